@@ -754,8 +754,9 @@ namespace EE
                 return false;
             }
 
-            // Create tools world
+            // Create tools world, workspace worlds are self-contained so can be updated alongside the other worlds
             auto pWorkspaceWorld = m_pWorldManager->CreateWorld( EntityWorldType::Tools );
+            pWorkspaceWorld->SetIndependentUpdateEnabled( true );
             m_pRenderingSystem->CreateCustomRenderTargetForViewport( pWorkspaceWorld->GetViewport(), true );
 
             // Create workspace
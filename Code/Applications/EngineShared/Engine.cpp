@@ -144,8 +144,9 @@ namespace EE
         }
 
         // Initialize rendering system
-        m_renderingSystem.Initialize( m_pRenderDevice, Float2( windowDimensions ), m_engineModule.GetRendererRegistry(), m_pEntityWorldManager );
+        m_renderingSystem.Initialize( m_pRenderDevice, m_pTaskSystem, Float2( windowDimensions ), m_engineModule.GetRendererRegistry(), m_pEntityWorldManager );
         m_pSystemRegistry->RegisterSystem( &m_renderingSystem );
+        m_renderingSystem.SetPipelinedRenderingEnabled( iniFile.GetBoolOrDefault( "Render:PipelinedRendering", false ) );
 
         // Create tools UI
         #if EE_DEVELOPMENT_TOOLS
@@ -326,6 +327,12 @@ namespace EE
                 {
                     EE_PROFILE_SCOPE_RESOURCE( "Resource System" );
 
+                    // The previous frame might still be rendering and referencing resources that are about to be unloaded
+                    if ( m_pResourceSystem->IsBusy() )
+                    {
+                        m_renderingSystem.WaitForRenderCompletion();
+                    }
+
                     m_pResourceSystem->Update();
 
                     // Handle hot-reloading of entities
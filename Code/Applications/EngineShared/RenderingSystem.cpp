@@ -5,6 +5,7 @@
 #include "Engine/Entity/EntityWorldManager.h"
 #include "Base/Render/RenderDevice.h"
 #include "Engine/UpdateContext.h"
+#include "Base/Threading/TaskSystem.h"
 #include "Base/Profiling.h"
 #include "Base/Math/ViewVolume.h"
 #include "Engine/Entity/EntityWorld.h"
@@ -32,6 +33,9 @@ namespace EE::Render
     {
         EE_ASSERT( pViewport != nullptr && pViewport->GetID().IsValid() );
 
+        // The in-flight frame might still be rendering into this target
+        WaitForRenderCompletion();
+
         auto pViewportRenderTarget = FindRenderTargetForViewport( pViewport );
         EE_ASSERT( pViewportRenderTarget != nullptr );
         EE_ASSERT( pViewportRenderTarget->m_pRenderTarget != nullptr && pViewportRenderTarget->m_pRenderTarget->IsValid() );
@@ -88,15 +92,17 @@ namespace EE::Render
 
     //-------------------------------------------------------------------------
 
-    void RenderingSystem::Initialize( RenderDevice* pRenderDevice, Float2 primaryWindowDimensions, RendererRegistry* pRegistry, EntityWorldManager* pWorldManager )
+    void RenderingSystem::Initialize( RenderDevice* pRenderDevice, TaskSystem* pTaskSystem, Float2 primaryWindowDimensions, RendererRegistry* pRegistry, EntityWorldManager* pWorldManager )
     {
         EE_ASSERT( m_pRenderDevice == nullptr );
-        EE_ASSERT( pRenderDevice != nullptr && pRegistry != nullptr );
+        EE_ASSERT( pRenderDevice != nullptr && pTaskSystem != nullptr && pRegistry != nullptr );
         EE_ASSERT( pWorldManager != nullptr );
 
         m_pRenderDevice = pRenderDevice;
         m_pWorldManager = pWorldManager;
 
+        m_framePipeline.Initialize( pTaskSystem, [this] ( RenderFramePacket const& packet, bool isPipelined ) { RenderFrame( packet, isPipelined ); } );
+
         // Set initial render device size
         //-------------------------------------------------------------------------
 
@@ -171,6 +177,8 @@ namespace EE::Render
 
     void RenderingSystem::Shutdown()
     {
+        m_framePipeline.Shutdown();
+
         // Destroy any viewport render targets created
         //-------------------------------------------------------------------------
 
@@ -193,6 +201,7 @@ namespace EE::Render
         m_pImguiRenderer = nullptr;
         #endif
 
+        m_extractedWorlds.clear();
         m_pWorldManager = nullptr;
         m_pRenderDevice = nullptr;
     }
@@ -202,6 +211,8 @@ namespace EE::Render
         Float2 const newWindowDimensions = Float2( newMainWindowDimensions );
         Float2 const oldWindowDimensions = Float2( m_pRenderDevice->GetPrimaryWindowDimensions() );
 
+        WaitForRenderCompletion();
+
         //-------------------------------------------------------------------------
 
         m_pRenderDevice->LockDevice();
@@ -228,13 +239,43 @@ namespace EE::Render
         EE_ASSERT( ctx.GetUpdateStage() == UpdateStage::FrameEnd );
         EE_PROFILE_SCOPE_RENDER( "Rendering Post-Physics" );
 
+        // Extract the frame into the packet that isnt being rendered
         //-------------------------------------------------------------------------
 
-        m_pRenderDevice->LockDevice();
+        m_framePipeline.ExtractFrame( [this, &ctx] ( RenderFramePacket& packet ) { ExtractFrame( ctx, packet ); } );
+
+        // Wait for the previous frame
+        //-------------------------------------------------------------------------
+
+        m_framePipeline.WaitForPreviousFrame();
+
+        #if EE_DEVELOPMENT_TOOLS
+        if ( m_pImguiRenderer != nullptr )
+        {
+            m_pRenderDevice->LockDevice();
+            m_pImguiRenderer->UpdatePlatformWindows();
+            m_pRenderDevice->UnlockDevice();
+        }
+        #endif
+
+        // Render
+        //-------------------------------------------------------------------------
+
+        m_framePipeline.SubmitFrame( CanPipelineFrame() );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderingSystem::ExtractFrame( UpdateContext const& ctx, RenderFramePacket& packet )
+    {
+        EE_PROFILE_SCOPE_RENDER( "Render Extraction" );
+
+        packet.Reset( ctx.GetDeltaTime() );
+        m_extractedWorlds.clear();
 
         RenderTarget* pPrimaryRT = m_pRenderDevice->GetPrimaryWindowRenderTarget();
 
-        // Render into active viewports
+        // Extract active worlds
         //-------------------------------------------------------------------------
 
         for ( auto pWorld : m_pWorldManager->GetWorlds() )
@@ -246,19 +287,91 @@ namespace EE::Render
 
             Render::Viewport* pViewport = pWorld->GetViewport();
 
-            // Set and clear render target
-            //-------------------------------------------------------------------------
+            WorldRenderPacket& worldPacket = packet.AddWorld();
+            m_extractedWorlds.emplace_back( pWorld );
 
-            RenderTarget* pViewportRT = pPrimaryRT;
             ViewportRenderTarget const* pVRT = FindRenderTargetForViewport( pViewport );
-            if ( pVRT != nullptr )
+            worldPacket.m_pRenderTarget = ( pVRT != nullptr ) ? pVRT->m_pRenderTarget : pPrimaryRT;
+            worldPacket.m_clearRenderTarget = ( pVRT != nullptr );
+
+            m_pWorldRenderer->ExtractWorld( *pViewport, pWorld, worldPacket );
+
+            #if EE_DEVELOPMENT_TOOLS
+            if ( pViewport->IsValid() )
             {
-                pViewportRT = pVRT->m_pRenderTarget;
+                m_pDebugRenderer->ExtractWorld( ctx.GetDeltaTime(), pWorld, worldPacket.m_debugDrawCommands );
+            }
+            #endif
+        }
+
+        // Extract development UI
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        packet.m_pToolsRenderTarget = pPrimaryRT;
 
+        if ( m_pImguiRenderer != nullptr )
+        {
+            m_pImguiRenderer->ExtractDrawData( packet.m_imgui );
+        }
+        #endif
+    }
+
+    bool RenderingSystem::CanPipelineFrame() const
+    {
+        if ( !m_framePipeline.IsPipeliningEnabled() )
+        {
+            return false;
+        }
+
+        // Custom renderers read directly from the world, so if any of them have work to do we need to render synchronously
+        for ( auto const& pCustomRenderer : m_customRenderers )
+        {
+            for ( auto pWorld : m_extractedWorlds )
+            {
+                if ( pCustomRenderer->RequiresWorldAccess( pWorld ) )
+                {
+                    return false;
+                }
+            }
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        if ( m_pImguiRenderer != nullptr && m_pImguiRenderer->HasPlatformWindowsToRender() )
+        {
+            return false;
+        }
+        #endif
+
+        return true;
+    }
+
+    void RenderingSystem::RenderFrame( RenderFramePacket const& packet, bool isPipelined )
+    {
+        EE_PROFILE_SCOPE_RENDER( "Render Frame" );
+
+        m_pRenderDevice->LockDevice();
+
+        // Render into active viewports
+        //-------------------------------------------------------------------------
+
+        for ( int32_t i = 0; i < packet.m_numWorlds; i++ )
+        {
+            WorldRenderPacket const& worldPacket = packet.m_worlds[i];
+            Viewport const& viewport = worldPacket.m_viewport;
+
+            // Set and clear render target
+            //-------------------------------------------------------------------------
+
+            RenderTarget* pViewportRT = worldPacket.m_pRenderTarget;
+            EE_ASSERT( pViewportRT != nullptr );
+
+            if ( worldPacket.m_clearRenderTarget )
+            {
                 // Resize render target if needed
-                if ( Int2( pViewport->GetDimensions() ) != pViewportRT->GetDimensions() )
+                if ( Int2( viewport.GetDimensions() ) != pViewportRT->GetDimensions() )
                 {
-                    m_pRenderDevice->ResizeRenderTarget( *pViewportRT, pViewport->GetDimensions() );
+                    m_pRenderDevice->ResizeRenderTarget( *pViewportRT, viewport.GetDimensions() );
                 }
 
                 // Clear render target and depth stencil textures
@@ -268,17 +381,21 @@ namespace EE::Render
             // Draw
             //-------------------------------------------------------------------------
 
-            m_pWorldRenderer->RenderWorld( ctx.GetDeltaTime(), *pViewport, *pViewportRT, pWorld );
+            m_pWorldRenderer->RenderPacket( worldPacket, *pViewportRT );
 
-            for ( auto const& pCustomRenderer : m_customRenderers )
+            if ( !isPipelined )
             {
-                pCustomRenderer->RenderWorld( ctx.GetDeltaTime(), *pViewport, *pViewportRT, pWorld );
-                pCustomRenderer->RenderViewport( ctx.GetDeltaTime(), *pViewport, *pViewportRT );
+                EntityWorld* pWorld = m_extractedWorlds[i];
+                for ( auto const& pCustomRenderer : m_customRenderers )
+                {
+                    pCustomRenderer->RenderWorld( packet.m_deltaTime, viewport, *pViewportRT, pWorld );
+                    pCustomRenderer->RenderViewport( packet.m_deltaTime, viewport, *pViewportRT );
+                }
             }
 
             #if EE_DEVELOPMENT_TOOLS
-            m_pDebugRenderer->RenderWorld( ctx.GetDeltaTime(), *pViewport, *pViewportRT, pWorld );
-            m_pDebugRenderer->RenderViewport( ctx.GetDeltaTime(), *pViewport, *pViewportRT );
+            m_pDebugRenderer->RenderCommands( viewport, *pViewportRT, worldPacket.m_debugDrawCommands );
+            m_pDebugRenderer->RenderViewport( packet.m_deltaTime, viewport, *pViewportRT );
             #endif
         }
 
@@ -288,7 +405,12 @@ namespace EE::Render
         #if EE_DEVELOPMENT_TOOLS
         if ( m_pImguiRenderer != nullptr )
         {
-            m_pImguiRenderer->RenderViewport( ctx.GetDeltaTime(), m_toolsViewport, *pPrimaryRT );
+            m_pImguiRenderer->RenderPacket( packet.m_imgui, *packet.m_pToolsRenderTarget );
+
+            if ( !isPipelined )
+            {
+                m_pImguiRenderer->RenderPlatformWindows();
+            }
         }
         #endif
 
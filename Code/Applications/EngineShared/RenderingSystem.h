@@ -1,18 +1,24 @@
 #pragma once
 
 #include "Engine/Render/RendererRegistry.h"
+#include "Engine/Render/RenderFramePipeline.h"
 #include "Base/Render/RenderViewport.h"
+#include "Base/Threading/TaskSystem.h"
 #include "Base/Systems.h"
 
 //-------------------------------------------------------------------------
 // EE Renderer System
 //-------------------------------------------------------------------------
 // This class allows us to define the exact rendering order and task scheduling for a frame
+// Each frame is first extracted into a frame packet on the main thread and then rendered from that packet
+// When pipelining is enabled, the packet is rendered on a dedicated worker while the next frame is simulated
 
 namespace EE
 {
     class UpdateContext;
+    class EntityWorld;
     class EntityWorldManager;
+    class TaskSystem;
 
     //-------------------------------------------------------------------------
 
@@ -47,12 +53,24 @@ namespace EE
 
         public:
 
-            void Initialize( RenderDevice* pRenderDevice, Float2 primaryWindowDimensions, RendererRegistry* pRegistry, EntityWorldManager* pWorldManager );
+            void Initialize( RenderDevice* pRenderDevice, TaskSystem* pTaskSystem, Float2 primaryWindowDimensions, RendererRegistry* pRegistry, EntityWorldManager* pWorldManager );
             void Shutdown();
 
             void ResizePrimaryRenderTarget( Int2 newMainWindowDimensions );
             void Update( UpdateContext const& ctx );
 
+            // Pipelining
+            //-------------------------------------------------------------------------
+
+            // Should we render each frame while simulating the next one, frames that need renderers that read directly from the world will still be rendered synchronously
+            inline void SetPipelinedRenderingEnabled( bool isEnabled ) { m_framePipeline.SetPipeliningEnabled( isEnabled ); }
+            inline bool IsPipelinedRenderingEnabled() const { return m_framePipeline.IsPipeliningEnabled(); }
+
+            // Block until the in-flight frame (if any) has completed rendering, needs to be called before freeing any resources a frame packet might reference
+            inline void WaitForRenderCompletion() { m_framePipeline.WaitForRenderCompletion(); }
+
+            inline FramePipeline::FrameStats const& GetFrameStats() const { return m_framePipeline.GetFrameStats(); }
+
             //-------------------------------------------------------------------------
 
             void CreateCustomRenderTargetForViewport( Viewport const* pViewport, bool requiresPickingBuffer = false );
@@ -63,6 +81,10 @@ namespace EE
 
         private:
 
+            void ExtractFrame( UpdateContext const& ctx, RenderFramePacket& packet );
+            bool CanPipelineFrame() const;
+            void RenderFrame( RenderFramePacket const& packet, bool isPipelined );
+
             ViewportRenderTarget* FindRenderTargetForViewport( Viewport const* pViewport );
             inline ViewportRenderTarget const* FindRenderTargetForViewport( Viewport const* pViewport ) const { return const_cast<RenderingSystem*>( this )->FindRenderTargetForViewport( pViewport ); }
 
@@ -75,6 +97,10 @@ namespace EE
 
             TInlineVector<ViewportRenderTarget, 5>          m_viewportRenderTargets;
 
+            // Frame packets
+            FramePipeline                                   m_framePipeline;
+            TInlineVector<EntityWorld*, 5>                  m_extractedWorlds;          // The worlds for the last extracted packet, only used for synchronous frames
+
             //-------------------------------------------------------------------------
 
             #if EE_DEVELOPMENT_TOOLS
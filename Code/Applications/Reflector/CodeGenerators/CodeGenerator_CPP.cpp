@@ -153,6 +153,8 @@ namespace EE::CPP
             typeRegistrationStr << "            " << module.m_moduleClassName.c_str() << "::RegisterTypes( typeRegistry );\n";
         }
 
+        typeRegistrationStr << "\n";
+        typeRegistrationStr << "            typeRegistry.UpdateTypeHierarchy();\n";
         typeRegistrationStr << "\n";
 
         if ( !registeredResourceTypes.empty() )
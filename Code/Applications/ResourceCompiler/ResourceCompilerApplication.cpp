@@ -6,6 +6,7 @@
 #include "Base/ThirdParty/cmdParser/cmdParser.h"
 #include "Base/Resource/ResourceSettings.h"
 #include "Base/FileSystem/FileSystemUtils.h"
+#include "Base/Threading/Threading.h"
 #include "Base/IniFile.h"
 
 
@@ -158,10 +159,12 @@ namespace EE::Resource
     //-------------------------------------------------------------------------
 
     ResourceCompilerApplication::ResourceCompilerApplication( CommandLineArgumentParser& argParser, ResourceSettings const& settings )
-        : m_compileContext( settings.m_rawResourcePath, argParser.m_isForPackagedBuild ? settings.m_packagedBuildCompiledResourcePath : settings.m_compiledResourcePath, argParser.m_resourceID, argParser.m_isForPackagedBuild )
+        : m_taskSystem( Threading::GetProcessorInfo().m_numPhysicalCores - 1 )
+        , m_compileContext( settings.m_rawResourcePath, argParser.m_isForPackagedBuild ? settings.m_packagedBuildCompiledResourcePath : settings.m_compiledResourcePath, argParser.m_resourceID, argParser.m_isForPackagedBuild )
         , m_forceCompilation( argParser.m_isForcedCompilation )
     {
         AutoGenerated::Tools::RegisterTypes( m_typeRegistry );
+        m_taskSystem.Initialize();
         m_pCompilerRegistry = EE::New<CompilerRegistry>( m_typeRegistry, settings.m_rawResourcePath );
 
         //-------------------------------------------------------------------------
@@ -169,6 +172,10 @@ namespace EE::Resource
         m_compileContext.m_rawResourceDirectoryPath.EnsureDirectoryExists();
         m_compileContext.m_compiledResourceDirectoryPath.EnsureDirectoryExists();
 
+        // Raw assets are always cached in the development compiled data directory, so that they are shared with packaging
+        m_compileContext.m_rawAssetCacheDirectoryPath = settings.m_compiledResourcePath + "RawAssetCache/";
+        m_compileContext.m_pTaskSystem = &m_taskSystem;
+
         //-------------------------------------------------------------------------
 
         m_compiledResourceDB.Connect( settings.m_compiledResourceDatabasePath );
@@ -178,6 +185,7 @@ namespace EE::Resource
     {
         m_compileDependencyTreeRoot.DestroyDependencies();
         EE::Delete( m_pCompilerRegistry );
+        m_taskSystem.Shutdown();
         AutoGenerated::Tools::UnregisterTypes( m_typeRegistry );
     }
 
@@ -2,6 +2,7 @@
 #include "EngineTools/Resource/ResourceCompiler.h"
 #include "CompiledResourceDatabase.h"
 #include "Base/TypeSystem/TypeRegistry.h"
+#include "Base/Threading/TaskSystem.h"
 
 //-------------------------------------------------------------------------
 
@@ -67,6 +68,7 @@ namespace EE::Resource
     private:
 
         TypeSystem::TypeRegistry                m_typeRegistry;
+        TaskSystem                              m_taskSystem;
         CompiledResourceDatabase                m_compiledResourceDB;
         CompilerRegistry*                       m_pCompilerRegistry = nullptr;
         CompileContext                          m_compileContext;
@@ -1,5 +1,6 @@
 #pragma once
 #include "Base/Resource/ResourceID.h"
+#include "Base/Resource/ResourceProviders/ResourceNetworkMessages.h"
 #include "Base/Time/Time.h"
 #include "Base/Types/UUID.h"
 #include "Base/Time/Timestamp.h"
@@ -45,6 +46,9 @@ namespace EE::Resource
         // Returns whether the request was externally requested (i.e. by a client) or internally requested (i.e. due to a file changing and being detected)
         inline bool IsInternalRequest() const { return m_origin != Origin::External; }
 
+        // Does the client already have the compiled data for this request cached
+        inline bool IsClientDataUpToDate() const { return m_clientDataHash != 0 && m_clientDataHash == m_compiledDataHash; }
+
         // Do we require a force recompile of this resource even if it's up to date
         inline bool RequiresForcedRecompiliation() const { return m_origin == Origin::ManualCompileForced || m_origin == Origin::Package; }
 
@@ -90,6 +94,12 @@ namespace EE::Resource
         FileSystem::Path                    m_destinationFile;
         String                              m_compilerArgs;
 
+        uint64_t                            m_clientDataHash = 0; // The hash of the compiled data the client has cached, if any
+        uint64_t                            m_compiledDataHash = 0; // Only calculated for external requests
+        uint64_t                            m_compileKey = 0; // Only calculated for external requests
+        uint32_t                            m_compiledDataSize = 0;
+        NetworkRequestPriority              m_priority = NetworkRequestPriority::Normal;
+
         TimeStamp                           m_timeRequested;
         Nanoseconds                         m_compilationTimeStarted = 0;
         Nanoseconds                         m_compilationTimeFinished = 0;
@@ -0,0 +1,349 @@
+#include "ResourcePackaging.h"
+#include "EngineTools/Resource/ResourceCompilerRegistry.h"
+#include "EngineTools/Resource/ResourceDescriptor.h"
+#include "Base/FileSystem/FileSystem.h"
+#include "Base/Encoding/Hash.h"
+#include <eastl/sort.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    namespace
+    {
+        // Tarjan's strongly connected components, only considering the waiting nodes
+        struct WaitingNodeComponentFinder
+        {
+            WaitingNodeComponentFinder( TVector<PackagingNode> const& nodes )
+                : m_nodes( nodes )
+                , m_visitIndices( nodes.size(), -1 )
+                , m_lowLinks( nodes.size(), 0 )
+                , m_componentIndices( nodes.size(), -1 )
+                , m_isOnStack( nodes.size(), false )
+            {
+                int32_t const numNodes = (int32_t) m_nodes.size();
+                for ( int32_t i = 0; i < numNodes; i++ )
+                {
+                    if ( IsWaiting( i ) && m_visitIndices[i] == -1 )
+                    {
+                        Visit( i );
+                    }
+                }
+            }
+
+            inline bool IsWaiting( int32_t nodeIdx ) const { return m_nodes[nodeIdx].m_state == PackagingNode::State::Waiting; }
+
+            void Visit( int32_t nodeIdx )
+            {
+                m_visitIndices[nodeIdx] = m_lowLinks[nodeIdx] = m_numVisited++;
+                m_stack.emplace_back( nodeIdx );
+                m_isOnStack[nodeIdx] = true;
+
+                for ( int32_t dependencyIdx : m_nodes[nodeIdx].m_dependencies )
+                {
+                    if ( !IsWaiting( dependencyIdx ) )
+                    {
+                        continue;
+                    }
+
+                    if ( m_visitIndices[dependencyIdx] == -1 )
+                    {
+                        Visit( dependencyIdx );
+                        m_lowLinks[nodeIdx] = Math::Min( m_lowLinks[nodeIdx], m_lowLinks[dependencyIdx] );
+                    }
+                    else if ( m_isOnStack[dependencyIdx] )
+                    {
+                        m_lowLinks[nodeIdx] = Math::Min( m_lowLinks[nodeIdx], m_visitIndices[dependencyIdx] );
+                    }
+                }
+
+                // Root of a component, pop all its nodes
+                if ( m_lowLinks[nodeIdx] == m_visitIndices[nodeIdx] )
+                {
+                    int32_t const componentIdx = (int32_t) m_components.size();
+                    TVector<int32_t>& component = m_components.emplace_back();
+
+                    int32_t poppedNodeIdx = -1;
+                    do
+                    {
+                        poppedNodeIdx = m_stack.back();
+                        m_stack.pop_back();
+                        m_isOnStack[poppedNodeIdx] = false;
+                        m_componentIndices[poppedNodeIdx] = componentIdx;
+                        component.emplace_back( poppedNodeIdx );
+                    }
+                    while ( poppedNodeIdx != nodeIdx );
+                }
+            }
+
+        public:
+
+            TVector<PackagingNode> const&       m_nodes;
+            TVector<int32_t>                    m_visitIndices;
+            TVector<int32_t>                    m_lowLinks;
+            TVector<int32_t>                    m_componentIndices;
+            TVector<bool>                       m_isOnStack;
+            TVector<int32_t>                    m_stack;
+            TVector<TVector<int32_t>>           m_components;
+            int32_t                             m_numVisited = 0;
+        };
+    }
+
+    TVector<TVector<int32_t>> FindBlockingDependencyCycles( TVector<PackagingNode> const& nodes )
+    {
+        WaitingNodeComponentFinder const finder( nodes );
+
+        TVector<TVector<int32_t>> cycles;
+        for ( int32_t componentIdx = 0; componentIdx < (int32_t) finder.m_components.size(); componentIdx++ )
+        {
+            TVector<int32_t> const& component = finder.m_components[componentIdx];
+
+            // A single node is only a cycle if it depends on itself
+            bool isCycle = component.size() > 1 || VectorContains( nodes[component[0]].m_dependencies, component[0] );
+            bool isBlocked = false;
+
+            for ( int32_t nodeIdx : component )
+            {
+                for ( int32_t dependencyIdx : nodes[nodeIdx].m_dependencies )
+                {
+                    isBlocked |= finder.IsWaiting( dependencyIdx ) && finder.m_componentIndices[dependencyIdx] != componentIdx;
+                }
+            }
+
+            if ( isCycle && !isBlocked )
+            {
+                TVector<int32_t>& cycle = cycles.emplace_back( component );
+                eastl::sort( cycle.begin(), cycle.end() );
+            }
+        }
+
+        return cycles;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool PackagingManifest::Load( FileSystem::Path const& manifestPath )
+    {
+        m_compileKeys.clear();
+
+        if ( !FileSystem::Exists( manifestPath ) )
+        {
+            return false;
+        }
+
+        Serialization::BinaryInputArchive archive;
+        if ( !archive.ReadFromFile( manifestPath ) )
+        {
+            return false;
+        }
+
+        int32_t version = 0;
+        TVector<Entry> entries;
+        archive << version;
+
+        // Ignore manifests from older versions, this will simply repackage everything
+        if ( version != s_version )
+        {
+            return false;
+        }
+
+        archive << entries;
+        for ( auto const& entry : entries )
+        {
+            m_compileKeys[entry.m_resourceID] = entry.m_compileKey;
+        }
+
+        return true;
+    }
+
+    bool PackagingManifest::Save( FileSystem::Path const& manifestPath ) const
+    {
+        TVector<Entry> entries;
+        entries.reserve( m_compileKeys.size() );
+        for ( auto const& compileKeyPair : m_compileKeys )
+        {
+            Entry& entry = entries.emplace_back();
+            entry.m_resourceID = compileKeyPair.first;
+            entry.m_compileKey = compileKeyPair.second;
+        }
+
+        Serialization::BinaryOutputArchive archive;
+        archive << s_version << entries;
+        return archive.WriteToFile( manifestPath );
+    }
+
+    uint64_t PackagingManifest::GetCompileKey( ResourceID const& resourceID ) const
+    {
+        auto iter = m_compileKeys.find( resourceID );
+        return ( iter != m_compileKeys.end() ) ? iter->second : 0;
+    }
+
+    //-------------------------------------------------------------------------
+
+    CompileKeyGenerator::CompileKeyGenerator( TypeSystem::TypeRegistry const& typeRegistry, CompilerRegistry const& compilerRegistry, FileSystem::Path const& rawResourcePath )
+        : m_typeRegistry( typeRegistry )
+        , m_compilerRegistry( compilerRegistry )
+        , m_rawResourcePath( rawResourcePath )
+    {}
+
+    uint64_t CompileKeyGenerator::GetCompileKey( ResourceID const& resourceID )
+    {
+        EE_ASSERT( resourceID.IsValid() );
+
+        auto iter = m_compileKeys.find( resourceID );
+        if ( iter != m_compileKeys.end() )
+        {
+            return iter->second;
+        }
+
+        //-------------------------------------------------------------------------
+
+        VisitResource( resourceID );
+        EE_ASSERT( m_nodeStack.empty() );
+
+        m_nodes.clear();
+        m_nodeIndices.clear();
+
+        return m_compileKeys[resourceID];
+    }
+
+    int32_t CompileKeyGenerator::VisitResource( ResourceID const& resourceID )
+    {
+        int32_t const nodeIdx = (int32_t) m_nodes.size();
+        m_nodeIndices[resourceID] = nodeIdx;
+        m_nodeStack.emplace_back( nodeIdx );
+
+        Node& node = m_nodes.emplace_back();
+        node.m_resourceID = resourceID;
+        node.m_lowLink = nodeIdx;
+
+        //-------------------------------------------------------------------------
+
+        FileSystem::Path const sourcePath = ResourcePath::ToFileSystemPath( m_rawResourcePath, resourceID.GetResourcePath() );
+        bool const sourceExists = FileSystem::Exists( sourcePath );
+
+        node.m_keyData.emplace_back( resourceID.GetPathID() );
+        node.m_keyData.emplace_back( sourceExists ? FileSystem::GetFileModifiedTime( sourcePath ) : 0 );
+
+        auto pCompiler = m_compilerRegistry.GetCompilerForResourceType( resourceID.GetResourceTypeID() );
+        if ( pCompiler != nullptr )
+        {
+            node.m_keyData.emplace_back( (uint64_t) pCompiler->GetVersion() );
+
+            // Maps and navmeshes dont check their compile dependencies (see ResourceCompilerApplication::ShouldCheckCompileDependenciesForResourceType)
+            bool const checkCompileDependencies = sourceExists && resourceID.GetResourceTypeID() != ResourceTypeID( "map" ) && resourceID.GetResourceTypeID() != ResourceTypeID( "nav" );
+            if ( checkCompileDependencies )
+            {
+                auto pDescriptor = ResourceDescriptor::TryReadFromFile( m_typeRegistry, sourcePath );
+                if ( pDescriptor != nullptr )
+                {
+                    TVector<ResourceID> compileDependencies;
+                    pDescriptor->GetCompileDependencies( compileDependencies );
+                    EE::Delete( pDescriptor );
+
+                    for ( auto const& dependencyID : compileDependencies )
+                    {
+                        if ( dependencyID.IsValid() )
+                        {
+                            node.m_dependencies.emplace_back( dependencyID );
+                        }
+                    }
+                }
+            }
+        }
+
+        // Visit dependencies, the node reference is invalidated by the recursion so always access it via the index
+        //-------------------------------------------------------------------------
+
+        int32_t const numDependencies = (int32_t) m_nodes[nodeIdx].m_dependencies.size();
+        for ( int32_t i = 0; i < numDependencies; i++ )
+        {
+            ResourceID const dependencyID = m_nodes[nodeIdx].m_dependencies[i];
+            if ( m_compileKeys.find( dependencyID ) != m_compileKeys.end() )
+            {
+                continue;
+            }
+
+            auto indexIter = m_nodeIndices.find( dependencyID );
+            if ( indexIter == m_nodeIndices.end() )
+            {
+                int32_t const dependencyNodeIdx = VisitResource( dependencyID );
+                m_nodes[nodeIdx].m_lowLink = Math::Min( m_nodes[nodeIdx].m_lowLink, m_nodes[dependencyNodeIdx].m_lowLink );
+            }
+            else if ( m_nodes[indexIter->second].m_isOnStack )
+            {
+                m_nodes[nodeIdx].m_lowLink = Math::Min( m_nodes[nodeIdx].m_lowLink, indexIter->second );
+            }
+        }
+
+        // If this is the root of a strongly connected component then all its dependencies are known
+        if ( m_nodes[nodeIdx].m_lowLink == nodeIdx )
+        {
+            CalculateCompileKeys( nodeIdx );
+        }
+
+        return nodeIdx;
+    }
+
+    void CompileKeyGenerator::CalculateCompileKeys( int32_t rootNodeIdx )
+    {
+        // Nodes are pushed in visitation order, so the component is every node on the stack from the root onwards
+        TInlineVector<int32_t, 8> componentNodes;
+        while ( !m_nodeStack.empty() && m_nodeStack.back() >= rootNodeIdx )
+        {
+            componentNodes.emplace_back( m_nodeStack.back() );
+            m_nodes[m_nodeStack.back()].m_isOnStack = false;
+            m_nodeStack.pop_back();
+        }
+
+        // No cycle, the key is calculated from the resource and its dependencies' keys
+        //-------------------------------------------------------------------------
+
+        Node const& rootNode = m_nodes[rootNodeIdx];
+        if ( componentNodes.size() == 1 && !VectorContains( rootNode.m_dependencies, rootNode.m_resourceID ) )
+        {
+            TInlineVector<uint64_t, 16> keyData( rootNode.m_keyData.begin(), rootNode.m_keyData.end() );
+            for ( auto const& dependencyID : rootNode.m_dependencies )
+            {
+                keyData.emplace_back( m_compileKeys[dependencyID] );
+            }
+
+            m_compileKeys[rootNode.m_resourceID] = Hash::XXHash::GetHash64( keyData.data(), keyData.size() * sizeof( uint64_t ) );
+            return;
+        }
+
+        // Cycle, calculate a single key from all the members and their dependencies outside the cycle
+        // Members are sorted so that the key doesnt depend on which member the traversal started from
+        //-------------------------------------------------------------------------
+
+        auto SortPredicate = [this] ( int32_t a, int32_t b ) { return strcmp( m_nodes[a].m_resourceID.c_str(), m_nodes[b].m_resourceID.c_str() ) < 0; };
+        eastl::sort( componentNodes.begin(), componentNodes.end(), SortPredicate );
+
+        TInlineVector<uint64_t, 16> cycleKeyData;
+        for ( int32_t nodeIdx : componentNodes )
+        {
+            cycleKeyData.insert( cycleKeyData.end(), m_nodes[nodeIdx].m_keyData.begin(), m_nodes[nodeIdx].m_keyData.end() );
+        }
+
+        for ( int32_t nodeIdx : componentNodes )
+        {
+            for ( auto const& dependencyID : m_nodes[nodeIdx].m_dependencies )
+            {
+                auto keyIter = m_compileKeys.find( dependencyID );
+                if ( keyIter != m_compileKeys.end() )
+                {
+                    cycleKeyData.emplace_back( keyIter->second );
+                }
+            }
+        }
+
+        uint64_t const cycleKey = Hash::XXHash::GetHash64( cycleKeyData.data(), cycleKeyData.size() * sizeof( uint64_t ) );
+
+        // Each member still needs a unique key
+        for ( int32_t nodeIdx : componentNodes )
+        {
+            uint64_t const keyData[2] = { m_nodes[nodeIdx].m_resourceID.GetPathID(), cycleKey };
+            m_compileKeys[m_nodes[nodeIdx].m_resourceID] = Hash::XXHash::GetHash64( keyData, sizeof( keyData ) );
+        }
+    }
+}
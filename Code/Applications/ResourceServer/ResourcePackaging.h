@@ -0,0 +1,150 @@
+#pragma once
+
+#include "ResourceCompilationRequest.h"
+#include "Base/Resource/ResourceID.h"
+#include "Base/Serialization/BinarySerialization.h"
+#include "Base/Types/HashMap.h"
+#include "Base/Types/Arrays.h"
+#include "Base/Time/Time.h"
+
+//-------------------------------------------------------------------------
+// Packaging
+//-------------------------------------------------------------------------
+// Packaging builds a graph of all the resources needed by the selected maps, where the edges are the runtime (install) dependencies of each resource
+// Resources are compiled in dependency order, a resource is only scheduled once all the resources it depends on have been packaged
+//
+// Every packaged resource has a compile key (compiler version and the timestamps of the resource and all its compile dependencies)
+// The keys of the last package are stored in a manifest alongside the packaged data, so only resources whose key changed need to be repackaged
+
+namespace EE::TypeSystem { class TypeRegistry; }
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    class CompilerRegistry;
+
+    //-------------------------------------------------------------------------
+
+    struct PackagingNode
+    {
+        enum class State : uint8_t
+        {
+            Waiting,
+            Compiling,
+            Complete
+        };
+
+    public:
+
+        ResourceID                              m_resourceID;
+        uint64_t                                m_compileKey = 0;
+        TVector<int32_t>                        m_dependencies;
+        TVector<int32_t>                        m_dependents;
+        CompilationRequest const*               m_pRequest = nullptr;       // Only set while compiling
+        Milliseconds                            m_compileTime = 0;
+        Milliseconds                            m_criticalPathTime = 0;     // The longest chain of compile times that ends with this node
+        int32_t                                 m_numUnresolvedDependencies = 0;
+        State                                   m_state = State::Waiting;
+        bool                                    m_wasUpToDate = false;
+        bool                                    m_hasSucceeded = false;
+    };
+
+    // Finds the install dependency cycles that are blocking packaging, i.e. the cycles of waiting nodes that dont depend on any waiting node outside the cycle
+    // Each cycle is returned as the indices of its nodes, nodes that depend on a cycle are not included since they can be scheduled once the cycle is resolved
+    TVector<TVector<int32_t>> FindBlockingDependencyCycles( TVector<PackagingNode> const& nodes );
+
+    //-------------------------------------------------------------------------
+
+    struct PackagingStats
+    {
+        // The number of resources compiled per second
+        inline float GetThroughput() const { return ( m_totalTime > 0 ) ? m_numCompiled / Seconds( m_totalTime ).ToFloat() : 0.0f; }
+
+    public:
+
+        Milliseconds                            m_preparationTime = 0;
+        Milliseconds                            m_totalTime = 0;
+        Milliseconds                            m_totalCompileTime = 0;     // The sum of all compile times
+        Milliseconds                            m_criticalPathTime = 0;     // The lower bound of the packaging time given infinite workers
+        int32_t                                 m_numResources = 0;
+        int32_t                                 m_numCompiled = 0;
+        int32_t                                 m_numUpToDate = 0;
+        int32_t                                 m_numFailed = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // The compile keys for all the resources in the last package
+    class PackagingManifest
+    {
+        constexpr static int32_t const s_version = 1;
+
+        struct Entry
+        {
+            EE_SERIALIZE( m_resourceID, m_compileKey );
+
+            ResourceID                          m_resourceID;
+            uint64_t                            m_compileKey = 0;
+        };
+
+    public:
+
+        bool Load( FileSystem::Path const& manifestPath );
+        bool Save( FileSystem::Path const& manifestPath ) const;
+
+        inline void Clear() { m_compileKeys.clear(); }
+
+        // Returns 0 if the resource was not packaged
+        uint64_t GetCompileKey( ResourceID const& resourceID ) const;
+        inline void SetCompileKey( ResourceID const& resourceID, uint64_t compileKey ) { m_compileKeys[resourceID] = compileKey; }
+        inline void Remove( ResourceID const& resourceID ) { m_compileKeys.erase( resourceID ); }
+
+    private:
+
+        THashMap<ResourceID, uint64_t>          m_compileKeys;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Calculates compile keys, this mirrors the up-to-date check in the resource compiler
+    // Resources that (indirectly) compile against each other form a cycle, all the resources in a cycle share a key calculated from the whole cycle
+    class CompileKeyGenerator
+    {
+        // A resource visited while calculating keys, cycles are found as strongly connected components (Tarjan) of the compile dependency graph
+        struct Node
+        {
+            ResourceID                          m_resourceID;
+            TInlineVector<uint64_t, 3>          m_keyData;              // Path ID, source timestamp and compiler version
+            TVector<ResourceID>                 m_dependencies;
+            int32_t                             m_lowLink = 0;
+            bool                                m_isOnStack = true;
+        };
+
+    public:
+
+        CompileKeyGenerator( TypeSystem::TypeRegistry const& typeRegistry, CompilerRegistry const& compilerRegistry, FileSystem::Path const& rawResourcePath );
+
+        uint64_t GetCompileKey( ResourceID const& resourceID );
+
+    private:
+
+        // Visits a resource and all its uncalculated compile dependencies, returns the node index
+        int32_t VisitResource( ResourceID const& resourceID );
+
+        // Calculate the keys for the strongly connected component at the top of the stack, starting with the specified node
+        void CalculateCompileKeys( int32_t rootNodeIdx );
+
+    private:
+
+        TypeSystem::TypeRegistry const&         m_typeRegistry;
+        CompilerRegistry const&                 m_compilerRegistry;
+        FileSystem::Path const&                 m_rawResourcePath;
+        THashMap<ResourceID, uint64_t>          m_compileKeys;
+
+        // Traversal state, only valid during a GetCompileKey call
+        TVector<Node>                           m_nodes;
+        THashMap<ResourceID, int32_t>           m_nodeIndices;
+        TVector<int32_t>                        m_nodeStack;
+    };
+}
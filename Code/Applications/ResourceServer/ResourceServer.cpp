@@ -8,6 +8,8 @@
 #include "Base/IniFile.h"
 #include "Base/FileSystem/FileSystem.h"
 #include "Base/FileSystem/FileSystemUtils.h"
+#include "Base/Encoding/Hash.h"
+#include <eastl/sort.h>
 
 //-------------------------------------------------------------------------
 
@@ -36,6 +38,9 @@ namespace EE::Resource
 
         inline CompilationRequest* GetRequest() const { return m_pRequest; }
 
+        // Get the compiled data, this is only loaded for client requests
+        inline Blob& GetCompiledData() { return m_compiledData; }
+
     private:
 
         virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
@@ -46,24 +51,35 @@ namespace EE::Resource
             {
                 EE_ASSERT( !m_pRequest->m_compilerArgs.empty() );
                 char const* processCommandLineArgs[6] = { m_context.m_compilerExecutablePath.c_str(), "-compile", m_pRequest->m_compilerArgs.c_str(), nullptr, nullptr, nullptr };
+                int32_t numArgs = 3;
 
                 // Set force compilation flag
                 if ( m_pRequest->RequiresForcedRecompiliation() )
                 {
-                    processCommandLineArgs[3] = "-force";
+                    processCommandLineArgs[numArgs++] = "-force";
                 }
 
                 // Set package flag for packing request
                 if ( m_pRequest->m_origin == CompilationRequest::Origin::Package )
                 {
-                    processCommandLineArgs[3] = "-package";
+                    processCommandLineArgs[numArgs++] = "-package";
                 }
 
-                // Start compiler process
+                // Calculate the compile key for client requests so that clients can later validate their cached data without a compile
+                // This is done before compiling so that any source changes during the compile will invalidate the key
                 //-------------------------------------------------------------------------
 
                 m_pRequest->m_compilationTimeStarted = PlatformClock::GetTime();
 
+                if ( m_pRequest->m_origin == CompilationRequest::Origin::External )
+                {
+                    CompileKeyGenerator compileKeyGenerator( *m_context.m_pTypeRegistry, *m_context.m_pCompilerRegistry, m_context.m_rawResourcePath );
+                    m_pRequest->m_compileKey = compileKeyGenerator.GetCompileKey( m_pRequest->m_resourceID );
+                }
+
+                // Start compiler process
+                //-------------------------------------------------------------------------
+
                 int32_t result = subprocess_create( processCommandLineArgs, subprocess_option_combined_stdout_stderr | subprocess_option_inherit_environment | subprocess_option_no_window, &m_subProcess );
                 if ( result != 0 )
                 {
@@ -133,6 +149,24 @@ namespace EE::Resource
                 //-------------------------------------------------------------------------
 
                 subprocess_destroy( &m_subProcess );
+
+                // Load the compiled data for client requests so that it can be streamed back
+                //-------------------------------------------------------------------------
+
+                if ( m_pRequest->m_origin == CompilationRequest::Origin::External && m_pRequest->HasSucceeded() )
+                {
+                    if ( FileSystem::LoadFile( m_pRequest->m_destinationFile, m_compiledData ) && !m_compiledData.empty() )
+                    {
+                        m_pRequest->m_compiledDataHash = Hash::GetHash64( m_compiledData );
+                        m_pRequest->m_compiledDataSize = (uint32_t) m_compiledData.size();
+                    }
+                    else
+                    {
+                        m_pRequest->m_status = CompilationRequest::Status::Failed;
+                        m_pRequest->m_log += "Failed to read compiled data!";
+                        m_compiledData.clear();
+                    }
+                }
             }
         }
 
@@ -141,10 +175,70 @@ namespace EE::Resource
         ResourceServerContext const&                        m_context;
         CompilationRequest*                                 m_pRequest = nullptr;
         subprocess_s                                        m_subProcess;
+        Blob                                                m_compiledData;
     };
 
     //-------------------------------------------------------------------------
 
+    // Validates a client's cached data by comparing the compile keys it was compiled with against the compile keys for the current sources
+    // Nothing is compiled and no compiled data is loaded, only the source descriptors and timestamps are read
+    class CacheValidationTask final : public ITaskSet
+    {
+    public:
+
+        CacheValidationTask( ResourceServerContext const& context, uint32_t clientID, NetworkCacheValidationRequest&& request )
+            : ITaskSet( 1 )
+            , m_context( context )
+            , m_clientID( clientID )
+            , m_request( eastl::move( request ) )
+        {
+            EE_ASSERT( m_context.IsValid() );
+            EE_ASSERT( m_clientID != 0 );
+        }
+
+        inline uint32_t GetClientID() const { return m_clientID; }
+        inline int32_t GetNumEntries() const { return (int32_t) m_request.m_entries.size(); }
+        inline NetworkCacheValidationResponse const& GetResponse() const { return m_response; }
+        inline Milliseconds GetValidationTime() const { return m_validationTime; }
+
+    private:
+
+        virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+        {
+            ScopedTimer<PlatformClock> timer( m_validationTime );
+
+            CompileKeyGenerator compileKeyGenerator( *m_context.m_pTypeRegistry, *m_context.m_pCompilerRegistry, m_context.m_rawResourcePath );
+            for ( auto const& entry : m_request.m_entries )
+            {
+                if ( m_context.m_isExiting )
+                {
+                    return;
+                }
+
+                if ( !entry.m_resourceID.IsValid() || entry.m_compileKey == 0 )
+                {
+                    continue;
+                }
+
+                if ( compileKeyGenerator.GetCompileKey( entry.m_resourceID ) == entry.m_compileKey )
+                {
+                    m_response.m_validResourceIDs.emplace_back( entry.m_resourceID );
+                }
+            }
+        }
+
+    private:
+
+        ResourceServerContext const&            m_context;
+        uint32_t                                m_clientID = 0;
+        NetworkCacheValidationRequest           m_request;
+        NetworkCacheValidationResponse          m_response;
+        Milliseconds                            m_validationTime = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Builds the packaging graph for a set of maps and calculates the compile keys for all the resources in it
     class PackagingTask final : public ITaskSet
     {
     public:
@@ -157,55 +251,92 @@ namespace EE::Resource
             EE_ASSERT( m_context.IsValid() );
         }
 
-        inline TVector<ResourceID> const& GetRuntimeDependencies() const { return m_runtimeDependencies; }
+        inline TVector<PackagingNode>& GetPackagingNodes() { return m_nodes; }
 
     private:
 
         virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
         {
-            EngineModule::GetListOfAllRequiredModuleResources( m_runtimeDependencies );
-            GameModule::GetListOfAllRequiredModuleResources( m_runtimeDependencies );
+            TVector<ResourceID> moduleResources;
+            EngineModule::GetListOfAllRequiredModuleResources( moduleResources );
+            GameModule::GetListOfAllRequiredModuleResources( moduleResources );
 
-            //-------------------------------------------------------------------------
+            for ( auto const& resourceID : moduleResources )
+            {
+                EnqueueResourceForPackaging( resourceID );
+            }
 
             for ( auto const& mapID : m_mapsToBePackaged )
             {
                 EnqueueResourceForPackaging( mapID );
             }
+
+            // Calculate compile keys
+            //-------------------------------------------------------------------------
+
+            CompileKeyGenerator compileKeyGenerator( *m_context.m_pTypeRegistry, *m_context.m_pCompilerRegistry, m_context.m_rawResourcePath );
+            for ( auto& node : m_nodes )
+            {
+                if ( m_context.m_isExiting )
+                {
+                    return;
+                }
+
+                node.m_compileKey = compileKeyGenerator.GetCompileKey( node.m_resourceID );
+            }
         }
 
-        void EnqueueResourceForPackaging( ResourceID const& resourceID )
+        // Returns the index of the node for the resource, InvalidIndex if the resource cant be packaged
+        int32_t EnqueueResourceForPackaging( ResourceID const& resourceID )
         {
-            if ( m_context.m_isExiting )
+            if ( m_context.m_isExiting || !resourceID.IsValid() )
             {
-                return;
+                return InvalidIndex;
+            }
+
+            auto nodeIter = m_nodeLookup.find( resourceID );
+            if ( nodeIter != m_nodeLookup.end() )
+            {
+                return nodeIter->second;
             }
 
             //-------------------------------------------------------------------------
 
             auto pCompiler = m_context.m_pCompilerRegistry->GetCompilerForResourceType( resourceID.GetResourceTypeID() );
-            if ( pCompiler != nullptr )
+            if ( pCompiler == nullptr )
             {
-                // Add resource for packaging
-                VectorEmplaceBackUnique( m_runtimeDependencies, resourceID );
+                return InvalidIndex;
+            }
+
+            // Add resource for packaging
+            int32_t const nodeIdx = (int32_t) m_nodes.size();
+            m_nodes.emplace_back().m_resourceID = resourceID;
+            m_nodeLookup.insert( TPair<ResourceID, int32_t>( resourceID, nodeIdx ) );
 
-                // Get all runtime install dependencies
-                TVector<ResourceID> referencedResources;
-                pCompiler->GetInstallDependencies( resourceID, referencedResources );
+            // Get all runtime install dependencies
+            TVector<ResourceID> referencedResources;
+            pCompiler->GetInstallDependencies( resourceID, referencedResources );
 
-                // Recursively enqueue all referenced resources
-                for ( auto const& referenceResourceID : referencedResources )
+            // Recursively enqueue all referenced resources, the node list might grow so we always access the nodes by index
+            for ( auto const& referenceResourceID : referencedResources )
+            {
+                int32_t const dependencyIdx = EnqueueResourceForPackaging( referenceResourceID );
+                if ( dependencyIdx != InvalidIndex && dependencyIdx != nodeIdx && !VectorContains( m_nodes[nodeIdx].m_dependencies, dependencyIdx ) )
                 {
-                    EnqueueResourceForPackaging( referenceResourceID );
+                    m_nodes[nodeIdx].m_dependencies.emplace_back( dependencyIdx );
+                    m_nodes[dependencyIdx].m_dependents.emplace_back( nodeIdx );
                 }
             }
+
+            return nodeIdx;
         }
 
     public:
 
         ResourceServerContext const&            m_context;
         TVector<ResourceID> const&              m_mapsToBePackaged;
-        TVector<ResourceID>                     m_runtimeDependencies;
+        TVector<PackagingNode>                  m_nodes;
+        THashMap<ResourceID, int32_t>           m_nodeLookup;
     };
 
     //-------------------------------------------------------------------------
@@ -279,8 +410,11 @@ namespace EE::Resource
 
         m_taskSystem.WaitForAll();
         ProcessCompletedRequests();
+        ProcessCompletedCacheValidations();
         m_taskSystem.Shutdown();
 
+        EE_ASSERT( m_cacheValidationTasks.empty() );
+
         EE_ASSERT( m_numScheduledTasks == 0 );
 
         // Packaging
@@ -333,15 +467,20 @@ namespace EE::Resource
         {
             auto ProcessIncomingMessages = [this] ( Network::IPC::Message const& message )
             {
+                uint32_t const clientID = message.GetClientConnectionID();
+
                 if ( message.GetMessageID() == (int32_t) NetworkMessageID::RequestResource )
                 {
-                    uint32_t const clientID = message.GetClientConnectionID();
                     NetworkResourceRequest networkRequest = message.GetData<NetworkResourceRequest>();
-                    for ( auto const& resourceID : networkRequest.m_resourceIDs )
+                    for ( auto const& clientRequest : networkRequest.m_requests )
                     {
-                        CreateResourceRequest( resourceID, clientID );
+                        CreateClientResourceRequest( clientID, clientRequest );
                     }
                 }
+                else if ( message.GetMessageID() == (int32_t) NetworkMessageID::ValidateCache )
+                {
+                    ScheduleCacheValidation( clientID, message.GetData<NetworkCacheValidationRequest>() );
+                }
             };
 
             m_networkServer.ProcessIncomingMessages( ProcessIncomingMessages );
@@ -356,39 +495,26 @@ namespace EE::Resource
 
             if ( m_pPackagingTask->GetIsComplete() )
             {
-                for ( auto const& resourceID : m_pPackagingTask->GetRuntimeDependencies() )
-                {
-                    m_packagingRequests.emplace_back( CreateResourceRequest( resourceID, 0, CompilationRequest::Origin::Package ) );
-                }
-
+                m_packagingNodes.swap( m_pPackagingTask->GetPackagingNodes() );
                 EE::Delete( m_pPackagingTask );
-                m_packagingStage = PackagingStage::Packaging;
+                StartPackagingCompilation();
             }
         }
         else if ( m_packagingStage == PackagingStage::Packaging )
         {
-            bool isComplete = true;
-
-            for ( auto pRequest : m_packagingRequests )
-            {
-                if ( !pRequest->IsComplete() )
-                {
-                    isComplete = false;
-                    break;
-                }
-            }
-
-            if ( isComplete )
-            {
-                m_packagingRequests.clear();
-                m_packagingStage = PackagingStage::Complete;
-            }
+            UpdatePackaging();
         }
 
         // Process completed requests
         //-------------------------------------------------------------------------
         
         ProcessCompletedRequests();
+        ProcessCompletedCacheValidations();
+
+        // Stream compiled data
+        //-------------------------------------------------------------------------
+
+        SendDataChunks();
 
         // Process cleanup request
         //-------------------------------------------------------------------------
@@ -397,6 +523,12 @@ namespace EE::Resource
         {
             for ( int32_t i = int32_t( m_requests.size() ) - 1; i >= 0; i-- )
             {
+                // The packaging graph references its in-flight requests
+                if ( IsPackaging() && m_requests[i]->m_origin == CompilationRequest::Origin::Package )
+                {
+                    continue;
+                }
+
                 if ( m_requests[i]->IsComplete() )
                 {
                     EE::Delete( m_requests[i] );
@@ -446,7 +578,7 @@ namespace EE::Resource
 
     bool ResourceServer::IsBusy() const
     {
-        return IsPackaging() || m_numScheduledTasks != 0;
+        return IsPackaging() || m_numScheduledTasks != 0 || !m_dataTransfers.empty() || !m_cacheValidationTasks.empty();
     }
 
     //-------------------------------------------------------------------------
@@ -454,6 +586,24 @@ namespace EE::Resource
     CompilationRequest* ResourceServer::CreateResourceRequest( ResourceID const& resourceID, uint32_t clientID, CompilationRequest::Origin origin )
     {
         CompilationRequest* pRequest = EE::New<CompilationRequest>();
+        InitializeRequest( pRequest, resourceID, clientID, origin );
+        ScheduleRequest( pRequest );
+        return pRequest;
+    }
+
+    CompilationRequest* ResourceServer::CreateClientResourceRequest( uint32_t clientID, NetworkResourceRequest::Request const& clientRequest )
+    {
+        CompilationRequest* pRequest = EE::New<CompilationRequest>();
+        InitializeRequest( pRequest, clientRequest.m_resourceID, clientID, CompilationRequest::Origin::External );
+        pRequest->m_clientDataHash = clientRequest.m_cachedDataHash;
+        pRequest->m_priority = clientRequest.m_priority;
+        ScheduleRequest( pRequest );
+        return pRequest;
+    }
+
+    void ResourceServer::InitializeRequest( CompilationRequest* pRequest, ResourceID const& resourceID, uint32_t clientID, CompilationRequest::Origin origin ) const
+    {
+        EE_ASSERT( pRequest != nullptr );
 
         if ( resourceID.IsValid() )
         {
@@ -487,22 +637,32 @@ namespace EE::Resource
         }
         else // Invalid resource ID
         {
+            pRequest->m_clientID = clientID;
+            pRequest->m_origin = origin;
+            pRequest->m_resourceID = resourceID;
             pRequest->m_log.sprintf( "Error: Invalid resource ID ( %s )", resourceID.c_str() );
             pRequest->m_status = CompilationRequest::Status::Failed;
         }
+    }
 
-        // Enqueue new request
-        //-------------------------------------------------------------------------
+    void ResourceServer::ScheduleRequest( CompilationRequest* pRequest )
+    {
+        EE_ASSERT( pRequest != nullptr );
 
         m_requests.emplace_back( pRequest );
         auto pTask = EE::New<CompilationTask>( m_context, pRequest );
+
+        // Prioritize requests that someone is actively waiting on
+        switch ( pRequest->m_priority )
+        {
+            case NetworkRequestPriority::High: pTask->m_Priority = enki::TASK_PRIORITY_HIGH; break;
+            case NetworkRequestPriority::Normal: pTask->m_Priority = enki::TASK_PRIORITY_MED; break;
+            case NetworkRequestPriority::Low: pTask->m_Priority = enki::TASK_PRIORITY_LOW; break;
+        }
+
         m_taskSystem.ScheduleTask( pTask );
         m_activeTasks.emplace_back( pTask );
         m_numScheduledTasks++;
-
-        //-------------------------------------------------------------------------
-
-        return pRequest;
     }
 
     void ResourceServer::ProcessCompletedRequests()
@@ -510,36 +670,29 @@ namespace EE::Resource
         // Create a bucket per connected client
         //-------------------------------------------------------------------------
 
+        // Limit each message to 64 results
+        constexpr static size_t const maxResultsPerMessage = 64;
+
         struct Bucket
         {
-            void AddUpdateResponse( ResourceID const& ID, String const& filePath )
+            void AddUpdateResponse( ResourceID const& ID )
             {
-                if ( m_updateResponses.empty() )
+                if ( m_updateResponses.empty() || m_updateResponses.back().m_results.size() == maxResultsPerMessage )
                 {
                     m_updateResponses.push_back();
                 }
 
-                m_updateResponses.back().m_results.emplace_back( ID, filePath );
-
-                if ( m_updateResponses.size() == 64 )
-                {
-                    m_updateResponses.push_back();
-                }
+                m_updateResponses.back().m_results.emplace_back( ID );
             }
 
-            void AddRequestResponse( ResourceID const& ID, String const& filePath )
+            void AddRequestResponse( NetworkResourceResponse::Result const& result )
             {
-                if ( m_requestResponses.empty() )
+                if ( m_requestResponses.empty() || m_requestResponses.back().m_results.size() == maxResultsPerMessage )
                 {
                     m_requestResponses.push_back();
                 }
 
-                m_requestResponses.back().m_results.emplace_back( ID, filePath );
-
-                if ( m_requestResponses.size() == 64 )
-                {
-                    m_requestResponses.push_back();
-                }
+                m_requestResponses.back().m_results.emplace_back( result );
             }
 
             TVector<NetworkResourceResponse> m_updateResponses;
@@ -576,7 +729,7 @@ namespace EE::Resource
                             // Bulk notify all connected client that a resource has been recompiled so that they can reload it if necessary
                             for ( auto& clientBucket : clientBuckets )
                             {
-                                clientBucket.AddUpdateResponse( pRequest->GetResourceID(), pRequest->HasSucceeded() ? pRequest->GetDestinationFilePath().ToString() : String() );
+                                clientBucket.AddUpdateResponse( pRequest->GetResourceID() );
                             }
                         }
                     }
@@ -584,9 +737,38 @@ namespace EE::Resource
                     {
                         for ( int32_t clientIdx = 0; clientIdx < numConnectedClients; clientIdx++ )
                         {
-                            if ( connectedClients[clientIdx].m_ID == pRequest->GetClientID() )
+                            if ( connectedClients[clientIdx].m_ID != pRequest->GetClientID() )
+                            {
+                                continue;
+                            }
+
+                            if ( !pRequest->HasSucceeded() )
+                            {
+                                clientBuckets[clientIdx].AddRequestResponse( NetworkResourceResponse::Result( pRequest->GetResourceID() ) );
+                            }
+                            else // Only send the data if the client doesnt already have it
                             {
-                                clientBuckets[clientIdx].AddRequestResponse( pRequest->GetResourceID(), pRequest->HasSucceeded() ? pRequest->GetDestinationFilePath().ToString() : String() );
+                                bool const shouldStreamData = !pRequest->IsClientDataUpToDate();
+                                clientBuckets[clientIdx].AddRequestResponse( NetworkResourceResponse::Result( pRequest->GetResourceID(), pRequest->m_compiledDataHash, pRequest->m_compileKey, pRequest->m_compiledDataSize, shouldStreamData ) );
+
+                                if ( shouldStreamData )
+                                {
+                                    // Replace any in-progress transfer of older data for this resource
+                                    for ( int32_t t = (int32_t) m_dataTransfers.size() - 1; t >= 0; t-- )
+                                    {
+                                        if ( m_dataTransfers[t].m_clientID == pRequest->GetClientID() && m_dataTransfers[t].m_resourceID == pRequest->GetResourceID() )
+                                        {
+                                            m_dataTransfers.erase( m_dataTransfers.begin() + t );
+                                        }
+                                    }
+
+                                    auto& transfer = m_dataTransfers.emplace_back();
+                                    transfer.m_clientID = pRequest->GetClientID();
+                                    transfer.m_resourceID = pRequest->GetResourceID();
+                                    transfer.m_dataHash = pRequest->m_compiledDataHash;
+                                    transfer.m_data.swap( pActiveTask->GetCompiledData() );
+                                    transfer.m_priority = pRequest->m_priority;
+                                }
                             }
                         }
                     }
@@ -616,7 +798,7 @@ namespace EE::Resource
                 m_networkServer.SendNetworkMessage( eastl::move( message ) );
             }
 
-            // Completed requests
+            // Completed requests - these need to be sent before any of the data chunks
             for ( auto const& response : clientBuckets[i].m_requestResponses )
             {
                 Network::IPC::Message message;
@@ -629,6 +811,143 @@ namespace EE::Resource
 
     //-------------------------------------------------------------------------
 
+    void ResourceServer::ScheduleCacheValidation( uint32_t clientID, NetworkCacheValidationRequest&& validationRequest )
+    {
+        // Validation gates every cached resource on the client so it is scheduled ahead of regular requests
+        auto pTask = EE::New<CacheValidationTask>( m_context, clientID, eastl::move( validationRequest ) );
+        pTask->m_Priority = enki::TASK_PRIORITY_HIGH;
+        m_taskSystem.ScheduleTask( pTask );
+        m_cacheValidationTasks.emplace_back( pTask );
+    }
+
+    void ResourceServer::ProcessCompletedCacheValidations()
+    {
+        auto const& connectedClients = m_networkServer.GetConnectedClients();
+        int32_t const numConnectedClients = m_networkServer.GetNumConnectedClients();
+
+        for ( int32_t i = (int32_t) m_cacheValidationTasks.size() - 1; i >= 0; i-- )
+        {
+            CacheValidationTask* pTask = m_cacheValidationTasks[i];
+            if ( !pTask->GetIsComplete() )
+            {
+                continue;
+            }
+
+            // The response is always sent, even if empty, so that the client knows validation has completed
+            if ( !m_context.m_isExiting )
+            {
+                NetworkCacheValidationResponse const& response = pTask->GetResponse();
+                EE_LOG_INFO( "Resource", "Resource Server", "Validated %d/%d cached resources for client %u in %.2fms", (int32_t) response.m_validResourceIDs.size(), pTask->GetNumEntries(), pTask->GetClientID(), pTask->GetValidationTime().ToFloat() );
+
+                for ( int32_t clientIdx = 0; clientIdx < numConnectedClients; clientIdx++ )
+                {
+                    if ( connectedClients[clientIdx].m_ID == pTask->GetClientID() )
+                    {
+                        Network::IPC::Message message;
+                        message.SetClientConnectionID( pTask->GetClientID() );
+                        message.SetData( (int32_t) NetworkMessageID::CacheValidationComplete, response );
+                        m_networkServer.SendNetworkMessage( eastl::move( message ) );
+                        break;
+                    }
+                }
+            }
+
+            EE::Delete( pTask );
+            m_cacheValidationTasks.erase_unsorted( m_cacheValidationTasks.begin() + i );
+        }
+    }
+
+    void ResourceServer::SendDataChunks()
+    {
+        if ( m_dataTransfers.empty() )
+        {
+            return;
+        }
+
+        // Remove transfers for disconnected clients
+        //-------------------------------------------------------------------------
+
+        auto const& connectedClients = m_networkServer.GetConnectedClients();
+        int32_t const numConnectedClients = m_networkServer.GetNumConnectedClients();
+
+        for ( int32_t i = (int32_t) m_dataTransfers.size() - 1; i >= 0; i-- )
+        {
+            bool isClientConnected = false;
+            for ( int32_t clientIdx = 0; clientIdx < numConnectedClients; clientIdx++ )
+            {
+                if ( connectedClients[clientIdx].m_ID == m_dataTransfers[i].m_clientID )
+                {
+                    isClientConnected = true;
+                    break;
+                }
+            }
+
+            if ( !isClientConnected )
+            {
+                m_dataTransfers.erase_unsorted( m_dataTransfers.begin() + i );
+            }
+        }
+
+        // Highest priority first, then smallest remaining first so that small resources are not stuck behind large ones
+        //-------------------------------------------------------------------------
+
+        auto SortPredicate = [] ( DataTransfer const& a, DataTransfer const& b )
+        {
+            if ( a.m_priority != b.m_priority )
+            {
+                return a.m_priority > b.m_priority;
+            }
+
+            return a.GetRemainingBytes() < b.GetRemainingBytes();
+        };
+
+        eastl::stable_sort( m_dataTransfers.begin(), m_dataTransfers.end(), SortPredicate );
+
+        // Send chunks until we exhaust the per-update budget
+        //-------------------------------------------------------------------------
+
+        constexpr static uint32_t const maxBytesPerUpdate = 16 * g_networkResourceDataChunkSize;
+        uint32_t bytesSent = 0;
+
+        int32_t numCompletedTransfers = 0;
+        for ( auto& transfer : m_dataTransfers )
+        {
+            while ( transfer.GetRemainingBytes() > 0 && bytesSent < maxBytesPerUpdate )
+            {
+                uint32_t const chunkSize = Math::Min( transfer.GetRemainingBytes(), g_networkResourceDataChunkSize );
+
+                NetworkResourceDataChunk chunk;
+                chunk.m_resourceID = transfer.m_resourceID;
+                chunk.m_dataHash = transfer.m_dataHash;
+                chunk.m_offset = transfer.m_bytesSent;
+                chunk.m_data.assign( transfer.m_data.begin() + transfer.m_bytesSent, transfer.m_data.begin() + transfer.m_bytesSent + chunkSize );
+
+                Network::IPC::Message message;
+                message.SetClientConnectionID( transfer.m_clientID );
+                message.SetData( (int32_t) NetworkMessageID::ResourceDataChunk, chunk );
+                m_networkServer.SendNetworkMessage( eastl::move( message ) );
+
+                transfer.m_bytesSent += chunkSize;
+                bytesSent += chunkSize;
+            }
+
+            if ( transfer.GetRemainingBytes() == 0 )
+            {
+                numCompletedTransfers++;
+            }
+
+            if ( bytesSent >= maxBytesPerUpdate )
+            {
+                break;
+            }
+        }
+
+        // Completed transfers are always at the front of the list
+        m_dataTransfers.erase( m_dataTransfers.begin(), m_dataTransfers.begin() + numCompletedTransfers );
+    }
+
+    //-------------------------------------------------------------------------
+
     void ResourceServer::RefreshAvailableMapList()
     {
         m_allMaps.clear();
@@ -664,11 +983,210 @@ namespace EE::Resource
     {
         EE_ASSERT( CanStartPackaging() );
 
+        m_packagingNodes.clear();
+        m_compilingPackagingNodes.clear();
+        m_numResolvedPackagingNodes = 0;
+        m_packagingStats = PackagingStats();
+        m_packagingTimer.Start();
+
         m_pPackagingTask = EE::New<PackagingTask>( m_context, m_mapsToBePackaged );
         m_taskSystem.ScheduleTask( m_pPackagingTask );
         m_packagingStage = PackagingStage::Preparing;
     }
 
+    void ResourceServer::StartPackagingCompilation()
+    {
+        m_packagingStats.m_preparationTime = m_packagingTimer.GetElapsedTimeMilliseconds();
+        m_packagingStats.m_numResources = (int32_t) m_packagingNodes.size();
+        m_packagingStage = PackagingStage::Packaging;
+
+        // Resolve all up to date resources first, so that nothing waits on them
+        //-------------------------------------------------------------------------
+
+        m_packagingManifest.Load( GetPackagingManifestPath() );
+
+        int32_t const numNodes = (int32_t) m_packagingNodes.size();
+        for ( int32_t i = 0; i < numNodes; i++ )
+        {
+            m_packagingNodes[i].m_numUnresolvedDependencies = (int32_t) m_packagingNodes[i].m_dependencies.size();
+        }
+
+        for ( int32_t i = 0; i < numNodes; i++ )
+        {
+            PackagingNode& node = m_packagingNodes[i];
+            if ( node.m_compileKey == 0 || m_packagingManifest.GetCompileKey( node.m_resourceID ) != node.m_compileKey )
+            {
+                continue;
+            }
+
+            if ( FileSystem::Exists( ResourcePath::ToFileSystemPath( m_settings.m_packagedBuildCompiledResourcePath, node.m_resourceID.GetResourcePath() ) ) )
+            {
+                node.m_wasUpToDate = true;
+                node.m_hasSucceeded = true;
+                ResolvePackagingNode( i );
+            }
+        }
+
+        // Schedule all resources that dont depend on anything that still needs to be compiled
+        //-------------------------------------------------------------------------
+
+        for ( int32_t i = 0; i < numNodes; i++ )
+        {
+            if ( m_packagingNodes[i].m_state == PackagingNode::State::Waiting && m_packagingNodes[i].m_numUnresolvedDependencies == 0 )
+            {
+                SchedulePackagingNode( i );
+            }
+        }
+
+        UpdatePackaging();
+    }
+
+    void ResourceServer::UpdatePackaging()
+    {
+        EE_ASSERT( m_packagingStage == PackagingStage::Packaging );
+
+        // Resolve completed compilations and schedule any dependents that are now ready
+        //-------------------------------------------------------------------------
+
+        for ( int32_t i = (int32_t) m_compilingPackagingNodes.size() - 1; i >= 0; i-- )
+        {
+            int32_t const nodeIdx = m_compilingPackagingNodes[i];
+            PackagingNode& node = m_packagingNodes[nodeIdx];
+            EE_ASSERT( node.m_pRequest != nullptr );
+
+            if ( !node.m_pRequest->IsComplete() )
+            {
+                continue;
+            }
+
+            node.m_compileTime = node.m_pRequest->GetCompilationElapsedTime();
+            node.m_hasSucceeded = node.m_pRequest->HasSucceeded();
+            node.m_pRequest = nullptr;
+            m_compilingPackagingNodes.erase_unsorted( m_compilingPackagingNodes.begin() + i );
+
+            ResolvePackagingNode( nodeIdx );
+
+            for ( int32_t dependentIdx : node.m_dependents )
+            {
+                if ( m_packagingNodes[dependentIdx].m_state == PackagingNode::State::Waiting && m_packagingNodes[dependentIdx].m_numUnresolvedDependencies == 0 )
+                {
+                    SchedulePackagingNode( dependentIdx );
+                }
+            }
+        }
+
+        // If nothing is compiling but we still have unresolved resources, then we have a dependency cycle
+        // Only the members of the cycles are force scheduled, anything depending on a cycle is scheduled as normal once the cycle is resolved
+        //-------------------------------------------------------------------------
+
+        if ( m_compilingPackagingNodes.empty() && m_numResolvedPackagingNodes < (int32_t) m_packagingNodes.size() )
+        {
+            TVector<TVector<int32_t>> const cycles = FindBlockingDependencyCycles( m_packagingNodes );
+            EE_ASSERT( !cycles.empty() );
+
+            for ( auto const& cycle : cycles )
+            {
+                for ( int32_t nodeIdx : cycle )
+                {
+                    EE_LOG_WARNING( "Resource", "Packaging", "Circular install dependency detected for: %s (cycle of %d resources)", m_packagingNodes[nodeIdx].m_resourceID.c_str(), (int32_t) cycle.size() );
+                    SchedulePackagingNode( nodeIdx );
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( m_numResolvedPackagingNodes == (int32_t) m_packagingNodes.size() )
+        {
+            CompletePackaging();
+        }
+    }
+
+    void ResourceServer::SchedulePackagingNode( int32_t nodeIdx )
+    {
+        PackagingNode& node = m_packagingNodes[nodeIdx];
+        EE_ASSERT( node.m_state == PackagingNode::State::Waiting );
+
+        node.m_pRequest = CreateResourceRequest( node.m_resourceID, 0, CompilationRequest::Origin::Package );
+        node.m_state = PackagingNode::State::Compiling;
+        m_compilingPackagingNodes.emplace_back( nodeIdx );
+    }
+
+    void ResourceServer::ResolvePackagingNode( int32_t nodeIdx )
+    {
+        PackagingNode& node = m_packagingNodes[nodeIdx];
+        EE_ASSERT( node.m_state != PackagingNode::State::Complete );
+        node.m_state = PackagingNode::State::Complete;
+        m_numResolvedPackagingNodes++;
+
+        // The critical path to this node is its own compile time plus the longest path to any of its dependencies
+        Milliseconds longestDependencyPathTime = 0;
+        for ( int32_t dependencyIdx : node.m_dependencies )
+        {
+            longestDependencyPathTime = Math::Max( longestDependencyPathTime, m_packagingNodes[dependencyIdx].m_criticalPathTime );
+        }
+        node.m_criticalPathTime = node.m_compileTime + longestDependencyPathTime;
+
+        // Failed resources are removed from the manifest so that they are always repackaged
+        if ( !node.m_wasUpToDate )
+        {
+            if ( node.m_hasSucceeded )
+            {
+                m_packagingManifest.SetCompileKey( node.m_resourceID, node.m_compileKey );
+            }
+            else
+            {
+                m_packagingManifest.Remove( node.m_resourceID );
+            }
+        }
+
+        for ( int32_t dependentIdx : node.m_dependents )
+        {
+            m_packagingNodes[dependentIdx].m_numUnresolvedDependencies--;
+        }
+    }
+
+    void ResourceServer::CompletePackaging()
+    {
+        EE_ASSERT( m_compilingPackagingNodes.empty() );
+
+        for ( auto const& node : m_packagingNodes )
+        {
+            if ( node.m_wasUpToDate )
+            {
+                m_packagingStats.m_numUpToDate++;
+            }
+            else
+            {
+                m_packagingStats.m_numCompiled++;
+                m_packagingStats.m_totalCompileTime += node.m_compileTime;
+
+                if ( !node.m_hasSucceeded )
+                {
+                    m_packagingStats.m_numFailed++;
+                }
+            }
+
+            m_packagingStats.m_criticalPathTime = Math::Max( m_packagingStats.m_criticalPathTime, node.m_criticalPathTime );
+        }
+
+        m_packagingStats.m_totalTime = m_packagingTimer.GetElapsedTimeMilliseconds();
+
+        //-------------------------------------------------------------------------
+
+        FileSystem::Path const manifestPath = GetPackagingManifestPath();
+        if ( !m_packagingManifest.Save( manifestPath ) )
+        {
+            EE_LOG_WARNING( "Resource", "Packaging", "Failed to write packaging manifest: %s", manifestPath.c_str() );
+        }
+
+        EE_LOG_INFO( "Resource", "Packaging", "Packaged %d resources in %.2fs (%d compiled, %d up to date, %d failed), critical path: %.2fs", m_packagingStats.m_numResources, Seconds( m_packagingStats.m_totalTime ).ToFloat(), m_packagingStats.m_numCompiled, m_packagingStats.m_numUpToDate, m_packagingStats.m_numFailed, Seconds( m_packagingStats.m_criticalPathTime ).ToFloat() );
+
+        m_packagingNodes.clear();
+        m_numResolvedPackagingNodes = 0;
+        m_packagingStage = PackagingStage::Complete;
+    }
+
     float ResourceServer::GetPackagingProgress() const
     {
         switch ( m_packagingStage )
@@ -687,16 +1205,7 @@ namespace EE::Resource
 
             case PackagingStage::Packaging:
             {
-                float numComplete = 0.0f;
-                for ( auto pRequest : m_packagingRequests )
-                {
-                    if ( pRequest->IsComplete() )
-                    {
-                        numComplete++;
-                    }
-                }
-
-                float const percentageComplete = numComplete / m_packagingRequests.size();
+                float const percentageComplete = m_packagingNodes.empty() ? 1.0f : float( m_numResolvedPackagingNodes ) / m_packagingNodes.size();
                 return 0.05f + ( 0.95f * percentageComplete );
             }
             break;
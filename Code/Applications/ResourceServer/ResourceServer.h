@@ -2,12 +2,14 @@
 
 #include "ResourceServerContext.h"
 #include "ResourceCompilationRequest.h"
+#include "ResourcePackaging.h"
 #include "EngineTools/Core/FileSystem/FileSystemWatcher.h"
 #include "Base/Network/IPC/IPCMessageServer.h"
 #include "Base/Resource/ResourceSettings.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Base/Threading/TaskSystem.h"
 #include "Base/Threading/Threading.h"
+#include "Base/Time/Timers.h"
 
 //-------------------------------------------------------------------------
 // The network resource server
@@ -19,12 +21,26 @@
 namespace EE::Resource
 {
     class CompilationTask;
+    class CacheValidationTask;
     class PackagingTask;
 
     //-------------------------------------------------------------------------
 
     class ResourceServer
     {
+        // Compiled data that is being streamed back to a client
+        struct DataTransfer
+        {
+            inline uint32_t GetRemainingBytes() const { return (uint32_t) m_data.size() - m_bytesSent; }
+
+            uint32_t                    m_clientID = 0;
+            ResourceID                  m_resourceID;
+            uint64_t                    m_dataHash = 0;
+            Blob                        m_data;
+            uint32_t                    m_bytesSent = 0;
+            NetworkRequestPriority      m_priority = NetworkRequestPriority::Normal;
+        };
+
     public:
 
         struct BusyState
@@ -112,14 +128,37 @@ namespace EE::Resource
         // Start the packaging process
         void StartPackaging();
 
+        // Get the stats for the current (or last) packaging process
+        inline PackagingStats const& GetPackagingStats() const { return m_packagingStats; }
+
     private:
 
         // Requests
         //-------------------------------------------------------------------------
 
         CompilationRequest* CreateResourceRequest( ResourceID const& resourceID, uint32_t clientID = 0, CompilationRequest::Origin origin = CompilationRequest::Origin::External );
+        CompilationRequest* CreateClientResourceRequest( uint32_t clientID, NetworkResourceRequest::Request const& clientRequest );
+        void InitializeRequest( CompilationRequest* pRequest, ResourceID const& resourceID, uint32_t clientID, CompilationRequest::Origin origin ) const;
+        void ScheduleRequest( CompilationRequest* pRequest );
         void ProcessCompletedRequests();
 
+        // Streams compiled data to clients, highest priority first, within a per-update bandwidth budget
+        void SendDataChunks();
+
+        // Client cache validation
+        void ScheduleCacheValidation( uint32_t clientID, NetworkCacheValidationRequest&& validationRequest );
+        void ProcessCompletedCacheValidations();
+
+        // Packaging
+        //-------------------------------------------------------------------------
+
+        inline FileSystem::Path GetPackagingManifestPath() const { return m_settings.m_packagedBuildCompiledResourcePath + "PackagingManifest.bin"; }
+        void StartPackagingCompilation();
+        void UpdatePackaging();
+        void SchedulePackagingNode( int32_t nodeIdx );
+        void ResolvePackagingNode( int32_t nodeIdx );
+        void CompletePackaging();
+
     private:
 
         Network::IPC::Server                                        m_networkServer;
@@ -137,15 +176,26 @@ namespace EE::Resource
         TVector<CompilationTask*>                                   m_activeTasks;
         std::atomic<int64_t>                                        m_numScheduledTasks = 0;
 
+        // Outgoing data
+        TVector<DataTransfer>                                       m_dataTransfers;
+
+        // Client cache validation
+        TVector<CacheValidationTask*>                               m_cacheValidationTasks;
+
         // Workers
         ResourceServerContext                                       m_context;
 
         // Packaging
         TVector<ResourceID>                                         m_allMaps;
         TVector<ResourceID>                                         m_mapsToBePackaged;
-        TVector<CompilationRequest const*>                          m_packagingRequests;
         PackagingTask*                                              m_pPackagingTask = nullptr;
         PackagingStage                                              m_packagingStage = PackagingStage::None;
+        TVector<PackagingNode>                                      m_packagingNodes;
+        TVector<int32_t>                                            m_compilingPackagingNodes;
+        int32_t                                                     m_numResolvedPackagingNodes = 0;
+        PackagingManifest                                           m_packagingManifest;
+        PackagingStats                                              m_packagingStats;
+        Timer<PlatformClock>                                        m_packagingTimer;
 
         // File System Watcher
         FileSystem::Watcher                                         m_fileSystemWatcher;
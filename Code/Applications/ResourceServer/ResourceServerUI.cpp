@@ -653,6 +653,20 @@ namespace EE::Resource
                 float const progress = m_resourceServer.GetPackagingProgress();
                 TInlineString<32> overlay( TInlineString<32>::CtorSprintf(), "%.2f%%", progress * 100 );
                 ImGui::ProgressBar( progress, ImVec2( -1, 0 ), overlay.c_str() );
+
+                // Stats
+                //-------------------------------------------------------------------------
+
+                if ( packagingStage == ResourceServer::PackagingStage::Complete )
+                {
+                    ImGuiX::TextSeparator( "Stats" );
+
+                    PackagingStats const& stats = m_resourceServer.GetPackagingStats();
+                    ImGui::Text( "Resources: %d (Compiled: %d, Up To Date: %d, Failed: %d)", stats.m_numResources, stats.m_numCompiled, stats.m_numUpToDate, stats.m_numFailed );
+                    ImGui::Text( "Total Time: %.2fs (Preparation: %.2fs)", Seconds( stats.m_totalTime ).ToFloat(), Seconds( stats.m_preparationTime ).ToFloat() );
+                    ImGui::Text( "Compile Time: %.2fs, Critical Path: %.2fs", Seconds( stats.m_totalCompileTime ).ToFloat(), Seconds( stats.m_criticalPathTime ).ToFloat() );
+                    ImGui::Text( "Throughput: %.2f resources/s", stats.GetThroughput() );
+                }
             }
         }
         ImGui::End();
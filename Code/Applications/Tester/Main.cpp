@@ -1,6 +1,7 @@
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Base/Application/ApplicationGlobalState.h"
 #include "Base/FileSystem/FileSystem.h"
+#include "Base/FileSystem/FileSystemUtils.h"
 #include "Base/Serialization/BinarySerialization.h"
 #include "Base/Math/NumericRange.h"
 #include "Base/Types/Event.h"
@@ -8,9 +9,56 @@
 #include "_AutoGenerated/ToolsTypeRegistration.h"
 
 #include <iostream>
+#include <eastl/sort.h>
 #include "Base/Network/IPC/IPCMessage.h"
 #include "Base/Math/MathRandom.h"
+#include "Base/Math/SIMDWide.h"
 #include "Base/Time/Timers.h"
+#include "Base/Render/RenderDevice.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Engine/Render/RenderSubmitBenchmark.h"
+#include "Engine/Render/LightClustering.h"
+#include "Engine/Animation/AnimationBlender.h"
+#include "Engine/Animation/AnimationPose.h"
+#include "Engine/Animation/TaskSystem/Animation_TaskStream.h"
+#include "Engine/Animation/TaskSystem/Animation_TaskSystem.h"
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_Instance.h"
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_Recording.h"
+#include "Engine/Animation/ResourceLoaders/ResourceLoader_AnimationSkeleton.h"
+#include "Engine/Animation/ResourceLoaders/ResourceLoader_AnimationClip.h"
+#include "Engine/Animation/ResourceLoaders/ResourceLoader_AnimationGraph.h"
+#include "Base/Resource/ResourceSystem.h"
+#include "Base/Resource/ResourceSettings.h"
+#include "Base/Resource/ResourceHeader.h"
+#include "Base/Resource/ResourceProviders/PackagedResourceProvider.h"
+#include "Engine/Entity/EntityComponentRouting.h"
+#include "Engine/Entity/EntityWorldSystem.h"
+#include "Engine/Entity/EntityComponent.h"
+#include "Engine/Entity/EntityComponentPool.h"
+#include "Engine/Entity/EntitySerialization.h"
+#include "Engine/Entity/EntityDescriptors.h"
+#include "Engine/Entity/Entity.h"
+#include "Engine/Entity/EntityWorld.h"
+#include "Engine/Entity/EntityMap.h"
+#include "Engine/Entity/ResourceLoaders/ResourceLoader_EntityCollection.h"
+#include "Engine/Entity/Systems/WorldSystem_EntityCollectionSpawner.h"
+#include "Engine/Render/Systems/WorldSystem_Renderer.h"
+#include "Engine/Animation/Systems/WorldSystem_Animation.h"
+#include "Engine/Camera/Systems/WorldSystem_CameraManager.h"
+#include "Engine/Player/Systems/WorldSystem_PlayerManager.h"
+#include "Engine/AI/Systems/WorldSystem_AIManager.h"
+#include "Engine/Render/Components/Component_StaticMesh.h"
+#include "Engine/Render/Components/Component_Lights.h"
+#include "Engine/Navmesh/Components/Component_Navmesh.h"
+#include "EngineTools/Resource/ResourceDatabase.h"
+#include "EngineTools/Render/ResourceDescriptors/ResourceDescriptor_RenderMesh.h"
+#include "EngineTools/RawAssets/RawAssetReader.h"
+#include "EngineTools/RawAssets/RawMesh.h"
+#include "EngineTools/Render/MeshTools/MeshTools.h"
+#include "Engine/Render/Mesh/MeshletCulling.h"
+#include "Engine/Render/Mesh/MeshLODSelection.h"
+#include "Base/Render/RenderViewport.h"
+#include "Base/Render/RenderVertexCompression.h"
 
 //-------------------------------------------------------------------------
 
@@ -46,6 +94,3619 @@ EE_FORCE_INLINE Float4 QuatMul( Float4 const &a, Float4 const& b )
 
 //-------------------------------------------------------------------------
 
+// Checks the wide SoA math kernels against the scalar versions and times them
+namespace WideMathBenchmark
+{
+    constexpr static int32_t const g_numTransforms = 4096; // Needs to be a multiple of the widest type
+    constexpr static int32_t const g_numIterations = 1000;
+    constexpr static float const g_maxError = 1e-5f; // Relative to the magnitude of the translation/scale
+
+    struct Data
+    {
+        Transform       m_a[g_numTransforms];
+        Transform       m_b[g_numTransforms];
+        float           m_t[g_numTransforms];
+        Transform       m_expected[g_numTransforms];
+        Transform       m_result[g_numTransforms];
+    };
+
+    static float GetMaxAbsComponent( Vector const& v )
+    {
+        Float4 const absV = v.GetAbs().ToFloat4();
+        return Math::Max( Math::Max( absV.m_x, absV.m_y ), Math::Max( absV.m_z, absV.m_w ) );
+    }
+
+    static float GetMaxError( Data const& data )
+    {
+        float maxError = 0.0f;
+        for ( int32_t i = 0; i < g_numTransforms; i++ )
+        {
+            Vector const expectedRotation = data.m_expected[i].GetRotation().ToVector();
+            Vector const rotation = data.m_result[i].GetRotation().ToVector();
+
+            // q and -q are the same rotation
+            float const rotationError = Math::Min( GetMaxAbsComponent( rotation - expectedRotation ), GetMaxAbsComponent( rotation + expectedRotation ) );
+            Vector const expectedTranslationScale = data.m_expected[i].GetTranslationAndScale();
+            float const translationScaleError = GetMaxAbsComponent( data.m_result[i].GetTranslationAndScale() - expectedTranslationScale ) / Math::Max( 1.0f, GetMaxAbsComponent( expectedTranslationScale ) );
+            maxError = Math::Max( maxError, Math::Max( rotationError, translationScaleError ) );
+        }
+        return maxError;
+    }
+
+    template<typename F, typename WideOp>
+    static void RunWide( Data& data, WideOp const& op )
+    {
+        for ( int32_t i = 0; i < g_numTransforms; i += F::s_width )
+        {
+            TTransformWide<F> const a = TTransformWide<F>::Load( &data.m_a[i] );
+            TTransformWide<F> const b = TTransformWide<F>::Load( &data.m_b[i] );
+            F const t = F::Load( &data.m_t[i] );
+            op( a, b, t ).Store( &data.m_result[i] );
+        }
+    }
+
+    template<typename ScalarOp, typename WideOp>
+    static bool RunKernel( char const* pName, Data& data, ScalarOp const& scalarOp, WideOp const& wideOp )
+    {
+        Milliseconds scalarTime, time4x, time8x;
+
+        {
+            ScopedTimer<PlatformClock> timer( scalarTime );
+            for ( int32_t j = 0; j < g_numIterations; j++ )
+            {
+                for ( int32_t i = 0; i < g_numTransforms; i++ )
+                {
+                    data.m_expected[i] = scalarOp( data.m_a[i], data.m_b[i], data.m_t[i] );
+                }
+            }
+        }
+
+        {
+            ScopedTimer<PlatformClock> timer( time4x );
+            for ( int32_t j = 0; j < g_numIterations; j++ )
+            {
+                RunWide<SIMD::Float4x>( data, wideOp );
+            }
+        }
+        float const error4x = GetMaxError( data );
+
+        {
+            ScopedTimer<PlatformClock> timer( time8x );
+            for ( int32_t j = 0; j < g_numIterations; j++ )
+            {
+                RunWide<SIMD::Float8x>( data, wideOp );
+            }
+        }
+        float const error8x = GetMaxError( data );
+
+        std::cout << pName << " - Scalar: " << scalarTime.ToFloat() << "ms, 4x: " << time4x.ToFloat() << "ms (Max Error: " << error4x << "), 8x: " << time8x.ToFloat() << "ms (Max Error: " << error8x << ")" << std::endl;
+
+        if ( error4x > g_maxError || error8x > g_maxError )
+        {
+            std::cout << pName << " failed validation!" << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+    // Per bone blend matching the original pose blends: masked out bones use the source and fully weighted bones the target
+    template<typename RotationOp, typename TranslationOp>
+    static void BlendScalar( Data& data, float blendWeight, bool useBoneWeights, bool canEarlyOut, RotationOp const& rotationOp, TranslationOp const& translationOp )
+    {
+        for ( int32_t i = 0; i < g_numTransforms; i++ )
+        {
+            float const boneBlendWeight = useBoneWeights ? blendWeight * data.m_t[i] : blendWeight;
+            if ( boneBlendWeight == 0.0f )
+            {
+                data.m_expected[i] = data.m_a[i];
+            }
+            else if ( canEarlyOut && boneBlendWeight == 1.0f )
+            {
+                data.m_expected[i] = data.m_b[i];
+            }
+            else
+            {
+                Transform::DirectlySetRotation( data.m_expected[i], rotationOp( data.m_a[i].GetRotation(), data.m_b[i].GetRotation(), boneBlendWeight ) );
+                Transform::DirectlySetTranslationScale( data.m_expected[i], translationOp( data.m_a[i].GetTranslationAndScale(), data.m_b[i].GetTranslationAndScale(), boneBlendWeight ) );
+            }
+        }
+    }
+
+    template<typename ScalarOp, typename BlendOp>
+    static bool RunBlendKernel( char const* pName, Data& data, ScalarOp const& scalarOp, BlendOp const& blendOp )
+    {
+        Milliseconds scalarTime, blendTime;
+
+        {
+            ScopedTimer<PlatformClock> timer( scalarTime );
+            for ( int32_t j = 0; j < g_numIterations; j++ )
+            {
+                scalarOp( data );
+            }
+        }
+
+        {
+            ScopedTimer<PlatformClock> timer( blendTime );
+            for ( int32_t j = 0; j < g_numIterations; j++ )
+            {
+                blendOp( data );
+            }
+        }
+        float const error = GetMaxError( data );
+
+        std::cout << pName << " - Scalar: " << scalarTime.ToFloat() << "ms, Blender (" << FloatWide::s_width << "x): " << blendTime.ToFloat() << "ms (Max Error: " << error << ")" << std::endl;
+
+        if ( error > g_maxError )
+        {
+            std::cout << pName << " failed validation!" << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+    static int Run()
+    {
+        Data* pData = EE::New<Data>();
+
+        for ( int32_t i = 0; i < g_numTransforms; i++ )
+        {
+            Quaternion const rotationA( EulerAngles( Math::GetRandomFloat( -180, 180 ), Math::GetRandomFloat( -180, 180 ), Math::GetRandomFloat( -180, 180 ) ) );
+            Quaternion const rotationB( EulerAngles( Math::GetRandomFloat( -180, 180 ), Math::GetRandomFloat( -180, 180 ), Math::GetRandomFloat( -180, 180 ) ) );
+
+            // Mix in negative scales so that the wide multiply hits the scalar fallback for both fully negative and mixed sign lanes
+            float const scaleA = ( i % 5 == 0 ) ? -Math::GetRandomFloat( 0.5f, 2.0f ) : Math::GetRandomFloat( 0.5f, 2.0f );
+            float const scaleB = ( i % 7 == 0 ) ? -Math::GetRandomFloat( 0.5f, 2.0f ) : Math::GetRandomFloat( 0.5f, 2.0f );
+
+            pData->m_a[i] = Transform( rotationA, Vector( Math::GetRandomFloat( -100, 100 ), Math::GetRandomFloat( -100, 100 ), Math::GetRandomFloat( -100, 100 ) ), scaleA );
+            pData->m_b[i] = Transform( rotationB, Vector( Math::GetRandomFloat( -100, 100 ), Math::GetRandomFloat( -100, 100 ), Math::GetRandomFloat( -100, 100 ) ), scaleB );
+            pData->m_t[i] = Math::GetRandomFloat( 0.0f, 1.0f );
+        }
+
+        // The weights double as bone mask weights, so add some fully masked out and fully weighted ranges
+        for ( int32_t i = 0; i < g_numTransforms; i++ )
+        {
+            int32_t const range = ( i / 16 ) % 4;
+            if ( range == 0 )
+            {
+                pData->m_t[i] = 0.0f;
+            }
+            else if ( range == 1 )
+            {
+                pData->m_t[i] = 1.0f;
+            }
+        }
+
+        std::cout << "Wide Math (" << g_numTransforms << " transforms x " << g_numIterations << " iterations, AVX: " << ( EE_SIMD_AVX ? "Yes" : "No" ) << ")" << std::endl;
+
+        bool isValid = true;
+        isValid &= RunKernel( "Transform Multiply", *pData, [] ( Transform const& a, Transform const& b, float ) { return a * b; }, [] ( auto const& a, auto const& b, auto const& ) { return a * b; } );
+        isValid &= RunKernel( "Transform Lerp", *pData, [] ( Transform const& a, Transform const& b, float t ) { return Transform::Lerp( a, b, t ); }, [] ( auto const& a, auto const& b, auto const& t ) { return std::decay_t<decltype( a )>::Lerp( a, b, t ); } );
+        isValid &= RunKernel( "Transform FastSlerp", *pData, [] ( Transform const& a, Transform const& b, float t ) { return Transform::FastSlerp( a, b, t ); }, [] ( auto const& a, auto const& b, auto const& t ) { return std::decay_t<decltype( a )>::FastSlerp( a, b, t ); } );
+
+
+        // Pose blending kernels
+        //-------------------------------------------------------------------------
+
+        using namespace Animation;
+
+        float const blendWeight = 0.35f;
+        auto SLerp = [] ( Quaternion const& q0, Quaternion const& q1, float t ) { return Quaternion::SLerp( q0, q1, t ); };
+        auto FastSLerp = [] ( Quaternion const& q0, Quaternion const& q1, float t ) { return Quaternion::FastSLerp( q0, q1, t ); };
+        auto Lerp = [] ( Vector const& v0, Vector const& v1, float t ) { return Vector::Lerp( v0, v1, t ); };
+        auto AdditiveRotation = [] ( Quaternion const& q0, Quaternion const& q1, float t ) { return Quaternion::SLerp( q0, q1 * q0, t ); };
+        auto AdditiveTranslation = [] ( Vector const& v0, Vector const& v1, float t ) { return Vector::MultiplyAdd( v1, Vector( t ), v0 ); };
+
+        isValid &= RunBlendKernel( "Local Blend", *pData, [&] ( Data& data ) { BlendScalar( data, blendWeight, false, true, SLerp, Lerp ); }, [&] ( Data& data ) { Blender::LocalBlend( data.m_a, data.m_b, blendWeight, nullptr, g_numTransforms, data.m_result ); } );
+        isValid &= RunBlendKernel( "Local Blend (FastSLerp)", *pData, [&] ( Data& data ) { BlendScalar( data, blendWeight, false, true, FastSLerp, Lerp ); }, [&] ( Data& data ) { Blender::LocalBlend( data.m_a, data.m_b, blendWeight, nullptr, g_numTransforms, data.m_result, true ); } );
+        isValid &= RunBlendKernel( "Masked Local Blend", *pData, [&] ( Data& data ) { BlendScalar( data, 1.0f, true, true, SLerp, Lerp ); }, [&] ( Data& data ) { Blender::LocalBlend( data.m_a, data.m_b, 1.0f, data.m_t, g_numTransforms, data.m_result ); } );
+        isValid &= RunBlendKernel( "Additive Blend", *pData, [&] ( Data& data ) { BlendScalar( data, blendWeight, false, false, AdditiveRotation, AdditiveTranslation ); }, [&] ( Data& data ) { Blender::AdditiveBlend( data.m_a, data.m_b, blendWeight, nullptr, g_numTransforms, data.m_result ); } );
+        isValid &= RunBlendKernel( "Masked Additive Blend", *pData, [&] ( Data& data ) { BlendScalar( data, 1.0f, true, false, AdditiveRotation, AdditiveTranslation ); }, [&] ( Data& data ) { Blender::AdditiveBlend( data.m_a, data.m_b, 1.0f, data.m_t, g_numTransforms, data.m_result ); } );
+
+        EE::Delete( pData );
+        return isValid ? 0 : 1;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+// Checks the SoA and the partially cached global pose calculations against a scalar parent chain reference, and times them
+// The skeletons range from a single deep chain to wide random hierarchies, some bones have negative scales to exercise the scalar fallback
+// The partial cache is checked after every round of local pose changes, so any stale cached transform fails the run
+namespace GlobalPoseBenchmark
+{
+    constexpr static int32_t const g_numSkeletons = 24;
+    constexpr static int32_t const g_numBones = 200;
+    constexpr static int32_t const g_numPosesPerSkeleton = 8;
+    constexpr static int32_t const g_numInvalidationRounds = 8;
+    constexpr static int32_t const g_numIterations = 1000;
+    constexpr static float const g_maxError = 1e-4f; // Relative to the magnitude of the translation/scale
+
+    static Transform CreateRandomTransform()
+    {
+        Quaternion const rotation( EulerAngles( Math::GetRandomFloat( -180, 180 ), Math::GetRandomFloat( -180, 180 ), Math::GetRandomFloat( -180, 180 ) ) );
+        Vector const translation( Math::GetRandomFloat( -1.0f, 1.0f ), Math::GetRandomFloat( -1.0f, 1.0f ), Math::GetRandomFloat( -1.0f, 1.0f ) );
+        float const scale = Math::GetRandomFloat( 0.8f, 1.25f ) * ( ( Math::GetRandomInt( 0, 19 ) == 0 ) ? -1.0f : 1.0f );
+        return Transform( rotation, translation, scale );
+    }
+
+    // The max parent distance controls the shape of the hierarchy: 1 is a single chain, larger values create wider and shallower hierarchies
+    static Animation::Skeleton CreateRandomSkeleton( int32_t numBones, int32_t maxParentDistance, int32_t numBonesToSampleAtLowLOD )
+    {
+        TVector<StringID> boneIDs;
+        TVector<int32_t> parentIndices;
+        TVector<Transform> referencePose;
+
+        for ( int32_t i = 0; i < numBones; i++ )
+        {
+            boneIDs.emplace_back( StringID( InlineString( InlineString::CtorSprintf(), "Bone%d", i ).c_str() ) );
+            int32_t const minParentIdx = Math::Max( 0, i - maxParentDistance );
+            parentIndices.emplace_back( ( i == 0 ) ? InvalidIndex : ( ( minParentIdx == i - 1 ) ? minParentIdx : Math::GetRandomInt( minParentIdx, i - 1 ) ) );
+            referencePose.emplace_back( CreateRandomTransform() );
+        }
+
+        return Animation::Skeleton( boneIDs, parentIndices, referencePose, numBonesToSampleAtLowLOD );
+    }
+
+    static void CalculateReferenceGlobalTransforms( Animation::Pose const& pose, TVector<Transform>& outGlobalTransforms )
+    {
+        Animation::Skeleton const* pSkeleton = pose.GetSkeleton();
+        int32_t const numBones = pose.GetNumBones();
+        outGlobalTransforms.resize( numBones );
+
+        outGlobalTransforms[0] = pose.GetTransform( 0 );
+        for ( int32_t boneIdx = 1; boneIdx < numBones; boneIdx++ )
+        {
+            outGlobalTransforms[boneIdx] = pose.GetTransform( boneIdx ) * outGlobalTransforms[pSkeleton->GetParentBoneIndex( boneIdx )];
+        }
+    }
+
+    static float GetMaxAbsComponent( Vector const& v )
+    {
+        Float4 const absV = v.GetAbs().ToFloat4();
+        return Math::Max( Math::Max( absV.m_x, absV.m_y ), Math::Max( absV.m_z, absV.m_w ) );
+    }
+
+    static float GetError( Transform const& transform, Transform const& expected )
+    {
+        Vector const expectedRotation = expected.GetRotation().ToVector();
+        Vector const rotation = transform.GetRotation().ToVector();
+
+        // q and -q are the same rotation
+        float const rotationError = Math::Min( GetMaxAbsComponent( rotation - expectedRotation ), GetMaxAbsComponent( rotation + expectedRotation ) );
+        Vector const expectedTranslationScale = expected.GetTranslationAndScale();
+        float const translationScaleError = GetMaxAbsComponent( transform.GetTranslationAndScale() - expectedTranslationScale ) / Math::Max( 1.0f, GetMaxAbsComponent( expectedTranslationScale ) );
+        return Math::Max( rotationError, translationScaleError );
+    }
+
+    static int Run()
+    {
+        float maxFullError = 0.0f;
+        float maxPartialError = 0.0f;
+        float maxInvalidatedError = 0.0f;
+        Milliseconds scalarTime = 0.0f;
+        Milliseconds SoATime = 0.0f;
+        int64_t numPosesTimed = 0;
+
+        TVector<Transform> referenceGlobalTransforms;
+
+        for ( int32_t s = 0; s < g_numSkeletons; s++ )
+        {
+            int32_t const maxParentDistance = ( s % 3 == 0 ) ? 1 : ( ( s % 3 == 1 ) ? 4 : g_numBones );
+            Animation::Skeleton const skeleton = CreateRandomSkeleton( g_numBones, maxParentDistance, g_numBones );
+
+            for ( int32_t p = 0; p < g_numPosesPerSkeleton; p++ )
+            {
+                Animation::Pose pose( &skeleton, Animation::Pose::Type::ZeroPose );
+                for ( int32_t boneIdx = 0; boneIdx < g_numBones; boneIdx++ )
+                {
+                    pose.SetTransform( boneIdx, CreateRandomTransform() );
+                }
+
+                CalculateReferenceGlobalTransforms( pose, referenceGlobalTransforms );
+
+                // Full (SoA) calculation
+                //-------------------------------------------------------------------------
+
+                pose.CalculateGlobalTransforms();
+                for ( int32_t boneIdx = 0; boneIdx < g_numBones; boneIdx++ )
+                {
+                    maxFullError = Math::Max( maxFullError, GetError( pose.GetGlobalTransforms()[boneIdx], referenceGlobalTransforms[boneIdx] ) );
+                }
+
+                // Partial calculation, query a random subset of bones so that the chains are only partially cached
+                //-------------------------------------------------------------------------
+
+                pose.ClearGlobalTransforms();
+                for ( int32_t i = 0; i < g_numBones / 4; i++ )
+                {
+                    int32_t const boneIdx = Math::GetRandomInt( 0, g_numBones - 1 );
+                    maxPartialError = Math::Max( maxPartialError, GetError( pose.GetGlobalTransform( boneIdx ), referenceGlobalTransforms[boneIdx] ) );
+                }
+
+                // Invalidation, change some of the local transforms and check that no stale cached transforms are returned
+                //-------------------------------------------------------------------------
+
+                for ( int32_t r = 0; r < g_numInvalidationRounds; r++ )
+                {
+                    int32_t const numChangedBones = Math::GetRandomInt( 1, 4 );
+                    for ( int32_t i = 0; i < numChangedBones; i++ )
+                    {
+                        int32_t const boneIdx = Math::GetRandomInt( 0, g_numBones - 1 );
+                        Transform const newTransform = CreateRandomTransform();
+
+                        switch ( Math::GetRandomInt( 0, 3 ) )
+                        {
+                            case 0: pose.SetTransform( boneIdx, newTransform ); break;
+                            case 1: pose.SetRotation( boneIdx, newTransform.GetRotation() ); break;
+                            case 2: pose.SetTranslation( boneIdx, newTransform.GetTranslation() ); break;
+                            case 3: pose.SetScale( boneIdx, newTransform.GetScale() ); break;
+                        }
+                    }
+
+                    CalculateReferenceGlobalTransforms( pose, referenceGlobalTransforms );
+
+                    for ( int32_t i = 0; i < g_numBones / 4; i++ )
+                    {
+                        int32_t const boneIdx = Math::GetRandomInt( 0, g_numBones - 1 );
+                        maxInvalidatedError = Math::Max( maxInvalidatedError, GetError( pose.GetGlobalTransform( boneIdx ), referenceGlobalTransforms[boneIdx] ) );
+                    }
+                }
+
+                // Timing
+                //-------------------------------------------------------------------------
+
+                if ( p == 0 )
+                {
+                    Milliseconds elapsedTime = 0.0f;
+
+                    {
+                        ScopedTimer<PlatformClock> timer( elapsedTime );
+                        for ( int32_t i = 0; i < g_numIterations; i++ )
+                        {
+                            CalculateReferenceGlobalTransforms( pose, referenceGlobalTransforms );
+                        }
+                    }
+                    scalarTime += elapsedTime;
+
+                    {
+                        ScopedTimer<PlatformClock> timer( elapsedTime );
+                        for ( int32_t i = 0; i < g_numIterations; i++ )
+                        {
+                            pose.CalculateGlobalTransforms();
+                        }
+                    }
+                    SoATime += elapsedTime;
+
+                    numPosesTimed += g_numIterations;
+                }
+            }
+        }
+
+        // Report
+        //-------------------------------------------------------------------------
+
+        std::cout << "Global Pose (" << g_numSkeletons << " skeletons x " << g_numPosesPerSkeleton << " poses, " << g_numBones << " bones)" << std::endl;
+        std::cout << "Max Errors - Full: " << maxFullError << ", Partial: " << maxPartialError << ", After Invalidation: " << maxInvalidatedError << " (allowed: " << g_maxError << ")" << std::endl;
+        std::cout << "Avg Per Pose - Scalar: " << ( scalarTime.ToFloat() * 1000.0f / numPosesTimed ) << "us, SoA: " << ( SoATime.ToFloat() * 1000.0f / numPosesTimed ) << "us" << std::endl;
+
+        if ( maxFullError > g_maxError || maxPartialError > g_maxError || maxInvalidatedError > g_maxError )
+        {
+            std::cout << "Global pose calculation failed validation!" << std::endl;
+            return 1;
+        }
+
+        return 0;
+    }
+}
+#endif
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+// Checks the pose level local, additive and global blends against scalar references on random skeletons and bone masks
+// The blends are run in place the same way the blend tasks run them, and every other skeleton is blended at the low LOD to check that bones past the LOD bone count are left untouched
+namespace PoseBlendBenchmark
+{
+    constexpr static int32_t const g_numSkeletons = 24;
+    constexpr static int32_t const g_numBones = 200;
+    constexpr static int32_t const g_numPosesPerSkeleton = 10;
+    constexpr static int32_t const g_numIterations = 1000;
+    constexpr static float const g_maxError = 1e-4f; // Relative to the magnitude of the translation/scale
+
+    enum class BlendType
+    {
+        Local,
+        LocalFastSLerp,
+        Additive,
+    };
+
+    enum class MaskType
+    {
+        Mixed,
+        MixedWithFullWeightRoot,
+        MixedWithMaskedOutRoot,
+        Zero,
+        Full,
+    };
+
+    // Mixed masks have fully masked out and fully weighted ranges between the partially weighted bones, the root weight is set separately since the global blend handles it differently
+    static void CreateBoneMask( Animation::BoneMask& boneMask, MaskType maskType )
+    {
+        if ( maskType == MaskType::Zero || maskType == MaskType::Full )
+        {
+            boneMask.ResetWeights( ( maskType == MaskType::Zero ) ? 0.0f : 1.0f );
+            return;
+        }
+
+        TVector<float> weights;
+        weights.resize( g_numBones );
+        for ( int32_t i = 0; i < g_numBones; i++ )
+        {
+            int32_t const range = ( i / 8 ) % 4;
+            weights[i] = ( range == 0 ) ? 0.0f : ( ( range == 1 ) ? 1.0f : Math::GetRandomFloat( 0.0f, 1.0f ) );
+        }
+
+        if ( maskType == MaskType::MixedWithFullWeightRoot )
+        {
+            weights[0] = 1.0f;
+        }
+        else if ( maskType == MaskType::MixedWithMaskedOutRoot )
+        {
+            weights[0] = 0.0f;
+        }
+        else
+        {
+            weights[0] = Math::GetRandomFloat( 0.1f, 0.9f );
+        }
+
+        boneMask.ResetWeights( weights );
+    }
+
+    static void CreateRandomPose( Animation::Pose& pose )
+    {
+        for ( int32_t boneIdx = 0; boneIdx < pose.GetNumBones(); boneIdx++ )
+        {
+            pose.SetTransform( boneIdx, GlobalPoseBenchmark::CreateRandomTransform() );
+        }
+    }
+
+    static Transform BlendTransform( BlendType blendType, Transform const& source, Transform const& target, float blendWeight )
+    {
+        Quaternion rotation;
+        Vector translationScale;
+
+        switch ( blendType )
+        {
+            case BlendType::Local:
+            {
+                rotation = Quaternion::SLerp( source.GetRotation(), target.GetRotation(), blendWeight );
+                translationScale = Vector::Lerp( source.GetTranslationAndScale(), target.GetTranslationAndScale(), blendWeight );
+            }
+            break;
+
+            case BlendType::LocalFastSLerp:
+            {
+                rotation = Quaternion::FastSLerp( source.GetRotation(), target.GetRotation(), blendWeight );
+                translationScale = Vector::Lerp( source.GetTranslationAndScale(), target.GetTranslationAndScale(), blendWeight );
+            }
+            break;
+
+            case BlendType::Additive:
+            {
+                rotation = Quaternion::SLerp( source.GetRotation(), target.GetRotation() * source.GetRotation(), blendWeight );
+                translationScale = Vector::MultiplyAdd( target.GetTranslationAndScale(), Vector( blendWeight ), source.GetTranslationAndScale() );
+            }
+            break;
+        }
+
+        Transform result = source;
+        Transform::DirectlySetRotation( result, rotation );
+        Transform::DirectlySetTranslationScale( result, translationScale );
+        return result;
+    }
+
+    static void LocalBlendReference( BlendType blendType, Animation::Pose const& source, Animation::Pose const& target, float blendWeight, Animation::BoneMask const* pBoneMask, int32_t numBones, TVector<Transform>& outTransforms )
+    {
+        outTransforms.resize( numBones );
+        for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            float const boneBlendWeight = ( pBoneMask != nullptr ) ? blendWeight * pBoneMask->GetWeight( boneIdx ) : blendWeight;
+            if ( boneBlendWeight == 0.0f )
+            {
+                outTransforms[boneIdx] = source.GetTransform( boneIdx );
+            }
+            else if ( blendType != BlendType::Additive && boneBlendWeight == 1.0f )
+            {
+                outTransforms[boneIdx] = target.GetTransform( boneIdx );
+            }
+            else
+            {
+                outTransforms[boneIdx] = BlendTransform( blendType, source.GetTransform( boneIdx ), target.GetTransform( boneIdx ), boneBlendWeight );
+            }
+        }
+    }
+
+    // Blend the global rotations and the local translations/scales of the masked bones and then blend the result onto the base pose
+    // The root is blended like every other bone since its global rotation is its local rotation
+    static void GlobalBlendReference( Animation::Pose const& base, Animation::Pose const& layer, float layerWeight, Animation::BoneMask const& boneMask, int32_t numBones, TVector<Transform>& outTransforms )
+    {
+        Animation::Skeleton const* pSkeleton = base.GetSkeleton();
+
+        TVector<Quaternion> baseRotations, layerRotations, resultRotations;
+        baseRotations.resize( numBones );
+        layerRotations.resize( numBones );
+        resultRotations.resize( numBones );
+
+        TVector<Transform> layeredTransforms;
+        layeredTransforms.resize( numBones );
+
+        for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            int32_t const parentIdx = pSkeleton->GetParentBoneIndex( boneIdx );
+            baseRotations[boneIdx] = ( boneIdx == 0 ) ? base.GetTransform( 0 ).GetRotation() : base.GetTransform( boneIdx ).GetRotation() * baseRotations[parentIdx];
+            layerRotations[boneIdx] = ( boneIdx == 0 ) ? layer.GetTransform( 0 ).GetRotation() : layer.GetTransform( boneIdx ).GetRotation() * layerRotations[parentIdx];
+
+            layeredTransforms[boneIdx] = base.GetTransform( boneIdx );
+
+            float const boneBlendWeight = boneMask.GetWeight( boneIdx );
+            if ( boneBlendWeight == 0.0f )
+            {
+                resultRotations[boneIdx] = baseRotations[boneIdx];
+            }
+            else
+            {
+                resultRotations[boneIdx] = Quaternion::FastSLerp( baseRotations[boneIdx], layerRotations[boneIdx], boneBlendWeight );
+                Transform::DirectlySetRotation( layeredTransforms[boneIdx], ( boneIdx == 0 ) ? resultRotations[0] : Quaternion::Delta( resultRotations[parentIdx], resultRotations[boneIdx] ) );
+                Transform::DirectlySetTranslationScale( layeredTransforms[boneIdx], Vector::Lerp( base.GetTransform( boneIdx ).GetTranslationAndScale(), layer.GetTransform( boneIdx ).GetTranslationAndScale(), boneBlendWeight ) );
+            }
+        }
+
+        outTransforms.resize( numBones );
+        for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            outTransforms[boneIdx] = ( layerWeight == 1.0f ) ? layeredTransforms[boneIdx] : BlendTransform( BlendType::LocalFastSLerp, base.GetTransform( boneIdx ), layeredTransforms[boneIdx], layerWeight );
+        }
+    }
+
+    // Compares the blended bones against the reference and checks that the bones past the LOD bone count still match the expected untouched pose
+    static float GetMaxError( Animation::Pose const& result, TVector<Transform> const& expectedTransforms, Animation::Pose const& untouchedPose, bool& outModifiedBonesPastLOD )
+    {
+        int32_t const numBlendedBones = (int32_t) expectedTransforms.size();
+
+        float maxError = 0.0f;
+        for ( int32_t boneIdx = 0; boneIdx < numBlendedBones; boneIdx++ )
+        {
+            maxError = Math::Max( maxError, GlobalPoseBenchmark::GetError( result.GetTransform( boneIdx ), expectedTransforms[boneIdx] ) );
+        }
+
+        for ( int32_t boneIdx = numBlendedBones; boneIdx < result.GetNumBones(); boneIdx++ )
+        {
+            if ( memcmp( &result.GetTransform( boneIdx ), &untouchedPose.GetTransform( boneIdx ), sizeof( Transform ) ) != 0 )
+            {
+                outModifiedBonesPastLOD = true;
+            }
+        }
+
+        return maxError;
+    }
+
+    static int Run()
+    {
+        using namespace Animation;
+
+        float maxLocalError = 0.0f;
+        float maxFastSLerpError = 0.0f;
+        float maxAdditiveError = 0.0f;
+        float maxGlobalError = 0.0f;
+        bool modifiedBonesPastLOD = false;
+
+        Milliseconds referenceTime = 0.0f;
+        Milliseconds blenderTime = 0.0f;
+        int64_t numBlendsTimed = 0;
+
+        TVector<Transform> expectedTransforms;
+
+        for ( int32_t s = 0; s < g_numSkeletons; s++ )
+        {
+            // Low LOD bone counts are random so that most of them end partway through a SIMD batch
+            bool const useLowLOD = ( s % 2 ) == 1;
+            int32_t const numBonesToSampleAtLowLOD = Math::GetRandomInt( 1, g_numBones - 1 );
+            int32_t const maxParentDistance = ( s % 3 == 0 ) ? 1 : ( ( s % 3 == 1 ) ? 4 : g_numBones );
+            Skeleton const skeleton = GlobalPoseBenchmark::CreateRandomSkeleton( g_numBones, maxParentDistance, numBonesToSampleAtLowLOD );
+
+            Skeleton::LOD const lod = useLowLOD ? Skeleton::LOD::Low : Skeleton::LOD::High;
+            int32_t const numBlendedBones = skeleton.GetNumBones( lod );
+
+            for ( int32_t p = 0; p < g_numPosesPerSkeleton; p++ )
+            {
+                MaskType const maskType = (MaskType) ( p % 5 );
+                BoneMask boneMask( &skeleton );
+                CreateBoneMask( boneMask, maskType );
+
+                Pose source( &skeleton, Pose::Type::ZeroPose );
+                Pose target( &skeleton, Pose::Type::ZeroPose );
+                CreateRandomPose( source );
+                CreateRandomPose( target );
+
+                // Blend weights are below one so that the unmasked blends don't early out into a full pose copy
+                float const blendWeight = Math::GetRandomFloat( 0.1f, 0.9f );
+
+                // Local blends, the result is written into the source pose
+                //-------------------------------------------------------------------------
+
+                for ( BlendType blendType : { BlendType::Local, BlendType::LocalFastSLerp, BlendType::Additive } )
+                {
+                    for ( BoneMask const* pBoneMask : { (BoneMask const*) nullptr, (BoneMask const*) &boneMask } )
+                    {
+                        LocalBlendReference( blendType, source, target, blendWeight, pBoneMask, numBlendedBones, expectedTransforms );
+
+                        Pose result( &skeleton, Pose::Type::ZeroPose );
+                        result.CopyFrom( source );
+
+                        if ( blendType == BlendType::Additive )
+                        {
+                            Blender::AdditiveBlend( lod, &result, &target, blendWeight, pBoneMask, &result );
+                        }
+                        else
+                        {
+                            Blender::LocalBlend( lod, &result, &target, blendWeight, pBoneMask, &result, blendType == BlendType::LocalFastSLerp );
+                        }
+
+                        float const error = GetMaxError( result, expectedTransforms, source, modifiedBonesPastLOD );
+                        float& maxError = ( blendType == BlendType::Local ) ? maxLocalError : ( ( blendType == BlendType::LocalFastSLerp ) ? maxFastSLerpError : maxAdditiveError );
+                        maxError = Math::Max( maxError, error );
+                    }
+                }
+
+                // Global blend, the result is written into the layer pose
+                //-------------------------------------------------------------------------
+                // A zero weight mask copies the whole base pose, including the bones past the LOD bone count
+
+                float const layerWeight = ( p % 2 == 0 ) ? 1.0f : blendWeight;
+                GlobalBlendReference( source, target, layerWeight, boneMask, numBlendedBones, expectedTransforms );
+
+                Pose result( &skeleton, Pose::Type::ZeroPose );
+                result.CopyFrom( target );
+                Blender::GlobalBlend( lod, &source, &result, layerWeight, &boneMask, &result );
+                maxGlobalError = Math::Max( maxGlobalError, GetMaxError( result, expectedTransforms, ( maskType == MaskType::Zero ) ? source : target, modifiedBonesPastLOD ) );
+
+                // Timing
+                //-------------------------------------------------------------------------
+
+                if ( !useLowLOD && maskType == MaskType::Mixed )
+                {
+                    Milliseconds elapsedTime = 0.0f;
+
+                    {
+                        ScopedTimer<PlatformClock> timer( elapsedTime );
+                        for ( int32_t i = 0; i < g_numIterations; i++ )
+                        {
+                            GlobalBlendReference( source, target, blendWeight, boneMask, numBlendedBones, expectedTransforms );
+                        }
+                    }
+                    referenceTime += elapsedTime;
+
+                    {
+                        ScopedTimer<PlatformClock> timer( elapsedTime );
+                        for ( int32_t i = 0; i < g_numIterations; i++ )
+                        {
+                            Blender::GlobalBlend( lod, &source, &target, blendWeight, &boneMask, &result );
+                        }
+                    }
+                    blenderTime += elapsedTime;
+
+                    numBlendsTimed += g_numIterations;
+                }
+            }
+        }
+
+        // Report
+        //-------------------------------------------------------------------------
+
+        std::cout << "Pose Blends (" << g_numSkeletons << " skeletons x " << g_numPosesPerSkeleton << " poses, " << g_numBones << " bones)" << std::endl;
+        std::cout << "Max Errors - Local: " << maxLocalError << ", Local (FastSLerp): " << maxFastSLerpError << ", Additive: " << maxAdditiveError << ", Global: " << maxGlobalError << " (allowed: " << g_maxError << ")" << std::endl;
+        std::cout << "Global Blend Avg - Reference: " << ( referenceTime.ToFloat() * 1000.0f / numBlendsTimed ) << "us, Blender: " << ( blenderTime.ToFloat() * 1000.0f / numBlendsTimed ) << "us" << std::endl;
+
+        bool isValid = true;
+
+        if ( modifiedBonesPastLOD )
+        {
+            std::cout << "Pose blends modified bones past the LOD bone count!" << std::endl;
+            isValid = false;
+        }
+
+        if ( maxLocalError > g_maxError || maxFastSLerpError > g_maxError || maxAdditiveError > g_maxError || maxGlobalError > g_maxError )
+        {
+            std::cout << "Pose blends failed validation!" << std::endl;
+            isValid = false;
+        }
+
+        return isValid ? 0 : 1;
+    }
+}
+#endif
+
+//-------------------------------------------------------------------------
+
+// Compares handing every component to every world system (with parent ID walks) against the interest based component routing
+namespace ComponentRoutingBenchmark
+{
+    constexpr static int32_t const g_numComponents = 100000;
+    constexpr static int32_t const g_numIterations = 20;
+
+    static int Run( TypeSystem::TypeRegistry const& typeRegistry )
+    {
+        TVector<EntityComponent*> components;
+        for ( auto pTypeInfo : typeRegistry.GetAllDerivedTypes( EntityComponent::GetStaticTypeID(), false, false ) )
+        {
+            components.emplace_back( const_cast<EntityComponent*>( Cast<EntityComponent>( pTypeInfo->GetDefaultInstance() ) ) );
+        }
+
+        TVector<EntityWorldSystem*> worldSystems;
+        for ( auto pTypeInfo : typeRegistry.GetAllDerivedTypes( EntityWorldSystem::GetStaticTypeID(), false, false ) )
+        {
+            worldSystems.emplace_back( const_cast<EntityWorldSystem*>( Cast<EntityWorldSystem>( pTypeInfo->GetDefaultInstance() ) ) );
+        }
+
+        if ( components.empty() || worldSystems.empty() )
+        {
+            std::cout << "No component or world system types registered" << std::endl;
+            return 1;
+        }
+
+        EntityModel::ComponentRoutingTable routingTable;
+        routingTable.Initialize( &typeRegistry, worldSystems );
+
+        int32_t const numSystems = (int32_t) worldSystems.size();
+        int32_t const numComponentTypes = (int32_t) components.size();
+
+        //-------------------------------------------------------------------------
+
+        Milliseconds broadcastTime, routedTime;
+        uint64_t numBroadcastMatches = 0, numRoutedMatches = 0;
+
+        // Every system is sent every component and checks it against each of its types
+        {
+            ScopedTimer<PlatformClock> timer( broadcastTime );
+            for ( int32_t j = 0; j < g_numIterations; j++ )
+            {
+                for ( int32_t i = 0; i < g_numComponents; i++ )
+                {
+                    TypeSystem::TypeInfo const* pComponentTypeInfo = components[i % numComponentTypes]->GetTypeInfo();
+                    for ( int32_t s = 0; s < numSystems; s++ )
+                    {
+                        if ( routingTable.IsSystemInterestedInAllComponents( s ) )
+                        {
+                            numBroadcastMatches++;
+                            continue;
+                        }
+
+                        for ( auto pInterestTypeInfo : routingTable.GetSystemInterests( s ) )
+                        {
+                            if ( pComponentTypeInfo->IsDerivedFrom( pInterestTypeInfo->m_ID ) )
+                            {
+                                numBroadcastMatches++;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // Components are only sent to the interested systems, which then check the types with the hierarchy intervals
+        {
+            ScopedTimer<PlatformClock> timer( routedTime );
+            for ( int32_t j = 0; j < g_numIterations; j++ )
+            {
+                for ( int32_t i = 0; i < g_numComponents; i++ )
+                {
+                    TypeSystem::TypeInfo const* pComponentTypeInfo = components[i % numComponentTypes]->GetTypeInfo();
+                    for ( int16_t systemIdx : routingTable.GetInterestedSystems( pComponentTypeInfo ) )
+                    {
+                        if ( routingTable.IsSystemInterestedInAllComponents( systemIdx ) )
+                        {
+                            numRoutedMatches++;
+                            continue;
+                        }
+
+                        for ( auto pInterestTypeInfo : routingTable.GetSystemInterests( systemIdx ) )
+                        {
+                            if ( pComponentTypeInfo->IsDerivedFrom( pInterestTypeInfo ) )
+                            {
+                                numRoutedMatches++;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        routingTable.Shutdown();
+
+        //-------------------------------------------------------------------------
+
+        std::cout << "Component Routing (" << g_numComponents << " components x " << g_numIterations << " iterations, " << numComponentTypes << " component types, " << numSystems << " world systems)" << std::endl;
+        std::cout << "Broadcast: " << broadcastTime.ToFloat() << "ms, Routed: " << routedTime.ToFloat() << "ms, Speedup: " << ( broadcastTime.ToFloat() / Math::Max( routedTime.ToFloat(), 0.001f ) ) << "x" << std::endl;
+
+        if ( numBroadcastMatches != numRoutedMatches )
+        {
+            std::cout << "Mismatch! Broadcast matches: " << numBroadcastMatches << ", Routed matches: " << numRoutedMatches << std::endl;
+            return 1;
+        }
+
+        return 0;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+// Compares iterating individually allocated components against components allocated from a map's per-type component pool
+// Cache misses are estimated by counting the jumps between consecutive components that cant be covered by the hardware prefetcher
+// Also checks that repeatedly creating and destroying collections doesnt grow the pool
+namespace ComponentPoolBenchmark
+{
+    constexpr static int32_t const g_numComponents = 50000;
+    constexpr static int32_t const g_numIterations = 100;
+    constexpr static uintptr_t const g_maxPrefetchDistance = 128;
+    constexpr static int32_t const g_numChurnComponents = 500;
+    constexpr static int32_t const g_numChurnIterations = 100;
+
+    struct Results
+    {
+        Milliseconds                    m_creationTime = 0.0f;
+        Milliseconds                    m_iterationTime = 0.0f;
+        int32_t                         m_numNonSequentialAccesses = 0;
+        float                           m_checksum = 0.0f;
+    };
+
+    static Results RunTest( TypeSystem::TypeRegistry const& typeRegistry, EntityModel::SerializedEntityCollection const& collection, EntityModel::ComponentPool* pComponentPool )
+    {
+        Results results;
+
+        TVector<Entity*> entities;
+        {
+            ScopedTimer<PlatformClock> timer( results.m_creationTime );
+            entities = EntityModel::Serializer::CreateEntities( nullptr, typeRegistry, collection, pComponentPool );
+        }
+
+        // Gather the components the way a world system would
+        TVector<Render::StaticMeshComponent*> components;
+        components.reserve( entities.size() );
+        for ( auto pEntity : entities )
+        {
+            components.emplace_back( Cast<Render::StaticMeshComponent>( pEntity->GetRootSpatialComponent() ) );
+        }
+
+        for ( int32_t i = 1; i < g_numComponents; i++ )
+        {
+            uintptr_t const previousAddress = reinterpret_cast<uintptr_t>( components[i - 1] );
+            uintptr_t const address = reinterpret_cast<uintptr_t>( components[i] );
+            if ( address < previousAddress || ( address - previousAddress ) > g_maxPrefetchDistance + sizeof( Render::StaticMeshComponent ) )
+            {
+                results.m_numNonSequentialAccesses++;
+            }
+        }
+
+        // Touch the same data as the renderer's visibility pass
+        {
+            ScopedTimer<PlatformClock> timer( results.m_iterationTime );
+            for ( int32_t j = 0; j < g_numIterations; j++ )
+            {
+                for ( auto pComponent : components )
+                {
+                    results.m_checksum += pComponent->GetWorldTransform().GetTranslation().GetX() + pComponent->GetWorldBounds().m_extents.GetX();
+                }
+            }
+        }
+
+        for ( auto pEntity : entities )
+        {
+            EE::Delete( pEntity );
+        }
+
+        return results;
+    }
+
+    // Create and destroy a collection over and over, returning the peak pool memory usage
+    static size_t RunChurnTest( TypeSystem::TypeRegistry const& typeRegistry, EntityModel::SerializedEntityCollection const& collection, EntityModel::ComponentPool& componentPool )
+    {
+        size_t peakMemoryUsage = 0;
+        for ( int32_t j = 0; j < g_numChurnIterations; j++ )
+        {
+            TVector<Entity*> entities = EntityModel::Serializer::CreateEntities( nullptr, typeRegistry, collection, &componentPool );
+            peakMemoryUsage = Math::Max( peakMemoryUsage, componentPool.GetStats().m_memoryUsage );
+
+            for ( auto pEntity : entities )
+            {
+                EE::Delete( pEntity );
+            }
+        }
+
+        return peakMemoryUsage;
+    }
+
+    // Each entity has a single root mesh component
+    static void CreateCollection( int32_t numEntities, EntityModel::SerializedEntityCollection& outCollection )
+    {
+        TypeSystem::TypeInfo const* pComponentTypeInfo = Render::StaticMeshComponent::s_pTypeInfo;
+        EE_ASSERT( pComponentTypeInfo != nullptr );
+
+        TVector<EntityModel::SerializedEntityDescriptor> entityDescs;
+        entityDescs.resize( numEntities );
+
+        InlineString name;
+        for ( int32_t i = 0; i < numEntities; i++ )
+        {
+            name.sprintf( "Entity_%d", i );
+            entityDescs[i].m_name = StringID( name.c_str() );
+            entityDescs[i].m_numSpatialComponents = 1;
+
+            EntityModel::SerializedComponentDescriptor& componentDesc = entityDescs[i].m_components.emplace_back();
+            componentDesc.m_typeID = pComponentTypeInfo->m_ID;
+            componentDesc.m_name = StringID( "Mesh" );
+            componentDesc.m_isSpatialComponent = true;
+        }
+
+        outCollection.SetCollectionData( eastl::move( entityDescs ) );
+    }
+
+    static int Run( TypeSystem::TypeRegistry const& typeRegistry )
+    {
+        TypeSystem::TypeInfo const* pComponentTypeInfo = Render::StaticMeshComponent::s_pTypeInfo;
+        EE_ASSERT( pComponentTypeInfo != nullptr );
+
+        EntityModel::SerializedEntityCollection collection;
+        CreateCollection( g_numComponents, collection );
+
+        EntityModel::SerializedEntityCollection churnCollection;
+        CreateCollection( g_numChurnComponents, churnCollection );
+
+        //-------------------------------------------------------------------------
+
+        Results const individualResults = RunTest( typeRegistry, collection, nullptr );
+
+        EntityModel::ComponentPool componentPool;
+        Results const pooledResults = RunTest( typeRegistry, collection, &componentPool );
+        EntityModel::ComponentPool::Stats const poolStats = componentPool.GetStats();
+        componentPool.Reset();
+
+        // A single churn collection needs a single slab, so the pool should never hold more than that
+        size_t const churnCollectionMemoryUsage = g_numChurnComponents * ( ( pComponentTypeInfo->m_size + pComponentTypeInfo->m_alignment - 1 ) / pComponentTypeInfo->m_alignment ) * pComponentTypeInfo->m_alignment;
+        size_t const churnPeakMemoryUsage = RunChurnTest( typeRegistry, churnCollection, componentPool );
+        componentPool.Reset();
+
+        //-------------------------------------------------------------------------
+
+        std::cout << "Component Pool (" << g_numComponents << " x " << pComponentTypeInfo->GetTypeName() << ", " << pComponentTypeInfo->m_size << " bytes, " << g_numIterations << " iterations)" << std::endl;
+        std::cout << "Individual - Create: " << individualResults.m_creationTime.ToFloat() << "ms, Iterate: " << individualResults.m_iterationTime.ToFloat() << "ms, Non-sequential Accesses: " << individualResults.m_numNonSequentialAccesses << std::endl;
+        std::cout << "Pooled - Create: " << pooledResults.m_creationTime.ToFloat() << "ms, Iterate: " << pooledResults.m_iterationTime.ToFloat() << "ms, Non-sequential Accesses: " << pooledResults.m_numNonSequentialAccesses << std::endl;
+        std::cout << "Pool Slabs: " << poolStats.m_numSlabs << ", Reserved Memory: " << ( poolStats.m_memoryUsage / 1024 ) << "KB" << std::endl;
+        std::cout << "Churn (" << g_numChurnComponents << " components x " << g_numChurnIterations << " iterations) - Peak Reserved Memory: " << ( churnPeakMemoryUsage / 1024 ) << "KB, Expected: " << ( churnCollectionMemoryUsage / 1024 ) << "KB" << std::endl;
+
+        if ( individualResults.m_checksum != pooledResults.m_checksum )
+        {
+            std::cout << "Mismatch! Individual: " << individualResults.m_checksum << ", Pooled: " << pooledResults.m_checksum << std::endl;
+            return 1;
+        }
+
+        if ( churnPeakMemoryUsage > churnCollectionMemoryUsage )
+        {
+            std::cout << "Pool growth! Destroyed collections are not being released" << std::endl;
+            return 1;
+        }
+
+        return 0;
+    }
+}
+#endif
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+// Compares spawning entities from their serialized descriptors against resetting existing (i.e. pooled) entities back to their serialized state
+// Pooled entities are first created from a mutated collection, so any state that the reset fails to restore is caught by comparing against the freshly spawned entities
+// Then spawns and destroys collections through an entity map every frame, with and without pooling, and reports the frame time spikes
+// Also checks that destroying pooled entities doesnt return them to their pool and that a hot-reloaded collection doesnt reuse existing instances
+namespace EntitySpawnBenchmark
+{
+    constexpr static int32_t const g_numEntities = 10000;
+    constexpr static int32_t const g_numIterations = 10;
+
+    // The navmesh component has nested structures and a dynamic array of structures alongside a resource ptr
+    static EntityModel::SerializedComponentDescriptor CreateComponentDescriptor( TypeSystem::TypeRegistry const& typeRegistry, int32_t entityIdx, bool isMutated )
+    {
+        Navmesh::NavmeshBuildSettings buildSettings;
+        buildSettings.m_defaultLayerBuildSettings.m_radius = isMutated ? 1.0f : 0.3f;
+        buildSettings.m_defaultLayerBuildSettings.m_optimizeForAxisAligned = isMutated;
+        buildSettings.m_enableBuildLogging = isMutated;
+
+        int32_t const numAdditionalLayers = isMutated ? 3 : 2;
+        for ( int32_t i = 0; i < numAdditionalLayers; i++ )
+        {
+            Navmesh::NavmeshLayerBuildSettings& layerSettings = buildSettings.m_additionalLayerBuildSettings.emplace_back();
+            layerSettings.m_radius = ( isMutated ? 2.0f : 0.5f ) + i;
+            layerSettings.m_maxNumIslands = isMutated ? 10 : i;
+        }
+
+        Navmesh::NavmeshComponent component;
+        component.SetBuildSettings( buildSettings );
+        component.SetLocalTransform( Transform( Quaternion::Identity, Vector( (float) entityIdx, isMutated ? 5.0f : 0.0f, 0.0f ) ) );
+
+        EntityModel::SerializedComponentDescriptor componentDesc;
+        componentDesc.DescribeTypeInstance( typeRegistry, &component, false );
+        componentDesc.m_name = StringID( "Navmesh" );
+        componentDesc.m_isSpatialComponent = true;
+        return componentDesc;
+    }
+
+    static void CreateCollection( TypeSystem::TypeRegistry const& typeRegistry, bool isMutated, EntityModel::SerializedEntityCollection& outCollection )
+    {
+        TVector<EntityModel::SerializedEntityDescriptor> entityDescs;
+        entityDescs.resize( g_numEntities );
+
+        InlineString name;
+        for ( int32_t i = 0; i < g_numEntities; i++ )
+        {
+            name.sprintf( "Entity_%d", i );
+            entityDescs[i].m_name = StringID( name.c_str() );
+            entityDescs[i].m_numSpatialComponents = 1;
+            entityDescs[i].m_components.emplace_back( CreateComponentDescriptor( typeRegistry, i, isMutated ) );
+        }
+
+        outCollection.SetCollectionData( eastl::move( entityDescs ) );
+    }
+
+    static bool AreComponentsEqual( TypeSystem::TypeRegistry const& typeRegistry, EntityComponent* pComponentA, EntityComponent* pComponentB )
+    {
+        if ( pComponentA->GetTypeID() != pComponentB->GetTypeID() || pComponentA->GetNameID() != pComponentB->GetNameID() )
+        {
+            return false;
+        }
+
+        TypeSystem::TypeDescriptor const descA( typeRegistry, pComponentA, false );
+        TypeSystem::TypeDescriptor const descB( typeRegistry, pComponentB, false );
+        if ( descA.m_properties.size() != descB.m_properties.size() )
+        {
+            return false;
+        }
+
+        for ( size_t i = 0; i < descA.m_properties.size(); i++ )
+        {
+            if ( descA.m_properties[i].m_path != descB.m_properties[i].m_path || descA.m_properties[i].m_byteValue != descB.m_properties[i].m_byteValue )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static void DestroyEntities( TVector<Entity*>& entities )
+    {
+        for ( auto pEntity : entities )
+        {
+            EE::Delete( pEntity );
+        }
+
+        entities.clear();
+    }
+
+    static int RunResetTest( TypeSystem::TypeRegistry const& typeRegistry )
+    {
+        EntityModel::SerializedEntityCollection collection;
+        CreateCollection( typeRegistry, false, collection );
+
+        EntityModel::SerializedEntityCollection mutatedCollection;
+        CreateCollection( typeRegistry, true, mutatedCollection );
+
+        auto const& entityDescs = collection.GetEntityDescriptors();
+
+        //-------------------------------------------------------------------------
+
+        Milliseconds spawnTime = 0.0f;
+        Milliseconds resetTime = 0.0f;
+        TVector<Entity*> spawnedEntities;
+        TVector<Entity*> pooledEntities = EntityModel::Serializer::CreateEntities( nullptr, typeRegistry, mutatedCollection );
+
+        for ( int32_t j = 0; j < g_numIterations; j++ )
+        {
+            DestroyEntities( spawnedEntities );
+
+            {
+                Milliseconds elapsedTime = 0.0f;
+                {
+                    ScopedTimer<PlatformClock> timer( elapsedTime );
+                    spawnedEntities = EntityModel::Serializer::CreateEntities( nullptr, typeRegistry, collection );
+                }
+                spawnTime += elapsedTime;
+            }
+
+            // Mutate the pooled entities so that every timed reset has state to restore
+            for ( int32_t i = 0; i < g_numEntities; i++ )
+            {
+                pooledEntities[i]->ResetToSerializedState( typeRegistry, mutatedCollection.GetEntityDescriptors()[i] );
+            }
+
+            {
+                Milliseconds elapsedTime = 0.0f;
+                {
+                    ScopedTimer<PlatformClock> timer( elapsedTime );
+                    for ( int32_t i = 0; i < g_numEntities; i++ )
+                    {
+                        pooledEntities[i]->ResetToSerializedState( typeRegistry, entityDescs[i] );
+                    }
+                }
+                resetTime += elapsedTime;
+            }
+        }
+
+        // Validate the reset entities against the freshly spawned ones
+        //-------------------------------------------------------------------------
+
+        int32_t numMismatches = 0;
+        for ( int32_t i = 0; i < g_numEntities; i++ )
+        {
+            auto const& spawnedComponents = spawnedEntities[i]->GetComponents();
+            auto const& pooledComponents = pooledEntities[i]->GetComponents();
+
+            bool isValid = spawnedComponents.size() == pooledComponents.size();
+            for ( size_t c = 0; isValid && c < spawnedComponents.size(); c++ )
+            {
+                isValid = AreComponentsEqual( typeRegistry, spawnedComponents[c], pooledComponents[c] );
+            }
+
+            isValid = isValid && spawnedEntities[i]->GetWorldTransform().GetTranslation().IsNearEqual3( pooledEntities[i]->GetWorldTransform().GetTranslation() );
+
+            if ( !isValid )
+            {
+                numMismatches++;
+            }
+        }
+
+        DestroyEntities( spawnedEntities );
+        DestroyEntities( pooledEntities );
+
+        //-------------------------------------------------------------------------
+
+        std::cout << "Entity Spawn (" << g_numEntities << " entities x " << g_numIterations << " iterations)" << std::endl;
+        std::cout << "Spawn: " << spawnTime.ToFloat() << "ms, Reset: " << resetTime.ToFloat() << "ms, Speedup: " << ( spawnTime.ToFloat() / Math::Max( resetTime.ToFloat(), 0.001f ) ) << "x" << std::endl;
+
+        if ( numMismatches > 0 )
+        {
+            std::cout << "Mismatch! " << numMismatches << " reset entities differ from their freshly spawned counterparts" << std::endl;
+            return 1;
+        }
+
+        return 0;
+    }
+
+    //-------------------------------------------------------------------------
+    // Map Spawning
+    //-------------------------------------------------------------------------
+    // Spawns and destroys collections through an entity map every frame, with and without pooling, and reports the per-frame cost
+    // Only the map's loading/activation cost is measured, the world has no world systems registered
+
+    constexpr static int32_t const g_numCollectionEntities = 16;
+    constexpr static int32_t const g_numFrames = 300;
+    constexpr static int32_t const g_numSpawnsPerFrame = 4;
+    constexpr static int32_t const g_collectionLifetime = 30;   // In frames
+    constexpr static int32_t const g_maxLoadingFrames = 100;
+
+    struct FrameResults
+    {
+        Milliseconds                    m_averageFrameTime = 0.0f;
+        Milliseconds                    m_p99FrameTime = 0.0f;
+        Milliseconds                    m_maxFrameTime = 0.0f;
+        int32_t                         m_numSpikes = 0;            // Frames that took more than twice the median frame time
+    };
+
+    // A compiled collection, the source hash is what identifies the version of the collection for hot-reloading
+    static bool WriteCompiledCollection( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, uint64_t sourceHash )
+    {
+        TVector<EntityModel::SerializedEntityDescriptor> entityDescs;
+        entityDescs.resize( g_numCollectionEntities );
+
+        InlineString name;
+        for ( int32_t i = 0; i < g_numCollectionEntities; i++ )
+        {
+            Render::PointLightComponent component;
+            component.SetLocalTransform( Transform( Quaternion::Identity, Vector( (float) i, 0.0f, 0.0f ) ) );
+
+            name.sprintf( "Light_%d", i );
+            entityDescs[i].m_name = StringID( name.c_str() );
+            entityDescs[i].m_numSpatialComponents = 1;
+
+            EntityModel::SerializedComponentDescriptor& componentDesc = entityDescs[i].m_components.emplace_back();
+            componentDesc.DescribeTypeInstance( typeRegistry, &component, false );
+            componentDesc.m_name = StringID( "Light" );
+            componentDesc.m_isSpatialComponent = true;
+        }
+
+        EntityModel::SerializedEntityCollection collection;
+        collection.SetCollectionData( eastl::move( entityDescs ) );
+
+        Serialization::BinaryOutputArchive archive;
+        archive << Resource::ResourceHeader( 0, EntityModel::SerializedEntityCollection::GetStaticResourceTypeID(), sourceHash ) << collection;
+        return filePath.EnsureDirectoryExists() && archive.WriteToFile( filePath );
+    }
+
+    static bool UpdateLoadingUntilComplete( EntityWorld& world, EntityModel::EntityMap* pMap )
+    {
+        for ( int32_t i = 0; i < g_maxLoadingFrames; i++ )
+        {
+            world.UpdateLoading();
+            if ( !world.IsBusyLoading() && !pMap->HasPendingAddOrRemoveRequests() )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    static FrameResults CalculateFrameResults( TVector<Milliseconds>& frameTimes )
+    {
+        FrameResults results;
+
+        eastl::sort( frameTimes.begin(), frameTimes.end(), [] ( Milliseconds const& a, Milliseconds const& b ) { return a.ToFloat() < b.ToFloat(); } );
+        float const medianFrameTime = frameTimes[frameTimes.size() / 2].ToFloat();
+
+        float totalFrameTime = 0.0f;
+        for ( auto const& frameTime : frameTimes )
+        {
+            totalFrameTime += frameTime.ToFloat();
+            results.m_numSpikes += ( frameTime.ToFloat() > medianFrameTime * 2 ) ? 1 : 0;
+        }
+
+        results.m_averageFrameTime = totalFrameTime / frameTimes.size();
+        results.m_p99FrameTime = frameTimes[( frameTimes.size() * 99 ) / 100];
+        results.m_maxFrameTime = frameTimes.back();
+        return results;
+    }
+
+    // Each collection is spawned at a different offset and destroyed (or released) once it has lived for the collection lifetime
+    static FrameResults RunSpawnFrames( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, EntityWorld& world, EntityModel::EntityMap* pMap, EntityModel::SerializedEntityCollection const& collection, bool usePooling )
+    {
+        TVector<TVector<EntityID>> liveCollections;
+        TVector<Milliseconds> frameTimes;
+        frameTimes.reserve( g_numFrames );
+
+        TVector<Entity*> spawnedEntities;
+        for ( int32_t frameIdx = 0; frameIdx < g_numFrames; frameIdx++ )
+        {
+            Milliseconds elapsedTime = 0.0f;
+            {
+                ScopedTimer<PlatformClock> timer( elapsedTime );
+
+                // Destroy the oldest collections
+                if ( frameIdx >= g_collectionLifetime )
+                {
+                    for ( int32_t i = 0; i < g_numSpawnsPerFrame; i++ )
+                    {
+                        TVector<EntityID> const& entityIDs = liveCollections[i];
+                        if ( usePooling )
+                        {
+                            pMap->ReleasePooledEntityCollection( entityIDs[0] );
+                        }
+                        else
+                        {
+                            for ( auto const& entityID : entityIDs )
+                            {
+                                pMap->DestroyEntity( entityID );
+                            }
+                        }
+                    }
+
+                    liveCollections.erase( liveCollections.begin(), liveCollections.begin() + g_numSpawnsPerFrame );
+                }
+
+                // Spawn the new ones
+                for ( int32_t i = 0; i < g_numSpawnsPerFrame; i++ )
+                {
+                    Transform const offset( Quaternion::Identity, Vector( 0.0f, (float) i, (float) frameIdx ) );
+                    if ( usePooling )
+                    {
+                        pMap->SpawnPooledEntityCollection( pTaskSystem, typeRegistry, collection, offset, &spawnedEntities );
+                    }
+                    else
+                    {
+                        pMap->AddEntityCollection( pTaskSystem, typeRegistry, collection, offset, &spawnedEntities );
+                    }
+
+                    TVector<EntityID>& entityIDs = liveCollections.emplace_back();
+                    for ( auto pEntity : spawnedEntities )
+                    {
+                        entityIDs.emplace_back( pEntity->GetID() );
+                    }
+                }
+
+                world.UpdateLoading();
+            }
+            frameTimes.emplace_back( elapsedTime );
+        }
+
+        // Destroy all remaining collections
+        for ( auto const& entityIDs : liveCollections )
+        {
+            for ( auto const& entityID : entityIDs )
+            {
+                pMap->DestroyEntity( entityID );
+            }
+        }
+
+        UpdateLoadingUntilComplete( world, pMap );
+        return CalculateFrameResults( frameTimes );
+    }
+
+    static void PrintFrameResults( char const* pLabel, FrameResults const& results )
+    {
+        std::cout << pLabel << " - Avg: " << results.m_averageFrameTime.ToFloat() << "ms, P99: " << results.m_p99FrameTime.ToFloat() << "ms, Max: " << results.m_maxFrameTime.ToFloat() << "ms, Spikes (>2x median): " << results.m_numSpikes << std::endl;
+    }
+
+    static int RunMapTest( TypeSystem::TypeRegistry const& typeRegistry )
+    {
+        FileSystem::Path const compiledResourceDirPath = FileSystem::GetCurrentProcessPath().Append( "EntitySpawnBenchmark", true );
+        ResourceID const collectionID( "data://EntitySpawnBenchmark/Collection.ec" );
+        FileSystem::Path const collectionFilePath = collectionID.GetResourcePath().ToFileSystemPath( compiledResourceDirPath );
+
+        FileSystem::EraseDir( compiledResourceDirPath.c_str() );
+        if ( !WriteCompiledCollection( typeRegistry, collectionFilePath, 1 ) )
+        {
+            std::cout << "Failed to write benchmark collection: " << collectionFilePath.c_str() << std::endl;
+            return 1;
+        }
+
+        // Create a headless world
+        //-------------------------------------------------------------------------
+
+        TaskSystem taskSystem( Threading::GetProcessorInfo().m_numPhysicalCores - 1 );
+        taskSystem.Initialize();
+
+        Resource::ResourceSettings settings;
+        settings.m_compiledResourcePath = compiledResourceDirPath;
+
+        Resource::ResourceProvider* pResourceProvider = EE::New<Resource::PackagedResourceProvider>( settings );
+        pResourceProvider->Initialize();
+
+        Resource::ResourceSystem resourceSystem( taskSystem );
+        resourceSystem.Initialize( pResourceProvider );
+
+        EntityModel::EntityCollectionLoader collectionLoader;
+        collectionLoader.SetTypeRegistryPtr( &typeRegistry );
+        resourceSystem.RegisterResourceLoader( &collectionLoader );
+
+        SystemRegistry systemRegistry;
+        systemRegistry.RegisterSystem( const_cast<TypeSystem::TypeRegistry*>( &typeRegistry ) );
+        systemRegistry.RegisterSystem( &taskSystem );
+        systemRegistry.RegisterSystem( &resourceSystem );
+
+        EntityWorld world;
+        world.Initialize( systemRegistry, {} );
+        EntityModel::EntityMap* pMap = world.GetPersistentMap();
+
+        TResourcePtr<EntityModel::SerializedEntityCollection> collection( collectionID );
+        resourceSystem.LoadResource( collection );
+        resourceSystem.WaitForAllRequestsToComplete();
+
+        // Run the spawn frames
+        //-------------------------------------------------------------------------
+
+        bool isValid = collection.IsLoaded() && UpdateLoadingUntilComplete( world, pMap );
+        FrameResults unpooledResults, pooledResults;
+        EntityModel::EntityMap::PoolStats poolStats;
+
+        if ( isValid )
+        {
+            unpooledResults = RunSpawnFrames( &taskSystem, typeRegistry, world, pMap, *collection.GetPtr(), false );
+
+            // Prewarm enough instances to cover every live collection, so no spawn should need a new instantiation
+            int32_t const numRequiredInstances = g_numSpawnsPerFrame * ( g_collectionLifetime + 1 );
+            pMap->PrewarmEntityCollection( &taskSystem, typeRegistry, *collection.GetPtr(), numRequiredInstances );
+            isValid &= UpdateLoadingUntilComplete( world, pMap );
+
+            pooledResults = RunSpawnFrames( &taskSystem, typeRegistry, world, pMap, *collection.GetPtr(), true );
+            poolStats = pMap->GetPoolStats();
+
+            if ( poolStats.m_numUnpooledSpawns != 0 )
+            {
+                std::cout << "Pooled spawns required " << poolStats.m_numUnpooledSpawns << " new instantiations!" << std::endl;
+                isValid = false;
+            }
+
+            // The pooled run ends by destroying every live collection, which must remove their instances rather than return them to the pool
+            int32_t const expectedNumFreeInstances = numRequiredInstances - ( g_collectionLifetime * g_numSpawnsPerFrame );
+            if ( poolStats.m_numActiveInstances != 0 || pMap->GetNumFreePooledInstances( collectionID ) != expectedNumFreeInstances )
+            {
+                std::cout << "Destroyed pooled entities were returned to the pool! Free: " << pMap->GetNumFreePooledInstances( collectionID ) << ", Expected: " << expectedNumFreeInstances << std::endl;
+                isValid = false;
+            }
+        }
+
+        // Hot-reload the collection with the same layout but a different source hash, none of the existing instances can be reused
+        //-------------------------------------------------------------------------
+
+        if ( isValid )
+        {
+            resourceSystem.UnloadResource( collection );
+            resourceSystem.WaitForAllRequestsToComplete();
+
+            WriteCompiledCollection( typeRegistry, collectionFilePath, 2 );
+            resourceSystem.LoadResource( collection );
+            resourceSystem.WaitForAllRequestsToComplete();
+
+            int32_t const numUnpooledSpawns = pMap->GetPoolStats().m_numUnpooledSpawns;
+            TVector<Entity*> spawnedEntities;
+            pMap->SpawnPooledEntityCollection( &taskSystem, typeRegistry, *collection.GetPtr(), Transform::Identity, &spawnedEntities );
+            UpdateLoadingUntilComplete( world, pMap );
+
+            if ( pMap->GetPoolStats().m_numUnpooledSpawns != numUnpooledSpawns + 1 || pMap->GetNumFreePooledInstances( collectionID ) != 0 )
+            {
+                std::cout << "Pooled instances of a hot-reloaded collection were reused!" << std::endl;
+                isValid = false;
+            }
+        }
+
+        // Shutdown
+        //-------------------------------------------------------------------------
+
+        world.Shutdown();
+        systemRegistry.UnregisterSystem( &resourceSystem );
+        systemRegistry.UnregisterSystem( &taskSystem );
+        systemRegistry.UnregisterSystem( const_cast<TypeSystem::TypeRegistry*>( &typeRegistry ) );
+
+        resourceSystem.UnloadResource( collection );
+        resourceSystem.WaitForAllRequestsToComplete();
+        resourceSystem.UnregisterResourceLoader( &collectionLoader );
+        collectionLoader.ClearTypeRegistryPtr();
+        resourceSystem.Shutdown();
+        pResourceProvider->Shutdown();
+        EE::Delete( pResourceProvider );
+        taskSystem.Shutdown();
+
+        FileSystem::EraseDir( compiledResourceDirPath.c_str() );
+
+        //-------------------------------------------------------------------------
+
+        std::cout << "Entity Map Spawn (" << g_numSpawnsPerFrame << " collections of " << g_numCollectionEntities << " entities spawned and destroyed per frame, " << g_numFrames << " frames)" << std::endl;
+        PrintFrameResults( "Unpooled", unpooledResults );
+        PrintFrameResults( "Pooled", pooledResults );
+        std::cout << "Pooled Spawns: " << poolStats.m_numPooledSpawns << ", Unpooled Spawns: " << poolStats.m_numUnpooledSpawns << std::endl;
+
+        if ( !isValid )
+        {
+            std::cout << "Entity map spawn test failed!" << std::endl;
+            return 1;
+        }
+
+        return 0;
+    }
+
+    //-------------------------------------------------------------------------
+
+    static int Run( TypeSystem::TypeRegistry const& typeRegistry )
+    {
+        int const resetResult = RunResetTest( typeRegistry );
+        int const mapResult = RunMapTest( typeRegistry );
+        return ( resetResult != 0 || mapResult != 0 ) ? 1 : 0;
+    }
+}
+#endif
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+// Activates and deactivates a large collection of lights in a headless world, with every component handed to every world system versus only routed to the interested systems
+// Only the world systems that dont rely on any other engine systems are created, the renderer is the only one interested in the lights
+namespace ComponentActivationBenchmark
+{
+    constexpr static int32_t const g_numEntities = 10000;
+    constexpr static int32_t const g_numIterations = 10;
+
+    struct ActivationResults
+    {
+        Milliseconds                    m_activationTime = 0.0f;
+        Milliseconds                    m_deactivationTime = 0.0f;
+        uint64_t                        m_numDispatchedComponents = 0;
+        bool                            m_isValid = true;
+    };
+
+    static void CreateCollection( TypeSystem::TypeRegistry const& typeRegistry, EntityModel::SerializedEntityCollection& outCollection )
+    {
+        TVector<EntityModel::SerializedEntityDescriptor> entityDescs;
+        entityDescs.resize( g_numEntities );
+
+        Render::PointLightComponent pointLightComponent;
+        Render::SpotLightComponent spotLightComponent;
+
+        InlineString name;
+        for ( int32_t i = 0; i < g_numEntities; i++ )
+        {
+            Render::LightComponent* pComponent = ( i % 2 == 0 ) ? static_cast<Render::LightComponent*>( &pointLightComponent ) : static_cast<Render::LightComponent*>( &spotLightComponent );
+            pComponent->SetLocalTransform( Transform( Quaternion::Identity, Vector( (float) i, 0.0f, 0.0f ) ) );
+
+            name.sprintf( "Light_%d", i );
+            entityDescs[i].m_name = StringID( name.c_str() );
+            entityDescs[i].m_numSpatialComponents = 1;
+
+            EntityModel::SerializedComponentDescriptor& componentDesc = entityDescs[i].m_components.emplace_back();
+            componentDesc.DescribeTypeInstance( typeRegistry, pComponent, false );
+            componentDesc.m_name = StringID( "Light" );
+            componentDesc.m_isSpatialComponent = true;
+        }
+
+        outCollection.SetCollectionData( eastl::move( entityDescs ) );
+    }
+
+    static ActivationResults RunActivation( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, EntityWorld& world, EntityModel::SerializedEntityCollection const& collection, bool isRoutingEnabled )
+    {
+        EntityModel::EntityMap* pMap = world.GetPersistentMap();
+        EntityModel::ComponentRoutingTable& routingTable = world.GetComponentRoutingTable();
+        routingTable.SetRoutingEnabled( isRoutingEnabled );
+        uint64_t const initialNumDispatchedComponents = routingTable.GetNumDispatchedComponents();
+
+        ActivationResults results;
+        TVector<Entity*> spawnedEntities;
+        TVector<EntityID> entityIDs;
+
+        for ( int32_t j = 0; j < g_numIterations; j++ )
+        {
+            pMap->AddEntityCollection( pTaskSystem, typeRegistry, collection, Transform::Identity, &spawnedEntities );
+
+            entityIDs.clear();
+            for ( auto pEntity : spawnedEntities )
+            {
+                entityIDs.emplace_back( pEntity->GetID() );
+            }
+
+            {
+                Milliseconds elapsedTime = 0.0f;
+                {
+                    ScopedTimer<PlatformClock> timer( elapsedTime );
+                    results.m_isValid &= EntitySpawnBenchmark::UpdateLoadingUntilComplete( world, pMap );
+                }
+                results.m_activationTime += elapsedTime;
+            }
+
+            // Every light needs to have been registered, regardless of how it was dispatched
+            results.m_isValid &= (int32_t) world.GetAllRegisteredComponentsOfType( Render::LightComponent::GetStaticTypeID() ).size() == g_numEntities;
+
+            //-------------------------------------------------------------------------
+
+            for ( auto const& entityID : entityIDs )
+            {
+                pMap->DestroyEntity( entityID );
+            }
+
+            {
+                Milliseconds elapsedTime = 0.0f;
+                {
+                    ScopedTimer<PlatformClock> timer( elapsedTime );
+                    results.m_isValid &= EntitySpawnBenchmark::UpdateLoadingUntilComplete( world, pMap );
+                }
+                results.m_deactivationTime += elapsedTime;
+            }
+
+            results.m_isValid &= world.GetAllRegisteredComponentsOfType( Render::LightComponent::GetStaticTypeID() ).empty();
+        }
+
+        results.m_numDispatchedComponents = routingTable.GetNumDispatchedComponents() - initialNumDispatchedComponents;
+        routingTable.SetRoutingEnabled( true );
+        return results;
+    }
+
+    static void PrintActivationResults( char const* pLabel, ActivationResults const& results )
+    {
+        std::cout << pLabel << " - Activation: " << results.m_activationTime.ToFloat() << "ms, Deactivation: " << results.m_deactivationTime.ToFloat() << "ms, Dispatched Components: " << results.m_numDispatchedComponents << std::endl;
+    }
+
+    static int Run( TypeSystem::TypeRegistry const& typeRegistry )
+    {
+        EntityModel::SerializedEntityCollection collection;
+        CreateCollection( typeRegistry, collection );
+
+        // Create a headless world
+        //-------------------------------------------------------------------------
+
+        TaskSystem taskSystem( Threading::GetProcessorInfo().m_numPhysicalCores - 1 );
+        taskSystem.Initialize();
+
+        // Nothing is loaded from disk, the components in the collection have no resource dependencies
+        Resource::ResourceSettings settings;
+        settings.m_compiledResourcePath = FileSystem::GetCurrentProcessPath().Append( "ComponentActivationBenchmark", true );
+
+        Resource::ResourceProvider* pResourceProvider = EE::New<Resource::PackagedResourceProvider>( settings );
+        pResourceProvider->Initialize();
+
+        Resource::ResourceSystem resourceSystem( taskSystem );
+        resourceSystem.Initialize( pResourceProvider );
+
+        SystemRegistry systemRegistry;
+        systemRegistry.RegisterSystem( const_cast<TypeSystem::TypeRegistry*>( &typeRegistry ) );
+        systemRegistry.RegisterSystem( &taskSystem );
+        systemRegistry.RegisterSystem( &resourceSystem );
+
+        TVector<TypeSystem::TypeInfo const*> const worldSystemTypeInfos =
+        {
+            Render::RendererWorldSystem::s_pTypeInfo,
+            Animation::AnimationWorldSystem::s_pTypeInfo,
+            CameraManager::s_pTypeInfo,
+            PlayerManager::s_pTypeInfo,
+            AI::AIManager::s_pTypeInfo,
+            EntityModel::EntityCollectionSpawner::s_pTypeInfo,
+        };
+
+        EntityWorld world;
+        world.Initialize( systemRegistry, worldSystemTypeInfos );
+
+        // Each activation registers and each deactivation unregisters every light, routed lights should only reach the systems that declared an interest in them
+        // The expected routes are derived with the parent ID walk rather than the hierarchy intervals the routing table uses
+        EntityModel::ComponentRoutingTable& routingTable = world.GetComponentRoutingTable();
+        auto GetNumInterestedSystems = [&] ( TypeSystem::TypeInfo const* pComponentTypeInfo )
+        {
+            uint64_t numInterestedSystems = 0;
+            for ( int32_t s = 0; s < (int32_t) worldSystemTypeInfos.size(); s++ )
+            {
+                bool isInterested = routingTable.IsSystemInterestedInAllComponents( s );
+                for ( auto pInterestTypeInfo : routingTable.GetSystemInterests( s ) )
+                {
+                    isInterested |= pComponentTypeInfo->IsDerivedFrom( pInterestTypeInfo->m_ID );
+                }
+                numInterestedSystems += isInterested ? 1 : 0;
+            }
+            return numInterestedSystems;
+        };
+
+        // Half of the entities are point lights and the other half spot lights
+        uint64_t const numRegistrationsPerType = (uint64_t) g_numEntities * g_numIterations;
+        uint64_t const expectedBroadcastDispatches = 2 * numRegistrationsPerType * worldSystemTypeInfos.size();
+        uint64_t const expectedRoutedDispatches = numRegistrationsPerType * ( GetNumInterestedSystems( Render::PointLightComponent::s_pTypeInfo ) + GetNumInterestedSystems( Render::SpotLightComponent::s_pTypeInfo ) );
+
+        // Run the activations
+        //-------------------------------------------------------------------------
+
+        bool isValid = EntitySpawnBenchmark::UpdateLoadingUntilComplete( world, world.GetPersistentMap() );
+        ActivationResults broadcastResults, routedResults;
+
+        if ( isValid )
+        {
+            broadcastResults = RunActivation( &taskSystem, typeRegistry, world, collection, false );
+            routedResults = RunActivation( &taskSystem, typeRegistry, world, collection, true );
+            isValid = broadcastResults.m_isValid && routedResults.m_isValid;
+        }
+
+        // Shutdown
+        //-------------------------------------------------------------------------
+
+        world.Shutdown();
+        systemRegistry.UnregisterSystem( &resourceSystem );
+        systemRegistry.UnregisterSystem( &taskSystem );
+        systemRegistry.UnregisterSystem( const_cast<TypeSystem::TypeRegistry*>( &typeRegistry ) );
+
+        resourceSystem.Shutdown();
+        pResourceProvider->Shutdown();
+        EE::Delete( pResourceProvider );
+        taskSystem.Shutdown();
+
+        //-------------------------------------------------------------------------
+
+        std::cout << "Component Activation (" << g_numEntities << " lights activated and deactivated x " << g_numIterations << " iterations, " << worldSystemTypeInfos.size() << " world systems)" << std::endl;
+        PrintActivationResults( "Broadcast", broadcastResults );
+        PrintActivationResults( "Routed", routedResults );
+        std::cout << "Activation Speedup: " << ( broadcastResults.m_activationTime.ToFloat() / Math::Max( routedResults.m_activationTime.ToFloat(), 0.001f ) ) << "x" << std::endl;
+
+        if ( !isValid )
+        {
+            std::cout << "Component activation failed! Not every light was registered and unregistered" << std::endl;
+            return 1;
+        }
+
+        if ( broadcastResults.m_numDispatchedComponents != expectedBroadcastDispatches || routedResults.m_numDispatchedComponents != expectedRoutedDispatches )
+        {
+            std::cout << "Mismatch! Expected " << expectedBroadcastDispatches << " broadcast and " << expectedRoutedDispatches << " routed dispatches" << std::endl;
+            return 1;
+        }
+
+        return 0;
+    }
+}
+#endif
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+// Compares the two entity editor undo schemes for a series of component property edits
+// Snapshot undo stores the full serialized entity before and after each edit and recreates the entity to undo/redo
+// Delta undo only stores the changed property values and resets the edited component in place
+// Only the undo data and the entity/component changes are measured, the editor's map unload/reload around each undo is the same for both and not included
+namespace EntityUndoBenchmark
+{
+    constexpr static int32_t const g_numLightComponents = 7;
+    constexpr static int32_t const g_numEdits = 1000;
+
+    struct SnapshotAction
+    {
+        EntityModel::SerializedEntityDescriptor     m_entityDescBefore;
+        EntityModel::SerializedEntityDescriptor     m_entityDescAfter;
+    };
+
+    struct DeltaAction
+    {
+        StringID                                    m_componentName;
+        TypeSystem::TypeDescriptorDelta             m_delta;
+    };
+
+    struct Results
+    {
+        Milliseconds                                m_recordTime = 0.0f;
+        Milliseconds                                m_undoTime = 0.0f;
+        Milliseconds                                m_redoTime = 0.0f;
+        size_t                                      m_bytesRetained = 0;
+    };
+
+    // A navmesh root component (lots of nested properties) with a set of attached lights
+    static EntityModel::SerializedEntityDescriptor CreateEntityDescriptor( TypeSystem::TypeRegistry const& typeRegistry )
+    {
+        EntityModel::SerializedEntityDescriptor entityDesc;
+        entityDesc.m_name = StringID( "Entity" );
+        entityDesc.m_components.emplace_back( EntitySpawnBenchmark::CreateComponentDescriptor( typeRegistry, 0, false ) );
+
+        InlineString name;
+        for ( int32_t i = 0; i < g_numLightComponents; i++ )
+        {
+            Render::PointLightComponent component;
+            component.SetLocalTransform( Transform( Quaternion::Identity, Vector( (float) i, 0.0f, 0.0f ) ) );
+
+            name.sprintf( "Light_%d", i );
+            EntityModel::SerializedComponentDescriptor& componentDesc = entityDesc.m_components.emplace_back();
+            componentDesc.DescribeTypeInstance( typeRegistry, &component, false );
+            componentDesc.m_name = StringID( name.c_str() );
+            componentDesc.m_spatialParentName = entityDesc.m_components[0].m_name;
+            componentDesc.m_isSpatialComponent = true;
+        }
+
+        entityDesc.m_numSpatialComponents = (int32_t) entityDesc.m_components.size();
+        return entityDesc;
+    }
+
+    static EntityComponent* FindComponent( Entity* pEntity, StringID componentName )
+    {
+        for ( auto pComponent : pEntity->GetComponents() )
+        {
+            if ( pComponent->GetNameID() == componentName )
+            {
+                return pComponent;
+            }
+        }
+
+        EE_UNREACHABLE_CODE();
+        return nullptr;
+    }
+
+    static StringID GetEditedComponentName( int32_t editIdx )
+    {
+        InlineString name;
+        name.sprintf( "Light_%d", editIdx % g_numLightComponents );
+        return StringID( name.c_str() );
+    }
+
+    // The same edit the property grid would do when moving a light
+    static void ApplyEdit( Entity* pEntity, int32_t editIdx )
+    {
+        auto pComponent = Cast<SpatialEntityComponent>( FindComponent( pEntity, GetEditedComponentName( editIdx ) ) );
+        pComponent->SetLocalTransform( Transform( Quaternion::Identity, Vector( (float) editIdx, 1.0f, 2.0f ) ) );
+    }
+
+    // Approximate memory retained by a serialized entity, the same way as TypeDescriptorDelta::GetMemoryUsage
+    static size_t GetMemoryUsage( EntityModel::SerializedEntityDescriptor const& entityDesc )
+    {
+        size_t memoryUsage = sizeof( EntityModel::SerializedEntityDescriptor ) + entityDesc.m_components.capacity() * sizeof( EntityModel::SerializedComponentDescriptor );
+        for ( auto const& componentDesc : entityDesc.m_components )
+        {
+            for ( auto const& propertyDesc : componentDesc.m_properties )
+            {
+                memoryUsage += sizeof( TypeSystem::PropertyDescriptor ) + propertyDesc.m_byteValue.capacity() + propertyDesc.m_stringValue.capacity();
+            }
+        }
+
+        return memoryUsage;
+    }
+
+    static bool AreEntitiesEqual( TypeSystem::TypeRegistry const& typeRegistry, Entity* pEntityA, Entity* pEntityB )
+    {
+        if ( pEntityA->GetComponents().size() != pEntityB->GetComponents().size() )
+        {
+            return false;
+        }
+
+        for ( auto pComponentA : pEntityA->GetComponents() )
+        {
+            if ( !EntitySpawnBenchmark::AreComponentsEqual( typeRegistry, pComponentA, FindComponent( pEntityB, pComponentA->GetNameID() ) ) )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    static void RestoreSnapshot( TypeSystem::TypeRegistry const& typeRegistry, Entity*& pEntity, EntityModel::SerializedEntityDescriptor const& entityDesc )
+    {
+        EE::Delete( pEntity );
+        pEntity = EntityModel::Serializer::CreateEntity( typeRegistry, entityDesc );
+    }
+
+    static void ApplyDelta( TypeSystem::TypeRegistry const& typeRegistry, Entity* pEntity, DeltaAction const& action, bool applyValuesBefore )
+    {
+        EntityComponent* pComponent = FindComponent( pEntity, action.m_componentName );
+
+        TypeSystem::TypeDescriptor componentDesc( typeRegistry, pComponent, false );
+        action.m_delta.Apply( componentDesc, applyValuesBefore );
+        componentDesc.ResetTypeInstance( typeRegistry, pComponent->GetTypeInfo(), pComponent, true );
+
+        // Reset the local transform to ensure that the world transform is recalculated
+        if ( auto pSpatialComponent = TryCast<SpatialEntityComponent>( pComponent ) )
+        {
+            pSpatialComponent->SetLocalTransform( pSpatialComponent->GetLocalTransform() );
+        }
+    }
+
+    static void PrintResults( char const* pLabel, Results const& results )
+    {
+        std::cout << pLabel << ": retained " << results.m_bytesRetained / 1024 << "KB ("
+            << results.m_bytesRetained / g_numEdits << " bytes/edit), record " << results.m_recordTime.ToFloat()
+            << "ms, undo " << results.m_undoTime.ToFloat() / g_numEdits << "ms/edit, redo "
+            << results.m_redoTime.ToFloat() / g_numEdits << "ms/edit" << std::endl;
+    }
+
+    static int Run( TypeSystem::TypeRegistry const& typeRegistry )
+    {
+        EntityModel::SerializedEntityDescriptor const entityDesc = CreateEntityDescriptor( typeRegistry );
+        Entity* pOriginalEntity = EntityModel::Serializer::CreateEntity( typeRegistry, entityDesc );
+        Entity* pSnapshotEntity = EntityModel::Serializer::CreateEntity( typeRegistry, entityDesc );
+        Entity* pDeltaEntity = EntityModel::Serializer::CreateEntity( typeRegistry, entityDesc );
+
+        Results snapshotResults;
+        Results deltaResults;
+
+        // Record edits
+        //-------------------------------------------------------------------------
+
+        TVector<SnapshotAction> snapshotActions;
+        snapshotActions.resize( g_numEdits );
+
+        {
+            ScopedTimer<PlatformClock> timer( snapshotResults.m_recordTime );
+            for ( int32_t i = 0; i < g_numEdits; i++ )
+            {
+                EntityModel::Serializer::SerializeEntity( typeRegistry, pSnapshotEntity, snapshotActions[i].m_entityDescBefore );
+                ApplyEdit( pSnapshotEntity, i );
+                EntityModel::Serializer::SerializeEntity( typeRegistry, pSnapshotEntity, snapshotActions[i].m_entityDescAfter );
+            }
+        }
+
+        TVector<DeltaAction> deltaActions;
+        deltaActions.resize( g_numEdits );
+
+        {
+            ScopedTimer<PlatformClock> timer( deltaResults.m_recordTime );
+            for ( int32_t i = 0; i < g_numEdits; i++ )
+            {
+                deltaActions[i].m_componentName = GetEditedComponentName( i );
+                EntityComponent* pComponent = FindComponent( pDeltaEntity, deltaActions[i].m_componentName );
+
+                TypeSystem::TypeDescriptor const componentDescBefore( typeRegistry, pComponent, false );
+                ApplyEdit( pDeltaEntity, i );
+                TypeSystem::TypeDescriptor const componentDescAfter( typeRegistry, pComponent, false );
+                deltaActions[i].m_delta = TypeSystem::TypeDescriptorDelta( componentDescBefore, componentDescAfter );
+            }
+        }
+
+        for ( auto const& action : snapshotActions )
+        {
+            snapshotResults.m_bytesRetained += GetMemoryUsage( action.m_entityDescBefore ) + GetMemoryUsage( action.m_entityDescAfter );
+        }
+
+        for ( auto const& action : deltaActions )
+        {
+            deltaResults.m_bytesRetained += sizeof( StringID ) + action.m_delta.GetMemoryUsage();
+        }
+
+        // Undo all edits, both schemes need to restore the original entity
+        //-------------------------------------------------------------------------
+
+        bool isValid = true;
+
+        {
+            ScopedTimer<PlatformClock> timer( snapshotResults.m_undoTime );
+            for ( int32_t i = g_numEdits - 1; i >= 0; i-- )
+            {
+                RestoreSnapshot( typeRegistry, pSnapshotEntity, snapshotActions[i].m_entityDescBefore );
+            }
+        }
+
+        {
+            ScopedTimer<PlatformClock> timer( deltaResults.m_undoTime );
+            for ( int32_t i = g_numEdits - 1; i >= 0; i-- )
+            {
+                ApplyDelta( typeRegistry, pDeltaEntity, deltaActions[i], true );
+            }
+        }
+
+        if ( !AreEntitiesEqual( typeRegistry, pOriginalEntity, pSnapshotEntity ) || !AreEntitiesEqual( typeRegistry, pOriginalEntity, pDeltaEntity ) )
+        {
+            std::cout << "Undo mismatch! The undone entity differs from the original" << std::endl;
+            isValid = false;
+        }
+
+        // Redo all edits, both schemes need to end up with the same entity
+        //-------------------------------------------------------------------------
+
+        {
+            ScopedTimer<PlatformClock> timer( snapshotResults.m_redoTime );
+            for ( auto const& action : snapshotActions )
+            {
+                RestoreSnapshot( typeRegistry, pSnapshotEntity, action.m_entityDescAfter );
+            }
+        }
+
+        {
+            ScopedTimer<PlatformClock> timer( deltaResults.m_redoTime );
+            for ( auto const& action : deltaActions )
+            {
+                ApplyDelta( typeRegistry, pDeltaEntity, action, false );
+            }
+        }
+
+        if ( !AreEntitiesEqual( typeRegistry, pSnapshotEntity, pDeltaEntity ) || AreEntitiesEqual( typeRegistry, pOriginalEntity, pDeltaEntity ) )
+        {
+            std::cout << "Redo mismatch! The redone entities differ" << std::endl;
+            isValid = false;
+        }
+
+        EE::Delete( pOriginalEntity );
+        EE::Delete( pSnapshotEntity );
+        EE::Delete( pDeltaEntity );
+
+        //-------------------------------------------------------------------------
+
+        std::cout << g_numEdits << " property edits on an entity with " << entityDesc.m_components.size() << " components" << std::endl;
+        PrintResults( "Snapshot undo", snapshotResults );
+        PrintResults( "Delta undo", deltaResults );
+
+        if ( !isValid )
+        {
+            return 1;
+        }
+
+        return 0;
+    }
+}
+#endif
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+// Measures the resource database startup time for a large synthetic project
+// Runs a cold build (no snapshot), a warm build (unchanged snapshot) and an incremental build (a few files changed since the snapshot was saved)
+// The warm build also measures path searches and referencer queries
+namespace ResourceDatabaseBenchmark
+{
+    constexpr static int32_t const g_numQueries = 1000;
+    constexpr static int32_t const g_numDirectories = 1000;
+    constexpr static int32_t const g_numFilesPerDirectory = 100;
+    constexpr static int32_t const g_descriptorFrequency = 4;       // Every Nth file is a resource descriptor
+    constexpr static int32_t const g_numModifiedDirectories = 10;   // For the incremental build, a file in each of these directories is modified and a new one is added
+
+    static bool WriteDescriptor( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, int32_t idx )
+    {
+        InlineString meshPath;
+        meshPath.sprintf( "data://Meshes/Mesh_%d.fbx", idx );
+
+        Render::StaticMeshResourceDescriptor descriptor;
+        descriptor.m_meshPath = ResourcePath( meshPath.c_str() );
+        return Resource::ResourceDescriptor::TryWriteToFile( typeRegistry, filePath, &descriptor );
+    }
+
+    static bool WriteRawFile( FileSystem::Path const& filePath, int32_t idx )
+    {
+        InlineString contents;
+        contents.sprintf( "Raw file %d", idx );
+
+        Blob fileData;
+        fileData.resize( contents.length() );
+        memcpy( fileData.data(), contents.c_str(), contents.length() );
+        return FileSystem::SaveFile( filePath.c_str(), fileData );
+    }
+
+    static FileSystem::Path GetFilePath( FileSystem::Path const& rawResourceDirPath, int32_t directoryIdx, int32_t fileIdx )
+    {
+        InlineString fileName;
+        fileName.sprintf( "Dir_%d/File_%d.%s", directoryIdx, fileIdx, ( fileIdx % g_descriptorFrequency ) == 0 ? "msh" : "txt" );
+        return rawResourceDirPath + fileName.c_str();
+    }
+
+    static bool WriteFile( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& filePath, int32_t fileIdx )
+    {
+        filePath.EnsureDirectoryExists();
+        return ( fileIdx % g_descriptorFrequency ) == 0 ? WriteDescriptor( typeRegistry, filePath, fileIdx ) : WriteRawFile( filePath, fileIdx );
+    }
+
+    struct QueryResults
+    {
+        Milliseconds                    m_searchTime = 0.0f;
+        Milliseconds                    m_referencersTime = 0.0f;
+        int32_t                         m_numSearchResults = 0;
+        int32_t                         m_numReferencers = 0;
+    };
+
+    static void RunQueries( Resource::ResourceDatabase const& database, QueryResults& results )
+    {
+        InlineString token;
+        TVector<String> searchTokens;
+        TVector<Resource::ResourceDatabase::FileEntry const*> searchResults;
+
+        {
+            ScopedTimer<PlatformClock> timer( results.m_searchTime );
+            for ( int32_t i = 0; i < g_numQueries; i++ )
+            {
+                searchTokens.clear();
+                token.sprintf( "dir_%d/", i % g_numDirectories );
+                searchTokens.emplace_back( token.c_str() );
+                searchTokens.emplace_back( "file_1" );
+
+                database.FindResources( searchTokens, searchResults );
+                results.m_numSearchResults += (int32_t) searchResults.size();
+            }
+        }
+
+        {
+            ScopedTimer<PlatformClock> timer( results.m_referencersTime );
+            for ( int32_t i = 0; i < g_numQueries; i++ )
+            {
+                token.sprintf( "data://Meshes/Mesh_%d.fbx", ( i % g_numFilesPerDirectory ) - ( i % g_descriptorFrequency ) );
+                results.m_numReferencers += (int32_t) database.GetReferencers( ResourcePath( token.c_str() ) ).size();
+            }
+        }
+    }
+
+    static Resource::ResourceDatabase::BuildStats RunBuild( TypeSystem::TypeRegistry const& typeRegistry, TaskSystem* pTaskSystem, FileSystem::Path const& rawResourceDirPath, FileSystem::Path const& compiledResourceDirPath, QueryResults* pQueryResults = nullptr )
+    {
+        Resource::ResourceDatabase database;
+        database.Initialize( &typeRegistry, pTaskSystem, rawResourceDirPath, compiledResourceDirPath );
+        while ( database.IsBuildingCaches() )
+        {
+            database.Update();
+            Threading::Sleep( Milliseconds( 1.0f ) );
+        }
+
+        if ( pQueryResults != nullptr )
+        {
+            RunQueries( database, *pQueryResults );
+        }
+
+        Resource::ResourceDatabase::BuildStats const stats = database.GetBuildStats();
+        database.Shutdown();
+        return stats;
+    }
+
+    static void PrintStats( char const* pLabel, Resource::ResourceDatabase::BuildStats const& stats )
+    {
+        std::cout << pLabel << " - File System Cache: " << stats.m_fileSystemCacheTime.ToFloat() << "ms, Total: " << stats.m_totalTime.ToFloat() << "ms, Files: " << stats.m_numFiles << ", Descriptors Read From Disk: " << stats.m_numDescriptorsReadFromDisk << ", Descriptors Read From Snapshot: " << stats.m_numDescriptorsReadFromSnapshot << std::endl;
+    }
+
+    static int Run( TypeSystem::TypeRegistry const& typeRegistry )
+    {
+        FileSystem::Path const benchmarkDirPath = FileSystem::GetCurrentProcessPath().Append( "ResourceDatabaseBenchmark", true );
+        FileSystem::Path const rawResourceDirPath = FileSystem::Path( benchmarkDirPath ).Append( "Data", true );
+        FileSystem::Path const compiledResourceDirPath = FileSystem::Path( benchmarkDirPath ).Append( "Compiled", true );
+
+        // Generate the project
+        //-------------------------------------------------------------------------
+
+        FileSystem::EraseDir( benchmarkDirPath.c_str() );
+        compiledResourceDirPath.EnsureDirectoryExists();
+
+        for ( int32_t i = 0; i < g_numDirectories; i++ )
+        {
+            for ( int32_t j = 0; j < g_numFilesPerDirectory; j++ )
+            {
+                if ( !WriteFile( typeRegistry, GetFilePath( rawResourceDirPath, i, j ), j ) )
+                {
+                    std::cout << "Failed to generate benchmark project in: " << benchmarkDirPath.c_str() << std::endl;
+                    return 1;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        TaskSystem taskSystem( Threading::GetProcessorInfo().m_numPhysicalCores - 1 );
+        taskSystem.Initialize();
+
+        Resource::ResourceDatabase::BuildStats const coldStats = RunBuild( typeRegistry, &taskSystem, rawResourceDirPath, compiledResourceDirPath );
+        QueryResults queryResults;
+        Resource::ResourceDatabase::BuildStats const warmStats = RunBuild( typeRegistry, &taskSystem, rawResourceDirPath, compiledResourceDirPath, &queryResults );
+
+        // Modify an existing descriptor and add a new one in a few directories
+        for ( int32_t i = 0; i < g_numModifiedDirectories; i++ )
+        {
+            int32_t const directoryIdx = i * ( g_numDirectories / g_numModifiedDirectories );
+            WriteDescriptor( typeRegistry, GetFilePath( rawResourceDirPath, directoryIdx, 0 ), g_numFilesPerDirectory + i );
+            WriteFile( typeRegistry, GetFilePath( rawResourceDirPath, directoryIdx, g_numFilesPerDirectory ), g_numFilesPerDirectory );
+        }
+
+        Resource::ResourceDatabase::BuildStats const incrementalStats = RunBuild( typeRegistry, &taskSystem, rawResourceDirPath, compiledResourceDirPath );
+
+        taskSystem.Shutdown();
+        FileSystem::EraseDir( benchmarkDirPath.c_str() );
+
+        //-------------------------------------------------------------------------
+
+        std::cout << "Resource Database (" << g_numDirectories << " directories x " << g_numFilesPerDirectory << " files)" << std::endl;
+        PrintStats( "Cold", coldStats );
+        PrintStats( "Warm", warmStats );
+        PrintStats( "Incremental", incrementalStats );
+        std::cout << "Search (" << g_numQueries << " queries) - Avg: " << ( queryResults.m_searchTime.ToFloat() / g_numQueries ) << "ms, Results: " << queryResults.m_numSearchResults << std::endl;
+        std::cout << "Referencers (" << g_numQueries << " queries) - Avg: " << ( queryResults.m_referencersTime.ToFloat() / g_numQueries ) << "ms, Results: " << queryResults.m_numReferencers << std::endl;
+
+        if ( coldStats.m_usedSnapshot || !warmStats.m_usedSnapshot || warmStats.m_numDescriptorsReadFromDisk != 0 || incrementalStats.m_numFiles != coldStats.m_numFiles + g_numModifiedDirectories )
+        {
+            std::cout << "Unexpected snapshot results!" << std::endl;
+            return 1;
+        }
+
+        // Only the modified and added descriptors should have been read from disk, anything else means the incremental build rescanned unchanged descriptors
+        static_assert( ( g_numFilesPerDirectory % g_descriptorFrequency ) == 0, "The file added to each modified directory needs to be a descriptor" );
+        int32_t const numExpectedDescriptorsReadFromDisk = g_numModifiedDirectories * 2;
+        if ( !incrementalStats.m_usedSnapshot || incrementalStats.m_numDescriptorsReadFromDisk != numExpectedDescriptorsReadFromDisk )
+        {
+            std::cout << "Incremental build read " << incrementalStats.m_numDescriptorsReadFromDisk << " descriptors from disk, expected " << numExpectedDescriptorsReadFromDisk << "!" << std::endl;
+            return 1;
+        }
+
+        return 0;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+// Measures the import time of a (large) source mesh file, reading it from source (converting the geometry serially and on the task system) and then from the raw asset cache
+namespace RawAssetImportBenchmark
+{
+    constexpr static int32_t const g_numCachedReads = 10;
+
+    static bool ReadMesh( RawAssets::ReaderContext const& readerCtx, FileSystem::Path const& sourceFilePath, bool isSkeletalMesh, Milliseconds& outTime, int32_t& outNumTriangles )
+    {
+        outNumTriangles = 0;
+
+        TUniquePtr<RawAssets::RawMesh> pRawMesh;
+        {
+            ScopedTimer<PlatformClock> timer( outTime );
+            pRawMesh = isSkeletalMesh ? RawAssets::ReadSkeletalMesh( readerCtx, sourceFilePath ) : RawAssets::ReadStaticMesh( readerCtx, sourceFilePath );
+        }
+
+        if ( pRawMesh == nullptr )
+        {
+            return false;
+        }
+
+        for ( auto const& geometrySection : pRawMesh->GetGeometrySections() )
+        {
+            outNumTriangles += (int32_t) geometrySection.GetNumTriangles();
+        }
+
+        return true;
+    }
+
+    static int Run( FileSystem::Path const& sourceFilePath, bool isSkeletalMesh )
+    {
+        if ( !sourceFilePath.IsValid() || !FileSystem::Exists( sourceFilePath ) )
+        {
+            std::cout << "Source file doesnt exist: " << sourceFilePath.c_str() << std::endl;
+            return 1;
+        }
+
+        FileSystem::Path const cacheDirPath = FileSystem::GetCurrentProcessPath().Append( "RawAssetImportBenchmark", true );
+        FileSystem::EraseDir( cacheDirPath.c_str() );
+
+        TaskSystem taskSystem( Threading::GetProcessorInfo().m_numPhysicalCores - 1 );
+        taskSystem.Initialize();
+
+        auto WarningDelegate = [] ( char const* pString ) {};
+        auto ErrorDelegate = [] ( char const* pString ) { std::cout << "Error: " << pString << std::endl; };
+        RawAssets::ReaderContext const serialReaderCtx = { WarningDelegate, ErrorDelegate, FileSystem::Path() };
+        RawAssets::ReaderContext const parallelReaderCtx = { WarningDelegate, ErrorDelegate, FileSystem::Path(), &taskSystem };
+        RawAssets::ReaderContext const readerCtx = { WarningDelegate, ErrorDelegate, cacheDirPath, &taskSystem };
+
+        // Parse the source file without the cache, converting the geometry serially and then on the task system
+        //-------------------------------------------------------------------------
+
+        Milliseconds serialSourceReadTime = 0.0f;
+        Milliseconds parallelSourceReadTime = 0.0f;
+        int32_t numSerialTriangles = 0;
+        int32_t numParallelTriangles = 0;
+        bool const sourceReadsSucceeded = ReadMesh( serialReaderCtx, sourceFilePath, isSkeletalMesh, serialSourceReadTime, numSerialTriangles ) && ReadMesh( parallelReaderCtx, sourceFilePath, isSkeletalMesh, parallelSourceReadTime, numParallelTriangles );
+        if ( !sourceReadsSucceeded || numSerialTriangles != numParallelTriangles )
+        {
+            std::cout << "Serial and parallel source reads dont match: " << sourceFilePath.c_str() << std::endl;
+            taskSystem.Shutdown();
+            return 1;
+        }
+
+        // The first read parses the source file and fills the cache, all subsequent reads hit the cache
+        //-------------------------------------------------------------------------
+
+        Milliseconds sourceReadTime = 0.0f;
+        int32_t numTriangles = 0;
+        if ( !ReadMesh( readerCtx, sourceFilePath, isSkeletalMesh, sourceReadTime, numTriangles ) )
+        {
+            std::cout << "Failed to read mesh: " << sourceFilePath.c_str() << std::endl;
+            taskSystem.Shutdown();
+            FileSystem::EraseDir( cacheDirPath.c_str() );
+            return 1;
+        }
+
+        Milliseconds totalCachedReadTime = 0.0f;
+        for ( int32_t i = 0; i < g_numCachedReads; i++ )
+        {
+            Milliseconds cachedReadTime = 0.0f;
+            int32_t numCachedTriangles = 0;
+            if ( !ReadMesh( readerCtx, sourceFilePath, isSkeletalMesh, cachedReadTime, numCachedTriangles ) || numCachedTriangles != numTriangles )
+            {
+                std::cout << "Cached mesh doesnt match source mesh!" << std::endl;
+                taskSystem.Shutdown();
+                FileSystem::EraseDir( cacheDirPath.c_str() );
+                return 1;
+            }
+
+            totalCachedReadTime += cachedReadTime;
+        }
+
+        taskSystem.Shutdown();
+        FileSystem::EraseDir( cacheDirPath.c_str() );
+
+        //-------------------------------------------------------------------------
+
+        std::cout << "Raw Asset Import (" << sourceFilePath.c_str() << ", " << numTriangles << " triangles)" << std::endl;
+        std::cout << "Source (Serial Conversion): " << serialSourceReadTime.ToFloat() << "ms" << std::endl;
+        std::cout << "Source (Parallel Conversion): " << parallelSourceReadTime.ToFloat() << "ms" << std::endl;
+        std::cout << "Source (Filling Cache): " << sourceReadTime.ToFloat() << "ms" << std::endl;
+        std::cout << "Cached (" << g_numCachedReads << " reads) - Avg: " << ( totalCachedReadTime.ToFloat() / g_numCachedReads ) << "ms" << std::endl;
+        return 0;
+    }
+}
+#endif
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+// Creates a tessellated sphere, with CCW triangles when viewed from outside the sphere
+static void CreateSphereMesh( int32_t numRings, int32_t numSegments, float radius, TVector<Float3>& outPositions, TVector<uint32_t>& outIndices )
+{
+    outPositions.clear();
+    outIndices.clear();
+
+    for ( int32_t r = 0; r <= numRings; r++ )
+    {
+        float const theta = Math::Pi * r / numRings;
+        for ( int32_t s = 0; s <= numSegments; s++ )
+        {
+            float const phi = 2.0f * Math::Pi * s / numSegments;
+            outPositions.emplace_back( Float3( Math::Sin( theta ) * Math::Cos( phi ), Math::Sin( theta ) * Math::Sin( phi ), Math::Cos( theta ) ) * radius );
+        }
+    }
+
+    uint32_t const rowSize = numSegments + 1;
+    for ( uint32_t r = 0; r < (uint32_t) numRings; r++ )
+    {
+        for ( uint32_t s = 0; s < (uint32_t) numSegments; s++ )
+        {
+            uint32_t const a = r * rowSize + s;
+            uint32_t const b = a + 1;
+            uint32_t const c = a + rowSize;
+            uint32_t const d = c + 1;
+            outIndices.insert( outIndices.end(), { a, c, b, b, c, d } );
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+// Measures meshlet generation and CPU meshlet culling/index compaction for a large generated mesh (a tessellated sphere)
+// The views orbit the mesh at different distances, so that both frustum and backface culling are exercised
+namespace MeshletCullingBenchmark
+{
+    constexpr static int32_t const g_numRings = 1000;
+    constexpr static int32_t const g_numSegments = 1000;
+    constexpr static float const g_radius = 10.0f;
+    constexpr static int32_t const g_numViews = 64;
+    constexpr static int32_t const g_numFramesPerView = 10;
+
+    static int Run()
+    {
+        TVector<Float3> positions;
+        TVector<uint32_t> indices;
+        CreateSphereMesh( g_numRings, g_numSegments, g_radius, positions, indices );
+
+        // Generate meshlets
+        //-------------------------------------------------------------------------
+
+        TVector<Render::Mesh::Meshlet> meshlets;
+        Milliseconds buildTime = 0.0f;
+        {
+            ScopedTimer<PlatformClock> timer( buildTime );
+            Render::BuildMeshlets( (uint8_t const*) positions.data(), positions.size(), sizeof( Float3 ), indices, 0, (uint32_t) indices.size(), meshlets );
+        }
+
+        // Cull
+        //-------------------------------------------------------------------------
+
+        Math::ViewVolume viewVolume( Float2( 1920, 1080 ), FloatRange( 0.1f, 1000.0f ), Degrees( 90.0f ).ToRadians() );
+        Transform const worldTransform = Transform::Identity;
+
+        TVector<uint32_t> visibleMeshlets;
+        TVector<uint32_t> compactedIndices;
+        visibleMeshlets.reserve( meshlets.size() );
+        compactedIndices.reserve( indices.size() );
+
+        Render::MeshletCulling::Stats stats;
+        Milliseconds totalCullTime = 0.0f;
+        Milliseconds totalCompactionTime = 0.0f;
+
+        for ( int32_t i = 0; i < g_numViews; i++ )
+        {
+            // Orbit the sphere, moving from far away (whole sphere visible) to close to the surface (most of the sphere is off-screen)
+            float const angle = 2.0f * Math::Pi * i / g_numViews;
+            float const distance = g_radius * ( 1.2f + 3.0f * ( i % 4 ) / 3.0f );
+            Vector const viewPosition( Math::Cos( angle ) * distance, Math::Sin( angle ) * distance, g_radius * 0.25f );
+            viewVolume.SetView( viewPosition, ( -viewPosition ).GetNormalized3(), Vector::UnitZ );
+
+            for ( int32_t f = 0; f < g_numFramesPerView; f++ )
+            {
+                visibleMeshlets.clear();
+                compactedIndices.clear();
+                stats.Reset();
+
+                Milliseconds cullTime = 0.0f;
+                {
+                    ScopedTimer<PlatformClock> timer( cullTime );
+                    Render::MeshletCulling::CullMeshlets( meshlets, 0, (uint32_t) meshlets.size(), worldTransform, viewVolume, true, visibleMeshlets, &stats );
+                }
+
+                Milliseconds compactionTime = 0.0f;
+                {
+                    ScopedTimer<PlatformClock> timer( compactionTime );
+                    Render::MeshletCulling::CompactIndices( indices, meshlets, visibleMeshlets, compactedIndices, &stats );
+                }
+
+                totalCullTime += cullTime;
+                totalCompactionTime += compactionTime;
+            }
+
+            std::cout << "View " << i << " (Distance: " << distance << ") - Visible Meshlets: " << visibleMeshlets.size() << "/" << stats.m_numMeshlets << ", Frustum Culled: " << stats.m_numFrustumCulled << ", Backface Culled: " << stats.m_numBackfaceCulled << ", Indices: " << stats.m_numOutputIndices << "/" << stats.m_numInputIndices << std::endl;
+        }
+
+        //-------------------------------------------------------------------------
+
+        int32_t const numFrames = g_numViews * g_numFramesPerView;
+        std::cout << "Meshlet Culling (" << ( indices.size() / 3 ) << " triangles, " << meshlets.size() << " meshlets)" << std::endl;
+        std::cout << "Meshlet Generation: " << buildTime.ToFloat() << "ms" << std::endl;
+        std::cout << "Cull (" << numFrames << " frames) - Avg: " << ( totalCullTime.ToFloat() / numFrames ) << "ms" << std::endl;
+        std::cout << "Compaction (" << numFrames << " frames) - Avg: " << ( totalCompactionTime.ToFloat() / numFrames ) << "ms" << std::endl;
+        return 0;
+    }
+}
+#endif
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+// Checks the light cluster binning against a brute force reference for perspective and orthographic views
+// Points are sampled inside every light's volume (sphere and spot cone), biased towards its edges, and each visible point is mapped to a cluster exactly as the lighting shader does
+// Fails if any of these clusters is missing the light or if the parallel binning differs from the single threaded binning
+namespace LightClusterTest
+{
+    constexpr static int32_t const g_numLights = 256;
+    constexpr static int32_t const g_numSamplesPerLight = 4000;
+    constexpr static float const g_sceneExtents = 50.0f;
+
+    // Lights surround the views so that some are behind the camera or straddle the near plane
+    static void CreateLights( Math::RNG& rng, TVector<Render::PunctualLight>& outLights )
+    {
+        outLights.clear();
+        outLights.reserve( g_numLights );
+
+        for ( int32_t i = 0; i < g_numLights; i++ )
+        {
+            Render::PunctualLight& light = outLights.emplace_back();
+            light.m_positionInvRadiusSqr = Vector( rng.GetFloat( -g_sceneExtents, g_sceneExtents ), rng.GetFloat( -g_sceneExtents, g_sceneExtents ), rng.GetFloat( -5.0f, 20.0f ), Math::Sqr( 1.0f / rng.GetFloat( 1.0f, 20.0f ) ) );
+            light.m_color = Vector::One;
+
+            if ( ( i % 2 ) == 0 )
+            {
+                light.m_dir = Vector::Zero;
+                light.m_spotAngles = Vector( -1.0f, 1.0f, 0.0f );
+            }
+            else
+            {
+                Vector coneAxis;
+                do
+                {
+                    coneAxis = Vector( rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ) );
+                } while ( coneAxis.GetLengthSquared3() < 0.01f );
+
+                // Same convention as the world renderer: the direction is towards the light, i.e. the negated cone axis
+                float const cosOuter = Math::Cos( Degrees( rng.GetFloat( 20.0f, 80.0f ) ).ToRadians().ToFloat() );
+                light.m_dir = -coneAxis.GetNormalized3();
+                light.m_spotAngles = Vector( cosOuter, 1.0f / ( 1.0f - cosOuter ), 0.0f );
+            }
+        }
+    }
+
+    // Matches GetLightCluster in Common_Lit.hlsli
+    static uint32_t GetShaderClusterIndex( Render::LightClusterShaderParams const& params, Render::Viewport const& viewport, Vector const& point )
+    {
+        Float2 const screenPos = viewport.WorldSpaceToScreenSpace( point );
+        uint32_t const tileX = Math::Min( (uint32_t) Math::Max( Math::Floor( ( screenPos.m_x - params.m_screenParams.m_x ) * params.m_screenParams.m_z ), 0.0f ), params.m_dimensions[0] - 1 );
+        uint32_t const tileY = Math::Min( (uint32_t) Math::Max( Math::Floor( ( screenPos.m_y - params.m_screenParams.m_y ) * params.m_screenParams.m_w ), 0.0f ), params.m_dimensions[1] - 1 );
+
+        float const depth = Math::Max( ( point - params.m_viewPosition ).GetDot3( params.m_viewForward ), 1e-4f );
+        uint32_t const slice = (uint32_t) Math::Clamp( Math::Floor( Math::Log( depth ) * params.m_depthParams.m_x + params.m_depthParams.m_y ), 0.0f, (float) ( params.m_dimensions[2] - 1 ) );
+        return ( slice * params.m_dimensions[1] + tileY ) * params.m_dimensions[0] + tileX;
+    }
+
+    static bool IsLightInCluster( Render::LightClusterGrid const& grid, uint32_t clusterIdx, uint32_t lightIdx )
+    {
+        Render::LightCluster const& cluster = grid.GetClusters()[clusterIdx];
+        for ( uint32_t i = 0; i < cluster.m_numLights; i++ )
+        {
+            if ( grid.GetLightIndices()[cluster.m_firstLightIdx + i] == lightIdx )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    static bool AreGridsEqual( Render::LightClusterGrid const& gridA, Render::LightClusterGrid const& gridB )
+    {
+        if ( gridA.GetClusters().size() != gridB.GetClusters().size() || gridA.GetLightIndices() != gridB.GetLightIndices() )
+        {
+            return false;
+        }
+
+        for ( size_t i = 0; i < gridA.GetClusters().size(); i++ )
+        {
+            if ( gridA.GetClusters()[i].m_firstLightIdx != gridB.GetClusters()[i].m_firstLightIdx || gridA.GetClusters()[i].m_numLights != gridB.GetClusters()[i].m_numLights )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Returns the number of sampled points whose cluster didnt contain the light
+    static int32_t RunView( char const* pViewName, Render::Viewport const& viewport, TVector<Render::PunctualLight> const& lights, TaskSystem* pTaskSystem, Math::RNG& rng, bool& outParallelMismatch )
+    {
+        Math::ViewVolume const& viewVolume = viewport.GetViewVolume();
+
+        Render::LightClusterGrid grid;
+        grid.Build( viewport, lights, nullptr );
+
+        Render::LightClusterGrid parallelGrid;
+        parallelGrid.Build( viewport, lights, pTaskSystem );
+        outParallelMismatch = !AreGridsEqual( grid, parallelGrid );
+
+        // Brute force every light against the clusters its sampled points map to
+        //-------------------------------------------------------------------------
+
+        TVector<uint64_t> sampledPairs;
+        int32_t numMissing = 0;
+        int32_t numVisibleSamples = 0;
+
+        uint32_t const numLights = (uint32_t) lights.size();
+        for ( uint32_t lightIdx = 0; lightIdx < numLights; lightIdx++ )
+        {
+            Render::PunctualLight const& light = lights[lightIdx];
+            Vector const lightPosition = light.m_positionInvRadiusSqr.GetWithW1();
+            float const radius = 1.0f / Math::Sqrt( light.m_positionInvRadiusSqr.GetW() );
+            float const cosAngle = light.m_spotAngles.GetX();
+            Vector const coneAxis = -light.m_dir;
+
+            int32_t numSamples = 0;
+            for ( int32_t attempt = 0; attempt < g_numSamplesPerLight * 50 && numSamples < g_numSamplesPerLight; attempt++ )
+            {
+                Vector direction;
+                do
+                {
+                    direction = Vector( rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ) );
+                } while ( direction.GetLengthSquared3() > 1.0f || direction.GetLengthSquared3() < 1e-6f );
+                direction = direction.GetNormalized3();
+
+                if ( cosAngle > -1.0f && direction.GetDot3( coneAxis ) < cosAngle )
+                {
+                    continue;
+                }
+
+                // Half the samples are close to the light's radius, this is where a binning error would show up first
+                float const distance = radius * ( ( attempt % 2 ) == 0 ? rng.GetFloat( 0.95f, 1.0f ) : Math::Pow( rng.GetFloat(), 1.0f / 3.0f ) );
+                Vector const point = lightPosition + direction * distance;
+                numSamples++;
+
+                if ( !viewVolume.Contains( point ) )
+                {
+                    continue;
+                }
+
+                numVisibleSamples++;
+                uint32_t const clusterIdx = GetShaderClusterIndex( grid.GetShaderParams(), viewport, point );
+                sampledPairs.emplace_back( ( (uint64_t) clusterIdx << 32 ) | lightIdx );
+
+                if ( !IsLightInCluster( grid, clusterIdx, lightIdx ) )
+                {
+                    if ( numMissing < 10 )
+                    {
+                        std::cout << pViewName << ": Light " << lightIdx << " is missing from cluster " << clusterIdx << " (point: " << point.GetX() << ", " << point.GetY() << ", " << point.GetZ() << ")" << std::endl;
+                    }
+
+                    numMissing++;
+                }
+            }
+        }
+
+        // The binning is conservative so it can contain more light/cluster pairs than were sampled
+        eastl::sort( sampledPairs.begin(), sampledPairs.end() );
+        sampledPairs.erase( eastl::unique( sampledPairs.begin(), sampledPairs.end() ), sampledPairs.end() );
+
+        Render::LightClusterGrid::Stats const& stats = grid.GetStats();
+        std::cout << pViewName << " - Visible Lights: " << stats.m_numVisibleLights << "/" << stats.m_numLights << ", Binned Pairs: " << stats.m_numLightIndices << ", Sampled Pairs: " << sampledPairs.size() << ", Visible Samples: " << numVisibleSamples << ", Missing: " << numMissing << std::endl;
+        return numMissing;
+    }
+
+    static int Run()
+    {
+        TaskSystem taskSystem( Threading::GetProcessorInfo().m_numPhysicalCores - 1 );
+        taskSystem.Initialize();
+
+        Math::RNG rng( 12345 );
+        TVector<Render::PunctualLight> lights;
+        CreateLights( rng, lights );
+
+        Int2 const resolution( 1920, 1080 );
+        FloatRange const depthRange( 0.1f, g_sceneExtents * 3.0f );
+
+        // Looking down at the scene from outside it, and from inside the lights looking across it
+        Vector const overviewPosition( 0.0f, -g_sceneExtents * 1.5f, g_sceneExtents * 0.5f );
+        Vector const insidePosition( 0.0f, 0.0f, 5.0f );
+        Vector const overviewUp = Vector( 0.0f, 1.0f, 3.0f ).GetNormalized3(); // SetView expects an up direction orthogonal to the view direction
+
+        Math::ViewVolume overviewVolume( Float2( resolution ), depthRange, Degrees( 90.0f ).ToRadians() );
+        overviewVolume.SetView( overviewPosition, ( -overviewPosition ).GetNormalized3(), overviewUp );
+
+        Math::ViewVolume insideVolume( Float2( resolution ), depthRange, Degrees( 60.0f ).ToRadians() );
+        insideVolume.SetView( insidePosition, Vector( 1.0f, 1.0f, 0.0f ).GetNormalized3(), Vector::UnitZ );
+
+        Math::ViewVolume orthographicVolume( Float2( g_sceneExtents * 2.0f, g_sceneExtents * 2.0f * 9.0f / 16.0f ), depthRange );
+        orthographicVolume.SetView( overviewPosition, ( -overviewPosition ).GetNormalized3(), overviewUp );
+
+        Render::Viewport const views[] =
+        {
+            Render::Viewport( Int2( 0, 0 ), resolution, overviewVolume ),
+            Render::Viewport( Int2( 0, 0 ), resolution, insideVolume ),
+            Render::Viewport( Int2( 0, 0 ), resolution, orthographicVolume ),
+        };
+
+        char const* const viewNames[] = { "Perspective (Overview)", "Perspective (Inside)", "Orthographic" };
+        static_assert( sizeof( views ) / sizeof( views[0] ) == sizeof( viewNames ) / sizeof( viewNames[0] ) );
+
+        bool isValid = true;
+        for ( size_t i = 0; i < sizeof( views ) / sizeof( views[0] ); i++ )
+        {
+            bool parallelMismatch = false;
+            int32_t const numMissing = RunView( viewNames[i], views[i], lights, &taskSystem, rng, parallelMismatch );
+
+            if ( parallelMismatch )
+            {
+                std::cout << viewNames[i] << ": Parallel binning differs from single threaded binning!" << std::endl;
+            }
+
+            isValid &= ( numMissing == 0 ) && !parallelMismatch;
+        }
+
+        taskSystem.Shutdown();
+
+        std::cout << ( isValid ? "Light clustering matches the brute force reference" : "Light clustering mismatch!" ) << std::endl;
+        return isValid ? 0 : 1;
+    }
+}
+#endif
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+// Generates a LOD chain for a sphere mesh and measures the runtime LOD selection for a grid of instances
+// Reports the scene triangle counts with and without LODs, validates the selected LODs against the error threshold
+// and counts the LOD switches for a camera oscillating around a LOD switch distance, with and without hysteresis
+namespace MeshLODBenchmark
+{
+    constexpr static int32_t const g_numRings = 200;
+    constexpr static int32_t const g_numSegments = 200;
+    constexpr static float const g_radius = 1.0f;
+    constexpr static int32_t const g_numLODs = 8;
+    constexpr static float const g_LODTriangleRatio = 0.5f;
+    constexpr static float const g_maxLODError = 0.05f;
+    constexpr static int32_t const g_gridSize = 64;
+    constexpr static float const g_gridSpacing = 4.0f;
+    constexpr static int32_t const g_numFrames = 100;
+    constexpr static int32_t const g_numOscillationFrames = 1000;
+
+    static Render::Viewport CreateViewport( Vector const& viewPosition, Vector const& viewTarget )
+    {
+        Math::ViewVolume viewVolume( Float2( 1920, 1080 ), FloatRange( 0.1f, 1000.0f ), Degrees( 90.0f ).ToRadians() );
+        viewVolume.SetView( viewPosition, ( viewTarget - viewPosition ).GetNormalized3(), Vector::UnitZ );
+        return Render::Viewport( Int2( 0, 0 ), Int2( 1920, 1080 ), viewVolume );
+    }
+
+    static float GetPixelsPerUnit( Render::Viewport const& viewport, Vector const& instancePosition )
+    {
+        return Render::MeshLODSelection::CalculatePixelsPerUnit( viewport, viewport.GetViewPosition().GetDistance3( instancePosition ) - g_radius );
+    }
+
+    static int32_t CountLODSwitches( TVector<float> const& LODErrors, Render::MeshLODSelection::Settings const& settings, float switchDistance )
+    {
+        Vector const instancePosition = Vector::Zero;
+
+        int32_t numSwitches = 0;
+        int32_t LOD = 0;
+        for ( int32_t i = 0; i < g_numOscillationFrames; i++ )
+        {
+            // Oscillate by 10% around the switch distance
+            float const distance = switchDistance * ( 1.0f + 0.1f * Math::Sin( i * 0.5f ) );
+            Render::Viewport const viewport = CreateViewport( Vector( 0.0f, -distance - g_radius, 0.0f ), instancePosition );
+            int32_t const newLOD = Render::MeshLODSelection::SelectLOD( LODErrors.data(), (int32_t) LODErrors.size(), GetPixelsPerUnit( viewport, instancePosition ), LOD, settings );
+            numSwitches += ( newLOD != LOD ) ? 1 : 0;
+            LOD = newLOD;
+        }
+
+        return numSwitches;
+    }
+
+    static int Run()
+    {
+        TVector<Float3> positions;
+        TVector<uint32_t> indices;
+        CreateSphereMesh( g_numRings, g_numSegments, g_radius, positions, indices );
+
+        // Generate LODs
+        //-------------------------------------------------------------------------
+
+        TVector<float> LODErrors = { 0.0f };
+        TVector<uint32_t> LODNumTriangles = { (uint32_t) indices.size() / 3 };
+
+        Milliseconds LODGenerationTime = 0.0f;
+        {
+            ScopedTimer<PlatformClock> timer( LODGenerationTime );
+
+            TVector<uint32_t> simplifiedIndices;
+            float targetRatio = 1.0f;
+            for ( int32_t i = 0; i < g_numLODs; i++ )
+            {
+                targetRatio *= g_LODTriangleRatio;
+                uint32_t const targetNumIndices = uint32_t( indices.size() / 3 * targetRatio ) * 3;
+                float const error = Render::SimplifyTriangles( (uint8_t const*) positions.data(), positions.size(), sizeof( Float3 ), indices.data(), (uint32_t) indices.size(), targetNumIndices, g_maxLODError, simplifiedIndices );
+
+                uint32_t const numTriangles = (uint32_t) simplifiedIndices.size() / 3;
+                if ( numTriangles > LODNumTriangles.back() * 0.95f )
+                {
+                    break;
+                }
+
+                LODErrors.emplace_back( Math::Max( error, LODErrors.back() ) );
+                LODNumTriangles.emplace_back( numTriangles );
+            }
+        }
+
+        int32_t const numLODs = (int32_t) LODErrors.size();
+        std::cout << "Mesh LODs (" << LODNumTriangles[0] << " triangles, generated in " << LODGenerationTime.ToFloat() << "ms)" << std::endl;
+        for ( int32_t i = 0; i < numLODs; i++ )
+        {
+            std::cout << "LOD " << i << " - Triangles: " << LODNumTriangles[i] << ", Error: " << LODErrors[i] << std::endl;
+        }
+
+        // Select LODs for the scene
+        //-------------------------------------------------------------------------
+
+        TVector<Vector> instancePositions;
+        for ( int32_t y = 0; y < g_gridSize; y++ )
+        {
+            for ( int32_t x = 0; x < g_gridSize; x++ )
+            {
+                instancePositions.emplace_back( Vector( x * g_gridSpacing, y * g_gridSpacing, 0.0f ) );
+            }
+        }
+
+        float const gridExtents = g_gridSize * g_gridSpacing;
+        Render::Viewport const viewport = CreateViewport( Vector( -4.0f, -4.0f, 4.0f ), Vector( gridExtents, gridExtents, 0.0f ) * 0.5f );
+
+        Render::MeshLODSelection::Settings const settings;
+        TVector<int32_t> instanceLODs( instancePositions.size(), 0 );
+
+        Milliseconds totalSelectionTime = 0.0f;
+        for ( int32_t f = 0; f < g_numFrames; f++ )
+        {
+            ScopedTimer<PlatformClock> timer( totalSelectionTime );
+            for ( size_t i = 0; i < instancePositions.size(); i++ )
+            {
+                instanceLODs[i] = Render::MeshLODSelection::SelectLOD( LODErrors.data(), numLODs, GetPixelsPerUnit( viewport, instancePositions[i] ), instanceLODs[i], settings );
+            }
+        }
+
+        // Report and validate
+        //-------------------------------------------------------------------------
+
+        uint64_t numBaseTriangles = 0;
+        uint64_t numSelectedTriangles = 0;
+        TVector<int32_t> LODHistogram( numLODs, 0 );
+        bool isValid = true;
+
+        for ( size_t i = 0; i < instancePositions.size(); i++ )
+        {
+            int32_t const LOD = instanceLODs[i];
+            numBaseTriangles += LODNumTriangles[0];
+            numSelectedTriangles += LODNumTriangles[LOD];
+            LODHistogram[LOD]++;
+
+            if ( LODErrors[LOD] * GetPixelsPerUnit( viewport, instancePositions[i] ) > settings.m_maxScreenSpaceError )
+            {
+                isValid = false;
+            }
+        }
+
+        // Find the distance at which LOD 1 becomes acceptable and oscillate around it
+        float const switchPixelsPerUnit = ( numLODs > 1 ) ? settings.m_maxScreenSpaceError / LODErrors[1] : 1.0f;
+        float const switchDistance = ( numLODs > 1 ) ? viewport.GetDimensions().m_x / ( 2.0f * switchPixelsPerUnit * Math::Tan( viewport.GetViewVolume().GetFOV().ToFloat() * 0.5f ) ) : 10.0f;
+
+        Render::MeshLODSelection::Settings noHysteresisSettings;
+        noHysteresisSettings.m_hysteresis = 0.0f;
+        int32_t const numSwitchesWithoutHysteresis = CountLODSwitches( LODErrors, noHysteresisSettings, switchDistance );
+        int32_t const numSwitchesWithHysteresis = CountLODSwitches( LODErrors, settings, switchDistance );
+
+        // Selection has to be monotonic, the closest view should always use the base LOD and the furthest view the coarsest LOD
+        isValid &= Render::MeshLODSelection::SelectLOD( LODErrors.data(), numLODs, 1000000.0f, numLODs - 1, settings ) == 0;
+        isValid &= Render::MeshLODSelection::SelectLOD( LODErrors.data(), numLODs, 0.0f, 0, settings ) == numLODs - 1;
+
+        std::cout << "Scene (" << instancePositions.size() << " instances) - Triangles: " << numBaseTriangles << " -> " << numSelectedTriangles << " (" << ( 100.0 * numSelectedTriangles / numBaseTriangles ) << "%)" << std::endl;
+        for ( int32_t i = 0; i < numLODs; i++ )
+        {
+            std::cout << "LOD " << i << " - Instances: " << LODHistogram[i] << std::endl;
+        }
+        std::cout << "Selection (" << g_numFrames << " frames) - Avg: " << ( totalSelectionTime.ToFloat() / g_numFrames ) << "ms" << std::endl;
+        std::cout << "LOD Switches (" << g_numOscillationFrames << " frames oscillating around " << switchDistance << "m) - Without Hysteresis: " << numSwitchesWithoutHysteresis << ", With Hysteresis: " << numSwitchesWithHysteresis << std::endl;
+
+        if ( !isValid )
+        {
+            std::cout << "LOD selection failed validation!" << std::endl;
+            return 1;
+        }
+
+        return 0;
+    }
+}
+#endif
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+// Round-trips the vertices of an (offset) sphere mesh through the compressed vertex formats
+// Reports the max decoding error per attribute and the vertex memory savings, and validates the errors against the quantization precision
+namespace VertexCompressionBenchmark
+{
+    constexpr static int32_t const g_numRings = 500;
+    constexpr static int32_t const g_numSegments = 500;
+    constexpr static float const g_radius = 5.0f;
+    constexpr static float const g_maxNormalErrorDegrees = 0.1f;
+    constexpr static float const g_maxUVError = 1.0f / 2048;          // Half float precision for UVs in the [0,1] range
+    constexpr static float const g_maxBoneWeightError = 2.0f / 255;   // Rounding error plus the redistributed remainder
+
+    static int Run()
+    {
+        TVector<Float3> positions;
+        TVector<uint32_t> indices;
+        CreateSphereMesh( g_numRings, g_numSegments, g_radius, positions, indices );
+
+        // Offset the sphere so that the quantization range doesnt start at the origin
+        Float3 const sphereOffset( 100.0f, -50.0f, 20.0f );
+        TVector<Render::SkeletalMeshVertex> vertices( positions.size() );
+        for ( size_t i = 0; i < positions.size(); i++ )
+        {
+            Render::SkeletalMeshVertex& vertex = vertices[i];
+            vertex.m_position = Float4( positions[i] + sphereOffset, 1.0f );
+            vertex.m_normal = Float4( positions[i] / g_radius, 0.0f );
+            vertex.m_UV0 = Float2( Math::GetRandomFloat(), Math::GetRandomFloat() );
+            vertex.m_UV1 = Float2( Math::GetRandomFloat(), Math::GetRandomFloat() );
+
+            // Between one and four influences, unused influences have an invalid bone index and zero weight
+            int32_t const numInfluences = Math::GetRandomInt( 1, 4 );
+            float weights[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            float totalWeight = 0.0f;
+            for ( int32_t j = 0; j < numInfluences; j++ )
+            {
+                weights[j] = Math::GetRandomFloat( 0.01f, 1.0f );
+                totalWeight += weights[j];
+            }
+
+            vertex.m_boneWeights = Float4( weights[0], weights[1], weights[2], weights[3] ) / totalWeight;
+            vertex.m_boneIndices = Int4( InvalidIndex );
+            for ( int32_t j = 0; j < numInfluences; j++ )
+            {
+                vertex.m_boneIndices[j] = Math::GetRandomInt( 0, 254 );
+            }
+        }
+
+        Float3 const rangeMin = sphereOffset - Float3( g_radius );
+        Float3 const rangeMax = sphereOffset + Float3( g_radius );
+        Render::VertexCompression::QuantizationRange const range( rangeMin, rangeMax );
+
+        // Compress
+        //-------------------------------------------------------------------------
+
+        size_t const numVertices = vertices.size();
+        Blob compressedStaticVertices;
+        Blob compressedSkeletalVertices;
+
+        // Slice the skeletal vertices, so the static compression can be validated against the static part of the skeletal compression
+        TVector<Render::StaticMeshVertex> staticVertices( vertices.begin(), vertices.end() );
+
+        Milliseconds staticCompressionTime = 0.0f;
+        {
+            ScopedTimer<PlatformClock> timer( staticCompressionTime );
+            Render::VertexCompression::CompressVertices( Render::VertexFormat::StaticMesh, (uint8_t const*) staticVertices.data(), numVertices, range, compressedStaticVertices );
+        }
+
+        Milliseconds skeletalCompressionTime = 0.0f;
+        {
+            ScopedTimer<PlatformClock> timer( skeletalCompressionTime );
+            Render::VertexCompression::CompressVertices( Render::VertexFormat::SkeletalMesh, (uint8_t const*) vertices.data(), numVertices, range, compressedSkeletalVertices );
+        }
+
+        // Validate
+        //-------------------------------------------------------------------------
+
+        float maxPositionError = 0.0f;
+        float maxNormalErrorDegrees = 0.0f;
+        float maxUVError = 0.0f;
+        float maxBoneWeightError = 0.0f;
+        bool areStaticVerticesIdentical = true;
+        bool areBoneIndicesValid = true;
+        bool areBoneWeightsNormalized = true;
+
+        auto pCompressedStaticVertices = reinterpret_cast<Render::StaticMeshCompressedVertex const*>( compressedStaticVertices.data() );
+        auto pCompressedSkeletalVertices = reinterpret_cast<Render::SkeletalMeshCompressedVertex const*>( compressedSkeletalVertices.data() );
+
+        for ( size_t i = 0; i < numVertices; i++ )
+        {
+            Render::SkeletalMeshVertex const& original = vertices[i];
+
+            Render::SkeletalMeshVertex decoded;
+            Render::VertexCompression::DecompressVertex( pCompressedSkeletalVertices[i], range, decoded );
+
+            // The static part of the skeletal vertex must be encoded identically to the static vertex
+            areStaticVerticesIdentical &= memcmp( &pCompressedStaticVertices[i], &pCompressedSkeletalVertices[i], sizeof( Render::StaticMeshCompressedVertex ) ) == 0;
+
+            for ( int32_t c = 0; c < 3; c++ )
+            {
+                maxPositionError = Math::Max( maxPositionError, Math::Abs( decoded.m_position[c] - original.m_position[c] ) );
+            }
+
+            float const normalDot = Math::Clamp( Dot( Float3( decoded.m_normal ), Float3( original.m_normal ) ), -1.0f, 1.0f );
+            maxNormalErrorDegrees = Math::Max( maxNormalErrorDegrees, Math::ACos( normalDot ) * Math::RadiansToDegrees );
+
+            for ( int32_t c = 0; c < 2; c++ )
+            {
+                maxUVError = Math::Max( maxUVError, Math::Abs( decoded.m_UV0[c] - original.m_UV0[c] ) );
+                maxUVError = Math::Max( maxUVError, Math::Abs( decoded.m_UV1[c] - original.m_UV1[c] ) );
+            }
+
+            int32_t weightSum = 0;
+            for ( int32_t c = 0; c < 4; c++ )
+            {
+                areBoneIndicesValid &= decoded.m_boneIndices[c] == original.m_boneIndices[c];
+                maxBoneWeightError = Math::Max( maxBoneWeightError, Math::Abs( decoded.m_boneWeights[c] - original.m_boneWeights[c] ) );
+                weightSum += pCompressedSkeletalVertices[i].m_boneWeights[c];
+            }
+
+            areBoneWeightsNormalized &= weightSum == 255;
+        }
+
+        // One quantization step, per axis (the rounding error is half a step, the rest is float precision at the offset)
+        float const maxAllowedPositionError = ( 2.0f * g_radius ) / 65535.0f;
+
+        // Report
+        //-------------------------------------------------------------------------
+
+        size_t const staticSize = numVertices * sizeof( Render::StaticMeshVertex );
+        size_t const skeletalSize = numVertices * sizeof( Render::SkeletalMeshVertex );
+
+        std::cout << "Vertices: " << numVertices << std::endl;
+        std::cout << "Static - " << sizeof( Render::StaticMeshVertex ) << " -> " << sizeof( Render::StaticMeshCompressedVertex ) << " bytes per vertex, " << staticSize / 1024 << "KB -> " << compressedStaticVertices.size() / 1024 << "KB (" << ( 100.0 * compressedStaticVertices.size() / staticSize ) << "%), compressed in " << staticCompressionTime.ToFloat() << "ms" << std::endl;
+        std::cout << "Skeletal - " << sizeof( Render::SkeletalMeshVertex ) << " -> " << sizeof( Render::SkeletalMeshCompressedVertex ) << " bytes per vertex, " << skeletalSize / 1024 << "KB -> " << compressedSkeletalVertices.size() / 1024 << "KB (" << ( 100.0 * compressedSkeletalVertices.size() / skeletalSize ) << "%), compressed in " << skeletalCompressionTime.ToFloat() << "ms" << std::endl;
+        std::cout << "Max Errors - Position: " << maxPositionError << " (allowed: " << maxAllowedPositionError << "), Normal: " << maxNormalErrorDegrees << " degrees, UV: " << maxUVError << ", Bone Weight: " << maxBoneWeightError << std::endl;
+
+        bool const isValid = areStaticVerticesIdentical && areBoneIndicesValid && areBoneWeightsNormalized && maxPositionError <= maxAllowedPositionError && maxNormalErrorDegrees <= g_maxNormalErrorDegrees && maxUVError <= g_maxUVError && maxBoneWeightError <= g_maxBoneWeightError;
+        if ( !isValid )
+        {
+            std::cout << "Vertex compression failed validation!" << std::endl;
+            return 1;
+        }
+
+        return 0;
+    }
+}
+#endif
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+// Replays animation task streams through the delta task stream encoder/decoder with simulated packet and ack loss
+// The main test records a real graph: the graph variation is loaded from the compiled data, updated headless with changing control parameters and recorded with a graph recorder
+// Every received frame needs to match the recorded task data and resource table bit-exactly, it is then deserialized into a separate task system using the replicated resource table and re-serialized, which needs to match the recording as well
+// A synthetic stream using the task serializer layout is also replayed for long enough to wrap the 16bit sequence, late or duplicated packets need to be rejected throughout
+namespace TaskStreamBenchmark
+{
+    using TaskDataArchive = Serialization::BitArchive<1280>; // Needs to match the task serializer
+
+    constexpr static int32_t const g_numRecordedFrames = 3000;
+    constexpr static int32_t const g_numFramesBetweenParameterChanges = 45;
+    constexpr static float const g_frameDeltaTime = 1.0f / 30.0f;
+    constexpr static int32_t const g_numSyntheticFrames = 70000; // More than the 16bit sequence range
+    constexpr static int32_t const g_minTasks = 4;
+    constexpr static int32_t const g_maxTasks = 12;
+    constexpr static int32_t const g_maxResources = 64;
+    constexpr static uint32_t const g_maxBitsForTaskType = 5;
+
+    // Simple deterministic LCG so that runs are reproducible
+    struct Random
+    {
+        Random( uint32_t seed ) : m_state( seed ) {}
+
+        inline uint32_t Next() { m_state = m_state * 1664525u + 1013904223u; return m_state >> 8; }
+        inline uint32_t GetUInt( uint32_t min, uint32_t max ) { return min + ( Next() % ( max - min + 1 ) ); }
+        inline float GetFloat( float min, float max ) { return min + ( float( Next() ) / float( 1 << 24 ) ) * ( max - min ); }
+        inline bool GetChance( float percentage ) { return float( Next() ) / float( 1 << 24 ) * 100.0f < percentage; }
+
+        uint32_t m_state = 0;
+    };
+
+    // The task system and resources used to deserialize and re-serialize the decoded frames
+    struct ReplicatedTaskSystem
+    {
+        Animation::TaskSystem*                              m_pTaskSystem = nullptr;
+        TInlineVector<Animation::ResourceLUT const*, 10>    m_LUTs;
+    };
+
+    struct Results
+    {
+        int64_t                                     m_totalFullBytes = 0;
+        int64_t                                     m_totalPacketBytes = 0;
+        int32_t                                     m_numFrames = 0;
+        int32_t                                     m_numLostPackets = 0;
+        int32_t                                     m_numFailedDecodes = 0;
+        int32_t                                     m_numMismatches = 0;
+        int32_t                                     m_numReplicatedMismatches = 0;
+        int32_t                                     m_numAcceptedStalePackets = 0;
+        Milliseconds                                m_encodeTime = 0.0f;
+        Milliseconds                                m_decodeTime = 0.0f;
+        Milliseconds                                m_deserializeTime = 0.0f;
+    };
+
+    //-------------------------------------------------------------------------
+    // Synthetic Stream
+    //-------------------------------------------------------------------------
+    // Most tasks only change a few bits per frame (i.e. sample times), tasks are occasionally added/removed and the resource table is occasionally appended to or replaced
+
+    struct SyntheticTask
+    {
+        struct Field
+        {
+            uint32_t                                m_value = 0;
+            uint32_t                                m_numBits = 0;
+        };
+
+        uint32_t                                    m_typeID = 0;
+        uint32_t                                    m_time = 0;
+        uint32_t                                    m_weight = 0;
+        TInlineVector<Field, 4>                     m_fields;
+    };
+
+    struct SyntheticTaskStream
+    {
+        TVector<SyntheticTask>                      m_tasks;
+        TVector<uint32_t>                           m_resourceTable;
+    };
+
+    static SyntheticTask CreateRandomTask( Random& random )
+    {
+        SyntheticTask task;
+        task.m_typeID = random.GetUInt( 0, ( 1u << g_maxBitsForTaskType ) - 1 );
+        task.m_time = random.GetUInt( 0, 0xFFFF );
+        task.m_weight = random.GetUInt( 0, 0xFF );
+
+        uint32_t const numFields = random.GetUInt( 1, 4 );
+        for ( uint32_t i = 0; i < numFields; i++ )
+        {
+            auto& field = task.m_fields.emplace_back();
+            field.m_numBits = random.GetUInt( 4, 12 );
+            field.m_value = random.GetUInt( 0, ( 1u << field.m_numBits ) - 1 );
+        }
+
+        return task;
+    }
+
+    static void CreateRandomResourceTable( Random& random, TVector<uint32_t>& outResourceTable )
+    {
+        outResourceTable.resize( random.GetUInt( 2, 6 ) );
+        for ( auto& resourceID : outResourceTable )
+        {
+            resourceID = random.Next();
+        }
+    }
+
+    static void UpdateSyntheticStream( Random& random, SyntheticTaskStream& stream )
+    {
+        // Task list changes
+        //-------------------------------------------------------------------------
+
+        if ( random.GetChance( 1.0f ) )
+        {
+            int32_t const numTasks = (int32_t) stream.m_tasks.size();
+            bool const shouldAddTask = ( numTasks == g_minTasks ) || ( numTasks < g_maxTasks && random.GetChance( 50.0f ) );
+            uint32_t const taskIdx = random.GetUInt( 0, numTasks - ( shouldAddTask ? 0 : 1 ) );
+            if ( shouldAddTask )
+            {
+                stream.m_tasks.insert( stream.m_tasks.begin() + taskIdx, CreateRandomTask( random ) );
+            }
+            else
+            {
+                stream.m_tasks.erase( stream.m_tasks.begin() + taskIdx );
+            }
+        }
+
+        // Task data changes
+        //-------------------------------------------------------------------------
+
+        for ( auto& task : stream.m_tasks )
+        {
+            task.m_time = ( task.m_time + 1 + ( task.m_typeID % 3 ) ) & 0xFFFF;
+
+            if ( random.GetChance( 3.0f ) )
+            {
+                task.m_weight = random.GetUInt( 0, 0xFF );
+            }
+
+            if ( random.GetChance( 0.5f ) )
+            {
+                auto& field = task.m_fields[random.GetUInt( 0, (uint32_t) task.m_fields.size() - 1 )];
+                field.m_value = random.GetUInt( 0, ( 1u << field.m_numBits ) - 1 );
+            }
+        }
+
+        // Resource table changes (i.e. external graphs being injected)
+        //-------------------------------------------------------------------------
+
+        if ( random.GetChance( 0.1f ) )
+        {
+            CreateRandomResourceTable( random, stream.m_resourceTable );
+        }
+        else if ( stream.m_resourceTable.size() < g_maxResources && random.GetChance( 0.5f ) )
+        {
+            stream.m_resourceTable.emplace_back( random.Next() );
+        }
+    }
+
+    static void SerializeSyntheticStream( SyntheticTaskStream const& stream, Animation::RecordedGraphFrameData& outFrameData )
+    {
+        Animation::SerializedTaskListLayout& layout = outFrameData.m_serializedTaskLayout;
+
+        TaskDataArchive archive;
+        layout.Clear();
+        layout.m_segmentBitOffsets.emplace_back( (uint16_t) 0 );
+
+        archive.WriteUInt( (uint32_t) stream.m_tasks.size(), 8 );
+        for ( auto const& task : stream.m_tasks )
+        {
+            archive.WriteUInt( task.m_typeID, g_maxBitsForTaskType );
+        }
+
+        for ( auto const& task : stream.m_tasks )
+        {
+            layout.m_segmentBitOffsets.emplace_back( (uint16_t) archive.GetBitPosition() );
+            archive.WriteUInt( task.m_time, 16 );
+            archive.WriteUInt( task.m_weight, 8 );
+            for ( auto const& field : task.m_fields )
+            {
+                archive.WriteUInt( field.m_value, field.m_numBits );
+            }
+        }
+
+        archive.GetWrittenData( outFrameData.m_serializedTaskData );
+        layout.m_segmentBitOffsets.emplace_back( (uint16_t) archive.GetBitPosition() );
+        layout.m_resourceTable = stream.m_resourceTable;
+    }
+
+    static void CreateSyntheticFrames( int32_t numFrames, TVector<Animation::RecordedGraphFrameData>& outFrames )
+    {
+        Random random( 0x2545F491 );
+
+        SyntheticTaskStream stream;
+        stream.m_tasks.resize( random.GetUInt( g_minTasks, g_maxTasks ) );
+        for ( auto& task : stream.m_tasks )
+        {
+            task = CreateRandomTask( random );
+        }
+
+        CreateRandomResourceTable( random, stream.m_resourceTable );
+
+        outFrames.resize( numFrames );
+        for ( auto& frameData : outFrames )
+        {
+            UpdateSyntheticStream( random, stream );
+            SerializeSyntheticStream( stream, frameData );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Replay
+    //-------------------------------------------------------------------------
+
+    // Frames with no task data (i.e. the tasks couldnt be serialized) are skipped
+    static Results ReplayFrames( TVector<Animation::RecordedGraphFrameData> const& frames, float packetLossPercentage, ReplicatedTaskSystem const* pReplicatedTaskSystem )
+    {
+        Results results;
+
+        Random networkRandom( 0x9E3779B9 );
+
+        Animation::TaskStreamEncoder encoder;
+        Animation::TaskStreamDecoder decoder;
+
+        Blob packet;
+        Blob delayedPacket;
+        Blob decodedTaskData;
+        TVector<uint32_t> decodedResourceTable;
+        Blob reserializedTaskData;
+        Animation::SerializedTaskListLayout reserializedLayout;
+
+        int32_t const numFrames = (int32_t) frames.size();
+        for ( int32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+        {
+            Animation::RecordedGraphFrameData const& frameData = frames[frameIdx];
+            if ( frameData.m_serializedTaskData.empty() )
+            {
+                continue;
+            }
+
+            results.m_numFrames++;
+
+            // Encode
+            //-------------------------------------------------------------------------
+
+            Milliseconds elapsedTime = 0.0f;
+            {
+                ScopedTimer<PlatformClock> timer( elapsedTime );
+                encoder.EncodeFrame( frameData.m_serializedTaskData, frameData.m_serializedTaskLayout, packet );
+            }
+            results.m_encodeTime += elapsedTime;
+
+            results.m_totalFullBytes += (int64_t) frameData.m_serializedTaskData.size();
+            results.m_totalPacketBytes += (int64_t) packet.size();
+
+            // Transmit - half of the lost packets arrive late instead
+            //-------------------------------------------------------------------------
+
+            if ( networkRandom.GetChance( packetLossPercentage ) )
+            {
+                results.m_numLostPackets++;
+                if ( networkRandom.GetChance( 50.0f ) )
+                {
+                    delayedPacket = packet;
+                }
+                continue;
+            }
+
+            // Decode
+            //-------------------------------------------------------------------------
+            // Packets are only encoded against baselines that the receiver acknowledged, so every packet that arrives needs to be decodable
+
+            bool wasDecoded = false;
+            {
+                ScopedTimer<PlatformClock> timer( elapsedTime );
+                wasDecoded = decoder.DecodePacket( packet, decodedTaskData, decodedResourceTable );
+            }
+            results.m_decodeTime += elapsedTime;
+
+            if ( !wasDecoded )
+            {
+                results.m_numFailedDecodes++;
+                continue;
+            }
+
+            if ( decodedTaskData != frameData.m_serializedTaskData || decodedResourceTable != frameData.m_serializedTaskLayout.m_resourceTable )
+            {
+                results.m_numMismatches++;
+            }
+
+            // Deserialize the decoded tasks using the replicated resource table, then re-serialize them
+            //-------------------------------------------------------------------------
+
+            else if ( pReplicatedTaskSystem != nullptr )
+            {
+                Animation::TaskSystem* pTaskSystem = pReplicatedTaskSystem->m_pTaskSystem;
+                pTaskSystem->Reset();
+
+                {
+                    ScopedTimer<PlatformClock> timer( elapsedTime );
+                    pTaskSystem->DeserializeTasks( pReplicatedTaskSystem->m_LUTs, decodedTaskData, &decodedResourceTable );
+                }
+                results.m_deserializeTime += elapsedTime;
+
+                pTaskSystem->UpdatePrePhysics( frameData.m_deltaTime, frameData.m_characterWorldTransform, frameData.m_characterWorldTransform.GetInverse() );
+                pTaskSystem->UpdatePostPhysics();
+
+                bool const wasReserialized = pTaskSystem->SerializeTasks( pReplicatedTaskSystem->m_LUTs, reserializedTaskData, &reserializedLayout );
+                if ( !wasReserialized || reserializedTaskData != frameData.m_serializedTaskData || reserializedLayout.m_segmentBitOffsets != frameData.m_serializedTaskLayout.m_segmentBitOffsets || reserializedLayout.m_resourceTable != decodedResourceTable )
+                {
+                    results.m_numReplicatedMismatches++;
+                }
+            }
+
+            // Late and duplicated packets are older than the last decoded packet and need to be rejected
+            //-------------------------------------------------------------------------
+
+            if ( !delayedPacket.empty() )
+            {
+                results.m_numAcceptedStalePackets += decoder.DecodePacket( delayedPacket, decodedTaskData, decodedResourceTable ) ? 1 : 0;
+                delayedPacket.clear();
+            }
+
+            if ( ( frameIdx % 16 ) == 0 )
+            {
+                results.m_numAcceptedStalePackets += decoder.DecodePacket( packet, decodedTaskData, decodedResourceTable ) ? 1 : 0;
+            }
+
+            // Acknowledge - acks are subject to the same loss as packets
+            //-------------------------------------------------------------------------
+
+            if ( !networkRandom.GetChance( packetLossPercentage ) )
+            {
+                encoder.AcknowledgeFrame( decoder.GetLastDecodedSequence() );
+            }
+        }
+
+        return results;
+    }
+
+    static bool ReportResults( char const* pLabel, Results const& results )
+    {
+        int32_t const numFrames = Math::Max( results.m_numFrames, 1 );
+        float const averageFullSize = float( results.m_totalFullBytes ) / numFrames;
+        float const averagePacketSize = float( results.m_totalPacketBytes ) / numFrames;
+        float const ratio = float( results.m_totalPacketBytes ) / Math::Max( results.m_totalFullBytes, int64_t( 1 ) );
+        int32_t const numDecodedPackets = Math::Max( results.m_numFrames - results.m_numLostPackets, 1 );
+
+        std::cout << pLabel << " - Full: " << averageFullSize << " bytes avg, Delta: " << averagePacketSize << " bytes avg (" << ( ratio * 100.0f ) << "% of full)";
+        std::cout << ", Encode: " << ( results.m_encodeTime.ToFloat() * 1000.0f / numFrames ) << "us avg, Decode: " << ( results.m_decodeTime.ToFloat() * 1000.0f / numDecodedPackets ) << "us avg";
+        if ( results.m_deserializeTime > 0.0f )
+        {
+            std::cout << ", Deserialize: " << ( results.m_deserializeTime.ToFloat() * 1000.0f / numDecodedPackets ) << "us avg";
+        }
+        std::cout << ", Lost Packets: " << results.m_numLostPackets << std::endl;
+
+        bool isValid = true;
+
+        if ( results.m_numFailedDecodes > 0 )
+        {
+            std::cout << "Failed to decode " << results.m_numFailedDecodes << " received packets!" << std::endl;
+            isValid = false;
+        }
+
+        if ( results.m_numMismatches > 0 )
+        {
+            std::cout << results.m_numMismatches << " decoded frames didnt match the sent task data!" << std::endl;
+            isValid = false;
+        }
+
+        if ( results.m_numReplicatedMismatches > 0 )
+        {
+            std::cout << results.m_numReplicatedMismatches << " decoded frames didnt re-serialize to the sent task data!" << std::endl;
+            isValid = false;
+        }
+
+        if ( results.m_numAcceptedStalePackets > 0 )
+        {
+            std::cout << "Accepted " << results.m_numAcceptedStalePackets << " late or duplicated packets!" << std::endl;
+            isValid = false;
+        }
+
+        return isValid;
+    }
+
+    //-------------------------------------------------------------------------
+    // Recording
+    //-------------------------------------------------------------------------
+
+    // IDs and targets are left untouched since we cant know which values are valid for the graph
+    static void RandomizeControlParameters( Random& random, Animation::GraphInstance& graphInstance )
+    {
+        using namespace Animation;
+
+        int32_t const numParameters = graphInstance.GetNumControlParameters();
+        for ( int16_t parameterIdx = 0; parameterIdx < numParameters; parameterIdx++ )
+        {
+            switch ( graphInstance.GetControlParameterType( parameterIdx ) )
+            {
+                case GraphValueType::Bool:
+                {
+                    graphInstance.SetControlParameterValue<bool>( parameterIdx, random.GetChance( 50.0f ) );
+                }
+                break;
+
+                case GraphValueType::Float:
+                {
+                    graphInstance.SetControlParameterValue<float>( parameterIdx, random.GetFloat( 0.0f, 1.0f ) );
+                }
+                break;
+
+                case GraphValueType::Vector:
+                {
+                    graphInstance.SetControlParameterValue<Vector>( parameterIdx, Vector( random.GetFloat( -1.0f, 1.0f ), random.GetFloat( -1.0f, 1.0f ), 0.0f ) );
+                }
+                break;
+
+                default:
+                break;
+            }
+        }
+    }
+
+    static bool RecordAndReplayGraph( TypeSystem::TypeRegistry const& typeRegistry, Animation::GraphVariation const* pGraphVariation )
+    {
+        using namespace Animation;
+
+        // Record
+        //-------------------------------------------------------------------------
+
+        GraphRecorder recorder;
+        GraphInstance graphInstance( pGraphVariation, 1 );
+        graphInstance.EnableTaskSystemSerialization( typeRegistry );
+        graphInstance.StartRecording( &recorder );
+
+        Random random( 0x2545F491 );
+        for ( int32_t frameIdx = 0; frameIdx < g_numRecordedFrames; frameIdx++ )
+        {
+            if ( ( frameIdx % g_numFramesBetweenParameterChanges ) == 0 )
+            {
+                RandomizeControlParameters( random, graphInstance );
+            }
+
+            graphInstance.EvaluateGraph( g_frameDeltaTime, Transform::Identity, nullptr, nullptr );
+            graphInstance.ExecutePrePhysicsPoseTasks( Transform::Identity );
+            graphInstance.ExecutePostPhysicsPoseTasks();
+        }
+
+        graphInstance.StopRecording();
+
+        int32_t numSerializedFrames = 0;
+        for ( auto const& frameData : recorder.m_recordedData )
+        {
+            numSerializedFrames += frameData.m_serializedTaskData.empty() ? 0 : 1;
+        }
+
+        std::cout << "Recorded Graph: " << pGraphVariation->GetResourceID().c_str() << " (" << recorder.GetNumRecordedFrames() << " frames, " << numSerializedFrames << " with serializable tasks)" << std::endl;
+
+        if ( numSerializedFrames == 0 )
+        {
+            std::cout << "The recorded graph didnt generate any serializable tasks!" << std::endl;
+            return false;
+        }
+
+        // Replay
+        //-------------------------------------------------------------------------
+
+        Animation::TaskSystem replicatedTaskSystem( pGraphVariation->GetSkeleton() );
+        replicatedTaskSystem.EnableSerialization( typeRegistry );
+
+        ReplicatedTaskSystem replicated;
+        replicated.m_pTaskSystem = &replicatedTaskSystem;
+        graphInstance.GetResourceLookupTables( replicated.m_LUTs );
+
+        bool isValid = true;
+        for ( float packetLossPercentage : { 0.0f, 10.0f, 30.0f, 60.0f } )
+        {
+            char label[32];
+            Printf( label, 32, "Packet Loss %.0f%%", packetLossPercentage );
+            isValid &= ReportResults( label, ReplayFrames( recorder.m_recordedData, packetLossPercentage, &replicated ) );
+        }
+
+        return isValid;
+    }
+
+    //-------------------------------------------------------------------------
+
+    static int Run( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& compiledResourcePath, ResourceID const& graphVariationID )
+    {
+        bool isValid = true;
+
+        // Load the graph from the compiled data
+        //-------------------------------------------------------------------------
+
+        TaskSystem taskSystem( Threading::GetProcessorInfo().m_numPhysicalCores - 1 );
+        taskSystem.Initialize();
+
+        Resource::ResourceSettings settings;
+        settings.m_compiledResourcePath = compiledResourcePath;
+        settings.m_compiledResourcePath.MakeIntoDirectoryPath();
+
+        Resource::ResourceProvider* pResourceProvider = EE::New<Resource::PackagedResourceProvider>( settings );
+        if ( !pResourceProvider->Initialize() )
+        {
+            std::cout << "Failed to initialize the resource provider for: " << settings.m_compiledResourcePath.c_str() << std::endl;
+            EE::Delete( pResourceProvider );
+            taskSystem.Shutdown();
+            return 1;
+        }
+
+        Resource::ResourceSystem resourceSystem( taskSystem );
+        resourceSystem.Initialize( pResourceProvider );
+
+        Animation::SkeletonLoader skeletonLoader;
+        Animation::AnimationClipLoader animationClipLoader;
+        Animation::GraphLoader graphLoader;
+        animationClipLoader.SetTypeRegistryPtr( &typeRegistry );
+        graphLoader.SetTypeRegistryPtr( &typeRegistry );
+        resourceSystem.RegisterResourceLoader( &skeletonLoader );
+        resourceSystem.RegisterResourceLoader( &animationClipLoader );
+        resourceSystem.RegisterResourceLoader( &graphLoader );
+
+        TResourcePtr<Animation::GraphVariation> graphVariation( graphVariationID );
+        resourceSystem.LoadResource( graphVariation );
+        resourceSystem.WaitForAllRequestsToComplete();
+
+        // Record and replay the graph
+        //-------------------------------------------------------------------------
+
+        if ( graphVariation.IsLoaded() )
+        {
+            isValid &= RecordAndReplayGraph( typeRegistry, graphVariation.GetPtr() );
+        }
+        else
+        {
+            std::cout << "Failed to load graph variation: " << graphVariationID.c_str() << " from " << settings.m_compiledResourcePath.c_str() << std::endl;
+            isValid = false;
+        }
+
+        resourceSystem.UnloadResource( graphVariation );
+        resourceSystem.WaitForAllRequestsToComplete();
+
+        resourceSystem.UnregisterResourceLoader( &graphLoader );
+        resourceSystem.UnregisterResourceLoader( &animationClipLoader );
+        resourceSystem.UnregisterResourceLoader( &skeletonLoader );
+        graphLoader.ClearTypeRegistryPtr();
+        animationClipLoader.ClearTypeRegistryPtr();
+
+        resourceSystem.Shutdown();
+        pResourceProvider->Shutdown();
+        EE::Delete( pResourceProvider );
+        taskSystem.Shutdown();
+
+        // Synthetic stream
+        //-------------------------------------------------------------------------
+
+        TVector<Animation::RecordedGraphFrameData> syntheticFrames;
+        CreateSyntheticFrames( g_numSyntheticFrames, syntheticFrames );
+        isValid &= ReportResults( "Synthetic Stream (10% Packet Loss, Sequence Wrap)", ReplayFrames( syntheticFrames, 10.0f, nullptr ) );
+
+        if ( !isValid )
+        {
+            std::cout << "Delta task stream failed validation!" << std::endl;
+        }
+
+        return isValid ? 0 : 1;
+    }
+}
+#endif
+
+//-------------------------------------------------------------------------
+
+static int RunRenderSubmitBenchmark()
+{
+    Render::RenderDevice renderDevice;
+    if ( !renderDevice.Initialize() )
+    {
+        std::cout << "Failed to initialize render device" << std::endl;
+        return 1;
+    }
+
+    TaskSystem taskSystem( Threading::GetProcessorInfo().m_numPhysicalCores - 1 );
+    taskSystem.Initialize();
+
+    Render::RenderSubmitBenchmark::Settings settings;
+    Render::RenderSubmitBenchmark::Results results;
+    bool const result = Render::RenderSubmitBenchmark::Run( &renderDevice, settings, results, &taskSystem );
+    if ( result )
+    {
+        std::cout << "Render Submit (" << results.m_numFrames << " frames) - Avg: " << results.m_averageSubmitTime.ToFloat() << "ms, Median: " << results.m_medianSubmitTime.ToFloat() << "ms, Min: " << results.m_minSubmitTime.ToFloat() << "ms, Max: " << results.m_maxSubmitTime.ToFloat() << "ms" << std::endl;
+
+        Render::DrawStats const& drawStats = results.m_drawStats;
+        std::cout << "Sections: " << drawStats.m_numSections << ", Draws: " << drawStats.m_numDraws << ", Instances Merged: " << drawStats.m_numInstancesMerged << std::endl;
+        std::cout << "Material Binds: " << drawStats.m_numMaterialBinds << " (Skipped: " << drawStats.m_numMaterialBindsSkipped << "), Mesh Binds: " << drawStats.m_numMeshBinds << " (Skipped: " << drawStats.m_numMeshBindsSkipped << ")" << std::endl;
+
+        Render::LightClusterGrid::Stats const& clusterStats = results.m_lightClusterStats;
+        std::cout << "Light Binning - Avg: " << results.m_averageLightBinningTime.ToFloat() << "ms, Median: " << results.m_medianLightBinningTime.ToFloat() << "ms" << std::endl;
+        std::cout << "Lights: " << clusterStats.m_numLights << " (Visible: " << clusterStats.m_numVisibleLights << "), Light Indices: " << clusterStats.m_numLightIndices << ", Max Lights Per Cluster: " << clusterStats.m_maxLightsPerCluster << ", Empty Clusters: " << clusterStats.m_numEmptyClusters << std::endl;
+
+        #if EE_RENDER_NULL_DEVICE
+        Render::RenderStats const& stats = results.m_stats;
+        std::cout << "Device Draws: " << stats.m_numDrawCalls << ", Instances: " << stats.m_numInstances << ", Dispatches: " << stats.m_numDispatches << ", Vertices: " << stats.m_numVertices << std::endl;
+        std::cout << "State Changes: " << stats.m_numStateChanges << ", Redundant: " << stats.m_numRedundantStateChanges << std::endl;
+        std::cout << "Buffer Writes: " << stats.m_numBufferWrites << ", Bytes Uploaded: " << stats.m_numBytesUploaded << std::endl;
+        #endif
+    }
+
+    taskSystem.Shutdown();
+    renderDevice.Shutdown();
+    return result ? 0 : 1;
+}
+#endif
+
+//-------------------------------------------------------------------------
+
+// Compares whole frame times when rendering synchronously and when rendering while the next frame is simulated
+#if EE_DEVELOPMENT_TOOLS
+static int RunRenderPipelineBenchmark()
+{
+    Render::RenderDevice renderDevice;
+    if ( !renderDevice.Initialize() )
+    {
+        std::cout << "Failed to initialize render device" << std::endl;
+        return 1;
+    }
+
+    TaskSystem taskSystem( Threading::GetProcessorInfo().m_numPhysicalCores - 1 );
+    taskSystem.Initialize();
+
+    Render::RenderSubmitBenchmark::Settings settings;
+    Render::RenderSubmitBenchmark::PipelineResults results;
+    bool const result = Render::RenderSubmitBenchmark::RunPipelined( &renderDevice, settings, results, &taskSystem );
+    if ( result )
+    {
+        std::cout << "Render Pipeline (" << results.m_numFrames << " frames, " << settings.m_simulationTime.ToFloat() << "ms simulation)" << std::endl;
+
+        auto PrintTimings = [] ( char const* pLabel, Render::RenderSubmitBenchmark::PipelineResults::Timings const& timings )
+        {
+            std::cout << pLabel << " - Frame Avg: " << timings.m_averageFrameTime.ToFloat() << "ms, Median: " << timings.m_medianFrameTime.ToFloat() << "ms, Max: " << timings.m_maxFrameTime.ToFloat() << "ms";
+            std::cout << ", Extraction: " << timings.m_averageExtractionTime.ToFloat() << "ms, Wait: " << timings.m_averageWaitTime.ToFloat() << "ms, Render: " << timings.m_averageRenderTime.ToFloat() << "ms, Pipelined Frames: " << timings.m_numPipelinedFrames << std::endl;
+        };
+
+        PrintTimings( "Synchronous", results.m_synchronous );
+        PrintTimings( "Pipelined", results.m_pipelined );
+    }
+
+    taskSystem.Shutdown();
+    renderDevice.Shutdown();
+    return result ? 0 : 1;
+}
+#endif
+
+//-------------------------------------------------------------------------
+
 int main( int argc, char *argv[] )
 {
     {
@@ -55,6 +3716,146 @@ int main( int argc, char *argv[] )
 
         //-------------------------------------------------------------------------
 
+        for ( int32_t i = 1; i < argc; i++ )
+        {
+            if ( strcmp( argv[i], "-simdbenchmark" ) == 0 )
+            {
+                int const result = WideMathBenchmark::Run();
+                AutoGenerated::Tools::UnregisterTypes( typeRegistry );
+                return result;
+            }
+        }
+
+        for ( int32_t i = 1; i < argc; i++ )
+        {
+            if ( strcmp( argv[i], "-componentroutingbenchmark" ) == 0 )
+            {
+                int const result = ComponentRoutingBenchmark::Run( typeRegistry );
+                AutoGenerated::Tools::UnregisterTypes( typeRegistry );
+                return result;
+            }
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        for ( int32_t i = 1; i < argc; i++ )
+        {
+            if ( strcmp( argv[i], "-renderbenchmark" ) == 0 )
+            {
+                int const result = RunRenderSubmitBenchmark();
+                AutoGenerated::Tools::UnregisterTypes( typeRegistry );
+                return result;
+            }
+
+            if ( strcmp( argv[i], "-renderpipelinebenchmark" ) == 0 )
+            {
+                int const result = RunRenderPipelineBenchmark();
+                AutoGenerated::Tools::UnregisterTypes( typeRegistry );
+                return result;
+            }
+
+            if ( strcmp( argv[i], "-componentpoolbenchmark" ) == 0 )
+            {
+                int const result = ComponentPoolBenchmark::Run( typeRegistry );
+                AutoGenerated::Tools::UnregisterTypes( typeRegistry );
+                return result;
+            }
+
+            if ( strcmp( argv[i], "-entityspawnbenchmark" ) == 0 )
+            {
+                int const result = EntitySpawnBenchmark::Run( typeRegistry );
+                AutoGenerated::Tools::UnregisterTypes( typeRegistry );
+                return result;
+            }
+
+            if ( strcmp( argv[i], "-componentactivationbenchmark" ) == 0 )
+            {
+                int const result = ComponentActivationBenchmark::Run( typeRegistry );
+                AutoGenerated::Tools::UnregisterTypes( typeRegistry );
+                return result;
+            }
+
+            if ( strcmp( argv[i], "-entityundobenchmark" ) == 0 )
+            {
+                int const result = EntityUndoBenchmark::Run( typeRegistry );
+                AutoGenerated::Tools::UnregisterTypes( typeRegistry );
+                return result;
+            }
+
+            if ( strcmp( argv[i], "-resourcedatabasebenchmark" ) == 0 )
+            {
+                int const result = ResourceDatabaseBenchmark::Run( typeRegistry );
+                AutoGenerated::Tools::UnregisterTypes( typeRegistry );
+                return result;
+            }
+
+            // Usage: -rawassetbenchmark <source file> [-skeletal]
+            if ( strcmp( argv[i], "-rawassetbenchmark" ) == 0 && ( i + 1 ) < argc )
+            {
+                bool isSkeletalMesh = false;
+                for ( int32_t j = i + 2; j < argc; j++ )
+                {
+                    isSkeletalMesh |= ( strcmp( argv[j], "-skeletal" ) == 0 );
+                }
+
+                int const result = RawAssetImportBenchmark::Run( FileSystem::Path( argv[i + 1] ), isSkeletalMesh );
+                AutoGenerated::Tools::UnregisterTypes( typeRegistry );
+                return result;
+            }
+
+            if ( strcmp( argv[i], "-meshletbenchmark" ) == 0 )
+            {
+                int const result = MeshletCullingBenchmark::Run();
+                AutoGenerated::Tools::UnregisterTypes( typeRegistry );
+                return result;
+            }
+
+            if ( strcmp( argv[i], "-lightclustertest" ) == 0 )
+            {
+                int const result = LightClusterTest::Run();
+                AutoGenerated::Tools::UnregisterTypes( typeRegistry );
+                return result;
+            }
+
+            if ( strcmp( argv[i], "-meshlodbenchmark" ) == 0 )
+            {
+                int const result = MeshLODBenchmark::Run();
+                AutoGenerated::Tools::UnregisterTypes( typeRegistry );
+                return result;
+            }
+
+            if ( strcmp( argv[i], "-vertexcompressionbenchmark" ) == 0 )
+            {
+                int const result = VertexCompressionBenchmark::Run();
+                AutoGenerated::Tools::UnregisterTypes( typeRegistry );
+                return result;
+            }
+
+            if ( strcmp( argv[i], "-globalposebenchmark" ) == 0 )
+            {
+                int const result = GlobalPoseBenchmark::Run();
+                AutoGenerated::Tools::UnregisterTypes( typeRegistry );
+                return result;
+            }
+
+            if ( strcmp( argv[i], "-poseblendbenchmark" ) == 0 )
+            {
+                int const result = PoseBlendBenchmark::Run();
+                AutoGenerated::Tools::UnregisterTypes( typeRegistry );
+                return result;
+            }
+
+            // Usage: -taskstreambenchmark <compiled resource path> <graph variation resource path>
+            if ( strcmp( argv[i], "-taskstreambenchmark" ) == 0 && ( i + 2 ) < argc )
+            {
+                int const result = TaskStreamBenchmark::Run( typeRegistry, FileSystem::Path( argv[i + 1] ), ResourceID( argv[i + 2] ) );
+                AutoGenerated::Tools::UnregisterTypes( typeRegistry );
+                return result;
+            }
+        }
+        #endif
+
+        //-------------------------------------------------------------------------
+
         constexpr static int32_t const size = 10000;
 
         Float4 s[size];
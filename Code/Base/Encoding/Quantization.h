@@ -84,6 +84,42 @@ namespace EE::Quantization
         return decodedValue;
     }
 
+    //-------------------------------------------------------------------------
+    // Half float
+    //-------------------------------------------------------------------------
+    // 32 bit float to IEEE 754 16bit float, values are rounded to nearest and denormals are flushed to zero
+
+    inline uint16_t EncodeHalfFloat( float value )
+    {
+        uint32_t bits;
+        memcpy( &bits, &value, sizeof( float ) );
+
+        int32_t const sign = ( bits >> 16 ) & 0x8000;
+        int32_t const exponentAndMantissa = bits & 0x7FFFFFFF;
+
+        // Re-bias the exponent (127 - 15 = 112) and round the mantissa
+        int32_t encodedValue = ( exponentAndMantissa - ( 112 << 23 ) + ( 1 << 12 ) ) >> 13;
+        encodedValue = ( exponentAndMantissa < ( 113 << 23 ) ) ? 0 : encodedValue;         // Underflow
+        encodedValue = ( exponentAndMantissa >= ( 143 << 23 ) ) ? 0x7C00 : encodedValue;   // Overflow -> infinity
+        encodedValue = ( exponentAndMantissa > ( 255 << 23 ) ) ? 0x7E00 : encodedValue;    // NaN
+        return uint16_t( sign | encodedValue );
+    }
+
+    inline float DecodeHalfFloat( uint16_t encodedValue )
+    {
+        uint32_t const sign = uint32_t( encodedValue & 0x8000 ) << 16;
+        int32_t const exponentAndMantissa = encodedValue & 0x7FFF;
+
+        int32_t bits = ( exponentAndMantissa + ( 112 << 10 ) ) << 13;
+        bits = ( exponentAndMantissa < ( 1 << 10 ) ) ? 0 : bits;                            // Denormal
+        bits += ( exponentAndMantissa >= ( 31 << 10 ) ) ? ( 112 << 23 ) : 0;                // Infinity/NaN
+
+        uint32_t const decodedBits = sign | (uint32_t) bits;
+        float value;
+        memcpy( &value, &decodedBits, sizeof( float ) );
+        return value;
+    }
+
     //-------------------------------------------------------------------------
     // Quaternion Encoding
     //-------------------------------------------------------------------------
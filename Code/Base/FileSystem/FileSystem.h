@@ -61,6 +61,10 @@ namespace EE::FileSystem
 
     EE_BASE_API bool LoadFile( char const* filePath, Blob& fileData );
     EE_FORCE_INLINE bool LoadFile( String const& filePath, Blob& fileData ) { return LoadFile( filePath.c_str(), fileData ); }
+
+    // Writes the data to the specified file, overwriting any existing file. The parent directory must already exist
+    EE_BASE_API bool SaveFile( char const* filePath, Blob const& fileData );
+    EE_FORCE_INLINE bool SaveFile( String const& filePath, Blob const& fileData ) { return SaveFile( filePath.c_str(), fileData ); }
     
     // Directory Functions
     //-------------------------------------------------------------------------
@@ -236,6 +236,12 @@ namespace EE::FileSystem
         return LoadFile( filePath.c_str(), fileData );
     }
 
+    EE_FORCE_INLINE bool SaveFile( Path const& filePath, Blob const& fileData )
+    {
+        EE_ASSERT( filePath.IsFilePath() );
+        return SaveFile( filePath.c_str(), fileData );
+    }
+
     EE_FORCE_INLINE bool CreateDir( Path const& path ) { EE_ASSERT( path.IsDirectoryPath() ); return CreateDir( path.c_str() ); }
     EE_FORCE_INLINE bool EraseDir( Path const& path ){ EE_ASSERT( path.IsDirectoryPath() ); return EraseDir( path.c_str() ); }
 }
@@ -192,6 +192,40 @@ namespace EE::FileSystem
         CloseHandle( hFile );
         return true;
     }
+
+    bool SaveFile( char const* pPath, Blob const& fileData )
+    {
+        EE_ASSERT( pPath != nullptr );
+
+        // Open file handle
+        HANDLE hFile = CreateFile( pPath, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr );
+        if ( hFile == INVALID_HANDLE_VALUE )
+        {
+            return false;
+        }
+
+        // Write file
+        static constexpr DWORD const defaultWriteBufferSize = 65536;
+        DWORD bytesWritten = 0;
+        DWORD remainingBytesToWrite = (DWORD) fileData.size();
+
+        uint8_t const* pBuffer = fileData.data();
+        while ( remainingBytesToWrite != 0 )
+        {
+            DWORD const numBytesToWrite = Math::Min( defaultWriteBufferSize, remainingBytesToWrite );
+            if ( !WriteFile( hFile, pBuffer, numBytesToWrite, &bytesWritten, nullptr ) )
+            {
+                CloseHandle( hFile );
+                return false;
+            }
+
+            pBuffer += bytesWritten;
+            remainingBytesToWrite -= bytesWritten;
+        }
+
+        CloseHandle( hFile );
+        return true;
+    }
 }
 
 #endif
\ No newline at end of file
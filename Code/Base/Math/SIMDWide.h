@@ -0,0 +1,879 @@
+#pragma once
+
+#include "Base/Math/Transform.h"
+#include <immintrin.h>
+
+//-------------------------------------------------------------------------
+// Wide SIMD Math
+//-------------------------------------------------------------------------
+// Structure-of-arrays (SoA) versions of the core math types that operate on 4 or 8 values at once
+// Every component is stored in its own register, i.e. a Vector4x stores the X components of 4 vectors in a single register
+//
+// These are meant for hot loops over large arrays (bones, instances, etc...): load a batch from the regular AoS arrays, operate on it and store it back
+// The 8-wide types use AVX when the build targets it (/arch:AVX or /arch:AVX2), otherwise every 8-wide operation is done as two SSE halves
+// Use the 'Wide' aliases to get the widest type supported by the build
+//
+// All operations match the results of the scalar types (within float precision) unless stated otherwise
+
+#if defined( __AVX__ ) || defined( __AVX2__ )
+    #define EE_SIMD_AVX 1
+#else
+    #define EE_SIMD_AVX 0
+#endif
+
+#if defined( __FMA__ ) || defined( __AVX2__ )
+    #define EE_SIMD_FMA 1
+#else
+    #define EE_SIMD_FMA 0
+#endif
+
+//-------------------------------------------------------------------------
+// Lane Types
+//-------------------------------------------------------------------------
+// Masks are stored as floats with all bits set for true lanes, as returned by the comparison operations
+
+namespace EE::SIMD
+{
+    struct Float4x
+    {
+        constexpr static uint32_t const s_width = 4;
+
+        EE_FORCE_INLINE static Float4x Zero() { return _mm_setzero_ps(); }
+        EE_FORCE_INLINE static Float4x One() { return _mm_set1_ps( 1.0f ); }
+        EE_FORCE_INLINE static Float4x Load( float const* pValues ) { return _mm_loadu_ps( pValues ); }
+
+    public:
+
+        Float4x() = default;
+        EE_FORCE_INLINE Float4x( __m128 v ) : m_data( v ) {}
+        EE_FORCE_INLINE explicit Float4x( float v ) : m_data( _mm_set1_ps( v ) ) {}
+
+        EE_FORCE_INLINE void Store( float* pValues ) const { _mm_storeu_ps( pValues, m_data ); }
+        EE_FORCE_INLINE float GetLane( uint32_t i ) const { EE_ASSERT( i < s_width ); alignas( 16 ) float v[4]; _mm_store_ps( v, m_data ); return v[i]; }
+
+        // Returns a bit per lane, set if the sign bit (i.e. the mask) is set
+        EE_FORCE_INLINE uint32_t GetMask() const { return (uint32_t) _mm_movemask_ps( m_data ); }
+
+        EE_FORCE_INLINE Float4x operator+( Float4x const& rhs ) const { return _mm_add_ps( m_data, rhs.m_data ); }
+        EE_FORCE_INLINE Float4x operator-( Float4x const& rhs ) const { return _mm_sub_ps( m_data, rhs.m_data ); }
+        EE_FORCE_INLINE Float4x operator*( Float4x const& rhs ) const { return _mm_mul_ps( m_data, rhs.m_data ); }
+        EE_FORCE_INLINE Float4x operator/( Float4x const& rhs ) const { return _mm_div_ps( m_data, rhs.m_data ); }
+        EE_FORCE_INLINE Float4x operator-() const { return _mm_xor_ps( m_data, _mm_set1_ps( -0.0f ) ); }
+        EE_FORCE_INLINE Float4x& operator+=( Float4x const& rhs ) { m_data = _mm_add_ps( m_data, rhs.m_data ); return *this; }
+        EE_FORCE_INLINE Float4x& operator-=( Float4x const& rhs ) { m_data = _mm_sub_ps( m_data, rhs.m_data ); return *this; }
+        EE_FORCE_INLINE Float4x& operator*=( Float4x const& rhs ) { m_data = _mm_mul_ps( m_data, rhs.m_data ); return *this; }
+
+    public:
+
+        __m128 m_data;
+    };
+
+    // result = ( a * b ) + c
+    EE_FORCE_INLINE Float4x MultiplyAdd( Float4x const& a, Float4x const& b, Float4x const& c )
+    {
+        #if EE_SIMD_FMA
+        return _mm_fmadd_ps( a.m_data, b.m_data, c.m_data );
+        #else
+        return _mm_add_ps( _mm_mul_ps( a.m_data, b.m_data ), c.m_data );
+        #endif
+    }
+
+    // result = ( a * b ) - c
+    EE_FORCE_INLINE Float4x MultiplySubtract( Float4x const& a, Float4x const& b, Float4x const& c )
+    {
+        #if EE_SIMD_FMA
+        return _mm_fmsub_ps( a.m_data, b.m_data, c.m_data );
+        #else
+        return _mm_sub_ps( _mm_mul_ps( a.m_data, b.m_data ), c.m_data );
+        #endif
+    }
+
+    EE_FORCE_INLINE Float4x Min( Float4x const& a, Float4x const& b ) { return _mm_min_ps( a.m_data, b.m_data ); }
+    EE_FORCE_INLINE Float4x Max( Float4x const& a, Float4x const& b ) { return _mm_max_ps( a.m_data, b.m_data ); }
+    EE_FORCE_INLINE Float4x Abs( Float4x const& a ) { return _mm_andnot_ps( _mm_set1_ps( -0.0f ), a.m_data ); }
+    EE_FORCE_INLINE Float4x Sqrt( Float4x const& a ) { return _mm_sqrt_ps( a.m_data ); }
+    EE_FORCE_INLINE Float4x Reciprocal( Float4x const& a ) { return _mm_div_ps( _mm_set1_ps( 1.0f ), a.m_data ); }
+    EE_FORCE_INLINE Float4x ReciprocalSqrt( Float4x const& a ) { return _mm_div_ps( _mm_set1_ps( 1.0f ), _mm_sqrt_ps( a.m_data ) ); }
+
+    EE_FORCE_INLINE Float4x And( Float4x const& a, Float4x const& b ) { return _mm_and_ps( a.m_data, b.m_data ); }
+    EE_FORCE_INLINE Float4x Or( Float4x const& a, Float4x const& b ) { return _mm_or_ps( a.m_data, b.m_data ); }
+    EE_FORCE_INLINE Float4x Xor( Float4x const& a, Float4x const& b ) { return _mm_xor_ps( a.m_data, b.m_data ); }
+    EE_FORCE_INLINE Float4x AndNot( Float4x const& a, Float4x const& b ) { return _mm_andnot_ps( a.m_data, b.m_data ); } // ~a & b
+
+    EE_FORCE_INLINE Float4x LessThan( Float4x const& a, Float4x const& b ) { return _mm_cmplt_ps( a.m_data, b.m_data ); }
+    EE_FORCE_INLINE Float4x LessThanEqual( Float4x const& a, Float4x const& b ) { return _mm_cmple_ps( a.m_data, b.m_data ); }
+    EE_FORCE_INLINE Float4x GreaterThan( Float4x const& a, Float4x const& b ) { return _mm_cmpgt_ps( a.m_data, b.m_data ); }
+    EE_FORCE_INLINE Float4x GreaterThanEqual( Float4x const& a, Float4x const& b ) { return _mm_cmpge_ps( a.m_data, b.m_data ); }
+    EE_FORCE_INLINE Float4x Equal( Float4x const& a, Float4x const& b ) { return _mm_cmpeq_ps( a.m_data, b.m_data ); }
+
+    // Per lane select: mask set means select from v1, same as Vector::Select
+    EE_FORCE_INLINE Float4x Select( Float4x const& v0, Float4x const& v1, Float4x const& mask ) { return _mm_or_ps( _mm_andnot_ps( mask.m_data, v0.m_data ), _mm_and_ps( mask.m_data, v1.m_data ) ); }
+
+    // Get the sign bit of each lane (-0.0f for negative lanes, 0.0f otherwise)
+    EE_FORCE_INLINE Float4x GetSignBits( Float4x const& a ) { return _mm_and_ps( a.m_data, _mm_set1_ps( -0.0f ) ); }
+
+    // Transpose 4 groups of 4 floats ( each 'stride' floats apart ) into 4 registers and back
+    EE_FORCE_INLINE void LoadTransposed( float const* pFirst, size_t stride, Float4x& outX, Float4x& outY, Float4x& outZ, Float4x& outW )
+    {
+        __m128 r0 = _mm_loadu_ps( pFirst );
+        __m128 r1 = _mm_loadu_ps( pFirst + stride );
+        __m128 r2 = _mm_loadu_ps( pFirst + stride * 2 );
+        __m128 r3 = _mm_loadu_ps( pFirst + stride * 3 );
+        _MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+        outX = r0; outY = r1; outZ = r2; outW = r3;
+    }
+
+    EE_FORCE_INLINE void StoreTransposed( float* pFirst, size_t stride, Float4x const& x, Float4x const& y, Float4x const& z, Float4x const& w )
+    {
+        __m128 r0 = x.m_data, r1 = y.m_data, r2 = z.m_data, r3 = w.m_data;
+        _MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+        _mm_storeu_ps( pFirst, r0 );
+        _mm_storeu_ps( pFirst + stride, r1 );
+        _mm_storeu_ps( pFirst + stride * 2, r2 );
+        _mm_storeu_ps( pFirst + stride * 3, r3 );
+    }
+
+    //-------------------------------------------------------------------------
+
+    #if EE_SIMD_AVX
+    struct Float8x
+    {
+        constexpr static uint32_t const s_width = 8;
+
+        EE_FORCE_INLINE static Float8x Zero() { return _mm256_setzero_ps(); }
+        EE_FORCE_INLINE static Float8x One() { return _mm256_set1_ps( 1.0f ); }
+        EE_FORCE_INLINE static Float8x Load( float const* pValues ) { return _mm256_loadu_ps( pValues ); }
+
+    public:
+
+        Float8x() = default;
+        EE_FORCE_INLINE Float8x( __m256 v ) : m_data( v ) {}
+        EE_FORCE_INLINE explicit Float8x( float v ) : m_data( _mm256_set1_ps( v ) ) {}
+
+        EE_FORCE_INLINE void Store( float* pValues ) const { _mm256_storeu_ps( pValues, m_data ); }
+        EE_FORCE_INLINE float GetLane( uint32_t i ) const { EE_ASSERT( i < s_width ); alignas( 32 ) float v[8]; _mm256_store_ps( v, m_data ); return v[i]; }
+        EE_FORCE_INLINE uint32_t GetMask() const { return (uint32_t) _mm256_movemask_ps( m_data ); }
+
+        EE_FORCE_INLINE Float8x operator+( Float8x const& rhs ) const { return _mm256_add_ps( m_data, rhs.m_data ); }
+        EE_FORCE_INLINE Float8x operator-( Float8x const& rhs ) const { return _mm256_sub_ps( m_data, rhs.m_data ); }
+        EE_FORCE_INLINE Float8x operator*( Float8x const& rhs ) const { return _mm256_mul_ps( m_data, rhs.m_data ); }
+        EE_FORCE_INLINE Float8x operator/( Float8x const& rhs ) const { return _mm256_div_ps( m_data, rhs.m_data ); }
+        EE_FORCE_INLINE Float8x operator-() const { return _mm256_xor_ps( m_data, _mm256_set1_ps( -0.0f ) ); }
+        EE_FORCE_INLINE Float8x& operator+=( Float8x const& rhs ) { m_data = _mm256_add_ps( m_data, rhs.m_data ); return *this; }
+        EE_FORCE_INLINE Float8x& operator-=( Float8x const& rhs ) { m_data = _mm256_sub_ps( m_data, rhs.m_data ); return *this; }
+        EE_FORCE_INLINE Float8x& operator*=( Float8x const& rhs ) { m_data = _mm256_mul_ps( m_data, rhs.m_data ); return *this; }
+
+    public:
+
+        __m256 m_data;
+    };
+
+    EE_FORCE_INLINE Float8x MultiplyAdd( Float8x const& a, Float8x const& b, Float8x const& c )
+    {
+        #if EE_SIMD_FMA
+        return _mm256_fmadd_ps( a.m_data, b.m_data, c.m_data );
+        #else
+        return _mm256_add_ps( _mm256_mul_ps( a.m_data, b.m_data ), c.m_data );
+        #endif
+    }
+
+    EE_FORCE_INLINE Float8x MultiplySubtract( Float8x const& a, Float8x const& b, Float8x const& c )
+    {
+        #if EE_SIMD_FMA
+        return _mm256_fmsub_ps( a.m_data, b.m_data, c.m_data );
+        #else
+        return _mm256_sub_ps( _mm256_mul_ps( a.m_data, b.m_data ), c.m_data );
+        #endif
+    }
+
+    EE_FORCE_INLINE Float8x Min( Float8x const& a, Float8x const& b ) { return _mm256_min_ps( a.m_data, b.m_data ); }
+    EE_FORCE_INLINE Float8x Max( Float8x const& a, Float8x const& b ) { return _mm256_max_ps( a.m_data, b.m_data ); }
+    EE_FORCE_INLINE Float8x Abs( Float8x const& a ) { return _mm256_andnot_ps( _mm256_set1_ps( -0.0f ), a.m_data ); }
+    EE_FORCE_INLINE Float8x Sqrt( Float8x const& a ) { return _mm256_sqrt_ps( a.m_data ); }
+    EE_FORCE_INLINE Float8x Reciprocal( Float8x const& a ) { return _mm256_div_ps( _mm256_set1_ps( 1.0f ), a.m_data ); }
+    EE_FORCE_INLINE Float8x ReciprocalSqrt( Float8x const& a ) { return _mm256_div_ps( _mm256_set1_ps( 1.0f ), _mm256_sqrt_ps( a.m_data ) ); }
+
+    EE_FORCE_INLINE Float8x And( Float8x const& a, Float8x const& b ) { return _mm256_and_ps( a.m_data, b.m_data ); }
+    EE_FORCE_INLINE Float8x Or( Float8x const& a, Float8x const& b ) { return _mm256_or_ps( a.m_data, b.m_data ); }
+    EE_FORCE_INLINE Float8x Xor( Float8x const& a, Float8x const& b ) { return _mm256_xor_ps( a.m_data, b.m_data ); }
+    EE_FORCE_INLINE Float8x AndNot( Float8x const& a, Float8x const& b ) { return _mm256_andnot_ps( a.m_data, b.m_data ); }
+
+    EE_FORCE_INLINE Float8x LessThan( Float8x const& a, Float8x const& b ) { return _mm256_cmp_ps( a.m_data, b.m_data, _CMP_LT_OQ ); }
+    EE_FORCE_INLINE Float8x LessThanEqual( Float8x const& a, Float8x const& b ) { return _mm256_cmp_ps( a.m_data, b.m_data, _CMP_LE_OQ ); }
+    EE_FORCE_INLINE Float8x GreaterThan( Float8x const& a, Float8x const& b ) { return _mm256_cmp_ps( a.m_data, b.m_data, _CMP_GT_OQ ); }
+    EE_FORCE_INLINE Float8x GreaterThanEqual( Float8x const& a, Float8x const& b ) { return _mm256_cmp_ps( a.m_data, b.m_data, _CMP_GE_OQ ); }
+    EE_FORCE_INLINE Float8x Equal( Float8x const& a, Float8x const& b ) { return _mm256_cmp_ps( a.m_data, b.m_data, _CMP_EQ_OQ ); }
+
+    EE_FORCE_INLINE Float8x Select( Float8x const& v0, Float8x const& v1, Float8x const& mask ) { return _mm256_blendv_ps( v0.m_data, v1.m_data, mask.m_data ); }
+    EE_FORCE_INLINE Float8x GetSignBits( Float8x const& a ) { return _mm256_and_ps( a.m_data, _mm256_set1_ps( -0.0f ) ); }
+
+    // The AVX unpack/shuffle instructions operate on each 128bit half independently,
+    // so we place group N in the low half and group N+4 in the high half and do a regular 4x4 transpose
+    EE_FORCE_INLINE void LoadTransposed( float const* pFirst, size_t stride, Float8x& outX, Float8x& outY, Float8x& outZ, Float8x& outW )
+    {
+        __m256 const r0 = _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_loadu_ps( pFirst ) ), _mm_loadu_ps( pFirst + stride * 4 ), 1 );
+        __m256 const r1 = _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_loadu_ps( pFirst + stride ) ), _mm_loadu_ps( pFirst + stride * 5 ), 1 );
+        __m256 const r2 = _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_loadu_ps( pFirst + stride * 2 ) ), _mm_loadu_ps( pFirst + stride * 6 ), 1 );
+        __m256 const r3 = _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_loadu_ps( pFirst + stride * 3 ) ), _mm_loadu_ps( pFirst + stride * 7 ), 1 );
+
+        __m256 const t0 = _mm256_unpacklo_ps( r0, r1 ); // x0 x1 y0 y1
+        __m256 const t1 = _mm256_unpacklo_ps( r2, r3 ); // x2 x3 y2 y3
+        __m256 const t2 = _mm256_unpackhi_ps( r0, r1 ); // z0 z1 w0 w1
+        __m256 const t3 = _mm256_unpackhi_ps( r2, r3 ); // z2 z3 w2 w3
+
+        outX = _mm256_shuffle_ps( t0, t1, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+        outY = _mm256_shuffle_ps( t0, t1, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+        outZ = _mm256_shuffle_ps( t2, t3, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+        outW = _mm256_shuffle_ps( t2, t3, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+    }
+
+    EE_FORCE_INLINE void StoreTransposed( float* pFirst, size_t stride, Float8x const& x, Float8x const& y, Float8x const& z, Float8x const& w )
+    {
+        __m256 const t0 = _mm256_unpacklo_ps( x.m_data, y.m_data ); // x0 y0 x1 y1
+        __m256 const t1 = _mm256_unpacklo_ps( z.m_data, w.m_data ); // z0 w0 z1 w1
+        __m256 const t2 = _mm256_unpackhi_ps( x.m_data, y.m_data ); // x2 y2 x3 y3
+        __m256 const t3 = _mm256_unpackhi_ps( z.m_data, w.m_data ); // z2 w2 z3 w3
+
+        __m256 const r0 = _mm256_shuffle_ps( t0, t1, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+        __m256 const r1 = _mm256_shuffle_ps( t0, t1, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+        __m256 const r2 = _mm256_shuffle_ps( t2, t3, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+        __m256 const r3 = _mm256_shuffle_ps( t2, t3, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+
+        _mm_storeu_ps( pFirst, _mm256_castps256_ps128( r0 ) );
+        _mm_storeu_ps( pFirst + stride, _mm256_castps256_ps128( r1 ) );
+        _mm_storeu_ps( pFirst + stride * 2, _mm256_castps256_ps128( r2 ) );
+        _mm_storeu_ps( pFirst + stride * 3, _mm256_castps256_ps128( r3 ) );
+        _mm_storeu_ps( pFirst + stride * 4, _mm256_extractf128_ps( r0, 1 ) );
+        _mm_storeu_ps( pFirst + stride * 5, _mm256_extractf128_ps( r1, 1 ) );
+        _mm_storeu_ps( pFirst + stride * 6, _mm256_extractf128_ps( r2, 1 ) );
+        _mm_storeu_ps( pFirst + stride * 7, _mm256_extractf128_ps( r3, 1 ) );
+    }
+    #else
+    // Fallback when AVX is not available, each operation is done on two SSE halves
+    struct Float8x
+    {
+        constexpr static uint32_t const s_width = 8;
+
+        EE_FORCE_INLINE static Float8x Zero() { return Float8x( Float4x::Zero(), Float4x::Zero() ); }
+        EE_FORCE_INLINE static Float8x One() { return Float8x( Float4x::One(), Float4x::One() ); }
+        EE_FORCE_INLINE static Float8x Load( float const* pValues ) { return Float8x( Float4x::Load( pValues ), Float4x::Load( pValues + 4 ) ); }
+
+    public:
+
+        Float8x() = default;
+        EE_FORCE_INLINE Float8x( Float4x lo, Float4x hi ) : m_lo( lo ), m_hi( hi ) {}
+        EE_FORCE_INLINE explicit Float8x( float v ) : m_lo( v ), m_hi( v ) {}
+
+        EE_FORCE_INLINE void Store( float* pValues ) const { m_lo.Store( pValues ); m_hi.Store( pValues + 4 ); }
+        EE_FORCE_INLINE float GetLane( uint32_t i ) const { EE_ASSERT( i < s_width ); return ( i < 4 ) ? m_lo.GetLane( i ) : m_hi.GetLane( i - 4 ); }
+        EE_FORCE_INLINE uint32_t GetMask() const { return m_lo.GetMask() | ( m_hi.GetMask() << 4 ); }
+
+        EE_FORCE_INLINE Float8x operator+( Float8x const& rhs ) const { return Float8x( m_lo + rhs.m_lo, m_hi + rhs.m_hi ); }
+        EE_FORCE_INLINE Float8x operator-( Float8x const& rhs ) const { return Float8x( m_lo - rhs.m_lo, m_hi - rhs.m_hi ); }
+        EE_FORCE_INLINE Float8x operator*( Float8x const& rhs ) const { return Float8x( m_lo * rhs.m_lo, m_hi * rhs.m_hi ); }
+        EE_FORCE_INLINE Float8x operator/( Float8x const& rhs ) const { return Float8x( m_lo / rhs.m_lo, m_hi / rhs.m_hi ); }
+        EE_FORCE_INLINE Float8x operator-() const { return Float8x( -m_lo, -m_hi ); }
+        EE_FORCE_INLINE Float8x& operator+=( Float8x const& rhs ) { m_lo += rhs.m_lo; m_hi += rhs.m_hi; return *this; }
+        EE_FORCE_INLINE Float8x& operator-=( Float8x const& rhs ) { m_lo -= rhs.m_lo; m_hi -= rhs.m_hi; return *this; }
+        EE_FORCE_INLINE Float8x& operator*=( Float8x const& rhs ) { m_lo *= rhs.m_lo; m_hi *= rhs.m_hi; return *this; }
+
+    public:
+
+        Float4x m_lo;
+        Float4x m_hi;
+    };
+
+    EE_FORCE_INLINE Float8x MultiplyAdd( Float8x const& a, Float8x const& b, Float8x const& c ) { return Float8x( MultiplyAdd( a.m_lo, b.m_lo, c.m_lo ), MultiplyAdd( a.m_hi, b.m_hi, c.m_hi ) ); }
+    EE_FORCE_INLINE Float8x MultiplySubtract( Float8x const& a, Float8x const& b, Float8x const& c ) { return Float8x( MultiplySubtract( a.m_lo, b.m_lo, c.m_lo ), MultiplySubtract( a.m_hi, b.m_hi, c.m_hi ) ); }
+
+    EE_FORCE_INLINE Float8x Min( Float8x const& a, Float8x const& b ) { return Float8x( Min( a.m_lo, b.m_lo ), Min( a.m_hi, b.m_hi ) ); }
+    EE_FORCE_INLINE Float8x Max( Float8x const& a, Float8x const& b ) { return Float8x( Max( a.m_lo, b.m_lo ), Max( a.m_hi, b.m_hi ) ); }
+    EE_FORCE_INLINE Float8x Abs( Float8x const& a ) { return Float8x( Abs( a.m_lo ), Abs( a.m_hi ) ); }
+    EE_FORCE_INLINE Float8x Sqrt( Float8x const& a ) { return Float8x( Sqrt( a.m_lo ), Sqrt( a.m_hi ) ); }
+    EE_FORCE_INLINE Float8x Reciprocal( Float8x const& a ) { return Float8x( Reciprocal( a.m_lo ), Reciprocal( a.m_hi ) ); }
+    EE_FORCE_INLINE Float8x ReciprocalSqrt( Float8x const& a ) { return Float8x( ReciprocalSqrt( a.m_lo ), ReciprocalSqrt( a.m_hi ) ); }
+
+    EE_FORCE_INLINE Float8x And( Float8x const& a, Float8x const& b ) { return Float8x( And( a.m_lo, b.m_lo ), And( a.m_hi, b.m_hi ) ); }
+    EE_FORCE_INLINE Float8x Or( Float8x const& a, Float8x const& b ) { return Float8x( Or( a.m_lo, b.m_lo ), Or( a.m_hi, b.m_hi ) ); }
+    EE_FORCE_INLINE Float8x Xor( Float8x const& a, Float8x const& b ) { return Float8x( Xor( a.m_lo, b.m_lo ), Xor( a.m_hi, b.m_hi ) ); }
+    EE_FORCE_INLINE Float8x AndNot( Float8x const& a, Float8x const& b ) { return Float8x( AndNot( a.m_lo, b.m_lo ), AndNot( a.m_hi, b.m_hi ) ); }
+
+    EE_FORCE_INLINE Float8x LessThan( Float8x const& a, Float8x const& b ) { return Float8x( LessThan( a.m_lo, b.m_lo ), LessThan( a.m_hi, b.m_hi ) ); }
+    EE_FORCE_INLINE Float8x LessThanEqual( Float8x const& a, Float8x const& b ) { return Float8x( LessThanEqual( a.m_lo, b.m_lo ), LessThanEqual( a.m_hi, b.m_hi ) ); }
+    EE_FORCE_INLINE Float8x GreaterThan( Float8x const& a, Float8x const& b ) { return Float8x( GreaterThan( a.m_lo, b.m_lo ), GreaterThan( a.m_hi, b.m_hi ) ); }
+    EE_FORCE_INLINE Float8x GreaterThanEqual( Float8x const& a, Float8x const& b ) { return Float8x( GreaterThanEqual( a.m_lo, b.m_lo ), GreaterThanEqual( a.m_hi, b.m_hi ) ); }
+    EE_FORCE_INLINE Float8x Equal( Float8x const& a, Float8x const& b ) { return Float8x( Equal( a.m_lo, b.m_lo ), Equal( a.m_hi, b.m_hi ) ); }
+
+    EE_FORCE_INLINE Float8x Select( Float8x const& v0, Float8x const& v1, Float8x const& mask ) { return Float8x( Select( v0.m_lo, v1.m_lo, mask.m_lo ), Select( v0.m_hi, v1.m_hi, mask.m_hi ) ); }
+    EE_FORCE_INLINE Float8x GetSignBits( Float8x const& a ) { return Float8x( GetSignBits( a.m_lo ), GetSignBits( a.m_hi ) ); }
+
+    EE_FORCE_INLINE void LoadTransposed( float const* pFirst, size_t stride, Float8x& outX, Float8x& outY, Float8x& outZ, Float8x& outW )
+    {
+        LoadTransposed( pFirst, stride, outX.m_lo, outY.m_lo, outZ.m_lo, outW.m_lo );
+        LoadTransposed( pFirst + stride * 4, stride, outX.m_hi, outY.m_hi, outZ.m_hi, outW.m_hi );
+    }
+
+    EE_FORCE_INLINE void StoreTransposed( float* pFirst, size_t stride, Float8x const& x, Float8x const& y, Float8x const& z, Float8x const& w )
+    {
+        StoreTransposed( pFirst, stride, x.m_lo, y.m_lo, z.m_lo, w.m_lo );
+        StoreTransposed( pFirst + stride * 4, stride, x.m_hi, y.m_hi, z.m_hi, w.m_hi );
+    }
+    #endif
+
+    //-------------------------------------------------------------------------
+
+    template<typename F> EE_FORCE_INLINE bool AnyTrue( F const& mask ) { return mask.GetMask() != 0; }
+    template<typename F> EE_FORCE_INLINE bool AllTrue( F const& mask ) { return mask.GetMask() == ( ( 1u << F::s_width ) - 1 ); }
+
+    // Returns a mask with the first 'count' lanes set
+    template<typename F> EE_FORCE_INLINE F GetFirstLanesMask( uint32_t count )
+    {
+        EE_ASSERT( count <= F::s_width );
+        alignas( 32 ) uint32_t bits[F::s_width];
+        for ( uint32_t i = 0; i < F::s_width; i++ )
+        {
+            bits[i] = ( i < count ) ? 0xFFFFFFFF : 0;
+        }
+        return F::Load( reinterpret_cast<float const*>( bits ) );
+    }
+
+    // Load the first 'count' values, the remaining lanes are set to zero
+    template<typename F> EE_FORCE_INLINE F LoadPartial( float const* pValues, uint32_t count )
+    {
+        EE_ASSERT( count <= F::s_width );
+        if ( count == F::s_width )
+        {
+            return F::Load( pValues );
+        }
+
+        alignas( 32 ) float padded[F::s_width] = {};
+        for ( uint32_t i = 0; i < count; i++ )
+        {
+            padded[i] = pValues[i];
+        }
+        return F::Load( padded );
+    }
+}
+
+//-------------------------------------------------------------------------
+// SoA Types
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    template<typename F>
+    struct TVectorWide
+    {
+        constexpr static uint32_t const s_width = F::s_width;
+
+        // Load/Store 's_width' vectors
+        EE_FORCE_INLINE static TVectorWide Load( Vector const* pVectors ) { TVectorWide v; SIMD::LoadTransposed( reinterpret_cast<float const*>( pVectors ), 4, v.m_x, v.m_y, v.m_z, v.m_w ); return v; }
+        EE_FORCE_INLINE void Store( Vector* pVectors ) const { SIMD::StoreTransposed( reinterpret_cast<float*>( pVectors ), 4, m_x, m_y, m_z, m_w ); }
+
+        // Load/Store a partial batch, unused lanes are set to the padding value
+        inline static TVectorWide Load( Vector const* pVectors, uint32_t count, Vector const& padding = Vector::Zero );
+        inline void Store( Vector* pVectors, uint32_t count ) const;
+
+        EE_FORCE_INLINE static F Dot3( TVectorWide const& a, TVectorWide const& b ) { return SIMD::MultiplyAdd( a.m_z, b.m_z, SIMD::MultiplyAdd( a.m_y, b.m_y, a.m_x * b.m_x ) ); }
+        EE_FORCE_INLINE static F Dot4( TVectorWide const& a, TVectorWide const& b ) { return SIMD::MultiplyAdd( a.m_w, b.m_w, Dot3( a, b ) ); }
+
+        // Cross product of the XYZ components, W is set to 0
+        EE_FORCE_INLINE static TVectorWide Cross3( TVectorWide const& a, TVectorWide const& b )
+        {
+            return TVectorWide( SIMD::MultiplySubtract( a.m_y, b.m_z, a.m_z * b.m_y ), SIMD::MultiplySubtract( a.m_z, b.m_x, a.m_x * b.m_z ), SIMD::MultiplySubtract( a.m_x, b.m_y, a.m_y * b.m_x ), F::Zero() );
+        }
+
+        // Linear interpolation of all 4 components with a per-lane T
+        EE_FORCE_INLINE static TVectorWide Lerp( TVectorWide const& from, TVectorWide const& to, F const& t )
+        {
+            return TVectorWide( SIMD::MultiplyAdd( to.m_x - from.m_x, t, from.m_x ), SIMD::MultiplyAdd( to.m_y - from.m_y, t, from.m_y ), SIMD::MultiplyAdd( to.m_z - from.m_z, t, from.m_z ), SIMD::MultiplyAdd( to.m_w - from.m_w, t, from.m_w ) );
+        }
+
+        // Per-lane select: mask set means select from v1
+        EE_FORCE_INLINE static TVectorWide Select( TVectorWide const& v0, TVectorWide const& v1, F const& mask )
+        {
+            return TVectorWide( SIMD::Select( v0.m_x, v1.m_x, mask ), SIMD::Select( v0.m_y, v1.m_y, mask ), SIMD::Select( v0.m_z, v1.m_z, mask ), SIMD::Select( v0.m_w, v1.m_w, mask ) );
+        }
+
+    public:
+
+        TVectorWide() = default;
+        EE_FORCE_INLINE TVectorWide( F const& x, F const& y, F const& z, F const& w ) : m_x( x ), m_y( y ), m_z( z ), m_w( w ) {}
+
+        // Set all lanes to the same vector
+        EE_FORCE_INLINE explicit TVectorWide( Vector const& v ) : m_x( v.GetX() ), m_y( v.GetY() ), m_z( v.GetZ() ), m_w( v.GetW() ) {}
+
+        EE_FORCE_INLINE Vector GetLane( uint32_t i ) const { return Vector( m_x.GetLane( i ), m_y.GetLane( i ), m_z.GetLane( i ), m_w.GetLane( i ) ); }
+
+        EE_FORCE_INLINE F Length3() const { return SIMD::Sqrt( Dot3( *this, *this ) ); }
+        EE_FORCE_INLINE F LengthSquared3() const { return Dot3( *this, *this ); }
+
+        // Normalize the XYZ components, W is left unchanged
+        EE_FORCE_INLINE TVectorWide GetNormalized3() const { F const invLength = SIMD::ReciprocalSqrt( Dot3( *this, *this ) ); return TVectorWide( m_x * invLength, m_y * invLength, m_z * invLength, m_w ); }
+
+        EE_FORCE_INLINE TVectorWide operator+( TVectorWide const& rhs ) const { return TVectorWide( m_x + rhs.m_x, m_y + rhs.m_y, m_z + rhs.m_z, m_w + rhs.m_w ); }
+        EE_FORCE_INLINE TVectorWide operator-( TVectorWide const& rhs ) const { return TVectorWide( m_x - rhs.m_x, m_y - rhs.m_y, m_z - rhs.m_z, m_w - rhs.m_w ); }
+        EE_FORCE_INLINE TVectorWide operator*( TVectorWide const& rhs ) const { return TVectorWide( m_x * rhs.m_x, m_y * rhs.m_y, m_z * rhs.m_z, m_w * rhs.m_w ); }
+        EE_FORCE_INLINE TVectorWide operator*( F const& s ) const { return TVectorWide( m_x * s, m_y * s, m_z * s, m_w * s ); }
+        EE_FORCE_INLINE TVectorWide operator-() const { return TVectorWide( -m_x, -m_y, -m_z, -m_w ); }
+
+    public:
+
+        F m_x;
+        F m_y;
+        F m_z;
+        F m_w;
+    };
+
+    //-------------------------------------------------------------------------
+
+    template<typename F>
+    struct TQuaternionWide
+    {
+        constexpr static uint32_t const s_width = F::s_width;
+        static_assert( sizeof( Quaternion ) == sizeof( Vector ), "Quaternions are loaded as vectors" );
+
+        EE_FORCE_INLINE static TQuaternionWide Load( Quaternion const* pQuaternions ) { TQuaternionWide q; SIMD::LoadTransposed( reinterpret_cast<float const*>( pQuaternions ), 4, q.m_x, q.m_y, q.m_z, q.m_w ); return q; }
+        EE_FORCE_INLINE void Store( Quaternion* pQuaternions ) const { SIMD::StoreTransposed( reinterpret_cast<float*>( pQuaternions ), 4, m_x, m_y, m_z, m_w ); }
+
+        // Load/Store a partial batch, unused lanes are set to identity
+        inline static TQuaternionWide Load( Quaternion const* pQuaternions, uint32_t count );
+        inline void Store( Quaternion* pQuaternions, uint32_t count ) const;
+
+        EE_FORCE_INLINE static F Dot( TQuaternionWide const& q0, TQuaternionWide const& q1 )
+        {
+            return SIMD::MultiplyAdd( q0.m_w, q1.m_w, SIMD::MultiplyAdd( q0.m_z, q1.m_z, SIMD::MultiplyAdd( q0.m_y, q1.m_y, q0.m_x * q1.m_x ) ) );
+        }
+
+        // Normalized linear interpolation, takes the shortest path - same as Quaternion::NLerp
+        inline static TQuaternionWide NLerp( TQuaternionWide const& from, TQuaternionWide const& to, F const& t );
+
+        // Spherical interpolation, takes the shortest path - same as Quaternion::SLerp
+        inline static TQuaternionWide SLerp( TQuaternionWide const& from, TQuaternionWide const& to, F const& t );
+
+        // SLerp approximation - same as Quaternion::FastSLerp
+        inline static TQuaternionWide FastSLerp( TQuaternionWide const& from, TQuaternionWide const& to, F const& t );
+
+        // Per-lane select: mask set means select from q1
+        EE_FORCE_INLINE static TQuaternionWide Select( TQuaternionWide const& q0, TQuaternionWide const& q1, F const& mask )
+        {
+            return TQuaternionWide( SIMD::Select( q0.m_x, q1.m_x, mask ), SIMD::Select( q0.m_y, q1.m_y, mask ), SIMD::Select( q0.m_z, q1.m_z, mask ), SIMD::Select( q0.m_w, q1.m_w, mask ) );
+        }
+
+    public:
+
+        TQuaternionWide() = default;
+        EE_FORCE_INLINE TQuaternionWide( F const& x, F const& y, F const& z, F const& w ) : m_x( x ), m_y( y ), m_z( z ), m_w( w ) {}
+        EE_FORCE_INLINE explicit TQuaternionWide( Quaternion const& q ) { Float4 const v = q.ToFloat4(); m_x = F( v.m_x ); m_y = F( v.m_y ); m_z = F( v.m_z ); m_w = F( v.m_w ); }
+
+        EE_FORCE_INLINE Quaternion GetLane( uint32_t i ) const { return Quaternion( m_x.GetLane( i ), m_y.GetLane( i ), m_z.GetLane( i ), m_w.GetLane( i ) ); }
+
+        EE_FORCE_INLINE TQuaternionWide GetConjugate() const { return TQuaternionWide( -m_x, -m_y, -m_z, m_w ); }
+        EE_FORCE_INLINE TQuaternionWide GetNegated() const { return TQuaternionWide( -m_x, -m_y, -m_z, -m_w ); }
+        EE_FORCE_INLINE TQuaternionWide GetNormalized() const { F const invLength = SIMD::ReciprocalSqrt( Dot( *this, *this ) ); return TQuaternionWide( m_x * invLength, m_y * invLength, m_z * invLength, m_w * invLength ); }
+
+        // Rotate a vector, the W component of the result is set to 0
+        inline TVectorWide<F> RotateVector( TVectorWide<F> const& v ) const;
+
+        // Same order as Quaternion::operator*, i.e. the result applies this rotation followed by the rhs rotation
+        inline TQuaternionWide operator*( TQuaternionWide const& rhs ) const;
+
+    public:
+
+        F m_x;
+        F m_y;
+        F m_z;
+        F m_w;
+    };
+
+    //-------------------------------------------------------------------------
+
+    template<typename F>
+    struct TTransformWide
+    {
+        constexpr static uint32_t const s_width = F::s_width;
+
+        // Load/Store 's_width' transforms, or a partial batch with the unused lanes set to identity
+        inline static TTransformWide Load( Transform const* pTransforms, uint32_t count = F::s_width );
+        inline void Store( Transform* pTransforms, uint32_t count = F::s_width ) const;
+
+        // Linear interpolation using NLerp for the rotations - same as Transform::Lerp
+        EE_FORCE_INLINE static TTransformWide Lerp( TTransformWide const& from, TTransformWide const& to, F const& t )
+        {
+            return TTransformWide( TQuaternionWide<F>::NLerp( from.m_rotation, to.m_rotation, t ), TVectorWide<F>::Lerp( from.m_translationScale, to.m_translationScale, t ) );
+        }
+
+        // Interpolation using FastSLerp for the rotations - same as Transform::FastSlerp
+        EE_FORCE_INLINE static TTransformWide FastSlerp( TTransformWide const& from, TTransformWide const& to, F const& t )
+        {
+            return TTransformWide( TQuaternionWide<F>::FastSLerp( from.m_rotation, to.m_rotation, t ), TVectorWide<F>::Lerp( from.m_translationScale, to.m_translationScale, t ) );
+        }
+
+        // Per-lane select: mask set means select from t1
+        EE_FORCE_INLINE static TTransformWide Select( TTransformWide const& t0, TTransformWide const& t1, F const& mask )
+        {
+            return TTransformWide( TQuaternionWide<F>::Select( t0.m_rotation, t1.m_rotation, mask ), TVectorWide<F>::Select( t0.m_translationScale, t1.m_translationScale, mask ) );
+        }
+
+    public:
+
+        TTransformWide() = default;
+        EE_FORCE_INLINE TTransformWide( TQuaternionWide<F> const& rotation, TVectorWide<F> const& translationScale ) : m_rotation( rotation ), m_translationScale( translationScale ) {}
+        EE_FORCE_INLINE explicit TTransformWide( Transform const& t ) : m_rotation( t.GetRotation() ), m_translationScale( t.GetTranslation() ) {}
+
+        inline Transform GetLane( uint32_t i ) const;
+
+        EE_FORCE_INLINE F GetScale() const { return m_translationScale.m_w; }
+
+        // Transform a point, the W component of the result is set to 0 - same as Transform::TransformPoint
+        inline TVectorWide<F> TransformPoint( TVectorWide<F> const& point ) const;
+
+        // Same order as Transform::operator*, i.e. this transform is relative to the rhs transform
+        // Lanes with negative scale fall back to the scalar path, same as Transform::operator*
+        inline TTransformWide operator*( TTransformWide const& rhs ) const;
+
+    public:
+
+        TQuaternionWide<F>  m_rotation;
+        TVectorWide<F>      m_translationScale;     // W: uniform scale
+    };
+
+    //-------------------------------------------------------------------------
+
+    using Vector4x = TVectorWide<SIMD::Float4x>;
+    using Quaternion4x = TQuaternionWide<SIMD::Float4x>;
+    using Transform4x = TTransformWide<SIMD::Float4x>;
+
+    using Vector8x = TVectorWide<SIMD::Float8x>;
+    using Quaternion8x = TQuaternionWide<SIMD::Float8x>;
+    using Transform8x = TTransformWide<SIMD::Float8x>;
+
+    // The widest types that are natively supported by the build
+    #if EE_SIMD_AVX
+    using FloatWide = SIMD::Float8x;
+    #else
+    using FloatWide = SIMD::Float4x;
+    #endif
+
+    using VectorWide = TVectorWide<FloatWide>;
+    using QuaternionWide = TQuaternionWide<FloatWide>;
+    using TransformWide = TTransformWide<FloatWide>;
+
+    //-------------------------------------------------------------------------
+    // Implementation
+    //-------------------------------------------------------------------------
+
+    template<typename F>
+    inline TVectorWide<F> TVectorWide<F>::Load( Vector const* pVectors, uint32_t count, Vector const& padding )
+    {
+        EE_ASSERT( count <= s_width );
+        if ( count == s_width )
+        {
+            return Load( pVectors );
+        }
+
+        Vector padded[s_width];
+        for ( uint32_t i = 0; i < s_width; i++ )
+        {
+            padded[i] = ( i < count ) ? pVectors[i] : padding;
+        }
+        return Load( padded );
+    }
+
+    template<typename F>
+    inline void TVectorWide<F>::Store( Vector* pVectors, uint32_t count ) const
+    {
+        EE_ASSERT( count <= s_width );
+        if ( count == s_width )
+        {
+            Store( pVectors );
+            return;
+        }
+
+        Vector unpacked[s_width];
+        Store( unpacked );
+        for ( uint32_t i = 0; i < count; i++ )
+        {
+            pVectors[i] = unpacked[i];
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    template<typename F>
+    inline TQuaternionWide<F> TQuaternionWide<F>::Load( Quaternion const* pQuaternions, uint32_t count )
+    {
+        EE_ASSERT( count <= s_width );
+        if ( count == s_width )
+        {
+            return Load( pQuaternions );
+        }
+
+        Quaternion padded[s_width];
+        for ( uint32_t i = 0; i < s_width; i++ )
+        {
+            padded[i] = ( i < count ) ? pQuaternions[i] : Quaternion::Identity;
+        }
+        return Load( padded );
+    }
+
+    template<typename F>
+    inline void TQuaternionWide<F>::Store( Quaternion* pQuaternions, uint32_t count ) const
+    {
+        EE_ASSERT( count <= s_width );
+        if ( count == s_width )
+        {
+            Store( pQuaternions );
+            return;
+        }
+
+        Quaternion unpacked[s_width];
+        Store( unpacked );
+        for ( uint32_t i = 0; i < count; i++ )
+        {
+            pQuaternions[i] = unpacked[i];
+        }
+    }
+
+    template<typename F>
+    inline TQuaternionWide<F> TQuaternionWide<F>::operator*( TQuaternionWide const& rhs ) const
+    {
+        // Same as the scalar version: ( rhs.w * x ) + ( rhs.x * w ) + ( rhs.y * z ) - ( rhs.z * y ), etc...
+        TQuaternionWide result;
+        result.m_x = SIMD::MultiplyAdd( rhs.m_y, m_z, SIMD::MultiplyAdd( rhs.m_x, m_w, rhs.m_w * m_x ) ) - ( rhs.m_z * m_y );
+        result.m_y = SIMD::MultiplyAdd( rhs.m_z, m_x, SIMD::MultiplyAdd( rhs.m_y, m_w, SIMD::MultiplySubtract( rhs.m_w, m_y, rhs.m_x * m_z ) ) );
+        result.m_z = SIMD::MultiplyAdd( rhs.m_z, m_w, SIMD::MultiplySubtract( rhs.m_w, m_z, rhs.m_y * m_x ) + rhs.m_x * m_y );
+        result.m_w = SIMD::MultiplySubtract( rhs.m_w, m_w, SIMD::MultiplyAdd( rhs.m_z, m_z, SIMD::MultiplyAdd( rhs.m_y, m_y, rhs.m_x * m_x ) ) );
+        return result;
+    }
+
+    template<typename F>
+    inline TVectorWide<F> TQuaternionWide<F>::RotateVector( TVectorWide<F> const& v ) const
+    {
+        // v' = v + w * t + cross( q.xyz, t ), where t = 2 * cross( q.xyz, v )
+        TVectorWide<F> const q( m_x, m_y, m_z, F::Zero() );
+        TVectorWide<F> t = TVectorWide<F>::Cross3( q, v );
+        F const two( 2.0f );
+        t = TVectorWide<F>( t.m_x * two, t.m_y * two, t.m_z * two, F::Zero() );
+
+        TVectorWide<F> const c = TVectorWide<F>::Cross3( q, t );
+        return TVectorWide<F>( SIMD::MultiplyAdd( m_w, t.m_x, v.m_x ) + c.m_x, SIMD::MultiplyAdd( m_w, t.m_y, v.m_y ) + c.m_y, SIMD::MultiplyAdd( m_w, t.m_z, v.m_z ) + c.m_z, F::Zero() );
+    }
+
+    template<typename F>
+    inline TQuaternionWide<F> TQuaternionWide<F>::NLerp( TQuaternionWide const& from, TQuaternionWide const& to, F const& t )
+    {
+        // Flip 'from' for the lanes where the rotations are in opposite directions
+        F const sign = SIMD::GetSignBits( Dot( from, to ) );
+        TQuaternionWide const adjustedFrom( SIMD::Xor( from.m_x, sign ), SIMD::Xor( from.m_y, sign ), SIMD::Xor( from.m_z, sign ), SIMD::Xor( from.m_w, sign ) );
+
+        TQuaternionWide result;
+        result.m_x = SIMD::MultiplyAdd( to.m_x - adjustedFrom.m_x, t, adjustedFrom.m_x );
+        result.m_y = SIMD::MultiplyAdd( to.m_y - adjustedFrom.m_y, t, adjustedFrom.m_y );
+        result.m_z = SIMD::MultiplyAdd( to.m_z - adjustedFrom.m_z, t, adjustedFrom.m_z );
+        result.m_w = SIMD::MultiplyAdd( to.m_w - adjustedFrom.m_w, t, adjustedFrom.m_w );
+        return result.GetNormalized();
+    }
+
+    template<typename F>
+    inline TQuaternionWide<F> TQuaternionWide<F>::SLerp( TQuaternionWide const& from, TQuaternionWide const& to, F const& t )
+    {
+        // See Quaternion::SLerp, once the sign is fixed up the angle is always in [0, pi/2], so we can skip the range reduction that Vector::Sin does
+        // The angle is calculated with the same polynomial as Vector::ACos rather than with an ATan2, the results are the same within float precision
+        static float const arcCoefficients[8] = { +1.5707963050f, -0.2145988016f, +0.0889789874f, -0.0501743046f, +0.0308918810f, -0.0170881256f, +0.0066700901f, -0.0012624911f };
+        static float const sinCoefficients[5] = { -0.16666667f, +0.0083333310f, -0.00019840874f, +2.7525562e-06f, -2.3889859e-08f };
+
+        auto CalculateSin = [] ( F const& x )
+        {
+            F const x2 = x * x;
+            F result = SIMD::MultiplyAdd( F( sinCoefficients[4] ), x2, F( sinCoefficients[3] ) );
+            for ( int32_t i = 2; i >= 0; i-- )
+            {
+                result = SIMD::MultiplyAdd( result, x2, F( sinCoefficients[i] ) );
+            }
+            result = SIMD::MultiplyAdd( result, x2, F::One() );
+            return result * x;
+        };
+
+        //-------------------------------------------------------------------------
+
+        F const one = F::One();
+
+        F cosOmega = Dot( from, to );
+        F const sign = SIMD::GetSignBits( cosOmega );
+        cosOmega = SIMD::Xor( cosOmega, sign );
+
+        // Nearly identical rotations fall back to a linear interpolation
+        F const useSLerp = SIMD::LessThan( cosOmega, F( 1.0f - 0.00001f ) );
+
+        F const sinOmega = SIMD::Sqrt( one - ( cosOmega * cosOmega ) );
+
+        F omega( arcCoefficients[7] );
+        for ( int32_t i = 6; i >= 0; i-- )
+        {
+            omega = SIMD::MultiplyAdd( omega, cosOmega, F( arcCoefficients[i] ) );
+        }
+        omega = omega * SIMD::Sqrt( SIMD::Max( F::Zero(), one - cosOmega ) );
+
+        F const oneMinusT = one - t;
+        F const s0 = SIMD::Select( oneMinusT, CalculateSin( oneMinusT * omega ) / sinOmega, useSLerp );
+        F const s1 = SIMD::Xor( SIMD::Select( t, CalculateSin( t * omega ) / sinOmega, useSLerp ), sign );
+
+        TQuaternionWide result;
+        result.m_x = SIMD::MultiplyAdd( from.m_x, s0, to.m_x * s1 );
+        result.m_y = SIMD::MultiplyAdd( from.m_y, s0, to.m_y * s1 );
+        result.m_z = SIMD::MultiplyAdd( from.m_z, s0, to.m_z * s1 );
+        result.m_w = SIMD::MultiplyAdd( from.m_w, s0, to.m_w * s1 );
+        return result;
+    }
+
+    template<typename F>
+    inline TQuaternionWide<F> TQuaternionWide<F>::FastSLerp( TQuaternionWide const& q0, TQuaternionWide const& q1, F const& t )
+    {
+        // See Quaternion::FastSLerp, since every lane has its own T and angle the polynomial coefficients are splatted instead of the values
+        constexpr float const mu = 1.85298109240830f;
+        static float const u[8] = { 1.f / ( 1 * 3 ), 1.f / ( 2 * 5 ), 1.f / ( 3 * 7 ), 1.f / ( 4 * 9 ), 1.f / ( 5 * 11 ), 1.f / ( 6 * 13 ), 1.f / ( 7 * 15 ), mu / ( 8 * 17 ) };
+        static float const v[8] = { 1.f / 3, 2.f / 5, 3.f / 7, 4.f / 9, 5.f / 11, 6.f / 13, 7.f / 15, mu * 8 / 17 };
+
+        auto CalculateCoefficient = [] ( F const& vT, F const& xm1 )
+        {
+            F const vTSquared = vT * vT;
+            F const one = F::One();
+
+            // c = 1 + b7, c = 1 + b6 * c, ..., c = 1 + b0 * c, where bi = ( x - 1 ) * ( ui * t^2 - vi )
+            F c = SIMD::MultiplySubtract( F( u[7] ), vTSquared, F( v[7] ) ) * xm1 + one;
+            for ( int32_t i = 6; i >= 0; i-- )
+            {
+                F const b = SIMD::MultiplySubtract( F( u[i] ), vTSquared, F( v[i] ) ) * xm1;
+                c = SIMD::MultiplyAdd( b, c, one );
+            }
+
+            return c * vT;
+        };
+
+        //-------------------------------------------------------------------------
+
+        F x = Dot( q0, q1 ); // cos( theta )
+        F const sign = SIMD::GetSignBits( x );
+        x = SIMD::Xor( sign, x );
+        TQuaternionWide const localQ1( SIMD::Xor( sign, q1.m_x ), SIMD::Xor( sign, q1.m_y ), SIMD::Xor( sign, q1.m_z ), SIMD::Xor( sign, q1.m_w ) );
+
+        F const xm1 = x - F::One();
+        F const cT = CalculateCoefficient( t, xm1 );
+        F const cD = CalculateCoefficient( F::One() - t, xm1 );
+
+        TQuaternionWide result;
+        result.m_x = SIMD::MultiplyAdd( cD, q0.m_x, cT * localQ1.m_x );
+        result.m_y = SIMD::MultiplyAdd( cD, q0.m_y, cT * localQ1.m_y );
+        result.m_z = SIMD::MultiplyAdd( cD, q0.m_z, cT * localQ1.m_z );
+        result.m_w = SIMD::MultiplyAdd( cD, q0.m_w, cT * localQ1.m_w );
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    template<typename F>
+    inline TTransformWide<F> TTransformWide<F>::Load( Transform const* pTransforms, uint32_t count )
+    {
+        EE_ASSERT( count <= s_width );
+        static_assert( sizeof( Transform ) == sizeof( Quaternion ) + sizeof( Vector ), "Transforms are loaded as a rotation followed by a translation/scale" );
+
+        // Full batches are transposed straight out of the transform array
+        if ( count == s_width )
+        {
+            TTransformWide result;
+            float const* pFirst = reinterpret_cast<float const*>( pTransforms );
+            SIMD::LoadTransposed( pFirst, 8, result.m_rotation.m_x, result.m_rotation.m_y, result.m_rotation.m_z, result.m_rotation.m_w );
+            SIMD::LoadTransposed( pFirst + 4, 8, result.m_translationScale.m_x, result.m_translationScale.m_y, result.m_translationScale.m_z, result.m_translationScale.m_w );
+            return result;
+        }
+
+        Quaternion rotations[s_width];
+        Vector translationScales[s_width];
+        for ( uint32_t i = 0; i < s_width; i++ )
+        {
+            Transform const& transform = ( i < count ) ? pTransforms[i] : Transform::Identity;
+            rotations[i] = transform.GetRotation();
+            translationScales[i] = transform.GetTranslation();
+        }
+
+        return TTransformWide( TQuaternionWide<F>::Load( rotations ), TVectorWide<F>::Load( translationScales ) );
+    }
+
+    template<typename F>
+    inline void TTransformWide<F>::Store( Transform* pTransforms, uint32_t count ) const
+    {
+        EE_ASSERT( count <= s_width );
+
+        if ( count == s_width )
+        {
+            float* pFirst = reinterpret_cast<float*>( pTransforms );
+            SIMD::StoreTransposed( pFirst, 8, m_rotation.m_x, m_rotation.m_y, m_rotation.m_z, m_rotation.m_w );
+            SIMD::StoreTransposed( pFirst + 4, 8, m_translationScale.m_x, m_translationScale.m_y, m_translationScale.m_z, m_translationScale.m_w );
+            return;
+        }
+
+        Quaternion rotations[s_width];
+        Vector translationScales[s_width];
+        m_rotation.Store( rotations );
+        m_translationScale.Store( translationScales );
+
+        for ( uint32_t i = 0; i < count; i++ )
+        {
+            Transform::DirectlySetRotation( pTransforms[i], rotations[i] );
+            Transform::DirectlySetTranslationScale( pTransforms[i], translationScales[i] );
+        }
+    }
+
+    template<typename F>
+    inline Transform TTransformWide<F>::GetLane( uint32_t i ) const
+    {
+        Transform transform( NoInit );
+        Transform::DirectlySetRotation( transform, m_rotation.GetLane( i ) );
+        Transform::DirectlySetTranslationScale( transform, m_translationScale.GetLane( i ) );
+        return transform;
+    }
+
+    template<typename F>
+    inline TVectorWide<F> TTransformWide<F>::TransformPoint( TVectorWide<F> const& point ) const
+    {
+        F const scale = m_translationScale.m_w;
+        TVectorWide<F> const scaledPoint( point.m_x * scale, point.m_y * scale, point.m_z * scale, F::Zero() );
+        TVectorWide<F> const rotatedPoint = m_rotation.RotateVector( scaledPoint );
+        return TVectorWide<F>( rotatedPoint.m_x + m_translationScale.m_x, rotatedPoint.m_y + m_translationScale.m_y, rotatedPoint.m_z + m_translationScale.m_z, F::Zero() );
+    }
+
+    template<typename F>
+    inline TTransformWide<F> TTransformWide<F>::operator*( TTransformWide const& rhs ) const
+    {
+        F const scale = m_translationScale.m_w;
+        F const rhsScale = rhs.m_translationScale.m_w;
+
+        TTransformWide result;
+        result.m_rotation = ( m_rotation * rhs.m_rotation ).GetNormalized();
+
+        TVectorWide<F> const scaledTranslation( m_translationScale.m_x * rhsScale, m_translationScale.m_y * rhsScale, m_translationScale.m_z * rhsScale, F::Zero() );
+        TVectorWide<F> const rotatedTranslation = rhs.m_rotation.RotateVector( scaledTranslation );
+        result.m_translationScale = TVectorWide<F>( rotatedTranslation.m_x + rhs.m_translationScale.m_x, rotatedTranslation.m_y + rhs.m_translationScale.m_y, rotatedTranslation.m_z + rhs.m_translationScale.m_z, scale * rhsScale );
+
+        // Negative scale needs the matrix path to get the correct rotation, this is rare so just use the scalar version for those lanes
+        uint32_t const negativeScaleMask = SIMD::LessThan( SIMD::Min( scale, rhsScale ), F::Zero() ).GetMask();
+        if ( negativeScaleMask != 0 )
+        {
+            Transform results[s_width];
+            result.Store( results );
+
+            for ( uint32_t i = 0; i < s_width; i++ )
+            {
+                if ( negativeScaleMask & ( 1u << i ) )
+                {
+                    results[i] = GetLane( i ) * rhs.GetLane( i );
+                }
+            }
+
+            result = Load( results );
+        }
+
+        return result;
+    }
+}
@@ -459,10 +459,7 @@ namespace EE::Math
     Radians ViewVolume::GetVerticalFOV() const
     {
         EE_ASSERT( IsPerspective() );
-        float const halfFOVX = GetFOV().ToFloat() * 0.5f;
-        float const AR = GetAspectRatio();
-        float const tanAR = Math::Tan( halfFOVX ) * AR;
-        return 2.0f * Math::ATan( tanAR );
+        return ConvertHorizontalToVerticalFOV( m_viewDimensions.m_x, m_viewDimensions.m_y, m_FOV );
     }
 
     float ViewVolume::GetScalingFactorAtPosition( Vector const& position, float pixels ) const
@@ -1,4 +1,6 @@
 #include "RenderContext_DX11.h"
+
+#if _WIN32 && !EE_RENDER_NULL_DEVICE
 #include "Base/Types/Color.h"
 
 //-------------------------------------------------------------------------
@@ -496,6 +498,12 @@ namespace EE::Render
         m_pDeviceContext->DrawIndexed( vertexCount, indexStartIndex, vertexStartIndex );
     }
 
+    void RenderContext::DrawIndexedInstanced( uint32_t indexCount, uint32_t instanceCount, uint32_t indexStartIndex, uint32_t vertexStartIndex, uint32_t instanceStartIndex ) const
+    {
+        EE_ASSERT( IsValid() );
+        m_pDeviceContext->DrawIndexedInstanced( indexCount, instanceCount, indexStartIndex, vertexStartIndex, instanceStartIndex );
+    }
+
     void RenderContext::Dispatch( uint32_t numGroupsX, uint32_t numGroupsY, uint32_t numGroupsZ ) const
     {
         EE_ASSERT( IsValid() );
@@ -507,4 +515,5 @@ namespace EE::Render
         auto pSwapChain = reinterpret_cast<IDXGISwapChain*>( window.m_pSwapChain );
         pSwapChain->Present( 0, 0 );
     }
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
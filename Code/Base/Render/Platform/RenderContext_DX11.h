@@ -1,6 +1,8 @@
 #pragma once
-#ifdef _WIN32
 
+#include "Base/Render/RenderAPI.h"
+
+#if _WIN32 && !EE_RENDER_NULL_DEVICE
 #include "Base/_Module/API.h"
 
 #include "Base/Render/RenderStates.h"
@@ -69,6 +71,7 @@ namespace EE
             void SetPrimitiveTopology( Topology topology ) const;
             void Draw( uint32_t vertexCount, uint32_t vertexStartIndex = 0 ) const;
             void DrawIndexed( uint32_t vertexCount, uint32_t indexStartIndex = 0, uint32_t vertexStartIndex = 0 ) const;
+            void DrawIndexedInstanced( uint32_t indexCount, uint32_t instanceCount, uint32_t indexStartIndex = 0, uint32_t vertexStartIndex = 0, uint32_t instanceStartIndex = 0 ) const;
 
             void Dispatch( uint32_t numGroupsX, uint32_t numGroupsY, uint32_t numGroupsZ ) const;
 
@@ -0,0 +1,366 @@
+#include "RenderContext_Null.h"
+
+#if EE_RENDER_NULL_DEVICE
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render
+{
+    void RenderContext::SetShader( PipelineStage stage, Shader const* pShader ) const
+    {
+        uint32_t const stageIdx = (uint32_t) stage;
+
+        if ( pShader != nullptr && pShader->IsValid() )
+        {
+            Null::Resource* pShaderResource = Null::GetResource( pShader->GetShaderHandle() );
+            EE_ASSERT( pShaderResource->m_stage == stage ); // Shader bound to the wrong stage
+            TrackStateChange( m_boundState.m_shaders[stageIdx], (void*) pShaderResource );
+
+            uint32_t const numCbuffers = pShader->GetNumConstBuffers();
+            EE_ASSERT( numCbuffers <= s_maxConstantBuffers );
+            for ( auto i = 0u; i < numCbuffers; i++ )
+            {
+                RenderBuffer const& cbuffer = pShader->GetConstBuffer( i );
+                EE_ASSERT( cbuffer.m_type == RenderBuffer::Type::Constant );
+                TrackStateChange( m_boundState.m_constantBuffers[stageIdx][i], (void*) Null::GetResource( cbuffer.GetResourceHandle() ) );
+            }
+        }
+        else
+        {
+            TrackStateChange( m_boundState.m_shaders[stageIdx], (void*) nullptr );
+        }
+    }
+
+    void RenderContext::SetPipelineState( PipelineState const& pipelineState ) const
+    {
+        EE_ASSERT( IsValid() );
+
+        SetShader( PipelineStage::Vertex, pipelineState.m_pVertexShader );
+        TrackStateChange( m_boundState.m_pInputBinding, (void*) nullptr );
+
+        SetShader( PipelineStage::Geometry, pipelineState.m_pGeometryShader );
+        SetShader( PipelineStage::Hull, pipelineState.m_pHullShader );
+        SetShader( PipelineStage::Compute, pipelineState.m_pComputeShader );
+        SetShader( PipelineStage::Pixel, pipelineState.m_pPixelShader );
+
+        //-------------------------------------------------------------------------
+
+        void* pBlendState = nullptr;
+        if ( pipelineState.m_pBlendState != nullptr && pipelineState.m_pBlendState->IsValid() )
+        {
+            pBlendState = Null::GetResource( pipelineState.m_pBlendState->GetResourceHandle() );
+        }
+        TrackStateChange( m_boundState.m_pBlendState, pBlendState );
+
+        if ( pipelineState.m_pRasterizerState != nullptr && pipelineState.m_pRasterizerState->IsValid() )
+        {
+            TrackStateChange( m_boundState.m_pRasterizerState, (void*) Null::GetResource( pipelineState.m_pRasterizerState->GetResourceHandle() ) );
+            SetRasterizerScissorRectangles( nullptr );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderContext::SetShaderInputBinding( ShaderInputBindingHandle const& inputBinding ) const
+    {
+        EE_ASSERT( IsValid() );
+        TrackStateChange( m_boundState.m_pInputBinding, (void*) Null::GetResource( inputBinding ) );
+    }
+
+    void RenderContext::SetShaderResource( PipelineStage stage, uint32_t slot, ViewSRVHandle const& shaderResourceView ) const
+    {
+        EE_ASSERT( IsValid() );
+        EE_ASSERT( stage != PipelineStage::Domain && stage != PipelineStage::None );
+        EE_ASSERT( slot < s_maxShaderResources );
+        TrackStateChange( m_boundState.m_shaderResources[(uint32_t) stage][slot], (void*) Null::GetResource( shaderResourceView ) );
+    }
+
+    void RenderContext::ClearShaderResource( PipelineStage stage, uint32_t slot ) const
+    {
+        EE_ASSERT( IsValid() );
+        EE_ASSERT( stage != PipelineStage::Domain && stage != PipelineStage::None );
+        EE_ASSERT( slot < s_maxShaderResources );
+        TrackStateChange( m_boundState.m_shaderResources[(uint32_t) stage][slot], (void*) nullptr );
+    }
+
+    void RenderContext::SetUnorderedAccess( PipelineStage stage, uint32_t slot, ViewUAVHandle const& unorderedAccessView ) const
+    {
+        EE_ASSERT( IsValid() && unorderedAccessView.IsValid() );
+        EE_ASSERT( stage == PipelineStage::Compute ); // Only supported for compute
+        EE_ASSERT( slot < s_maxUnorderedAccessViews );
+        TrackStateChange( m_boundState.m_unorderedAccessViews[slot], (void*) Null::GetResource( unorderedAccessView ) );
+    }
+
+    void RenderContext::ClearUnorderedAccess( PipelineStage stage, uint32_t slot ) const
+    {
+        EE_ASSERT( IsValid() );
+        EE_ASSERT( stage == PipelineStage::Compute ); // Only supported for compute
+        EE_ASSERT( slot < s_maxUnorderedAccessViews );
+        TrackStateChange( m_boundState.m_unorderedAccessViews[slot], (void*) nullptr );
+    }
+
+    void RenderContext::SetSampler( PipelineStage stage, uint32_t slot, SamplerState const& state ) const
+    {
+        EE_ASSERT( IsValid() && state.IsValid() );
+        EE_ASSERT( stage != PipelineStage::Domain && stage != PipelineStage::None );
+        EE_ASSERT( slot < s_maxSamplers );
+        TrackStateChange( m_boundState.m_samplers[(uint32_t) stage][slot], (void*) Null::GetResource( state.GetResourceHandle() ) );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void* RenderContext::MapBuffer( RenderBuffer const& buffer ) const
+    {
+        // Check that we have write access to this buffer
+        EE_ASSERT( IsValid() );
+        EE_ASSERT( buffer.IsValid() );
+        EE_ASSERT( buffer.m_usage == RenderBuffer::Usage::CPU_and_GPU ); // Buffer does not allow CPU access
+
+        Null::Resource* pBuffer = Null::GetResource( buffer.GetResourceHandle() );
+        EE_ASSERT( !pBuffer->m_isMapped ); // Buffer is already mapped
+        EE_ASSERT( pBuffer->m_pCPUData != nullptr );
+        pBuffer->m_isMapped = true;
+        return pBuffer->m_pCPUData;
+    }
+
+    void RenderContext::UnmapBuffer( RenderBuffer const& buffer ) const
+    {
+        EE_ASSERT( IsValid() && buffer.IsValid() && buffer.m_usage == RenderBuffer::Usage::CPU_and_GPU );
+
+        Null::Resource* pBuffer = Null::GetResource( buffer.GetResourceHandle() );
+        EE_ASSERT( pBuffer->m_isMapped ); // Unmapping a buffer that wasn't mapped
+        pBuffer->m_isMapped = false;
+
+        // Maps always discard the previous contents so we have to assume the whole buffer was uploaded
+        m_stats.m_numBufferWrites++;
+        m_stats.m_numBytesUploaded += pBuffer->m_byteSize;
+    }
+
+    void RenderContext::WriteToBuffer( RenderBuffer const& buffer, void const* pData, size_t const dataSize ) const
+    {
+        EE_ASSERT( IsValid() && buffer.IsValid() && buffer.m_usage == RenderBuffer::Usage::CPU_and_GPU );
+        EE_ASSERT( pData != nullptr && buffer.m_byteSize >= dataSize );
+
+        Null::Resource* pBuffer = Null::GetResource( buffer.GetResourceHandle() );
+        EE_ASSERT( !pBuffer->m_isMapped );
+        memcpy( pBuffer->m_pCPUData, pData, dataSize );
+
+        m_stats.m_numBufferWrites++;
+        m_stats.m_numBytesUploaded += dataSize;
+    }
+
+    void RenderContext::SetVertexBuffer( RenderBuffer const& buffer, uint32_t offset ) const
+    {
+        EE_ASSERT( IsValid() && buffer.IsValid() && buffer.m_type == RenderBuffer::Type::Vertex );
+        EE_ASSERT( offset < buffer.m_byteSize );
+        TrackStateChange( m_boundState.m_pVertexBuffer, (void*) Null::GetResource( buffer.GetResourceHandle() ) );
+        m_boundState.m_vertexBufferOffset = offset;
+    }
+
+    void RenderContext::SetIndexBuffer( RenderBuffer const& buffer, uint32_t offset ) const
+    {
+        EE_ASSERT( IsValid() && buffer.IsValid() && buffer.m_type == RenderBuffer::Type::Index );
+        EE_ASSERT( buffer.m_byteStride == 2 || buffer.m_byteStride == 4 );
+        EE_ASSERT( offset < buffer.m_byteSize );
+        TrackStateChange( m_boundState.m_pIndexBuffer, (void*) Null::GetResource( buffer.GetResourceHandle() ) );
+        m_boundState.m_indexBufferOffset = offset;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderContext::SetViewport( Float2 dimensions, Float2 topLeft, Float2 rangeZ ) const
+    {
+        EE_ASSERT( IsValid() );
+        EE_ASSERT( dimensions.m_x >= 0 && dimensions.m_y >= 0 );
+        EE_ASSERT( rangeZ.m_x >= 0.0f && rangeZ.m_y <= 1.0f && rangeZ.m_x <= rangeZ.m_y );
+
+        // Count the viewport as a single piece of state
+        Float4 const viewport( topLeft.m_x, topLeft.m_y, dimensions.m_x, dimensions.m_y );
+        if ( m_boundState.m_viewport == viewport && m_boundState.m_viewportDepthRange == rangeZ )
+        {
+            m_stats.m_numRedundantStateChanges++;
+        }
+        else
+        {
+            m_boundState.m_viewport = viewport;
+            m_boundState.m_viewportDepthRange = rangeZ;
+            m_stats.m_numStateChanges++;
+        }
+    }
+
+    void RenderContext::SetDepthTestMode( DepthTestMode mode ) const
+    {
+        EE_ASSERT( IsValid() );
+        TrackStateChange( m_boundState.m_depthTestMode, mode );
+    }
+
+    void RenderContext::SetRasterizerScissorRectangles( ScissorRect const* pScissorRects, uint32_t numRects ) const
+    {
+        EE_ASSERT( IsValid() );
+
+        if ( numRects != 0 )
+        {
+            EE_ASSERT( pScissorRects != nullptr );
+            for ( auto i = 0u; i < numRects; i++ )
+            {
+                EE_ASSERT( pScissorRects[i].m_left <= pScissorRects[i].m_right && pScissorRects[i].m_top <= pScissorRects[i].m_bottom );
+            }
+
+            // We dont keep the rects around so any non-empty set is treated as a change
+            m_boundState.m_numScissorRects = numRects;
+            m_stats.m_numStateChanges++;
+        }
+        else
+        {
+            TrackStateChange( m_boundState.m_numScissorRects, 0u );
+        }
+    }
+
+    void RenderContext::SetBlendState( BlendState const& blendState ) const
+    {
+        EE_ASSERT( IsValid() );
+        TrackStateChange( m_boundState.m_pBlendState, (void*) Null::GetResource( blendState.GetResourceHandle() ) );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderContext::SetRenderTarget( RenderTarget const& renderTarget ) const
+    {
+        EE_ASSERT( IsValid() && renderTarget.IsValid() );
+
+        void* pRenderTargetView = Null::GetResource( renderTarget.GetRenderTargetHandle() );
+        void* pPickingView = renderTarget.HasPickingRT() ? Null::GetResource( renderTarget.GetPickingRenderTargetHandle() ) : nullptr;
+        void* pDepthStencilView = renderTarget.HasDepthStencil() ? Null::GetResource( renderTarget.GetDepthStencilHandle() ) : nullptr;
+
+        // Render targets are set as a single call so treat them as a single piece of state
+        if ( m_boundState.m_renderTargets[0] == pRenderTargetView && m_boundState.m_renderTargets[1] == pPickingView && m_boundState.m_pDepthStencil == pDepthStencilView )
+        {
+            m_stats.m_numRedundantStateChanges++;
+        }
+        else
+        {
+            m_boundState.m_renderTargets[0] = pRenderTargetView;
+            m_boundState.m_renderTargets[1] = pPickingView;
+            m_boundState.m_pDepthStencil = pDepthStencilView;
+            m_stats.m_numStateChanges++;
+        }
+    }
+
+    void RenderContext::SetRenderTarget( ViewDSHandle const& dsView ) const
+    {
+        EE_ASSERT( IsValid() && dsView.IsValid() );
+
+        void* pDepthStencilView = Null::GetResource( dsView );
+        if ( m_boundState.m_renderTargets[0] == nullptr && m_boundState.m_renderTargets[1] == nullptr && m_boundState.m_pDepthStencil == pDepthStencilView )
+        {
+            m_stats.m_numRedundantStateChanges++;
+        }
+        else
+        {
+            m_boundState.m_renderTargets[0] = nullptr;
+            m_boundState.m_renderTargets[1] = nullptr;
+            m_boundState.m_pDepthStencil = pDepthStencilView;
+            m_stats.m_numStateChanges++;
+        }
+    }
+
+    void RenderContext::SetRenderTarget( nullptr_t ) const
+    {
+        EE_ASSERT( IsValid() );
+        m_boundState.m_renderTargets[0] = nullptr;
+        m_boundState.m_renderTargets[1] = nullptr;
+        m_boundState.m_pDepthStencil = nullptr;
+        m_stats.m_numStateChanges++;
+    }
+
+    void RenderContext::ClearDepthStencilView( ViewDSHandle const& dsView, float depth, uint8_t stencil ) const
+    {
+        EE_ASSERT( IsValid() && dsView.IsValid() );
+        EE_ASSERT( depth >= 0.0f && depth <= 1.0f );
+        Null::GetResource( dsView );
+    }
+
+    void RenderContext::ClearRenderTargetViews( RenderTarget const& renderTarget ) const
+    {
+        EE_ASSERT( IsValid() && renderTarget.IsValid() );
+        Null::GetResource( renderTarget.GetRenderTargetHandle() );
+        Null::GetResource( renderTarget.GetDepthStencilHandle() );
+
+        if ( renderTarget.HasPickingRT() )
+        {
+            Null::GetResource( renderTarget.GetPickingRenderTargetHandle() );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderContext::SetPrimitiveTopology( Topology topology ) const
+    {
+        EE_ASSERT( IsValid() );
+        EE_ASSERT( topology != Topology::None );
+        TrackStateChange( m_boundState.m_topology, topology );
+    }
+
+    void RenderContext::ValidateDraw() const
+    {
+        EE_ASSERT( m_boundState.m_shaders[(uint32_t) PipelineStage::Vertex] != nullptr ); // No vertex shader bound
+        EE_ASSERT( m_boundState.m_topology != Topology::None );
+        EE_ASSERT( m_boundState.m_renderTargets[0] != nullptr || m_boundState.m_pDepthStencil != nullptr ); // Nothing to draw into
+        EE_ASSERT( m_boundState.m_viewport.m_z > 0 && m_boundState.m_viewport.m_w > 0 );
+    }
+
+    void RenderContext::Draw( uint32_t vertexCount, uint32_t vertexStartIndex ) const
+    {
+        EE_ASSERT( IsValid() );
+        ValidateDraw();
+
+        m_stats.m_numDrawCalls++;
+        m_stats.m_numVertices += vertexCount;
+    }
+
+    void RenderContext::DrawIndexed( uint32_t vertexCount, uint32_t indexStartIndex, uint32_t vertexStartIndex ) const
+    {
+        EE_ASSERT( IsValid() );
+        ValidateDraw();
+
+        // Ensure we dont read past the end of the index buffer
+        auto pIndexBuffer = reinterpret_cast<Null::Resource*>( m_boundState.m_pIndexBuffer );
+        EE_ASSERT( pIndexBuffer != nullptr );
+        EE_ASSERT( pIndexBuffer->m_validationID == Null::Resource::s_validationID );
+        EE_ASSERT( ( (uint64_t) indexStartIndex + vertexCount ) * pIndexBuffer->m_stride <= pIndexBuffer->m_byteSize );
+
+        m_stats.m_numDrawCalls++;
+        m_stats.m_numVertices += vertexCount;
+    }
+
+    void RenderContext::DrawIndexedInstanced( uint32_t indexCount, uint32_t instanceCount, uint32_t indexStartIndex, uint32_t vertexStartIndex, uint32_t instanceStartIndex ) const
+    {
+        EE_ASSERT( IsValid() );
+        EE_ASSERT( instanceCount > 0 );
+        ValidateDraw();
+
+        auto pIndexBuffer = reinterpret_cast<Null::Resource*>( m_boundState.m_pIndexBuffer );
+        EE_ASSERT( pIndexBuffer != nullptr );
+        EE_ASSERT( pIndexBuffer->m_validationID == Null::Resource::s_validationID );
+        EE_ASSERT( ( (uint64_t) indexStartIndex + indexCount ) * pIndexBuffer->m_stride <= pIndexBuffer->m_byteSize );
+
+        m_stats.m_numDrawCalls++;
+        m_stats.m_numInstances += instanceCount;
+        m_stats.m_numVertices += (uint64_t) indexCount * instanceCount;
+    }
+
+    void RenderContext::Dispatch( uint32_t numGroupsX, uint32_t numGroupsY, uint32_t numGroupsZ ) const
+    {
+        EE_ASSERT( IsValid() );
+        EE_ASSERT( m_boundState.m_shaders[(uint32_t) PipelineStage::Compute] != nullptr ); // No compute shader bound
+        EE_ASSERT( numGroupsX > 0 && numGroupsY > 0 && numGroupsZ > 0 );
+        m_stats.m_numDispatches++;
+    }
+
+    void RenderContext::Present( RenderWindow& window ) const
+    {
+        EE_ASSERT( IsValid() && window.IsValid() );
+        m_stats.m_numPresents++;
+    }
+}
+#endif
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "Base/Render/RenderAPI.h"
+
+#if EE_RENDER_NULL_DEVICE
+#include "Base/_Module/API.h"
+
+#include "Base/Render/RenderStates.h"
+#include "Base/Render/RenderShader.h"
+#include "Base/Render/RenderTexture.h"
+#include "Base/Render/RenderBuffer.h"
+#include "Base/Render/RenderTarget.h"
+#include "Base/Render/RenderWindow.h"
+#include "Base/Render/RenderPipelineState.h"
+
+//-------------------------------------------------------------------------
+// Null Render Context
+//-------------------------------------------------------------------------
+// Accepts all the same calls as the GPU contexts but only validates them and tracks the bound state
+// Every bind is compared against the currently bound state so we can count real and redundant state changes
+
+namespace EE
+{
+    namespace Render
+    {
+        namespace Null
+        {
+            // The API object that all null resource handles point to
+            struct Resource
+            {
+                constexpr static uint32_t const s_validationID = 0x4E554C4C;
+
+                Resource( ResourceType type, uint32_t byteSize = 0, uint32_t stride = 0, PipelineStage stage = PipelineStage::None )
+                    : m_type( type )
+                    , m_stage( stage )
+                    , m_byteSize( byteSize )
+                    , m_stride( stride )
+                {}
+
+                uint32_t                        m_validationID = s_validationID;
+                ResourceType                    m_type = ResourceType::None;
+                PipelineStage                   m_stage = PipelineStage::None;
+                bool                            m_isMapped = false;
+                uint32_t                        m_byteSize = 0;
+                uint32_t                        m_stride = 0;
+                uint8_t*                        m_pCPUData = nullptr;       // Backing memory for CPU writable buffers
+            };
+
+            template<ResourceType T>
+            EE_FORCE_INLINE Resource* GetResource( ObjectHandle<T> const& handle )
+            {
+                if ( !handle.IsValid() )
+                {
+                    return nullptr;
+                }
+
+                auto pResource = reinterpret_cast<Resource*>( handle.m_pData );
+                EE_ASSERT( pResource->m_validationID == Resource::s_validationID ); // Not a null device resource or it's already been destroyed
+                EE_ASSERT( pResource->m_type == T );
+                return pResource;
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        struct RenderStats
+        {
+            inline void Reset() { *this = RenderStats(); }
+
+        public:
+
+            uint32_t                            m_numDrawCalls = 0;
+            uint32_t                            m_numDispatches = 0;
+            uint32_t                            m_numInstances = 0;         // Only counts instanced draws
+            uint64_t                            m_numVertices = 0;          // Index count for indexed draws
+            uint32_t                            m_numStateChanges = 0;
+            uint32_t                            m_numRedundantStateChanges = 0;
+            uint32_t                            m_numBufferWrites = 0;
+            uint64_t                            m_numBytesUploaded = 0;
+            uint32_t                            m_numPresents = 0;
+        };
+
+        //-------------------------------------------------------------------------
+
+        class EE_BASE_API RenderContext
+        {
+            friend class RenderDevice;
+
+            constexpr static uint32_t const s_maxConstantBuffers = 14;
+            constexpr static uint32_t const s_maxShaderResources = 16;
+            constexpr static uint32_t const s_maxSamplers = 16;
+            constexpr static uint32_t const s_maxUnorderedAccessViews = 8;
+            constexpr static uint32_t const s_numStages = (uint32_t) PipelineStage::None;
+
+            struct BoundState
+            {
+                void*                           m_shaders[s_numStages] = {};
+                void*                           m_constantBuffers[s_numStages][s_maxConstantBuffers] = {};
+                void*                           m_shaderResources[s_numStages][s_maxShaderResources] = {};
+                void*                           m_samplers[s_numStages][s_maxSamplers] = {};
+                void*                           m_unorderedAccessViews[s_maxUnorderedAccessViews] = {};
+                void*                           m_pInputBinding = nullptr;
+                void*                           m_pVertexBuffer = nullptr;
+                void*                           m_pIndexBuffer = nullptr;
+                uint32_t                        m_vertexBufferOffset = 0;
+                uint32_t                        m_indexBufferOffset = 0;
+                void*                           m_pBlendState = nullptr;
+                void*                           m_pRasterizerState = nullptr;
+                void*                           m_renderTargets[2] = {};
+                void*                           m_pDepthStencil = nullptr;
+                Float4                          m_viewport = Float4::Zero;
+                Float2                          m_viewportDepthRange = Float2::Zero;
+                uint32_t                        m_numScissorRects = 0;
+                DepthTestMode                   m_depthTestMode = DepthTestMode::On;
+                Topology                        m_topology = Topology::None;
+            };
+
+        public:
+
+            RenderContext() = default;
+
+            inline bool IsValid() const { return m_isValid; }
+
+            void SetPipelineState( PipelineState const& pipelineState ) const;
+
+            // Shaders
+            void SetShaderInputBinding( ShaderInputBindingHandle const& inputBinding ) const;
+            void SetShaderResource( PipelineStage stage, uint32_t slot, ViewSRVHandle const& shaderResourceView ) const;
+            void ClearShaderResource( PipelineStage stage, uint32_t slot ) const;
+            void SetUnorderedAccess( PipelineStage stage, uint32_t slot, ViewUAVHandle const& shaderResourceView ) const;
+            void ClearUnorderedAccess( PipelineStage stage, uint32_t slot ) const;
+            void SetSampler( PipelineStage stage, uint32_t slot, SamplerState const& state ) const;
+
+            // Buffers
+            void* MapBuffer( RenderBuffer const& buffer ) const;
+            void UnmapBuffer( RenderBuffer const& buffer ) const;
+            void WriteToBuffer( RenderBuffer const& buffer, void const* pData, size_t const dataSize ) const;
+            void SetVertexBuffer( RenderBuffer const& buffer, uint32_t offset = 0 ) const;
+            void SetIndexBuffer( RenderBuffer const& buffer, uint32_t offset = 0 ) const;
+
+            // Rasterizer
+            void SetViewport( Float2 dimensions, Float2 topLeft, Float2 zRange = Float2(0, 1) ) const;
+            void SetDepthTestMode( DepthTestMode mode ) const;
+            void SetRasterizerScissorRectangles( ScissorRect const* pScissorRects, uint32_t numRects = 0 ) const;
+            void SetBlendState( BlendState const& blendState ) const;
+
+            // Render Targets
+            void SetRenderTarget( RenderTarget const& renderTarget ) const;
+            void SetRenderTarget( ViewDSHandle const& dsView ) const;
+            void SetRenderTarget( nullptr_t ) const;
+            void ClearDepthStencilView( ViewDSHandle const& dsView, float depth, uint8_t stencil ) const;
+            void ClearRenderTargetViews( RenderTarget const& renderTarget ) const;
+
+            // Drawing
+            void SetPrimitiveTopology( Topology topology ) const;
+            void Draw( uint32_t vertexCount, uint32_t vertexStartIndex = 0 ) const;
+            void DrawIndexed( uint32_t vertexCount, uint32_t indexStartIndex = 0, uint32_t vertexStartIndex = 0 ) const;
+            void DrawIndexedInstanced( uint32_t indexCount, uint32_t instanceCount, uint32_t indexStartIndex = 0, uint32_t vertexStartIndex = 0, uint32_t instanceStartIndex = 0 ) const;
+
+            void Dispatch( uint32_t numGroupsX, uint32_t numGroupsY, uint32_t numGroupsZ ) const;
+
+            // Window
+            void Present( RenderWindow& window ) const;
+
+            // Stats
+            inline RenderStats const& GetStats() const { return m_stats; }
+            inline void ResetStats() { m_stats.Reset(); }
+
+        private:
+
+            void SetShader( PipelineStage stage, Shader const* pShader ) const;
+            void ValidateDraw() const;
+
+            // Update a piece of bound state, returns true if the state actually changed
+            template<typename T>
+            inline bool TrackStateChange( T& boundState, T const& newState ) const
+            {
+                if ( boundState == newState )
+                {
+                    m_stats.m_numRedundantStateChanges++;
+                    return false;
+                }
+
+                boundState = newState;
+                m_stats.m_numStateChanges++;
+                return true;
+            }
+
+        private:
+
+            mutable BoundState                  m_boundState;
+            mutable RenderStats                 m_stats;
+            bool                                m_isValid = false;
+        };
+    }
+}
+
+#endif
@@ -1,4 +1,6 @@
 #include "RenderDevice_DX11.h"
+
+#if _WIN32 && !EE_RENDER_NULL_DEVICE
 #include "TextureLoader_Win32.h"
 #include "Base/Render/RenderCoreResources.h"
 #include "Base/IniFile.h"
@@ -545,6 +547,12 @@ namespace EE::Render
             EE_ASSERT( buffer.m_byteStride == 2 || buffer.m_byteStride == 4 ); // only 16/32 bit indices support
             break;
 
+            case RenderBuffer::Type::Structured:
+            bufferDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+            bufferDesc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+            EE_ASSERT( buffer.m_byteSize % buffer.m_byteStride == 0 );
+            break;
+
             default:
             EE_HALT();
         }
@@ -560,6 +568,20 @@ namespace EE::Render
         // Create and store buffer
         m_pDevice->CreateBuffer( &bufferDesc, pInitializationData == nullptr ? nullptr : &initData, (ID3D11Buffer**) &buffer.m_resourceHandle.m_pData );
         EE_ASSERT( buffer.IsValid() );
+
+        // Create shader resource view for structured buffers
+        if ( buffer.m_type == RenderBuffer::Type::Structured )
+        {
+            D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
+            Memory::MemsetZero( &srvDesc, sizeof( srvDesc ) );
+            srvDesc.Format = DXGI_FORMAT_UNKNOWN;
+            srvDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+            srvDesc.Buffer.FirstElement = 0;
+            srvDesc.Buffer.NumElements = buffer.GetNumElements();
+
+            auto result = m_pDevice->CreateShaderResourceView( (ID3D11Buffer*) buffer.m_resourceHandle.m_pData, &srvDesc, (ID3D11ShaderResourceView**) &buffer.m_shaderResourceView.m_pData );
+            EE_ASSERT( SUCCEEDED( result ) );
+        }
     }
 
     void RenderDevice::ResizeBuffer( RenderBuffer& buffer, uint32_t newSize )
@@ -567,6 +589,12 @@ namespace EE::Render
         EE_ASSERT( buffer.IsValid() && newSize % buffer.m_byteStride == 0 );
 
         // Release D3D buffer
+        if ( buffer.m_shaderResourceView.IsValid() )
+        {
+            ( (ID3D11ShaderResourceView*) buffer.m_shaderResourceView.m_pData )->Release();
+            buffer.m_shaderResourceView.m_pData = nullptr;
+        }
+
         ( (ID3D11Buffer*) buffer.m_resourceHandle.m_pData )->Release();
         buffer.m_resourceHandle.m_pData = nullptr;
         buffer.m_byteSize = newSize;
@@ -579,6 +607,12 @@ namespace EE::Render
 
         if ( buffer.IsValid() )
         {
+            if ( buffer.m_shaderResourceView.IsValid() )
+            {
+                ( (ID3D11ShaderResourceView*) buffer.m_shaderResourceView.m_pData )->Release();
+                buffer.m_shaderResourceView.Reset();
+            }
+
             ( (ID3D11Buffer*) buffer.m_resourceHandle.m_pData )->Release();
             buffer.m_resourceHandle.Reset();
             buffer = RenderBuffer();
@@ -627,7 +661,13 @@ namespace EE::Render
             DXGI_FORMAT_R32G32B32_FLOAT,
             DXGI_FORMAT_R32G32B32A32_FLOAT,
 
-            DXGI_FORMAT_R32_TYPELESS
+            DXGI_FORMAT_R32_TYPELESS,
+
+            DXGI_FORMAT_R16G16_UNORM,
+            DXGI_FORMAT_R16G16B16A16_UNORM,
+
+            DXGI_FORMAT_R16G16_SNORM,
+            DXGI_FORMAT_R16G16B16A16_SNORM
         };
 
         EE_FORCE_INLINE static DXGI_FORMAT GetDXGIFormat( DataFormat format  )
@@ -1272,4 +1312,5 @@ namespace EE::Render
 
         return pickingID;
     }
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
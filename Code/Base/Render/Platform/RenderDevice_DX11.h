@@ -1,6 +1,8 @@
 #pragma once
-#ifdef _WIN32
 
+#include "Base/Render/RenderAPI.h"
+
+#if _WIN32 && !EE_RENDER_NULL_DEVICE
 #include "RenderContext_DX11.h"
 #include "Base/Types/Color.h"
 #include "Base/Threading/Threading.h"
@@ -0,0 +1,512 @@
+#include "RenderDevice_Null.h"
+
+#if EE_RENDER_NULL_DEVICE
+#include "Base/Render/RenderCoreResources.h"
+#include "Base/IniFile.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render
+{
+    template<ResourceType T>
+    void RenderDevice::CreateResource( ObjectHandle<T>& handle, uint32_t byteSize, uint32_t stride, PipelineStage stage )
+    {
+        EE_ASSERT( !handle.IsValid() );
+        handle.m_pData = EE::New<Null::Resource>( T, byteSize, stride, stage );
+        m_numLiveResources++;
+    }
+
+    template<ResourceType T>
+    void RenderDevice::DestroyResource( ObjectHandle<T>& handle )
+    {
+        Null::Resource* pResource = Null::GetResource( handle );
+        EE_ASSERT( pResource != nullptr );
+        EE_ASSERT( !pResource->m_isMapped ); // Destroying a mapped resource
+
+        if ( pResource->m_pCPUData != nullptr )
+        {
+            EE::Free( pResource->m_pCPUData );
+        }
+
+        // Clear the validation ID so that any dangling handles assert if they are used before the memory is reused
+        pResource->m_validationID = 0;
+        EE::Delete( pResource );
+        handle.Reset();
+
+        m_numLiveResources--;
+        EE_ASSERT( m_numLiveResources >= 0 );
+    }
+
+    //-------------------------------------------------------------------------
+
+    RenderDevice::~RenderDevice()
+    {
+        EE_ASSERT( !m_immediateContext.IsValid() );
+        EE_ASSERT( !m_primaryWindow.IsValid() );
+        EE_ASSERT( !m_primaryWindow.m_renderTarget.IsValid() );
+        EE_ASSERT( !m_isInitialized );
+    }
+
+    bool RenderDevice::IsInitialized() const
+    {
+        return m_isInitialized;
+    }
+
+    bool RenderDevice::Initialize( IniFile const& iniFile )
+    {
+        EE_ASSERT( iniFile.IsValid() );
+
+        m_resolution.m_x = iniFile.GetIntOrDefault( "Render:ResolutionX", 1280 );
+        m_resolution.m_y = iniFile.GetIntOrDefault( "Render:ResolutionY", 720 );
+
+        //-------------------------------------------------------------------------
+
+        if ( m_resolution.m_x <= 0 || m_resolution.m_y <= 0 )
+        {
+            EE_LOG_ERROR( "Render", "Render Device", "Invalid render settings read from ini file." );
+            return false;
+        }
+
+        return Initialize();
+    }
+
+    bool RenderDevice::Initialize()
+    {
+        EE_ASSERT( !m_isInitialized );
+        EE_ASSERT( m_numLiveResources == 0 );
+
+        m_isInitialized = true;
+        m_immediateContext.m_isValid = true;
+
+        if ( !CreateWindowRenderTarget( m_primaryWindow, m_resolution ) )
+        {
+            return false;
+        }
+
+        // Set OM default state
+        m_immediateContext.SetRenderTarget( m_primaryWindow.m_renderTarget );
+        m_immediateContext.ClearRenderTargetViews( m_primaryWindow.m_renderTarget );
+        m_immediateContext.SetDepthTestMode( DepthTestMode::On );
+
+        CoreResources::Initialize( this );
+
+        m_immediateContext.ResetStats();
+        return true;
+    }
+
+    void RenderDevice::Shutdown()
+    {
+        CoreResources::Shutdown( this );
+
+        DestroyWindow( m_primaryWindow );
+
+        m_immediateContext.m_boundState = RenderContext::BoundState();
+        m_immediateContext.m_isValid = false;
+
+        if ( m_numLiveResources != 0 )
+        {
+            EE_LOG_WARNING( "Render", "Render Device", "%d render resources were not destroyed before the device was shutdown!", (int32_t) m_numLiveResources );
+        }
+
+        m_isInitialized = false;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool RenderDevice::CreateWindowRenderTarget( RenderWindow& window, Int2 dimensions )
+    {
+        EE_ASSERT( IsInitialized() && !window.IsValid() );
+
+        if ( dimensions.m_x <= 0 || dimensions.m_y <= 0 )
+        {
+            EE_LOG_ERROR( "Render", "Render Device", "Invalid window dimensions: %d x %d", dimensions.m_x, dimensions.m_y );
+            return false;
+        }
+
+        // There is no swap chain, so just store a record to keep the window valid
+        window.m_pSwapChain = EE::New<Null::Resource>( ResourceType::RenderTarget );
+        m_numLiveResources++;
+
+        CreateRenderTarget( window.m_renderTarget, dimensions );
+        return true;
+    }
+
+    void RenderDevice::DestroyWindow( RenderWindow& window )
+    {
+        if ( window.m_renderTarget.IsValid() )
+        {
+            DestroyRenderTarget( window.m_renderTarget );
+        }
+
+        if ( window.m_pSwapChain != nullptr )
+        {
+            auto pSwapChain = reinterpret_cast<Null::Resource*>( window.m_pSwapChain );
+            EE_ASSERT( pSwapChain->m_validationID == Null::Resource::s_validationID && pSwapChain->m_type == ResourceType::RenderTarget );
+            pSwapChain->m_validationID = 0;
+            EE::Delete( pSwapChain );
+            window.m_pSwapChain = nullptr;
+            m_numLiveResources--;
+        }
+    }
+
+    void RenderDevice::PresentFrame()
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        EE_ASSERT( IsInitialized() );
+
+        m_immediateContext.Present( m_primaryWindow );
+        m_immediateContext.SetRenderTarget( m_primaryWindow.m_renderTarget );
+        m_immediateContext.ClearRenderTargetViews( m_primaryWindow.m_renderTarget );
+    }
+
+    void RenderDevice::ResizePrimaryWindowRenderTarget( Int2 const& dimensions )
+    {
+        EE_ASSERT( dimensions.m_x > 0 && dimensions.m_y > 0 );
+        ResizeWindow( m_primaryWindow, dimensions );
+        m_immediateContext.SetRenderTarget( m_primaryWindow.m_renderTarget );
+        m_immediateContext.ClearRenderTargetViews( m_primaryWindow.m_renderTarget );
+        m_resolution = dimensions;
+    }
+
+    void RenderDevice::CreateSecondaryRenderWindow( RenderWindow& window, void* platformWindowHandle )
+    {
+        EE_ASSERT( platformWindowHandle != nullptr );
+
+        // We have no way to query the platform window so start at the primary window size, the window will be resized as needed
+        CreateWindowRenderTarget( window, m_resolution );
+    }
+
+    void RenderDevice::DestroySecondaryRenderWindow( RenderWindow& window )
+    {
+        EE_ASSERT( window.IsValid() );
+        DestroyWindow( window );
+    }
+
+    void RenderDevice::ResizeWindow( RenderWindow& window, Int2 const& dimensions )
+    {
+        EE_ASSERT( window.IsValid() );
+        EE_ASSERT( dimensions.m_x > 0 && dimensions.m_y > 0 );
+
+        // Unbind everything since the previous targets are about to be destroyed
+        m_immediateContext.SetRenderTarget( nullptr );
+        ResizeRenderTarget( window.m_renderTarget, dimensions );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderDevice::CreateShader( Shader& shader )
+    {
+        EE_ASSERT( IsInitialized() && !shader.IsValid() );
+        EE_ASSERT( !shader.m_byteCode.empty() );
+
+        PipelineStage const stage = shader.GetPipelineStage();
+        if ( stage == PipelineStage::Vertex || stage == PipelineStage::Pixel || stage == PipelineStage::Geometry || stage == PipelineStage::Compute )
+        {
+            CreateResource( shader.m_shaderHandle, (uint32_t) shader.m_byteCode.size(), 0, stage );
+        }
+        else //  Hull / Domain / etc...
+        {
+            EE_UNIMPLEMENTED_FUNCTION();
+        }
+
+        // Create buffers const for shader
+        for ( auto& cbuffer : shader.m_cbuffers )
+        {
+            CreateBuffer( cbuffer );
+            EE_ASSERT( cbuffer.IsValid() );
+        }
+
+        EE_ASSERT( shader.IsValid() );
+    }
+
+    void RenderDevice::DestroyShader( Shader& shader )
+    {
+        EE_ASSERT( IsInitialized() && shader.IsValid() && shader.GetPipelineStage() != PipelineStage::None );
+
+        DestroyResource( shader.m_shaderHandle );
+
+        for ( auto& cbuffer : shader.m_cbuffers )
+        {
+            DestroyBuffer( cbuffer );
+        }
+        shader.m_cbuffers.clear();
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderDevice::CreateBuffer( RenderBuffer& buffer, void const* pInitializationData )
+    {
+        EE_ASSERT( IsInitialized() && !buffer.IsValid() );
+        EE_ASSERT( buffer.m_byteSize > 0 && buffer.m_byteStride > 0 );
+        EE_ASSERT( buffer.m_type != RenderBuffer::Type::Unknown );
+
+        // Constant buffers need to be 16 byte aligned
+        if ( buffer.m_type == RenderBuffer::Type::Constant )
+        {
+            EE_ASSERT( buffer.m_byteSize % 16 == 0 );
+        }
+        else
+        {
+            EE_ASSERT( buffer.m_byteSize % buffer.m_byteStride == 0 );
+        }
+
+        // Immutable GPU buffers need their data up front
+        EE_ASSERT( buffer.m_usage == RenderBuffer::Usage::CPU_and_GPU || buffer.m_type == RenderBuffer::Type::Constant || pInitializationData != nullptr );
+
+        CreateResource( buffer.m_resourceHandle, buffer.m_byteSize, buffer.m_byteStride );
+
+        if ( buffer.m_type == RenderBuffer::Type::Structured )
+        {
+            CreateResource( buffer.m_shaderResourceView );
+        }
+
+        if ( buffer.m_usage == RenderBuffer::Usage::CPU_and_GPU )
+        {
+            auto pResource = Null::GetResource( buffer.m_resourceHandle );
+            pResource->m_pCPUData = (uint8_t*) EE::Alloc( buffer.m_byteSize );
+            if ( pInitializationData != nullptr )
+            {
+                memcpy( pResource->m_pCPUData, pInitializationData, buffer.m_byteSize );
+            }
+        }
+
+        if ( pInitializationData != nullptr )
+        {
+            m_numResourceBytesUploaded += buffer.m_byteSize;
+        }
+    }
+
+    void RenderDevice::ResizeBuffer( RenderBuffer& buffer, uint32_t newSize )
+    {
+        EE_ASSERT( buffer.IsValid() && newSize % buffer.m_byteStride == 0 );
+
+        if ( buffer.m_shaderResourceView.IsValid() )
+        {
+            DestroyResource( buffer.m_shaderResourceView );
+        }
+
+        DestroyResource( buffer.m_resourceHandle );
+        buffer.m_byteSize = newSize;
+        CreateBuffer( buffer );
+    }
+
+    void RenderDevice::DestroyBuffer( RenderBuffer& buffer )
+    {
+        EE_ASSERT( IsInitialized() );
+
+        if ( buffer.IsValid() )
+        {
+            if ( buffer.m_shaderResourceView.IsValid() )
+            {
+                DestroyResource( buffer.m_shaderResourceView );
+            }
+
+            DestroyResource( buffer.m_resourceHandle );
+            buffer = RenderBuffer();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderDevice::CreateShaderInputBinding( VertexShader const& shader, VertexLayoutDescriptor const& vertexLayoutDesc, ShaderInputBindingHandle& inputBinding )
+    {
+        EE_ASSERT( IsInitialized() && shader.IsValid() && !inputBinding.IsValid() );
+
+        // Every element the shader expects needs to be provided by the vertex layout
+        auto const& shaderVertexLayoutDesc = shader.GetVertexLayoutDesc();
+        for ( auto const& shaderVertexElementDesc : shaderVertexLayoutDesc.m_elementDescriptors )
+        {
+            bool elementFound = false;
+            for ( auto const& vertexElementDesc : vertexLayoutDesc.m_elementDescriptors )
+            {
+                if ( shaderVertexElementDesc.m_semantic == vertexElementDesc.m_semantic && shaderVertexElementDesc.m_semanticIndex == vertexElementDesc.m_semanticIndex )
+                {
+                    elementFound = true;
+                    break;
+                }
+            }
+
+            if ( !elementFound )
+            {
+                EE_LOG_ERROR( "Render", "Render Device", "Vertex layout doesnt match the shader input layout!" );
+                return;
+            }
+        }
+
+        CreateResource( inputBinding, vertexLayoutDesc.m_byteSize );
+    }
+
+    void RenderDevice::DestroyShaderInputBinding( ShaderInputBindingHandle& inputBinding )
+    {
+        EE_ASSERT( IsInitialized() && inputBinding.IsValid() );
+        DestroyResource( inputBinding );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderDevice::CreateRasterizerState( RasterizerState& state )
+    {
+        EE_ASSERT( IsInitialized() && !state.IsValid() );
+        CreateResource( state.m_resourceHandle );
+    }
+
+    void RenderDevice::DestroyRasterizerState( RasterizerState& state )
+    {
+        EE_ASSERT( IsInitialized() && state.IsValid() );
+        DestroyResource( state.m_resourceHandle );
+    }
+
+    void RenderDevice::CreateBlendState( BlendState& state )
+    {
+        EE_ASSERT( IsInitialized() && !state.IsValid() );
+        CreateResource( state.m_resourceHandle );
+    }
+
+    void RenderDevice::DestroyBlendState( BlendState& state )
+    {
+        EE_ASSERT( IsInitialized() && state.IsValid() );
+        DestroyResource( state.m_resourceHandle );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderDevice::CreateDataTexture( Texture& texture, TextureFormat format, uint8_t const* pRawData, size_t rawDataSize )
+    {
+        EE_ASSERT( IsInitialized() && !texture.IsValid() );
+        EE_ASSERT( pRawData != nullptr && rawDataSize > 0 );
+
+        // Read the dimensions from the DDS header (magic number followed by the size, flags, height and width)
+        if ( format == TextureFormat::DDS )
+        {
+            constexpr static uint32_t const ddsMagic = 0x20534444;
+            EE_ASSERT( rawDataSize >= sizeof( uint32_t ) * 5 && *reinterpret_cast<uint32_t const*>( pRawData ) == ddsMagic );
+            uint32_t const* pHeader = reinterpret_cast<uint32_t const*>( pRawData );
+            texture.m_dimensions = Int2( (int32_t) pHeader[4], (int32_t) pHeader[3] );
+        }
+
+        CreateResource( texture.m_textureHandle, (uint32_t) rawDataSize );
+        CreateResource( texture.m_shaderResourceView );
+        m_numResourceBytesUploaded += rawDataSize;
+    }
+
+    void RenderDevice::CreateTexture( Texture& texture, DataFormat format, Int2 dimensions, uint32_t usage )
+    {
+        EE_ASSERT( IsInitialized() && !texture.IsValid() );
+        EE_ASSERT( format != DataFormat::Unknown && format != DataFormat::Count );
+        EE_ASSERT( dimensions.m_x > 0 && dimensions.m_y > 0 );
+
+        texture.m_dimensions = dimensions;
+
+        CreateResource( texture.m_textureHandle );
+
+        if ( usage & USAGE_SRV )
+        {
+            CreateResource( texture.m_shaderResourceView );
+        }
+
+        if ( usage & USAGE_UAV )
+        {
+            CreateResource( texture.m_unorderedAccessView );
+        }
+
+        if ( usage & USAGE_RT_DS )
+        {
+            // Float_X32 is the only format that is treated as a depth stencil format
+            if ( format == DataFormat::Float_X32 )
+            {
+                CreateResource( texture.m_depthStencilView );
+            }
+            else
+            {
+                CreateResource( texture.m_renderTargetView );
+            }
+        }
+    }
+
+    void RenderDevice::DestroyTexture( Texture& texture )
+    {
+        EE_ASSERT( IsInitialized() && texture.IsValid() );
+
+        DestroyResource( texture.m_textureHandle );
+
+        if ( texture.m_shaderResourceView.IsValid() )
+        {
+            DestroyResource( texture.m_shaderResourceView );
+        }
+
+        if ( texture.m_unorderedAccessView.IsValid() )
+        {
+            DestroyResource( texture.m_unorderedAccessView );
+        }
+
+        if ( texture.m_renderTargetView.IsValid() )
+        {
+            DestroyResource( texture.m_renderTargetView );
+        }
+
+        if ( texture.m_depthStencilView.IsValid() )
+        {
+            DestroyResource( texture.m_depthStencilView );
+        }
+    }
+
+    void RenderDevice::CreateSamplerState( SamplerState& state )
+    {
+        EE_ASSERT( IsInitialized() && !state.IsValid() );
+        EE_ASSERT( state.m_minLOD <= state.m_maxLOD );
+        CreateResource( state.m_resourceHandle );
+    }
+
+    void RenderDevice::DestroySamplerState( SamplerState& state )
+    {
+        EE_ASSERT( IsInitialized() );
+        EE_ASSERT( state.IsValid() );
+        DestroyResource( state.m_resourceHandle );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderDevice::CreateRenderTarget( RenderTarget& renderTarget, Int2 const& dimensions, bool createPickingTarget )
+    {
+        EE_ASSERT( IsInitialized() && !renderTarget.IsValid() );
+        EE_ASSERT( dimensions.m_x >= 0 && dimensions.m_y >= 0 );
+        CreateTexture( renderTarget.m_RT, DataFormat::UNorm_R8G8B8A8, dimensions, USAGE_SRV | USAGE_RT_DS );
+        CreateTexture( renderTarget.m_DS, DataFormat::Float_X32, dimensions, USAGE_RT_DS );
+
+        if ( createPickingTarget )
+        {
+            CreateTexture( renderTarget.m_pickingRT, DataFormat::UInt_R32G32B32A32, dimensions, USAGE_SRV | USAGE_RT_DS );
+            CreateTexture( renderTarget.m_pickingStagingTexture, DataFormat::UInt_R32G32B32A32, Int2( 1, 1 ), USAGE_STAGING );
+        }
+    }
+
+    void RenderDevice::ResizeRenderTarget( RenderTarget& renderTarget, Int2 const& newDimensions )
+    {
+        EE_ASSERT( IsInitialized() && renderTarget.IsValid() );
+        bool const createPickingRT = renderTarget.HasPickingRT();
+        DestroyRenderTarget( renderTarget );
+        CreateRenderTarget( renderTarget, newDimensions, createPickingRT );
+    }
+
+    void RenderDevice::DestroyRenderTarget( RenderTarget& renderTarget )
+    {
+        EE_ASSERT( IsInitialized() && renderTarget.IsValid() );
+        DestroyTexture( renderTarget.m_RT );
+        DestroyTexture( renderTarget.m_DS );
+
+        if ( renderTarget.m_pickingRT.IsValid() )
+        {
+            DestroyTexture( renderTarget.m_pickingRT );
+            DestroyTexture( renderTarget.m_pickingStagingTexture );
+        }
+    }
+
+    PickingID RenderDevice::ReadBackPickingID( RenderTarget const& renderTarget, Int2 const& pixelCoords )
+    {
+        EE_ASSERT( IsInitialized() && renderTarget.IsValid() );
+        return PickingID();
+    }
+}
+#endif
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "Base/Render/RenderAPI.h"
+
+#if EE_RENDER_NULL_DEVICE
+#include "RenderContext_Null.h"
+#include "Base/Types/Color.h"
+#include "Base/Threading/Threading.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+
+namespace EE { class IniFile; }
+
+//-------------------------------------------------------------------------
+// Null Render Device
+//-------------------------------------------------------------------------
+// A render device that doesnt need a GPU or a window, all resources are lightweight records that are validated on use
+// CPU writable buffers keep a backing allocation so that mapping and writing behave like the real device
+// This allows the CPU side of the renderers to be run and measured on headless machines
+
+namespace EE::Render
+{
+    class EE_BASE_API RenderDevice
+    {
+
+    public:
+
+        RenderDevice() = default;
+        ~RenderDevice();
+
+        //-------------------------------------------------------------------------
+
+        bool IsInitialized() const;
+        bool Initialize( IniFile const& iniFile );
+        bool Initialize();
+        void Shutdown();
+
+        inline RenderContext const& GetImmediateContext() const { return m_immediateContext; }
+        void PresentFrame();
+
+        // Device locking: required since we create/destroy resources while rendering
+        //-------------------------------------------------------------------------
+
+        void LockDevice() { m_deviceMutex.lock(); }
+        void UnlockDevice() { m_deviceMutex.unlock(); }
+
+        // Swap Chains
+        //-------------------------------------------------------------------------
+
+        RenderTarget const* GetPrimaryWindowRenderTarget() const { return &m_primaryWindow.m_renderTarget; }
+        RenderTarget* GetPrimaryWindowRenderTarget() { return &m_primaryWindow.m_renderTarget; }
+        inline Int2 GetPrimaryWindowDimensions() const { return m_resolution; }
+
+        void CreateSecondaryRenderWindow( RenderWindow& window, void* platformWindowHandle );
+        void DestroySecondaryRenderWindow( RenderWindow& window );
+
+        void ResizeWindow( RenderWindow& window, Int2 const& dimensions );
+        void ResizePrimaryWindowRenderTarget( Int2 const& dimensions );
+
+        // Resource and state management
+        //-------------------------------------------------------------------------
+
+        // Shaders
+        void CreateShader( Shader& shader );
+        void DestroyShader( Shader& shader );
+
+        // Buffers
+        void CreateBuffer( RenderBuffer& buffer, void const* pInitializationData = nullptr );
+        void ResizeBuffer( RenderBuffer& buffer, uint32_t newSize );
+        void DestroyBuffer( RenderBuffer& buffer );
+
+        // Vertex shader input mappings
+        void CreateShaderInputBinding( VertexShader const& shader, VertexLayoutDescriptor const& vertexLayoutDesc, ShaderInputBindingHandle& inputBinding );
+        void DestroyShaderInputBinding( ShaderInputBindingHandle& inputBinding );
+
+        // Rasterizer
+        void CreateRasterizerState( RasterizerState& stateDesc );
+        void DestroyRasterizerState( RasterizerState& state );
+
+        void CreateBlendState( BlendState& stateDesc );
+        void DestroyBlendState( BlendState& state );
+
+        // Textures and Sampling
+        void CreateDataTexture( Texture& texture, TextureFormat format, uint8_t const* rawData, size_t size );
+        inline void CreateDataTexture( Texture& texture, TextureFormat format, Blob const& rawData ) { CreateDataTexture( texture, format, rawData.data(), rawData.size() ); }
+        void CreateTexture( Texture& texture, DataFormat format, Int2 dimensions, uint32_t usage );
+        void DestroyTexture( Texture& texture );
+
+        void CreateSamplerState( SamplerState& state );
+        void DestroySamplerState( SamplerState& state );
+
+        // Render Targets
+        void CreateRenderTarget( RenderTarget& renderTarget, Int2 const& dimensions, bool createPickingTarget = false );
+        void ResizeRenderTarget( RenderTarget& renderTarget, Int2 const& newDimensions );
+        void DestroyRenderTarget( RenderTarget& renderTarget );
+
+        // Picking - there is no GPU so this always returns an unset ID
+        PickingID ReadBackPickingID( RenderTarget const& renderTarget, Int2 const& pixelCoords );
+
+        // Stats
+        //-------------------------------------------------------------------------
+
+        inline RenderStats const& GetStats() const { return m_immediateContext.GetStats(); }
+        inline void ResetStats() { m_immediateContext.ResetStats(); }
+
+        inline int32_t GetNumLiveResources() const { return m_numLiveResources; }
+        inline uint64_t GetNumResourceBytesUploaded() const { return m_numResourceBytesUploaded; }
+
+    private:
+
+        bool CreateWindowRenderTarget( RenderWindow& renderWindow, Int2 dimensions );
+        void DestroyWindow( RenderWindow& renderWindow );
+
+        template<ResourceType T>
+        void CreateResource( ObjectHandle<T>& handle, uint32_t byteSize = 0, uint32_t stride = 0, PipelineStage stage = PipelineStage::None );
+
+        template<ResourceType T>
+        void DestroyResource( ObjectHandle<T>& handle );
+
+    private:
+
+        Int2                        m_resolution = Int2( 1280, 720 );
+        bool                        m_isInitialized = false;
+
+        RenderWindow                m_primaryWindow;
+        RenderContext               m_immediateContext;
+
+        // Resources can be created from any thread
+        std::atomic<int32_t>        m_numLiveResources = 0;
+        std::atomic<uint64_t>       m_numResourceBytesUploaded = 0;
+
+        // Lock to allow loading resources while rendering across different threads
+        Threading::RecursiveMutex   m_deviceMutex;
+    };
+}
+
+#endif
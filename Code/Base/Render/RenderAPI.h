@@ -2,6 +2,20 @@
 
 #include "Base/Esoterica.h"
 
+//-------------------------------------------------------------------------
+// Render Backend
+//-------------------------------------------------------------------------
+// The null device accepts and validates all resource creation and submission calls without needing a GPU
+// It is used on platforms without a GPU backend and can be forced on windows by defining EE_RENDER_NULL_DEVICE=1 (i.e. for headless runs)
+
+#ifndef EE_RENDER_NULL_DEVICE
+    #if _WIN32
+        #define EE_RENDER_NULL_DEVICE 0
+    #else
+        #define EE_RENDER_NULL_DEVICE 1
+    #endif
+#endif
+
 //-------------------------------------------------------------------------
 
 namespace EE::Render
@@ -53,6 +67,13 @@ namespace EE::Render
         // Special case format that changes based on texture usage
         Float_X32,
 
+        // Appended since the format values are serialized in compiled resources (i.e. shader vertex layouts)
+        UNorm_R16G16,
+        UNorm_R16G16B16A16,
+
+        SNorm_R16G16,
+        SNorm_R16G16B16A16,
+
         Count,
     };
 
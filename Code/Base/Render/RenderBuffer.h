@@ -23,6 +23,7 @@ namespace EE::Render
             Vertex,
             Index,
             Constant,
+            Structured,     // Read-only structured buffer, bound to shaders via its shader resource view
         };
 
         enum class Usage
@@ -35,13 +36,14 @@ namespace EE::Render
 
         RenderBuffer() = default;
         RenderBuffer( RenderBuffer const& ) = default;
-        ~RenderBuffer() { EE_ASSERT( !m_resourceHandle.IsValid() ); }
+        ~RenderBuffer() { EE_ASSERT( !m_resourceHandle.IsValid() && !m_shaderResourceView.IsValid() ); }
 
         RenderBuffer& operator=( RenderBuffer const& ) = default;
 
         inline bool IsValid() const { return m_resourceHandle.IsValid(); }
 
         BufferHandle const& GetResourceHandle() const { return m_resourceHandle; }
+        inline ViewSRVHandle const& GetShaderResourceView() const { EE_ASSERT( m_type == Type::Structured ); return m_shaderResourceView; }
         inline uint32_t GetNumElements() const { return m_byteSize / m_byteStride; }
 
     public:
@@ -56,6 +58,7 @@ namespace EE::Render
     protected:
 
         BufferHandle            m_resourceHandle;
+        ViewSRVHandle           m_shaderResourceView;
     };
 
     //-------------------------------------------------------------------------
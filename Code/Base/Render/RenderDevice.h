@@ -4,8 +4,10 @@
 
 #include "RenderAPI.h"
 
-#ifdef _WIN32
+#if EE_RENDER_NULL_DEVICE
+#include "Platform/RenderDevice_Null.h"
+#elif _WIN32
 #include "Platform/RenderDevice_DX11.h"
 #else
-#error 
+#error Unsupported render backend
 #endif
\ No newline at end of file
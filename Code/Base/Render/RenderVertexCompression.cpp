@@ -0,0 +1,248 @@
+#include "RenderVertexCompression.h"
+#include "Base/Encoding/Quantization.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render::VertexCompression
+{
+    static int16_t EncodeSignedNormalizedValue( float value )
+    {
+        return (int16_t) Math::RoundToInt( Math::Clamp( value, -1.0f, 1.0f ) * 32767.0f );
+    }
+
+    // Must match the GPU conversion for SNORM formats
+    static float DecodeSignedNormalizedValue( int16_t encodedValue )
+    {
+        return Math::Max( encodedValue / 32767.0f, -1.0f );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void EncodePosition( Float3 const& position, QuantizationRange const& range, uint16_t outEncodedPosition[4] )
+    {
+        for ( uint32_t i = 0; i < 3; i++ )
+        {
+            // Flat meshes have a zero scale on one axis, all positions on that axis decode to the offset
+            float const normalizedValue = ( range.m_scale[i] > 0.0f ) ? Math::Clamp( ( position[i] - range.m_offset[i] ) / range.m_scale[i], 0.0f, 1.0f ) : 0.0f;
+            outEncodedPosition[i] = Quantization::EncodeUnsignedNormalizedFloat<16>( normalizedValue );
+        }
+
+        outEncodedPosition[3] = 0;
+    }
+
+    Float3 DecodePosition( uint16_t const encodedPosition[4], QuantizationRange const& range )
+    {
+        Float3 position;
+        for ( uint32_t i = 0; i < 3; i++ )
+        {
+            position[i] = Quantization::DecodeUnsignedNormalizedFloat<16>( encodedPosition[i] ) * range.m_scale[i] + range.m_offset[i];
+        }
+
+        return position;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void EncodeNormal( Float3 const& normal, int16_t outEncodedNormal[2] )
+    {
+        float const sum = Math::Abs( normal.m_x ) + Math::Abs( normal.m_y ) + Math::Abs( normal.m_z );
+        if ( sum <= 0.0f )
+        {
+            outEncodedNormal[0] = outEncodedNormal[1] = 0;
+            return;
+        }
+
+        // Project onto the octahedron and fold the lower hemisphere over the upper one
+        float u = normal.m_x / sum;
+        float v = normal.m_y / sum;
+        if ( normal.m_z < 0.0f )
+        {
+            float const foldedU = ( 1.0f - Math::Abs( v ) ) * ( ( u >= 0.0f ) ? 1.0f : -1.0f );
+            float const foldedV = ( 1.0f - Math::Abs( u ) ) * ( ( v >= 0.0f ) ? 1.0f : -1.0f );
+            u = foldedU;
+            v = foldedV;
+        }
+
+        outEncodedNormal[0] = EncodeSignedNormalizedValue( u );
+        outEncodedNormal[1] = EncodeSignedNormalizedValue( v );
+    }
+
+    Float3 DecodeNormal( int16_t const encodedNormal[2] )
+    {
+        Float3 normal;
+        normal.m_x = DecodeSignedNormalizedValue( encodedNormal[0] );
+        normal.m_y = DecodeSignedNormalizedValue( encodedNormal[1] );
+        normal.m_z = 1.0f - Math::Abs( normal.m_x ) - Math::Abs( normal.m_y );
+
+        float const t = Math::Max( -normal.m_z, 0.0f );
+        normal.m_x += ( normal.m_x >= 0.0f ) ? -t : t;
+        normal.m_y += ( normal.m_y >= 0.0f ) ? -t : t;
+
+        float const length = Math::Sqrt( normal.m_x * normal.m_x + normal.m_y * normal.m_y + normal.m_z * normal.m_z );
+        return normal / length;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void EncodeBoneWeights( Float4 const& weights, uint8_t outEncodedWeights[4] )
+    {
+        int32_t sum = 0;
+        int32_t largestWeightIdx = 0;
+        for ( int32_t i = 0; i < 4; i++ )
+        {
+            int32_t const encodedWeight = Math::RoundToInt( Math::Clamp( weights[i], 0.0f, 1.0f ) * 255.0f );
+            outEncodedWeights[i] = (uint8_t) encodedWeight;
+            sum += encodedWeight;
+
+            if ( weights[i] > weights[largestWeightIdx] )
+            {
+                largestWeightIdx = i;
+            }
+        }
+
+        // Add the rounding error to the largest weight, so that the weights still sum to one
+        if ( sum > 0 )
+        {
+            outEncodedWeights[largestWeightIdx] = (uint8_t) Math::Clamp( outEncodedWeights[largestWeightIdx] + 255 - sum, 0, 255 );
+        }
+    }
+
+    Float4 DecodeBoneWeights( uint8_t const encodedWeights[4] )
+    {
+        return Float4( encodedWeights[0] / 255.0f, encodedWeights[1] / 255.0f, encodedWeights[2] / 255.0f, encodedWeights[3] / 255.0f );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CompressVertex( StaticMeshVertex const& vertex, QuantizationRange const& range, StaticMeshCompressedVertex& outVertex )
+    {
+        EncodePosition( Float3( vertex.m_position ), range, outVertex.m_position );
+        EncodeNormal( Float3( vertex.m_normal ), outVertex.m_normal );
+        outVertex.m_UV0[0] = Quantization::EncodeHalfFloat( vertex.m_UV0.m_x );
+        outVertex.m_UV0[1] = Quantization::EncodeHalfFloat( vertex.m_UV0.m_y );
+        outVertex.m_UV1[0] = Quantization::EncodeHalfFloat( vertex.m_UV1.m_x );
+        outVertex.m_UV1[1] = Quantization::EncodeHalfFloat( vertex.m_UV1.m_y );
+    }
+
+    void CompressVertex( SkeletalMeshVertex const& vertex, QuantizationRange const& range, SkeletalMeshCompressedVertex& outVertex )
+    {
+        CompressVertex( static_cast<StaticMeshVertex const&>( vertex ), range, outVertex );
+
+        for ( int32_t i = 0; i < 4; i++ )
+        {
+            EE_ASSERT( vertex.m_boneIndices[i] < 0xFF );
+            outVertex.m_boneIndices[i] = ( vertex.m_boneIndices[i] < 0 ) ? 0xFF : (uint8_t) vertex.m_boneIndices[i];
+        }
+
+        EncodeBoneWeights( vertex.m_boneWeights, outVertex.m_boneWeights );
+    }
+
+    void DecompressVertex( StaticMeshCompressedVertex const& vertex, QuantizationRange const& range, StaticMeshVertex& outVertex )
+    {
+        outVertex.m_position = Float4( DecodePosition( vertex.m_position, range ), 1.0f );
+        outVertex.m_normal = Float4( DecodeNormal( vertex.m_normal ), 0.0f );
+        outVertex.m_UV0 = Float2( Quantization::DecodeHalfFloat( vertex.m_UV0[0] ), Quantization::DecodeHalfFloat( vertex.m_UV0[1] ) );
+        outVertex.m_UV1 = Float2( Quantization::DecodeHalfFloat( vertex.m_UV1[0] ), Quantization::DecodeHalfFloat( vertex.m_UV1[1] ) );
+    }
+
+    void DecompressVertex( SkeletalMeshCompressedVertex const& vertex, QuantizationRange const& range, SkeletalMeshVertex& outVertex )
+    {
+        DecompressVertex( static_cast<StaticMeshCompressedVertex const&>( vertex ), range, outVertex );
+
+        for ( int32_t i = 0; i < 4; i++ )
+        {
+            outVertex.m_boneIndices[i] = ( vertex.m_boneIndices[i] == 0xFF ) ? InvalidIndex : vertex.m_boneIndices[i];
+        }
+
+        outVertex.m_boneWeights = DecodeBoneWeights( vertex.m_boneWeights );
+    }
+
+    //-------------------------------------------------------------------------
+
+    VertexFormat GetCompressedFormat( VertexFormat format )
+    {
+        switch ( format )
+        {
+            case VertexFormat::StaticMesh:
+            case VertexFormat::StaticMeshCompressed:
+            return VertexFormat::StaticMeshCompressed;
+
+            case VertexFormat::SkeletalMesh:
+            case VertexFormat::SkeletalMeshCompressed:
+            return VertexFormat::SkeletalMeshCompressed;
+
+            default:
+            EE_UNREACHABLE_CODE();
+            return VertexFormat::Unknown;
+        }
+    }
+
+    VertexFormat CompressVertices( VertexFormat format, uint8_t const* pVertexData, size_t numVertices, QuantizationRange const& range, Blob& outVertexData )
+    {
+        EE_ASSERT( format == VertexFormat::StaticMesh || format == VertexFormat::SkeletalMesh );
+        EE_ASSERT( pVertexData != nullptr || numVertices == 0 );
+
+        if ( format == VertexFormat::SkeletalMesh )
+        {
+            outVertexData.resize( numVertices * sizeof( SkeletalMeshCompressedVertex ) );
+            auto pSourceVertices = reinterpret_cast<SkeletalMeshVertex const*>( pVertexData );
+            auto pCompressedVertices = reinterpret_cast<SkeletalMeshCompressedVertex*>( outVertexData.data() );
+            for ( size_t i = 0; i < numVertices; i++ )
+            {
+                CompressVertex( pSourceVertices[i], range, pCompressedVertices[i] );
+            }
+        }
+        else
+        {
+            outVertexData.resize( numVertices * sizeof( StaticMeshCompressedVertex ) );
+            auto pSourceVertices = reinterpret_cast<StaticMeshVertex const*>( pVertexData );
+            auto pCompressedVertices = reinterpret_cast<StaticMeshCompressedVertex*>( outVertexData.data() );
+            for ( size_t i = 0; i < numVertices; i++ )
+            {
+                CompressVertex( pSourceVertices[i], range, pCompressedVertices[i] );
+            }
+        }
+
+        return GetCompressedFormat( format );
+    }
+
+    StaticMeshVertex DecodeVertex( VertexFormat format, uint8_t const* pVertexData, int32_t vertexIdx, QuantizationRange const& range )
+    {
+        EE_ASSERT( pVertexData != nullptr && vertexIdx >= 0 );
+
+        StaticMeshVertex vertex;
+        switch ( format )
+        {
+            case VertexFormat::StaticMesh:
+            {
+                vertex = reinterpret_cast<StaticMeshVertex const*>( pVertexData )[vertexIdx];
+            }
+            break;
+
+            case VertexFormat::SkeletalMesh:
+            {
+                vertex = reinterpret_cast<SkeletalMeshVertex const*>( pVertexData )[vertexIdx];
+            }
+            break;
+
+            case VertexFormat::StaticMeshCompressed:
+            {
+                DecompressVertex( reinterpret_cast<StaticMeshCompressedVertex const*>( pVertexData )[vertexIdx], range, vertex );
+            }
+            break;
+
+            case VertexFormat::SkeletalMeshCompressed:
+            {
+                // Only the static part of the vertex is needed
+                DecompressVertex( static_cast<StaticMeshCompressedVertex const&>( reinterpret_cast<SkeletalMeshCompressedVertex const*>( pVertexData )[vertexIdx] ), range, vertex );
+            }
+            break;
+
+            default:
+            EE_UNREACHABLE_CODE();
+            break;
+        }
+
+        return vertex;
+    }
+}
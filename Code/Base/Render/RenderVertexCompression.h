@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Base/_Module/API.h"
+#include "RenderVertexFormats.h"
+
+//-------------------------------------------------------------------------
+// Vertex Compression
+//-------------------------------------------------------------------------
+// Converts mesh vertices to/from the compressed vertex formats, the decoding must match the compressed vertex shaders
+//
+// * Positions are quantized to 16bits per component, relative to a quantization range (i.e. the mesh bounds)
+// * Normals are octahedral encoded into two 16bit signed normalized values
+// * UVs are stored as half floats
+// * Bone indices are stored as 8bit values, so a compressed mesh can have at most 255 bones
+// * Bone weights are quantized to 8bits, the rounding error is added to the largest weight so the weights still sum to one
+
+namespace EE::Render::VertexCompression
+{
+    // The range that positions are quantized to: position = normalizedPosition * scale + offset
+    struct QuantizationRange
+    {
+        EE_SERIALIZE( m_offset, m_scale );
+
+        QuantizationRange() = default;
+        QuantizationRange( Float3 const& min, Float3 const& max ) : m_offset( min ), m_scale( max - min ) {}
+
+        Float3                          m_offset = Float3::Zero;
+        Float3                          m_scale = Float3::One;
+    };
+
+    //-------------------------------------------------------------------------
+
+    EE_BASE_API void EncodePosition( Float3 const& position, QuantizationRange const& range, uint16_t outEncodedPosition[4] );
+    EE_BASE_API Float3 DecodePosition( uint16_t const encodedPosition[4], QuantizationRange const& range );
+
+    EE_BASE_API void EncodeNormal( Float3 const& normal, int16_t outEncodedNormal[2] );
+    EE_BASE_API Float3 DecodeNormal( int16_t const encodedNormal[2] );
+
+    EE_BASE_API void EncodeBoneWeights( Float4 const& weights, uint8_t outEncodedWeights[4] );
+    EE_BASE_API Float4 DecodeBoneWeights( uint8_t const encodedWeights[4] );
+
+    //-------------------------------------------------------------------------
+
+    EE_BASE_API void CompressVertex( StaticMeshVertex const& vertex, QuantizationRange const& range, StaticMeshCompressedVertex& outVertex );
+    EE_BASE_API void CompressVertex( SkeletalMeshVertex const& vertex, QuantizationRange const& range, SkeletalMeshCompressedVertex& outVertex );
+
+    EE_BASE_API void DecompressVertex( StaticMeshCompressedVertex const& vertex, QuantizationRange const& range, StaticMeshVertex& outVertex );
+    EE_BASE_API void DecompressVertex( SkeletalMeshCompressedVertex const& vertex, QuantizationRange const& range, SkeletalMeshVertex& outVertex );
+
+    //-------------------------------------------------------------------------
+
+    // Get the compressed equivalent of an uncompressed mesh vertex format
+    EE_BASE_API VertexFormat GetCompressedFormat( VertexFormat format );
+
+    // Compress a static or skeletal mesh vertex buffer, returns the format of the compressed vertices
+    EE_BASE_API VertexFormat CompressVertices( VertexFormat format, uint8_t const* pVertexData, size_t numVertices, QuantizationRange const& range, Blob& outVertexData );
+
+    // Get the position, normal and UVs of a vertex in any of the mesh vertex formats
+    EE_BASE_API StaticMeshVertex DecodeVertex( VertexFormat format, uint8_t const* pVertexData, int32_t vertexIdx, QuantizationRange const& range );
+}
@@ -35,7 +35,13 @@ namespace EE::Render
         12,
         16,
 
-        4
+        4,
+
+        4,
+        8,
+
+        4,
+        8
     };
 
     static_assert( sizeof( g_dataTypeSizes ) / sizeof( uint32_t ) == (uint32_t) DataFormat::Count, "Mismatched data type and size arrays" );
@@ -87,6 +93,23 @@ namespace EE::Render
                 layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::BlendIndex, DataFormat::SInt_R32G32B32A32, 0, 48 ) );
                 layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::BlendWeight, DataFormat::Float_R32G32B32A32, 0, 64 ) );
             }
+            else if ( format == VertexFormat::StaticMeshCompressed )
+            {
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::Position, DataFormat::UNorm_R16G16B16A16, 0, 0 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::Normal, DataFormat::SNorm_R16G16, 0, 8 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R16G16, 0, 12 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R16G16, 1, 16 ) );
+            }
+            else if ( format == VertexFormat::SkeletalMeshCompressed )
+            {
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::Position, DataFormat::UNorm_R16G16B16A16, 0, 0 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::Normal, DataFormat::SNorm_R16G16, 0, 8 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R16G16, 0, 12 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::TexCoord, DataFormat::Float_R16G16, 1, 16 ) );
+
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::BlendIndex, DataFormat::UInt_R8G8B8A8, 0, 20 ) );
+                layoutDesc.m_elementDescriptors.push_back( VertexLayoutDescriptor::ElementDescriptor( DataSemantic::BlendWeight, DataFormat::UNorm_R8G8B8A8, 0, 24 ) );
+            }
 
             //-------------------------------------------------------------------------
 
@@ -20,8 +20,12 @@ namespace EE::Render
         None,
         StaticMesh,
         SkeletalMesh,
+        StaticMeshCompressed,
+        SkeletalMeshCompressed,
     };
 
+    inline bool IsCompressedVertexFormat( VertexFormat format ) { return format == VertexFormat::StaticMeshCompressed || format == VertexFormat::SkeletalMeshCompressed; }
+
     // CPU format for the static mesh vertex - this is what the mesh compiler fills the vertex data array with
     struct StaticMeshVertex
     {
@@ -38,6 +42,25 @@ namespace EE::Render
         Float4  m_boneWeights;
     };
 
+    // CPU format for the compressed static mesh vertex - see RenderVertexCompression.h for the encoding
+    struct StaticMeshCompressedVertex
+    {
+        uint16_t    m_position[4];          // Unsigned normalized, relative to the mesh position quantization range (w is unused)
+        int16_t     m_normal[2];            // Signed normalized octahedral encoding
+        uint16_t    m_UV0[2];               // Half float
+        uint16_t    m_UV1[2];               // Half float
+    };
+
+    // CPU format for the compressed skeletal mesh vertex - see RenderVertexCompression.h for the encoding
+    struct SkeletalMeshCompressedVertex : public StaticMeshCompressedVertex
+    {
+        uint8_t     m_boneIndices[4];       // 0xFF is an invalid bone index
+        uint8_t     m_boneWeights[4];       // Unsigned normalized, these always sum to 255
+    };
+
+    static_assert( sizeof( StaticMeshCompressedVertex ) == 20, "Compressed vertex size must match the vertex layout" );
+    static_assert( sizeof( SkeletalMeshCompressedVertex ) == 28, "Compressed vertex size must match the vertex layout" );
+
     //-------------------------------------------------------------------------
 
     struct EE_BASE_API VertexLayoutDescriptor
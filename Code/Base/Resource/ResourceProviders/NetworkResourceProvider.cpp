@@ -3,7 +3,10 @@
 #include "Base/Resource/ResourceSettings.h"
 #include "Base/Serialization/BinarySerialization.h"
 #include "Base/FileSystem/FileSystem.h"
+#include "Base/FileSystem/FileSystemUtils.h"
+#include "Base/Encoding/Hash.h"
 #include "Base/Profiling.h"
+#include <eastl/sort.h>
 
 
 //-------------------------------------------------------------------------
@@ -11,6 +14,12 @@
 #if EE_DEVELOPMENT_TOOLS
 namespace EE::Resource
 {
+    static char const* const g_cacheIndexFilename = "CacheIndex.idx";
+    static char const* const g_cacheDataExtension = "bin";
+    static uint32_t const g_cacheIndexVersion = 1; // Bump whenever the cache entry format or the compile key calculation changes
+
+    //-------------------------------------------------------------------------
+
     bool NetworkResourceProvider::IsReady() const
     {
         return m_networkClient.IsConnected() || m_networkClient.IsConnecting();
@@ -25,12 +34,45 @@ namespace EE::Resource
             return false;
         }
 
+        // Validate the local cache against the server with a single batched request
+        //-------------------------------------------------------------------------
+
+        if ( IsCacheEnabled() )
+        {
+            LoadCacheIndex();
+
+            if ( !m_cacheIndex.empty() )
+            {
+                NetworkCacheValidationRequest request;
+                request.m_entries.reserve( m_cacheIndex.size() );
+                for ( auto const& entry : m_cacheIndex )
+                {
+                    request.m_entries.emplace_back( entry.first, entry.second.m_compileKey );
+                }
+
+                Network::IPC::Message validateCacheMessage( (int32_t) NetworkMessageID::ValidateCache, request );
+                m_networkClient.SendMessageToServer( eastl::move( validateCacheMessage ) );
+                m_cacheValidationStartTime = PlatformClock::GetTime();
+            }
+        }
+
         return true;
     }
 
     void NetworkResourceProvider::Shutdown()
     {
         Network::NetworkSystem::StopClientConnection( &m_networkClient );
+
+        if ( IsCacheEnabled() && m_isCacheIndexDirty )
+        {
+            SaveCacheIndex();
+        }
+
+        m_incomingTransfers.clear();
+        m_completedTransfers.clear();
+        m_validatedCacheEntries.clear();
+        m_cacheIndex.clear();
+        m_hotReloadStartTimes.clear();
     }
 
     void NetworkResourceProvider::RequestRawResource( ResourceRequest* pRequest )
@@ -52,6 +94,15 @@ namespace EE::Resource
     {
         EE_ASSERT( pRequest != nullptr && pRequest->IsValid() );
 
+        // The request might not have been sent yet
+        auto pendingIter = VectorFind( m_pendingRequests, pRequest );
+        if ( pendingIter != m_pendingRequests.end() )
+        {
+            m_pendingRequests.erase( pendingIter );
+            return;
+        }
+
+        // Any in-flight transfer is left to complete so that the data still ends up in the cache
         auto foundIter = VectorFind( m_sentRequests, pRequest );
         EE_ASSERT( foundIter != m_sentRequests.end() );
 
@@ -95,20 +146,51 @@ namespace EE::Resource
             {
                 case NetworkMessageID::ResourceRequestComplete:
                 {
-                    NetworkResourceResponse response = message.GetData<NetworkResourceResponse>();
-                    m_serverResults.insert( m_serverResults.end(), response.m_results.begin(), response.m_results.end() );
+                    ProcessRequestResults( message.GetData<NetworkResourceResponse>() );
+                }
+                break;
+
+                case NetworkMessageID::ResourceDataChunk:
+                {
+                    ProcessDataChunk( message.GetData<NetworkResourceDataChunk>() );
+                }
+                break;
+
+                case NetworkMessageID::CacheValidationComplete:
+                {
+                    NetworkCacheValidationResponse response = message.GetData<NetworkCacheValidationResponse>();
+                    for ( auto const& resourceID : response.m_validResourceIDs )
+                    {
+                        // Entries invalidated since the validation request was sent are no longer in the index
+                        auto cacheIter = m_cacheIndex.find( resourceID );
+                        if ( cacheIter != m_cacheIndex.end() )
+                        {
+                            m_validatedCacheEntries[resourceID] = cacheIter->second.m_dataHash;
+                        }
+                    }
+
+                    Milliseconds const validationTime = ( PlatformClock::GetTime() - m_cacheValidationStartTime ).ToMilliseconds();
+                    EE_LOG_INFO( "Resource", "Network Resource Provider", "Local cache validated: %u/%u entries up to date (%.2fms)", (uint32_t) response.m_validResourceIDs.size(), (uint32_t) m_cacheIndex.size(), validationTime.ToFloat() );
                 }
                 break;
 
                 case NetworkMessageID::ResourceUpdated:
                 {
-                    #if EE_DEVELOPMENT_TOOLS
                     NetworkResourceResponse response = message.GetData<NetworkResourceResponse>();
                     for ( auto const& result : response.m_results )
                     {
+                        // Any cached data for this resource is now stale
+                        m_validatedCacheEntries.erase( result.m_resourceID );
+                        if ( m_cacheIndex.erase( result.m_resourceID ) > 0 )
+                        {
+                            m_isCacheIndexDirty = true;
+                        }
+
+                        #if EE_DEVELOPMENT_TOOLS
                         m_externallyUpdatedResources.emplace_back( result.m_resourceID );
+                        m_hotReloadStartTimes[result.m_resourceID] = PlatformClock::GetTime();
+                        #endif
                     }
-                    #endif
                 }
                 break;
 
@@ -119,68 +201,361 @@ namespace EE::Resource
 
         m_networkClient.ProcessIncomingMessages( ProcessMessageFunction );
 
-        // Send all requests and keep-alive messages
+        // Send all requests
+        //-------------------------------------------------------------------------
+
+        SendPendingRequests();
+
+        // Process all server results
         //-------------------------------------------------------------------------
 
-        if ( !m_pendingRequests.empty() )
+        for ( auto& result : m_serverResults )
         {
-            NetworkResourceRequest request;
+            EE_ASSERT( !result.m_isDataStreamed );
+
+            if ( !result.HasSucceeded() )
+            {
+                CompleteRequest( result.m_resourceID, Blob() );
+                continue;
+            }
+
+            // The server confirmed our cached copy is up to date, so record the compile key for future cache validation
+            m_validatedCacheEntries[result.m_resourceID] = result.m_dataHash;
 
-            // Process all pending requests
-            for( auto pRequest : m_pendingRequests )
+            auto cacheIter = m_cacheIndex.find( result.m_resourceID );
+            if ( cacheIter != m_cacheIndex.end() && cacheIter->second.m_dataHash == result.m_dataHash && cacheIter->second.m_compileKey != result.m_compileKey )
             {
-                request.m_resourceIDs.emplace_back( pRequest->GetResourceID() );
-                m_sentRequests.emplace_back( pRequest );
+                cacheIter->second.m_compileKey = result.m_compileKey;
+                m_isCacheIndexDirty = true;
+            }
+
+            auto predicate = [] ( ResourceRequest* pRequest, ResourceID const& resourceID ) { return pRequest->GetResourceID() == resourceID; };
+            auto foundIter = VectorFind( m_sentRequests, result.m_resourceID, predicate );
+            if ( foundIter != m_sentRequests.end() )
+            {
+                ResourceRequest* pFoundRequest = *foundIter;
+                m_sentRequests.erase_unsorted( foundIter );
 
-                // Try to limit the size of the network messages so we limit each message to 128 request
-                if ( request.m_resourceIDs.size() == 128 )
+                if ( pFoundRequest->GetLoadingStatus() == LoadingStatus::Loading )
                 {
-                    Network::IPC::Message requestResourceMessage( (int32_t) NetworkMessageID::RequestResource, request );
-                    m_networkClient.SendMessageToServer( eastl::move( requestResourceMessage ) );
-                    request.m_resourceIDs.clear();
+                    pFoundRequest->OnRawResourceRequestComplete( GetCacheFilePath( result.m_dataHash ).ToString() );
+                    OnRequestCompleted( result.m_resourceID );
                 }
             }
-            m_pendingRequests.clear();
+        }
+
+        m_serverResults.clear();
+
+        // Process all completed transfers
+        //-------------------------------------------------------------------------
+
+        for ( auto& transfer : m_completedTransfers )
+        {
+            WriteToCache( transfer.m_resourceID, transfer.m_dataHash, transfer.m_compileKey, transfer.m_data );
+            CompleteRequest( transfer.m_resourceID, eastl::move( transfer.m_data ) );
+        }
+
+        m_completedTransfers.clear();
+    }
+
+    void NetworkResourceProvider::SendPendingRequests()
+    {
+        if ( m_pendingRequests.empty() )
+        {
+            return;
+        }
+
+        // Send high priority requests first, the server will also prioritize their compilation and data transfer
+        //-------------------------------------------------------------------------
+
+        auto GetPriority = [] ( ResourceRequest const* pRequest ) { return pRequest->IsReloadRequest() ? NetworkRequestPriority::High : NetworkRequestPriority::Normal; };
+        eastl::stable_sort( m_pendingRequests.begin(), m_pendingRequests.end(), [&GetPriority] ( ResourceRequest const* pA, ResourceRequest const* pB ) { return GetPriority( pA ) > GetPriority( pB ); } );
+
+        //-------------------------------------------------------------------------
+
+        NetworkResourceRequest request;
+
+        for ( auto pRequest : m_pendingRequests )
+        {
+            ResourceID const& resourceID = pRequest->GetResourceID();
+
+            // If the cached data was validated by the server, we can skip the round trip entirely
+            auto validatedIter = m_validatedCacheEntries.find( resourceID );
+            if ( validatedIter != m_validatedCacheEntries.end() && IsCached( validatedIter->second ) )
+            {
+                pRequest->OnRawResourceRequestComplete( GetCacheFilePath( validatedIter->second ).ToString() );
+                OnRequestCompleted( resourceID );
+                continue;
+            }
+
+            request.m_requests.emplace_back( resourceID, GetCachedDataHash( resourceID ), GetPriority( pRequest ) );
+            m_sentRequests.emplace_back( pRequest );
 
-            // Send any remaining requests
-            if ( request.m_resourceIDs.size() > 0 )
+            // Try to limit the size of the network messages so we limit each message to 128 request
+            if ( request.m_requests.size() == 128 )
             {
                 Network::IPC::Message requestResourceMessage( (int32_t) NetworkMessageID::RequestResource, request );
                 m_networkClient.SendMessageToServer( eastl::move( requestResourceMessage ) );
+                request.m_requests.clear();
             }
         }
+        m_pendingRequests.clear();
 
-        // Process all server results
+        // Send any remaining requests
+        if ( request.m_requests.size() > 0 )
+        {
+            Network::IPC::Message requestResourceMessage( (int32_t) NetworkMessageID::RequestResource, request );
+            m_networkClient.SendMessageToServer( eastl::move( requestResourceMessage ) );
+        }
+    }
+
+    void NetworkResourceProvider::ProcessRequestResults( NetworkResourceResponse const& response )
+    {
+        for ( auto const& result : response.m_results )
+        {
+            if ( result.m_isDataStreamed )
+            {
+                EE_ASSERT( result.HasSucceeded() && result.m_dataSize > 0 );
+
+                // Drop any prior transfer for this resource, the data has since been recompiled
+                auto predicate = [] ( IncomingTransfer const& transfer, ResourceID const& resourceID ) { return transfer.m_resourceID == resourceID; };
+                auto foundIter = VectorFind( m_incomingTransfers, result.m_resourceID, predicate );
+                if ( foundIter != m_incomingTransfers.end() )
+                {
+                    m_incomingTransfers.erase_unsorted( foundIter );
+                }
+
+                auto& transfer = m_incomingTransfers.emplace_back();
+                transfer.m_resourceID = result.m_resourceID;
+                transfer.m_dataHash = result.m_dataHash;
+                transfer.m_compileKey = result.m_compileKey;
+                transfer.m_data.resize( result.m_dataSize );
+            }
+            else
+            {
+                m_serverResults.emplace_back( result );
+            }
+        }
+    }
+
+    void NetworkResourceProvider::ProcessDataChunk( NetworkResourceDataChunk const& chunk )
+    {
+        auto predicate = [] ( IncomingTransfer const& transfer, ResourceID const& resourceID ) { return transfer.m_resourceID == resourceID; };
+        auto foundIter = VectorFind( m_incomingTransfers, chunk.m_resourceID, predicate );
+
+        // Ignore chunks for stale transfers
+        if ( foundIter == m_incomingTransfers.end() || foundIter->m_dataHash != chunk.m_dataHash )
+        {
+            return;
+        }
+
+        IncomingTransfer& transfer = *foundIter;
+        EE_ASSERT( chunk.m_offset == transfer.m_bytesReceived );
+        EE_ASSERT( chunk.m_offset + chunk.m_data.size() <= transfer.m_data.size() );
+        memcpy( transfer.m_data.data() + chunk.m_offset, chunk.m_data.data(), chunk.m_data.size() );
+        transfer.m_bytesReceived += (uint32_t) chunk.m_data.size();
+
+        // Transfer complete
         //-------------------------------------------------------------------------
 
-        for ( auto& result : m_serverResults )
+        if ( transfer.m_bytesReceived == transfer.m_data.size() )
         {
-            auto predicate = [] ( ResourceRequest* pRequest, ResourceID const& resourceID ) { return pRequest->GetResourceID() == resourceID; };
-            auto foundIter = VectorFind( m_sentRequests, result.m_resourceID, predicate );
+            if ( Hash::GetHash64( transfer.m_data ) != transfer.m_dataHash )
+            {
+                EE_LOG_ERROR( "Resource", "Network Resource Provider", "Corrupted data received for resource (%s)", transfer.m_resourceID.c_str() );
+                transfer.m_data.clear();
+                transfer.m_dataHash = 0;
+            }
+
+            m_completedTransfers.emplace_back( eastl::move( transfer ) );
+            m_incomingTransfers.erase_unsorted( foundIter );
+        }
+    }
 
-            // This might have been a canceled request
-            if ( foundIter == m_sentRequests.end() )
+    void NetworkResourceProvider::CompleteRequest( ResourceID const& resourceID, Blob&& data )
+    {
+        auto predicate = [] ( ResourceRequest* pRequest, ResourceID const& resourceID ) { return pRequest->GetResourceID() == resourceID; };
+        auto foundIter = VectorFind( m_sentRequests, resourceID, predicate );
+
+        // This might have been a canceled request
+        if ( foundIter == m_sentRequests.end() )
+        {
+            return;
+        }
+
+        ResourceRequest* pFoundRequest = *foundIter;
+        EE_ASSERT( pFoundRequest->IsValid() );
+        m_sentRequests.erase_unsorted( foundIter );
+
+        // Ignore any responses for requests that may have been canceled or are unloading
+        if ( pFoundRequest->GetLoadingStatus() != LoadingStatus::Loading )
+        {
+            return;
+        }
+
+        // If we have data, the compilation was a success
+        pFoundRequest->OnRawResourceRequestComplete( eastl::move( data ) );
+        OnRequestCompleted( resourceID );
+    }
+
+    void NetworkResourceProvider::OnRequestCompleted( ResourceID const& resourceID )
+    {
+        // Report the time from the server notifying us of the change to the reloaded data being available
+        auto reloadIter = m_hotReloadStartTimes.find( resourceID );
+        if ( reloadIter != m_hotReloadStartTimes.end() )
+        {
+            Milliseconds const reloadLatency = ( PlatformClock::GetTime() - reloadIter->second ).ToMilliseconds();
+            EE_LOG_INFO( "Resource", "Network Resource Provider", "Hot-reload data received for %s (%.2fms)", resourceID.c_str(), reloadLatency.ToFloat() );
+            m_hotReloadStartTimes.erase( reloadIter );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Local Cache
+    //-------------------------------------------------------------------------
+
+    FileSystem::Path NetworkResourceProvider::GetCacheFilePath( uint64_t dataHash ) const
+    {
+        EE_ASSERT( IsCacheEnabled() );
+        return m_settings.m_localResourceCachePath + String( String::CtorSprintf(), "%016llx.%s", dataHash, g_cacheDataExtension );
+    }
+
+    uint64_t NetworkResourceProvider::GetCachedDataHash( ResourceID const& resourceID ) const
+    {
+        auto foundIter = m_cacheIndex.find( resourceID );
+        return ( foundIter != m_cacheIndex.end() ) ? foundIter->second.m_dataHash : 0;
+    }
+
+    bool NetworkResourceProvider::IsCached( uint64_t dataHash ) const
+    {
+        if ( !IsCacheEnabled() || dataHash == 0 )
+        {
+            return false;
+        }
+
+        return FileSystem::Exists( GetCacheFilePath( dataHash ) );
+    }
+
+    void NetworkResourceProvider::WriteToCache( ResourceID const& resourceID, uint64_t dataHash, uint64_t compileKey, Blob const& data )
+    {
+        if ( !IsCacheEnabled() || data.empty() )
+        {
+            return;
+        }
+
+        // Data is keyed by content so identical data only needs to be written once
+        if ( !IsCached( dataHash ) )
+        {
+            FileSystem::Path const cacheFilePath = GetCacheFilePath( dataHash );
+            if ( !cacheFilePath.EnsureDirectoryExists() || !FileSystem::SaveFile( cacheFilePath, data ) )
             {
-                continue;
+                EE_LOG_WARNING( "Resource", "Network Resource Provider", "Failed to write resource (%s) to local cache: %s", resourceID.c_str(), cacheFilePath.c_str() );
+                return;
             }
+        }
+
+        CacheEntry& entry = m_cacheIndex[resourceID];
+        entry.m_dataHash = dataHash;
+        entry.m_compileKey = compileKey;
+        m_validatedCacheEntries[resourceID] = dataHash;
+        m_isCacheIndexDirty = true;
+    }
 
-            ResourceRequest* pFoundRequest = static_cast<ResourceRequest*>( *foundIter );
-            EE_ASSERT( pFoundRequest->IsValid() );
+    void NetworkResourceProvider::LoadCacheIndex()
+    {
+        EE_ASSERT( IsCacheEnabled() );
+        EE_PROFILE_FUNCTION_RESOURCE();
+
+        m_cacheIndex.clear();
+        m_isCacheIndexDirty = false;
 
-            // Ignore any responses for requests that may have been canceled or are unloading
-            if ( pFoundRequest->GetLoadingStatus() != LoadingStatus::Loading )
+        FileSystem::Path const indexFilePath = m_settings.m_localResourceCachePath + g_cacheIndexFilename;
+        if ( FileSystem::Exists( indexFilePath ) )
+        {
+            Serialization::BinaryInputArchive archive;
+            if ( archive.ReadFromFile( indexFilePath ) )
             {
-                continue;
+                uint32_t version = 0;
+                archive << version;
+
+                // Indices from older versions cant be validated, the data files are kept and will be re-indexed as they are requested
+                if ( version == g_cacheIndexVersion )
+                {
+                    archive << m_cacheIndex;
+                }
+                else
+                {
+                    EE_LOG_INFO( "Resource", "Network Resource Provider", "Local resource cache index version mismatch (%u != %u), index discarded", version, g_cacheIndexVersion );
+                    m_isCacheIndexDirty = true;
+                }
             }
+        }
 
-            // If the request has a filepath set, the compilation was a success
-            pFoundRequest->OnRawResourceRequestComplete( result.m_filePath );
+        // Remove all entries whose data is missing
+        //-------------------------------------------------------------------------
 
-            // Remove from request list
-            m_sentRequests.erase_unsorted( foundIter );
+        TVector<ResourceID> invalidEntries;
+        THashMap<uint64_t, bool> referencedHashes;
+        for ( auto const& entry : m_cacheIndex )
+        {
+            if ( !IsCached( entry.second.m_dataHash ) )
+            {
+                invalidEntries.emplace_back( entry.first );
+            }
+            else
+            {
+                referencedHashes[entry.second.m_dataHash] = true;
+            }
         }
 
-        m_serverResults.clear();
+        for ( auto const& resourceID : invalidEntries )
+        {
+            m_cacheIndex.erase( resourceID );
+        }
+
+        // Report data files that are no longer referenced
+        // These are never deleted here: the index may be stale or discarded, and the data is content-addressed so it will be
+        // reused as soon as a request resolves to the same hash. Clearing the cache is left to the user.
+        //-------------------------------------------------------------------------
+
+        TVector<FileSystem::Path> cachedFiles;
+        if ( FileSystem::GetDirectoryContents( m_settings.m_localResourceCachePath, cachedFiles, FileSystem::DirectoryReaderOutput::OnlyFiles, FileSystem::DirectoryReaderMode::DontExpand, { g_cacheDataExtension } ) )
+        {
+            uint32_t numUnreferencedFiles = 0;
+            for ( auto const& cachedFile : cachedFiles )
+            {
+                uint64_t const dataHash = strtoull( cachedFile.GetFileNameWithoutExtension().c_str(), nullptr, 16 );
+                if ( referencedHashes.find( dataHash ) == referencedHashes.end() )
+                {
+                    numUnreferencedFiles++;
+                }
+            }
+
+            if ( numUnreferencedFiles > 0 )
+            {
+                EE_LOG_INFO( "Resource", "Network Resource Provider", "Local resource cache contains %u/%u unreferenced data files (%s)", numUnreferencedFiles, (uint32_t) cachedFiles.size(), m_settings.m_localResourceCachePath.c_str() );
+            }
+        }
+
+        m_isCacheIndexDirty |= !invalidEntries.empty();
+    }
+
+    void NetworkResourceProvider::SaveCacheIndex()
+    {
+        EE_ASSERT( IsCacheEnabled() );
+
+        Serialization::BinaryOutputArchive archive;
+        archive << g_cacheIndexVersion;
+        archive << m_cacheIndex;
+
+        FileSystem::Path const indexFilePath = m_settings.m_localResourceCachePath + g_cacheIndexFilename;
+        if ( !archive.WriteToFile( indexFilePath ) )
+        {
+            EE_LOG_WARNING( "Resource", "Network Resource Provider", "Failed to write local resource cache index: %s", indexFilePath.c_str() );
+            return;
+        }
+
+        m_isCacheIndexDirty = false;
     }
 }
-#endif
\ No newline at end of file
+#endif
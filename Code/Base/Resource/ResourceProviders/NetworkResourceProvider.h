@@ -5,6 +5,7 @@
 #include "Base/Network/IPC/IPCMessageClient.h"
 #include "Base/Time/Timers.h"
 #include "Base/Threading/Threading.h"
+#include "Base/Types/HashMap.h"
 
 //-------------------------------------------------------------------------
 
@@ -15,8 +16,35 @@ namespace EE::Resource
 
     //-------------------------------------------------------------------------
 
+    //-------------------------------------------------------------------------
+    // Network Resource Provider
+    //-------------------------------------------------------------------------
+    // Requests compiled resources from the resource server, the compiled data is streamed back over the connection
+    // Streamed data is stored in a local cache keyed by content hash. Each cache entry also stores the compile key the data was
+    // compiled with (source/dependency timestamps and compiler versions), so the server can validate the whole cache with a
+    // single batched query at startup without compiling anything. Validated entries are served without a server round trip.
+    //-------------------------------------------------------------------------
+
     class EE_BASE_API NetworkResourceProvider final : public ResourceProvider
     {
+        // An in-progress transfer of compiled data from the server
+        struct IncomingTransfer
+        {
+            ResourceID                                      m_resourceID;
+            uint64_t                                        m_dataHash = 0;
+            uint64_t                                        m_compileKey = 0;
+            uint32_t                                        m_bytesReceived = 0;
+            Blob                                            m_data;
+        };
+
+        // A locally cached resource
+        struct CacheEntry
+        {
+            EE_SERIALIZE( m_dataHash, m_compileKey );
+
+            uint64_t                                        m_dataHash = 0;
+            uint64_t                                        m_compileKey = 0;
+        };
 
     public:
 
@@ -34,6 +62,22 @@ namespace EE::Resource
 
         virtual TVector<ResourceID> const& GetExternallyUpdatedResources() const override { return m_externallyUpdatedResources; }
 
+        // Message processing
+        void ProcessRequestResults( NetworkResourceResponse const& response );
+        void ProcessDataChunk( NetworkResourceDataChunk const& chunk );
+        void SendPendingRequests();
+        void CompleteRequest( ResourceID const& resourceID, Blob&& data );
+        void OnRequestCompleted( ResourceID const& resourceID );
+
+        // Local Cache
+        inline bool IsCacheEnabled() const { return m_settings.m_localResourceCachePath.IsValid(); }
+        FileSystem::Path GetCacheFilePath( uint64_t dataHash ) const;
+        uint64_t GetCachedDataHash( ResourceID const& resourceID ) const;
+        void LoadCacheIndex();
+        void SaveCacheIndex();
+        void WriteToCache( ResourceID const& resourceID, uint64_t dataHash, uint64_t compileKey, Blob const& data );
+        bool IsCached( uint64_t dataHash ) const;
+
     private:
 
         Network::IPC::Client                                m_networkClient;
@@ -43,6 +87,16 @@ namespace EE::Resource
 
         TVector<ResourceRequest*>                           m_pendingRequests; // Requests we need to still send
         TVector<ResourceRequest*>                           m_sentRequests; // Request that were sent but we're still waiting for a response
+        TVector<IncomingTransfer>                           m_incomingTransfers;
+        TVector<IncomingTransfer>                           m_completedTransfers;
+
+        THashMap<ResourceID, CacheEntry>                    m_cacheIndex;
+        THashMap<ResourceID, uint64_t>                      m_validatedCacheEntries; // Cache entries that the server confirmed are up to date -> content hash
+        bool                                                m_isCacheIndexDirty = false;
+
+        // Latency tracking
+        Nanoseconds                                         m_cacheValidationStartTime = 0;
+        THashMap<ResourceID, Nanoseconds>                   m_hotReloadStartTimes; // Time at which the server notified us of a resource change
 
         TVector<ResourceID>                                 m_externallyUpdatedResources;
     };
@@ -13,15 +13,45 @@ namespace EE
             RequestResource = 1,
             ResourceRequestComplete = 2,
             ResourceUpdated = 3,
+            ResourceDataChunk = 4,
+            ValidateCache = 5,
+            CacheValidationComplete = 6,
         };
 
+        enum class NetworkRequestPriority : uint8_t
+        {
+            Low = 0, // Background work i.e. cache validation
+            Normal,
+            High, // Someone is actively waiting on this i.e. hot-reload
+        };
+
+        // Compiled resource data is streamed back in chunks of this size
+        constexpr static uint32_t const g_networkResourceDataChunkSize = 256 * 1024;
+
         //-------------------------------------------------------------------------
 
         struct NetworkResourceRequest
         {
-            EE_SERIALIZE( m_resourceIDs );
+            struct Request
+            {
+                EE_SERIALIZE( m_resourceID, m_cachedDataHash, m_priority );
 
-            TVector<ResourceID>     m_resourceIDs;
+                Request() = default;
+
+                Request( ResourceID const& ID, uint64_t cachedDataHash, NetworkRequestPriority priority )
+                    : m_resourceID( ID )
+                    , m_cachedDataHash( cachedDataHash )
+                    , m_priority( priority )
+                {}
+
+                ResourceID                  m_resourceID;
+                uint64_t                    m_cachedDataHash = 0; // The hash of the data the client already has cached (0 if none), the server will not send the data if it matches
+                NetworkRequestPriority      m_priority = NetworkRequestPriority::Normal;
+            };
+
+            EE_SERIALIZE( m_requests );
+
+            TVector<Request>        m_requests;
         };
 
         //-------------------------------------------------------------------------
@@ -30,17 +60,26 @@ namespace EE
         {
             struct Result
             {
-                EE_SERIALIZE( m_resourceID, m_filePath );
+                EE_SERIALIZE( m_resourceID, m_dataHash, m_compileKey, m_dataSize, m_isDataStreamed );
 
                 Result() = default;
 
-                Result( ResourceID const& ID, String const& path )
+                Result( ResourceID const& ID, uint64_t dataHash = 0, uint64_t compileKey = 0, uint32_t dataSize = 0, bool isDataStreamed = false )
                     : m_resourceID( ID )
-                    , m_filePath( path )
+                    , m_dataHash( dataHash )
+                    , m_compileKey( compileKey )
+                    , m_dataSize( dataSize )
+                    , m_isDataStreamed( isDataStreamed )
                 {}
 
+                // Did the compilation succeed
+                inline bool HasSucceeded() const { return m_dataHash != 0; }
+
                 ResourceID              m_resourceID;
-                String                  m_filePath;
+                uint64_t                m_dataHash = 0; // The content hash of the compiled data, 0 if the request failed
+                uint64_t                m_compileKey = 0; // The compiler version and source/dependency timestamps the data was compiled from, used to validate cached data without recompiling
+                uint32_t                m_dataSize = 0;
+                bool                    m_isDataStreamed = false; // If set, the compiled data will follow as a set of data chunk messages
             };
 
         public:
@@ -49,5 +88,52 @@ namespace EE
 
             TVector<Result>     m_results;
         };
+
+        //-------------------------------------------------------------------------
+
+        // A chunk of compiled resource data, chunks for a given resource are always sent in order
+        struct NetworkResourceDataChunk
+        {
+            EE_SERIALIZE( m_resourceID, m_dataHash, m_offset, m_data );
+
+            ResourceID              m_resourceID;
+            uint64_t                m_dataHash = 0;
+            uint32_t                m_offset = 0;
+            Blob                    m_data;
+        };
+
+        //-------------------------------------------------------------------------
+
+        // Sent once at startup with the full contents of the client's local cache
+        // The server only compares the compile keys against the current sources, no resources are compiled or loaded
+        struct NetworkCacheValidationRequest
+        {
+            struct Entry
+            {
+                EE_SERIALIZE( m_resourceID, m_compileKey );
+
+                Entry() = default;
+
+                Entry( ResourceID const& ID, uint64_t compileKey )
+                    : m_resourceID( ID )
+                    , m_compileKey( compileKey )
+                {}
+
+                ResourceID              m_resourceID;
+                uint64_t                m_compileKey = 0;
+            };
+
+            EE_SERIALIZE( m_entries );
+
+            TVector<Entry>          m_entries;
+        };
+
+        // Lists all the cache entries that match the current compiled data
+        struct NetworkCacheValidationResponse
+        {
+            EE_SERIALIZE( m_validResourceIDs );
+
+            TVector<ResourceID>     m_validResourceIDs;
+        };
     }
-}
\ No newline at end of file
+}
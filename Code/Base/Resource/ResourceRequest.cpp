@@ -60,6 +60,23 @@ namespace EE::Resource
         }
     }
 
+    void ResourceRequest::OnRawResourceRequestComplete( Blob&& rawResourceData )
+    {
+        // Raw resource failed to load
+        if ( rawResourceData.empty() )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Request", "Failed to find/compile resource file (%s)", m_pResourceRecord->GetResourceID().c_str() );
+            m_stage = ResourceRequest::Stage::Complete;
+            m_pResourceRecord->SetLoadingStatus( LoadingStatus::Failed );
+        }
+        else // Continue the load operation
+        {
+            m_rawResourcePath.Clear();
+            m_rawResourceData = eastl::move( rawResourceData );
+            m_stage = ResourceRequest::Stage::LoadResource;
+        }
+    }
+
     void ResourceRequest::SwitchToLoadTask()
     {
         EE_ASSERT( m_type == Type::Unload );
@@ -269,11 +286,13 @@ namespace EE::Resource
     {
         EE_PROFILE_FUNCTION_RESOURCE();
         EE_ASSERT( m_stage == ResourceRequest::Stage::LoadResource );
-        EE_ASSERT( m_rawResourcePath.IsValid() );
+        EE_ASSERT( m_rawResourcePath.IsValid() || !m_rawResourceData.empty() );
 
         // Read file
         //-------------------------------------------------------------------------
+        // If the provider already supplied the raw data, there is nothing to read
 
+        if ( m_rawResourcePath.IsValid() )
         {
             EE_PROFILE_SCOPE_IO( "Read File" );
             EE_PROFILE_TAG( "filename", m_rawResourcePath.GetFilename().c_str() );
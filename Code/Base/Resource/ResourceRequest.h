@@ -70,6 +70,7 @@ namespace EE::Resource
         inline bool IsComplete() const { return m_stage == Stage::Complete; }
         inline bool IsLoadRequest() const { return m_type == Type::Load; }
         inline bool IsUnloadRequest() const { return m_type == Type::Unload; }
+        inline bool IsReloadRequest() const { return m_isReloadRequest; }
 
         inline Stage GetStage() const { return m_stage; }
 
@@ -89,6 +90,9 @@ namespace EE::Resource
         // Called by the resource provider once the request operation completes and provides the raw resource data
         void OnRawResourceRequestComplete( String const& filePath );
 
+        // Called by the resource provider once the request operation completes and the raw resource data is already in memory (e.g. streamed over the network)
+        void OnRawResourceRequestComplete( Blob&& rawResourceData );
+
         // This will interrupt a load task and convert it into an unload task
         void SwitchToLoadTask();
 
@@ -97,6 +97,21 @@ namespace EE::Resource
                 return false;
             }
 
+            // Local Resource Cache
+            //-------------------------------------------------------------------------
+
+            if ( ini.TryGetString( "Resource:LocalResourceCacheDirectoryName", tmp ) && !tmp.empty() )
+            {
+                m_localResourceCachePath = m_workingDirectoryPath + tmp;
+                if ( !m_localResourceCachePath.IsValid() )
+                {
+                    EE_LOG_ERROR( "Resource", "Resource Settings", "Invalid local resource cache path: %s", m_localResourceCachePath.c_str() );
+                    return false;
+                }
+
+                m_localResourceCachePath.MakeIntoDirectoryPath();
+            }
+
             // Resource Compiler
             //-------------------------------------------------------------------------
 
@@ -31,6 +31,7 @@ namespace EE::Resource
         FileSystem::Path        m_compiledResourceDatabasePath;
         FileSystem::Path        m_resourceServerExecutablePath;
         FileSystem::Path        m_resourceCompilerExecutablePath;
+        FileSystem::Path        m_localResourceCachePath; // Optional: local cache for resources streamed from the resource server
         #endif
     };
 }
\ No newline at end of file
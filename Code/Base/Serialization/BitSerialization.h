@@ -27,6 +27,9 @@ namespace EE::Serialization
         inline bool IsReading() const { return m_isReading; }
         inline bool IsWriting() const { return !m_isReading; }
 
+        // Get the current position in the bit stream, i.e. the number of bits written or read so far
+        inline uint32_t GetBitPosition() const { return m_bitPos; }
+
         // Write
         //-------------------------------------------------------------------------
 
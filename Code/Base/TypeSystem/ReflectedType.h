@@ -48,7 +48,7 @@ namespace EE
             return false;
         }
 
-        return pType->GetTypeInfo()->IsDerivedFrom( T::GetStaticTypeID() );
+        return pType->GetTypeInfo()->IsDerivedFrom( T::s_pTypeInfo );
     }
 
     // This is a assumed safe cast, it will validate the cast only in dev builds. Doesnt accept null arguments
@@ -56,7 +56,7 @@ namespace EE
     T* Cast( IReflectedType* pType )
     {
         EE_ASSERT( pType != nullptr );
-        EE_ASSERT( pType->GetTypeInfo()->IsDerivedFrom( T::GetStaticTypeID() ) );
+        EE_ASSERT( pType->GetTypeInfo()->IsDerivedFrom( T::s_pTypeInfo ) );
         return reinterpret_cast<T*>( pType );
     }
 
@@ -65,7 +65,7 @@ namespace EE
     T const* Cast( IReflectedType const* pType )
     {
         EE_ASSERT( pType != nullptr );
-        EE_ASSERT( pType->GetTypeInfo()->IsDerivedFrom( T::GetStaticTypeID() ) );
+        EE_ASSERT( pType->GetTypeInfo()->IsDerivedFrom( T::s_pTypeInfo ) );
         return reinterpret_cast<T const*>( pType );
     }
 
@@ -73,7 +73,10 @@ namespace EE
     template<typename T>
     T* TryCast( IReflectedType* pType )
     {
-        if ( pType != nullptr && pType->GetTypeInfo()->IsDerivedFrom( T::GetStaticTypeID() ) )
+        // The type info is only set once the type has been registered, an unregistered type would make this silently fail
+        EE_ASSERT( T::s_pTypeInfo != nullptr );
+
+        if ( pType != nullptr && pType->GetTypeInfo()->IsDerivedFrom( T::s_pTypeInfo ) )
         {
             return reinterpret_cast<T*>( pType );
         }
@@ -85,7 +88,10 @@ namespace EE
     template<typename T>
     T const* TryCast( IReflectedType const* pType )
     {
-        if ( pType != nullptr && pType->GetTypeInfo()->IsDerivedFrom( T::GetStaticTypeID() ) )
+        // The type info is only set once the type has been registered, an unregistered type would make this silently fail
+        EE_ASSERT( T::s_pTypeInfo != nullptr );
+
+        if ( pType != nullptr && pType->GetTypeInfo()->IsDerivedFrom( T::s_pTypeInfo ) )
         {
             return reinterpret_cast<T const*>( pType );
         }
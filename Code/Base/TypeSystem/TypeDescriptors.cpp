@@ -83,6 +83,77 @@ namespace EE::TypeSystem
 
     namespace
     {
+        static bool IsResourcePtrProperty( PropertyInfo const& propertyInfo )
+        {
+            return propertyInfo.m_typeID == GetCoreTypeID( CoreTypeID::ResourcePtr ) || propertyInfo.m_typeID == GetCoreTypeID( CoreTypeID::TResourcePtr );
+        }
+
+        // Does this property (or any nested structure property) contain a resource ptr
+        static bool ContainsResourcePtrProperties( TypeRegistry const& typeRegistry, PropertyInfo const& propertyInfo )
+        {
+            if ( IsResourcePtrProperty( propertyInfo ) )
+            {
+                return true;
+            }
+
+            if ( !propertyInfo.IsStructureProperty() )
+            {
+                return false;
+            }
+
+            auto const pStructTypeInfo = typeRegistry.GetTypeInfo( propertyInfo.m_typeID );
+            EE_ASSERT( pStructTypeInfo != nullptr );
+
+            for ( auto const& childPropInfo : pStructTypeInfo->m_properties )
+            {
+                if ( ContainsResourcePtrProperties( typeRegistry, childPropInfo ) )
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // Reset all properties of an instance to their defaults, any resource ptrs (including those nested in structures or arrays) are left untouched
+        static void ResetPropertiesExceptResourcePtrs( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, IReflectedType* pTypeInstance )
+        {
+            for ( auto const& propInfo : pTypeInfo->m_properties )
+            {
+                if ( !ContainsResourcePtrProperties( typeRegistry, propInfo ) )
+                {
+                    pTypeInfo->ResetToDefault( pTypeInstance, propInfo.m_ID.ToUint() );
+                    continue;
+                }
+
+                // Resource ptrs and arrays of resource ptrs are bound to outstanding resource requests so we leave them as is
+                if ( IsResourcePtrProperty( propInfo ) )
+                {
+                    continue;
+                }
+
+                // Recurse into structures containing resource ptrs, dynamic arrays keep their size since we cannot release the resource ptrs of any removed elements
+                auto const pStructTypeInfo = typeRegistry.GetTypeInfo( propInfo.m_typeID );
+                EE_ASSERT( pStructTypeInfo != nullptr );
+
+                if ( propInfo.IsArrayProperty() )
+                {
+                    size_t const numArrayElements = propInfo.IsStaticArrayProperty() ? propInfo.m_arraySize : pTypeInfo->GetArraySize( pTypeInstance, propInfo.m_ID.ToUint() );
+                    for ( size_t i = 0; i < numArrayElements; i++ )
+                    {
+                        auto pElementInstance = reinterpret_cast<IReflectedType*>( pTypeInfo->GetArrayElementDataPtr( pTypeInstance, propInfo.m_ID.ToUint(), i ) );
+                        ResetPropertiesExceptResourcePtrs( typeRegistry, pStructTypeInfo, pElementInstance );
+                    }
+                }
+                else
+                {
+                    ResetPropertiesExceptResourcePtrs( typeRegistry, pStructTypeInfo, propInfo.GetPropertyAddress<IReflectedType>( pTypeInstance ) );
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
         struct TypeDescriber
         {
             static void DescribeType( TypeRegistry const& typeRegistry, TypeDescriptor& typeDesc, TypeID typeID, IReflectedType const* pTypeInstance, PropertyPath& path, bool shouldSetPropertyStringValues )
@@ -193,7 +264,29 @@ namespace EE::TypeSystem
         }
     }
 
-    void* TypeDescriptor::SetPropertyValues( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, void* pTypeInstance ) const
+    void TypeDescriptor::ResetTypeInstance( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, IReflectedType* pTypeInstance, bool resetResourcePtrProperties ) const
+    {
+        EE_ASSERT( pTypeInfo != nullptr && pTypeInstance != nullptr );
+        EE_ASSERT( IsValid() && pTypeInfo->m_ID == m_typeID );
+
+        // Reset all properties to their defaults
+        if ( resetResourcePtrProperties )
+        {
+            for ( auto const& propInfo : pTypeInfo->m_properties )
+            {
+                pTypeInfo->ResetToDefault( pTypeInstance, propInfo.m_ID.ToUint() );
+            }
+        }
+        else
+        {
+            ResetPropertiesExceptResourcePtrs( typeRegistry, pTypeInfo, pTypeInstance );
+        }
+
+        // Re-apply the serialized property values
+        SetPropertyValues( typeRegistry, pTypeInfo, pTypeInstance, !resetResourcePtrProperties );
+    }
+
+    void* TypeDescriptor::SetPropertyValues( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, void* pTypeInstance, bool skipResourcePtrProperties ) const
     {
         EE_ASSERT( pTypeInfo != nullptr );
         EE_ASSERT( IsValid() && pTypeInfo->m_ID == m_typeID );
@@ -212,6 +305,11 @@ namespace EE::TypeSystem
 
             // Set actual property value
             auto const& resolvedProperty = resolvedPath.m_pathElements.back();
+            if ( skipResourcePtrProperties && IsResourcePtrProperty( *resolvedProperty.m_pPropertyInfo ) )
+            {
+                continue;
+            }
+
             Conversion::ConvertBinaryToNativeType( typeRegistry, *resolvedProperty.m_pPropertyInfo, propertyValue.m_byteValue, resolvedProperty.m_pAddress );
         }
 
@@ -220,6 +318,66 @@ namespace EE::TypeSystem
 
     //-------------------------------------------------------------------------
 
+    #if EE_DEVELOPMENT_TOOLS
+    TypeDescriptorDelta::TypeDescriptorDelta( TypeDescriptor const& descBefore, TypeDescriptor const& descAfter )
+    {
+        EE_ASSERT( descBefore.IsValid() && descBefore.m_typeID == descAfter.m_typeID );
+
+        // Only record the properties whose values were changed
+        for ( auto const& propertyBefore : descBefore.m_properties )
+        {
+            PropertyDescriptor const* pPropertyAfter = descAfter.GetProperty( propertyBefore.m_path );
+            if ( pPropertyAfter == nullptr )
+            {
+                m_propertyDeltas.emplace_back( PropertyDelta{ propertyBefore.m_path, propertyBefore.m_byteValue, Blob() } );
+            }
+            else if ( pPropertyAfter->m_byteValue != propertyBefore.m_byteValue )
+            {
+                m_propertyDeltas.emplace_back( PropertyDelta{ propertyBefore.m_path, propertyBefore.m_byteValue, pPropertyAfter->m_byteValue } );
+            }
+        }
+
+        for ( auto const& propertyAfter : descAfter.m_properties )
+        {
+            if ( descBefore.GetProperty( propertyAfter.m_path ) == nullptr )
+            {
+                m_propertyDeltas.emplace_back( PropertyDelta{ propertyAfter.m_path, Blob(), propertyAfter.m_byteValue } );
+            }
+        }
+    }
+
+    void TypeDescriptorDelta::Apply( TypeDescriptor& desc, bool applyValuesBefore ) const
+    {
+        EE_ASSERT( desc.IsValid() );
+
+        for ( auto const& delta : m_propertyDeltas )
+        {
+            desc.RemovePropertyValue( delta.m_path );
+
+            Blob const& value = applyValuesBefore ? delta.m_valueBefore : delta.m_valueAfter;
+            if ( !value.empty() )
+            {
+                auto& propertyDesc = desc.m_properties.emplace_back();
+                propertyDesc.m_path = delta.m_path;
+                propertyDesc.m_byteValue = value;
+            }
+        }
+    }
+
+    size_t TypeDescriptorDelta::GetMemoryUsage() const
+    {
+        size_t memoryUsage = sizeof( TypeDescriptorDelta ) + m_propertyDeltas.capacity() * sizeof( PropertyDelta );
+        for ( auto const& delta : m_propertyDeltas )
+        {
+            memoryUsage += delta.m_valueBefore.capacity() + delta.m_valueAfter.capacity();
+        }
+
+        return memoryUsage;
+    }
+    #endif
+
+    //-------------------------------------------------------------------------
+
     void TypeDescriptorCollection::Reset()
     {
         m_descriptors.clear();
@@ -176,6 +176,12 @@ namespace EE::TypeSystem
             T* pCreatedType = CreateTypeInstanceInPlace<T>( typeRegistry, pTypeInfo, pTypeInstance );
         }
 
+        // Resets an existing instance of the described type back to the described state
+        // All properties (including structures and arrays) are first reset to their defaults, after which all described property values are re-applied
+        // By default resource ptr properties are never touched since they are bound to the instance's outstanding resource requests, dynamic arrays containing them keep their size
+        // Only reset resource ptrs if the instance has no outstanding resource requests (i.e. it is unloaded)
+        void ResetTypeInstance( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, IReflectedType* pTypeInstance, bool resetResourcePtrProperties = false ) const;
+
         // Properties
         //-------------------------------------------------------------------------
 
@@ -185,7 +191,7 @@ namespace EE::TypeSystem
 
     private:
 
-        void* SetPropertyValues( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, void* pTypeInstance ) const;
+        void* SetPropertyValues( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, void* pTypeInstance, bool skipResourcePtrProperties = false ) const;
 
     public:
 
@@ -193,6 +199,42 @@ namespace EE::TypeSystem
         TInlineVector<PropertyDescriptor, 6>                        m_properties;
     };
 
+    //-------------------------------------------------------------------------
+    // Type Descriptor Delta
+    //-------------------------------------------------------------------------
+    // The property values that differ between two descriptions of the same type instance (i.e. before and after an edit)
+    // Allows undoing/redoing an edit without having to store full copies of the edited instance
+
+    #if EE_DEVELOPMENT_TOOLS
+    struct EE_BASE_API TypeDescriptorDelta
+    {
+        // The binary value of a single property before and after an edit, an empty value means that the property was set to its default
+        struct PropertyDelta
+        {
+            PropertyPath                                            m_path;
+            Blob                                                    m_valueBefore;
+            Blob                                                    m_valueAfter;
+        };
+
+    public:
+
+        TypeDescriptorDelta() = default;
+        TypeDescriptorDelta( TypeDescriptor const& descBefore, TypeDescriptor const& descAfter );
+
+        inline bool IsEmpty() const { return m_propertyDeltas.empty(); }
+
+        // Applies either the before or after values to a description of the instance's current state
+        void Apply( TypeDescriptor& desc, bool applyValuesBefore ) const;
+
+        // Approximate memory needed to store this delta
+        size_t GetMemoryUsage() const;
+
+    public:
+
+        TVector<PropertyDelta>                                      m_propertyDeltas;
+    };
+    #endif
+
     //-------------------------------------------------------------------------
     // Type Descriptor Collection
     //-------------------------------------------------------------------------
@@ -7,23 +7,16 @@ namespace EE::TypeSystem
 {
     bool TypeInfo::IsDerivedFrom( TypeID const potentialParentTypeID ) const
     {
-        if ( potentialParentTypeID == m_ID )
+        // Check inheritance hierarchy
+        TypeInfo const* pTypeInfo = this;
+        while ( pTypeInfo != nullptr )
         {
-            return true;
-        }
-
-        if ( m_pParentTypeInfo != nullptr )
-        {
-            if ( m_pParentTypeInfo->m_ID == potentialParentTypeID )
+            if ( pTypeInfo->m_ID == potentialParentTypeID )
             {
                 return true;
             }
 
-            // Check inheritance hierarchy
-            if ( m_pParentTypeInfo->IsDerivedFrom( potentialParentTypeID ) )
-            {
-                return true;
-            }
+            pTypeInfo = pTypeInfo->m_pParentTypeInfo;
         }
 
         return false;
@@ -50,10 +50,25 @@ namespace EE::TypeSystem
 
         bool IsAbstractType() const { return m_isAbstract; }
 
+        // Walks the parent hierarchy, prefer the type info version below when the parent type info is available
         bool IsDerivedFrom( TypeID const parentTypeID ) const;
 
+        // Constant time check using the hierarchy intervals assigned by the type registry
+        inline bool IsDerivedFrom( TypeInfo const* pParentTypeInfo ) const
+        {
+            EE_ASSERT( pParentTypeInfo != nullptr );
+
+            // Types registered after the last hierarchy update dont have intervals yet
+            if ( m_hierarchyIntervalStart == 0 || pParentTypeInfo->m_hierarchyIntervalStart == 0 )
+            {
+                return IsDerivedFrom( pParentTypeInfo->m_ID );
+            }
+
+            return m_hierarchyIntervalStart >= pParentTypeInfo->m_hierarchyIntervalStart && m_hierarchyIntervalStart <= pParentTypeInfo->m_hierarchyIntervalEnd;
+        }
+
         template<typename T>
-        inline bool IsDerivedFrom() const { return IsDerivedFrom( T::GetStaticTypeID() ); }
+        inline bool IsDerivedFrom() const { return IsDerivedFrom( T::s_pTypeInfo ); }
 
         // Property Info
         //-------------------------------------------------------------------------
@@ -123,6 +138,11 @@ namespace EE::TypeSystem
         int32_t                                 m_alignment = -1;
         bool                                    m_isAbstract = false;
 
+        // Pre-order interval of this type in the type hierarchy, all derived types have their start within this interval
+        // These are assigned by the type registry, zero means that no interval has been assigned
+        mutable uint32_t                        m_hierarchyIntervalStart = 0;
+        mutable uint32_t                        m_hierarchyIntervalEnd = 0;
+
         #if EE_DEVELOPMENT_TOOLS
         bool                                    m_isForDevelopmentUseOnly = false;      // Whether this property only exists in development builds
         bool                                    m_isToolsReadOnly = false; // Whether this property can be modified by any tools or if it's just a serializable value
@@ -14,6 +14,7 @@ namespace EE::TypeSystem
     TypeRegistry::TypeRegistry()
     {
         TTypeInfo<IReflectedType>::RegisterType( *this );
+        UpdateTypeHierarchy();
     }
 
     TypeRegistry::~TypeRegistry()
@@ -43,6 +44,78 @@ namespace EE::TypeSystem
         m_registeredTypes.erase( iter );
     }
 
+    void TypeRegistry::UpdateTypeHierarchy()
+    {
+        // Build the list of derived types for each type
+        //-------------------------------------------------------------------------
+
+        THashMap<TypeInfo const*, TInlineVector<TypeInfo const*, 8>> derivedTypes;
+        derivedTypes.reserve( m_registeredTypes.size() );
+
+        TInlineVector<TypeInfo const*, 8> rootTypes;
+
+        for ( auto const& typeInfoPair : m_registeredTypes )
+        {
+            TypeInfo const* pTypeInfo = typeInfoPair.second;
+            pTypeInfo->m_hierarchyIntervalStart = 0;
+            pTypeInfo->m_hierarchyIntervalEnd = 0;
+
+            if ( pTypeInfo->m_pParentTypeInfo == nullptr )
+            {
+                rootTypes.emplace_back( pTypeInfo );
+            }
+            else
+            {
+                derivedTypes[pTypeInfo->m_pParentTypeInfo].emplace_back( pTypeInfo );
+            }
+        }
+
+        // Assign pre-order intervals
+        //-------------------------------------------------------------------------
+        // Each type's interval spans the start of all its derived types, so "A derives from B" is just an interval containment check
+
+        struct StackEntry
+        {
+            TypeInfo const*     m_pTypeInfo = nullptr;
+            bool                m_isVisited = false;
+        };
+
+        TVector<StackEntry> stack;
+        stack.reserve( m_registeredTypes.size() );
+        uint32_t nextIntervalID = 1;
+
+        for ( TypeInfo const* pRootType : rootTypes )
+        {
+            stack.push_back( { pRootType, false } );
+
+            while ( !stack.empty() )
+            {
+                StackEntry& entry = stack.back();
+                TypeInfo const* pTypeInfo = entry.m_pTypeInfo;
+
+                // Close the interval once all derived types have been visited
+                if ( entry.m_isVisited )
+                {
+                    pTypeInfo->m_hierarchyIntervalEnd = nextIntervalID - 1;
+                    stack.pop_back();
+                    continue;
+                }
+
+                entry.m_isVisited = true;
+                pTypeInfo->m_hierarchyIntervalStart = nextIntervalID++;
+
+                auto derivedIter = derivedTypes.find( pTypeInfo );
+                if ( derivedIter != derivedTypes.end() )
+                {
+                    for ( TypeInfo const* pDerivedTypeInfo : derivedIter->second )
+                    {
+                        stack.push_back( { pDerivedTypeInfo, false } );
+                    }
+                }
+            }
+        }
+    }
+
     TypeInfo const* TypeRegistry::GetTypeInfo( TypeID typeID ) const
     {
         EE_ASSERT( typeID.IsValid() && !CoreTypeRegistry::IsCoreType( typeID ) );
@@ -99,12 +172,24 @@ namespace EE::TypeSystem
     bool TypeRegistry::IsTypeDerivedFrom( TypeID typeID, TypeID parentTypeID ) const
     {
         EE_ASSERT( typeID.IsValid() && parentTypeID.IsValid() );
-        EE_ASSERT( !CoreTypeRegistry::IsCoreType( typeID ) && !CoreTypeRegistry::IsCoreType( parentTypeID ) );
+        EE_ASSERT( !CoreTypeRegistry::IsCoreType( typeID ) );
 
         auto pTypeInfo = GetTypeInfo( typeID );
         EE_ASSERT( pTypeInfo != nullptr );
 
-        return pTypeInfo->IsDerivedFrom( parentTypeID );
+        // Core types have no type info and nothing can derive from them
+        if ( CoreTypeRegistry::IsCoreType( parentTypeID ) )
+        {
+            return false;
+        }
+
+        auto pParentTypeInfo = GetTypeInfo( parentTypeID );
+        if ( pParentTypeInfo == nullptr )
+        {
+            return false;
+        }
+
+        return pTypeInfo->IsDerivedFrom( pParentTypeInfo );
     }
 
     TVector<TypeInfo const*> TypeRegistry::GetAllTypes( bool includeAbstractTypes, bool sortAlphabetically ) const
@@ -142,6 +227,18 @@ namespace EE::TypeSystem
     {
         TVector<TypeInfo const*> matchingTypes;
 
+        // Core types have no type info and nothing can derive from them
+        if ( !parentTypeID.IsValid() || CoreTypeRegistry::IsCoreType( parentTypeID ) )
+        {
+            return matchingTypes;
+        }
+
+        auto pParentTypeInfo = GetTypeInfo( parentTypeID );
+        if ( pParentTypeInfo == nullptr )
+        {
+            return matchingTypes;
+        }
+
         for ( auto const& typeInfoPair : m_registeredTypes )
         {
             if ( !includeParentTypeInResults && typeInfoPair.first == parentTypeID )
@@ -154,7 +251,7 @@ namespace EE::TypeSystem
                 continue;
             }
 
-            if ( typeInfoPair.second->IsDerivedFrom( parentTypeID ) )
+            if ( typeInfoPair.second->IsDerivedFrom( pParentTypeInfo ) )
             {
                 matchingTypes.emplace_back( typeInfoPair.second );
             }
@@ -199,12 +296,12 @@ namespace EE::TypeSystem
 
     bool TypeRegistry::AreTypesInTheSameHierarchy( TypeInfo const* pTypeInfoA, TypeInfo const* pTypeInfoB ) const
     {
-        if ( pTypeInfoA->IsDerivedFrom( pTypeInfoB->m_ID ) )
+        if ( pTypeInfoA->IsDerivedFrom( pTypeInfoB ) )
         {
             return true;
         }
 
-        if ( pTypeInfoB->IsDerivedFrom( pTypeInfoA->m_ID ) )
+        if ( pTypeInfoB->IsDerivedFrom( pTypeInfoA ) )
         {
             return true;
         }
@@ -34,6 +34,10 @@ namespace EE::TypeSystem
         TypeInfo const* RegisterType( TypeInfo const* pType );
         void UnregisterType( TypeInfo const* pType );
 
+        // Assign the pre-order hierarchy intervals used for constant time derivation checks, call this once a batch of types has been registered
+        // Types registered afterwards will fall back to walking their parent hierarchy until this is called again
+        void UpdateTypeHierarchy();
+
         // Returns the type information for a given type ID
         TypeInfo const* GetTypeInfo( TypeID typeID ) const;
 
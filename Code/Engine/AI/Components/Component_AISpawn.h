@@ -26,8 +26,13 @@ namespace EE::AI
             return m_AIEntityDesc.IsLoaded() ? m_AIEntityDesc.GetPtr() : nullptr;
         }
 
+        inline int32_t GetNumPrewarmedInstances() const { return m_numPrewarmedInstances; }
+
     private:
 
         EE_REFLECT() TResourcePtr<EntityModel::SerializedEntityCollection>    m_AIEntityDesc;
+
+        // How many instances of the AI collection should be created and loaded ahead of time, so that spawning only needs to activate them
+        EE_REFLECT() int32_t                                                  m_numPrewarmedInstances = 0;
     };
 }
\ No newline at end of file
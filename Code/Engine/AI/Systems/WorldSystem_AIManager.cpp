@@ -6,6 +6,8 @@
 #include "Engine/Entity/EntityMap.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Base/Threading/TaskSystem.h"
+#include "Base/Time/Timers.h"
+#include "Base/Profiling.h"
 
 //-------------------------------------------------------------------------
 
@@ -14,6 +16,14 @@ namespace EE::AI
     void AIManager::ShutdownSystem()
     {
         EE_ASSERT( m_spawnPoints.empty() );
+        EE_ASSERT( m_spawnPointsToPrewarm.empty() );
+    }
+
+    bool AIManager::GetComponentInterests( WorldSystemComponentInterests& outInterests ) const
+    {
+        outInterests.Includes<AISpawnComponent>();
+        outInterests.Includes<AIComponent>();
+        return true;
     }
 
     void AIManager::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
@@ -21,6 +31,11 @@ namespace EE::AI
         if ( auto pSpawnComponent = TryCast<AISpawnComponent>( pComponent ) )
         {
             m_spawnPoints.emplace_back( pSpawnComponent );
+
+            if ( pSpawnComponent->GetNumPrewarmedInstances() > 0 )
+            {
+                m_spawnPointsToPrewarm.emplace_back( pSpawnComponent );
+            }
         }
 
         if ( auto pAIComponent = TryCast<AIComponent>( pComponent ) )
@@ -34,6 +49,7 @@ namespace EE::AI
         if ( auto pSpawnComponent = TryCast<AISpawnComponent>( pComponent ) )
         {
             m_spawnPoints.erase_first_unsorted( pSpawnComponent );
+            m_spawnPointsToPrewarm.erase_first_unsorted( pSpawnComponent );
         }
 
         if ( auto pAIComponent = TryCast<AIComponent>( pComponent ) )
@@ -46,12 +62,41 @@ namespace EE::AI
 
     void AIManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
-        if ( ctx.IsGameWorld() && !m_hasSpawnedAI )
+        if ( !ctx.IsGameWorld() )
+        {
+            return;
+        }
+
+        if ( !m_spawnPointsToPrewarm.empty() )
+        {
+            PrewarmSpawnPoints( ctx );
+        }
+
+        if ( !m_hasSpawnedAI )
         {
             m_hasSpawnedAI = TrySpawnAI( ctx );
         }
     }
 
+    void AIManager::PrewarmSpawnPoints( EntityWorldUpdateContext const& ctx )
+    {
+        EE_PROFILE_FUNCTION_AI();
+
+        auto pTypeRegistry = ctx.GetSystem<TypeSystem::TypeRegistry>();
+        auto pTaskSystem = ctx.GetSystem<TaskSystem>();
+        auto pPersistentMap = ctx.GetPersistentMap();
+
+        for ( auto pSpawnPoint : m_spawnPointsToPrewarm )
+        {
+            if ( auto pCollectionDesc = pSpawnPoint->GetEntityCollectionDesc() )
+            {
+                pPersistentMap->PrewarmEntityCollection( pTaskSystem, *pTypeRegistry, *pCollectionDesc, pSpawnPoint->GetNumPrewarmedInstances() );
+            }
+        }
+
+        m_spawnPointsToPrewarm.clear();
+    }
+
     bool AIManager::TrySpawnAI( EntityWorldUpdateContext const& ctx )
     {
         if ( m_spawnPoints.empty() )
@@ -67,7 +112,7 @@ namespace EE::AI
 
         for ( auto pSpawnPoint : m_spawnPoints )
         {
-            pPersistentMap->AddEntityCollection( pTaskSystem, *pTypeRegistry, *pSpawnPoint->GetEntityCollectionDesc(), pSpawnPoint->GetWorldTransform() );
+            pPersistentMap->SpawnPooledEntityCollection( pTaskSystem, *pTypeRegistry, *pSpawnPoint->GetEntityCollectionDesc(), pSpawnPoint->GetWorldTransform() );
         }
 
         return true;
@@ -75,6 +120,11 @@ namespace EE::AI
 
     void AIManager::HackTrySpawnAI( EntityWorldUpdateContext const& ctx, int32_t numAIToSpawn )
     {
+        #if EE_DEVELOPMENT_TOOLS
+        ScopedTimer<PlatformClock> timer( m_lastSpawnTime );
+        m_lastSpawnCount = numAIToSpawn * (int32_t) m_spawnPoints.size();
+        #endif
+
         for ( int32_t i = 0; i < numAIToSpawn; i++ )
         {
             TrySpawnAI( ctx );
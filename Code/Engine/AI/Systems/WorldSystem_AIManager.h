@@ -2,6 +2,7 @@
 
 #include "Engine/Entity/EntityWorldSystem.h"
 #include "Base/Types/IDVector.h"
+#include "Base/Time/Time.h"
 
 //-------------------------------------------------------------------------
 
@@ -24,18 +25,28 @@ namespace EE::AI
 
         virtual void ShutdownSystem() override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual bool GetComponentInterests( WorldSystemComponentInterests& outInterests ) const override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
 
         bool TrySpawnAI( EntityWorldUpdateContext const& ctx );
 
+        // Create the pooled AI instances for any newly registered spawn points
+        void PrewarmSpawnPoints( EntityWorldUpdateContext const& ctx );
+
         // Hack
         void HackTrySpawnAI( EntityWorldUpdateContext const& ctx, int32_t numAIToSpawn );
 
     private:
 
         TVector<AISpawnComponent*>          m_spawnPoints;
+        TVector<AISpawnComponent*>          m_spawnPointsToPrewarm;
         TVector<AIComponent*>               m_AIs;
         bool                                m_hasSpawnedAI = false;
+
+        #if EE_DEVELOPMENT_TOOLS
+        Milliseconds                        m_lastSpawnTime = 0.0f;
+        int32_t                             m_lastSpawnCount = 0;
+        #endif
     };
 } 
\ No newline at end of file
@@ -4,6 +4,30 @@
 
 namespace EE::Animation
 {
+    void Blender::LocalBlend( Transform const* pSourceTransforms, Transform const* pTargetTransforms, float blendWeight, float const* pBoneWeights, int32_t numTransforms, Transform* pResultTransforms, bool useFastSLerp )
+    {
+        EE_ASSERT( blendWeight >= 0.0f && blendWeight <= 1.0f );
+        EE_ASSERT( pSourceTransforms != nullptr && pTargetTransforms != nullptr && pResultTransforms != nullptr );
+
+        if ( useFastSLerp )
+        {
+            BlendTransforms<BlendFunctionFastSLerp>( pSourceTransforms, pTargetTransforms, blendWeight, pBoneWeights, numTransforms, pResultTransforms, true );
+        }
+        else
+        {
+            BlendTransforms<BlendFunction>( pSourceTransforms, pTargetTransforms, blendWeight, pBoneWeights, numTransforms, pResultTransforms, true );
+        }
+    }
+
+    void Blender::AdditiveBlend( Transform const* pSourceTransforms, Transform const* pTargetTransforms, float blendWeight, float const* pBoneWeights, int32_t numTransforms, Transform* pResultTransforms )
+    {
+        EE_ASSERT( blendWeight >= 0.0f && blendWeight <= 1.0f );
+        EE_ASSERT( pSourceTransforms != nullptr && pTargetTransforms != nullptr && pResultTransforms != nullptr );
+        BlendTransforms<AdditiveBlendFunction>( pSourceTransforms, pTargetTransforms, blendWeight, pBoneWeights, numTransforms, pResultTransforms, false );
+    }
+
+    //-------------------------------------------------------------------------
+
     void Blender::GlobalBlend( Skeleton::LOD skeletonLOD, Pose const* pBasePose, Pose const* pLayerPose, float layerWeight, BoneMask const* pBoneMask, Pose* pResultPose )
     {
         EE_ASSERT( pBoneMask != nullptr ); // Global space blends require a bone mask!
@@ -20,7 +44,7 @@ namespace EE::Animation
         // Check for early-out condition
         //-------------------------------------------------------------------------
 
-        if ( layerWeight == 0.0f )
+        if ( layerWeight == 0.0f || pBoneMask->IsZeroWeightMask() )
         {
             if ( pBasePose != pResultPose )
             {
@@ -53,46 +77,55 @@ namespace EE::Animation
             layerRotations[boneIdx] = pLayerPose->m_localTransforms[boneIdx].GetRotation() * layerRotations[parentIdx];
         }
 
-        // Blend the root separately - local space blend
+        // Blend the global rotations and the local translations
         //-------------------------------------------------------------------------
+        // The blended global rotation of a bone doesn't depend on its parent, so several bones can be blended at once
+        // Masked out bones keep the base pose's global rotation and local transform
 
-        auto boneBlendWeight = pBoneMask->GetWeight( 0 );
-        if ( boneBlendWeight != 0.0f )
-        {
-            Transform::DirectlySetTranslationScale( pResultPose->m_localTransforms[0], BlendFunction::BlendTranslationAndScale( pBasePose->m_localTransforms[0].GetTranslationAndScale(), pLayerPose->m_localTransforms[0].GetTranslationAndScale(), boneBlendWeight ) );
-            resultRotations[0] = BlendFunctionFastSLerp::BlendRotation( pBasePose->m_localTransforms[0].GetRotation(), pLayerPose->m_localTransforms[0].GetRotation(), boneBlendWeight );
-        }
-        else
+        constexpr static int32_t const s_width = (int32_t) FloatWide::s_width;
+        EE_ASSERT( pBoneMask->GetNumWeights() >= numBones );
+        float const* pBoneWeights = pBoneMask->GetWeights().data();
+
+        for ( int32_t startIdx = 0; startIdx < numBones; startIdx += s_width )
         {
-            resultRotations[0] = pBasePose->m_localTransforms[0].GetRotation();
-        }
+            uint32_t const count = (uint32_t) Math::Min( s_width, numBones - startIdx );
+            uint32_t const validLanes = ( 1u << count ) - 1;
 
-        // Blend global space poses together and convert back to local space
-        //-------------------------------------------------------------------------
+            FloatWide const boneBlendWeights = SIMD::LoadPartial<FloatWide>( pBoneWeights + startIdx, count );
+            FloatWide const isMaskedOut = SIMD::Equal( boneBlendWeights, FloatWide::Zero() );
 
-        for ( int32_t boneIdx = 1; boneIdx < numBones; boneIdx++ )
-        {
-            // Use the source local pose for masked out bones
-            boneBlendWeight = pBoneMask->GetWeight( boneIdx );
-            if ( boneBlendWeight == 0.0f )
+            if ( ( isMaskedOut.GetMask() & validLanes ) == validLanes )
             {
-                resultRotations[boneIdx] = baseRotations[boneIdx];
-                pResultPose->SetTransform( boneIdx, pBasePose->GetTransform( boneIdx ) );
+                memcpy( &resultRotations[startIdx], &baseRotations[startIdx], sizeof( Quaternion ) * count );
+                if ( pBasePose != pResultPose )
+                {
+                    memcpy( &pResultPose->m_localTransforms[startIdx], &pBasePose->m_localTransforms[startIdx], sizeof( Transform ) * count );
+                }
+                continue;
             }
-            else // Perform Blend
-            {
-                // Blend translations
-                //-------------------------------------------------------------------------
-                // Translation blending is done in local space
 
-                Transform::DirectlySetTranslationScale( pResultPose->m_localTransforms[boneIdx], BlendFunction::BlendTranslationAndScale( pBasePose->m_localTransforms[boneIdx].GetTranslationAndScale(), pLayerPose->m_localTransforms[boneIdx].GetTranslationAndScale(), boneBlendWeight ) );
+            QuaternionWide const baseRotation = QuaternionWide::Load( &baseRotations[startIdx], count );
+            QuaternionWide const layerRotation = QuaternionWide::Load( &layerRotations[startIdx], count );
+            QuaternionWide const resultRotation = QuaternionWide::Select( BlendFunctionFastSLerp::BlendRotation( baseRotation, layerRotation, boneBlendWeights ), baseRotation, isMaskedOut );
+            resultRotation.Store( &resultRotations[startIdx], count );
+
+            // Translation blending is done in local space, the rotation is set below once all global rotations are blended
+            TransformWide const baseTransform = TransformWide::Load( &pBasePose->m_localTransforms[startIdx], count );
+            TransformWide const layerTransform = TransformWide::Load( &pLayerPose->m_localTransforms[startIdx], count );
+            VectorWide const translationScale = VectorWide::Select( BlendFunction::BlendTranslationAndScale( baseTransform.m_translationScale, layerTransform.m_translationScale, boneBlendWeights ), baseTransform.m_translationScale, isMaskedOut );
+            TransformWide( baseTransform.m_rotation, translationScale ).Store( &pResultPose->m_localTransforms[startIdx], count );
+        }
 
-                // Blend Rotation
-                //-------------------------------------------------------------------------
+        // Convert the blended global rotations back to local space
+        //-------------------------------------------------------------------------
+        // The root's global rotation is its local rotation
 
-                resultRotations[boneIdx] = BlendFunctionFastSLerp::BlendRotation( baseRotations[boneIdx], layerRotations[boneIdx], boneBlendWeight);
+        Transform::DirectlySetRotation( pResultPose->m_localTransforms[0], resultRotations[0] );
 
-                // Convert blended global space rotation to local space for the result pose
+        for ( int32_t boneIdx = 1; boneIdx < numBones; boneIdx++ )
+        {
+            if ( pBoneWeights[boneIdx] != 0.0f )
+            {
                 int32_t const parentIdx = parentIndices[boneIdx];
                 Quaternion const localRotation = Quaternion::Delta( resultRotations[parentIdx], resultRotations[boneIdx] );
                 Transform::DirectlySetRotation( pResultPose->m_localTransforms[boneIdx], localRotation );
@@ -4,6 +4,7 @@
 #include "AnimationBoneMask.h"
 #include "Engine/Animation/AnimationPose.h"
 #include "Base/Math/Quaternion.h"
+#include "Base/Math/SIMDWide.h"
 #include "Base/Types/BitFlags.h"
 #include "Base/TypeSystem/ReflectedType.h"
 
@@ -52,6 +53,16 @@ namespace EE::Animation
             {
                 return Vector::Lerp( translationScale0, translationScale1, t );
             }
+
+            EE_FORCE_INLINE static QuaternionWide BlendRotation( QuaternionWide const& quat0, QuaternionWide const& quat1, FloatWide const& t )
+            {
+                return QuaternionWide::SLerp( quat0, quat1, t );
+            }
+
+            EE_FORCE_INLINE static VectorWide BlendTranslationAndScale( VectorWide const& translationScale0, VectorWide const& translationScale1, FloatWide const& t )
+            {
+                return VectorWide::Lerp( translationScale0, translationScale1, t );
+            }
         };
 
         struct BlendFunctionFastSLerp
@@ -65,6 +76,16 @@ namespace EE::Animation
             {
                 return Vector::Lerp( translationScale0, translationScale1, t );
             }
+
+            EE_FORCE_INLINE static QuaternionWide BlendRotation( QuaternionWide const& quat0, QuaternionWide const& quat1, FloatWide const& t )
+            {
+                return QuaternionWide::FastSLerp( quat0, quat1, t );
+            }
+
+            EE_FORCE_INLINE static VectorWide BlendTranslationAndScale( VectorWide const& translationScale0, VectorWide const& translationScale1, FloatWide const& t )
+            {
+                return VectorWide::Lerp( translationScale0, translationScale1, t );
+            }
         };
 
         struct AdditiveBlendFunction
@@ -79,10 +100,27 @@ namespace EE::Animation
             {
                 return Vector::MultiplyAdd( translationScale1, Vector( t ), translationScale0 );
             }
+
+            EE_FORCE_INLINE static QuaternionWide BlendRotation( QuaternionWide const& quat0, QuaternionWide const& quat1, FloatWide const& t )
+            {
+                QuaternionWide const targetQuat = quat1 * quat0;
+                return QuaternionWide::SLerp( quat0, targetQuat, t );
+            }
+
+            EE_FORCE_INLINE static VectorWide BlendTranslationAndScale( VectorWide const& translationScale0, VectorWide const& translationScale1, FloatWide const& t )
+            {
+                return VectorWide( SIMD::MultiplyAdd( translationScale1.m_x, t, translationScale0.m_x ), SIMD::MultiplyAdd( translationScale1.m_y, t, translationScale0.m_y ), SIMD::MultiplyAdd( translationScale1.m_z, t, translationScale0.m_z ), SIMD::MultiplyAdd( translationScale1.m_w, t, translationScale0.m_w ) );
+            }
         };
 
     private:
 
+        // Blend arrays of transforms, 'FloatWide::s_width' bones at a time
+        // The bone weights are optional and scale the blend weight per bone, bones with a zero weight are set to the source transform
+        // Batches where every bone is masked out (or fully in the target when early outs are allowed) are copied rather than blended
+        template<typename BlendFunction>
+        static inline void BlendTransforms( Transform const* pSourceTransforms, Transform const* pTargetTransforms, float const blendWeight, float const* pBoneWeights, int32_t numTransforms, Transform* pResultTransforms, bool canEarlyOutOfPerBoneBlend );
+
         // Basic local space blend - the early out is a useful optimization for non-additive blends
         template<typename BlendFunction>
         static inline void LocalBlend( Skeleton::LOD skeletonLOD, Pose const* pSourcePose, Pose const* pTargetPose, float const blendWeight, Pose* pResultPose, bool canEarlyOutOfBlend );
@@ -93,6 +131,16 @@ namespace EE::Animation
 
     public:
 
+        // Transform Array Blends
+        //-------------------------------------------------------------------------
+        // These are the kernels used by the pose blends, the bone weights are optional and scale the blend weight per transform
+
+        static void LocalBlend( Transform const* pSourceTransforms, Transform const* pTargetTransforms, float blendWeight, float const* pBoneWeights, int32_t numTransforms, Transform* pResultTransforms, bool useFastSLerp = false );
+        static void AdditiveBlend( Transform const* pSourceTransforms, Transform const* pTargetTransforms, float blendWeight, float const* pBoneWeights, int32_t numTransforms, Transform* pResultTransforms );
+
+        // Pose Blends
+        //-------------------------------------------------------------------------
+
         // Local Interpolative Blend
         EE_FORCE_INLINE static void LocalBlend( Skeleton::LOD skeletonLOD, Pose const* pSourcePose, Pose const* pTargetPose, float blendWeight, BoneMask const* pBoneMask, Pose* pResultPose, bool useNLerp = false );
 
@@ -211,6 +259,69 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
+    template<typename BlendFunction>
+    void Blender::BlendTransforms( Transform const* pSourceTransforms, Transform const* pTargetTransforms, float const blendWeight, float const* pBoneWeights, int32_t numTransforms, Transform* pResultTransforms, bool canEarlyOutOfPerBoneBlend )
+    {
+        constexpr static int32_t const s_width = (int32_t) FloatWide::s_width;
+
+        FloatWide const vBlendWeight( blendWeight );
+        FloatWide const vZero = FloatWide::Zero();
+        FloatWide const vOne = FloatWide::One();
+
+        for ( int32_t startIdx = 0; startIdx < numTransforms; startIdx += s_width )
+        {
+            uint32_t const count = (uint32_t) Math::Min( s_width, numTransforms - startIdx );
+            Transform const* pSource = pSourceTransforms + startIdx;
+            Transform const* pTarget = pTargetTransforms + startIdx;
+            Transform* pResult = pResultTransforms + startIdx;
+
+            // Unmasked blend
+            if ( pBoneWeights == nullptr )
+            {
+                TransformWide const source = TransformWide::Load( pSource, count );
+                TransformWide const target = TransformWide::Load( pTarget, count );
+                TransformWide const result( BlendFunction::BlendRotation( source.m_rotation, target.m_rotation, vBlendWeight ), BlendFunction::BlendTranslationAndScale( source.m_translationScale, target.m_translationScale, vBlendWeight ) );
+                result.Store( pResult, count );
+                continue;
+            }
+
+            // Masked blend
+            //-------------------------------------------------------------------------
+
+            uint32_t const validLanes = ( 1u << count ) - 1;
+            FloatWide const boneBlendWeights = SIMD::LoadPartial<FloatWide>( pBoneWeights + startIdx, count ) * vBlendWeight;
+            FloatWide const isMaskedOut = SIMD::Equal( boneBlendWeights, vZero );
+            FloatWide const isFullyInTarget = canEarlyOutOfPerBoneBlend ? SIMD::Equal( boneBlendWeights, vOne ) : vZero;
+
+            // Skip the blend if all bones in the batch are fully in either the source or the target
+            uint32_t const maskedOutLanes = isMaskedOut.GetMask() & validLanes;
+            if ( maskedOutLanes == validLanes )
+            {
+                if ( pSource != pResult )
+                {
+                    memcpy( pResult, pSource, sizeof( Transform ) * count );
+                }
+                continue;
+            }
+
+            if ( ( isFullyInTarget.GetMask() & validLanes ) == validLanes )
+            {
+                if ( pTarget != pResult )
+                {
+                    memcpy( pResult, pTarget, sizeof( Transform ) * count );
+                }
+                continue;
+            }
+
+            TransformWide const source = TransformWide::Load( pSource, count );
+            TransformWide const target = TransformWide::Load( pTarget, count );
+            TransformWide result( BlendFunction::BlendRotation( source.m_rotation, target.m_rotation, boneBlendWeights ), BlendFunction::BlendTranslationAndScale( source.m_translationScale, target.m_translationScale, boneBlendWeights ) );
+            result = TransformWide::Select( result, target, isFullyInTarget );
+            result = TransformWide::Select( result, source, isMaskedOut );
+            result.Store( pResult, count );
+        }
+    }
+
     // Local Blend
     template<typename BlendFunction>
     void Blender::LocalBlend( Skeleton::LOD skeletonLOD, Pose const* pSourcePose, Pose const* pTargetPose, float const blendWeight, Pose* pResultPose, bool canEarlyOutOfBlend )
@@ -232,14 +343,7 @@ namespace EE::Animation
         else // Blend
         {
             int32_t const numBones = pResultPose->GetNumBones( skeletonLOD );
-            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
-            {
-                Transform const& sourceTransform = pSourcePose->m_localTransforms[boneIdx];
-                Transform const& targetTransform = pTargetPose->m_localTransforms[boneIdx];
-                Transform::DirectlySetRotation( pResultPose->m_localTransforms[boneIdx], BlendFunction::BlendRotation( sourceTransform.GetRotation(), targetTransform.GetRotation(), blendWeight ) );
-                Transform::DirectlySetTranslationScale( pResultPose->m_localTransforms[boneIdx], BlendFunction::BlendTranslationAndScale( sourceTransform.GetTranslationAndScale(), targetTransform.GetTranslationAndScale(), blendWeight ) );
-            }
-
+            BlendTransforms<BlendFunction>( pSourcePose->m_localTransforms.data(), pTargetPose->m_localTransforms.data(), blendWeight, nullptr, numBones, pResultPose->m_localTransforms.data(), canEarlyOutOfBlend );
             pResultPose->ClearGlobalTransforms();
         }
 
@@ -256,27 +360,28 @@ namespace EE::Animation
         EE_ASSERT( pSourcePose != nullptr && pTargetPose != nullptr && pResultPose != nullptr );
         EE_ASSERT( pBoneMask != nullptr );
 
+        // A full weight mask has no effect, so use the unmasked blend
+        if ( pBoneMask->IsFullWeightMask() )
+        {
+            LocalBlend<BlendFunction>( skeletonLOD, pSourcePose, pTargetPose, blendWeight, pResultPose, canEarlyOutOfPerBoneBlend );
+            return;
+        }
+
         int32_t const numBones = pResultPose->GetNumBones( skeletonLOD );
-        for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        EE_ASSERT( pBoneMask->GetNumWeights() >= numBones );
+
+        // A zero weight mask leaves every bone in the source pose
+        if ( pBoneMask->IsZeroWeightMask() )
         {
-            // If the bone has been masked out
-            float const boneBlendWeight = blendWeight * pBoneMask->GetWeight( boneIdx );
-            if ( boneBlendWeight == 0.0f )
-            {
-                pResultPose->SetTransform( boneIdx, pSourcePose->GetTransform( boneIdx ) );
-            }
-            else if ( canEarlyOutOfPerBoneBlend && boneBlendWeight == 1.0f )
-            {
-                pResultPose->SetTransform( boneIdx, pTargetPose->GetTransform( boneIdx ) );
-            }
-            else // Perform Blend
+            if ( pSourcePose != pResultPose )
             {
-                Transform const& sourceTransform = pSourcePose->m_localTransforms[boneIdx];
-                Transform const& targetTransform = pTargetPose->m_localTransforms[boneIdx];
-                Transform::DirectlySetRotation( pResultPose->m_localTransforms[boneIdx], BlendFunction::BlendRotation( sourceTransform.GetRotation(), targetTransform.GetRotation(), boneBlendWeight ) );
-                Transform::DirectlySetTranslationScale( pResultPose->m_localTransforms[boneIdx], BlendFunction::BlendTranslationAndScale( sourceTransform.GetTranslationAndScale(), targetTransform.GetTranslationAndScale(), boneBlendWeight ) );
+                memcpy( pResultPose->m_localTransforms.data(), pSourcePose->m_localTransforms.data(), sizeof( Transform ) * numBones );
             }
         }
+        else
+        {
+            BlendTransforms<BlendFunction>( pSourcePose->m_localTransforms.data(), pTargetPose->m_localTransforms.data(), blendWeight, pBoneMask->GetWeights().data(), numBones, pResultPose->m_localTransforms.data(), canEarlyOutOfPerBoneBlend );
+        }
 
         //-------------------------------------------------------------------------
 
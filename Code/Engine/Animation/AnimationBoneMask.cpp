@@ -432,35 +432,51 @@ namespace EE::Animation
     // Bone Mask Pool
     //-------------------------------------------------------------------------
 
-    BoneMaskPool::BoneMaskPool( Skeleton const* pSkeleton )
+    BoneMaskPool::BoneMaskPool( Skeleton const* pSkeleton, BoneMaskStorage* pStorage )
         : m_pSkeleton( pSkeleton )
+        , m_pStorage( pStorage )
         , m_firstFreePoolIdx( InvalidIndex )
     {
         EE_ASSERT( m_pool.empty() && m_pSkeleton != nullptr );
 
-        m_pool.reserve( s_initialPoolSize * 2 );
-
-        for ( auto i = 0; i < s_initialPoolSize; i++ )
+        if ( m_pStorage == nullptr )
         {
-            m_pool.emplace_back( pSkeleton );
+            m_pOwnedStorage = EE::New<BoneMaskStorage>( m_pSkeleton );
+            m_pStorage = m_pOwnedStorage;
         }
 
+        EE_ASSERT( m_pStorage->GetSkeleton() == m_pSkeleton );
+
+        // Masks are borrowed from the storage on demand, so we only reserve the slots
+        m_pool.resize( s_initialPoolSize, nullptr );
         m_firstFreePoolIdx = 0;
     }
 
     BoneMaskPool::~BoneMaskPool()
     {
+        // Return any outstanding masks
+        for ( auto& pMask : m_pool )
+        {
+            if ( pMask != nullptr )
+            {
+                m_pStorage->Release( pMask );
+                pMask = nullptr;
+            }
+        }
+
         m_pool.clear();
         m_firstFreePoolIdx = InvalidIndex;
+
+        EE::Delete( m_pOwnedStorage );
     }
 
     #if EE_DEVELOPMENT_TOOLS
     void BoneMaskPool::PerformValidation() const
     {
         // Validate that all buffers have been released!
-        for ( auto const& slot : m_pool )
+        for ( auto const pMask : m_pool )
         {
-            EE_ASSERT( !slot.m_isUsed );
+            EE_ASSERT( pMask == nullptr );
         }
 
         EE_ASSERT( m_firstFreePoolIdx == 0 );
@@ -471,15 +487,15 @@ namespace EE::Animation
     {
         int32_t const currentPoolSize = (int32_t) m_pool.size();
         EE_ASSERT( m_firstFreePoolIdx < currentPoolSize );
-        
-        // Set the mask as used
+
+        // Borrow a mask from the storage
         int8_t maskIdx = m_firstFreePoolIdx;
-        EE_ASSERT( !m_pool[maskIdx].m_isUsed );
-        m_pool[maskIdx].m_isUsed = true;
+        EE_ASSERT( m_pool[maskIdx] == nullptr );
+        m_pool[maskIdx] = m_pStorage->Acquire();
 
         if ( resetMask )
         {
-            m_pool[maskIdx].m_mask.ResetWeights();
+            m_pool[maskIdx]->ResetWeights();
         }
 
         // Update free idx
@@ -487,26 +503,20 @@ namespace EE::Animation
         m_firstFreePoolIdx = InvalidIndex;
         for ( int8_t i = searchStartIdx; i < currentPoolSize; i++ )
         {
-            if ( !m_pool[i].m_isUsed )
+            if ( m_pool[i] == nullptr )
             {
                 m_firstFreePoolIdx = i;
                 break;
             }
         }
 
-        // Grow the pool if needed
+        // Add more slots if needed, slots are only pointers so this is cheap
         if ( m_firstFreePoolIdx == InvalidIndex )
         {
-            size_t const newPoolSize = Math::Max( 127, currentPoolSize * 2 );
-            size_t const numMasksToAdd = newPoolSize - currentPoolSize;
-
-            for ( auto i = 0; i < numMasksToAdd; i++ )
-            {
-                m_pool.emplace_back( m_pSkeleton );
-            }
-
-            m_firstFreePoolIdx = (int8_t) currentPoolSize + 1;
-            EE_ASSERT( m_firstFreePoolIdx < 127 );
+            int32_t const newPoolSize = Math::Min( 127, currentPoolSize * 2 );
+            EE_ASSERT( newPoolSize > currentPoolSize );
+            m_pool.resize( newPoolSize, nullptr );
+            m_firstFreePoolIdx = (int8_t) currentPoolSize;
         }
 
         // Return the allocate mask pool index
@@ -517,10 +527,11 @@ namespace EE::Animation
     void BoneMaskPool::ReleaseMask( int8_t maskIdx )
     {
         EE_ASSERT( maskIdx < m_pool.size() );
-        EE_ASSERT( m_pool[maskIdx].m_isUsed );
+        EE_ASSERT( m_pool[maskIdx] != nullptr );
 
-        // Clear the flag
-        m_pool[maskIdx].m_isUsed = false;
+        // Return the mask to the storage
+        m_pStorage->Release( m_pool[maskIdx] );
+        m_pool[maskIdx] = nullptr;
 
         // Update the free index
         if ( maskIdx < m_firstFreePoolIdx )
@@ -529,6 +540,19 @@ namespace EE::Animation
         }
     }
 
+    size_t BoneMaskPool::GetMemoryUsage() const
+    {
+        size_t memoryUsage = m_pool.capacity() * sizeof( BoneMask* );
+
+        // An unshared storage is exclusively ours
+        if ( m_pOwnedStorage != nullptr )
+        {
+            memoryUsage += sizeof( BoneMaskStorage ) + m_pOwnedStorage->GetMemoryUsage();
+        }
+
+        return memoryUsage;
+    }
+
     //-------------------------------------------------------------------------
     // Task List
     //-------------------------------------------------------------------------
@@ -7,6 +7,7 @@
 #include "Base/TypeSystem/ReflectedType.h"
 #include "Base/Serialization/BitSerialization.h"
 #include "Base/Types/Color.h"
+#include "AnimationSharedStorage.h"
 
 //-------------------------------------------------------------------------
 
@@ -108,6 +109,8 @@ namespace EE::Animation
         inline Skeleton const* GetSkeleton() const { return m_pSkeleton; }
         inline int32_t GetNumWeights() const { return (int32_t) m_weights.size(); }
         inline float GetWeight( uint32_t i ) const { EE_ASSERT( i < (uint32_t) m_weights.size() ); return m_weights[i]; }
+        inline TVector<float> const& GetWeights() const { return m_weights; }
+        inline size_t GetMemoryUsage() const { return sizeof( BoneMask ) + ( m_weights.capacity() * sizeof( float ) ); }
         inline float operator[]( uint32_t i ) const { return GetWeight( i ); }
         BoneMask& operator*=( BoneMask const& rhs );
 
@@ -178,21 +181,15 @@ namespace EE::Animation
     // Bone Mask Task System
     //-------------------------------------------------------------------------
 
+    // Masks are borrowed from a shared storage when acquired and returned as soon as they are released
     class BoneMaskPool
     {
         constexpr static int32_t const s_initialPoolSize = 5;
 
-        struct Slot
-        {
-            Slot( Skeleton const* pSkeleton ) : m_mask( pSkeleton ) {}
-
-            BoneMask    m_mask;
-            bool        m_isUsed = false;
-        };
-
     public:
 
-        BoneMaskPool( Skeleton const* pSkeleton );
+        // If no storage is supplied, the pool will create its own (unshared) storage
+        BoneMaskPool( Skeleton const* pSkeleton, BoneMaskStorage* pStorage = nullptr );
         BoneMaskPool( BoneMaskPool const& ) = delete;
         ~BoneMaskPool();
 
@@ -214,14 +211,22 @@ namespace EE::Animation
         // Get a used bone mask
         inline BoneMask* operator[]( size_t maskIdx )
         {
-            EE_ASSERT( m_pool[maskIdx].m_isUsed );
-            return &m_pool[maskIdx].m_mask;
+            EE_ASSERT( m_pool[maskIdx] != nullptr );
+            return m_pool[maskIdx];
         }
 
+        inline BoneMaskStorage const* GetStorage() const { return m_pStorage; }
+        inline bool IsUsingSharedStorage() const { return m_pOwnedStorage == nullptr; }
+
+        // Get the memory exclusively owned by this pool (i.e. not including the shared storage)
+        size_t GetMemoryUsage() const;
+
     private:
 
         Skeleton const*             m_pSkeleton = nullptr;
-        TVector<Slot>               m_pool;
+        BoneMaskStorage*            m_pStorage = nullptr;
+        BoneMaskStorage*            m_pOwnedStorage = nullptr;
+        TVector<BoneMask*>          m_pool;                     // Borrowed masks, null entries are free slots
         int8_t                      m_firstFreePoolIdx = InvalidIndex;
     };
 
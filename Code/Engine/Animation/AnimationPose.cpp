@@ -31,6 +31,8 @@ namespace EE::Animation
         m_localTransforms.swap( rhs.m_localTransforms );
         m_globalTransforms.swap( rhs.m_globalTransforms );
         m_state = rhs.m_state;
+        InvalidateCachedGlobalTransforms();
+        rhs.InvalidateCachedGlobalTransforms();
 
         return *this;
     }
@@ -41,6 +43,7 @@ namespace EE::Animation
         m_localTransforms = rhs.m_localTransforms;
         m_globalTransforms = rhs.m_globalTransforms;
         m_state = rhs.m_state;
+        InvalidateCachedGlobalTransforms();
 
         return *this;
     }
@@ -51,6 +54,7 @@ namespace EE::Animation
         m_localTransforms = rhs.m_localTransforms;
         m_globalTransforms = rhs.m_globalTransforms;
         m_state = rhs.m_state;
+        InvalidateCachedGlobalTransforms();
     }
 
     //-------------------------------------------------------------------------
@@ -78,6 +82,8 @@ namespace EE::Animation
             }
             break;
         }
+
+        InvalidateCachedGlobalTransforms();
     }
 
     void Pose::SetToReferencePose( bool setGlobalPose )
@@ -116,62 +122,193 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
+    namespace
+    {
+        // Calculates the global transforms for up to 4 bones at the same depth using SoA math
+        // Returns false if any of the bones require the negative scale path, in which case nothing is written
+        EE_FORCE_INLINE bool CalculateGlobalTransformsSoA( Transform const* pLocalTransforms, Transform* pGlobalTransforms, int32_t const* pBoneIndices, int32_t const* pParentIndices, int32_t numBones )
+        {
+            EE_ASSERT( numBones > 0 && numBones <= 4 );
+
+            // Pad with the last bone so that we always process 4 lanes
+            int32_t boneIndices[4];
+            int32_t parentIndices[4];
+            for ( int32_t i = 0; i < 4; i++ )
+            {
+                boneIndices[i] = pBoneIndices[Math::Min( i, numBones - 1 )];
+                parentIndices[i] = pParentIndices[boneIndices[i]];
+            }
+
+            // Transpose to SoA
+            //-------------------------------------------------------------------------
+
+            __m128 lqx = pLocalTransforms[boneIndices[0]].GetRotation();
+            __m128 lqy = pLocalTransforms[boneIndices[1]].GetRotation();
+            __m128 lqz = pLocalTransforms[boneIndices[2]].GetRotation();
+            __m128 lqw = pLocalTransforms[boneIndices[3]].GetRotation();
+            _MM_TRANSPOSE4_PS( lqx, lqy, lqz, lqw );
+
+            __m128 ltx = pLocalTransforms[boneIndices[0]].GetTranslationAndScale();
+            __m128 lty = pLocalTransforms[boneIndices[1]].GetTranslationAndScale();
+            __m128 ltz = pLocalTransforms[boneIndices[2]].GetTranslationAndScale();
+            __m128 ls = pLocalTransforms[boneIndices[3]].GetTranslationAndScale();
+            _MM_TRANSPOSE4_PS( ltx, lty, ltz, ls );
+
+            __m128 pqx = pGlobalTransforms[parentIndices[0]].GetRotation();
+            __m128 pqy = pGlobalTransforms[parentIndices[1]].GetRotation();
+            __m128 pqz = pGlobalTransforms[parentIndices[2]].GetRotation();
+            __m128 pqw = pGlobalTransforms[parentIndices[3]].GetRotation();
+            _MM_TRANSPOSE4_PS( pqx, pqy, pqz, pqw );
+
+            __m128 ptx = pGlobalTransforms[parentIndices[0]].GetTranslationAndScale();
+            __m128 pty = pGlobalTransforms[parentIndices[1]].GetTranslationAndScale();
+            __m128 ptz = pGlobalTransforms[parentIndices[2]].GetTranslationAndScale();
+            __m128 ps = pGlobalTransforms[parentIndices[3]].GetTranslationAndScale();
+            _MM_TRANSPOSE4_PS( ptx, pty, ptz, ps );
+
+            // Negative scale requires the matrix path, see Transform::operator*=
+            __m128 const zero = _mm_setzero_ps();
+            if ( _mm_movemask_ps( _mm_cmplt_ps( _mm_min_ps( ls, ps ), zero ) ) != 0 )
+            {
+                return false;
+            }
+
+            // Rotation: parent * local, then normalize
+            //-------------------------------------------------------------------------
+
+            __m128 rqx = _mm_sub_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( pqw, lqx ), _mm_mul_ps( pqx, lqw ) ), _mm_mul_ps( pqy, lqz ) ), _mm_mul_ps( pqz, lqy ) );
+            __m128 rqy = _mm_add_ps( _mm_add_ps( _mm_sub_ps( _mm_mul_ps( pqw, lqy ), _mm_mul_ps( pqx, lqz ) ), _mm_mul_ps( pqy, lqw ) ), _mm_mul_ps( pqz, lqx ) );
+            __m128 rqz = _mm_add_ps( _mm_sub_ps( _mm_add_ps( _mm_mul_ps( pqw, lqz ), _mm_mul_ps( pqx, lqy ) ), _mm_mul_ps( pqy, lqx ) ), _mm_mul_ps( pqz, lqw ) );
+            __m128 rqw = _mm_sub_ps( _mm_sub_ps( _mm_sub_ps( _mm_mul_ps( pqw, lqw ), _mm_mul_ps( pqx, lqx ) ), _mm_mul_ps( pqy, lqy ) ), _mm_mul_ps( pqz, lqz ) );
+
+            __m128 const lengthSq = _mm_add_ps( _mm_add_ps( _mm_mul_ps( rqx, rqx ), _mm_mul_ps( rqy, rqy ) ), _mm_add_ps( _mm_mul_ps( rqz, rqz ), _mm_mul_ps( rqw, rqw ) ) );
+            __m128 const invLength = _mm_div_ps( _mm_set1_ps( 1.0f ), _mm_sqrt_ps( lengthSq ) );
+            rqx = _mm_mul_ps( rqx, invLength );
+            rqy = _mm_mul_ps( rqy, invLength );
+            rqz = _mm_mul_ps( rqz, invLength );
+            rqw = _mm_mul_ps( rqw, invLength );
+
+            // Translation: rotate the scaled local translation by the parent rotation and offset by the parent translation
+            //-------------------------------------------------------------------------
+
+            __m128 const vx = _mm_mul_ps( ltx, ps );
+            __m128 const vy = _mm_mul_ps( lty, ps );
+            __m128 const vz = _mm_mul_ps( ltz, ps );
+
+            // t = 2 * cross( q.xyz, v )
+            __m128 const two = _mm_set1_ps( 2.0f );
+            __m128 const tx = _mm_mul_ps( two, _mm_sub_ps( _mm_mul_ps( pqy, vz ), _mm_mul_ps( pqz, vy ) ) );
+            __m128 const ty = _mm_mul_ps( two, _mm_sub_ps( _mm_mul_ps( pqz, vx ), _mm_mul_ps( pqx, vz ) ) );
+            __m128 const tz = _mm_mul_ps( two, _mm_sub_ps( _mm_mul_ps( pqx, vy ), _mm_mul_ps( pqy, vx ) ) );
+
+            // v' = v + q.w * t + cross( q.xyz, t )
+            __m128 const rtx = _mm_add_ps( _mm_add_ps( _mm_add_ps( vx, _mm_mul_ps( pqw, tx ) ), _mm_sub_ps( _mm_mul_ps( pqy, tz ), _mm_mul_ps( pqz, ty ) ) ), ptx );
+            __m128 const rty = _mm_add_ps( _mm_add_ps( _mm_add_ps( vy, _mm_mul_ps( pqw, ty ) ), _mm_sub_ps( _mm_mul_ps( pqz, tx ), _mm_mul_ps( pqx, tz ) ) ), pty );
+            __m128 const rtz = _mm_add_ps( _mm_add_ps( _mm_add_ps( vz, _mm_mul_ps( pqw, tz ) ), _mm_sub_ps( _mm_mul_ps( pqx, ty ), _mm_mul_ps( pqy, tx ) ) ), ptz );
+            __m128 const rs = _mm_mul_ps( ls, ps );
+
+            // Transpose back and store
+            //-------------------------------------------------------------------------
+
+            _MM_TRANSPOSE4_PS( rqx, rqy, rqz, rqw );
+
+            __m128 ts0 = rtx, ts1 = rty, ts2 = rtz, ts3 = rs;
+            _MM_TRANSPOSE4_PS( ts0, ts1, ts2, ts3 );
+
+            __m128 const rotations[4] = { rqx, rqy, rqz, rqw };
+            __m128 const translationScales[4] = { ts0, ts1, ts2, ts3 };
+            for ( int32_t i = 0; i < numBones; i++ )
+            {
+                Transform::DirectlySetRotation( pGlobalTransforms[boneIndices[i]], Quaternion( rotations[i] ) );
+                Transform::DirectlySetTranslationScale( pGlobalTransforms[boneIndices[i]], Vector( translationScales[i] ) );
+            }
+
+            return true;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     void Pose::CalculateGlobalTransforms()
     {
         int32_t const numBones = m_pSkeleton->GetNumBones();
         m_globalTransforms.resize( numBones );
 
+        auto const& bonesSortedByDepth = m_pSkeleton->GetBonesSortedByDepth();
+        auto const& depthLevelOffsets = m_pSkeleton->GetDepthLevelOffsets();
+        int32_t const* pParentIndices = m_pSkeleton->GetParentBoneIndices().data();
+
+        // Root
         m_globalTransforms[0] = m_localTransforms[0];
-        for ( auto boneIdx = 1; boneIdx < numBones; boneIdx++ )
+
+        // All bones at a given depth are independent of each other so we can process them in groups of 4
+        int32_t const numDepthLevels = (int32_t) depthLevelOffsets.size() - 1;
+        for ( int32_t depth = 1; depth < numDepthLevels; depth++ )
         {
-            int32_t const parentIdx = m_pSkeleton->GetParentBoneIndex( boneIdx );
-            m_globalTransforms[boneIdx] = m_localTransforms[boneIdx] * m_globalTransforms[parentIdx];
+            int32_t const levelEnd = depthLevelOffsets[depth + 1];
+            for ( int32_t i = depthLevelOffsets[depth]; i < levelEnd; i += 4 )
+            {
+                int32_t const numBonesInGroup = Math::Min( 4, levelEnd - i );
+                int32_t const* pGroupBoneIndices = &bonesSortedByDepth[i];
+                if ( !CalculateGlobalTransformsSoA( m_localTransforms.data(), m_globalTransforms.data(), pGroupBoneIndices, pParentIndices, numBonesInGroup ) )
+                {
+                    for ( int32_t j = 0; j < numBonesInGroup; j++ )
+                    {
+                        int32_t const boneIdx = pGroupBoneIndices[j];
+                        m_globalTransforms[boneIdx] = m_localTransforms[boneIdx] * m_globalTransforms[pParentIndices[boneIdx]];
+                    }
+                }
+            }
         }
     }
 
     Transform Pose::GetGlobalTransform( int32_t boneIdx ) const
     {
-        EE_ASSERT( boneIdx < m_pSkeleton->GetNumBones() );
+        EE_ASSERT( boneIdx >= 0 && boneIdx < m_pSkeleton->GetNumBones() );
 
-        Transform boneGlobalTransform;
         if ( !m_globalTransforms.empty() )
         {
-            boneGlobalTransform = m_globalTransforms[boneIdx];
+            return m_globalTransforms[boneIdx];
         }
-        else
+
+        // Partial evaluation
+        //-------------------------------------------------------------------------
+
+        int32_t const numBones = m_pSkeleton->GetNumBones();
+        if ( m_cachedGlobalTransformVersions.size() != numBones )
+        {
+            m_cachedGlobalTransforms.resize( numBones );
+            m_cachedGlobalTransformVersions.clear();
+            m_cachedGlobalTransformVersions.resize( numBones, 0 );
+        }
+
+        // Walk up the hierarchy until we find a cached transform or reach the root
+        TInlineVector<int32_t, 64> chain;
+        int32_t currentIdx = boneIdx;
+        while ( currentIdx != InvalidIndex && m_cachedGlobalTransformVersions[currentIdx] != m_localTransformsVersion )
         {
-            auto boneParents = EE_STACK_ARRAY_ALLOC( int32_t, m_pSkeleton->GetNumBones() );
-            int32_t nextEntry = 0;
+            chain.emplace_back( currentIdx );
+            currentIdx = m_pSkeleton->GetParentBoneIndex( currentIdx );
+        }
 
-            // Get parent list
-            int32_t parentIdx = m_pSkeleton->GetParentBoneIndex( boneIdx );
-            while ( parentIdx != InvalidIndex )
+        // Calculate and cache the global transforms down the chain
+        for ( int32_t i = (int32_t) chain.size() - 1; i >= 0; i-- )
+        {
+            int32_t const chainBoneIdx = chain[i];
+            int32_t const parentIdx = m_pSkeleton->GetParentBoneIndex( chainBoneIdx );
+            if ( parentIdx == InvalidIndex )
             {
-                boneParents[nextEntry++] = parentIdx;
-                parentIdx = m_pSkeleton->GetParentBoneIndex( parentIdx );
+                m_cachedGlobalTransforms[chainBoneIdx] = m_localTransforms[chainBoneIdx];
             }
-
-            // If we have parents
-            boneGlobalTransform = m_localTransforms[boneIdx];
-            if ( nextEntry > 0 )
+            else
             {
-                // Calculate global transform of parent
-                int32_t arrayIdx = nextEntry - 1;
-                parentIdx = boneParents[arrayIdx--];
-                auto parentGlobalTransform = m_localTransforms[parentIdx];
-                for ( ; arrayIdx >= 0; arrayIdx-- )
-                {
-                    int32_t const nextIdx = boneParents[arrayIdx];
-                    auto const nextTransform = m_localTransforms[nextIdx];
-                    parentGlobalTransform = nextTransform * parentGlobalTransform;
-                }
-
-                // Calculate global transform of bone
-                boneGlobalTransform = boneGlobalTransform * parentGlobalTransform;
+                m_cachedGlobalTransforms[chainBoneIdx] = m_localTransforms[chainBoneIdx] * m_cachedGlobalTransforms[parentIdx];
             }
+
+            m_cachedGlobalTransformVersions[chainBoneIdx] = m_localTransformsVersion;
         }
 
-        return boneGlobalTransform;
+        return m_cachedGlobalTransforms[boneIdx];
     }
 
     //-------------------------------------------------------------------------
@@ -65,6 +65,13 @@ namespace EE::Animation
         inline int32_t GetNumBones( Skeleton::LOD lod ) const { return m_pSkeleton->GetNumBones( lod ); }
         inline Skeleton const* GetSkeleton() const { return m_pSkeleton; }
 
+        // Get the total memory used by this pose (including all transform buffers)
+        inline size_t GetMemoryUsage() const
+        {
+            size_t const transformsCapacity = m_localTransforms.capacity() + m_globalTransforms.capacity() + m_cachedGlobalTransforms.capacity();
+            return sizeof( Pose ) + ( transformsCapacity * sizeof( Transform ) ) + ( m_cachedGlobalTransformVersions.capacity() * sizeof( uint32_t ) );
+        }
+
         // Pose state
         //-------------------------------------------------------------------------
 
@@ -91,6 +98,7 @@ namespace EE::Animation
             EE_ASSERT( boneIdx < GetNumBones() && boneIdx >= 0 );
             m_localTransforms[boneIdx] = transform;
             MarkAsValidPose();
+            InvalidateCachedGlobalTransforms();
         }
 
         inline void SetRotation( int32_t boneIdx, Quaternion const& rotation )
@@ -98,6 +106,7 @@ namespace EE::Animation
             EE_ASSERT( boneIdx < GetNumBones() && boneIdx >= 0 );
             m_localTransforms[boneIdx].SetRotation( rotation );
             MarkAsValidPose();
+            InvalidateCachedGlobalTransforms();
         }
 
         inline void SetTranslation( int32_t boneIdx, Float3 const& translation )
@@ -105,6 +114,7 @@ namespace EE::Animation
             EE_ASSERT( boneIdx < GetNumBones() && boneIdx >= 0 );
             m_localTransforms[boneIdx].SetTranslation( translation );
             MarkAsValidPose();
+            InvalidateCachedGlobalTransforms();
         }
 
         // Set the scale for a given bone, note will change pose state to "Pose" if not already set
@@ -113,13 +123,17 @@ namespace EE::Animation
             EE_ASSERT( boneIdx < GetNumBones() && boneIdx >= 0 );
             m_localTransforms[boneIdx].SetScale( uniformScale );
             MarkAsValidPose();
+            InvalidateCachedGlobalTransforms();
         }
 
         // Global Transform Cache
         //-------------------------------------------------------------------------
+        // The full set of global transforms needs to be explicitly calculated and is not updated when the local transforms change
+        // Requesting individual global transforms without the full set will only evaluate the required bone chains, these results are cached until the local pose changes
+        // Note: the partial cache is not threadsafe, do not request individual global transforms for the same pose from multiple threads
 
         inline bool HasGlobalTransforms() const { return !m_globalTransforms.empty(); }
-        inline void ClearGlobalTransforms() { m_globalTransforms.clear(); }
+        inline void ClearGlobalTransforms() { m_globalTransforms.clear(); InvalidateCachedGlobalTransforms(); }
         inline TVector<Transform> const& GetGlobalTransforms() const { return m_globalTransforms; }
         void CalculateGlobalTransforms();
         Transform GetGlobalTransform( int32_t boneIdx ) const;
@@ -146,11 +160,28 @@ namespace EE::Animation
             }
         }
 
+        // Invalidates all partially calculated global transforms
+        EE_FORCE_INLINE void InvalidateCachedGlobalTransforms()
+        {
+            m_localTransformsVersion++;
+
+            // Handle wrap around, since the cached versions could now be valid again
+            if ( m_localTransformsVersion == 0 )
+            {
+                m_cachedGlobalTransformVersions.clear();
+                m_localTransformsVersion = 1;
+            }
+        }
+
     private:
 
         Skeleton const*             m_pSkeleton;                // The skeleton for this pose
         TVector<Transform>          m_localTransforms;          // Parent-space transforms
         TVector<Transform>          m_globalTransforms;         // Character-space transforms
         State                       m_state = State::Unset;     // Pose state
+
+        mutable TVector<Transform>  m_cachedGlobalTransforms;           // Partially calculated character-space transforms
+        mutable TVector<uint32_t>   m_cachedGlobalTransformVersions;    // The local transforms version that each cached global transform was calculated for
+        uint32_t                    m_localTransformsVersion = 1;       // Incremented each time the local transforms change
     };
 }
\ No newline at end of file
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "Base/Threading/Threading.h"
+#include "Base/Types/Arrays.h"
+#include "Base/Memory/Memory.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+// Shared Skeleton Storage
+//-------------------------------------------------------------------------
+// A thread-safe free list of skeleton sized objects (pose buffers, bone masks) shared by all the task systems for a graph
+// Task system pools borrow items for the duration of a single update and return them as soon as they are released
+// This means that the storage only ever grows to the peak number of items that are in use at the same time, rather than every instance keeping its own worst case
+//
+// Free items are spread over a small number of buckets selected by thread ID, so graph instances updating on different threads rarely contend on the same lock
+
+namespace EE::Animation
+{
+    class Skeleton;
+
+    //-------------------------------------------------------------------------
+
+    template<typename T>
+    class TSharedSkeletonStorage
+    {
+        constexpr static int32_t const s_numBuckets = 8;
+
+        struct alignas( 64 ) Bucket
+        {
+            Threading::Mutex                    m_mutex;
+            TVector<T*>                         m_freeItems;
+        };
+
+    public:
+
+        TSharedSkeletonStorage( Skeleton const* pSkeleton )
+            : m_pSkeleton( pSkeleton )
+        {
+            EE_ASSERT( m_pSkeleton != nullptr );
+        }
+
+        TSharedSkeletonStorage( TSharedSkeletonStorage const& ) = delete;
+        TSharedSkeletonStorage& operator=( TSharedSkeletonStorage const& ) = delete;
+
+        ~TSharedSkeletonStorage()
+        {
+            int32_t numFreeItems = 0;
+            for ( auto& bucket : m_buckets )
+            {
+                for ( T* pItem : bucket.m_freeItems )
+                {
+                    EE::Delete( pItem );
+                }
+
+                numFreeItems += (int32_t) bucket.m_freeItems.size();
+                bucket.m_freeItems.clear();
+            }
+
+            // All borrowed items must have been returned before the storage is destroyed
+            EE_ASSERT( numFreeItems == m_numAllocatedItems );
+        }
+
+        inline Skeleton const* GetSkeleton() const { return m_pSkeleton; }
+
+        // Borrow an item, this will only allocate if no free items are available
+        T* Acquire()
+        {
+            int32_t const bucketIdx = GetBucketIndexForCurrentThread();
+
+            // Try the bucket for this thread first
+            {
+                Bucket& bucket = m_buckets[bucketIdx];
+                Threading::ScopeLock lock( bucket.m_mutex );
+                if ( !bucket.m_freeItems.empty() )
+                {
+                    T* pItem = bucket.m_freeItems.back();
+                    bucket.m_freeItems.pop_back();
+                    return pItem;
+                }
+            }
+
+            // Take from any other bucket that isnt currently in use, we never wait on another thread's bucket
+            for ( int32_t i = 1; i < s_numBuckets; i++ )
+            {
+                Bucket& bucket = m_buckets[( bucketIdx + i ) % s_numBuckets];
+                if ( bucket.m_mutex.try_lock() )
+                {
+                    T* pItem = nullptr;
+                    if ( !bucket.m_freeItems.empty() )
+                    {
+                        pItem = bucket.m_freeItems.back();
+                        bucket.m_freeItems.pop_back();
+                    }
+                    bucket.m_mutex.unlock();
+
+                    if ( pItem != nullptr )
+                    {
+                        return pItem;
+                    }
+                }
+            }
+
+            // Grow the storage
+            T* pNewItem = EE::New<T>( m_pSkeleton );
+            m_itemMemoryUsage = pNewItem->GetMemoryUsage();
+            m_numAllocatedItems++;
+            return pNewItem;
+        }
+
+        // Return a borrowed item to the storage
+        void Release( T* pItem )
+        {
+            EE_ASSERT( pItem != nullptr );
+
+            Bucket& bucket = m_buckets[GetBucketIndexForCurrentThread()];
+            Threading::ScopeLock lock( bucket.m_mutex );
+            bucket.m_freeItems.emplace_back( pItem );
+        }
+
+        // Get the total number of items allocated, this is the peak number of items that were ever in use at the same time
+        inline int32_t GetNumAllocatedItems() const { return m_numAllocatedItems; }
+
+        // Get the total memory used by all allocated items
+        inline size_t GetMemoryUsage() const { return m_itemMemoryUsage * m_numAllocatedItems; }
+
+    private:
+
+        EE_FORCE_INLINE static int32_t GetBucketIndexForCurrentThread()
+        {
+            static_assert( s_numBuckets == 8, "The hash below assumes 8 buckets" );
+            uint32_t const threadID = (uint32_t) Threading::GetCurrentThreadID();
+            return int32_t( ( threadID * 2654435761u ) >> 29 );
+        }
+
+    private:
+
+        Skeleton const*                         m_pSkeleton = nullptr;
+        Bucket                                  m_buckets[s_numBuckets];
+        std::atomic<int32_t>                    m_numAllocatedItems = 0;
+        std::atomic<size_t>                     m_itemMemoryUsage = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct PoseBuffer;
+    class BoneMask;
+
+    using PoseBufferStorage = TSharedSkeletonStorage<PoseBuffer>;
+    using BoneMaskStorage = TSharedSkeletonStorage<BoneMask>;
+}
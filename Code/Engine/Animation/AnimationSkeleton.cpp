@@ -5,6 +5,85 @@
 
 namespace EE::Animation
 {
+    #if EE_DEVELOPMENT_TOOLS
+    Skeleton::Skeleton( TVector<StringID> const& boneIDs, TVector<int32_t> const& parentIndices, TVector<Transform> const& localReferencePose, int32_t numBonesToSampleAtLowLOD )
+        : m_boneIDs( boneIDs )
+        , m_parentIndices( parentIndices )
+        , m_localReferencePose( localReferencePose )
+        , m_numBonesToSampleAtLowLOD( numBonesToSampleAtLowLOD )
+    {
+        EE_ASSERT( IsValid() );
+        EE_ASSERT( m_parentIndices[0] == InvalidIndex );
+        EE_ASSERT( numBonesToSampleAtLowLOD > 0 && numBonesToSampleAtLowLOD <= GetNumBones() );
+
+        m_boneFlags.resize( m_boneIDs.size() );
+        CalculateRuntimeData();
+    }
+    #endif
+
+    void Skeleton::CalculateRuntimeData()
+    {
+        int32_t const numBones = GetNumBones();
+
+        // Create bone lookup map
+        //-------------------------------------------------------------------------
+
+        m_boneIndexLookupMap.clear();
+        m_boneIndexLookupMap.reserve( numBones );
+        for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            m_boneIndexLookupMap.insert( TPair<StringID, int32_t>( m_boneIDs[boneIdx], boneIdx ) );
+        }
+
+        // Calculate global reference pose
+        //-------------------------------------------------------------------------
+
+        m_globalReferencePose.resize( numBones );
+
+        m_globalReferencePose[0] = m_localReferencePose[0];
+        for ( auto boneIdx = 1; boneIdx < numBones; boneIdx++ )
+        {
+            int32_t const parentIdx = GetParentBoneIndex( boneIdx );
+            m_globalReferencePose[boneIdx] = m_localReferencePose[boneIdx] * m_globalReferencePose[parentIdx];
+        }
+
+        // Sort bones by depth
+        //-------------------------------------------------------------------------
+        // Bones are always stored after their parents so the depths can be calculated in a single pass
+
+        TVector<int32_t> boneDepths;
+        boneDepths.resize( numBones, 0 );
+        int32_t maxDepth = 0;
+        for ( auto boneIdx = 1; boneIdx < numBones; boneIdx++ )
+        {
+            int32_t const parentIdx = GetParentBoneIndex( boneIdx );
+            EE_ASSERT( parentIdx >= 0 && parentIdx < boneIdx );
+            boneDepths[boneIdx] = boneDepths[parentIdx] + 1;
+            maxDepth = Math::Max( maxDepth, boneDepths[boneIdx] );
+        }
+
+        m_depthLevelOffsets.clear();
+        m_depthLevelOffsets.resize( maxDepth + 2, 0 );
+        for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            m_depthLevelOffsets[boneDepths[boneIdx] + 1]++;
+        }
+
+        for ( auto depth = 1; depth < m_depthLevelOffsets.size(); depth++ )
+        {
+            m_depthLevelOffsets[depth] += m_depthLevelOffsets[depth - 1];
+        }
+
+        TVector<int32_t> insertionIndices( m_depthLevelOffsets.begin(), m_depthLevelOffsets.end() - 1 );
+        m_bonesSortedByDepth.resize( numBones );
+        for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            m_bonesSortedByDepth[insertionIndices[boneDepths[boneIdx]]++] = boneIdx;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     bool Skeleton::IsValid() const
     {
         return !m_boneIDs.empty() && ( m_boneIDs.size() == m_parentIndices.size() ) && ( m_boneIDs.size() == m_localReferencePose.size() );
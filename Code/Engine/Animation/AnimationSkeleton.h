@@ -5,6 +5,7 @@
 #include "Base/Resource/IResource.h"
 #include "Base/Math/Transform.h"
 #include "Base/Types/BitFlags.h"
+#include "Base/Types/HashMap.h"
 
 //-------------------------------------------------------------------------
 
@@ -46,6 +47,16 @@ namespace EE::Animation
         static void DrawRootBone( Drawing::DrawContext& ctx, Transform const& transform );
         #endif
 
+    public:
+
+        Skeleton() = default;
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Create a skeleton directly from a bone hierarchy, this is only intended for tests and benchmarks since runtime skeletons are always loaded from compiled resources
+        // Bones need to be sorted so that parents are always before their children and the root is the first bone
+        Skeleton( TVector<StringID> const& boneIDs, TVector<int32_t> const& parentIndices, TVector<Transform> const& localReferencePose, int32_t numBonesToSampleAtLowLOD );
+        #endif
+
     public:
 
         virtual bool IsValid() const final;
@@ -62,7 +73,11 @@ namespace EE::Animation
         EE_FORCE_INLINE bool IsValidBoneIndex( int32_t idx ) const { return idx >= 0 && idx < m_boneIDs.size(); }
 
         // Get the index for a given bone ID, can return InvalidIndex
-        inline int32_t GetBoneIndex( StringID const& ID ) const { return VectorFindIndex( m_boneIDs, ID ); }
+        inline int32_t GetBoneIndex( StringID const& ID ) const
+        {
+            auto iter = m_boneIndexLookupMap.find( ID );
+            return ( iter != m_boneIndexLookupMap.end() ) ? iter->second : InvalidIndex;
+        }
 
         // Get all parent indices
         inline TVector<int32_t> const& GetParentBoneIndices() const { return m_parentIndices; }
@@ -96,6 +111,12 @@ namespace EE::Animation
             return m_boneIDs[boneIdx];
         }
 
+        // Get all bone indices sorted by their depth in the hierarchy, bones at a given depth only depend on bones at lower depths
+        inline TVector<int32_t> const& GetBonesSortedByDepth() const { return m_bonesSortedByDepth; }
+
+        // Get the start index (into the depth sorted bone list) for each depth level, the last entry is the total number of bones
+        inline TVector<int32_t> const& GetDepthLevelOffsets() const { return m_depthLevelOffsets; }
+
         // Pose info
         //-------------------------------------------------------------------------
 
@@ -125,6 +146,11 @@ namespace EE::Animation
         void DrawDebug( Drawing::DrawContext& ctx, Transform const& worldTransform ) const;
         #endif
 
+    private:
+
+        // Calculate all the data that isnt serialized (bone lookup map, global reference pose, depth sorted bones)
+        void CalculateRuntimeData();
+
     private:
 
         TVector<StringID>                   m_boneIDs;
@@ -133,6 +159,9 @@ namespace EE::Animation
         TVector<Transform>                  m_globalReferencePose;
         TVector<TBitFlags<BoneFlags>>       m_boneFlags;
         TVector<BoneMask>                   m_boneMasks;
+        THashMap<StringID, int32_t>         m_boneIndexLookupMap;   // Generated at load time
+        TVector<int32_t>                    m_bonesSortedByDepth;   // Generated at load time
+        TVector<int32_t>                    m_depthLevelOffsets;    // Generated at load time
         int32_t                             m_numBonesToSampleAtLowLOD = 0; // The number of bones we should sample when operating at a low LOD
     };
 }
\ No newline at end of file
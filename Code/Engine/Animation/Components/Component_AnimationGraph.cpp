@@ -151,6 +151,14 @@ namespace EE::Animation
         return m_pGraphInstance->GetRootMotionDebugMode();
     }
 
+    void GraphComponent::SetGraphProfiler( GraphProfiler* pProfiler )
+    {
+        if ( m_pGraphInstance != nullptr )
+        {
+            m_pGraphInstance->SetProfiler( pProfiler );
+        }
+    }
+
     void GraphComponent::DrawDebug( Drawing::DrawContext& drawingContext )
     {
         if ( !HasGraph() || !IsInitialized() || m_pGraphInstance == nullptr )
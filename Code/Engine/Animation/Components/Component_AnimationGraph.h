@@ -126,6 +126,9 @@ namespace EE::Animation
         void SetRootMotionDebugMode( RootMotionDebugMode mode );
         RootMotionDebugMode GetRootMotionDebugMode() const;
 
+        // Profiling - set a null profiler to disable profiling
+        void SetGraphProfiler( GraphProfiler* pProfiler );
+
         // Draw all debug visualizations
         void DrawDebug( Drawing::DrawContext& drawingContext );
 
@@ -7,6 +7,8 @@
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Base/Imgui/ImguiX.h"
 #include "Base/Math/MathUtils.h"
+#include "Base/FileSystem/FileSystemUtils.h"
+#include "EASTL/sort.h"
 
 //-------------------------------------------------------------------------
 
@@ -18,6 +20,7 @@ namespace EE::Animation
         static StringID const g_controlParameterWindowID( "ControlParam" );
         static StringID const g_tasksWindowID( "Tasks" );
         static StringID const g_eventsWindowID( "Events" );
+        static StringID const g_graphProfilerWindowID( "GraphProfiler" );
     }
 
     void AnimationDebugView::DrawGraphControlParameters( GraphInstance* pGraphInstance )
@@ -508,6 +511,33 @@ namespace EE::Animation
 
     void AnimationDebugView::DrawMenu( EntityWorldUpdateContext const& context )
     {
+        ImGuiX::TextSeparator( "Profiling" );
+
+        bool isGraphProfilingEnabled = m_pAnimationWorldSystem->IsGraphProfilingEnabled();
+        if ( ImGui::Checkbox( "Enable Graph Profiling", &isGraphProfilingEnabled ) )
+        {
+            m_pAnimationWorldSystem->SetGraphProfilingEnabled( isGraphProfilingEnabled );
+        }
+
+        if ( ImGui::MenuItem( "Show Graph Profiler" ) )
+        {
+            auto pProfilerWindow = GetDebugWindow( g_graphProfilerWindowID );
+            if ( pProfilerWindow != nullptr )
+            {
+                pProfilerWindow->m_isOpen = true;
+            }
+            else
+            {
+                m_windows.emplace_back( "Animation Graph Profiler", [this] ( EntityWorldUpdateContext const& context, bool isFocused, uint64_t userData ) { DrawGraphProfilerWindow( context, isFocused, userData ); } );
+                m_windows.back().m_typeID = g_graphProfilerWindowID;
+                m_windows.back().m_isOpen = true;
+            }
+        }
+
+        ImGuiX::TextSeparator( "Graphs" );
+
+        //-------------------------------------------------------------------------
+
         InlineString componentName;
         for ( GraphComponent* pGraphComponent : m_pAnimationWorldSystem->m_graphComponents )
         {
@@ -560,6 +590,16 @@ namespace EE::Animation
 
                 //-------------------------------------------------------------------------
 
+                ImGuiX::TextSeparator( "Memory" );
+                if ( pGraphComponent->m_pGraphInstance != nullptr )
+                {
+                    GraphInstance::MemoryUsage const memoryUsage = pGraphComponent->m_pGraphInstance->GetMemoryUsage();
+                    ImGui::Text( "Instance: %.2f KB", memoryUsage.m_instanceMemory / 1024.0f );
+                    ImGui::Text( "Shared: %.2f KB", memoryUsage.m_sharedMemory / 1024.0f );
+                }
+
+                //-------------------------------------------------------------------------
+
                 ImGuiX::TextSeparator( "Root Motion debug" );
                 {
                     RootMotionDebugMode const debugMode = pGraphComponent->GetRootMotionDebugMode();
@@ -651,6 +691,11 @@ namespace EE::Animation
         // Delete windows for missing components
         for ( int32_t i = (int32_t) m_windows.size() - 1; i >= 0; i-- )
         {
+            if ( m_windows[i].m_typeID == g_graphProfilerWindowID )
+            {
+                continue;
+            }
+
             auto ppFoundComponent = m_pAnimationWorldSystem->m_graphComponents.FindItem( ComponentID( m_windows[i].m_userData ) );
             if ( ppFoundComponent == nullptr )
             {
@@ -682,5 +727,155 @@ namespace EE::Animation
         auto pGraphComponent = *ppFoundComponent;
         DrawCombinedSampledEventsView( pGraphComponent->m_pGraphInstance );
     }
+
+    void AnimationDebugView::DrawGraphProfilerWindow( EntityWorldUpdateContext const& context, bool isFocused, uint64_t userData )
+    {
+        GraphProfiler& profiler = m_pAnimationWorldSystem->GetGraphProfiler();
+
+        bool isGraphProfilingEnabled = m_pAnimationWorldSystem->IsGraphProfilingEnabled();
+        if ( ImGui::Checkbox( "Enabled", &isGraphProfilingEnabled ) )
+        {
+            m_pAnimationWorldSystem->SetGraphProfilingEnabled( isGraphProfilingEnabled );
+        }
+
+        ImGui::SameLine();
+        if ( ImGui::Button( "Reset" ) )
+        {
+            profiler.Reset();
+        }
+
+        ImGui::SameLine();
+        if ( ImGui::Button( "Export CSV" ) )
+        {
+            FileSystem::Path const outputPath = FileSystem::GetCurrentProcessPath() + "AnimationGraphProfile.csv";
+            if ( profiler.ExportToCSV( outputPath ) )
+            {
+                EE_LOG_INFO( "Animation", "Graph Profiler", "Exported graph profile to '%s'", outputPath.c_str() );
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        profiler.GetStats( m_graphProfilerStats );
+        if ( m_graphProfilerStats.empty() )
+        {
+            ImGui::Text( "No profiling data recorded!" );
+            return;
+        }
+
+        auto ToMicroseconds = [] ( uint64_t time ) { return float( double( time ) / 1000.0 ); };
+        auto GetAverage = [] ( uint64_t total, uint32_t count ) { return ( count > 0 ) ? float( double( total ) / count / 1000.0 ) : 0.0f; };
+
+        TVector<int32_t> sortedNodeIndices;
+        for ( int32_t graphIdx = 0; graphIdx < (int32_t) m_graphProfilerStats.size(); graphIdx++ )
+        {
+            GraphProfiler::GraphStats const& graphStats = m_graphProfilerStats[graphIdx];
+            if ( !ImGui::CollapsingHeader( graphStats.m_graphID.c_str(), ImGuiTreeNodeFlags_DefaultOpen ) )
+            {
+                continue;
+            }
+
+            ImGui::PushID( graphIdx );
+
+            ImGui::Text( "Evaluations: %u, Avg: %.3fus, Max: %.3fus", graphStats.m_numEvaluations, GetAverage( graphStats.m_totalUpdateTime, graphStats.m_numEvaluations ), ToMicroseconds( graphStats.m_maxUpdateTime ) );
+
+            if ( graphStats.m_numTaskUpdates > 0 )
+            {
+                float const averageSampledClips = float( double( graphStats.m_numSampledClips ) / graphStats.m_numTaskUpdates );
+                ImGui::Text( "Task Updates: %u, Avg: %.3fus, Max: %.3fus", graphStats.m_numTaskUpdates, GetAverage( graphStats.m_totalTaskTime, graphStats.m_numTaskUpdates ), ToMicroseconds( graphStats.m_maxTaskTime ) );
+                ImGui::Text( "Pose Buffers: %d peak used, %d allocated. Clips Sampled: %.2f per update", graphStats.m_peakPoseBuffersUsed, graphStats.m_maxPoseBuffersAllocated, averageSampledClips );
+            }
+
+            // Nodes - sorted by total exclusive time so the most expensive nodes are at the top
+            //-------------------------------------------------------------------------
+
+            sortedNodeIndices.clear();
+            for ( int32_t i = 0; i < (int32_t) graphStats.m_nodeStats.size(); i++ )
+            {
+                if ( graphStats.m_nodeStats[i].m_numUpdates > 0 )
+                {
+                    sortedNodeIndices.emplace_back( i );
+                }
+            }
+
+            auto SortByExclusiveTime = [&graphStats] ( int32_t a, int32_t b ) { return graphStats.m_nodeStats[a].m_totalExclusiveTime > graphStats.m_nodeStats[b].m_totalExclusiveTime; };
+            eastl::sort( sortedNodeIndices.begin(), sortedNodeIndices.end(), SortByExclusiveTime );
+
+            if ( ImGui::BeginTable( "NodesTable", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_RowBg ) )
+            {
+                ImGui::TableSetupColumn( "Node", ImGuiTableColumnFlags_WidthStretch, 0.6f );
+                ImGui::TableSetupColumn( "Type", ImGuiTableColumnFlags_WidthStretch, 0.4f );
+                ImGui::TableSetupColumn( "Updates", ImGuiTableColumnFlags_WidthFixed, 60 );
+                ImGui::TableSetupColumn( "Avg Incl (us)", ImGuiTableColumnFlags_WidthFixed, 90 );
+                ImGui::TableSetupColumn( "Avg Excl (us)", ImGuiTableColumnFlags_WidthFixed, 90 );
+                ImGui::TableSetupColumn( "Max Incl (us)", ImGuiTableColumnFlags_WidthFixed, 90 );
+                ImGui::TableHeadersRow();
+
+                for ( int32_t nodeIdx : sortedNodeIndices )
+                {
+                    GraphProfiler::NodeStats const& nodeStats = graphStats.m_nodeStats[nodeIdx];
+
+                    ImGui::TableNextRow();
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%s", nodeStats.m_path.c_str() );
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%s", nodeStats.m_pTypeName );
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%u", nodeStats.m_numUpdates );
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.3f", GetAverage( nodeStats.m_totalInclusiveTime, nodeStats.m_numUpdates ) );
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.3f", GetAverage( nodeStats.m_totalExclusiveTime, nodeStats.m_numUpdates ) );
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.3f", ToMicroseconds( nodeStats.m_maxInclusiveTime ) );
+                }
+
+                ImGui::EndTable();
+            }
+
+            // Tasks
+            //-------------------------------------------------------------------------
+
+            if ( !graphStats.m_taskStats.empty() && ImGui::BeginTable( "TasksTable", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_RowBg ) )
+            {
+                ImGui::TableSetupColumn( "Task", ImGuiTableColumnFlags_WidthStretch );
+                ImGui::TableSetupColumn( "Executions", ImGuiTableColumnFlags_WidthFixed, 70 );
+                ImGui::TableSetupColumn( "Avg (us)", ImGuiTableColumnFlags_WidthFixed, 90 );
+                ImGui::TableSetupColumn( "Max (us)", ImGuiTableColumnFlags_WidthFixed, 90 );
+                ImGui::TableSetupColumn( "Total (ms)", ImGuiTableColumnFlags_WidthFixed, 90 );
+                ImGui::TableHeadersRow();
+
+                for ( GraphProfiler::TaskStats const& taskStats : graphStats.m_taskStats )
+                {
+                    ImGui::TableNextRow();
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%s", taskStats.m_pTaskTypeInfo->GetTypeName() );
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%u", taskStats.m_numExecutions );
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.3f", GetAverage( taskStats.m_totalTime, taskStats.m_numExecutions ) );
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.3f", ToMicroseconds( taskStats.m_maxTime ) );
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%.3f", ToMicroseconds( taskStats.m_totalTime ) / 1000.0f );
+                }
+
+                ImGui::EndTable();
+            }
+
+            ImGui::PopID();
+        }
+    }
 }
 #endif
\ No newline at end of file
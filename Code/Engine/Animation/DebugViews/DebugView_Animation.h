@@ -65,11 +65,13 @@ namespace EE::Animation
         void DrawControlParameterWindow( EntityWorldUpdateContext const& context, bool isFocused, uint64_t userData );
         void DrawTasksWindow( EntityWorldUpdateContext const& context, bool isFocused, uint64_t userData );
         void DrawEventsWindow( EntityWorldUpdateContext const& context, bool isFocused, uint64_t userData );
+        void DrawGraphProfilerWindow( EntityWorldUpdateContext const& context, bool isFocused, uint64_t userData );
 
     private:
 
         AnimationWorldSystem*                   m_pAnimationWorldSystem = nullptr;
         TVector<ComponentDebugState>            m_componentRuntimeSettings;
+        TVector<GraphProfiler::GraphStats>      m_graphProfilerStats;
     };
 }
 #endif
\ No newline at end of file
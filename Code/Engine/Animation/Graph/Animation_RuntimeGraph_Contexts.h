@@ -23,6 +23,7 @@ namespace EE::Animation
     struct GraphLayerUpdateState;
     struct GraphLayerContext;
     struct BoneMaskTaskList;
+    class GraphUpdateProfile;
 
     //-------------------------------------------------------------------------
 
@@ -152,6 +153,9 @@ namespace EE::Animation
         // Root Motion
         inline RootMotionDebugger* GetRootMotionDebugger() { return m_pRootMotionDebugger; }
 
+        // Get the profile to record node costs into, this is null unless profiling is enabled for the owning graph instance
+        inline GraphUpdateProfile* GetProfile() const { return m_pProfile; }
+
         // Log a graph warning
         void LogWarning( int16_t nodeIdx, char const* pFormat, ... );
 
@@ -197,6 +201,7 @@ namespace EE::Animation
         RootMotionDebugger*                         m_pRootMotionDebugger = nullptr; // Allows nodes to record root motion operations
         TVector<int16_t>*                           m_pActiveNodes = nullptr;
         TVector<GraphLogEntry>*                     m_pLog = nullptr;
+        GraphUpdateProfile*                         m_pProfile = nullptr;
         #endif
     };
 }
\ No newline at end of file
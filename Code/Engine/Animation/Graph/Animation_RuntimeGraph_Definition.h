@@ -1,12 +1,17 @@
 #pragma once
 #include "Animation_RuntimeGraph_Node.h"
 #include "Animation_RuntimeGraph_DataSet.h"
+#include "Engine/Animation/AnimationSharedStorage.h"
 #include "Base/Resource/ResourcePtr.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Animation
 {
+    class GraphInstanceMemoryPool;
+
+    //-------------------------------------------------------------------------
+
     class EE_ENGINE_API GraphDefinition final : public Resource::IResource
     {
         EE_RESOURCE( 'ag', "Animation Graph" );
@@ -16,6 +21,7 @@ namespace EE::Animation
         friend class AnimationGraphCompiler;
         friend class GraphLoader;
         friend class GraphInstance;
+        friend class GraphProfiler;
 
     public:
 
@@ -69,6 +75,9 @@ namespace EE::Animation
 
         // Node settings are created/destroyed by the animation graph loader
         TVector<GraphNode::Settings*>               m_nodeSettings;
+
+        // The node memory for all instances of this graph is allocated from this pool, created/destroyed by the animation graph loader
+        GraphInstanceMemoryPool*                    m_pInstanceMemoryPool = nullptr;
     };
 
     //-------------------------------------------------------------------------
@@ -107,9 +116,17 @@ namespace EE::Animation
             return m_dataSet;
         }
 
+        // The pose buffer and bone mask storage shared by all standalone instances of this variation
+        inline PoseBufferStorage* GetPoseBufferStorage() const { return m_pPoseBufferStorage; }
+        inline BoneMaskStorage* GetBoneMaskStorage() const { return m_pBoneMaskStorage; }
+
     protected:
 
         TResourcePtr<GraphDefinition>               m_pGraphDefinition = nullptr;
         GraphDataSet                                m_dataSet;
+
+        // Shared storage is created/destroyed by the animation graph loader
+        PoseBufferStorage*                          m_pPoseBufferStorage = nullptr;
+        BoneMaskStorage*                            m_pBoneMaskStorage = nullptr;
     };
 }
\ No newline at end of file
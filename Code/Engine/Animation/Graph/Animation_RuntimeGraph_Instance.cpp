@@ -2,6 +2,7 @@
 #include "Animation_RuntimeGraph_Node.h"
 #include "Nodes/Animation_RuntimeGraphNode_ExternalGraph.h"
 #include "Nodes/Animation_RuntimeGraphNode_Layers.h"
+#include "Animation_RuntimeGraph_InstanceMemoryPool.h"
 
 #include "Base/Profiling.h"
 #include "Engine/Animation/TaskSystem/Animation_TaskSystem.h"
@@ -24,7 +25,7 @@ namespace EE::Animation
         bool const isStandaloneGraphInstance = ( pTaskSystem == nullptr );
         if ( isStandaloneGraphInstance )
         {
-            m_pTaskSystem = EE::New<TaskSystem>( m_pGraphVariation->GetSkeleton() );
+            m_pTaskSystem = EE::New<TaskSystem>( m_pGraphVariation->GetSkeleton(), m_pGraphVariation->GetPoseBufferStorage(), m_pGraphVariation->GetBoneMaskStorage() );
         }
 
         // Allocate memory
@@ -34,7 +35,8 @@ namespace EE::Animation
         size_t const numNodes = pGraphDef->m_instanceNodeStartOffsets.size();
         EE_ASSERT( pGraphDef->m_nodeSettings.size() == numNodes );
 
-        m_pAllocatedInstanceMemory = reinterpret_cast<uint8_t*>( EE::Alloc( pGraphDef->m_instanceRequiredMemory, pGraphDef->m_instanceRequiredAlignment ) );
+        EE_ASSERT( pGraphDef->m_pInstanceMemoryPool != nullptr );
+        m_pAllocatedInstanceMemory = pGraphDef->m_pInstanceMemoryPool->Allocate();
 
         m_nodes.reserve( numNodes );
 
@@ -164,7 +166,8 @@ namespace EE::Animation
         }
         m_childGraphs.clear();
 
-        EE::Free( m_pAllocatedInstanceMemory );
+        pGraphDef->m_pInstanceMemoryPool->Free( m_pAllocatedInstanceMemory );
+        m_pAllocatedInstanceMemory = nullptr;
         EE::Delete( m_pTaskSystem );
     }
 
@@ -300,6 +303,10 @@ namespace EE::Animation
         connectedGraph.m_pInstance = new ( EE::Alloc( sizeof( GraphInstance ) ) ) GraphInstance( pExternalGraphVariation, m_userID, m_pTaskSystem );
         EE_ASSERT( connectedGraph.m_pInstance != nullptr );
 
+        #if EE_DEVELOPMENT_TOOLS
+        connectedGraph.m_pInstance->SetProfiler( m_pProfiler );
+        #endif
+
         // Attach instance to the node
         //-------------------------------------------------------------------------
 
@@ -358,6 +365,12 @@ namespace EE::Animation
         EE_PROFILE_SCOPE_ANIMATION( "Graph Instance: Evaluate Graph" );
 
         #if EE_DEVELOPMENT_TOOLS
+        uint64_t const profileStartTime = ( m_pProfiler != nullptr ) ? uint64_t( PlatformClock::GetTime() ) : 0;
+        if ( m_pProfiler != nullptr )
+        {
+            m_updateProfile.Reset( (int32_t) m_nodes.size() );
+        }
+
         m_activeNodes.clear();
         m_rootMotionDebugger.StartCharacterUpdate( startWorldTransform );
         RecordPreGraphEvaluateState( deltaTime, startWorldTransform );
@@ -385,6 +398,12 @@ namespace EE::Animation
 
         #if EE_DEVELOPMENT_TOOLS
         RecordPostGraphEvaluateState( nullptr );
+
+        if ( m_pProfiler != nullptr )
+        {
+            m_updateProfile.m_updateTime = uint64_t( PlatformClock::GetTime() ) - profileStartTime;
+            m_pProfiler->RecordGraphUpdate( m_pGraphVariation->m_pGraphDefinition.GetPtr(), m_updateProfile );
+        }
         #endif
 
         return result;
@@ -436,6 +455,11 @@ namespace EE::Animation
 
         #if EE_DEVELOPMENT_TOOLS
         RecordTasks();
+
+        if ( m_pProfiler != nullptr )
+        {
+            m_pProfiler->RecordTaskSystemUpdate( m_pGraphVariation->m_pGraphDefinition.GetPtr(), m_pTaskSystem->GetProfile() );
+        }
         #endif
     }
 
@@ -804,7 +828,67 @@ namespace EE::Animation
 
         // Record task
         auto& frameData = m_pRecorder->m_recordedData.back();
-        m_pTaskSystem->SerializeTasks( LUTs, frameData.m_serializedTaskData );
+        m_pTaskSystem->SerializeTasks( LUTs, frameData.m_serializedTaskData, &frameData.m_serializedTaskLayout );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void GraphInstance::SetProfiler( GraphProfiler* pProfiler )
+    {
+        m_pProfiler = pProfiler;
+        m_graphContext.m_pProfile = ( m_pProfiler != nullptr ) ? &m_updateProfile : nullptr;
+
+        if ( m_pTaskSystem != nullptr )
+        {
+            m_pTaskSystem->SetProfilingEnabled( m_pProfiler != nullptr );
+        }
+
+        for ( auto& childGraph : m_childGraphs )
+        {
+            if ( childGraph.m_pInstance != nullptr )
+            {
+                childGraph.m_pInstance->SetProfiler( pProfiler );
+            }
+        }
+
+        for ( auto& externalGraph : m_externalGraphs )
+        {
+            externalGraph.m_pInstance->SetProfiler( pProfiler );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    GraphInstance::MemoryUsage GraphInstance::GetMemoryUsage() const
+    {
+        auto pGraphDef = m_pGraphVariation->m_pGraphDefinition.GetPtr();
+
+        MemoryUsage usage;
+        usage.m_instanceMemory = sizeof( GraphInstance ) + pGraphDef->m_pInstanceMemoryPool->GetBlockSize();
+        usage.m_instanceMemory += m_nodes.capacity() * sizeof( GraphNode* );
+        usage.m_instanceMemory += m_childGraphs.capacity() * sizeof( ChildGraph );
+        usage.m_instanceMemory += m_externalGraphs.capacity() * sizeof( ExternalGraph );
+
+        // Unused node memory blocks are shared by all instances of the graph
+        usage.m_sharedMemory = pGraphDef->m_pInstanceMemoryPool->GetMemoryUsage() - ( size_t( pGraphDef->m_pInstanceMemoryPool->GetNumUsedBlocks() ) * pGraphDef->m_pInstanceMemoryPool->GetBlockSize() );
+
+        if ( m_pTaskSystem != nullptr )
+        {
+            usage.m_instanceMemory += m_pTaskSystem->GetMemoryUsage();
+            usage.m_sharedMemory += m_pTaskSystem->GetSharedStorageMemoryUsage();
+        }
+
+        for ( auto const& childGraph : m_childGraphs )
+        {
+            if ( childGraph.m_pInstance != nullptr )
+            {
+                MemoryUsage const childUsage = childGraph.m_pInstance->GetMemoryUsage();
+                usage.m_instanceMemory += childUsage.m_instanceMemory;
+                usage.m_sharedMemory += childUsage.m_sharedMemory;
+            }
+        }
+
+        return usage;
     }
     #endif
 }
\ No newline at end of file
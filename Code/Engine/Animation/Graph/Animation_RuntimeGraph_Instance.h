@@ -2,6 +2,7 @@
 #include "Animation_RuntimeGraph_Definition.h"
 #include "Animation_RuntimeGraph_RootMotionDebugger.h"
 #include "Animation_RuntimeGraph_Contexts.h"
+#include "Animation_RuntimeGraph_Profiler.h"
 #include "Base/Types/PointerID.h"
 
 //-------------------------------------------------------------------------
@@ -333,6 +334,31 @@ namespace EE::Animation
         void SetToRecordedState( RecordedGraphState const& recordedState );
         #endif
 
+        // Profiling
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Are we currently recording node and task costs for this graph
+        inline bool IsProfiling() const { return m_pProfiler != nullptr; }
+
+        // Set the profiler to record this graph's (and all its child/external graphs') costs into, set to null to disable profiling
+        void SetProfiler( GraphProfiler* pProfiler );
+        #endif
+
+        // Memory
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        struct MemoryUsage
+        {
+            size_t                              m_instanceMemory = 0;           // Memory exclusively owned by this instance (including child graphs and its task system)
+            size_t                              m_sharedMemory = 0;             // Memory shared with all other instances of this graph (node memory slabs, pose buffer and bone mask storage)
+        };
+
+        // Get the memory used by this instance, connected external graphs are not included
+        MemoryUsage GetMemoryUsage() const;
+        #endif
+
     private:
 
         explicit GraphInstance( GraphVariation const* pGraphVariation, uint64_t ownerID, TaskSystem* pTaskSystem );
@@ -380,6 +406,8 @@ namespace EE::Animation
         TVector<GraphLogEntry>                  m_log;
         int32_t                                 m_lastOutputtedLogItemIdx = 0;
         GraphRecorder*                          m_pRecorder = nullptr;
+        GraphProfiler*                          m_pProfiler = nullptr;
+        GraphUpdateProfile                      m_updateProfile;
         #endif
     };
 }
@@ -0,0 +1,62 @@
+#include "Animation_RuntimeGraph_InstanceMemoryPool.h"
+#include "Base/Math/Math.h"
+#include "Base/Memory/Memory.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    GraphInstanceMemoryPool::GraphInstanceMemoryPool( uint32_t blockSize, uint32_t blockAlignment )
+        : m_blockAlignment( Math::Max( blockAlignment, (uint32_t) EE_DEFAULT_ALIGNMENT ) )
+    {
+        EE_ASSERT( blockSize > 0 );
+
+        // Round up the block size so that every block in a slab is correctly aligned
+        m_blockSize = Math::RoundUpToNearestMultiple32( blockSize, m_blockAlignment );
+    }
+
+    GraphInstanceMemoryPool::~GraphInstanceMemoryPool()
+    {
+        EE_ASSERT( m_numUsedBlocks == 0 );
+
+        for ( auto& pSlab : m_slabs )
+        {
+            EE::Free( pSlab );
+        }
+
+        m_slabs.clear();
+        m_freeBlocks.clear();
+    }
+
+    uint8_t* GraphInstanceMemoryPool::Allocate()
+    {
+        Threading::ScopeLock lock( m_mutex );
+
+        if ( m_freeBlocks.empty() )
+        {
+            uint8_t* pSlab = reinterpret_cast<uint8_t*>( EE::Alloc( size_t( m_blockSize ) * s_numBlocksPerSlab, m_blockAlignment ) );
+            m_slabs.emplace_back( pSlab );
+
+            // Add in reverse order so that consecutive allocations are adjacent in memory
+            for ( int32_t i = s_numBlocksPerSlab - 1; i >= 0; i-- )
+            {
+                m_freeBlocks.emplace_back( pSlab + ( size_t( i ) * m_blockSize ) );
+            }
+        }
+
+        uint8_t* pBlock = m_freeBlocks.back();
+        m_freeBlocks.pop_back();
+        m_numUsedBlocks++;
+        return pBlock;
+    }
+
+    void GraphInstanceMemoryPool::Free( uint8_t* pBlock )
+    {
+        EE_ASSERT( pBlock != nullptr );
+
+        Threading::ScopeLock lock( m_mutex );
+        EE_ASSERT( m_numUsedBlocks > 0 );
+        m_freeBlocks.emplace_back( pBlock );
+        m_numUsedBlocks--;
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Graph Instance Memory Pool
+//-------------------------------------------------------------------------
+// Every instance of a graph definition needs the exact same amount of node memory, so we allocate these blocks in slabs
+// This avoids an individual allocation per instance and keeps the node memory of instances of the same graph close together
+// Slabs are never released until the pool is destroyed, so the pool will stay at the peak number of instances
+
+namespace EE::Animation
+{
+    class EE_ENGINE_API GraphInstanceMemoryPool
+    {
+        constexpr static int32_t const s_numBlocksPerSlab = 16;
+
+    public:
+
+        GraphInstanceMemoryPool( uint32_t blockSize, uint32_t blockAlignment );
+        GraphInstanceMemoryPool( GraphInstanceMemoryPool const& ) = delete;
+        ~GraphInstanceMemoryPool();
+
+        GraphInstanceMemoryPool& operator=( GraphInstanceMemoryPool const& ) = delete;
+
+        // Get a block of node memory for a new instance
+        uint8_t* Allocate();
+
+        // Return an instance's node memory to the pool
+        void Free( uint8_t* pBlock );
+
+        inline uint32_t GetBlockSize() const { return m_blockSize; }
+        inline int32_t GetNumUsedBlocks() const { return m_numUsedBlocks; }
+        inline int32_t GetNumAllocatedBlocks() const { return (int32_t) m_slabs.size() * s_numBlocksPerSlab; }
+        inline size_t GetMemoryUsage() const { return m_slabs.size() * s_numBlocksPerSlab * m_blockSize; }
+
+    private:
+
+        Threading::Mutex                        m_mutex;
+        TVector<uint8_t*>                       m_slabs;
+        TVector<uint8_t*>                       m_freeBlocks;
+        uint32_t                                m_blockSize = 0;
+        uint32_t                                m_blockAlignment = 0;
+        int32_t                                 m_numUsedBlocks = 0;
+    };
+}
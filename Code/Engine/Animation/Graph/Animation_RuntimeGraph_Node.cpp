@@ -1,4 +1,5 @@
 #include "Animation_RuntimeGraph_Node.h"
+#include "Animation_RuntimeGraph_Profiler.h"
 
 //-------------------------------------------------------------------------
 
@@ -148,6 +149,20 @@ namespace EE::Animation
     }
 
     #if EE_DEVELOPMENT_TOOLS
+    GraphPoseNodeResult PoseNode::Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
+    {
+        GraphUpdateProfile* pProfile = context.GetProfile();
+        if ( pProfile == nullptr )
+        {
+            return UpdateInternal( context, pUpdateRange );
+        }
+
+        pProfile->BeginNodeUpdate( GetNodeIndex() );
+        GraphPoseNodeResult const result = UpdateInternal( context, pUpdateRange );
+        pProfile->EndNodeUpdate();
+        return result;
+    }
+
     PoseNodeDebugInfo PoseNode::GetDebugInfo() const
     {
         PoseNodeDebugInfo info;
@@ -201,7 +201,11 @@ namespace EE::Animation
         // Node update function
         // If the sync track update range is set, this will perform a synchronized update
         // If the sync track update range is not set, it will run unsynchronized and use the frame delta time instead
-        virtual GraphPoseNodeResult Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange = nullptr ) = 0;
+        #if EE_DEVELOPMENT_TOOLS
+        GraphPoseNodeResult Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange = nullptr );
+        #else
+        EE_FORCE_INLINE GraphPoseNodeResult Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange = nullptr ) { return UpdateInternal( context, pUpdateRange ); }
+        #endif
 
         //-------------------------------------------------------------------------
 
@@ -215,6 +219,9 @@ namespace EE::Animation
 
     protected:
 
+        // The actual node update, only called via 'Update' so that the update can be instrumented
+        virtual GraphPoseNodeResult UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange ) = 0;
+
         #if EE_DEVELOPMENT_TOOLS
         virtual void RecordGraphState( RecordedGraphState& outState ) override;
         virtual void RestoreGraphState( RecordedGraphState const& inState ) override;
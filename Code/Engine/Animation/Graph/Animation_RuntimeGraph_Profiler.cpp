@@ -0,0 +1,257 @@
+#include "Animation_RuntimeGraph_Profiler.h"
+#include "Animation_RuntimeGraph_Definition.h"
+#include "Base/FileSystem/FileStreams.h"
+#include "Base/TypeSystem/TypeInfo.h"
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+namespace EE::Animation
+{
+    void GraphUpdateProfile::Reset( int32_t numNodes )
+    {
+        m_nodeSamples.clear();
+        m_nodeSamples.resize( numNodes );
+        m_activeNodes.clear();
+        m_updateTime = 0;
+    }
+
+    void GraphUpdateProfile::BeginNodeUpdate( int16_t nodeIdx )
+    {
+        EE_ASSERT( nodeIdx >= 0 && nodeIdx < m_nodeSamples.size() );
+
+        ActiveNode& activeNode = m_activeNodes.emplace_back();
+        activeNode.m_nodeIdx = nodeIdx;
+        activeNode.m_startTime = PlatformClock::GetTime();
+    }
+
+    void GraphUpdateProfile::EndNodeUpdate()
+    {
+        EE_ASSERT( !m_activeNodes.empty() );
+
+        ActiveNode const activeNode = m_activeNodes.back();
+        m_activeNodes.pop_back();
+
+        uint64_t const inclusiveTime = uint64_t( PlatformClock::GetTime() ) - activeNode.m_startTime;
+        EE_ASSERT( inclusiveTime >= activeNode.m_childTime );
+
+        NodeSample& sample = m_nodeSamples[activeNode.m_nodeIdx];
+        sample.m_inclusiveTime += inclusiveTime;
+        sample.m_exclusiveTime += inclusiveTime - activeNode.m_childTime;
+        sample.m_numUpdates++;
+
+        // Remove our time from the parent's exclusive time
+        if ( !m_activeNodes.empty() )
+        {
+            m_activeNodes.back().m_childTime += inclusiveTime;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void TaskSystemProfile::Reset()
+    {
+        m_taskSamples.clear();
+        m_executionTime = 0;
+        m_numSampledClips = 0;
+        m_peakPoseBuffersUsed = 0;
+        m_numPoseBuffersAllocated = 0;
+    }
+
+    void TaskSystemProfile::RecordTaskExecution( TypeSystem::TypeInfo const* pTaskTypeInfo, uint64_t time )
+    {
+        EE_ASSERT( pTaskTypeInfo != nullptr );
+
+        m_executionTime += time;
+
+        // There are only a handful of task types so a linear search is fine
+        for ( auto& sample : m_taskSamples )
+        {
+            if ( sample.m_pTaskTypeInfo == pTaskTypeInfo )
+            {
+                sample.m_time += time;
+                sample.m_numExecutions++;
+                return;
+            }
+        }
+
+        TaskSample& sample = m_taskSamples.emplace_back();
+        sample.m_pTaskTypeInfo = pTaskTypeInfo;
+        sample.m_time = time;
+        sample.m_numExecutions = 1;
+    }
+
+    //-------------------------------------------------------------------------
+
+    GraphProfiler::GraphStats& GraphProfiler::GetOrCreateGraphStats( GraphDefinition const* pGraphDefinition )
+    {
+        EE_ASSERT( pGraphDefinition != nullptr );
+
+        ResourceID const& graphID = pGraphDefinition->GetResourceID();
+        for ( auto& graphStats : m_graphStats )
+        {
+            if ( graphStats.m_graphID == graphID )
+            {
+                return graphStats;
+            }
+        }
+
+        // Copy out all the node info so that the stats remain valid if the definition is unloaded
+        GraphStats& graphStats = m_graphStats.emplace_back();
+        graphStats.m_graphID = graphID;
+
+        int32_t const numNodes = (int32_t) pGraphDefinition->m_nodeSettings.size();
+        graphStats.m_nodeStats.resize( numNodes );
+        for ( int16_t i = 0; i < numNodes; i++ )
+        {
+            graphStats.m_nodeStats[i].m_path = pGraphDefinition->GetNodePath( i );
+            graphStats.m_nodeStats[i].m_pTypeName = pGraphDefinition->m_nodeSettings[i]->GetTypeInfo()->GetTypeName();
+        }
+
+        return graphStats;
+    }
+
+    void GraphProfiler::RecordGraphUpdate( GraphDefinition const* pGraphDefinition, GraphUpdateProfile const& profile )
+    {
+        Threading::ScopeLock lock( m_mutex );
+
+        GraphStats& graphStats = GetOrCreateGraphStats( pGraphDefinition );
+        graphStats.m_totalUpdateTime += profile.m_updateTime;
+        graphStats.m_maxUpdateTime = Math::Max( graphStats.m_maxUpdateTime, profile.m_updateTime );
+        graphStats.m_numEvaluations++;
+
+        int32_t const numNodes = (int32_t) graphStats.m_nodeStats.size();
+        EE_ASSERT( profile.m_nodeSamples.size() == numNodes );
+        for ( int32_t i = 0; i < numNodes; i++ )
+        {
+            GraphUpdateProfile::NodeSample const& sample = profile.m_nodeSamples[i];
+            if ( sample.m_numUpdates == 0 )
+            {
+                continue;
+            }
+
+            NodeStats& nodeStats = graphStats.m_nodeStats[i];
+            nodeStats.m_totalInclusiveTime += sample.m_inclusiveTime;
+            nodeStats.m_totalExclusiveTime += sample.m_exclusiveTime;
+            nodeStats.m_maxInclusiveTime = Math::Max( nodeStats.m_maxInclusiveTime, sample.m_inclusiveTime );
+            nodeStats.m_numUpdates += sample.m_numUpdates;
+            nodeStats.m_numEvaluationsActive++;
+        }
+    }
+
+    void GraphProfiler::RecordTaskSystemUpdate( GraphDefinition const* pGraphDefinition, TaskSystemProfile const& profile )
+    {
+        Threading::ScopeLock lock( m_mutex );
+
+        GraphStats& graphStats = GetOrCreateGraphStats( pGraphDefinition );
+        graphStats.m_totalTaskTime += profile.m_executionTime;
+        graphStats.m_maxTaskTime = Math::Max( graphStats.m_maxTaskTime, profile.m_executionTime );
+        graphStats.m_numTaskUpdates++;
+        graphStats.m_numSampledClips += profile.m_numSampledClips;
+        graphStats.m_peakPoseBuffersUsed = Math::Max( graphStats.m_peakPoseBuffersUsed, profile.m_peakPoseBuffersUsed );
+        graphStats.m_maxPoseBuffersAllocated = Math::Max( graphStats.m_maxPoseBuffersAllocated, profile.m_numPoseBuffersAllocated );
+
+        for ( auto const& sample : profile.m_taskSamples )
+        {
+            TaskStats* pTaskStats = nullptr;
+            for ( auto& taskStats : graphStats.m_taskStats )
+            {
+                if ( taskStats.m_pTaskTypeInfo == sample.m_pTaskTypeInfo )
+                {
+                    pTaskStats = &taskStats;
+                    break;
+                }
+            }
+
+            if ( pTaskStats == nullptr )
+            {
+                pTaskStats = &graphStats.m_taskStats.emplace_back();
+                pTaskStats->m_pTaskTypeInfo = sample.m_pTaskTypeInfo;
+            }
+
+            pTaskStats->m_totalTime += sample.m_time;
+            pTaskStats->m_maxTime = Math::Max( pTaskStats->m_maxTime, sample.m_time );
+            pTaskStats->m_numExecutions += sample.m_numExecutions;
+        }
+    }
+
+    void GraphProfiler::Reset()
+    {
+        Threading::ScopeLock lock( m_mutex );
+        m_graphStats.clear();
+    }
+
+    void GraphProfiler::GetStats( TVector<GraphStats>& outStats ) const
+    {
+        Threading::ScopeLock lock( m_mutex );
+        outStats = m_graphStats;
+    }
+
+    bool GraphProfiler::ExportToCSV( FileSystem::Path const& outputPath ) const
+    {
+        EE_ASSERT( outputPath.IsValid() && outputPath.IsFilePath() );
+
+        auto ToMicroseconds = [] ( uint64_t time ) { return float( double( time ) / 1000.0 ); };
+        auto GetAverage = [] ( uint64_t total, uint32_t count ) { return ( count > 0 ) ? float( double( total ) / count / 1000.0 ) : 0.0f; };
+
+        String csv = "Graph,Category,Name,Type,Count,Evaluations,Avg Inclusive (us),Avg Exclusive (us),Max (us),Total (ms)\r\n";
+        InlineString line;
+
+        {
+            Threading::ScopeLock lock( m_mutex );
+
+            for ( auto const& graphStats : m_graphStats )
+            {
+                char const* pGraphID = graphStats.m_graphID.c_str();
+
+                line.sprintf( "%s,Graph,Evaluation,,%u,%u,%.3f,,%.3f,%.3f\r\n", pGraphID, graphStats.m_numEvaluations, graphStats.m_numEvaluations, GetAverage( graphStats.m_totalUpdateTime, graphStats.m_numEvaluations ), ToMicroseconds( graphStats.m_maxUpdateTime ), ToMicroseconds( graphStats.m_totalUpdateTime ) / 1000.0f );
+                csv.append( line.c_str() );
+
+                for ( auto const& nodeStats : graphStats.m_nodeStats )
+                {
+                    if ( nodeStats.m_numUpdates == 0 )
+                    {
+                        continue;
+                    }
+
+                    line.sprintf( "%s,Node,\"%s\",%s,%u,%u,%.3f,%.3f,%.3f,%.3f\r\n", pGraphID, nodeStats.m_path.c_str(), nodeStats.m_pTypeName, nodeStats.m_numUpdates, nodeStats.m_numEvaluationsActive, GetAverage( nodeStats.m_totalInclusiveTime, nodeStats.m_numUpdates ), GetAverage( nodeStats.m_totalExclusiveTime, nodeStats.m_numUpdates ), ToMicroseconds( nodeStats.m_maxInclusiveTime ), ToMicroseconds( nodeStats.m_totalInclusiveTime ) / 1000.0f );
+                    csv.append( line.c_str() );
+                }
+
+                if ( graphStats.m_numTaskUpdates == 0 )
+                {
+                    continue;
+                }
+
+                line.sprintf( "%s,Tasks,Execution,,%u,%u,%.3f,,%.3f,%.3f\r\n", pGraphID, graphStats.m_numTaskUpdates, graphStats.m_numTaskUpdates, GetAverage( graphStats.m_totalTaskTime, graphStats.m_numTaskUpdates ), ToMicroseconds( graphStats.m_maxTaskTime ), ToMicroseconds( graphStats.m_totalTaskTime ) / 1000.0f );
+                csv.append( line.c_str() );
+
+                for ( auto const& taskStats : graphStats.m_taskStats )
+                {
+                    line.sprintf( "%s,Task,%s,,%u,%u,%.3f,%.3f,%.3f,%.3f\r\n", pGraphID, taskStats.m_pTaskTypeInfo->GetTypeName(), taskStats.m_numExecutions, graphStats.m_numTaskUpdates, GetAverage( taskStats.m_totalTime, taskStats.m_numExecutions ), GetAverage( taskStats.m_totalTime, taskStats.m_numExecutions ), ToMicroseconds( taskStats.m_maxTime ), ToMicroseconds( taskStats.m_totalTime ) / 1000.0f );
+                    csv.append( line.c_str() );
+                }
+
+                line.sprintf( "%s,Pose Buffers,Peak Used,,%d,,,,,\r\n", pGraphID, graphStats.m_peakPoseBuffersUsed );
+                csv.append( line.c_str() );
+                line.sprintf( "%s,Pose Buffers,Max Allocated,,%d,,,,,\r\n", pGraphID, graphStats.m_maxPoseBuffersAllocated );
+                csv.append( line.c_str() );
+                line.sprintf( "%s,Clips,Sampled,,%llu,%u,,,,\r\n", pGraphID, (unsigned long long) graphStats.m_numSampledClips, graphStats.m_numTaskUpdates );
+                csv.append( line.c_str() );
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        FileSystem::OutputFileStream outputFile( outputPath );
+        if ( !outputFile.IsValid() )
+        {
+            EE_LOG_ERROR( "Animation", "Graph Profiler", "Failed to open '%s' for writing", outputPath.c_str() );
+            return false;
+        }
+
+        outputFile.Write( (void*) csv.data(), csv.size() );
+        return true;
+    }
+}
+#endif
@@ -0,0 +1,165 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Base/Resource/ResourceID.h"
+#include "Base/FileSystem/FileSystemPath.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Time/Time.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Animation Graph Profiler
+//-------------------------------------------------------------------------
+// Opt-in instrumentation used to find out which nodes and tasks make up the cost of a graph
+//
+// Graph instances and task systems record into their own per-frame profiles without any locking
+// These are then merged into the shared profiler, which aggregates the data per graph definition (over all frames and all instances)
+//
+// Node times are recorded both inclusive and exclusive of the node's children. Child and external graphs are profiled against their own definitions.
+// Pose tasks are attributed to the graph that owns the task system (i.e. the top-level graph instance)
+
+#if EE_DEVELOPMENT_TOOLS
+namespace EE::TypeSystem { class TypeInfo; }
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    class GraphDefinition;
+
+    //-------------------------------------------------------------------------
+
+    // The node update costs for a single graph instance evaluation
+    class GraphUpdateProfile
+    {
+        struct ActiveNode
+        {
+            int16_t                             m_nodeIdx = InvalidIndex;
+            uint64_t                            m_startTime = 0;
+            uint64_t                            m_childTime = 0;
+        };
+
+    public:
+
+        struct NodeSample
+        {
+            uint64_t                            m_inclusiveTime = 0;    // Nanoseconds
+            uint64_t                            m_exclusiveTime = 0;    // Nanoseconds
+            uint32_t                            m_numUpdates = 0;
+        };
+
+    public:
+
+        void Reset( int32_t numNodes );
+
+        void BeginNodeUpdate( int16_t nodeIdx );
+        void EndNodeUpdate();
+
+    public:
+
+        TVector<NodeSample>                     m_nodeSamples;
+        uint64_t                                m_updateTime = 0;       // Nanoseconds, the total time spent evaluating the graph
+
+    private:
+
+        TInlineVector<ActiveNode, 32>           m_activeNodes;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // The pose task costs for a single task system update
+    class TaskSystemProfile
+    {
+    public:
+
+        struct TaskSample
+        {
+            TypeSystem::TypeInfo const*         m_pTaskTypeInfo = nullptr;
+            uint64_t                            m_time = 0;             // Nanoseconds
+            uint32_t                            m_numExecutions = 0;
+        };
+
+    public:
+
+        void Reset();
+
+        void RecordTaskExecution( TypeSystem::TypeInfo const* pTaskTypeInfo, uint64_t time );
+
+    public:
+
+        TInlineVector<TaskSample, 16>           m_taskSamples;
+        uint64_t                                m_executionTime = 0;    // Nanoseconds, the total time spent executing tasks
+        int32_t                                 m_numSampledClips = 0;
+        int32_t                                 m_peakPoseBuffersUsed = 0;
+        int32_t                                 m_numPoseBuffersAllocated = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API GraphProfiler
+    {
+    public:
+
+        struct NodeStats
+        {
+            String                              m_path;
+            char const*                         m_pTypeName = nullptr;
+            uint64_t                            m_totalInclusiveTime = 0;
+            uint64_t                            m_totalExclusiveTime = 0;
+            uint64_t                            m_maxInclusiveTime = 0;
+            uint32_t                            m_numUpdates = 0;
+            uint32_t                            m_numEvaluationsActive = 0; // The number of graph evaluations in which this node was updated
+        };
+
+        struct TaskStats
+        {
+            TypeSystem::TypeInfo const*         m_pTaskTypeInfo = nullptr;
+            uint64_t                            m_totalTime = 0;
+            uint64_t                            m_maxTime = 0;
+            uint32_t                            m_numExecutions = 0;
+        };
+
+        struct GraphStats
+        {
+            ResourceID                          m_graphID;
+            TVector<NodeStats>                  m_nodeStats;
+            TVector<TaskStats>                  m_taskStats;
+            uint64_t                            m_totalUpdateTime = 0;
+            uint64_t                            m_maxUpdateTime = 0;
+            uint32_t                            m_numEvaluations = 0;
+            uint64_t                            m_totalTaskTime = 0;
+            uint64_t                            m_maxTaskTime = 0;
+            uint32_t                            m_numTaskUpdates = 0;
+            uint64_t                            m_numSampledClips = 0;
+            int32_t                             m_peakPoseBuffersUsed = 0;
+            int32_t                             m_maxPoseBuffersAllocated = 0;
+        };
+
+    public:
+
+        // Merge the results of a graph evaluation into the stats for its definition
+        void RecordGraphUpdate( GraphDefinition const* pGraphDefinition, GraphUpdateProfile const& profile );
+
+        // Merge the results of a task system update into the stats for the graph that owns the task system
+        void RecordTaskSystemUpdate( GraphDefinition const* pGraphDefinition, TaskSystemProfile const& profile );
+
+        // Clear all recorded stats
+        void Reset();
+
+        // Copy out the current stats, this is safe to call while graphs are recording
+        void GetStats( TVector<GraphStats>& outStats ) const;
+
+        // Write all the recorded stats to a CSV file (one row per node and per task)
+        bool ExportToCSV( FileSystem::Path const& outputPath ) const;
+
+    private:
+
+        GraphStats& GetOrCreateGraphStats( GraphDefinition const* pGraphDefinition );
+
+    private:
+
+        mutable Threading::Mutex                m_mutex;
+        TVector<GraphStats>                     m_graphStats;
+    };
+}
+#endif
@@ -2,6 +2,7 @@
 #include "Engine/_Module/API.h"
 #include "Animation_RuntimeGraph_Contexts.h"
 #include "Animation_RuntimeGraph_LayerData.h"
+#include "Engine/Animation/TaskSystem/Animation_TaskSerializer.h"
 #include "Engine/Animation/AnimationTarget.h"
 #include "Engine/Animation/AnimationSyncTrack.h"
 #include "Base/Time/Time.h"
@@ -119,6 +120,7 @@ namespace EE::Animation
         TVector<ParameterData>                              m_parameterData;
         Seconds                                             m_deltaTime;
         Blob                                                m_serializedTaskData;
+        SerializedTaskListLayout                            m_serializedTaskLayout;
         TVector<GraphLayerUpdateState>                      m_layerUpdateStates;
     };
 
@@ -75,7 +75,7 @@ namespace EE::Animation::GraphNodes
     }
 
 
-    GraphPoseNodeResult AnimationClipNode::Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
+    GraphPoseNodeResult AnimationClipNode::UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
     {
         EE_ASSERT( context.IsValid() && IsInitialized() );
 
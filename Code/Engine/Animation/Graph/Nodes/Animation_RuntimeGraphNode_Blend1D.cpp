@@ -216,7 +216,7 @@ namespace EE::Animation::GraphNodes
         }
     }
 
-    GraphPoseNodeResult ParameterizedBlendNode::Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
+    GraphPoseNodeResult ParameterizedBlendNode::UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
     {
         EE_ASSERT( context.IsValid() );
 
@@ -76,7 +76,7 @@ namespace EE::Animation::GraphNodes
         virtual void InitializeInternal( GraphContext& context, SyncTrackTime const& initialTime ) override;
         virtual void ShutdownInternal( GraphContext& context ) override;
 
-        virtual GraphPoseNodeResult Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange ) override final;
+        virtual GraphPoseNodeResult UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange ) override final;
 
         void EvaluateBlendSpace( GraphContext& context );
 
@@ -296,7 +296,7 @@ namespace EE::Animation::GraphNodes
         }
     }
 
-    GraphPoseNodeResult Blend2DNode::Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
+    GraphPoseNodeResult Blend2DNode::UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
     {
         EE_ASSERT( context.IsValid() );
 
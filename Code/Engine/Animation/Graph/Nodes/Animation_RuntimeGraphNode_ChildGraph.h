@@ -34,7 +34,7 @@ namespace EE::Animation::GraphNodes
         virtual void InitializeInternal( GraphContext& context, SyncTrackTime const& initialTime ) override;
         virtual void ShutdownInternal( GraphContext& context ) override;
 
-        virtual GraphPoseNodeResult Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange ) override;
+        virtual GraphPoseNodeResult UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange ) override;
 
         void ReflectControlParameters( GraphContext& context );
 
@@ -34,7 +34,7 @@ namespace EE::Animation::GraphNodes
 
         virtual SyncTrack const& GetSyncTrack() const override;
         virtual void InitializeInternal( GraphContext& context, SyncTrackTime const& initialTime ) override;
-        virtual GraphPoseNodeResult Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange ) override;
+        virtual GraphPoseNodeResult UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange ) override;
 
     private:
 
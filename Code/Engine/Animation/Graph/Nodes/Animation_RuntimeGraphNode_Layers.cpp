@@ -136,7 +136,7 @@ namespace EE::Animation::GraphNodes
     }
 
     // NB: Layered nodes always update the base according to the specified update time delta or time range. The layers are then updated relative to the base.
-    GraphPoseNodeResult LayerBlendNode::Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
+    GraphPoseNodeResult LayerBlendNode::UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
     {
         EE_ASSERT( context.IsValid() );
 
@@ -215,7 +215,7 @@ namespace EE::Animation::GraphNodes
         }
     }
 
-    GraphPoseNodeResult OrientationWarpNode::Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
+    GraphPoseNodeResult OrientationWarpNode::UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
     {
         MarkNodeActive( context );
 
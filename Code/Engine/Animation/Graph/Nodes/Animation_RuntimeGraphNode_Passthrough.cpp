@@ -56,7 +56,7 @@ namespace EE::Animation::GraphNodes
         PoseNode::ShutdownInternal( context );
     }
 
-    GraphPoseNodeResult PassthroughNode::Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
+    GraphPoseNodeResult PassthroughNode::UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
     {
         EE_ASSERT( context.IsValid() );
         MarkNodeActive( context );
@@ -22,7 +22,7 @@ namespace EE::Animation::GraphNodes
 
         virtual SyncTrack const& GetSyncTrack() const override { return SyncTrack::s_defaultTrack; }
         virtual void InitializeInternal( GraphContext& context, SyncTrackTime const& initialTime ) override;
-        virtual GraphPoseNodeResult Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange ) override;
+        virtual GraphPoseNodeResult UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange ) override;
     };
 
     //-------------------------------------------------------------------------
@@ -41,7 +41,7 @@ namespace EE::Animation::GraphNodes
 
         virtual SyncTrack const& GetSyncTrack() const override { return SyncTrack::s_defaultTrack; }
         virtual void InitializeInternal( GraphContext& context, SyncTrackTime const& initialTime ) override;
-        virtual GraphPoseNodeResult Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange ) override;
+        virtual GraphPoseNodeResult UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange ) override;
     };
 
     //-------------------------------------------------------------------------
@@ -73,7 +73,7 @@ namespace EE::Animation::GraphNodes
         virtual SyncTrack const& GetSyncTrack() const override { return SyncTrack::s_defaultTrack; }
         virtual void InitializeInternal( GraphContext& context, SyncTrackTime const& initialTime ) override;
         virtual void ShutdownInternal( GraphContext& context ) override;
-        virtual GraphPoseNodeResult Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange ) override;
+        virtual GraphPoseNodeResult UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange ) override;
 
     private:
 
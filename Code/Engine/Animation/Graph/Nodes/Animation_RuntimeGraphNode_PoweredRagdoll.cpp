@@ -86,7 +86,7 @@ namespace EE::Animation::GraphNodes
         PassthroughNode::ShutdownInternal( context );
     }
 
-    GraphPoseNodeResult PoweredRagdollNode::Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
+    GraphPoseNodeResult PoweredRagdollNode::UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
     {
         GraphPoseNodeResult result;
 
@@ -103,7 +103,7 @@ namespace EE::Animation::GraphNodes
 
         if ( IsValid() )
         {
-            result = PassthroughNode::Update( context, pUpdateRange );
+            result = PassthroughNode::UpdateInternal( context, pUpdateRange );
             result = UpdateRagdoll( context, result );
         }
         else
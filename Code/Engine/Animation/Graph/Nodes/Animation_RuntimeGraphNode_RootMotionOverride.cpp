@@ -336,9 +336,9 @@ namespace EE::Animation::GraphNodes
         }
     }
 
-    GraphPoseNodeResult RootMotionOverrideNode::Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
+    GraphPoseNodeResult RootMotionOverrideNode::UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
     {
-        GraphPoseNodeResult Result = PassthroughNode::Update( context, pUpdateRange );
+        GraphPoseNodeResult Result = PassthroughNode::UpdateInternal( context, pUpdateRange );
 
         // Always modify root motion even if child is invalid
         ModifyRootMotion( context, Result );
@@ -131,7 +131,7 @@ namespace EE::Animation::GraphNodes
         }
     }
 
-    GraphPoseNodeResult SimulatedRagdollNode::Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
+    GraphPoseNodeResult SimulatedRagdollNode::UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
     {
         EE_ASSERT( IsInitialized() );
 
@@ -31,7 +31,7 @@ namespace EE::Animation::GraphNodes
         PassthroughNode::ShutdownInternal( context );
     }
 
-    GraphPoseNodeResult SpeedScaleNode::Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
+    GraphPoseNodeResult SpeedScaleNode::UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
     {
         MarkNodeActive( context );
 
@@ -44,7 +44,7 @@ namespace EE::Animation::GraphNodes
             context.LogWarning( GetNodeIndex(), "Attempting to run a speed scale node in a synchronized manner, this is an invalid operation!" );
             #endif
 
-            result = PassthroughNode::Update( context, pUpdateRange );
+            result = PassthroughNode::UpdateInternal( context, pUpdateRange );
         }
         else // Unsynchronized Update
         {
@@ -93,7 +93,7 @@ namespace EE::Animation::GraphNodes
             // Update the child node
             //-------------------------------------------------------------------------
 
-            result = PassthroughNode::Update( context );
+            result = PassthroughNode::UpdateInternal( context );
 
             // Override node values
             //-------------------------------------------------------------------------
@@ -151,7 +151,7 @@ namespace EE::Animation::GraphNodes
         PassthroughNode::ShutdownInternal( context );
     }
 
-    GraphPoseNodeResult DurationScaleNode::Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
+    GraphPoseNodeResult DurationScaleNode::UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
     {
         MarkNodeActive( context );
 
@@ -163,7 +163,7 @@ namespace EE::Animation::GraphNodes
             context.LogWarning( GetNodeIndex(), "Attempting to run a speed scale node in a synchronized manner, this is an invalid operation!" );
             #endif
 
-            result = PassthroughNode::Update( context, pUpdateRange );
+            result = PassthroughNode::UpdateInternal( context, pUpdateRange );
         }
         else
         {
@@ -204,7 +204,7 @@ namespace EE::Animation::GraphNodes
             // Update the child node
             //-------------------------------------------------------------------------
 
-            result = PassthroughNode::Update( context );
+            result = PassthroughNode::UpdateInternal( context );
 
             // Override node values
             //-------------------------------------------------------------------------
@@ -280,7 +280,7 @@ namespace EE::Animation::GraphNodes
         }
     }
 
-    GraphPoseNodeResult VelocityBasedSpeedScaleNode::Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
+    GraphPoseNodeResult VelocityBasedSpeedScaleNode::UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
     {
         MarkNodeActive( context );
 
@@ -228,7 +228,7 @@ namespace EE::Animation::GraphNodes
         }
     }
 
-    GraphPoseNodeResult StateNode::Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
+    GraphPoseNodeResult StateNode::UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
     {
         EE_ASSERT( context.IsValid() );
 
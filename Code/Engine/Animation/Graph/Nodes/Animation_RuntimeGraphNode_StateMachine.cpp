@@ -244,7 +244,7 @@ namespace EE::Animation::GraphNodes
         }
     }
 
-    GraphPoseNodeResult StateMachineNode::Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
+    GraphPoseNodeResult StateMachineNode::UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
     {
         EE_ASSERT( context.IsValid() );
         MarkNodeActive( context );
@@ -77,7 +77,7 @@ namespace EE::Animation::GraphNodes
         virtual bool IsValid() const override;
         virtual SyncTrack const& GetSyncTrack() const override;
 
-        virtual GraphPoseNodeResult Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange ) override;
+        virtual GraphPoseNodeResult UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange ) override;
 
     private:
 
@@ -654,7 +654,7 @@ namespace EE::Animation::GraphNodes
 
     //-------------------------------------------------------------------------
 
-    GraphPoseNodeResult TransitionNode::Update( GraphContext& context, SyncTrackTimeRange const* pExternallySuppliedUpdateRange )
+    GraphPoseNodeResult TransitionNode::UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pExternallySuppliedUpdateRange )
     {
         EE_ASSERT( IsInitialized() && m_pSourceNode != nullptr && m_pSourceNode->IsInitialized() && !IsComplete( context ) );
         auto pSettings = GetSettings<TransitionNode>();
@@ -82,7 +82,7 @@ namespace EE::Animation::GraphNodes
     public:
 
         virtual SyncTrack const& GetSyncTrack() const override { return m_syncTrack; }
-        virtual GraphPoseNodeResult Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange ) override;
+        virtual GraphPoseNodeResult UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange ) override;
 
         // Secondary initialization
         //-------------------------------------------------------------------------
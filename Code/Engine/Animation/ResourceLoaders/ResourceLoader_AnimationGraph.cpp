@@ -1,5 +1,8 @@
 #include "ResourceLoader_AnimationGraph.h"
 #include "Engine/Animation/Graph/Animation_RuntimeGraph_Definition.h"
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_InstanceMemoryPool.h"
+#include "Engine/Animation/TaskSystem/Animation_TaskPosePool.h"
+#include "Engine/Animation/AnimationBoneMask.h"
 #include "Base/Serialization/BinarySerialization.h"
 #include "Base/TypeSystem/TypeDescriptors.h"
 
@@ -64,9 +67,16 @@ namespace EE::Animation
                 pSettings->Load( archive );
             }
 
+            // Create instance memory pool
             //-------------------------------------------------------------------------
 
-            return pGraphDef->IsValid();
+            if ( !pGraphDef->IsValid() )
+            {
+                return false;
+            }
+
+            pGraphDef->m_pInstanceMemoryPool = EE::New<GraphInstanceMemoryPool>( pGraphDef->m_instanceRequiredMemory, pGraphDef->m_instanceRequiredAlignment );
+            return true;
         }
 
         //-------------------------------------------------------------------------
@@ -109,6 +119,13 @@ namespace EE::Animation
                 return Resource::InstallResult::Failed;
             }
 
+            // Create shared storage
+            //-------------------------------------------------------------------------
+
+            EE_ASSERT( pGraphVariation->m_pPoseBufferStorage == nullptr && pGraphVariation->m_pBoneMaskStorage == nullptr );
+            pGraphVariation->m_pPoseBufferStorage = EE::New<PoseBufferStorage>( dataSet.GetSkeleton() );
+            pGraphVariation->m_pBoneMaskStorage = EE::New<BoneMaskStorage>( dataSet.GetSkeleton() );
+
             // Fill Slots
             //-------------------------------------------------------------------------
 
@@ -152,6 +169,17 @@ namespace EE::Animation
             if ( pGraphDef != nullptr )
             {
                 TypeSystem::TypeDescriptorCollection::DestroyStaticCollection( pGraphDef->m_nodeSettings );
+                EE::Delete( pGraphDef->m_pInstanceMemoryPool );
+            }
+        }
+        else if ( resourceTypeID == GraphVariation::GetStaticResourceTypeID() )
+        {
+            // Release shared storage
+            auto pGraphVariation = pResourceRecord->GetResourceData<GraphVariation>();
+            if ( pGraphVariation != nullptr )
+            {
+                EE::Delete( pGraphVariation->m_pPoseBufferStorage );
+                EE::Delete( pGraphVariation->m_pBoneMaskStorage );
             }
         }
 
@@ -18,6 +18,12 @@ namespace EE::Animation
         EE_ASSERT( pSkeleton->IsValid() );
         pResourceRecord->SetResourceData( pSkeleton );
 
+        // Calculate the runtime data
+        //-------------------------------------------------------------------------
+        // Needs to be created before the bone masks as they look up bones by ID
+
+        pSkeleton->CalculateRuntimeData();
+
         TVector<BoneMaskDefinition> boneMaskDefinitions;
         archive << boneMaskDefinitions;
 
@@ -31,19 +37,6 @@ namespace EE::Animation
             pSkeleton->m_boneMasks.emplace_back( pSkeleton, def );
         }
 
-        // Calculate global reference pose
-        //-------------------------------------------------------------------------
-
-        int32_t const numBones = pSkeleton->GetNumBones();
-        pSkeleton->m_globalReferencePose.resize( numBones );
-
-        pSkeleton->m_globalReferencePose[0] = pSkeleton->m_localReferencePose[0];
-        for ( auto boneIdx = 1; boneIdx < numBones; boneIdx++ )
-        {
-            int32_t const parentIdx = pSkeleton->GetParentBoneIndex( boneIdx );
-            pSkeleton->m_globalReferencePose[boneIdx] = pSkeleton->m_localReferencePose[boneIdx] * pSkeleton->m_globalReferencePose[parentIdx];
-        }
-
         //-------------------------------------------------------------------------
 
         return true;
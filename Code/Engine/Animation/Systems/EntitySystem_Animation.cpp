@@ -95,6 +95,12 @@ namespace EE::Animation
 
         //-------------------------------------------------------------------------
 
+        if ( ctx.GetUpdateStage() == UpdateStage::PostPhysics )
+        {
+            m_meshPosesToFinalize.clear();
+            m_meshPosesToFinalize.resize( m_meshComponents.size(), nullptr );
+        }
+
         UpdateAnimPlayers( ctx, characterWorldTransform );
         UpdateAnimGraphs( ctx, characterWorldTransform );
 
@@ -102,15 +108,24 @@ namespace EE::Animation
 
         if ( ctx.GetUpdateStage() == UpdateStage::PostPhysics )
         {
-            for ( auto pMeshComponent : m_meshComponents )
+            // Set the final poses and generate the skinning transforms for all meshes in a single batch
+            m_meshComponentsToFinalize.clear();
+            int32_t numPosesToFinalize = 0;
+
+            int32_t const numMeshComponents = (int32_t) m_meshComponents.size();
+            for ( int32_t i = 0; i < numMeshComponents; i++ )
             {
-                if ( !pMeshComponent->HasMeshResourceSet() )
+                if ( !m_meshComponents[i]->HasMeshResourceSet() )
                 {
                     continue;
                 }
 
-                pMeshComponent->FinalizePose();
+                m_meshComponentsToFinalize.emplace_back( m_meshComponents[i] );
+                m_meshPosesToFinalize[numPosesToFinalize++] = m_meshPosesToFinalize[i];
             }
+
+            m_meshPosesToFinalize.resize( numPosesToFinalize );
+            Render::SkeletalMeshComponent::SetPosesAndFinalize( m_meshComponentsToFinalize, m_meshPosesToFinalize );
         }
     }
 
@@ -227,8 +242,10 @@ namespace EE::Animation
                 auto const* pPose = pAnimComponent->GetPose();
                 EE_ASSERT( pPose->HasGlobalTransforms() );
 
-                for ( auto pMeshComponent : m_meshComponents )
+                int32_t const numMeshComponents = (int32_t) m_meshComponents.size();
+                for ( int32_t i = 0; i < numMeshComponents; i++ )
                 {
+                    auto pMeshComponent = m_meshComponents[i];
                     if ( !pMeshComponent->HasMeshResourceSet() )
                     {
                         continue;
@@ -239,7 +256,8 @@ namespace EE::Animation
                         continue;
                     }
 
-                    pMeshComponent->SetPose( pPose );
+                    // The pose is applied when the meshes are finalized
+                    m_meshPosesToFinalize[i] = pPose;
                 }
             }
         }
@@ -22,6 +22,7 @@ namespace EE::Animation
 {
     class GraphComponent;
     class AnimationClipPlayerComponent;
+    class Pose;
 
     //-------------------------------------------------------------------------
 
@@ -47,6 +48,8 @@ namespace EE::Animation
         TVector<AnimationClipPlayerComponent*>          m_animPlayers;
         TVector<GraphComponent*>                        m_animGraphs;
         TVector<Render::SkeletalMeshComponent*>         m_meshComponents;
+        TVector<Render::SkeletalMeshComponent*>         m_meshComponentsToFinalize;
+        TVector<Pose const*>                            m_meshPosesToFinalize;      // The post-physics pose to apply to each mesh component, null if the mesh pose was already set
         SpatialEntityComponent*                         m_pRootComponent = nullptr;
     };
 }
\ No newline at end of file
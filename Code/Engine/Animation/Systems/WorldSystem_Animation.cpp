@@ -12,11 +12,24 @@ namespace EE::Animation
         EE_ASSERT( m_graphComponents.empty() );
     }
 
+    bool AnimationWorldSystem::GetComponentInterests( WorldSystemComponentInterests& outInterests ) const
+    {
+        outInterests.Includes<GraphComponent>();
+        return true;
+    }
+
     void AnimationWorldSystem::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
     {
         if ( auto pGraphComponent = TryCast<GraphComponent>( pComponent ) )
         {
             m_graphComponents.Add( pGraphComponent );
+
+            #if EE_DEVELOPMENT_TOOLS
+            if ( m_isGraphProfilingEnabled )
+            {
+                pGraphComponent->SetGraphProfiler( &m_graphProfiler );
+            }
+            #endif
         }
     }
 
@@ -24,10 +37,33 @@ namespace EE::Animation
     {
         if ( auto pGraphComponent = TryCast<GraphComponent>( pComponent ) )
         {
+            #if EE_DEVELOPMENT_TOOLS
+            pGraphComponent->SetGraphProfiler( nullptr );
+            #endif
+
             m_graphComponents.Remove( pGraphComponent->GetID() );
         }
     }
 
+    bool AnimationWorldSystem::GetUpdateDependencies( UpdateStage stage, WorldSystemUpdateDependencies& outDependencies ) const
+    {
+        outDependencies.Reads<GraphComponent>();
+        return true;
+    }
+
+    #if EE_DEVELOPMENT_TOOLS
+    void AnimationWorldSystem::SetGraphProfilingEnabled( bool isEnabled )
+    {
+        m_isGraphProfilingEnabled = isEnabled;
+
+        GraphProfiler* pProfiler = m_isGraphProfilingEnabled ? &m_graphProfiler : nullptr;
+        for ( auto pComponent : m_graphComponents )
+        {
+            pComponent->SetGraphProfiler( pProfiler );
+        }
+    }
+    #endif
+
     void AnimationWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         #if EE_DEVELOPMENT_TOOLS
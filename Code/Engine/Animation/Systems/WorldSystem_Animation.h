@@ -2,6 +2,7 @@
 
 #include "Engine/_Module/API.h"
 #include "Engine/Entity/EntityWorldSystem.h"
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_Profiler.h"
 #include "Base/Types/IDVector.h"
 
 //-------------------------------------------------------------------------
@@ -22,17 +23,29 @@ namespace EE::Animation
 
         #if EE_DEVELOPMENT_TOOLS
         inline TVector<GraphComponent*> const& GetRegisteredGraphComponents() const { return m_graphComponents.GetVector(); }
+
+        // Graph profiling - records the costs of all registered graphs into a single profiler
+        inline bool IsGraphProfilingEnabled() const { return m_isGraphProfilingEnabled; }
+        void SetGraphProfilingEnabled( bool isEnabled );
+        inline GraphProfiler& GetGraphProfiler() { return m_graphProfiler; }
         #endif
 
     private:
 
         virtual void ShutdownSystem() override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual bool GetComponentInterests( WorldSystemComponentInterests& outInterests ) const override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual bool GetUpdateDependencies( UpdateStage stage, WorldSystemUpdateDependencies& outDependencies ) const override;
 
     private:
 
         TIDVector<ComponentID, GraphComponent*>          m_graphComponents;
+
+        #if EE_DEVELOPMENT_TOOLS
+        GraphProfiler                                   m_graphProfiler;
+        bool                                            m_isGraphProfilingEnabled = false;
+        #endif
     };
 } 
\ No newline at end of file
@@ -22,14 +22,25 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
-    PoseBufferPool::PoseBufferPool( Skeleton const* pSkeleton )
+    PoseBufferPool::PoseBufferPool( Skeleton const* pSkeleton, PoseBufferStorage* pStorage )
         : m_pSkeleton( pSkeleton )
+        , m_pStorage( pStorage )
     {
         EE_ASSERT( m_pSkeleton != nullptr );
 
+        if ( m_pStorage == nullptr )
+        {
+            m_pOwnedStorage = EE::New<PoseBufferStorage>( m_pSkeleton );
+            m_pStorage = m_pOwnedStorage;
+        }
+
+        EE_ASSERT( m_pStorage->GetSkeleton() == m_pSkeleton );
+
+        // Pose buffers are borrowed from the storage on demand, so we only reserve the slots
+        m_poseBuffers.resize( s_numInitialBuffers, nullptr );
+
         for ( auto i = 0; i < s_numInitialBuffers; i++ )
         {
-            m_poseBuffers.emplace_back( PoseBuffer( m_pSkeleton ) );
             m_cachedBuffers.emplace_back( CachedPoseBuffer( m_pSkeleton ) );
 
             #if EE_DEVELOPMENT_TOOLS
@@ -42,14 +53,20 @@ namespace EE::Animation
     PoseBufferPool::~PoseBufferPool()
     {
         Reset();
+        EE::Delete( m_pOwnedStorage );
     }
 
     void PoseBufferPool::Reset()
     {
-        // Reset all buffers
-        for ( auto& poseBuffer : m_poseBuffers )
+        // Return all buffers that are still in use
+        for ( auto& pPoseBuffer : m_poseBuffers )
         {
-            poseBuffer.Reset();
+            if ( pPoseBuffer != nullptr )
+            {
+                pPoseBuffer->Reset();
+                m_pStorage->Release( pPoseBuffer );
+                pPoseBuffer = nullptr;
+            }
         }
 
         m_firstFreeBuffer = 0;
@@ -71,6 +88,8 @@ namespace EE::Animation
         #if EE_DEVELOPMENT_TOOLS
         m_firstFreeDebugBuffer = 0;
         for ( auto& taskIdx : m_debugBufferTaskIdxMapping ) { taskIdx = InvalidIndex; }
+        m_numUsedBuffers = 0;
+        m_peakNumUsedBuffers = 0;
         #endif
     }
 
@@ -80,20 +99,29 @@ namespace EE::Animation
         {
             for ( auto i = 0; i < s_bufferGrowAmount; i++ )
             {
-                m_poseBuffers.emplace_back( PoseBuffer( m_pSkeleton ) );
+                m_poseBuffers.emplace_back( nullptr );
             }
-            EE_ASSERT( m_poseBuffers.size() < 255 );
+            EE_ASSERT( m_poseBuffers.size() < 127 );
         }
 
         int8_t const freeBufferIdx = m_firstFreeBuffer;
-        EE_ASSERT( !m_poseBuffers[freeBufferIdx].m_isUsed );
-        m_poseBuffers[freeBufferIdx].m_isUsed = true;
+        EE_ASSERT( m_poseBuffers[freeBufferIdx] == nullptr );
+
+        PoseBuffer* pPoseBuffer = m_pStorage->Acquire();
+        EE_ASSERT( !pPoseBuffer->m_isUsed );
+        pPoseBuffer->m_isUsed = true;
+        m_poseBuffers[freeBufferIdx] = pPoseBuffer;
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_numUsedBuffers++;
+        m_peakNumUsedBuffers = Math::Max( m_peakNumUsedBuffers, m_numUsedBuffers );
+        #endif
 
         // Update free index
         int8_t const numPoseBuffers = (int8_t) m_poseBuffers.size();
         for ( ; m_firstFreeBuffer < numPoseBuffers; m_firstFreeBuffer++ )
         {
-            if ( !m_poseBuffers[m_firstFreeBuffer].m_isUsed )
+            if ( m_poseBuffers[m_firstFreeBuffer] == nullptr )
             {
                 break;
             }
@@ -104,11 +132,45 @@ namespace EE::Animation
 
     void PoseBufferPool::ReleasePoseBuffer( int8_t bufferIdx )
     {
-        EE_ASSERT( m_poseBuffers[bufferIdx].m_isUsed );
-        m_poseBuffers[bufferIdx].m_isUsed = false;
+        PoseBuffer* pPoseBuffer = m_poseBuffers[bufferIdx];
+        EE_ASSERT( pPoseBuffer != nullptr && pPoseBuffer->m_isUsed );
+        pPoseBuffer->Reset();
+        m_pStorage->Release( pPoseBuffer );
+        m_poseBuffers[bufferIdx] = nullptr;
         m_firstFreeBuffer = Math::Min( bufferIdx, m_firstFreeBuffer );
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_numUsedBuffers--;
+        #endif
     }
 
+    size_t PoseBufferPool::GetMemoryUsage() const
+    {
+        size_t memoryUsage = m_poseBuffers.capacity() * sizeof( PoseBuffer* );
+
+        for ( auto const& cachedBuffer : m_cachedBuffers )
+        {
+            memoryUsage += cachedBuffer.GetMemoryUsage();
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        for ( auto const& debugBuffer : m_debugBuffers )
+        {
+            memoryUsage += debugBuffer.GetMemoryUsage();
+        }
+        #endif
+
+        // An unshared storage is exclusively ours
+        if ( m_pOwnedStorage != nullptr )
+        {
+            memoryUsage += sizeof( PoseBufferStorage ) + m_pOwnedStorage->GetMemoryUsage();
+        }
+
+        return memoryUsage;
+    }
+
+    //-------------------------------------------------------------------------
+
     UUID PoseBufferPool::CreateCachedPoseBuffer()
     {
         CachedPoseBuffer* pCachedPoseBuffer = nullptr;
@@ -219,8 +281,8 @@ namespace EE::Animation
             EE_ASSERT( m_debugBuffers.size() < 255 );
         }
 
-        EE_ASSERT( m_poseBuffers[poseBufferIdx].m_isUsed );
-        m_debugBuffers[m_firstFreeDebugBuffer].CopyFrom( m_poseBuffers[poseBufferIdx].m_pose );
+        EE_ASSERT( m_poseBuffers[poseBufferIdx] != nullptr && m_poseBuffers[poseBufferIdx]->m_isUsed );
+        m_debugBuffers[m_firstFreeDebugBuffer].CopyFrom( m_poseBuffers[poseBufferIdx]->m_pose );
         m_debugBufferTaskIdxMapping[m_firstFreeDebugBuffer] = taskIdx;
         m_firstFreeDebugBuffer++;
     }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Animation/AnimationPose.h"
+#include "Engine/Animation/AnimationSharedStorage.h"
 
 //-------------------------------------------------------------------------
 
@@ -19,6 +20,8 @@ namespace EE::Animation
         void CopyFrom( PoseBuffer const& RHS );
         inline void CopyFrom( PoseBuffer const* RHS ) { CopyFrom( *RHS ); }
 
+        inline size_t GetMemoryUsage() const { return sizeof( PoseBuffer ) - sizeof( Pose ) + m_pose.GetMemoryUsage(); }
+
     public:
 
         Pose								m_pose;
@@ -53,6 +56,8 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
+    // Pose buffers are borrowed from a shared storage when requested and returned as soon as they are released
+    // Cached pose buffers persist across updates so they are still owned by the pool
     class EE_ENGINE_API PoseBufferPool
     {
         constexpr static int8_t const s_numInitialBuffers = 6;
@@ -60,7 +65,8 @@ namespace EE::Animation
 
     public:
 
-        PoseBufferPool( Skeleton const* pSkeleton );
+        // If no storage is supplied, the pool will create its own (unshared) storage
+        PoseBufferPool( Skeleton const* pSkeleton, PoseBufferStorage* pStorage = nullptr );
         PoseBufferPool( PoseBufferPool const& ) = delete;
         ~PoseBufferPool();
 
@@ -76,10 +82,16 @@ namespace EE::Animation
 
         inline PoseBuffer* GetBuffer( int8_t bufferIdx )
         {
-            EE_ASSERT( m_poseBuffers[bufferIdx].m_isUsed );
-            return &m_poseBuffers[bufferIdx];
+            EE_ASSERT( m_poseBuffers[bufferIdx] != nullptr && m_poseBuffers[bufferIdx]->m_isUsed );
+            return m_poseBuffers[bufferIdx];
         }
 
+        inline PoseBufferStorage const* GetStorage() const { return m_pStorage; }
+        inline bool IsUsingSharedStorage() const { return m_pOwnedStorage == nullptr; }
+
+        // Get the memory exclusively owned by this pool (i.e. not including the shared storage)
+        size_t GetMemoryUsage() const;
+
         // Cached Poses
         //-------------------------------------------------------------------------
 
@@ -97,12 +109,20 @@ namespace EE::Animation
         inline bool HasRecordedData() const { return m_firstFreeDebugBuffer != 0; }
         void RecordPose( int8_t taskIdx, int8_t poseBufferIdx );
         Pose const* GetRecordedPoseForTask( int8_t taskIdx ) const;
+
+        // Get the number of pose buffers currently allocated in the storage we borrow from
+        inline int32_t GetNumAllocatedPoseBuffers() const { return m_pStorage->GetNumAllocatedItems(); }
+
+        // Get the max number of pose buffers that were in use at the same time since the last reset
+        inline int32_t GetPeakNumUsedPoseBuffers() const { return m_peakNumUsedBuffers; }
         #endif
 
     private:
 
         Skeleton const*                             m_pSkeleton = nullptr;
-        TInlineVector<PoseBuffer, 10>               m_poseBuffers;
+        PoseBufferStorage*                          m_pStorage = nullptr;
+        PoseBufferStorage*                          m_pOwnedStorage = nullptr;
+        TInlineVector<PoseBuffer*, 10>              m_poseBuffers;              // Borrowed buffers, null entries are free slots
         TInlineVector<CachedPoseBuffer, 10>         m_cachedBuffers;
         TInlineVector<UUID, 5>                      m_cachedPoseBuffersToDestroy;
         int8_t                                      m_firstFreeCachedBuffer = 0;
@@ -112,6 +132,8 @@ namespace EE::Animation
         TVector<Pose>                               m_debugBuffers;
         TVector<int8_t>                             m_debugBufferTaskIdxMapping; // The task index for each debug buffer
         int8_t                                      m_firstFreeDebugBuffer = 0;
+        int8_t                                      m_numUsedBuffers = 0;
+        int8_t                                      m_peakNumUsedBuffers = 0;
         mutable bool                                m_isDebugRecordingEnabled = false;
         #endif
     };
@@ -25,11 +25,18 @@ namespace EE::Animation
         WriteUInt( numTasksToSerialize, m_maxBitsForDependencies );
     }
 
-    TaskSerializer::TaskSerializer( Skeleton const* pSkeleton, TInlineVector<ResourceLUT const*, 10> const& LUTs, Blob const& inData )
+    TaskSerializer::TaskSerializer( Skeleton const* pSkeleton, TInlineVector<ResourceLUT const*, 10> const& LUTs, Blob const& inData, TVector<uint32_t> const* pResourceTable )
         : BitArchive<1280>( inData )
         , m_LUTs( LUTs )
     {
-        GenerateResourceMappings();
+        if ( pResourceTable != nullptr )
+        {
+            SetResourceMappings( *pResourceTable );
+        }
+        else
+        {
+            GenerateResourceMappings();
+        }
 
         m_maxBitsForDependencies = (uint8_t) ReadUInt( 4 );
         EE_ASSERT( m_maxBitsForDependencies <= 8 );
@@ -67,6 +74,32 @@ namespace EE::Animation
         EE_ASSERT( m_maxBitsForResourceIDs > 0 && m_maxBitsForResourceIDs <= 16 );
     }
 
+    void TaskSerializer::SetResourceMappings( TVector<uint32_t> const& resourceTable )
+    {
+        m_resourceIDToIdxMap.clear();
+        m_resourceIdxToIDMap.clear();
+
+        uint32_t const numResources = (uint32_t) resourceTable.size();
+        for ( uint32_t resourceIdx = 0; resourceIdx < numResources; resourceIdx++ )
+        {
+            m_resourceIDToIdxMap.insert( TPair<uint32_t, uint32_t>( resourceTable[resourceIdx], resourceIdx ) );
+            m_resourceIdxToIDMap.insert( TPair<uint32_t, uint32_t>( resourceIdx, resourceTable[resourceIdx] ) );
+        }
+
+        m_maxBitsForResourceIDs = Math::GetMostSignificantBit( numResources ) + 1;
+        EE_ASSERT( m_maxBitsForResourceIDs > 0 && m_maxBitsForResourceIDs <= 16 );
+    }
+
+    void TaskSerializer::GetResourceTable( TVector<uint32_t>& outResourceTable ) const
+    {
+        uint32_t const numResources = (uint32_t) m_resourceIdxToIDMap.size();
+        outResourceTable.resize( numResources );
+        for ( uint32_t resourceIdx = 0; resourceIdx < numResources; resourceIdx++ )
+        {
+            outResourceTable[resourceIdx] = m_resourceIdxToIDMap.at( resourceIdx );
+        }
+    }
+
     //-------------------------------------------------------------------------
 
     void TaskSerializer::WriteDependencyIndex( int8_t index )
@@ -15,6 +15,28 @@ namespace EE::Animation
 
     using ResourceLUT = THashMap<uint32_t, Resource::ResourcePtr>;
 
+    //-------------------------------------------------------------------------
+
+    // Describes the layout of a serialized task list, this is needed to delta compress task lists against one another
+    // The stream is split into segments: the first segment contains the header and task types, followed by one segment per task
+    struct SerializedTaskListLayout
+    {
+        inline int32_t GetNumSegments() const { return (int32_t) m_segmentBitOffsets.size() - 1; }
+        inline uint32_t GetSegmentStart( int32_t segmentIdx ) const { return m_segmentBitOffsets[segmentIdx]; }
+        inline uint32_t GetSegmentLength( int32_t segmentIdx ) const { return m_segmentBitOffsets[segmentIdx + 1] - m_segmentBitOffsets[segmentIdx]; }
+
+        inline void Clear()
+        {
+            m_segmentBitOffsets.clear();
+            m_resourceTable.clear();
+        }
+
+    public:
+
+        TInlineVector<uint16_t, 32>                                 m_segmentBitOffsets; // The start bit of each segment followed by the total number of bits
+        TVector<uint32_t>                                           m_resourceTable; // The resource path IDs in serialized index order
+    };
+
     // Single use serializer!
     //-------------------------------------------------------------------------
 
@@ -24,7 +46,7 @@ namespace EE::Animation
     public:
 
         TaskSerializer( Skeleton const* pSkeleton, TInlineVector<ResourceLUT const*, 10> const& LUTs, uint8_t numTasksToSerialize );
-        TaskSerializer( Skeleton const* pSkeleton, TInlineVector<ResourceLUT const*, 10> const& LUTs, Blob const& inData );
+        TaskSerializer( Skeleton const* pSkeleton, TInlineVector<ResourceLUT const*, 10> const& LUTs, Blob const& inData, TVector<uint32_t> const* pResourceTable = nullptr );
 
         // Get the number of serialized task in the provided blob
         uint8_t GetNumSerializedTasks() const { EE_ASSERT( IsReading() ); return m_numSerializedTasks; }
@@ -32,12 +54,14 @@ namespace EE::Animation
         // Get the number of bits to use for bone mask indices
         uint32_t GetMaxBitsForBoneMaskIndex() const { return m_maxBitsForBoneMask; }
 
+        // Get the resource path IDs in serialized index order, this needs to be replicated if the LUTs differ between the writer and the reader
+        void GetResourceTable( TVector<uint32_t>& outResourceTable ) const;
+
         // Serialization
         //-------------------------------------------------------------------------
 
         // Writes out a resource ptr
-        // NOTE: This is not a robust solution as it does not take into account for external graphs being injected at runtime
-        // We should replicate all LUT changes and update the serializer tables
+        // NOTE: Indices are only valid for this serializer's resource table, if the reader's LUTs may differ (i.e. external graphs were injected), replicate the table
         template<typename T>
         void WriteResourcePtr( T const* pResource )
         {
@@ -52,8 +76,7 @@ namespace EE::Animation
         //-------------------------------------------------------------------------
 
         // Read back a resource ptr
-        // NOTE: This is not a robust solution as it does not take into account for external graphs being injected at runtime
-        // We should replicate all LUT changes and update the serializer tables
+        // NOTE: If a replicated resource table was provided, the resource still needs to be present in one of the reader's LUTs
         template<typename T>
         T const* ReadResourcePtr()
         {
@@ -87,6 +110,7 @@ namespace EE::Animation
     private:
 
         void GenerateResourceMappings();
+        void SetResourceMappings( TVector<uint32_t> const& resourceTable );
 
     private:
 
@@ -0,0 +1,434 @@
+#include "Animation_TaskStream.h"
+#include "Base/Serialization/BitSerialization.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    using PacketArchive = Serialization::BitArchive<TaskStream::s_maxPacketBits>;
+    using TaskDataArchive = Serialization::BitArchive<1280>; // Needs to match the task serializer
+
+    constexpr static uint32_t const g_maxBitsForSequence = 16;
+    constexpr static uint32_t const g_maxBitsForSegmentCount = 9; // 255 tasks + the header segment
+    constexpr static uint32_t const g_maxBitsForSegmentLength = 14; // Segments can span the whole task data, leave headroom for larger task archives
+    constexpr static uint32_t const g_maxBitsForResourceCount = 16;
+    constexpr static uint32_t const g_maxBitsForResourceID = 32;
+    constexpr static uint32_t const g_patchWordSize = 8;
+
+    //-------------------------------------------------------------------------
+
+    // Is sequence A more recent than sequence B, handles wrap around
+    static inline bool IsNewerSequence( TaskStreamSequence a, TaskStreamSequence b )
+    {
+        return (int16_t) ( a - b ) > 0;
+    }
+
+    // A range of bits within a serialized task list
+    struct Segment
+    {
+        Segment( Blob const& data, SerializedTaskListLayout const& layout, int32_t segmentIdx )
+            : m_data( data )
+            , m_startBit( layout.GetSegmentStart( segmentIdx ) )
+            , m_numBits( layout.GetSegmentLength( segmentIdx ) )
+        {}
+
+        inline bool GetBit( uint32_t bitIdx ) const
+        {
+            EE_ASSERT( bitIdx < m_numBits );
+            uint32_t const dataBitIdx = m_startBit + bitIdx;
+            return ( m_data[dataBitIdx >> 3] >> ( dataBitIdx & 7 ) ) & 1;
+        }
+
+        inline uint32_t GetNumPatchWords() const { return ( m_numBits + g_patchWordSize - 1 ) / g_patchWordSize; }
+
+        inline uint32_t GetPatchWordLength( uint32_t wordIdx ) const { return Math::Min( g_patchWordSize, m_numBits - ( wordIdx * g_patchWordSize ) ); }
+
+    public:
+
+        Blob const&                             m_data;
+        uint32_t                                m_startBit = 0;
+        uint32_t                                m_numBits = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    static bool AreBitRangesEqual( Segment const& a, Segment const& b, uint32_t startBit, uint32_t numBits )
+    {
+        for ( uint32_t i = startBit; i < startBit + numBits; i++ )
+        {
+            if ( a.GetBit( i ) != b.GetBit( i ) )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static bool AreSegmentsEqual( Segment const& a, Segment const& b )
+    {
+        if ( a.m_numBits != b.m_numBits )
+        {
+            return false;
+        }
+
+        return AreBitRangesEqual( a, b, 0, a.m_numBits );
+    }
+
+    // Returns the number of bits needed to patch the baseline segment into the new segment
+    static uint32_t CalculatePatchCost( Segment const& segment, Segment const& baselineSegment )
+    {
+        EE_ASSERT( segment.m_numBits == baselineSegment.m_numBits );
+
+        uint32_t const numWords = segment.GetNumPatchWords();
+        uint32_t cost = numWords; // One mask bit per word
+        for ( uint32_t w = 0; w < numWords; w++ )
+        {
+            uint32_t const wordLength = segment.GetPatchWordLength( w );
+            if ( !AreBitRangesEqual( segment, baselineSegment, w * g_patchWordSize, wordLength ) )
+            {
+                cost += wordLength;
+            }
+        }
+
+        return cost;
+    }
+
+    //-------------------------------------------------------------------------
+
+    static void WriteResourceTable( PacketArchive& archive, TVector<uint32_t> const& resourceTable, TaskStream::Frame const* pBaseline )
+    {
+        TVector<uint32_t> const* pBaselineTable = ( pBaseline != nullptr ) ? &pBaseline->m_layout.m_resourceTable : nullptr;
+
+        bool const isUnchanged = pBaselineTable != nullptr && *pBaselineTable == resourceTable;
+        archive.WriteBool( isUnchanged );
+        if ( isUnchanged )
+        {
+            return;
+        }
+
+        // Tables usually only grow (i.e. external graphs being injected) so try to only send the new entries
+        uint32_t numSharedEntries = 0;
+        if ( pBaselineTable != nullptr && pBaselineTable->size() <= resourceTable.size() && eastl::equal( pBaselineTable->begin(), pBaselineTable->end(), resourceTable.begin() ) )
+        {
+            numSharedEntries = (uint32_t) pBaselineTable->size();
+        }
+
+        uint32_t const numResources = (uint32_t) resourceTable.size();
+        archive.WriteBool( numSharedEntries > 0 );
+        archive.WriteUInt( numResources - numSharedEntries, g_maxBitsForResourceCount );
+        for ( uint32_t i = numSharedEntries; i < numResources; i++ )
+        {
+            archive.WriteUInt( resourceTable[i], g_maxBitsForResourceID );
+        }
+    }
+
+    static void ReadResourceTable( PacketArchive& archive, TaskStream::Frame const* pBaseline, TVector<uint32_t>& outResourceTable )
+    {
+        bool const isUnchanged = archive.ReadBool();
+        if ( isUnchanged )
+        {
+            EE_ASSERT( pBaseline != nullptr );
+            outResourceTable = pBaseline->m_layout.m_resourceTable;
+            return;
+        }
+
+        bool const isAppended = archive.ReadBool();
+        if ( isAppended )
+        {
+            EE_ASSERT( pBaseline != nullptr );
+            outResourceTable = pBaseline->m_layout.m_resourceTable;
+        }
+        else
+        {
+            outResourceTable.clear();
+        }
+
+        uint32_t const numNewEntries = archive.ReadUInt( g_maxBitsForResourceCount );
+        outResourceTable.reserve( outResourceTable.size() + numNewEntries );
+        for ( uint32_t i = 0; i < numNewEntries; i++ )
+        {
+            outResourceTable.emplace_back( archive.ReadUInt( g_maxBitsForResourceID ) );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Encoder
+    //-------------------------------------------------------------------------
+
+    void TaskStreamEncoder::Reset()
+    {
+        for ( auto& frame : m_history )
+        {
+            frame = TaskStream::Frame();
+        }
+
+        m_nextSequence = 0;
+    }
+
+    void TaskStreamEncoder::AcknowledgeFrame( TaskStreamSequence sequence )
+    {
+        auto& frame = m_history[sequence % TaskStream::s_historySize];
+
+        // Ignore acks for frames that have already left the history window
+        if ( frame.m_isValid && frame.m_sequence == sequence )
+        {
+            frame.m_isAcknowledged = true;
+        }
+    }
+
+    TaskStream::Frame const* TaskStreamEncoder::FindBaseline( TaskStreamSequence sequence ) const
+    {
+        TaskStream::Frame const* pBaseline = nullptr;
+
+        for ( auto const& frame : m_history )
+        {
+            if ( !frame.m_isValid || !frame.m_isAcknowledged )
+            {
+                continue;
+            }
+
+            // Only frames within the history window are guaranteed to still be available on the receiver
+            TaskStreamSequence const age = TaskStreamSequence( sequence - frame.m_sequence );
+            if ( age == 0 || age >= TaskStream::s_historySize )
+            {
+                continue;
+            }
+
+            if ( pBaseline == nullptr || IsNewerSequence( frame.m_sequence, pBaseline->m_sequence ) )
+            {
+                pBaseline = &frame;
+            }
+        }
+
+        return pBaseline;
+    }
+
+    TaskStreamSequence TaskStreamEncoder::EncodeFrame( Blob const& taskData, SerializedTaskListLayout const& layout, Blob& outPacket )
+    {
+        EE_PROFILE_FUNCTION_ANIMATION();
+
+        int32_t const numSegments = layout.GetNumSegments();
+        EE_ASSERT( numSegments > 0 && numSegments < ( 1 << g_maxBitsForSegmentCount ) );
+
+        TaskStreamSequence const sequence = m_nextSequence++;
+        TaskStream::Frame const* pBaseline = FindBaseline( sequence );
+
+        // Header
+        //-------------------------------------------------------------------------
+
+        PacketArchive archive;
+        archive.WriteUInt( sequence, g_maxBitsForSequence );
+        archive.WriteBool( pBaseline != nullptr );
+        if ( pBaseline != nullptr )
+        {
+            archive.WriteUInt( pBaseline->m_sequence, g_maxBitsForSequence );
+        }
+
+        WriteResourceTable( archive, layout.m_resourceTable, pBaseline );
+
+        // Segments
+        //-------------------------------------------------------------------------
+
+        archive.WriteUInt( numSegments, g_maxBitsForSegmentCount );
+
+        int32_t const numBaselineSegments = ( pBaseline != nullptr ) ? pBaseline->m_layout.GetNumSegments() : 0;
+        for ( int32_t i = 0; i < numSegments; i++ )
+        {
+            Segment const segment( taskData, layout, i );
+
+            if ( i < numBaselineSegments )
+            {
+                Segment const baselineSegment( pBaseline->m_data, pBaseline->m_layout, i );
+
+                // Unchanged
+                bool const isUnchanged = AreSegmentsEqual( segment, baselineSegment );
+                archive.WriteBool( isUnchanged );
+                if ( isUnchanged )
+                {
+                    continue;
+                }
+
+                // Patch - only send the changed words if that is cheaper than sending the whole segment
+                bool const shouldPatch = ( segment.m_numBits == baselineSegment.m_numBits ) && ( CalculatePatchCost( segment, baselineSegment ) < ( g_maxBitsForSegmentLength + segment.m_numBits ) );
+                archive.WriteBool( shouldPatch );
+                if ( shouldPatch )
+                {
+                    uint32_t const numWords = segment.GetNumPatchWords();
+                    TInlineVector<bool, 64> changedWords;
+                    changedWords.resize( numWords );
+
+                    for ( uint32_t w = 0; w < numWords; w++ )
+                    {
+                        changedWords[w] = !AreBitRangesEqual( segment, baselineSegment, w * g_patchWordSize, segment.GetPatchWordLength( w ) );
+                        archive.WriteBool( changedWords[w] );
+                    }
+
+                    for ( uint32_t w = 0; w < numWords; w++ )
+                    {
+                        if ( changedWords[w] )
+                        {
+                            uint32_t const wordStart = w * g_patchWordSize;
+                            uint32_t const wordLength = segment.GetPatchWordLength( w );
+                            for ( uint32_t b = wordStart; b < wordStart + wordLength; b++ )
+                            {
+                                archive.WriteBool( segment.GetBit( b ) );
+                            }
+                        }
+                    }
+
+                    continue;
+                }
+            }
+
+            // Full
+            archive.WriteUInt( segment.m_numBits, g_maxBitsForSegmentLength );
+            for ( uint32_t b = 0; b < segment.m_numBits; b++ )
+            {
+                archive.WriteBool( segment.GetBit( b ) );
+            }
+        }
+
+        archive.GetWrittenData( outPacket );
+
+        // Record frame so that it can be used as a baseline once acknowledged
+        //-------------------------------------------------------------------------
+
+        auto& frame = m_history[sequence % TaskStream::s_historySize];
+        frame.m_sequence = sequence;
+        frame.m_data = taskData;
+        frame.m_layout = layout;
+        frame.m_isValid = true;
+        frame.m_isAcknowledged = false;
+
+        return sequence;
+    }
+
+    //-------------------------------------------------------------------------
+    // Decoder
+    //-------------------------------------------------------------------------
+
+    void TaskStreamDecoder::Reset()
+    {
+        for ( auto& frame : m_history )
+        {
+            frame = TaskStream::Frame();
+        }
+
+        m_lastDecodedSequence = 0;
+        m_hasDecodedFrame = false;
+    }
+
+    bool TaskStreamDecoder::DecodePacket( Blob const& packet, Blob& outTaskData, TVector<uint32_t>& outResourceTable )
+    {
+        EE_PROFILE_FUNCTION_ANIMATION();
+
+        PacketArchive archive( packet );
+
+        // Header
+        //-------------------------------------------------------------------------
+
+        TaskStreamSequence const sequence = (TaskStreamSequence) archive.ReadUInt( g_maxBitsForSequence );
+
+        // Ignore stale or duplicate packets
+        if ( m_hasDecodedFrame && !IsNewerSequence( sequence, m_lastDecodedSequence ) )
+        {
+            return false;
+        }
+
+        TaskStream::Frame const* pBaseline = nullptr;
+        if ( archive.ReadBool() )
+        {
+            TaskStreamSequence const baselineSequence = (TaskStreamSequence) archive.ReadUInt( g_maxBitsForSequence );
+            auto const& baselineFrame = m_history[baselineSequence % TaskStream::s_historySize];
+            if ( !baselineFrame.m_isValid || baselineFrame.m_sequence != baselineSequence )
+            {
+                return false;
+            }
+
+            pBaseline = &baselineFrame;
+            EE_ASSERT( ( baselineSequence % TaskStream::s_historySize ) != ( sequence % TaskStream::s_historySize ) );
+        }
+
+        TaskStream::Frame decodedFrame;
+        decodedFrame.m_sequence = sequence;
+        ReadResourceTable( archive, pBaseline, decodedFrame.m_layout.m_resourceTable );
+
+        // Reconstruct the task data
+        //-------------------------------------------------------------------------
+
+        TaskDataArchive taskDataArchive;
+
+        int32_t const numSegments = (int32_t) archive.ReadUInt( g_maxBitsForSegmentCount );
+        int32_t const numBaselineSegments = ( pBaseline != nullptr ) ? pBaseline->m_layout.GetNumSegments() : 0;
+        for ( int32_t i = 0; i < numSegments; i++ )
+        {
+            decodedFrame.m_layout.m_segmentBitOffsets.emplace_back( (uint16_t) taskDataArchive.GetBitPosition() );
+
+            if ( i < numBaselineSegments )
+            {
+                Segment const baselineSegment( pBaseline->m_data, pBaseline->m_layout, i );
+
+                // Unchanged
+                if ( archive.ReadBool() )
+                {
+                    for ( uint32_t b = 0; b < baselineSegment.m_numBits; b++ )
+                    {
+                        taskDataArchive.WriteBool( baselineSegment.GetBit( b ) );
+                    }
+
+                    continue;
+                }
+
+                // Patch
+                if ( archive.ReadBool() )
+                {
+                    uint32_t const numWords = baselineSegment.GetNumPatchWords();
+                    TInlineVector<bool, 64> changedWords;
+                    changedWords.resize( numWords );
+
+                    for ( uint32_t w = 0; w < numWords; w++ )
+                    {
+                        changedWords[w] = archive.ReadBool();
+                    }
+
+                    for ( uint32_t w = 0; w < numWords; w++ )
+                    {
+                        uint32_t const wordStart = w * g_patchWordSize;
+                        uint32_t const wordLength = baselineSegment.GetPatchWordLength( w );
+                        for ( uint32_t b = wordStart; b < wordStart + wordLength; b++ )
+                        {
+                            taskDataArchive.WriteBool( changedWords[w] ? archive.ReadBool() : baselineSegment.GetBit( b ) );
+                        }
+                    }
+
+                    continue;
+                }
+            }
+
+            // Full
+            uint32_t const numBits = archive.ReadUInt( g_maxBitsForSegmentLength );
+            for ( uint32_t b = 0; b < numBits; b++ )
+            {
+                taskDataArchive.WriteBool( archive.ReadBool() );
+            }
+        }
+
+        decodedFrame.m_layout.m_segmentBitOffsets.emplace_back( (uint16_t) taskDataArchive.GetBitPosition() );
+        taskDataArchive.GetWrittenData( decodedFrame.m_data );
+
+        // Store the frame so that it can be used as a baseline
+        //-------------------------------------------------------------------------
+
+        outTaskData = decodedFrame.m_data;
+        outResourceTable = decodedFrame.m_layout.m_resourceTable;
+
+        decodedFrame.m_isValid = true;
+        m_history[sequence % TaskStream::s_historySize] = eastl::move( decodedFrame );
+        m_lastDecodedSequence = sequence;
+        m_hasDecodedFrame = true;
+
+        return true;
+    }
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include "Animation_TaskSerializer.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Task Stream Replication
+//-------------------------------------------------------------------------
+// Delta compresses serialized task lists against a baseline frame that the receiver has acknowledged
+//
+// * Each task list is split into segments (header + task types, then one segment per task)
+// * Each segment is either unchanged from the baseline, patched (only the changed bytes are sent) or sent in full
+// * Only acknowledged frames are used as baselines so lost packets never break the stream, if no baseline is available a full frame is sent
+// * The serializer resource table is replicated whenever it changes (i.e. external graphs being injected)
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    using TaskStreamSequence = uint16_t;
+
+    //-------------------------------------------------------------------------
+
+    namespace TaskStream
+    {
+        // How many frames are kept around to be used as baselines
+        constexpr static int32_t const s_historySize = 32;
+
+        // The max size of a single encoded packet
+        constexpr static size_t const s_maxPacketBits = 32768;
+
+        //-------------------------------------------------------------------------
+
+        struct Frame
+        {
+            TaskStreamSequence                  m_sequence = 0;
+            Blob                                m_data;
+            SerializedTaskListLayout            m_layout;
+            bool                                m_isValid = false;
+            bool                                m_isAcknowledged = false;
+        };
+    }
+
+    //-------------------------------------------------------------------------
+    // Sender
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API TaskStreamEncoder
+    {
+    public:
+
+        // Encode a serialized task list into a packet, returns the sequence number assigned to the packet
+        TaskStreamSequence EncodeFrame( Blob const& taskData, SerializedTaskListLayout const& layout, Blob& outPacket );
+
+        // Called whenever the receiver acknowledges a packet, acknowledged frames become candidates for baselines
+        void AcknowledgeFrame( TaskStreamSequence sequence );
+
+        // Clear all history, the next packet will be a full frame
+        void Reset();
+
+    private:
+
+        TaskStream::Frame const* FindBaseline( TaskStreamSequence sequence ) const;
+
+    private:
+
+        TArray<TaskStream::Frame, TaskStream::s_historySize>    m_history;
+        TaskStreamSequence                                      m_nextSequence = 0;
+    };
+
+    //-------------------------------------------------------------------------
+    // Receiver
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API TaskStreamDecoder
+    {
+    public:
+
+        // Decode a packet back into a serialized task list and the resource table needed to deserialize it
+        // Returns false if the packet is stale or if its baseline is no longer available, these packets should not be acknowledged
+        bool DecodePacket( Blob const& packet, Blob& outTaskData, TVector<uint32_t>& outResourceTable );
+
+        // Get the sequence of the most recently decoded packet, this is what the receiver should acknowledge
+        inline TaskStreamSequence GetLastDecodedSequence() const { EE_ASSERT( m_hasDecodedFrame ); return m_lastDecodedSequence; }
+
+        // Have we decoded any packets
+        inline bool HasDecodedFrame() const { return m_hasDecodedFrame; }
+
+        // Clear all history
+        void Reset();
+
+    private:
+
+        TArray<TaskStream::Frame, TaskStream::s_historySize>    m_history;
+        TaskStreamSequence                                      m_lastDecodedSequence = 0;
+        bool                                                    m_hasDecodedFrame = false;
+    };
+}
@@ -1,5 +1,6 @@
 #include "Animation_TaskSystem.h"
 #include "Tasks/Animation_Task_DefaultPose.h"
+#include "Tasks/Animation_Task_Sample.h"
 #include "Engine/Animation/AnimationBlender.h"
 
 #include "Base/Drawing/DebugDrawing.h"
@@ -112,9 +113,9 @@ namespace EE::Animation
 
 namespace EE::Animation
 {
-    TaskSystem::TaskSystem( Skeleton const* pSkeleton )
-        : m_posePool( pSkeleton )
-        , m_boneMaskPool( pSkeleton )
+    TaskSystem::TaskSystem( Skeleton const* pSkeleton, PoseBufferStorage* pPoseBufferStorage, BoneMaskStorage* pBoneMaskStorage )
+        : m_posePool( pSkeleton, pPoseBufferStorage )
+        , m_boneMaskPool( pSkeleton, pBoneMaskStorage )
         , m_taskContext( m_posePool, m_boneMaskPool )
         , m_finalPose( pSkeleton )
     {
@@ -192,6 +193,7 @@ namespace EE::Animation
 
         #if EE_DEVELOPMENT_TOOLS
         m_boneMaskPool.PerformValidation();
+        m_profile.Reset();
         #endif
 
         m_taskContext.m_currentTaskIdx = InvalidIndex;
@@ -233,17 +235,7 @@ namespace EE::Animation
             {
                 for ( TaskIndex prePhysicsTaskIdx : m_prePhysicsTaskIndices )
                 {
-                    m_taskContext.m_currentTaskIdx = prePhysicsTaskIdx;
-
-                    // Set dependencies
-                    m_taskContext.m_dependencies.clear();
-                    for ( auto depTaskIdx : m_tasks[prePhysicsTaskIdx]->GetDependencyIndices() )
-                    {
-                        EE_ASSERT( m_tasks[depTaskIdx]->IsComplete() );
-                        m_taskContext.m_dependencies.emplace_back( m_tasks[depTaskIdx] );
-                    }
-
-                    m_tasks[prePhysicsTaskIdx]->Execute( m_taskContext );
+                    ExecuteTask( prePhysicsTaskIdx );
                 }
             }
         }
@@ -303,6 +295,46 @@ namespace EE::Animation
         {
             m_finalPose.Reset( Pose::Type::ReferencePose, true );
         }
+
+        #if EE_DEVELOPMENT_TOOLS
+        if ( m_isProfilingEnabled )
+        {
+            m_profile.m_peakPoseBuffersUsed = m_posePool.GetPeakNumUsedPoseBuffers();
+            m_profile.m_numPoseBuffersAllocated = m_posePool.GetNumAllocatedPoseBuffers();
+        }
+        #endif
+    }
+
+    void TaskSystem::ExecuteTask( TaskIndex taskIdx )
+    {
+        Task* pTask = m_tasks[taskIdx];
+        m_taskContext.m_currentTaskIdx = taskIdx;
+
+        // Set dependencies
+        m_taskContext.m_dependencies.clear();
+        for ( auto depTaskIdx : pTask->GetDependencyIndices() )
+        {
+            EE_ASSERT( m_tasks[depTaskIdx]->IsComplete() );
+            m_taskContext.m_dependencies.emplace_back( m_tasks[depTaskIdx] );
+        }
+
+        // Execute task
+        #if EE_DEVELOPMENT_TOOLS
+        if ( m_isProfilingEnabled )
+        {
+            uint64_t const startTime = PlatformClock::GetTime();
+            pTask->Execute( m_taskContext );
+            m_profile.RecordTaskExecution( pTask->GetTypeInfo(), uint64_t( PlatformClock::GetTime() ) - startTime );
+
+            if ( pTask->GetTypeID() == Tasks::SampleTask::GetStaticTypeID() )
+            {
+                m_profile.m_numSampledClips++;
+            }
+            return;
+        }
+        #endif
+
+        pTask->Execute( m_taskContext );
     }
 
     void TaskSystem::ExecuteTasks()
@@ -312,18 +344,7 @@ namespace EE::Animation
         {
             if ( !m_tasks[i]->IsComplete() )
             {
-                m_taskContext.m_currentTaskIdx = i;
-
-                // Set dependencies
-                m_taskContext.m_dependencies.clear();
-                for ( auto DepTaskIdx : m_tasks[i]->GetDependencyIndices() )
-                {
-                    EE_ASSERT( m_tasks[DepTaskIdx]->IsComplete() );
-                    m_taskContext.m_dependencies.emplace_back( m_tasks[DepTaskIdx] );
-                }
-
-                // Execute task
-                m_tasks[i]->Execute( m_taskContext );
+                ExecuteTask( i );
             }
         }
 
@@ -348,7 +369,7 @@ namespace EE::Animation
         m_serializationEnabled = false;
     }
 
-    bool TaskSystem::SerializeTasks( TInlineVector<ResourceLUT const*, 10> const& LUTs, Blob& outSerializedData ) const
+    bool TaskSystem::SerializeTasks( TInlineVector<ResourceLUT const*, 10> const& LUTs, Blob& outSerializedData, SerializedTaskListLayout* pOutLayout ) const
     {
         auto FindTaskTypeID = [this] ( TypeSystem::TypeID typeID )
         {
@@ -372,6 +393,12 @@ namespace EE::Animation
         uint8_t const numTasks = (uint8_t) m_tasks.size();
         TaskSerializer serializer( GetSkeleton(), LUTs, numTasks );
 
+        if ( pOutLayout != nullptr )
+        {
+            pOutLayout->Clear();
+            pOutLayout->m_segmentBitOffsets.emplace_back( (uint16_t) 0 );
+        }
+
         // Serialize task types
         for ( auto pTask : m_tasks )
         {
@@ -389,21 +416,32 @@ namespace EE::Animation
                 return false;
             }
 
+            if ( pOutLayout != nullptr )
+            {
+                pOutLayout->m_segmentBitOffsets.emplace_back( (uint16_t) serializer.GetBitPosition() );
+            }
+
             pTask->Serialize( serializer );
         }
 
         serializer.GetWrittenData( outSerializedData );
 
+        if ( pOutLayout != nullptr )
+        {
+            pOutLayout->m_segmentBitOffsets.emplace_back( (uint16_t) serializer.GetBitPosition() );
+            serializer.GetResourceTable( pOutLayout->m_resourceTable );
+        }
+
         return true;
     }
 
-    void TaskSystem::DeserializeTasks( TInlineVector<ResourceLUT const*, 10> const& LUTs, Blob const& inSerializedData )
+    void TaskSystem::DeserializeTasks( TInlineVector<ResourceLUT const*, 10> const& LUTs, Blob const& inSerializedData, TVector<uint32_t> const* pResourceTable )
     {
         EE_ASSERT( m_serializationEnabled );
         EE_ASSERT( m_tasks.empty() );
         EE_ASSERT( !m_needsUpdate );
 
-        TaskSerializer serializer( GetSkeleton(), LUTs, inSerializedData );
+        TaskSerializer serializer( GetSkeleton(), LUTs, inSerializedData, pResourceTable );
         uint8_t const numTasks = serializer.GetNumSerializedTasks();
 
         // Create tasks
@@ -425,6 +463,32 @@ namespace EE::Animation
     //-------------------------------------------------------------------------
 
     #if EE_DEVELOPMENT_TOOLS
+    size_t TaskSystem::GetMemoryUsage() const
+    {
+        size_t memoryUsage = sizeof( TaskSystem ) + m_tasks.capacity() * sizeof( Task* );
+        memoryUsage += m_finalPose.GetMemoryUsage() - sizeof( Pose );
+        memoryUsage += m_posePool.GetMemoryUsage();
+        memoryUsage += m_boneMaskPool.GetMemoryUsage();
+        return memoryUsage;
+    }
+
+    size_t TaskSystem::GetSharedStorageMemoryUsage() const
+    {
+        size_t memoryUsage = 0;
+
+        if ( m_posePool.IsUsingSharedStorage() )
+        {
+            memoryUsage += m_posePool.GetStorage()->GetMemoryUsage();
+        }
+
+        if ( m_boneMaskPool.IsUsingSharedStorage() )
+        {
+            memoryUsage += m_boneMaskPool.GetStorage()->GetMemoryUsage();
+        }
+
+        return memoryUsage;
+    }
+
     void TaskSystem::SetDebugMode( TaskSystemDebugMode mode )
     {
         m_debugMode = mode;
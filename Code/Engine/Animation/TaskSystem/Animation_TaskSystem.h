@@ -3,6 +3,7 @@
 #include "Animation_Task.h"
 #include "Animation_TaskSerializer.h"
 #include "Engine/Animation/AnimationBoneMask.h"
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_Profiler.h"
 
 //-------------------------------------------------------------------------
 
@@ -34,7 +35,9 @@ namespace EE::Animation
 
     public:
 
-        TaskSystem( Skeleton const* pSkeleton );
+        // Pose buffers and bone masks are borrowed from the supplied storage, this allows multiple task systems to share a single peak-sized storage
+        // If no storage is supplied, the task system will create its own
+        TaskSystem( Skeleton const* pSkeleton, PoseBufferStorage* pPoseBufferStorage = nullptr, BoneMaskStorage* pBoneMaskStorage = nullptr );
         ~TaskSystem();
 
         void Reset();
@@ -112,11 +115,13 @@ namespace EE::Animation
 
         // Serialized the current executed tasks - NOTE: this can fail since some tasks (i.e. physics) cannot be serialized!
         // Only do this if there are no currently pending tasks!
-        bool SerializeTasks( TInlineVector<ResourceLUT const*, 10> const& LUTs, Blob& outSerializedData ) const;
+        // Optionally returns the layout of the serialized data, this is needed for delta compression (see TaskStreamEncoder)
+        bool SerializeTasks( TInlineVector<ResourceLUT const*, 10> const& LUTs, Blob& outSerializedData, SerializedTaskListLayout* pOutLayout = nullptr ) const;
 
         // Create a new set of tasks from a serialized set of data
         // Only do this if there are no registered tasks!
-        void DeserializeTasks( TInlineVector<ResourceLUT const*, 10> const& LUTs, Blob const& inSerializedData );
+        // If a replicated resource table is supplied, it will be used instead of generating one from the LUTs
+        void DeserializeTasks( TInlineVector<ResourceLUT const*, 10> const& LUTs, Blob const& inSerializedData, TVector<uint32_t> const* pResourceTable = nullptr );
 
         // Debug
         //-------------------------------------------------------------------------
@@ -125,11 +130,23 @@ namespace EE::Animation
         void SetDebugMode( TaskSystemDebugMode mode );
         TaskSystemDebugMode GetDebugMode() const { return m_debugMode; }
         void DrawDebug( Drawing::DrawContext& drawingContext );
+
+        // When profiling is enabled, all task executions are timed. The profile is reset at the start of each pre-physics update.
+        inline void SetProfilingEnabled( bool isEnabled ) { m_isProfilingEnabled = isEnabled; }
+        inline bool IsProfilingEnabled() const { return m_isProfilingEnabled; }
+        inline TaskSystemProfile const& GetProfile() const { return m_profile; }
+
+        // Get the memory exclusively owned by this task system, this doesnt include any shared storage
+        size_t GetMemoryUsage() const;
+
+        // Get the memory used by the shared pose buffer and bone mask storage, this is shared with all other task systems using the same storage
+        size_t GetSharedStorageMemoryUsage() const;
         #endif
 
     private:
 
         bool AddTaskChainToPrePhysicsList( TaskIndex taskIdx );
+        void ExecuteTask( TaskIndex taskIdx );
         void ExecuteTasks();
 
     private:
@@ -154,6 +171,8 @@ namespace EE::Animation
 
         #if EE_DEVELOPMENT_TOOLS
         TaskSystemDebugMode                     m_debugMode = TaskSystemDebugMode::Off;
+        TaskSystemProfile                       m_profile;
+        bool                                    m_isProfilingEnabled = false;
         #endif
     };
 }
\ No newline at end of file
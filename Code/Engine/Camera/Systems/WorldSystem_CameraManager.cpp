@@ -33,6 +33,12 @@ namespace EE
         #endif
     }
 
+    bool CameraManager::GetComponentInterests( WorldSystemComponentInterests& outInterests ) const
+    {
+        outInterests.Includes<CameraComponent>();
+        return true;
+    }
+
     void CameraManager::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
     {
         if ( auto pCameraComponent = TryCast<CameraComponent>( pComponent ) )
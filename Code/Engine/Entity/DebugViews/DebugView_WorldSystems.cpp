@@ -0,0 +1,127 @@
+#include "DebugView_WorldSystems.h"
+#include "Engine/Entity/EntityWorld.h"
+#include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "Base/Imgui/ImguiX.h"
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+namespace EE
+{
+    static char const* const g_stageNames[] = { "Frame Start", "Pre-Physics", "Physics", "Post-Physics", "Frame End", "Paused" };
+    static_assert( sizeof( g_stageNames ) / sizeof( g_stageNames[0] ) == (int32_t) UpdateStage::NumStages, "Stage name list out of date" );
+
+    //-------------------------------------------------------------------------
+
+    void WorldSystemsDebugView::Initialize( SystemRegistry const& systemRegistry, EntityWorld const* pWorld )
+    {
+        DebugView::Initialize( systemRegistry, pWorld );
+        m_windows.emplace_back( "World System Schedule", [this] ( EntityWorldUpdateContext const& context, bool isFocused, uint64_t ) { DrawScheduleWindow( context ); } );
+    }
+
+    void WorldSystemsDebugView::DrawMenu( EntityWorldUpdateContext const& context )
+    {
+        if ( ImGui::MenuItem( "Update Schedule" ) )
+        {
+            m_windows[0].m_isOpen = true;
+        }
+
+        bool isParallelUpdateEnabled = m_pWorld->GetSystemScheduler().IsParallelUpdateEnabled();
+        if ( ImGui::Checkbox( "Parallel System Updates", &isParallelUpdateEnabled ) )
+        {
+            const_cast<EntityWorld*>( m_pWorld )->SetParallelSystemUpdatesEnabled( isParallelUpdateEnabled );
+        }
+    }
+
+    void WorldSystemsDebugView::DrawScheduleWindow( EntityWorldUpdateContext const& context )
+    {
+        EntityWorldSystemScheduler const& scheduler = m_pWorld->GetSystemScheduler();
+
+        bool isParallelUpdateEnabled = scheduler.IsParallelUpdateEnabled();
+        if ( ImGui::Checkbox( "Parallel System Updates", &isParallelUpdateEnabled ) )
+        {
+            const_cast<EntityWorld*>( m_pWorld )->SetParallelSystemUpdatesEnabled( isParallelUpdateEnabled );
+        }
+
+        ImGui::Text( "World Update: %.3fms (%s)", m_pWorld->GetLastFrameUpdateTime().ToFloat(), m_pWorld->IsIndependentUpdateEnabled() ? "Independent" : "Main Thread" );
+        if ( m_pWorld->GetUpdateBudget() > 0.0f )
+        {
+            ImGui::SameLine();
+            ImGui::TextColored( m_pWorld->IsOverBudget() ? Colors::OrangeRed.ToFloat4() : Colors::Lime.ToFloat4(), "Budget: %.3fms (%u frames over)", m_pWorld->GetUpdateBudget().ToFloat(), m_pWorld->GetNumFramesOverBudget() );
+        }
+
+        for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+        {
+            UpdateStage const stage = (UpdateStage) i;
+            if ( scheduler.GetScheduledSystems( stage ).empty() )
+            {
+                continue;
+            }
+
+            Milliseconds const criticalPathTime = scheduler.GetCriticalPath( stage, m_criticalPath );
+
+            InlineString const headerLabel( InlineString::CtorSprintf(), "%s - %.3fms (Critical Path: %.3fms)###%s", g_stageNames[i], scheduler.GetLastStageUpdateTime( stage ).ToFloat(), criticalPathTime.ToFloat(), g_stageNames[i] );
+            if ( ImGui::CollapsingHeader( headerLabel.c_str(), ImGuiTreeNodeFlags_DefaultOpen ) )
+            {
+                DrawStageSchedule( stage );
+            }
+        }
+    }
+
+    void WorldSystemsDebugView::DrawStageSchedule( UpdateStage stage )
+    {
+        EntityWorldSystemScheduler const& scheduler = m_pWorld->GetSystemScheduler();
+        TVector<EntityWorldSystemScheduler::ScheduledSystem> const& systems = scheduler.GetScheduledSystems( stage );
+
+        InlineString const tableID( InlineString::CtorSprintf(), "StageScheduleTable%d", (int32_t) stage );
+        if ( ImGui::BeginTable( tableID.c_str(), 6, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable ) )
+        {
+            ImGui::TableSetupColumn( "Segment", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_NoResize, 50 );
+            ImGui::TableSetupColumn( "System", ImGuiTableColumnFlags_WidthStretch, 0.5f );
+            ImGui::TableSetupColumn( "Thread", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_NoResize, 45 );
+            ImGui::TableSetupColumn( "Start (ms)", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_NoResize, 60 );
+            ImGui::TableSetupColumn( "Time (ms)", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_NoResize, 60 );
+            ImGui::TableSetupColumn( "Waits On", ImGuiTableColumnFlags_WidthStretch, 0.5f );
+            ImGui::TableHeadersRow();
+
+            //-------------------------------------------------------------------------
+
+            InlineString dependencyStr;
+            for ( int16_t i = 0; i < (int16_t) systems.size(); i++ )
+            {
+                auto const& scheduledSystem = systems[i];
+                bool const isOnCriticalPath = VectorContains( m_criticalPath, i );
+                ImVec4 const textColor = isOnCriticalPath ? ImVec4( Colors::OrangeRed.ToFloat4() ) : ImGui::GetStyle().Colors[ImGuiCol_Text];
+
+                ImGui::TableNextRow();
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%d", scheduledSystem.m_segmentIdx );
+
+                ImGui::TableNextColumn();
+                ImGui::TextColored( textColor, "%s %s", scheduledSystem.m_isExclusive ? EE_ICON_LOCK : EE_ICON_CALL_SPLIT, scheduledSystem.m_pSystem->GetTypeInfo()->GetTypeName() );
+                ImGuiX::TextTooltip( scheduledSystem.m_isExclusive ? "Exclusive - runs alone on the world update thread" : "Parallel - runs concurrently with non-conflicting systems" );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%u", scheduledSystem.m_lastThreadIdx );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.3f", scheduledSystem.m_lastStartTime.ToFloat() );
+
+                ImGui::TableNextColumn();
+                ImGui::TextColored( textColor, "%.3f", scheduledSystem.m_lastUpdateTime.ToFloat() );
+
+                ImGui::TableNextColumn();
+                dependencyStr.clear();
+                for ( int16_t dependencyIdx : scheduledSystem.m_dependencies )
+                {
+                    dependencyStr.append_sprintf( dependencyStr.empty() ? "%s" : ", %s", systems[dependencyIdx].m_pSystem->GetTypeInfo()->GetTypeName() );
+                }
+                ImGui::Text( dependencyStr.c_str() );
+            }
+
+            ImGui::EndTable();
+        }
+    }
+}
+#endif
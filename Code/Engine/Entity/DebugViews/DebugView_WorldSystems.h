@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Engine/DebugViews/DebugView.h"
+#include "Engine/UpdateStage.h"
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+namespace EE
+{
+    class WorldSystemsDebugView : public DebugView
+    {
+        EE_REFLECT_TYPE( WorldSystemsDebugView );
+
+    public:
+
+        WorldSystemsDebugView() : DebugView( "Engine/World Systems" ) {}
+
+    private:
+
+        virtual void Initialize( SystemRegistry const& systemRegistry, EntityWorld const* pWorld ) override;
+        virtual void DrawMenu( EntityWorldUpdateContext const& context ) override;
+
+        void DrawScheduleWindow( EntityWorldUpdateContext const& context );
+        void DrawStageSchedule( UpdateStage stage );
+
+    private:
+
+        TVector<int16_t>                                m_criticalPath;
+    };
+}
+#endif
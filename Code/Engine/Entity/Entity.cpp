@@ -3,6 +3,7 @@
 #include "EntityContexts.h"
 #include "EntityDescriptors.h"
 #include "EntityLog.h"
+#include "EntityComponentPool.h"
 #include "Base/Resource/ResourceRequesterID.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include <eastl/sort.h>
@@ -62,7 +63,7 @@ namespace EE
         // Destroy components
         for ( auto& pComponent : m_components )
         {
-            EE::Delete( pComponent );
+            EntityModel::ComponentPool::DestroyComponent( pComponent );
         }
 
         m_components.clear();
@@ -197,7 +198,7 @@ namespace EE
         for ( auto pAttachedEntity : m_attachedEntities )
         {
             EE_ASSERT( !pAttachedEntity->IsInitialized() );
-            if ( pAttachedEntity->IsLoaded() )
+            if ( pAttachedEntity->IsLoaded() && !pAttachedEntity->IsDeactivated() )
             {
                 pAttachedEntity->Initialize( initializationContext );
             }
@@ -281,6 +282,48 @@ namespace EE
         m_status = Status::Loaded;
     }
 
+    void Entity::ResetToSerializedState( TypeSystem::TypeRegistry const& typeRegistry, EntityModel::SerializedEntityDescriptor const& entityDesc )
+    {
+        EE_ASSERT( m_status != Status::Initialized );
+        EE_ASSERT( entityDesc.IsValid() );
+
+        Threading::RecursiveScopeLock myLock( m_internalStateMutex );
+
+        for ( auto pComponent : m_components )
+        {
+            // Components that were added at runtime have no serialized state to restore
+            EntityModel::SerializedComponentDescriptor const* pComponentDesc = entityDesc.FindComponent( pComponent->GetNameID() );
+            if ( pComponentDesc == nullptr )
+            {
+                continue;
+            }
+
+            // Since the entity is not initialized, the component is not registered with any systems so we can safely cycle its initialization state
+            bool const wasInitialized = pComponent->IsInitialized();
+            if ( wasInitialized )
+            {
+                pComponent->Shutdown();
+                EE_ASSERT( !pComponent->IsInitialized() ); // Did you forget to call the parent class shutdown?
+            }
+
+            StringID const componentNameID = pComponent->m_name;
+            pComponentDesc->ResetTypeInstance( typeRegistry, pComponent->GetTypeInfo(), pComponent );
+            pComponent->m_name = componentNameID;
+
+            if ( wasInitialized )
+            {
+                pComponent->Initialize();
+                EE_ASSERT( pComponent->IsInitialized() ); // Did you forget to call the parent class initialize?
+            }
+        }
+
+        // Local transforms have been restored so we need to update the world transforms
+        if ( IsSpatialEntity() )
+        {
+            m_pRootSpatialComponent->CalculateWorldTransform( false );
+        }
+    }
+
     //-------------------------------------------------------------------------
 
     void Entity::UpdateSystems( EntityWorldUpdateContext const& context )
@@ -1081,7 +1124,7 @@ namespace EE
         //-------------------------------------------------------------------------
 
         m_components.erase_unsorted( m_components.begin() + componentIdx );
-        EE::Delete( pComponent );
+        EntityModel::ComponentPool::DestroyComponent( pComponent );
     }
 
     void Entity::RemoveComponentFromSpatialHierarchy( SpatialEntityComponent* pSpatialComponent )
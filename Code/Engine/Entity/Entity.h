@@ -196,6 +196,12 @@ namespace EE
         inline bool IsUnloaded() const { return m_status == Status::Unloaded; }
         inline bool HasStateChangeActionsPending() const { return !m_deferredActions.empty(); }
 
+        // Deactivated entities are kept loaded by their map but are never initialized (i.e. they are pooled and waiting to be reused)
+        inline bool IsDeactivated() const { return m_isDeactivated; }
+
+        // Resets all serialized component state back to the values in the supplied descriptor - only valid for entities that are not initialized
+        void ResetToSerializedState( TypeSystem::TypeRegistry const& typeRegistry, EntityModel::SerializedEntityDescriptor const& entityDesc );
+
         // Components
         //-------------------------------------------------------------------------
         // NB!!! Add and remove operations execute immediately for unloaded entities BUT will be deferred to the next loading phase for loaded entities
@@ -371,6 +377,7 @@ namespace EE
         Entity*                                             m_pParentSpatialEntity = nullptr;                                       // The parent entity we are attached to
         EE_REFLECT() StringID                               m_parentAttachmentSocketID;                                             // The socket that we are attached to on the parent
         bool                                                m_isSpatialAttachmentCreated = false;                                   // Has the actual component-to-component attachment been created
+        bool                                                m_isDeactivated = false;                                                // Is this entity pooled i.e. loaded but not allowed to be initialized
 
         TVector<EntityInternalStateAction>                  m_deferredActions;                                                      // The set of internal entity state changes that need to be executed
         Threading::RecursiveMutex                           m_internalStateMutex;                                                   // A mutex that needs to be lock due to internal state changes
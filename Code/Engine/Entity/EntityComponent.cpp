@@ -4,6 +4,28 @@
 
 namespace EE
 {
+    EntityComponent::EntityComponent( EntityComponent const& rhs )
+        : IReflectedType( rhs )
+        , m_ID( rhs.m_ID )
+        , m_entityID( rhs.m_entityID )
+        , m_name( rhs.m_name )
+        , m_status( rhs.m_status )
+        , m_isRegisteredWithEntity( rhs.m_isRegisteredWithEntity )
+        , m_isRegisteredWithWorld( rhs.m_isRegisteredWithWorld )
+    {}
+
+    EntityComponent& EntityComponent::operator=( EntityComponent const& rhs )
+    {
+        IReflectedType::operator=( rhs );
+        m_ID = rhs.m_ID;
+        m_entityID = rhs.m_entityID;
+        m_name = rhs.m_name;
+        m_status = rhs.m_status;
+        m_isRegisteredWithEntity = rhs.m_isRegisteredWithEntity;
+        m_isRegisteredWithWorld = rhs.m_isRegisteredWithWorld;
+        return *this;
+    }
+
     EntityComponent::~EntityComponent()
     {
         EE_ASSERT( m_status == Status::Unloaded );
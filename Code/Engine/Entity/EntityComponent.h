@@ -14,6 +14,8 @@ namespace EE
         class EntityMapEditor;
         class EntityCollection;
         class EntityMap;
+        class ComponentSlab;
+        class ComponentPool;
         struct Serializer;
     }
 
@@ -28,6 +30,7 @@ namespace EE
         friend EntityModel::Serializer;
         friend EntityModel::EntityCollection;
         friend EntityModel::EntityMap;
+        friend EntityModel::ComponentPool;
 
     public:
 
@@ -67,10 +70,11 @@ namespace EE
     protected:
 
         EntityComponent() = default;
-        EntityComponent( EntityComponent const& ) = default;
+        EntityComponent( EntityComponent const& rhs );
         EntityComponent( StringID name ) : m_name( name ) {}
 
-        EntityComponent& operator=( EntityComponent const& rhs ) = default;
+        // Copies never share the source component's pool allocation
+        EntityComponent& operator=( EntityComponent const& rhs );
 
         // Request load of all component data - loading takes time
         virtual void Load( EntityModel::LoadingContext const& context, Resource::ResourceRequesterID const& requesterID ) = 0;
@@ -96,6 +100,7 @@ namespace EE
         Status                                              m_status = Status::Unloaded;                    // Component status
         bool                                                m_isRegisteredWithEntity = false;               // Registered with its parent entity's local systems
         bool                                                m_isRegisteredWithWorld = false;                // Registered with the global systems in it's parent world
+        EntityModel::ComponentSlab*                         m_pPoolSlab = nullptr;                          // Set if this component was allocated from a map's component pool
     };
 }
 
@@ -0,0 +1,187 @@
+#include "EntityComponentPool.h"
+#include "EntityComponent.h"
+#include "EntityDescriptors.h"
+#include "Base/TypeSystem/TypeRegistry.h"
+#include "Base/Types/HashMap.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    ComponentSlab::ComponentSlab( TypeSystem::TypeInfo const* pTypeInfo, int32_t capacity )
+        : m_pTypeInfo( pTypeInfo )
+        , m_capacity( capacity )
+        , m_referenceCount( capacity + 1 )
+    {
+        EE_ASSERT( m_pTypeInfo != nullptr && !m_pTypeInfo->IsAbstractType() );
+        EE_ASSERT( m_pTypeInfo->m_size > 0 && m_pTypeInfo->m_alignment > 0 );
+        EE_ASSERT( m_capacity > 0 );
+
+        size_t const alignment = (size_t) m_pTypeInfo->m_alignment;
+        m_stride = ( ( (size_t) m_pTypeInfo->m_size + alignment - 1 ) / alignment ) * alignment;
+        m_pMemory = (uint8_t*) EE::Alloc( m_stride * m_capacity, Math::Max( alignment, size_t( 64 ) ) );
+    }
+
+    ComponentSlab::~ComponentSlab()
+    {
+        EE_ASSERT( m_referenceCount == 0 );
+        EE::Free( m_pMemory );
+    }
+
+    void ComponentSlab::ReleaseReference()
+    {
+        EE_ASSERT( m_referenceCount > 0 );
+        if ( m_referenceCount.fetch_sub( 1 ) == 1 )
+        {
+            ComponentSlab* pSlab = this;
+            EE::Delete( pSlab );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    ComponentPool::~ComponentPool()
+    {
+        Reset();
+    }
+
+    void ComponentPool::AllocateCollection( TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollection, TVector<ComponentAllocation>& outAllocations )
+    {
+        EE_PROFILE_FUNCTION_ENTITY();
+
+        struct TypeAllocation
+        {
+            TypeSystem::TypeInfo const*         m_pTypeInfo = nullptr;
+            ComponentSlab*                      m_pSlab = nullptr;
+            int32_t                             m_numComponents = 0;
+            int32_t                             m_nextElementIdx = 0;
+        };
+
+        TVector<TypeAllocation> typeAllocations;
+        THashMap<TypeSystem::TypeID, int32_t> typeAllocationIndices;
+
+        // Count the components of each type
+        //-------------------------------------------------------------------------
+
+        int32_t numComponents = 0;
+        for ( auto const& entityDesc : entityCollection.GetEntityDescriptors() )
+        {
+            for ( auto const& componentDesc : entityDesc.m_components )
+            {
+                auto iter = typeAllocationIndices.find( componentDesc.m_typeID );
+                if ( iter == typeAllocationIndices.end() )
+                {
+                    iter = typeAllocationIndices.insert( TPair<TypeSystem::TypeID, int32_t>( componentDesc.m_typeID, (int32_t) typeAllocations.size() ) ).first;
+
+                    TypeAllocation& typeAllocation = typeAllocations.emplace_back();
+                    typeAllocation.m_pTypeInfo = typeRegistry.GetTypeInfo( componentDesc.m_typeID );
+                    EE_ASSERT( typeAllocation.m_pTypeInfo != nullptr );
+                }
+
+                typeAllocations[iter->second].m_numComponents++;
+                numComponents++;
+            }
+        }
+
+        // Create a slab per type
+        //-------------------------------------------------------------------------
+
+        {
+            Threading::ScopeLock lock( m_mutex );
+            ReleaseEmptySlabsInternal();
+
+            for ( auto& typeAllocation : typeAllocations )
+            {
+                typeAllocation.m_pSlab = EE::New<ComponentSlab>( typeAllocation.m_pTypeInfo, typeAllocation.m_numComponents );
+                m_slabs.emplace_back( typeAllocation.m_pSlab );
+            }
+        }
+
+        // Assign slots in collection order
+        //-------------------------------------------------------------------------
+
+        outAllocations.clear();
+        outAllocations.reserve( numComponents );
+
+        for ( auto const& entityDesc : entityCollection.GetEntityDescriptors() )
+        {
+            for ( auto const& componentDesc : entityDesc.m_components )
+            {
+                TypeAllocation& typeAllocation = typeAllocations[typeAllocationIndices[componentDesc.m_typeID]];
+
+                ComponentAllocation& allocation = outAllocations.emplace_back();
+                allocation.m_pMemory = typeAllocation.m_pSlab->GetElementMemory( typeAllocation.m_nextElementIdx++ );
+                allocation.m_pSlab = typeAllocation.m_pSlab;
+            }
+        }
+    }
+
+    void ComponentPool::Reset()
+    {
+        Threading::ScopeLock lock( m_mutex );
+
+        for ( auto pSlab : m_slabs )
+        {
+            pSlab->ReleaseReference();
+        }
+
+        m_slabs.clear();
+    }
+
+    void ComponentPool::ReleaseEmptySlabs()
+    {
+        Threading::ScopeLock lock( m_mutex );
+        ReleaseEmptySlabsInternal();
+    }
+
+    void ComponentPool::ReleaseEmptySlabsInternal()
+    {
+        // No new components are ever constructed in an existing slab, so once a slab is empty it will stay empty
+        for ( int32_t i = (int32_t) m_slabs.size() - 1; i >= 0; i-- )
+        {
+            if ( m_slabs[i]->IsEmpty() )
+            {
+                m_slabs[i]->ReleaseReference();
+                m_slabs.erase_unsorted( m_slabs.begin() + i );
+            }
+        }
+    }
+
+    void ComponentPool::Swap( ComponentPool& other )
+    {
+        Threading::ScopeLock lock( m_mutex );
+        Threading::ScopeLock otherLock( other.m_mutex );
+        m_slabs.swap( other.m_slabs );
+    }
+
+    ComponentPool::Stats ComponentPool::GetStats() const
+    {
+        Threading::ScopeLock lock( m_mutex );
+
+        Stats stats;
+        stats.m_numSlabs = (int32_t) m_slabs.size();
+        for ( auto pSlab : m_slabs )
+        {
+            stats.m_numReservedComponents += pSlab->GetCapacity();
+            stats.m_memoryUsage += pSlab->GetMemoryUsage();
+        }
+
+        return stats;
+    }
+
+    void ComponentPool::DestroyComponent( EntityComponent* pComponent )
+    {
+        EE_ASSERT( pComponent != nullptr );
+
+        ComponentSlab* pSlab = pComponent->m_pPoolSlab;
+        if ( pSlab == nullptr )
+        {
+            EE::Delete( pComponent );
+            return;
+        }
+
+        pComponent->~EntityComponent();
+        pSlab->ReleaseReference();
+    }
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Types/Arrays.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+// Component Pool
+//-------------------------------------------------------------------------
+// Per-type slab storage for the components created when instantiating an entity collection
+// All the components of the same concrete type in a collection are allocated from a single contiguous slab, in collection (i.e. registration) order
+// This means that world systems iterating their component lists walk roughly sequential memory instead of chasing pointers all over the heap
+//
+// Slabs are reference counted by the components constructed in them, so a component is free to outlive the pool (e.g. entities removed from a map)
+// The memory of destroyed components is not reused, a slab is only freed once all its components are destroyed and the pool has released it
+// The pool releases its empty slabs whenever a new collection is allocated, so repeatedly creating and destroying collections does not grow the pool
+
+namespace EE
+{
+    class EntityComponent;
+    namespace TypeSystem { class TypeInfo; class TypeRegistry; }
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    class SerializedEntityCollection;
+
+    //-------------------------------------------------------------------------
+
+    class ComponentSlab
+    {
+        friend class ComponentPool;
+
+    public:
+
+        // Every slot in the slab is expected to be constructed, the slab holds a reference for each of them
+        ComponentSlab( TypeSystem::TypeInfo const* pTypeInfo, int32_t capacity );
+        ComponentSlab( ComponentSlab const& ) = delete;
+        ~ComponentSlab();
+
+        ComponentSlab& operator=( ComponentSlab const& ) = delete;
+
+        inline TypeSystem::TypeInfo const* GetTypeInfo() const { return m_pTypeInfo; }
+        inline int32_t GetCapacity() const { return m_capacity; }
+        inline size_t GetStride() const { return m_stride; }
+        inline size_t GetMemoryUsage() const { return m_stride * m_capacity; }
+
+        inline void* GetElementMemory( int32_t elementIdx ) const
+        {
+            EE_ASSERT( elementIdx >= 0 && elementIdx < m_capacity );
+            return m_pMemory + ( m_stride * elementIdx );
+        }
+
+        // Called once a component constructed in this slab is destroyed, the last release frees the slab
+        void ReleaseReference();
+
+        // Have all the components constructed in this slab been destroyed, i.e. is the owning pool the only remaining reference
+        inline bool IsEmpty() const { return m_referenceCount == 1; }
+
+    private:
+
+        TypeSystem::TypeInfo const*             m_pTypeInfo = nullptr;
+        uint8_t*                                m_pMemory = nullptr;
+        size_t                                  m_stride = 0;
+        int32_t                                 m_capacity = 0;
+        std::atomic<int32_t>                    m_referenceCount = 0;   // One per slot plus one for the owning pool
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API ComponentPool
+    {
+    public:
+
+        // The memory reserved for a single component of a collection
+        struct ComponentAllocation
+        {
+            void*                               m_pMemory = nullptr;
+            ComponentSlab*                      m_pSlab = nullptr;
+        };
+
+        struct Stats
+        {
+            int32_t                             m_numSlabs = 0;
+            int32_t                             m_numReservedComponents = 0;
+            size_t                              m_memoryUsage = 0;
+        };
+
+    public:
+
+        ComponentPool() = default;
+        ComponentPool( ComponentPool const& ) = delete;
+        ~ComponentPool();
+
+        ComponentPool& operator=( ComponentPool const& ) = delete;
+
+        // Reserve contiguous per-type memory for all the components in a collection
+        // Allocations are returned in descriptor order (i.e. entity by entity, component by component) and every allocation MUST be constructed
+        void AllocateCollection( TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollection, TVector<ComponentAllocation>& outAllocations );
+
+        // Release the pool's references to all its slabs, slabs with living components will be freed once those components are destroyed
+        void Reset();
+
+        // Free all slabs whose components have all been destroyed
+        void ReleaseEmptySlabs();
+
+        void Swap( ComponentPool& other );
+
+        Stats GetStats() const;
+
+        // Destroy a component, this handles both pooled and individually allocated components
+        static void DestroyComponent( EntityComponent* pComponent );
+
+    private:
+
+        void ReleaseEmptySlabsInternal();
+
+    private:
+
+        mutable Threading::Mutex                m_mutex;
+        TVector<ComponentSlab*>                 m_slabs;
+    };
+}
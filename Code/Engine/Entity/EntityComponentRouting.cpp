@@ -0,0 +1,138 @@
+#include "EntityComponentRouting.h"
+#include "EntityWorldSystem.h"
+#include "EntityComponent.h"
+#include "Base/TypeSystem/TypeRegistry.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    void ComponentRoutingTable::Initialize( TypeSystem::TypeRegistry const* pTypeRegistry, TVector<EntityWorldSystem*> const& worldSystems )
+    {
+        EE_ASSERT( pTypeRegistry != nullptr );
+        EE_ASSERT( m_systemInterests.empty() && m_routes.empty() );
+        EE_ASSERT( worldSystems.size() < INT16_MAX );
+
+        m_systemInterests.resize( worldSystems.size() );
+        m_systemRegistrationLists.resize( worldSystems.size() );
+
+        int32_t const numSystems = (int32_t) worldSystems.size();
+        for ( int32_t i = 0; i < numSystems; i++ )
+        {
+            WorldSystemComponentInterests interests;
+            if ( !worldSystems[i]->GetComponentInterests( interests ) )
+            {
+                m_systemInterests[i].m_isInterestedInAllComponents = true;
+                continue;
+            }
+
+            for ( auto const& componentTypeID : interests.m_componentTypeIDs )
+            {
+                TypeSystem::TypeInfo const* pComponentTypeInfo = pTypeRegistry->GetTypeInfo( componentTypeID );
+                EE_ASSERT( pComponentTypeInfo != nullptr && pComponentTypeInfo->IsDerivedFrom<EntityComponent>() );
+                m_systemInterests[i].m_componentTypes.emplace_back( pComponentTypeInfo );
+            }
+        }
+    }
+
+    void ComponentRoutingTable::Shutdown()
+    {
+        m_systemInterests.clear();
+        m_routes.clear();
+        m_systemRegistrationLists.clear();
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_numDispatchedComponents = 0;
+        m_isRoutingEnabled = true;
+        #endif
+    }
+
+    ComponentRoutingTable::SystemIndexList const& ComponentRoutingTable::GetInterestedSystems( TypeSystem::TypeInfo const* pComponentTypeInfo )
+    {
+        EE_ASSERT( IsInitialized() && pComponentTypeInfo != nullptr );
+
+        auto routeIter = m_routes.find( pComponentTypeInfo );
+        if ( routeIter != m_routes.end() )
+        {
+            return routeIter->second;
+        }
+
+        // Build the route for this type
+        //-------------------------------------------------------------------------
+
+        SystemIndexList& route = m_routes[pComponentTypeInfo];
+
+        int16_t const numSystems = (int16_t) m_systemInterests.size();
+        for ( int16_t i = 0; i < numSystems; i++ )
+        {
+            SystemInterests const& interests = m_systemInterests[i];
+            if ( interests.m_isInterestedInAllComponents )
+            {
+                route.emplace_back( i );
+                continue;
+            }
+
+            for ( auto pInterestTypeInfo : interests.m_componentTypes )
+            {
+                if ( pComponentTypeInfo->IsDerivedFrom( pInterestTypeInfo ) )
+                {
+                    route.emplace_back( i );
+                    break;
+                }
+            }
+        }
+
+        return route;
+    }
+
+    TVector<ComponentRoutingTable::SystemRegistrationList> const& ComponentRoutingTable::RouteComponents( TVector<EntityComponentPair> const& componentsToRegister, TVector<EntityComponentPair> const& componentsToUnregister )
+    {
+        EE_PROFILE_FUNCTION_ENTITY();
+
+        for ( auto& registrationList : m_systemRegistrationLists )
+        {
+            registrationList.m_componentsToRegister.clear();
+            registrationList.m_componentsToUnregister.clear();
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        if ( !m_isRoutingEnabled )
+        {
+            for ( auto& registrationList : m_systemRegistrationLists )
+            {
+                registrationList.m_componentsToUnregister = componentsToUnregister;
+                registrationList.m_componentsToRegister = componentsToRegister;
+            }
+
+            m_numDispatchedComponents += m_systemRegistrationLists.size() * ( componentsToUnregister.size() + componentsToRegister.size() );
+            return m_systemRegistrationLists;
+        }
+        #endif
+
+        for ( auto const& pair : componentsToUnregister )
+        {
+            for ( int16_t systemIdx : GetInterestedSystems( pair.m_pComponent->GetTypeInfo() ) )
+            {
+                m_systemRegistrationLists[systemIdx].m_componentsToUnregister.emplace_back( pair );
+            }
+        }
+
+        for ( auto const& pair : componentsToRegister )
+        {
+            for ( int16_t systemIdx : GetInterestedSystems( pair.m_pComponent->GetTypeInfo() ) )
+            {
+                m_systemRegistrationLists[systemIdx].m_componentsToRegister.emplace_back( pair );
+            }
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        for ( auto const& registrationList : m_systemRegistrationLists )
+        {
+            m_numDispatchedComponents += registrationList.m_componentsToUnregister.size() + registrationList.m_componentsToRegister.size();
+        }
+        #endif
+
+        return m_systemRegistrationLists;
+    }
+}
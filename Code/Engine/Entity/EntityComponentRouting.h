@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "EntityContexts.h"
+#include "Base/Types/Arrays.h"
+#include "Base/Types/HashMap.h"
+
+//-------------------------------------------------------------------------
+// Component Routing Table
+//-------------------------------------------------------------------------
+// Maps each concrete component type to the world systems that are interested in it (see EntityWorldSystem::GetComponentInterests)
+// This lets component registration only visit the relevant systems instead of handing every component to every system
+// Routes are built the first time a component type is encountered and must only be accessed from the main thread
+
+namespace EE
+{
+    class EntityWorldSystem;
+    namespace TypeSystem { class TypeInfo; }
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    class EE_ENGINE_API ComponentRoutingTable
+    {
+    public:
+
+        using SystemIndexList = TInlineVector<int16_t, 8>;
+
+        // The components to register/unregister with a single world system
+        struct SystemRegistrationList
+        {
+            inline bool IsEmpty() const { return m_componentsToRegister.empty() && m_componentsToUnregister.empty(); }
+
+            TVector<EntityComponentPair>        m_componentsToRegister;
+            TVector<EntityComponentPair>        m_componentsToUnregister;
+        };
+
+    public:
+
+        void Initialize( TypeSystem::TypeRegistry const* pTypeRegistry, TVector<EntityWorldSystem*> const& worldSystems );
+        void Shutdown();
+
+        inline bool IsInitialized() const { return !m_systemInterests.empty(); }
+
+        // Get the declared component interests for a system, this is empty for systems that are interested in all components
+        inline TInlineVector<TypeSystem::TypeInfo const*, 8> const& GetSystemInterests( int32_t systemIdx ) const { return m_systemInterests[systemIdx].m_componentTypes; }
+        inline bool IsSystemInterestedInAllComponents( int32_t systemIdx ) const { return m_systemInterests[systemIdx].m_isInterestedInAllComponents; }
+
+        // Get the indices (into the world system list) of all systems interested in the specified component type
+        SystemIndexList const& GetInterestedSystems( TypeSystem::TypeInfo const* pComponentTypeInfo );
+
+        // Split the supplied components into per-system registration lists, the returned lists are only valid until the next call
+        TVector<SystemRegistrationList> const& RouteComponents( TVector<EntityComponentPair> const& componentsToRegister, TVector<EntityComponentPair> const& componentsToUnregister );
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Disabling routing hands every component to every system (each system then filters them itself), this only exists to measure the cost of unrouted registration
+        inline void SetRoutingEnabled( bool isEnabled ) { m_isRoutingEnabled = isEnabled; }
+        inline bool IsRoutingEnabled() const { return m_isRoutingEnabled; }
+
+        // The total number of component registrations and unregistrations that have been handed to systems
+        inline uint64_t GetNumDispatchedComponents() const { return m_numDispatchedComponents; }
+        #endif
+
+    private:
+
+        struct SystemInterests
+        {
+            TInlineVector<TypeSystem::TypeInfo const*, 8>   m_componentTypes;
+            bool                                            m_isInterestedInAllComponents = false;
+        };
+
+    private:
+
+        TVector<SystemInterests>                                    m_systemInterests;
+        THashMap<TypeSystem::TypeInfo const*, SystemIndexList>      m_routes;
+        TVector<SystemRegistrationList>                             m_systemRegistrationLists;
+
+        #if EE_DEVELOPMENT_TOOLS
+        uint64_t                                                    m_numDispatchedComponents = 0;
+        bool                                                        m_isRoutingEnabled = true;
+        #endif
+    };
+}
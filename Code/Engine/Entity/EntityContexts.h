@@ -19,6 +19,10 @@ namespace EE
 
 namespace EE::EntityModel
 {
+    class ComponentRoutingTable;
+
+    //-------------------------------------------------------------------------
+
     struct LoadingContext
     {
         LoadingContext() = default;
@@ -73,13 +77,15 @@ namespace EE::EntityModel
         void SetComponentTypeMapPtr( EntityComponentTypeMap* pMap ) { m_pComponentTypeMap = pMap; }
         #endif
 
+        void SetComponentRoutingTablePtr( ComponentRoutingTable* pRoutingTable ) { m_pComponentRoutingTable = pRoutingTable; }
+
         inline bool IsValid() const
         {
             #if EE_DEVELOPMENT_TOOLS
             if ( m_pComponentTypeMap == nullptr ) return false;
             #endif
 
-            return m_pTaskSystem != nullptr && m_pTypeRegistry != nullptr;
+            return m_pTaskSystem != nullptr && m_pTypeRegistry != nullptr && m_pComponentRoutingTable != nullptr;
         }
 
     public:
@@ -99,6 +105,7 @@ namespace EE::EntityModel
 
         TVector<EntityWorldSystem*> const&                         m_worldSystems;
         TVector<Entity*>&                                           m_entityUpdateList;
+        ComponentRoutingTable*                                      m_pComponentRoutingTable = nullptr;
 
         #if EE_DEVELOPMENT_TOOLS
         EntityComponentTypeMap*                                     m_pComponentTypeMap = nullptr;
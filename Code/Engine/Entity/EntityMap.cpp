@@ -3,6 +3,7 @@
 #include "EntityContexts.h"
 #include "EntitySerialization.h"
 #include "EntityWorldSystem.h"
+#include "EntityComponentRouting.h"
 #include "Entity.h"
 #include "Base/Resource/ResourceSystem.h"
 #include "Base/TypeSystem/TypeRegistry.h"
@@ -39,6 +40,7 @@ namespace EE::EntityModel
         EE_ASSERT( IsUnloaded() );
         EE_ASSERT( m_entities.empty() && m_entityIDLookupMap.empty() );
         EE_ASSERT( m_entitiesToLoad.empty() && m_entitiesToRemove.empty() );
+        EE_ASSERT( m_entitiesToDeactivate.empty() && m_pools.empty() && m_pooledInstanceLookupMap.empty() );
 
         #if EE_DEVELOPMENT_TOOLS
         EE_ASSERT( m_entitiesToHotReload.empty() );
@@ -75,6 +77,9 @@ namespace EE::EntityModel
         m_entityIDLookupMap.swap( map.m_entityIDLookupMap );
         m_pMapDesc = eastl::move( map.m_pMapDesc );
         m_entitiesCurrentlyLoading = eastl::move( map.m_entitiesCurrentlyLoading );
+        m_pools.swap( map.m_pools );
+        m_pooledInstanceLookupMap.swap( map.m_pooledInstanceLookupMap );
+        m_componentPool.Swap( map.m_componentPool );
         m_status = map.m_status;
         const_cast<bool&>( m_isTransientMap ) = map.m_isTransientMap;
 
@@ -195,6 +200,7 @@ namespace EE::EntityModel
         //-------------------------------------------------------------------------
 
         m_entities.erase_first_unsorted( pEntityToRemove );
+        m_entitiesToDeactivate.erase_first_unsorted( pEntityToRemove );
 
         // Remove from internal lookup maps
         //-------------------------------------------------------------------------
@@ -242,6 +248,9 @@ namespace EE::EntityModel
 
     Entity* EntityMap::RemoveEntity( EntityID entityID )
     {
+        Threading::RecursiveScopeLock lock( m_mutex );
+
+        DetachPooledEntity( entityID );
         Entity* pEntityToRemove = RemoveEntityInternal( entityID, false );
         EE_ASSERT( pEntityToRemove != nullptr );
         return pEntityToRemove;
@@ -249,9 +258,344 @@ namespace EE::EntityModel
 
     void EntityMap::DestroyEntity( EntityID entityID )
     {
+        Threading::RecursiveScopeLock lock( m_mutex );
+
+        DetachPooledEntity( entityID );
         RemoveEntityInternal( entityID, true );
     }
 
+    //-------------------------------------------------------------------------
+    // Entity Pooling
+    //-------------------------------------------------------------------------
+
+    // Used to detect pooled instances that were created from a previous version of a hot-reloaded collection
+    static uint64_t GetCollectionVersion( SerializedEntityCollection const& entityCollectionDesc )
+    {
+        #if EE_DEVELOPMENT_TOOLS
+        return entityCollectionDesc.GetSourceResourceHash();
+        #else
+        return 0; // Collections cannot change at runtime
+        #endif
+    }
+
+    EntityMap::EntityCollectionPool* EntityMap::FindPool( ResourceID const& collectionID )
+    {
+        for ( auto& pool : m_pools )
+        {
+            if ( pool.m_collectionID == collectionID )
+            {
+                return &pool;
+            }
+        }
+
+        return nullptr;
+    }
+
+    EntityMap::PooledCollectionInstance* EntityMap::FindPooledInstance( EntityID entityID )
+    {
+        auto iter = m_pooledInstanceLookupMap.find( entityID );
+        return ( iter != m_pooledInstanceLookupMap.end() ) ? iter->second : nullptr;
+    }
+
+    void EntityMap::RemovePooledInstance( PooledCollectionInstance* pInstance )
+    {
+        EE_ASSERT( pInstance != nullptr );
+
+        for ( auto const& entityID : pInstance->m_entityIDs )
+        {
+            m_pooledInstanceLookupMap.erase( entityID );
+        }
+
+        EntityCollectionPool* pPool = FindPool( pInstance->m_collectionID );
+        EE_ASSERT( pPool != nullptr );
+        pPool->m_instances.erase_first_unsorted( pInstance );
+        EE::Delete( pInstance );
+    }
+
+    void EntityMap::DetachPooledEntity( EntityID entityID )
+    {
+        PooledCollectionInstance* pInstance = FindPooledInstance( entityID );
+        if ( pInstance == nullptr )
+        {
+            return;
+        }
+
+        // The instance can no longer be reused once any of its entities are removed
+        // The remaining entities of an active instance are left as regular entities, the remaining entities of an inactive instance can never be activated so are destroyed
+        TVector<EntityID> entitiesToDestroy;
+        if ( !pInstance->m_isActive )
+        {
+            entitiesToDestroy = pInstance->m_entityIDs;
+        }
+
+        RemovePooledInstance( pInstance );
+
+        for ( auto const& instanceEntityID : entitiesToDestroy )
+        {
+            if ( instanceEntityID != entityID && FindEntity( instanceEntityID ) != nullptr )
+            {
+                RemoveEntityInternal( instanceEntityID, true );
+            }
+        }
+
+        // Ensure that a removed entity can be initialized if it is ever re-added
+        Entity* pEntity = FindEntity( entityID );
+        EE_ASSERT( pEntity != nullptr );
+        pEntity->m_isDeactivated = false;
+    }
+
+    EntityMap::EntityCollectionPool& EntityMap::FindOrCreatePool( ResourceID const& collectionID )
+    {
+        EntityCollectionPool* pPool = FindPool( collectionID );
+        if ( pPool == nullptr )
+        {
+            pPool = &m_pools.emplace_back();
+            pPool->m_collectionID = collectionID;
+        }
+
+        return *pPool;
+    }
+
+    void EntityMap::CreatePooledInstance( EntityCollectionPool& pool, TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollectionDesc )
+    {
+        TVector<Entity*> const createdEntities = Serializer::CreateEntities( pTaskSystem, typeRegistry, entityCollectionDesc, &m_componentPool );
+
+        PooledCollectionInstance* pInstance = pool.m_instances.emplace_back( EE::New<PooledCollectionInstance>() );
+        pInstance->m_collectionID = pool.m_collectionID;
+        pInstance->m_collectionVersion = GetCollectionVersion( entityCollectionDesc );
+        pInstance->m_entityIDs.reserve( createdEntities.size() );
+        for ( auto pEntity : createdEntities )
+        {
+            pEntity->m_isDeactivated = true;
+            pInstance->m_entityIDs.emplace_back( pEntity->GetID() );
+            m_pooledInstanceLookupMap.insert( TPair<EntityID, PooledCollectionInstance*>( pEntity->GetID(), pInstance ) );
+        }
+
+        // Entities will be loaded as part of the regular loading update but will not be initialized
+        AddEntities( createdEntities );
+    }
+
+    bool EntityMap::ResetPooledInstance( PooledCollectionInstance const& instance, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollectionDesc, Transform const& offsetTransform, TVector<Entity*>& outEntities )
+    {
+        EE_ASSERT( !instance.m_isActive );
+
+        // If the collection was modified (i.e. hot-reloaded) then this instance is no longer valid
+        int32_t const numEntities = (int32_t) instance.m_entityIDs.size();
+        if ( instance.m_collectionVersion != GetCollectionVersion( entityCollectionDesc ) || numEntities != entityCollectionDesc.GetNumEntityDescriptors() )
+        {
+            return false;
+        }
+
+        // Resolve entities, all entities need to exist and be shutdown for the instance to be reusable
+        outEntities.clear();
+        outEntities.reserve( numEntities );
+
+        for ( auto const& entityID : instance.m_entityIDs )
+        {
+            Entity* pEntity = FindEntity( entityID );
+            if ( pEntity == nullptr || pEntity->IsInitialized() )
+            {
+                return false;
+            }
+
+            outEntities.emplace_back( pEntity );
+        }
+
+        // Restore serialized state and apply the requested offset
+        bool const applyOffset = !offsetTransform.IsIdentity();
+        auto const& entityDescs = entityCollectionDesc.GetEntityDescriptors();
+        for ( int32_t i = 0; i < numEntities; i++ )
+        {
+            Entity* pEntity = outEntities[i];
+            pEntity->ResetToSerializedState( typeRegistry, entityDescs[i] );
+
+            if ( applyOffset && pEntity->IsSpatialEntity() )
+            {
+                pEntity->SetWorldTransform( pEntity->GetWorldTransform() * offsetTransform );
+            }
+        }
+
+        return true;
+    }
+
+    void EntityMap::PrewarmEntityCollection( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollectionDesc, int32_t numInstances )
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Prewarm Entity Collection" );
+        EE_ASSERT( entityCollectionDesc.GetResourceID().IsValid() );
+        EE_ASSERT( numInstances >= 0 );
+
+        Threading::RecursiveScopeLock lock( m_mutex );
+
+        EntityCollectionPool& pool = FindOrCreatePool( entityCollectionDesc.GetResourceID() );
+        pool.m_instances.reserve( pool.m_instances.size() + numInstances );
+
+        for ( int32_t i = 0; i < numInstances; i++ )
+        {
+            CreatePooledInstance( pool, pTaskSystem, typeRegistry, entityCollectionDesc );
+        }
+    }
+
+    void EntityMap::SpawnPooledEntityCollection( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollectionDesc, Transform const& offsetTransform, TVector<Entity*>* pOutCreatedEntities )
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Spawn Pooled Entity Collection" );
+        EE_ASSERT( entityCollectionDesc.GetResourceID().IsValid() );
+
+        TVector<Entity*> scratchVector;
+        TVector<Entity*>& spawnedEntities = ( pOutCreatedEntities != nullptr ) ? *pOutCreatedEntities : scratchVector;
+        spawnedEntities.clear();
+
+        //-------------------------------------------------------------------------
+
+        Threading::RecursiveScopeLock lock( m_mutex );
+
+        EntityCollectionPool& pool = FindOrCreatePool( entityCollectionDesc.GetResourceID() );
+
+        // Try to reuse a free instance
+        //-------------------------------------------------------------------------
+
+        for ( int32_t i = (int32_t) pool.m_instances.size() - 1; i >= 0; i-- )
+        {
+            PooledCollectionInstance& instance = *pool.m_instances[i];
+            if ( instance.m_isActive )
+            {
+                continue;
+            }
+
+            if ( ResetPooledInstance( instance, typeRegistry, entityCollectionDesc, offsetTransform, spawnedEntities ) )
+            {
+                // Activate the entities, once they have finished loading they will be initialized as part of the regular loading update
+                for ( auto pEntity : spawnedEntities )
+                {
+                    pEntity->m_isDeactivated = false;
+
+                    if ( pEntity->IsLoaded() && !VectorContains( m_entitiesCurrentlyLoading, pEntity ) )
+                    {
+                        m_entitiesCurrentlyLoading.emplace_back( pEntity );
+                    }
+                }
+
+                instance.m_isActive = true;
+                m_numPooledSpawns++;
+                return;
+            }
+
+            // Instances with entities that are still waiting to be shutdown will become available during the next update
+            // Destroy any stale instances i.e. instances created from a previous version of the collection (removed entities already remove their instance)
+            if ( instance.m_collectionVersion != GetCollectionVersion( entityCollectionDesc ) || (int32_t) instance.m_entityIDs.size() != entityCollectionDesc.GetNumEntityDescriptors() )
+            {
+                TVector<EntityID> const entitiesToDestroy = instance.m_entityIDs;
+                RemovePooledInstance( &instance );
+
+                for ( auto const& entityID : entitiesToDestroy )
+                {
+                    if ( FindEntity( entityID ) != nullptr )
+                    {
+                        RemoveEntityInternal( entityID, true );
+                    }
+                }
+            }
+        }
+
+        // No free instances, so create a new one
+        //-------------------------------------------------------------------------
+
+        spawnedEntities.clear();
+        CreatePooledInstance( pool, pTaskSystem, typeRegistry, entityCollectionDesc );
+        PooledCollectionInstance& instance = *pool.m_instances.back();
+        instance.m_isActive = true;
+
+        bool const applyOffset = !offsetTransform.IsIdentity();
+        for ( auto const& entityID : instance.m_entityIDs )
+        {
+            Entity* pEntity = FindEntity( entityID );
+            EE_ASSERT( pEntity != nullptr );
+            pEntity->m_isDeactivated = false;
+
+            if ( applyOffset && pEntity->IsSpatialEntity() )
+            {
+                pEntity->SetWorldTransform( pEntity->GetWorldTransform() * offsetTransform );
+            }
+
+            spawnedEntities.emplace_back( pEntity );
+        }
+
+        m_numUnpooledSpawns++;
+    }
+
+    void EntityMap::ReleasePooledEntityCollection( EntityID entityID )
+    {
+        Threading::RecursiveScopeLock lock( m_mutex );
+
+        PooledCollectionInstance* pInstance = FindPooledInstance( entityID );
+        EE_ASSERT( pInstance != nullptr ); // Entity doesnt belong to a pooled collection!
+
+        // Releasing any entity of an instance releases the whole instance, so this might have already been released
+        if ( !pInstance->m_isActive )
+        {
+            return;
+        }
+
+        pInstance->m_isActive = false;
+
+        // Prevent initialization of any entities that are still loading and schedule the shutdown of initialized entities
+        for ( auto const& instanceEntityID : pInstance->m_entityIDs )
+        {
+            Entity* pEntity = FindEntity( instanceEntityID );
+            if ( pEntity == nullptr )
+            {
+                continue;
+            }
+
+            pEntity->m_isDeactivated = true;
+
+            if ( pEntity->IsInitialized() && !VectorContains( m_entitiesToDeactivate, pEntity ) )
+            {
+                m_entitiesToDeactivate.emplace_back( pEntity );
+            }
+        }
+    }
+
+    int32_t EntityMap::GetNumFreePooledInstances( ResourceID const& collectionID ) const
+    {
+        int32_t numFreeInstances = 0;
+        if ( EntityCollectionPool const* pPool = FindPool( collectionID ) )
+        {
+            for ( auto const pInstance : pPool->m_instances )
+            {
+                numFreeInstances += pInstance->m_isActive ? 0 : 1;
+            }
+        }
+
+        return numFreeInstances;
+    }
+
+    EntityMap::PoolStats EntityMap::GetPoolStats() const
+    {
+        PoolStats stats;
+        stats.m_numPools = (int32_t) m_pools.size();
+        stats.m_numPooledSpawns = m_numPooledSpawns;
+        stats.m_numUnpooledSpawns = m_numUnpooledSpawns;
+
+        for ( auto const& pool : m_pools )
+        {
+            for ( auto const pInstance : pool.m_instances )
+            {
+                if ( pInstance->m_isActive )
+                {
+                    stats.m_numActiveInstances++;
+                }
+                else
+                {
+                    stats.m_numInactiveInstances++;
+                }
+            }
+        }
+
+        return stats;
+    }
+
+    //-------------------------------------------------------------------------
+
     void EntityMap::OnEntityStateUpdated( Entity* pEntity )
     {
         if ( pEntity->GetMapID() == m_ID )
@@ -317,7 +661,7 @@ namespace EE::EntityModel
         if ( m_pMapDesc->IsValid() )
         {
             // Create all required entities
-            TVector<Entity*> const createdEntities = Serializer::CreateEntities( loadingContext.m_pTaskSystem, *loadingContext.m_pTypeRegistry, *m_pMapDesc.GetPtr() );
+            TVector<Entity*> const createdEntities = Serializer::CreateEntities( loadingContext.m_pTaskSystem, *loadingContext.m_pTypeRegistry, *m_pMapDesc.GetPtr(), &m_componentPool );
 
             // Reserve memory for new entities in internal structures
             m_entities.reserve( m_entities.size() + createdEntities.size() );
@@ -363,6 +707,18 @@ namespace EE::EntityModel
 
         m_entitiesCurrentlyLoading.clear();
         m_entitiesToLoad.clear();
+        m_entitiesToDeactivate.clear();
+
+        for ( auto& pool : m_pools )
+        {
+            for ( auto pInstance : pool.m_instances )
+            {
+                EE::Delete( pInstance );
+            }
+        }
+
+        m_pools.clear();
+        m_pooledInstanceLookupMap.clear();
 
         // Shutdown all entities
         //-------------------------------------------------------------------------
@@ -439,6 +795,9 @@ namespace EE::EntityModel
         m_entityNameLookupMap.clear();
         #endif
 
+        // Any components still alive (i.e. entities that were removed from the map) will keep their slabs alive
+        m_componentPool.Reset();
+
         // Unload the map resource
         //-------------------------------------------------------------------------
 
@@ -467,10 +826,28 @@ namespace EE::EntityModel
         }
     }
 
+    void EntityMap::ProcessEntityDeactivationRequests( InitializationContext& initializationContext )
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Entity Deactivation" );
+
+        // Pooled collections are stored in creation order, so parents will always be shutdown before their attached entities
+        for ( auto pEntityToDeactivate : m_entitiesToDeactivate )
+        {
+            EE_ASSERT( pEntityToDeactivate->IsDeactivated() );
+            if ( pEntityToDeactivate->IsInitialized() )
+            {
+                pEntityToDeactivate->Shutdown( initializationContext );
+            }
+        }
+
+        m_entitiesToDeactivate.clear();
+    }
+
     void EntityMap::ProcessEntityRemovalRequests( LoadingContext const& loadingContext )
     {
         EE_PROFILE_SCOPE_ENTITY( "Entity Removal" );
 
+        bool wereEntitiesDestroyed = false;
         for ( int32_t i = (int32_t) m_entitiesToRemove.size() - 1; i >= 0; i-- )
         {
             auto& removalRequest = m_entitiesToRemove[i];
@@ -488,11 +865,18 @@ namespace EE::EntityModel
             if ( removalRequest.m_shouldDestroy )
             {
                 EE::Delete( pEntityToRemove );
+                wereEntitiesDestroyed = true;
             }
 
             // Remove the request from the list
             m_entitiesToRemove.erase_unsorted( m_entitiesToRemove.begin() + i );
         }
+
+        // Free the component memory of any fully destroyed collections
+        if ( wereEntitiesDestroyed )
+        {
+            m_componentPool.ReleaseEmptySlabs();
+        }
     }
 
     void EntityMap::ProcessEntityLoadingAndInitialization( LoadingContext const& loadingContext, InitializationContext& initializationContext )
@@ -541,8 +925,8 @@ namespace EE::EntityModel
                         }
                         #endif
 
-                        // Initialize any entities that loaded successfully
-                        if ( pEntity->IsLoaded() )
+                        // Initialize any entities that loaded successfully, deactivated entities remain loaded until they are reactivated
+                        if ( pEntity->IsLoaded() && !pEntity->IsDeactivated() )
                         {
                             // Prevent us from initializing entities whose parents are not yet initialized, this ensures that our attachment chains have a consistent initialized state
                             if ( pEntity->HasSpatialParent() )
@@ -636,13 +1020,14 @@ namespace EE::EntityModel
         //-------------------------------------------------------------------------
 
         // Create a task that splits per-system registration across multiple threads
+        // Each system only receives the components that were routed to it (i.e. the component types it declared an interest in)
         struct ComponentRegistrationTask : public ITaskSet
         {
-            ComponentRegistrationTask( TVector<EntityWorldSystem*> const& worldSystems, TVector<EntityModel::EntityComponentPair> const& componentsToRegister, TVector<EntityModel::EntityComponentPair> const& componentsToUnregister )
+            ComponentRegistrationTask( TVector<EntityWorldSystem*> const& worldSystems, TVector<ComponentRoutingTable::SystemRegistrationList> const& systemRegistrationLists )
                 : m_worldSystems( worldSystems )
-                , m_componentsToRegister( componentsToRegister )
-                , m_componentsToUnregister( componentsToUnregister )
+                , m_systemRegistrationLists( systemRegistrationLists )
             {
+                EE_ASSERT( m_worldSystems.size() == m_systemRegistrationLists.size() );
                 m_SetSize = (uint32_t) worldSystems.size();
             }
 
@@ -656,40 +1041,32 @@ namespace EE::EntityModel
                 for ( uint64_t i = range.start; i < range.end; ++i )
                 {
                     auto pSystem = m_worldSystems[i];
+                    auto const& registrationList = m_systemRegistrationLists[i];
 
                     //-------------------------------------------------------------------------
 
-                    size_t const numComponentsToUnregister = m_componentsToUnregister.size();
-                    for ( auto c = 0u; c < numComponentsToUnregister; c++ )
+                    for ( auto const& pair : registrationList.m_componentsToUnregister )
                     {
-                        auto pEntity = m_componentsToUnregister[c].m_pEntity;
-                        auto pComponent = m_componentsToUnregister[c].m_pComponent;
-
-                        EE_ASSERT( pEntity != nullptr );
-                        EE_ASSERT( pComponent != nullptr && pComponent->IsInitialized() && pComponent->m_isRegisteredWithWorld );
-                        pSystem->UnregisterComponent( pEntity, pComponent );
+                        EE_ASSERT( pair.m_pEntity != nullptr );
+                        EE_ASSERT( pair.m_pComponent != nullptr && pair.m_pComponent->IsInitialized() && pair.m_pComponent->m_isRegisteredWithWorld );
+                        pSystem->UnregisterComponent( pair.m_pEntity, pair.m_pComponent );
                     }
 
                     //-------------------------------------------------------------------------
 
-                    size_t const numComponentsToRegister = m_componentsToRegister.size();
-                    for ( auto c = 0u; c < numComponentsToRegister; c++ )
+                    for ( auto const& pair : registrationList.m_componentsToRegister )
                     {
-                        auto pEntity = m_componentsToRegister[c].m_pEntity;
-                        auto pComponent = m_componentsToRegister[c].m_pComponent;
-
-                        EE_ASSERT( pEntity != nullptr && pEntity->IsInitialized() && !pComponent->m_isRegisteredWithWorld );
-                        EE_ASSERT( pComponent != nullptr && pComponent->IsInitialized() );
-                        pSystem->RegisterComponent( pEntity, pComponent );
+                        EE_ASSERT( pair.m_pEntity != nullptr && pair.m_pEntity->IsInitialized() && !pair.m_pComponent->m_isRegisteredWithWorld );
+                        EE_ASSERT( pair.m_pComponent != nullptr && pair.m_pComponent->IsInitialized() );
+                        pSystem->RegisterComponent( pair.m_pEntity, pair.m_pComponent );
                     }
                 }
             }
 
         private:
 
-            TVector<EntityWorldSystem*> const&                         m_worldSystems;
-            TVector<EntityModel::EntityComponentPair> const&            m_componentsToRegister;
-            TVector<EntityModel::EntityComponentPair> const&            m_componentsToUnregister;
+            TVector<EntityWorldSystem*> const&                                  m_worldSystems;
+            TVector<ComponentRoutingTable::SystemRegistrationList> const&       m_systemRegistrationLists;
         };
 
         //-------------------------------------------------------------------------
@@ -721,7 +1098,8 @@ namespace EE::EntityModel
 
             if ( ( numComponentsToUnregister + numComponentsToRegister ) > 0 )
             {
-                ComponentRegistrationTask componentRegistrationTask( initializationContext.m_worldSystems, componentsToRegister, componentsToUnregister );
+                auto const& systemRegistrationLists = initializationContext.m_pComponentRoutingTable->RouteComponents( componentsToRegister, componentsToUnregister );
+                ComponentRegistrationTask componentRegistrationTask( initializationContext.m_worldSystems, systemRegistrationLists );
                 initializationContext.m_pTaskSystem->ScheduleTask( &componentRegistrationTask );
                 initializationContext.m_pTaskSystem->WaitForTask( &componentRegistrationTask );
             }
@@ -800,6 +1178,7 @@ namespace EE::EntityModel
         // Process entity removal requests
         //-------------------------------------------------------------------------
 
+        ProcessEntityDeactivationRequests( initializationContext );
         ProcessEntityShutdownRequests( initializationContext );
         ProcessEntityRegistrationRequests( initializationContext );
         ProcessEntityRemovalRequests( loadingContext );
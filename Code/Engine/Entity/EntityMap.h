@@ -2,6 +2,7 @@
 
 #include "Engine/_Module/API.h"
 #include "EntityDescriptors.h"
+#include "EntityComponentPool.h"
 #include "Base/Types/Event.h"
 #include "Base/Threading/Threading.h"
 #include "Base/Resource/ResourcePtr.h"
@@ -52,6 +53,33 @@ namespace EE
                 bool        m_shouldDestroy = false;
             };
 
+            // A single instantiation of a pooled collection, entities are stored in the same order as the collection's descriptors
+            struct PooledCollectionInstance
+            {
+                ResourceID                          m_collectionID;
+                TVector<EntityID>                   m_entityIDs;
+                uint64_t                            m_collectionVersion = 0;    // The version of the collection this was instantiated from, a hot-reload invalidates the instance
+                bool                                m_isActive = false;
+            };
+
+            // All pooled instances for a given entity collection
+            struct EntityCollectionPool
+            {
+                ResourceID                          m_collectionID;
+                TVector<PooledCollectionInstance*>  m_instances;
+            };
+
+        public:
+
+            struct PoolStats
+            {
+                int32_t                         m_numPools = 0;
+                int32_t                         m_numActiveInstances = 0;
+                int32_t                         m_numInactiveInstances = 0;
+                int32_t                         m_numPooledSpawns = 0;          // Number of spawns that were serviced from the pool
+                int32_t                         m_numUnpooledSpawns = 0;        // Number of spawns that required a new instantiation of the collection
+            };
+
         public:
 
             EntityMap(); // Default constructor creates a transient map
@@ -83,7 +111,7 @@ namespace EE
             bool UpdateLoadingAndStateChanges( LoadingContext const& loadingContext, InitializationContext& initializationContext );
 
             // Do we have any pending entity addition or removal requests?
-            inline bool HasPendingAddOrRemoveRequests() const { return ( m_entitiesToLoad.size() + m_entitiesToRemove.size() ) > 0; }
+            inline bool HasPendingAddOrRemoveRequests() const { return ( m_entitiesToLoad.size() + m_entitiesToRemove.size() + m_entitiesToDeactivate.size() ) > 0; }
 
             bool IsLoading() const { return m_status == Status::Loading; }
             inline bool IsLoaded() const { return m_status == Status::Loaded; }
@@ -119,6 +147,7 @@ namespace EE
             // Instantiates and adds an entity collection to the map
             // Additionally allows you to offset all the entities via the supplied offset transform
             // Takes 1 frame to be fully added
+            // Since these entities can be destroyed at any time, their components are allocated individually rather than from the map's component pool
             void AddEntityCollection( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollectionDesc, Transform const& offsetTransform = Transform::Identity, TVector<Entity*>* pOutCreatedEntities = nullptr );
 
             // Add a newly created entity to the map - Transfers ownership of the entity to the map
@@ -131,8 +160,37 @@ namespace EE
 
             // Unload, remove and destroy entity in this map
             // May take multiple frames to be fully destroyed, as the removal occurs during the loading update
+            // Removing or destroying a pooled entity removes its instance from the pool, use ReleasePooledEntityCollection to return an instance to its pool instead
             void DestroyEntity( EntityID entityID );
 
+            //-------------------------------------------------------------------------
+            // Entity Pooling
+            //-------------------------------------------------------------------------
+            // Pooled collections are instantiated ahead of time, added to the map and loaded but never initialized.
+            // Spawning a pooled collection resets and re-activates an existing instance so only the world registration cost is paid.
+            // The collection resource needs to remain loaded for as long as the pool is in use.
+
+            // Instantiate and load additional deactivated instances of an entity collection
+            void PrewarmEntityCollection( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollectionDesc, int32_t numInstances );
+
+            // Activates a pooled instance of an entity collection, if no free instances exist, a new instance will be created
+            // Additionally allows you to offset all the entities via the supplied offset transform
+            // Takes 1 frame to be fully added
+            void SpawnPooledEntityCollection( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollectionDesc, Transform const& offsetTransform = Transform::Identity, TVector<Entity*>* pOutCreatedEntities = nullptr );
+
+            // Deactivates the pooled instance that the specified entity belongs to and returns it to the pool
+            // The instance's entities are shutdown during the next loading update but remain loaded, releasing an already released instance does nothing
+            void ReleasePooledEntityCollection( EntityID entityID );
+
+            // Get the number of free (deactivated) instances for a given collection
+            int32_t GetNumFreePooledInstances( ResourceID const& collectionID ) const;
+
+            // Get the current pool usage for this map
+            PoolStats GetPoolStats() const;
+
+            // Get the memory reserved for the components instantiated by this map
+            inline ComponentPool::Stats GetComponentPoolStats() const { return m_componentPool.GetStats(); }
+
             //-------------------------------------------------------------------------
             // Tools API
             //-------------------------------------------------------------------------
@@ -179,9 +237,21 @@ namespace EE
             void ProcessEntityRemovalRequests( LoadingContext const& loadingContext );
             void ProcessEntityLoadingAndInitialization( LoadingContext const& loadingContext, InitializationContext& initializationContext );
 
+            void ProcessEntityDeactivationRequests( InitializationContext& initializationContext );
+
             // Remove entity
             Entity* RemoveEntityInternal( EntityID entityID, bool destroyEntityOnceRemoved );
 
+            // Pooling
+            EntityCollectionPool* FindPool( ResourceID const& collectionID );
+            EntityCollectionPool const* FindPool( ResourceID const& collectionID ) const { return const_cast<EntityMap*>( this )->FindPool( collectionID ); }
+            EntityCollectionPool& FindOrCreatePool( ResourceID const& collectionID );
+            PooledCollectionInstance* FindPooledInstance( EntityID entityID );
+            void RemovePooledInstance( PooledCollectionInstance* pInstance );
+            void DetachPooledEntity( EntityID entityID );
+            void CreatePooledInstance( EntityCollectionPool& pool, TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollectionDesc );
+            bool ResetPooledInstance( PooledCollectionInstance const& instance, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollectionDesc, Transform const& offsetTransform, TVector<Entity*>& outEntities );
+
         private:
 
             EntityMapID                                 m_ID = UUID::GenerateID(); // ID is always regenerated at creation time, do not rely on the ID being the same for a map on different runs
@@ -192,6 +262,12 @@ namespace EE
             TVector<Entity*>                            m_entitiesCurrentlyLoading;
             TInlineVector<Entity*, 5>                   m_entitiesToLoad;
             TInlineVector<RemovalRequest, 5>            m_entitiesToRemove;
+            TVector<Entity*>                            m_entitiesToDeactivate;
+            TVector<EntityCollectionPool>               m_pools;
+            THashMap<EntityID, PooledCollectionInstance*> m_pooledInstanceLookupMap;  // Entity ID -> pooled instance it belongs to
+            ComponentPool                               m_componentPool;        // Per-type storage for the components of the map's own entities and its pooled collections
+            int32_t                                     m_numPooledSpawns = 0;
+            int32_t                                     m_numUnpooledSpawns = 0;
             EventBindingID                              m_entityUpdateEventBindingID;
             Status                                      m_status = Status::Unloaded;
             bool const                                  m_isTransientMap = false; // If this is set, then this is a transient map i.e.created and managed at runtime and not loaded from disk
@@ -13,7 +13,7 @@
 
 namespace EE::EntityModel
 {
-    Entity* Serializer::CreateEntity( TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityDescriptor const& entityDesc )
+    Entity* Serializer::CreateEntity( TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityDescriptor const& entityDesc, ComponentPool::ComponentAllocation const* pComponentAllocations )
     {
         EE_ASSERT( entityDesc.IsValid() );
 
@@ -38,9 +38,23 @@ namespace EE::EntityModel
         //-------------------------------------------------------------------------
         // Component descriptors are sorted during compilation, spatial components are first, followed by regular components
 
-        for ( EntityModel::SerializedComponentDescriptor const& componentDesc : entityDesc.m_components )
+        int32_t const numComponents = (int32_t) entityDesc.m_components.size();
+        for ( int32_t componentIdx = 0; componentIdx < numComponents; componentIdx++ )
         {
-            auto pEntityComponent = componentDesc.CreateTypeInstance<EntityComponent>( typeRegistry );
+            EntityModel::SerializedComponentDescriptor const& componentDesc = entityDesc.m_components[componentIdx];
+
+            EntityComponent* pEntityComponent = nullptr;
+            if ( pComponentAllocations != nullptr )
+            {
+                ComponentPool::ComponentAllocation const& allocation = pComponentAllocations[componentIdx];
+                EE_ASSERT( allocation.m_pMemory != nullptr && allocation.m_pSlab->GetTypeInfo()->m_ID == componentDesc.m_typeID );
+                pEntityComponent = componentDesc.CreateTypeInstanceInPlace<EntityComponent>( typeRegistry, allocation.m_pSlab->GetTypeInfo(), reinterpret_cast<IReflectedType*>( allocation.m_pMemory ) );
+                pEntityComponent->m_pPoolSlab = allocation.m_pSlab;
+            }
+            else
+            {
+                pEntityComponent = componentDesc.CreateTypeInstance<EntityComponent>( typeRegistry );
+            }
             EE_ASSERT( pEntityComponent != nullptr );
 
             TypeSystem::TypeInfo const* pTypeInfo = pEntityComponent->GetTypeInfo();
@@ -131,7 +145,7 @@ namespace EE::EntityModel
         return pEntity;
     }
 
-    TVector<Entity*> Serializer::CreateEntities( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollection )
+    TVector<Entity*> Serializer::CreateEntities( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollection, ComponentPool* pComponentPool )
     {
         EE_PROFILE_SCOPE_ENTITY( "Instantiate Entity Collection" );
 
@@ -139,6 +153,31 @@ namespace EE::EntityModel
         TVector<Entity*> createdEntities;
         createdEntities.resize( numEntitiesToCreate );
 
+        // Reserve the component memory up front, so that the components are laid out in collection order regardless of how the creation is spread over threads
+        //-------------------------------------------------------------------------
+
+        TVector<ComponentPool::ComponentAllocation> componentAllocations;
+        TVector<int32_t> firstComponentAllocationIndices;
+
+        if ( pComponentPool != nullptr )
+        {
+            pComponentPool->AllocateCollection( typeRegistry, entityCollection, componentAllocations );
+
+            firstComponentAllocationIndices.resize( numEntitiesToCreate );
+            int32_t numComponents = 0;
+            for ( auto i = 0; i < numEntitiesToCreate; i++ )
+            {
+                firstComponentAllocationIndices[i] = numComponents;
+                numComponents += (int32_t) entityCollection.m_entityDescriptors[i].m_components.size();
+            }
+            EE_ASSERT( numComponents == componentAllocations.size() );
+        }
+
+        auto GetComponentAllocations = [&componentAllocations, &firstComponentAllocationIndices] ( int32_t entityIdx ) -> ComponentPool::ComponentAllocation const*
+        {
+            return componentAllocations.empty() ? nullptr : componentAllocations.data() + firstComponentAllocationIndices[entityIdx];
+        };
+
         //-------------------------------------------------------------------------
 
         // For small number of entities, just create them inline!
@@ -146,17 +185,19 @@ namespace EE::EntityModel
         {
             for ( auto i = 0; i < numEntitiesToCreate; i++ )
             {
-                createdEntities[i] = CreateEntity( typeRegistry, entityCollection.m_entityDescriptors[i] );
+                createdEntities[i] = CreateEntity( typeRegistry, entityCollection.m_entityDescriptors[i], GetComponentAllocations( i ) );
             }
         }
         else // Go wide and create all entities in parallel
         {
             struct EntityCreationTask : public ITaskSet
             {
-                EntityCreationTask( TypeSystem::TypeRegistry const& typeRegistry, TVector<SerializedEntityDescriptor> const& descriptors, TVector<Entity*>& createdEntities )
+                EntityCreationTask( TypeSystem::TypeRegistry const& typeRegistry, TVector<SerializedEntityDescriptor> const& descriptors, TVector<Entity*>& createdEntities, TVector<ComponentPool::ComponentAllocation> const& componentAllocations, TVector<int32_t> const& firstComponentAllocationIndices )
                     : m_typeRegistry( typeRegistry )
                     , m_descriptors( descriptors )
                     , m_createdEntities( createdEntities )
+                    , m_componentAllocations( componentAllocations )
+                    , m_firstComponentAllocationIndices( firstComponentAllocationIndices )
                 {
                     m_SetSize = (uint32_t) descriptors.size();
                     m_MinRange = 10;
@@ -167,7 +208,8 @@ namespace EE::EntityModel
                     EE_PROFILE_SCOPE_ENTITY( "Entity Creation Task" );
                     for ( uint64_t i = range.start; i < range.end; ++i )
                     {
-                        m_createdEntities[i] = CreateEntity( m_typeRegistry, m_descriptors[i] );
+                        ComponentPool::ComponentAllocation const* pComponentAllocations = m_componentAllocations.empty() ? nullptr : m_componentAllocations.data() + m_firstComponentAllocationIndices[i];
+                        m_createdEntities[i] = CreateEntity( m_typeRegistry, m_descriptors[i], pComponentAllocations );
                     }
                 }
 
@@ -176,12 +218,14 @@ namespace EE::EntityModel
                 TypeSystem::TypeRegistry const&                     m_typeRegistry;
                 TVector<SerializedEntityDescriptor> const&          m_descriptors;
                 TVector<Entity*>&                                   m_createdEntities;
+                TVector<ComponentPool::ComponentAllocation> const&  m_componentAllocations;
+                TVector<int32_t> const&                             m_firstComponentAllocationIndices;
             };
 
             //-------------------------------------------------------------------------
 
             // Create all entities in parallel
-            EntityCreationTask updateTask( typeRegistry, entityCollection.m_entityDescriptors, createdEntities );
+            EntityCreationTask updateTask( typeRegistry, entityCollection.m_entityDescriptors, createdEntities, componentAllocations, firstComponentAllocationIndices );
             pTaskSystem->ScheduleTask( &updateTask );
             pTaskSystem->WaitForTask( &updateTask );
         }
@@ -1,5 +1,6 @@
 #pragma once
 #include "Engine/_Module/API.h"
+#include "EntityComponentPool.h"
 #include "Base/Types/Containers_ForwardDecl.h"
 
 //-------------------------------------------------------------------------
@@ -18,8 +19,11 @@ namespace EE::EntityModel
 {
     struct EE_ENGINE_API Serializer
     {
-        static Entity* CreateEntity( TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityDescriptor const& entityDesc );
-        static TVector<Entity*> CreateEntities( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollection );
+        // If component allocations are supplied (one per component descriptor), the components are constructed in that memory rather than individually allocated
+        static Entity* CreateEntity( TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityDescriptor const& entityDesc, ComponentPool::ComponentAllocation const* pComponentAllocations = nullptr );
+
+        // If a component pool is supplied, all components will be allocated from per-type slabs in that pool
+        static TVector<Entity*> CreateEntities( TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollection, ComponentPool* pComponentPool = nullptr );
 
         //-------------------------------------------------------------------------
 
@@ -1,6 +1,7 @@
 #include "EntityWorld.h"
 #include "EntityWorldUpdateContext.h"
 #include "Base/Resource/ResourceSystem.h"
+#include "Base/Logging/Log.h"
 #include "Base/Profiling.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include <eastl/sort.h>
@@ -55,6 +56,8 @@ namespace EE
         m_initializationContext.SetComponentTypeMapPtr( &m_componentTypeLookup );
         #endif
 
+        m_initializationContext.SetComponentRoutingTablePtr( &m_componentRoutingTable );
+
         EE_ASSERT( m_initializationContext.IsValid() );
 
         // Create World Systems
@@ -88,6 +91,15 @@ namespace EE
             }
         }
 
+        // Build the per-stage update schedules once all systems have been created
+        for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+        {
+            m_systemScheduler.BuildSchedule( (UpdateStage) i, m_systemUpdateLists[i] );
+        }
+
+        // Build the component routing table from the systems' declared component interests
+        m_componentRoutingTable.Initialize( m_loadingContext.m_pTypeRegistry, m_worldSystems );
+
         // Create and initialize the persistent map
         //-------------------------------------------------------------------------
 
@@ -120,6 +132,8 @@ namespace EE
         // Shutdown all world systems
         //-------------------------------------------------------------------------
 
+        m_systemScheduler.Clear();
+
         for( auto pWorldSystem : m_worldSystems )
         {
             // Remove from update lists
@@ -139,6 +153,7 @@ namespace EE
         }
 
         m_worldSystems.clear();
+        m_componentRoutingTable.Shutdown();
 
         //-------------------------------------------------------------------------
 
@@ -192,7 +207,7 @@ namespace EE
 
     void EntityWorld::Update( UpdateContext const& context )
     {
-        EE_ASSERT( Threading::IsMainThread() );
+        EE_ASSERT( Threading::IsMainThread() || m_isIndependentUpdateEnabled );
         EE_ASSERT( !m_isSuspended );
 
         struct EntityUpdateTask final : public ITaskSet
@@ -282,11 +297,9 @@ namespace EE
         // Update systems
         //-------------------------------------------------------------------------
 
-        for ( auto pSystem : m_systemUpdateLists[(int8_t) updateStage] )
         {
             EE_PROFILE_SCOPE_ENTITY( "Update World Systems" );
-            EE_ASSERT( pSystem->GetRequiredUpdatePriorities().IsStageEnabled( updateStage ) );
-            pSystem->UpdateSystem( entityWorldUpdateContext );
+            m_systemScheduler.Update( m_pTaskSystem, updateStage, entityWorldUpdateContext );
         }
 
         //-------------------------------------------------------------------------
@@ -297,6 +310,32 @@ namespace EE
         }
     }
 
+    void EntityWorld::RecordStageUpdateTime( UpdateStage stage, Milliseconds updateTime )
+    {
+        if ( stage == UpdateStage::FrameStart )
+        {
+            m_lastFrameUpdateTime = m_currentFrameUpdateTime;
+            m_currentFrameUpdateTime = 0.0f;
+
+            bool const wasOverBudget = m_isOverBudget;
+            m_isOverBudget = ( m_updateBudget > 0.0f ) && ( m_lastFrameUpdateTime > m_updateBudget );
+            if ( m_isOverBudget )
+            {
+                m_numFramesOverBudget++;
+
+                #if EE_DEVELOPMENT_TOOLS
+                if ( !wasOverBudget )
+                {
+                    EE_LOG_WARNING( "Entity", "World Update", "World '%s' exceeded its update budget: %.2fms / %.2fms", m_debugName.c_str(), m_lastFrameUpdateTime.ToFloat(), m_updateBudget.ToFloat() );
+                }
+                #endif
+            }
+        }
+
+        m_stageUpdateTimes[(int8_t) stage] = updateTime;
+        m_currentFrameUpdateTime += updateTime;
+    }
+
     //-------------------------------------------------------------------------
     // Maps
     //-------------------------------------------------------------------------
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "EntityWorldSystem.h"
+#include "EntityWorldSystemScheduler.h"
 #include "EntityContexts.h"
+#include "EntityComponentRouting.h"
 #include "Entity.h"
 #include "EntityMap.h"
 #include "Base/Render/RenderViewport.h"
@@ -23,6 +25,7 @@ namespace EE
     {
         friend class EntityDebugView;
         friend class EntityWorldUpdateContext;
+        friend class EntityWorldManager;
 
     public:
 
@@ -53,6 +56,31 @@ namespace EE
         // Run entity and system updates
         void Update( UpdateContext const& context );
 
+        // Independent worlds dont share any non-thread-safe state with other worlds and can be updated concurrently from a worker thread
+        // Only flag worlds whose systems dont touch global engine state during their update (e.g. tools preview worlds)
+        inline bool IsIndependentUpdateEnabled() const { return m_isIndependentUpdateEnabled; }
+        inline void SetIndependentUpdateEnabled( bool isEnabled ) { EE_ASSERT( Threading::IsMainThread() ); m_isIndependentUpdateEnabled = isEnabled; }
+
+        //-------------------------------------------------------------------------
+        // Update Timing
+        //-------------------------------------------------------------------------
+
+        // Get the time spent updating this world in the last update of the specified stage
+        inline Milliseconds GetLastStageUpdateTime( UpdateStage stage ) const { return m_stageUpdateTimes[(int8_t) stage]; }
+
+        // Get the total time spent updating this world last frame
+        inline Milliseconds GetLastFrameUpdateTime() const { return m_lastFrameUpdateTime; }
+
+        // The update budget for this world per frame, a budget <= 0 means the world has no budget
+        inline Milliseconds GetUpdateBudget() const { return m_updateBudget; }
+        inline void SetUpdateBudget( Milliseconds budget ) { m_updateBudget = budget; }
+
+        // Did the world exceed its budget last frame
+        inline bool IsOverBudget() const { return m_isOverBudget; }
+
+        // How many frames has this world exceeded its budget since it was created
+        inline uint32_t GetNumFramesOverBudget() const { return m_numFramesOverBudget; }
+
         // This function will handle all actual loading/unloading operations for the world/maps.
         // Any queued requests will be handled here as will any requests to the resource system.
         void UpdateLoading();
@@ -66,6 +94,11 @@ namespace EE
         template<typename T>
         inline T* GetWorldSystem() const { return reinterpret_cast<T*>( GetWorldSystem( T::s_entitySystemID ) ); }
 
+        #if EE_DEVELOPMENT_TOOLS
+        // Get the table used to route registered components to the interested world systems
+        inline EntityModel::ComponentRoutingTable& GetComponentRoutingTable() { return m_componentRoutingTable; }
+        #endif
+
         //-------------------------------------------------------------------------
         // Input
         //-------------------------------------------------------------------------
@@ -256,6 +289,9 @@ namespace EE
 
         inline Drawing::DrawingSystem* GetDebugDrawingSystem() { return &m_debugDrawingSystem; }
         inline void ResetDebugDrawingSystem() { m_debugDrawingSystem.Reset(); }
+
+        inline EntityWorldSystemScheduler const& GetSystemScheduler() const { return m_systemScheduler; }
+        inline void SetParallelSystemUpdatesEnabled( bool isEnabled ) { m_systemScheduler.SetParallelUpdateEnabled( isEnabled ); }
         #endif
 
         //-------------------------------------------------------------------------
@@ -270,6 +306,11 @@ namespace EE
         void HotReload_ReloadEntities();
         #endif
 
+    private:
+
+        // Called by the world manager after each stage update, the frame time and budget are evaluated when the next frame starts
+        void RecordStageUpdateTime( UpdateStage stage, Milliseconds updateTime );
+
     private:
 
         EntityWorldID                                                           m_worldID = UUID::GenerateID();
@@ -278,9 +319,11 @@ namespace EE
         EntityModel::LoadingContext                                             m_loadingContext;
         EntityModel::InitializationContext                                      m_initializationContext;
         TVector<EntityWorldSystem*>                                             m_worldSystems;
+        EntityModel::ComponentRoutingTable                                      m_componentRoutingTable;
         EntityWorldType                                                         m_worldType = EntityWorldType::Game;
         bool                                                                    m_initialized = false;
         bool                                                                    m_isSuspended = false;
+        bool                                                                    m_isIndependentUpdateEnabled = false;
         Render::Viewport                                                        m_viewport = Render::Viewport( Int2::Zero, Int2( 640, 480 ), Math::ViewVolume( Float2( 640, 480 ), FloatRange( 0.1f, 100.0f ) ) );
 
         // Maps
@@ -289,6 +332,15 @@ namespace EE
         // Entities
         TVector<Entity*>                                                        m_entityUpdateList;
         TVector<EntityWorldSystem*>                                             m_systemUpdateLists[(int8_t) UpdateStage::NumStages];
+        EntityWorldSystemScheduler                                              m_systemScheduler;
+
+        // Update Timing
+        Milliseconds                                                            m_stageUpdateTimes[(int8_t) UpdateStage::NumStages];
+        Milliseconds                                                            m_currentFrameUpdateTime = 0.0f;
+        Milliseconds                                                            m_lastFrameUpdateTime = 0.0f;
+        Milliseconds                                                            m_updateBudget = 0.0f;
+        uint32_t                                                                m_numFramesOverBudget = 0;
+        bool                                                                    m_isOverBudget = false;
 
         // Time Scaling + Pause
         float                                                                   m_timeScale = 1.0f; // <= 0 means that the world is paused
@@ -6,6 +6,9 @@
 #include "Engine/Camera/Components/Component_Camera.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Engine/UpdateContext.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Time/Timers.h"
+#include "Base/Profiling.h"
 #include "Base/Systems.h"
 
 //-------------------------------------------------------------------------
@@ -20,6 +23,8 @@ namespace EE
     void EntityWorldManager::Initialize( SystemRegistry const& systemsRegistry )
     {
         m_pSystemsRegistry = &systemsRegistry;
+        m_pTaskSystem = systemsRegistry.GetSystem<TaskSystem>();
+        EE_ASSERT( m_pTaskSystem != nullptr );
 
         //-------------------------------------------------------------------------
 
@@ -45,6 +50,7 @@ namespace EE
         //-------------------------------------------------------------------------
 
         m_worldSystemTypeInfos.clear();
+        m_pTaskSystem = nullptr;
         m_pSystemsRegistry = nullptr;
     }
 
@@ -155,37 +161,13 @@ namespace EE
         }
     }
 
-    void EntityWorldManager::UpdateWorlds( UpdateContext const& context )
+    void EntityWorldManager::UpdateWorld( UpdateContext const& context, EntityWorld* pWorld )
     {
-        //-------------------------------------------------------------------------
-        // World Update
-        //-------------------------------------------------------------------------
+        EE_PROFILE_SCOPE_ENTITY( "Update World" );
 
-        for ( auto const& pWorld : m_worlds )
+        Milliseconds updateTime = 0.0f;
         {
-            if ( pWorld->IsSuspended() )
-            {
-                continue;
-            }
-
-            // Reflect input state
-            //-------------------------------------------------------------------------
-
-            if ( context.GetUpdateStage() == UpdateStage::FrameStart )
-            {
-                auto pPlayerManager = pWorld->GetWorldSystem<PlayerManager>();
-                auto pWorldInputState = pWorld->GetInputState();
-
-                if ( pPlayerManager->IsPlayerEnabled() )
-                {
-                    auto pInputSystem = context.GetSystem<Input::InputSystem>();
-                    pInputSystem->ReflectState( context.GetDeltaTime(), pWorld->GetTimeScale(), *pWorldInputState );
-                }
-                else
-                {
-                    pWorldInputState->Clear();
-                }
-            }
+            ScopedTimer<PlatformClock> timer( updateTime );
 
             // Run world updates
             //-------------------------------------------------------------------------
@@ -220,6 +202,101 @@ namespace EE
             }
         }
 
+        pWorld->RecordStageUpdateTime( context.GetUpdateStage(), updateTime );
+    }
+
+    void EntityWorldManager::UpdateWorlds( UpdateContext const& context )
+    {
+        EE_ASSERT( Threading::IsMainThread() );
+
+        struct IndependentWorldUpdateTask final : public ITaskSet
+        {
+            IndependentWorldUpdateTask( EntityWorldManager* pWorldManager, UpdateContext const& context, TInlineVector<EntityWorld*, 5> const& worlds )
+                : m_pWorldManager( pWorldManager )
+                , m_context( context )
+                , m_worlds( worlds )
+            {
+                m_SetSize = (uint32_t) worlds.size();
+                m_MinRange = 1;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    m_pWorldManager->UpdateWorld( m_context, m_worlds[i] );
+                }
+            }
+
+        private:
+
+            EntityWorldManager*                         m_pWorldManager = nullptr;
+            UpdateContext const&                        m_context;
+            TInlineVector<EntityWorld*, 5> const&       m_worlds;
+        };
+
+        //-------------------------------------------------------------------------
+        // Reflect input state
+        //-------------------------------------------------------------------------
+
+        if ( context.GetUpdateStage() == UpdateStage::FrameStart )
+        {
+            auto pInputSystem = context.GetSystem<Input::InputSystem>();
+
+            for ( auto const& pWorld : m_worlds )
+            {
+                if ( pWorld->IsSuspended() )
+                {
+                    continue;
+                }
+
+                auto pPlayerManager = pWorld->GetWorldSystem<PlayerManager>();
+                auto pWorldInputState = pWorld->GetInputState();
+
+                if ( pPlayerManager->IsPlayerEnabled() )
+                {
+                    pInputSystem->ReflectState( context.GetDeltaTime(), pWorld->GetTimeScale(), *pWorldInputState );
+                }
+                else
+                {
+                    pWorldInputState->Clear();
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------
+        // World Update
+        //-------------------------------------------------------------------------
+        // Kick off all the independent worlds first so that they overlap with the main thread world updates
+
+        m_independentWorlds.clear();
+        for ( auto const& pWorld : m_worlds )
+        {
+            if ( !pWorld->IsSuspended() && pWorld->IsIndependentUpdateEnabled() )
+            {
+                m_independentWorlds.emplace_back( pWorld );
+            }
+        }
+
+        IndependentWorldUpdateTask independentWorldsTask( this, context, m_independentWorlds );
+        if ( !m_independentWorlds.empty() )
+        {
+            m_pTaskSystem->ScheduleTask( &independentWorldsTask );
+        }
+
+        for ( auto const& pWorld : m_worlds )
+        {
+            if ( !pWorld->IsSuspended() && !pWorld->IsIndependentUpdateEnabled() )
+            {
+                UpdateWorld( context, pWorld );
+            }
+        }
+
+        if ( !m_independentWorlds.empty() )
+        {
+            m_pTaskSystem->WaitForTask( &independentWorldsTask );
+        }
+
         //-------------------------------------------------------------------------
         // Handle Entity Log
         //-------------------------------------------------------------------------
@@ -12,6 +12,7 @@ namespace EE
     class UpdateContext;
     class EntityWorld;
     class SystemRegistry;
+    class TaskSystem;
     namespace TypeSystem { class TypeInfo; }
     namespace Render { class Viewport; }
 
@@ -65,6 +66,7 @@ namespace EE
         TInlineVector<EntityWorld*, 5> const& GetWorlds() const { return m_worlds; }
 
         // Run the world update - updates all entities, systems and camera
+        // Independent worlds are updated concurrently on the task system while the remaining worlds are updated on the main thread
         void UpdateWorlds( UpdateContext const& context );
 
         // Hot Reload
@@ -75,10 +77,17 @@ namespace EE
         void HotReload_ReloadEntities();
         #endif
 
+    private:
+
+        // Run the update for a single world and record its update time
+        void UpdateWorld( UpdateContext const& context, EntityWorld* pWorld );
+
     private:
 
         SystemRegistry const*                               m_pSystemsRegistry = nullptr;
+        TaskSystem*                                         m_pTaskSystem = nullptr;
         TInlineVector<EntityWorld*, 5>                      m_worlds;
+        TInlineVector<EntityWorld*, 5>                      m_independentWorlds;
         TVector<TypeSystem::TypeInfo const*>                m_worldSystemTypeInfos;
     };
 }
\ No newline at end of file
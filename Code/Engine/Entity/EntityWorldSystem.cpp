@@ -5,6 +5,62 @@
 
 namespace EE
 {
+    // Two component type accesses overlap if either type is derived from the other, since a system accessing a base type can touch derived components
+    static bool DoComponentAccessesOverlap( TypeSystem::TypeInfo const* pWrittenTypeInfo, TInlineVector<TypeSystem::TypeInfo const*, 6> const& accessedTypes )
+    {
+        for ( TypeSystem::TypeInfo const* pAccessedTypeInfo : accessedTypes )
+        {
+            if ( pWrittenTypeInfo->IsDerivedFrom( pAccessedTypeInfo ) || pAccessedTypeInfo->IsDerivedFrom( pWrittenTypeInfo ) )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool WorldSystemUpdateDependencies::ConflictsWith( WorldSystemUpdateDependencies const& rhs ) const
+    {
+        // Write/Write and Write/Read are conflicts, concurrent reads are fine
+        for ( TypeSystem::TypeInfo const* pWrittenTypeInfo : m_componentWrites )
+        {
+            if ( DoComponentAccessesOverlap( pWrittenTypeInfo, rhs.m_componentWrites ) || DoComponentAccessesOverlap( pWrittenTypeInfo, rhs.m_componentReads ) )
+            {
+                return true;
+            }
+        }
+
+        for ( TypeSystem::TypeInfo const* pWrittenTypeInfo : rhs.m_componentWrites )
+        {
+            if ( DoComponentAccessesOverlap( pWrittenTypeInfo, m_componentReads ) )
+            {
+                return true;
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        for ( uint32_t const writeID : m_resourceWrites )
+        {
+            if ( VectorContains( rhs.m_resourceWrites, writeID ) || VectorContains( rhs.m_resourceReads, writeID ) )
+            {
+                return true;
+            }
+        }
+
+        for ( uint32_t const writeID : rhs.m_resourceWrites )
+        {
+            if ( VectorContains( m_resourceReads, writeID ) )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+
     bool EntityWorldSystem::IsInAGameWorld() const
     {
         return m_pWorld->GetWorldType() == EntityWorldType::Game;
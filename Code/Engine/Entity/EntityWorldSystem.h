@@ -7,7 +7,7 @@
 #include "Base/TypeSystem/ReflectedType.h"
 #include "Base/Types/Arrays.h"
 #include "Base/Encoding/Hash.h"
-
+#include "Base/Types/StringID.h"
 
 //-------------------------------------------------------------------------
 // World Entity System
@@ -20,7 +20,54 @@ namespace EE
     class EntityWorldUpdateContext;
     class Entity;
     class EntityComponent;
-    namespace EntityModel { class EntityMap; }
+    namespace EntityModel { class EntityMap; class ComponentRoutingTable; }
+
+    //-------------------------------------------------------------------------
+    // World System Update Dependencies
+    //-------------------------------------------------------------------------
+    // Describes the data a world system accesses during an update stage, this lets the world update non-conflicting systems concurrently
+    // Access is declared against component types or named resources (i.e. a third-party simulation instance), ordering is declared against other systems
+    // Component type access covers all derived types, so reading a base component type conflicts with writing any of its derived types
+    // Systems that dont declare their dependencies are exclusive: they run on the thread updating the world with no other world system running
+
+    struct WorldSystemUpdateDependencies
+    {
+        template<typename T> inline WorldSystemUpdateDependencies& Reads() { EE_ASSERT( T::s_pTypeInfo != nullptr ); m_componentReads.emplace_back( T::s_pTypeInfo ); return *this; }
+        template<typename T> inline WorldSystemUpdateDependencies& Writes() { EE_ASSERT( T::s_pTypeInfo != nullptr ); m_componentWrites.emplace_back( T::s_pTypeInfo ); return *this; }
+
+        inline WorldSystemUpdateDependencies& ReadsResource( StringID resourceID ) { EE_ASSERT( resourceID.IsValid() ); m_resourceReads.emplace_back( resourceID.ToUint() ); return *this; }
+        inline WorldSystemUpdateDependencies& WritesResource( StringID resourceID ) { EE_ASSERT( resourceID.IsValid() ); m_resourceWrites.emplace_back( resourceID.ToUint() ); return *this; }
+
+        // Explicit ordering constraints, these only apply if both systems update in the same stage
+        template<typename T> inline WorldSystemUpdateDependencies& RunsBefore() { m_runsBefore.emplace_back( T::s_entitySystemID ); return *this; }
+        template<typename T> inline WorldSystemUpdateDependencies& RunsAfter() { m_runsAfter.emplace_back( T::s_entitySystemID ); return *this; }
+
+        // Do these two sets of accesses require the systems to be serialized
+        bool ConflictsWith( WorldSystemUpdateDependencies const& rhs ) const;
+
+    public:
+
+        TInlineVector<TypeSystem::TypeInfo const*, 6>   m_componentReads;
+        TInlineVector<TypeSystem::TypeInfo const*, 6>   m_componentWrites;
+        TInlineVector<uint32_t, 2>                      m_resourceReads;
+        TInlineVector<uint32_t, 2>                      m_resourceWrites;
+        TInlineVector<uint32_t, 2>          m_runsBefore;
+        TInlineVector<uint32_t, 2>          m_runsAfter;
+    };
+
+    //-------------------------------------------------------------------------
+    // World System Component Interests
+    //-------------------------------------------------------------------------
+    // The component types a world system needs to be registered with, the world will only route components of these types (or derived types) to the system
+
+    struct WorldSystemComponentInterests
+    {
+        template<typename T> inline WorldSystemComponentInterests& Includes() { m_componentTypeIDs.emplace_back( T::GetStaticTypeID() ); return *this; }
+
+    public:
+
+        TInlineVector<TypeSystem::TypeID, 8>    m_componentTypeIDs;
+    };
 
     //-------------------------------------------------------------------------
 
@@ -29,7 +76,9 @@ namespace EE
         EE_REFLECT_TYPE( EntityWorldSystem );
 
         friend class EntityWorld;
+        friend class EntityWorldSystemScheduler;
         friend EntityModel::EntityMap;
+        friend EntityModel::ComponentRoutingTable;
 
     public:
 
@@ -46,6 +95,14 @@ namespace EE
         // Get the required update stages and priorities for this component
         virtual UpdatePriorityList const& GetRequiredUpdatePriorities() = 0;
 
+        // Declare the data accessed by this system for the specified stage, return false to have the system run exclusively on the thread updating the world
+        // Systems with declared dependencies can be updated from any worker thread and must not add or remove entities during their update
+        virtual bool GetUpdateDependencies( UpdateStage stage, WorldSystemUpdateDependencies& outDependencies ) const { return false; }
+
+        // Declare the component types this system wants to be registered with, return false to be sent every component that is added to the world
+        // This is queried once when the world is initialized
+        virtual bool GetComponentInterests( WorldSystemComponentInterests& outInterests ) const { return false; }
+
         // Called when the system is registered with the world - using explicit "EntitySystem" name to allow for a standalone initialize function
         virtual void InitializeSystem( SystemRegistry const& systemRegistry ) {};
 
@@ -55,7 +112,7 @@ namespace EE
         // System Update - using explicit "EntitySystem" name to allow for a standalone update functions
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) {};
 
-        // Called whenever a new component is activated (i.e. added to the world)
+        // Called whenever a new component is activated (i.e. added to the world), only called for the component types of interest (if declared)
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) = 0;
 
         // Called immediately before an component is deactivated
@@ -0,0 +1,399 @@
+#include "EntityWorldSystemScheduler.h"
+#include "EntityWorldUpdateContext.h"
+#include "Base/Logging/Log.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    struct EntityWorldSystemScheduler::SystemUpdateTask final : public ITaskSet
+    {
+        SystemUpdateTask( EntityWorldSystemScheduler* pScheduler, ScheduledSystem* pScheduledSystem )
+            : m_pScheduler( pScheduler )
+            , m_pScheduledSystem( pScheduledSystem )
+        {
+            EE_ASSERT( m_pScheduler != nullptr && m_pScheduledSystem != nullptr );
+        }
+
+        ~SystemUpdateTask()
+        {
+            if ( m_pDependencies != nullptr )
+            {
+                EE::DeleteArray( m_pDependencies );
+            }
+        }
+
+        virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+        {
+            EE_ASSERT( m_pContext != nullptr );
+            m_pScheduler->UpdateSystem( *m_pScheduledSystem, *m_pContext, threadnum );
+        }
+
+    public:
+
+        EntityWorldSystemScheduler*             m_pScheduler = nullptr;
+        ScheduledSystem*                        m_pScheduledSystem = nullptr;
+        EntityWorldUpdateContext const*         m_pContext = nullptr;
+        TaskDependency*                         m_pDependencies = nullptr;
+    };
+
+    //-------------------------------------------------------------------------
+
+    EntityWorldSystemScheduler::~EntityWorldSystemScheduler()
+    {
+        for ( auto const& stage : m_stages )
+        {
+            EE_ASSERT( stage.m_systems.empty() && stage.m_tasks.empty() );
+        }
+    }
+
+    void EntityWorldSystemScheduler::ClearStage( StageSchedule& stage )
+    {
+        // Dependents always come after their dependencies so destroy in reverse order to unlink them safely
+        for ( int32_t i = (int32_t) stage.m_tasks.size() - 1; i >= 0; i-- )
+        {
+            if ( stage.m_tasks[i] != nullptr )
+            {
+                EE_ASSERT( stage.m_tasks[i]->GetIsComplete() );
+                EE::Delete( stage.m_tasks[i] );
+            }
+        }
+
+        stage.m_tasks.clear();
+        stage.m_segments.clear();
+        stage.m_systems.clear();
+    }
+
+    void EntityWorldSystemScheduler::Clear()
+    {
+        for ( auto& stage : m_stages )
+        {
+            ClearStage( stage );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void EntityWorldSystemScheduler::BuildSchedule( UpdateStage stage, TVector<EntityWorldSystem*> const& updateList )
+    {
+        StageSchedule& schedule = m_stages[(int8_t) stage];
+        ClearStage( schedule );
+
+        int32_t const numSystems = (int32_t) updateList.size();
+        if ( numSystems == 0 )
+        {
+            return;
+        }
+
+        EE_ASSERT( numSystems < INT16_MAX );
+
+        // Gather declared dependencies
+        //-------------------------------------------------------------------------
+
+        struct SystemInfo
+        {
+            WorldSystemUpdateDependencies       m_dependencies;
+            TInlineVector<int16_t, 2>           m_explicitSuccessors;
+            int32_t                             m_numExplicitPredecessors = 0;
+            bool                                m_isDeclared = false;
+            bool                                m_isOrdered = false;
+        };
+
+        TVector<SystemInfo> systemInfos;
+        systemInfos.resize( numSystems );
+
+        for ( int32_t i = 0; i < numSystems; i++ )
+        {
+            systemInfos[i].m_isDeclared = updateList[i]->GetUpdateDependencies( stage, systemInfos[i].m_dependencies );
+        }
+
+        // Apply explicit ordering constraints
+        //-------------------------------------------------------------------------
+        // Any system not constrained stays in priority order
+
+        auto AddExplicitEdge = [&systemInfos] ( int32_t fromIdx, int32_t toIdx )
+        {
+            if ( !VectorContains( systemInfos[fromIdx].m_explicitSuccessors, (int16_t) toIdx ) )
+            {
+                systemInfos[fromIdx].m_explicitSuccessors.emplace_back( (int16_t) toIdx );
+                systemInfos[toIdx].m_numExplicitPredecessors++;
+            }
+        };
+
+        auto FindSystemIdx = [&updateList] ( uint32_t systemID )
+        {
+            return VectorFindIndex( updateList, systemID, [] ( EntityWorldSystem* const& pSystem, uint32_t const& ID ) { return pSystem->GetSystemID() == ID; } );
+        };
+
+        for ( int32_t i = 0; i < numSystems; i++ )
+        {
+            for ( uint32_t const systemID : systemInfos[i].m_dependencies.m_runsBefore )
+            {
+                int32_t const otherIdx = FindSystemIdx( systemID );
+                if ( otherIdx != InvalidIndex )
+                {
+                    AddExplicitEdge( i, otherIdx );
+                }
+            }
+
+            for ( uint32_t const systemID : systemInfos[i].m_dependencies.m_runsAfter )
+            {
+                int32_t const otherIdx = FindSystemIdx( systemID );
+                if ( otherIdx != InvalidIndex )
+                {
+                    AddExplicitEdge( otherIdx, i );
+                }
+            }
+        }
+
+        // Always pick the earliest system in the update list whose explicit predecessors have all been ordered
+        TVector<int16_t> order;
+        order.reserve( numSystems );
+        for ( int32_t step = 0; step < numSystems; step++ )
+        {
+            int32_t nextIdx = InvalidIndex;
+            for ( int32_t i = 0; i < numSystems; i++ )
+            {
+                if ( !systemInfos[i].m_isOrdered && systemInfos[i].m_numExplicitPredecessors == 0 )
+                {
+                    nextIdx = i;
+                    break;
+                }
+            }
+
+            if ( nextIdx == InvalidIndex )
+            {
+                EE_LOG_ERROR( "Entity", "World System Scheduler", "Cyclic world system ordering constraints detected, falling back to priority order!" );
+
+                order.clear();
+                for ( int32_t i = 0; i < numSystems; i++ )
+                {
+                    systemInfos[i].m_explicitSuccessors.clear();
+                    order.emplace_back( (int16_t) i );
+                }
+                break;
+            }
+
+            systemInfos[nextIdx].m_isOrdered = true;
+            order.emplace_back( (int16_t) nextIdx );
+
+            for ( int16_t const successorIdx : systemInfos[nextIdx].m_explicitSuccessors )
+            {
+                systemInfos[successorIdx].m_numExplicitPredecessors--;
+            }
+        }
+
+        // Build segments and dependencies
+        //-------------------------------------------------------------------------
+        // Exclusive systems act as barriers so we only need to track dependencies within a segment
+
+        schedule.m_systems.resize( numSystems );
+
+        for ( int32_t scheduleIdx = 0; scheduleIdx < numSystems; scheduleIdx++ )
+        {
+            int32_t const systemIdx = order[scheduleIdx];
+            SystemInfo const& systemInfo = systemInfos[systemIdx];
+
+            ScheduledSystem& scheduledSystem = schedule.m_systems[scheduleIdx];
+            scheduledSystem.m_pSystem = updateList[systemIdx];
+            scheduledSystem.m_isExclusive = !systemInfo.m_isDeclared;
+
+            if ( scheduledSystem.m_isExclusive )
+            {
+                Segment& segment = schedule.m_segments.emplace_back();
+                segment.m_firstSystemIdx = (int16_t) scheduleIdx;
+                segment.m_numSystems = 1;
+                segment.m_isExclusive = true;
+            }
+            else
+            {
+                if ( schedule.m_segments.empty() || schedule.m_segments.back().m_isExclusive )
+                {
+                    Segment& segment = schedule.m_segments.emplace_back();
+                    segment.m_firstSystemIdx = (int16_t) scheduleIdx;
+                }
+
+                Segment& segment = schedule.m_segments.back();
+                segment.m_numSystems++;
+
+                for ( int32_t previousScheduleIdx = segment.m_firstSystemIdx; previousScheduleIdx < scheduleIdx; previousScheduleIdx++ )
+                {
+                    SystemInfo const& previousSystemInfo = systemInfos[order[previousScheduleIdx]];
+                    bool const hasExplicitEdge = VectorContains( previousSystemInfo.m_explicitSuccessors, (int16_t) systemIdx );
+                    if ( hasExplicitEdge || previousSystemInfo.m_dependencies.ConflictsWith( systemInfo.m_dependencies ) )
+                    {
+                        scheduledSystem.m_dependencies.emplace_back( (int16_t) previousScheduleIdx );
+                    }
+                }
+            }
+
+            scheduledSystem.m_segmentIdx = (int16_t) ( schedule.m_segments.size() - 1 );
+        }
+
+        // Create tasks
+        //-------------------------------------------------------------------------
+        // Only segments with more than one system are dispatched to the task system
+
+        schedule.m_tasks.resize( numSystems, nullptr );
+
+        for ( Segment const& segment : schedule.m_segments )
+        {
+            if ( segment.m_isExclusive || segment.m_numSystems == 1 )
+            {
+                continue;
+            }
+
+            int32_t const endIdx = segment.m_firstSystemIdx + segment.m_numSystems;
+            for ( int32_t i = segment.m_firstSystemIdx; i < endIdx; i++ )
+            {
+                ScheduledSystem& scheduledSystem = schedule.m_systems[i];
+                SystemUpdateTask* pTask = EE::New<SystemUpdateTask>( this, &scheduledSystem );
+                schedule.m_tasks[i] = pTask;
+
+                int32_t const numDependencies = (int32_t) scheduledSystem.m_dependencies.size();
+                if ( numDependencies > 0 )
+                {
+                    pTask->m_pDependencies = EE::NewArray<TaskDependency>( numDependencies );
+                    for ( int32_t d = 0; d < numDependencies; d++ )
+                    {
+                        pTask->m_pDependencies[d].SetDependency( schedule.m_tasks[scheduledSystem.m_dependencies[d]], pTask );
+                    }
+                }
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void EntityWorldSystemScheduler::UpdateSystem( ScheduledSystem& scheduledSystem, EntityWorldUpdateContext const& context, uint32_t threadIdx )
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Update World System" );
+
+        #if EE_DEVELOPMENT_TOOLS
+        Nanoseconds const startTime = PlatformClock::GetTime();
+        #endif
+
+        scheduledSystem.m_pSystem->UpdateSystem( context );
+
+        #if EE_DEVELOPMENT_TOOLS
+        Nanoseconds const endTime = PlatformClock::GetTime();
+        scheduledSystem.m_lastStartTime = ( startTime - m_stageStartTime ).ToMilliseconds();
+        scheduledSystem.m_lastUpdateTime = ( endTime - startTime ).ToMilliseconds();
+        scheduledSystem.m_lastThreadIdx = threadIdx;
+        #endif
+    }
+
+    void EntityWorldSystemScheduler::Update( TaskSystem* pTaskSystem, UpdateStage stage, EntityWorldUpdateContext const& context )
+    {
+        EE_ASSERT( pTaskSystem != nullptr );
+
+        StageSchedule& schedule = m_stages[(int8_t) stage];
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_stageStartTime = PlatformClock::GetTime();
+        bool const isParallelUpdateEnabled = m_isParallelUpdateEnabled;
+        #else
+        bool const isParallelUpdateEnabled = true;
+        #endif
+
+        //-------------------------------------------------------------------------
+
+        for ( Segment const& segment : schedule.m_segments )
+        {
+            int32_t const endIdx = segment.m_firstSystemIdx + segment.m_numSystems;
+
+            // Exclusive systems and single system segments are run directly on the thread updating the world
+            if ( segment.m_isExclusive || segment.m_numSystems == 1 || !isParallelUpdateEnabled )
+            {
+                for ( int32_t i = segment.m_firstSystemIdx; i < endIdx; i++ )
+                {
+                    UpdateSystem( schedule.m_systems[i], context, 0 );
+                }
+                continue;
+            }
+
+            // Only the systems without dependencies are scheduled, the rest are kicked off by the task system as their dependencies complete
+            for ( int32_t i = segment.m_firstSystemIdx; i < endIdx; i++ )
+            {
+                schedule.m_tasks[i]->m_pContext = &context;
+            }
+
+            for ( int32_t i = segment.m_firstSystemIdx; i < endIdx; i++ )
+            {
+                if ( schedule.m_systems[i].m_dependencies.empty() )
+                {
+                    pTaskSystem->ScheduleTask( schedule.m_tasks[i] );
+                }
+            }
+
+            for ( int32_t i = segment.m_firstSystemIdx; i < endIdx; i++ )
+            {
+                pTaskSystem->WaitForTask( schedule.m_tasks[i] );
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        schedule.m_lastUpdateTime = ( PlatformClock::GetTime() - m_stageStartTime ).ToMilliseconds();
+        #endif
+    }
+
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    Milliseconds EntityWorldSystemScheduler::GetCriticalPath( UpdateStage stage, TVector<int16_t>& outPath ) const
+    {
+        StageSchedule const& schedule = m_stages[(int8_t) stage];
+        int32_t const numSystems = (int32_t) schedule.m_systems.size();
+
+        outPath.clear();
+        float totalTime = 0.0f;
+
+        // Segments run one after the other so the critical path is the concatenation of each segment's longest chain
+        TVector<float> chainTimes;
+        TVector<int16_t> chainPredecessors;
+        chainTimes.resize( numSystems, 0.0f );
+        chainPredecessors.resize( numSystems, (int16_t) InvalidIndex );
+
+        TInlineVector<int16_t, 16> segmentPath;
+        for ( Segment const& segment : schedule.m_segments )
+        {
+            int32_t const endIdx = segment.m_firstSystemIdx + segment.m_numSystems;
+            int32_t longestChainEndIdx = segment.m_firstSystemIdx;
+
+            for ( int32_t i = segment.m_firstSystemIdx; i < endIdx; i++ )
+            {
+                ScheduledSystem const& scheduledSystem = schedule.m_systems[i];
+                for ( int16_t const dependencyIdx : scheduledSystem.m_dependencies )
+                {
+                    if ( chainTimes[dependencyIdx] > chainTimes[i] )
+                    {
+                        chainTimes[i] = chainTimes[dependencyIdx];
+                        chainPredecessors[i] = dependencyIdx;
+                    }
+                }
+
+                chainTimes[i] += scheduledSystem.m_lastUpdateTime.ToFloat();
+
+                if ( chainTimes[i] > chainTimes[longestChainEndIdx] )
+                {
+                    longestChainEndIdx = i;
+                }
+            }
+
+            segmentPath.clear();
+            for ( int16_t i = (int16_t) longestChainEndIdx; i != InvalidIndex; i = chainPredecessors[i] )
+            {
+                segmentPath.emplace_back( i );
+            }
+
+            outPath.insert( outPath.end(), segmentPath.rbegin(), segmentPath.rend() );
+            totalTime += chainTimes[longestChainEndIdx];
+        }
+
+        return totalTime;
+    }
+    #endif
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "EntityWorldSystem.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Time/Time.h"
+
+//-------------------------------------------------------------------------
+// World System Scheduler
+//-------------------------------------------------------------------------
+// Builds a dependency graph per update stage from the priority sorted system lists and the systems' declared dependencies
+// Exclusive systems (i.e. with no declared dependencies) split the stage into segments and are run on the thread updating the world (the main thread unless the world is independent)
+// Systems within a non-exclusive segment are dispatched as tasks and only wait on the systems they conflict with
+// The priority order is always preserved between conflicting systems so the results match a serial update
+
+namespace EE
+{
+    class EntityWorldUpdateContext;
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API EntityWorldSystemScheduler
+    {
+        struct SystemUpdateTask;
+
+    public:
+
+        struct ScheduledSystem
+        {
+            EntityWorldSystem*                  m_pSystem = nullptr;
+            TInlineVector<int16_t, 4>           m_dependencies;             // The scheduled systems (in this stage) that need to complete before this one runs
+            int16_t                             m_segmentIdx = InvalidIndex;
+            bool                                m_isExclusive = true;
+
+            #if EE_DEVELOPMENT_TOOLS
+            Milliseconds                        m_lastStartTime = 0.0f;     // Relative to the start of the stage update
+            Milliseconds                        m_lastUpdateTime = 0.0f;
+            uint32_t                            m_lastThreadIdx = 0;
+            #endif
+        };
+
+        struct Segment
+        {
+            int16_t                             m_firstSystemIdx = 0;
+            int16_t                             m_numSystems = 0;
+            bool                                m_isExclusive = false;
+        };
+
+    public:
+
+        ~EntityWorldSystemScheduler();
+
+        // Build the schedule for a stage, expects the update list sorted by priority
+        void BuildSchedule( UpdateStage stage, TVector<EntityWorldSystem*> const& updateList );
+
+        // Destroy all schedules, needs to be called before the systems are destroyed
+        void Clear();
+
+        // Run all the world system updates for the specified stage
+        void Update( TaskSystem* pTaskSystem, UpdateStage stage, EntityWorldUpdateContext const& context );
+
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        inline TVector<ScheduledSystem> const& GetScheduledSystems( UpdateStage stage ) const { return m_stages[(int8_t) stage].m_systems; }
+        inline TVector<Segment> const& GetSegments( UpdateStage stage ) const { return m_stages[(int8_t) stage].m_segments; }
+        inline Milliseconds GetLastStageUpdateTime( UpdateStage stage ) const { return m_stages[(int8_t) stage].m_lastUpdateTime; }
+
+        // Get the longest chain of dependent systems for the last update of a stage, returns the total time of the chain
+        Milliseconds GetCriticalPath( UpdateStage stage, TVector<int16_t>& outPath ) const;
+
+        // Allows us to force a serial update to compare results or timings
+        inline bool IsParallelUpdateEnabled() const { return m_isParallelUpdateEnabled; }
+        inline void SetParallelUpdateEnabled( bool isEnabled ) { m_isParallelUpdateEnabled = isEnabled; }
+        #endif
+
+    private:
+
+        struct StageSchedule
+        {
+            TVector<ScheduledSystem>            m_systems;
+            TVector<Segment>                    m_segments;
+            TVector<SystemUpdateTask*>          m_tasks;
+
+            #if EE_DEVELOPMENT_TOOLS
+            Milliseconds                        m_lastUpdateTime = 0.0f;
+            #endif
+        };
+
+        void ClearStage( StageSchedule& stage );
+        void UpdateSystem( ScheduledSystem& scheduledSystem, EntityWorldUpdateContext const& context, uint32_t threadIdx );
+
+    private:
+
+        StageSchedule                           m_stages[(int8_t) UpdateStage::NumStages];
+
+        #if EE_DEVELOPMENT_TOOLS
+        Nanoseconds                             m_stageStartTime = 0;
+        bool                                    m_isParallelUpdateEnabled = true;
+        #endif
+    };
+}
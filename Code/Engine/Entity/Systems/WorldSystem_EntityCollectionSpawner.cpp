@@ -14,6 +14,12 @@ namespace EE::EntityModel
         EE_ASSERT( m_entityCollectionReferences.empty() );
     }
 
+    bool EntityCollectionSpawner::GetComponentInterests( WorldSystemComponentInterests& outInterests ) const
+    {
+        outInterests.Includes<EntityCollectionComponent>();
+        return true;
+    }
+
     void EntityCollectionSpawner::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
     {
         if ( auto pEntityCollectionComponent = TryCast<EntityCollectionComponent>( pComponent ) )
@@ -32,6 +32,7 @@ namespace EE::EntityModel
 
         virtual void ShutdownSystem() override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual bool GetComponentInterests( WorldSystemComponentInterests& outInterests ) const override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
 
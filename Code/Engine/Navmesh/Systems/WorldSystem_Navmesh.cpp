@@ -137,6 +137,12 @@ namespace EE::Navmesh
 
     //-------------------------------------------------------------------------
 
+    bool NavmeshWorldSystem::GetComponentInterests( WorldSystemComponentInterests& outInterests ) const
+    {
+        outInterests.Includes<NavmeshComponent>();
+        return true;
+    }
+
     void NavmeshWorldSystem::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
     {
         if ( auto pNavmeshComponent = TryCast<NavmeshComponent>( pComponent ) )
@@ -224,6 +230,13 @@ namespace EE::Navmesh
 
     //-------------------------------------------------------------------------
 
+    bool NavmeshWorldSystem::GetUpdateDependencies( UpdateStage stage, WorldSystemUpdateDependencies& outDependencies ) const
+    {
+        // The navpower instance is only ever touched by this system
+        outDependencies.WritesResource( StringID( "NavmeshInstance" ) );
+        return true;
+    }
+
     void NavmeshWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         #if EE_ENABLE_NAVPOWER
@@ -59,12 +59,14 @@ namespace EE::Navmesh
         virtual void ShutdownSystem() override;
 
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual bool GetComponentInterests( WorldSystemComponentInterests& outInterests ) const override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
 
         void RegisterNavmesh( NavmeshComponent* pComponent );
         void UnregisterNavmesh( NavmeshComponent* pComponent );
 
         void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual bool GetUpdateDependencies( UpdateStage stage, WorldSystemUpdateDependencies& outDependencies ) const override;
 
         #if EE_DEVELOPMENT_TOOLS
         bool IsDebugRendererDepthTestEnabled() const;
@@ -220,6 +220,12 @@ namespace EE::Physics
 
     //-------------------------------------------------------------------------
 
+    bool PhysicsRenderer::RequiresWorldAccess( EntityWorld const* pWorld ) const
+    {
+        auto pPhysicsWorldSystem = pWorld->GetWorldSystem<PhysicsWorldSystem>();
+        return pPhysicsWorldSystem->GetWorld()->IsDebugDrawingEnabled();
+    }
+
     void PhysicsRenderer::RenderWorld( Seconds const deltaTime, Render::Viewport const& viewport, Render::RenderTarget const& renderTarget, EntityWorld* pWorld )
     {
         EE_ASSERT( IsInitialized() && Threading::IsMainThread() );
@@ -34,6 +34,7 @@ namespace EE::Physics
         bool Initialize( Render::RenderDevice* pRenderDevice );
         void Shutdown();
         void RenderWorld( Seconds const deltaTime, Render::Viewport const& viewport, Render::RenderTarget const& renderTarget, EntityWorld* pWorld ) override final;
+        virtual bool RequiresWorldAccess( EntityWorld const* pWorld ) const override final;
 
     private:
 
@@ -46,6 +46,14 @@ namespace EE::Physics
 
     //-------------------------------------------------------------------------
 
+    bool PhysicsWorldSystem::GetComponentInterests( WorldSystemComponentInterests& outInterests ) const
+    {
+        outInterests.Includes<PhysicsShapeComponent>();
+        outInterests.Includes<CharacterComponent>();
+        outInterests.Includes<PhysicsTestComponent>();
+        return true;
+    }
+
     void PhysicsWorldSystem::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
     {
         if ( auto pPhysicsComponent = TryCast<PhysicsShapeComponent>( pComponent ) )
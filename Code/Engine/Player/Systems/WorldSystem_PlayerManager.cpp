@@ -19,6 +19,14 @@ namespace EE
         EE_ASSERT( m_cameras.empty() );
     }
 
+    bool PlayerManager::GetComponentInterests( WorldSystemComponentInterests& outInterests ) const
+    {
+        outInterests.Includes<Player::PlayerSpawnComponent>();
+        outInterests.Includes<Player::PlayerComponent>();
+        outInterests.Includes<CameraComponent>();
+        return true;
+    }
+
     void PlayerManager::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
     {
         if ( auto pSpawnComponent = TryCast<Player::PlayerSpawnComponent>( pComponent ) )
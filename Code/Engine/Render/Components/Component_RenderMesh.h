@@ -12,6 +12,8 @@ namespace EE::Render
     {
         EE_ENTITY_COMPONENT( MeshComponent );
 
+        friend class RendererWorldSystem;
+
     public:
 
         inline MeshComponent() = default;
@@ -53,6 +55,9 @@ namespace EE::Render
         // Get the section visibility mask
         EE_FORCE_INLINE uint64_t GetSectionVisibilityMask() const { return m_sectionVisibilityMask; }
 
+        // Get the currently rendered LOD, this is selected by the renderer each frame the mesh is visible
+        EE_FORCE_INLINE int32_t GetLOD() const { return m_LOD; }
+
         // Materials
         //-------------------------------------------------------------------------
 
@@ -84,6 +89,9 @@ namespace EE::Render
         EE_REFLECT( "IsToolsReadOnly" : true );
         uint64_t                                                m_sectionVisibilityMask = 0xFFFFFFFF;
 
+        // The LOD selected by the renderer
+        int32_t                                                 m_LOD = 0;
+
         // Should this component be rendered
         bool                                                    m_isVisible = true;
     };
@@ -46,7 +46,7 @@ namespace EE::Render
 
             if ( HasSkeletonResourceSet() )
             {
-                GenerateAnimationBoneMap();
+                m_pBoneMap = AnimationBoneMapCache::Acquire( m_skeleton.GetPtr(), m_mesh.GetPtr() );
             }
 
             // Set mesh to reference pose
@@ -57,7 +57,7 @@ namespace EE::Render
 
             //-------------------------------------------------------------------------
 
-            // Allocate skinning transforms and calculate initial values
+            // Allocate skinning transforms, these will be calculated once the mesh is first rendered
             m_skinningTransforms.resize( m_boneTransforms.size() );
             FinalizePose();
         }
@@ -67,7 +67,12 @@ namespace EE::Render
     {
         m_boneTransforms.clear();
         m_skinningTransforms.clear();
-        m_animToMeshBoneMap.clear();
+        m_isSkinningDirty = false;
+        if ( m_pBoneMap != nullptr )
+        {
+            AnimationBoneMapCache::Release( m_pBoneMap );
+        }
+
         MeshComponent::Shutdown();
     }
 
@@ -131,17 +136,17 @@ namespace EE::Render
         EE_PROFILE_FUNCTION_RENDER();
         EE_ASSERT( IsInitialized() );
         EE_ASSERT( HasMeshResourceSet() && HasSkeletonResourceSet() );
-        EE_ASSERT( !m_animToMeshBoneMap.empty() );
+        EE_ASSERT( m_pBoneMap != nullptr );
         EE_ASSERT( pPose != nullptr && pPose->HasGlobalTransforms() );
 
-        int32_t const numAnimBones = pPose->GetNumBones();
-        for ( auto animBoneIdx = 0; animBoneIdx < numAnimBones; animBoneIdx++ )
+        auto const& globalTransforms = pPose->GetGlobalTransforms();
+        int32_t const numMeshBones = (int32_t) m_boneTransforms.size();
+        for ( auto meshBoneIdx = 0; meshBoneIdx < numMeshBones; meshBoneIdx++ )
         {
-            int32_t const meshBoneIdx = m_animToMeshBoneMap[animBoneIdx];
-            if ( meshBoneIdx != InvalidIndex )
+            int32_t const animBoneIdx = m_pBoneMap->m_meshToAnimBoneMap[meshBoneIdx];
+            if ( animBoneIdx != InvalidIndex )
             {
-                Transform const boneTransform = pPose->GetGlobalTransform( animBoneIdx );
-                m_boneTransforms[meshBoneIdx] = boneTransform;
+                m_boneTransforms[meshBoneIdx] = globalTransforms[animBoneIdx];
             }
         }
     }
@@ -169,40 +174,61 @@ namespace EE::Render
 
         NotifySocketsUpdated();
         UpdateBounds();
-        UpdateSkinningTransforms();
+        m_isSkinningDirty = true;
     }
 
     //-------------------------------------------------------------------------
 
-    void SkeletalMeshComponent::UpdateSkinningTransforms()
+    SkinningBatchElement SkeletalMeshComponent::CreateSkinningBatchElement()
     {
         EE_ASSERT( m_mesh.IsSet() && m_mesh.IsLoaded() );
+        EE_ASSERT( m_skinningTransforms.size() == m_boneTransforms.size() );
+
+        SkinningBatchElement element;
+        element.m_pBoneTransforms = m_boneTransforms.data();
+        element.m_pInverseBindPose = m_mesh->GetInverseBindPoseMatrices().data();
+        element.m_pSkinningTransforms = m_skinningTransforms.data();
+        element.m_numBones = (int32_t) m_boneTransforms.size();
+        return element;
+    }
 
-        auto const numBones = m_boneTransforms.size();
-        EE_ASSERT( m_skinningTransforms.size() == numBones );
+    void SkeletalMeshComponent::SetPosesAndFinalize( TVector<SkeletalMeshComponent*> const& components, TVector<Animation::Pose const*> const& poses )
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+        EE_ASSERT( components.size() == poses.size() );
 
-        auto const& inverseBindPose = m_mesh->GetInverseBindPose();
-        for ( auto i = 0; i < numBones; i++ )
+        int32_t const numComponents = (int32_t) components.size();
+        for ( int32_t i = 0; i < numComponents; i++ )
         {
-            Transform const skinningTransform = inverseBindPose[i] * m_boneTransforms[i];
-            m_skinningTransforms[i] = ( skinningTransform ).ToMatrix();
+            EE_ASSERT( components[i]->IsInitialized() );
+
+            if ( poses[i] != nullptr )
+            {
+                components[i]->SetPose( poses[i] );
+            }
+
+            components[i]->FinalizePose();
         }
     }
 
-    void SkeletalMeshComponent::GenerateAnimationBoneMap()
+    void SkeletalMeshComponent::UpdateSkinningTransforms( TVector<SkeletalMeshComponent*> const& components )
     {
-        EE_ASSERT( m_mesh != nullptr && m_skeleton != nullptr );
-
-        auto const pMesh = GetMesh();
+        EE_PROFILE_FUNCTION_RENDER();
 
-        auto const numBones = m_skeleton->GetNumBones();
-        m_animToMeshBoneMap.resize( numBones, InvalidIndex );
+        TVector<SkinningBatchElement> batch;
+        batch.reserve( components.size() );
 
-        for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        for ( auto pComponent : components )
         {
-            auto const& boneID = m_skeleton->GetBoneID( boneIdx );
-            m_animToMeshBoneMap[boneIdx] = pMesh->GetBoneIndex( boneID );
+            EE_ASSERT( pComponent->IsInitialized() );
+            if ( pComponent->m_isSkinningDirty )
+            {
+                batch.emplace_back( pComponent->CreateSkinningBatchElement() );
+                pComponent->m_isSkinningDirty = false;
+            }
         }
+
+        Render::GenerateSkinningTransforms( batch.data(), (int32_t) batch.size() );
     }
 
     //-------------------------------------------------------------------------
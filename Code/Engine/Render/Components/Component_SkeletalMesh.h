@@ -2,6 +2,7 @@
 
 #include "Component_RenderMesh.h"
 #include "Engine/Render/Mesh/SkeletalMesh.h"
+#include "Engine/Render/Mesh/SkeletalMeshSkinning.h"
 #include "Engine/Animation/AnimationSkeleton.h"
 
 //-------------------------------------------------------------------------
@@ -16,6 +17,16 @@ namespace EE::Render
     {
         EE_ENTITY_COMPONENT( SkeletalMeshComponent );
 
+    public:
+
+        // Sets the poses for a set of components and finalizes them
+        // The poses are optional, a null pose will finalize the component with its current bone transforms
+        static void SetPosesAndFinalize( TVector<SkeletalMeshComponent*> const& components, TVector<Animation::Pose const*> const& poses );
+
+        // Generates the skinning transforms for all components whose pose has been finalized since their last update, in a single batch
+        // This is done by the renderer for all visible components, so the skinning cost is only paid for meshes that are actually drawn
+        static void UpdateSkinningTransforms( TVector<SkeletalMeshComponent*> const& components );
+
     public:
 
         using MeshComponent::MeshComponent;
@@ -51,11 +62,12 @@ namespace EE::Render
             m_boneTransforms[boneIdx] = transform;
         }
 
-        // This function will finalize the pose, run any procedural bone solvers and generate the skinning transforms
+        // This function will finalize the pose, run any procedural bone solvers and flag the skinning transforms for regeneration
         // Only run this function once per frame once you have set the final global pose
         void FinalizePose();
 
         // Get the skinning transforms for this mesh - these are the global transforms relative to the bind pose
+        // These are only valid once the renderer has updated them for the latest finalized pose (see UpdateSkinningTransforms)
         inline TVector<Matrix> const& GetSkinningTransforms() const { return m_skinningTransforms; }
 
         // Animation Pose
@@ -80,8 +92,7 @@ namespace EE::Render
 
         virtual TVector<TResourcePtr<Render::Material>> const& GetDefaultMaterials() const override final;
 
-        void UpdateSkinningTransforms();
-        void GenerateAnimationBoneMap();
+        SkinningBatchElement CreateSkinningBatchElement();
 
         virtual OBB CalculateLocalBounds() const override final;
 
@@ -95,9 +106,10 @@ namespace EE::Render
 
         EE_REFLECT() TResourcePtr<SkeletalMesh>            m_mesh;
         EE_REFLECT() TResourcePtr<Animation::Skeleton>     m_skeleton = nullptr;
-        TVector<int32_t>                                m_animToMeshBoneMap;
+        AnimationBoneMap const*                         m_pBoneMap = nullptr;
         TVector<Transform>                              m_boneTransforms;
         TVector<Matrix>                                 m_skinningTransforms;
+        bool                                            m_isSkinningDirty = false;
     };
 
     //-------------------------------------------------------------------------
@@ -49,6 +49,12 @@ namespace EE::Render
 
         DrawRenderVisualizationModesMenu( m_pWorld );
 
+        ImGuiX::TextSeparator( "LODs" );
+
+        ImGui::SliderFloat( "Max Screen Space Error (px)", &m_pWorldRendererSystem->m_LODSelectionSettings.m_maxScreenSpaceError, 0.1f, 16.0f );
+        ImGui::SliderFloat( "LOD Hysteresis", &m_pWorldRendererSystem->m_LODSelectionSettings.m_hysteresis, 0.0f, 0.9f );
+        ImGui::InputInt( "Forced LOD", &m_pWorldRendererSystem->m_forcedMeshLOD );
+
         ImGuiX::TextSeparator( "Static Meshes" );
 
         ImGui::Checkbox( "Show Static Mesh Bounds", &m_pWorldRendererSystem->m_showStaticMeshBounds );
@@ -46,6 +46,10 @@ namespace EE::Render
 
         virtual void RenderWorld( Seconds const deltaTime, Viewport const& viewport, RenderTarget const& renderTarget, EntityWorld* pWorld ) {};
         virtual void RenderViewport( Seconds const deltaTime, Viewport const& viewport, RenderTarget const& renderTarget ) {};
+
+        // Does this renderer need to read from the world this frame? If so, the frame cannot be rendered while the next frame is simulated
+        // There is no default, every renderer needs to explicitly state whether it reads world state when rendering
+        virtual bool RequiresWorldAccess( EntityWorld const* pWorld ) const = 0;
     };
 }
 
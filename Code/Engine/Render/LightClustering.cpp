@@ -0,0 +1,349 @@
+#include "LightClustering.h"
+#include "Engine/Render/RenderFramePacket.h"
+#include "Base/Render/RenderViewport.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render
+{
+    struct LightClusterGrid::BinningTask final : public ITaskSet
+    {
+        BinningTask( LightClusterGrid* pGrid )
+            : m_pGrid( pGrid )
+        {
+            m_SetSize = pGrid->m_numDepthSlices;
+        }
+
+        virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+        {
+            for ( uint32_t i = range.start; i < range.end; i++ )
+            {
+                m_pGrid->BinDepthSlice( i );
+            }
+        }
+
+    private:
+
+        LightClusterGrid*                       m_pGrid = nullptr;
+    };
+
+    //-------------------------------------------------------------------------
+
+    void LightClusterGrid::Reset()
+    {
+        m_lightBounds.clear();
+        m_clusters.clear();
+        m_lightIndices.clear();
+
+        for ( auto& sliceIndices : m_sliceLightIndices )
+        {
+            sliceIndices.clear();
+        }
+
+        m_shaderParams = LightClusterShaderParams();
+        m_stats = Stats();
+    }
+
+    void LightClusterGrid::SetDimensions( uint32_t numTilesX, uint32_t numTilesY, uint32_t numDepthSlices )
+    {
+        // Tile and slice ranges are stored as 16bit values
+        EE_ASSERT( numTilesX > 0 && numTilesX <= 0xFFFF );
+        EE_ASSERT( numTilesY > 0 && numTilesY <= 0xFFFF );
+        EE_ASSERT( numDepthSlices > 0 && numDepthSlices <= 0xFFFF );
+
+        m_numTilesX = numTilesX;
+        m_numTilesY = numTilesY;
+        m_numDepthSlices = numDepthSlices;
+        Reset();
+    }
+
+    float LightClusterGrid::GetSliceDepth( uint32_t slice ) const
+    {
+        return m_depthRange.m_x * Math::Pow( m_depthRange.m_y / m_depthRange.m_x, (float) slice / m_numDepthSlices );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void LightClusterGrid::Build( Viewport const& viewport, TVector<PunctualLight> const& lights, TaskSystem* pTaskSystem )
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        uint32_t const numClusters = GetNumClusters();
+        EE_ASSERT( numClusters > 0 );
+
+        Math::ViewVolume const& viewVolume = viewport.GetViewVolume();
+        Float2 const viewportDimensions = viewport.GetDimensions();
+        EE_ASSERT( viewportDimensions.m_x > 0 && viewportDimensions.m_y > 0 );
+
+        m_stats = Stats();
+        m_stats.m_numLights = (uint32_t) lights.size();
+
+        // View info
+        //-------------------------------------------------------------------------
+
+        FloatRange const depthRange = viewVolume.GetDepthRange();
+        m_depthRange = Float2( Math::Max( depthRange.m_begin, 0.01f ), Math::Max( depthRange.m_end, depthRange.m_begin + 0.02f ) );
+        m_isPerspective = viewVolume.IsPerspective();
+
+        if ( m_isPerspective )
+        {
+            m_tanHalfFOV.m_x = Math::Tan( viewVolume.GetFOV().ToFloat() * 0.5f );
+            m_tanHalfFOV.m_y = Math::Tan( viewVolume.GetVerticalFOV().ToFloat() * 0.5f );
+        }
+        else
+        {
+            m_halfDimensions = viewVolume.GetViewDimensions() * 0.5f;
+        }
+
+        // Shader params
+        //-------------------------------------------------------------------------
+
+        float const depthSliceScale = m_numDepthSlices / Math::Log( m_depthRange.m_y / m_depthRange.m_x );
+        Float2 const viewportTopLeft = viewport.GetTopLeftPosition();
+
+        m_shaderParams.m_viewPosition = viewVolume.GetViewPosition().GetWithW0();
+        m_shaderParams.m_viewForward = viewVolume.GetViewForwardVector().GetWithW0();
+        m_shaderParams.m_screenParams = Float4( viewportTopLeft.m_x, viewportTopLeft.m_y, m_numTilesX / viewportDimensions.m_x, m_numTilesY / viewportDimensions.m_y );
+        m_shaderParams.m_depthParams = Float4( depthSliceScale, -Math::Log( m_depthRange.m_x ) * depthSliceScale, 0.0f, 0.0f );
+        m_shaderParams.m_dimensions[0] = m_numTilesX;
+        m_shaderParams.m_dimensions[1] = m_numTilesY;
+        m_shaderParams.m_dimensions[2] = m_numDepthSlices;
+        m_shaderParams.m_dimensions[3] = 0;
+
+        // Calculate the view space bounds and the cluster range for each light
+        //-------------------------------------------------------------------------
+        // View space is RH with -Z forward, so depth is -Z
+
+        Matrix const& viewMatrix = viewVolume.GetViewMatrix();
+        float const logNear = Math::Log( m_depthRange.m_x );
+
+        auto GetTileX = [this] ( float viewX, float depth )
+        {
+            float const ndcX = m_isPerspective ? ( viewX / ( depth * m_tanHalfFOV.m_x ) ) : ( viewX / m_halfDimensions.m_x );
+            return Math::Clamp( (int32_t) Math::Floor( ( ndcX * 0.5f + 0.5f ) * m_numTilesX ), 0, (int32_t) m_numTilesX - 1 );
+        };
+
+        // Tiles are ordered top to bottom to match screen space
+        auto GetTileY = [this] ( float viewY, float depth )
+        {
+            float const ndcY = m_isPerspective ? ( viewY / ( depth * m_tanHalfFOV.m_y ) ) : ( viewY / m_halfDimensions.m_y );
+            return Math::Clamp( (int32_t) Math::Floor( ( 0.5f - ndcY * 0.5f ) * m_numTilesY ), 0, (int32_t) m_numTilesY - 1 );
+        };
+
+        m_lightBounds.clear();
+        m_lightBounds.reserve( lights.size() );
+
+        uint32_t const numLights = (uint32_t) lights.size();
+        for ( uint32_t i = 0; i < numLights; i++ )
+        {
+            PunctualLight const& light = lights[i];
+
+            // Lights need a finite radius to be clustered
+            float const invRadiusSqr = light.m_positionInvRadiusSqr.GetW();
+            if ( invRadiusSqr <= 0.0f )
+            {
+                continue;
+            }
+
+            float const radius = 1.0f / Math::Sqrt( invRadiusSqr );
+            Vector const viewPosition = viewMatrix.TransformPoint( light.m_positionInvRadiusSqr );
+            float const depth = -viewPosition.GetZ();
+
+            // Depth cull
+            float const minDepth = Math::Max( depth - radius, m_depthRange.m_x );
+            float const maxDepth = Math::Min( depth + radius, m_depthRange.m_y );
+            if ( minDepth > maxDepth )
+            {
+                continue;
+            }
+
+            LightBounds& bounds = m_lightBounds.emplace_back();
+            bounds.m_lightIdx = i;
+            bounds.m_viewPositionRadius = viewPosition.GetWithW0() + Vector( 0, 0, 0, radius );
+
+            // The light's direction points towards the light, so the cone axis is its negation
+            float const cosAngle = light.m_spotAngles.GetX();
+            float const sinAngle = Math::Sqrt( Math::Max( 0.0f, 1.0f - cosAngle * cosAngle ) );
+            bounds.m_viewSpotDirection = viewMatrix.TransformNormal( -light.m_dir ).GetWithW0() + Vector( 0, 0, 0, cosAngle );
+            bounds.m_spotSinCos = Vector( sinAngle, cosAngle, 0.0f, 0.0f );
+
+            // Depth slice range
+            bounds.m_minSlice = (uint16_t) Math::Clamp( (int32_t) Math::Floor( ( Math::Log( minDepth ) - logNear ) * depthSliceScale ), 0, (int32_t) m_numDepthSlices - 1 );
+            bounds.m_maxSlice = (uint16_t) Math::Clamp( (int32_t) Math::Floor( ( Math::Log( maxDepth ) - logNear ) * depthSliceScale ), 0, (int32_t) m_numDepthSlices - 1 );
+
+            // Tile range - project the view space bounding box, the extremes of x/depth are always at the corners
+            float const minX = viewPosition.GetX() - radius;
+            float const maxX = viewPosition.GetX() + radius;
+            float const minY = viewPosition.GetY() - radius;
+            float const maxY = viewPosition.GetY() + radius;
+
+            bounds.m_minTileX = (uint16_t) Math::Min( GetTileX( minX, minDepth ), GetTileX( minX, maxDepth ) );
+            bounds.m_maxTileX = (uint16_t) Math::Max( GetTileX( maxX, minDepth ), GetTileX( maxX, maxDepth ) );
+            bounds.m_minTileY = (uint16_t) Math::Min( GetTileY( maxY, minDepth ), GetTileY( maxY, maxDepth ) );
+            bounds.m_maxTileY = (uint16_t) Math::Max( GetTileY( minY, minDepth ), GetTileY( minY, maxDepth ) );
+        }
+
+        // Bin lights
+        //-------------------------------------------------------------------------
+
+        m_clusters.resize( numClusters );
+        m_sliceLightIndices.resize( m_numDepthSlices );
+
+        if ( pTaskSystem != nullptr && m_lightBounds.size() >= s_minLightsForParallelBinning )
+        {
+            BinningTask task( this );
+            pTaskSystem->ScheduleTask( &task );
+            pTaskSystem->WaitForTask( &task );
+        }
+        else
+        {
+            for ( uint32_t i = 0; i < m_numDepthSlices; i++ )
+            {
+                BinDepthSlice( i );
+            }
+        }
+
+        // Merge the per-slice index lists
+        //-------------------------------------------------------------------------
+
+        uint32_t numIndices = 0;
+        for ( uint32_t i = 0; i < m_numDepthSlices; i++ )
+        {
+            numIndices += (uint32_t) m_sliceLightIndices[i].size();
+        }
+
+        m_lightIndices.resize( numIndices );
+
+        uint32_t const numClustersPerSlice = m_numTilesX * m_numTilesY;
+        uint32_t sliceOffset = 0;
+        for ( uint32_t i = 0; i < m_numDepthSlices; i++ )
+        {
+            TVector<uint32_t> const& sliceIndices = m_sliceLightIndices[i];
+            if ( !sliceIndices.empty() )
+            {
+                memcpy( m_lightIndices.data() + sliceOffset, sliceIndices.data(), sliceIndices.size() * sizeof( uint32_t ) );
+            }
+
+            LightCluster* pSliceClusters = m_clusters.data() + ( i * numClustersPerSlice );
+            for ( uint32_t c = 0; c < numClustersPerSlice; c++ )
+            {
+                pSliceClusters[c].m_firstLightIdx += sliceOffset;
+                m_stats.m_maxLightsPerCluster = Math::Max( m_stats.m_maxLightsPerCluster, pSliceClusters[c].m_numLights );
+                m_stats.m_numEmptyClusters += ( pSliceClusters[c].m_numLights == 0 ) ? 1 : 0;
+            }
+
+            sliceOffset += (uint32_t) sliceIndices.size();
+        }
+
+        m_stats.m_numLightIndices = numIndices;
+        m_stats.m_numVisibleLights = (uint32_t) m_lightBounds.size();
+    }
+
+    void LightClusterGrid::BinDepthSlice( uint32_t slice )
+    {
+        TVector<uint32_t>& sliceIndices = m_sliceLightIndices[slice];
+        sliceIndices.clear();
+
+        uint32_t const numClustersPerSlice = m_numTilesX * m_numTilesY;
+        LightCluster* pSliceClusters = m_clusters.data() + ( slice * numClustersPerSlice );
+
+        // Gather the lights overlapping this slice
+        //-------------------------------------------------------------------------
+
+        TInlineVector<LightBounds const*, 64> candidates;
+        for ( LightBounds const& bounds : m_lightBounds )
+        {
+            if ( slice >= bounds.m_minSlice && slice <= bounds.m_maxSlice )
+            {
+                candidates.emplace_back( &bounds );
+            }
+        }
+
+        if ( candidates.empty() )
+        {
+            for ( uint32_t c = 0; c < numClustersPerSlice; c++ )
+            {
+                pSliceClusters[c] = LightCluster();
+            }
+            return;
+        }
+
+        // Test each cluster against the candidate lights
+        //-------------------------------------------------------------------------
+
+        float const sliceNear = GetSliceDepth( slice );
+        float const sliceFar = GetSliceDepth( slice + 1 );
+
+        // Half-extents of the slice at its near and far depths
+        Float2 const nearExtents = m_isPerspective ? Float2( sliceNear * m_tanHalfFOV.m_x, sliceNear * m_tanHalfFOV.m_y ) : m_halfDimensions;
+        Float2 const farExtents = m_isPerspective ? Float2( sliceFar * m_tanHalfFOV.m_x, sliceFar * m_tanHalfFOV.m_y ) : m_halfDimensions;
+
+        for ( uint32_t y = 0; y < m_numTilesY; y++ )
+        {
+            // NDC range for this row (Y is flipped since tiles are ordered top to bottom)
+            float const ndcMaxY = 1.0f - ( 2.0f * y ) / m_numTilesY;
+            float const ndcMinY = 1.0f - ( 2.0f * ( y + 1 ) ) / m_numTilesY;
+
+            for ( uint32_t x = 0; x < m_numTilesX; x++ )
+            {
+                float const ndcMinX = ( 2.0f * x ) / m_numTilesX - 1.0f;
+                float const ndcMaxX = ( 2.0f * ( x + 1 ) ) / m_numTilesX - 1.0f;
+
+                // View space AABB for the cluster, the cluster is a frustum so we need to include both the near and far faces
+                Vector const nearMin( ndcMinX * nearExtents.m_x, ndcMinY * nearExtents.m_y, -sliceFar );
+                Vector const nearMax( ndcMaxX * nearExtents.m_x, ndcMaxY * nearExtents.m_y, -sliceNear );
+                Vector const farMin( ndcMinX * farExtents.m_x, ndcMinY * farExtents.m_y, -sliceFar );
+                Vector const farMax( ndcMaxX * farExtents.m_x, ndcMaxY * farExtents.m_y, -sliceNear );
+                Vector const clusterMin = Vector::Min( nearMin, farMin );
+                Vector const clusterMax = Vector::Max( nearMax, farMax );
+
+                Vector const clusterCenter = ( clusterMin + clusterMax ) * 0.5f;
+                float const clusterRadius = ( clusterMax - clusterCenter ).GetLength3();
+
+                LightCluster& cluster = pSliceClusters[y * m_numTilesX + x];
+                cluster.m_firstLightIdx = (uint32_t) sliceIndices.size();
+                cluster.m_numLights = 0;
+
+                for ( LightBounds const* pBounds : candidates )
+                {
+                    if ( x < pBounds->m_minTileX || x > pBounds->m_maxTileX || y < pBounds->m_minTileY || y > pBounds->m_maxTileY )
+                    {
+                        continue;
+                    }
+
+                    // Sphere vs AABB
+                    Vector const lightCenter = pBounds->m_viewPositionRadius.GetWithW0();
+                    float const lightRadius = pBounds->m_viewPositionRadius.GetW();
+                    Vector const closestPoint = Vector::Clamp( lightCenter, clusterMin, clusterMax );
+                    if ( lightCenter.GetDistanceSquared3( closestPoint ) > lightRadius * lightRadius )
+                    {
+                        continue;
+                    }
+
+                    // Cone vs cluster bounding sphere, point lights have a cone angle cosine of -1 so skip this
+                    float const cosAngle = pBounds->m_spotSinCos.GetY();
+                    if ( cosAngle > -1.0f )
+                    {
+                        Vector const toCluster = clusterCenter - lightCenter;
+                        float const distanceSq = toCluster.GetLengthSquared3();
+                        float const distanceAlongAxis = toCluster.GetDot3( pBounds->m_viewSpotDirection.GetWithW0() );
+                        float const distanceToAxis = Math::Sqrt( Math::Max( 0.0f, distanceSq - distanceAlongAxis * distanceAlongAxis ) );
+                        float const distanceToCone = cosAngle * distanceToAxis - distanceAlongAxis * pBounds->m_spotSinCos.GetX();
+
+                        bool const isOutsideAngle = distanceToCone > clusterRadius;
+                        bool const isBehindLight = distanceAlongAxis < -clusterRadius;
+                        if ( isOutsideAngle || isBehindLight )
+                        {
+                            continue;
+                        }
+                    }
+
+                    sliceIndices.emplace_back( pBounds->m_lightIdx );
+                    cluster.m_numLights++;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Base/Math/Vector.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Light Clustering
+//-------------------------------------------------------------------------
+// Splits a view frustum into a 3D grid of clusters (screen tiles x exponentially distributed depth slices) and assigns lights to them
+// Each cluster stores a range into a shared light index list so that a pixel only needs to shade the lights that can affect its cluster
+// Lights are binned per depth slice, so slices can be processed on different threads without any synchronization
+
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render
+{
+    class Viewport;
+    struct PunctualLight;
+
+    //-------------------------------------------------------------------------
+
+    struct LightCluster
+    {
+        uint32_t                                m_firstLightIdx = 0;            // Index into the light index list
+        uint32_t                                m_numLights = 0;
+    };
+
+    // The cluster grid info needed to find the cluster for a pixel, matches the layout in the lighting constant buffer
+    struct LightClusterShaderParams
+    {
+        Vector                                  m_viewPosition = Vector::Zero;
+        Vector                                  m_viewForward = Vector::Zero;
+        Float4                                  m_screenParams = Float4::Zero;  // XY: viewport top left, ZW: number of tiles per pixel
+        Float4                                  m_depthParams = Float4::Zero;   // X: depth slice scale, Y: depth slice bias (slice = log( depth ) * X + Y)
+        uint32_t                                m_dimensions[4] = { 0, 0, 0, 0 };
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API LightClusterGrid
+    {
+        struct BinningTask;
+
+        // The view space bounds of a single light and the range of clusters it can touch
+        struct LightBounds
+        {
+            Vector                              m_viewPositionRadius;           // W: radius
+            Vector                              m_viewSpotDirection;            // Cone axis pointing away from the light, W: cone angle cosine ( -1 for point lights )
+            Vector                              m_spotSinCos;                   // X: sin of the cone angle, Y: cos of the cone angle
+            uint32_t                            m_lightIdx = 0;
+            uint16_t                            m_minTileX = 0;
+            uint16_t                            m_maxTileX = 0;
+            uint16_t                            m_minTileY = 0;
+            uint16_t                            m_maxTileY = 0;
+            uint16_t                            m_minSlice = 0;
+            uint16_t                            m_maxSlice = 0;
+        };
+
+    public:
+
+        constexpr static uint32_t const s_defaultNumTilesX = 16;
+        constexpr static uint32_t const s_defaultNumTilesY = 9;
+        constexpr static uint32_t const s_defaultNumDepthSlices = 24;
+
+        // When there are fewer lights than this, binning is always done on the calling thread
+        constexpr static uint32_t const s_minLightsForParallelBinning = 32;
+
+        struct Stats
+        {
+            uint32_t                            m_numLights = 0;                // Lights supplied for binning
+            uint32_t                            m_numVisibleLights = 0;         // Lights that touched at least one cluster
+            uint32_t                            m_numLightIndices = 0;
+            uint32_t                            m_maxLightsPerCluster = 0;
+            uint32_t                            m_numEmptyClusters = 0;
+        };
+
+    public:
+
+        LightClusterGrid() = default;
+        LightClusterGrid( uint32_t numTilesX, uint32_t numTilesY, uint32_t numDepthSlices ) { SetDimensions( numTilesX, numTilesY, numDepthSlices ); }
+
+        // Clear the binned data but keep the allocated memory around
+        void Reset();
+
+        // Set the grid dimensions, this clears any binned data
+        void SetDimensions( uint32_t numTilesX, uint32_t numTilesY, uint32_t numDepthSlices );
+
+        inline uint32_t GetNumTilesX() const { return m_numTilesX; }
+        inline uint32_t GetNumTilesY() const { return m_numTilesY; }
+        inline uint32_t GetNumDepthSlices() const { return m_numDepthSlices; }
+        inline uint32_t GetNumClusters() const { return m_numTilesX * m_numTilesY * m_numDepthSlices; }
+        inline uint32_t GetClusterIndex( uint32_t tileX, uint32_t tileY, uint32_t slice ) const { return ( slice * m_numTilesY + tileY ) * m_numTilesX + tileX; }
+
+        // Assign the supplied lights to the clusters for the viewport, lights are referenced by their index in the supplied list
+        // If a task system is supplied, the depth slices will be binned in parallel
+        void Build( Viewport const& viewport, TVector<PunctualLight> const& lights, TaskSystem* pTaskSystem = nullptr );
+
+        // Binned Data
+        //-------------------------------------------------------------------------
+
+        inline bool IsBuilt() const { return m_clusters.size() == GetNumClusters() && GetNumClusters() > 0; }
+        inline TVector<LightCluster> const& GetClusters() const { return m_clusters; }
+        inline TVector<uint32_t> const& GetLightIndices() const { return m_lightIndices; }
+        inline LightClusterShaderParams const& GetShaderParams() const { return m_shaderParams; }
+        inline Stats const& GetStats() const { return m_stats; }
+
+    private:
+
+        float GetSliceDepth( uint32_t slice ) const;
+        void BinDepthSlice( uint32_t slice );
+
+    private:
+
+        uint32_t                                m_numTilesX = s_defaultNumTilesX;
+        uint32_t                                m_numTilesY = s_defaultNumTilesY;
+        uint32_t                                m_numDepthSlices = s_defaultNumDepthSlices;
+
+        // Per build view data
+        Float2                                  m_depthRange = Float2::Zero;
+        Float2                                  m_tanHalfFOV = Float2::Zero;    // For perspective views
+        Float2                                  m_halfDimensions = Float2::Zero;// For orthographic views
+        bool                                    m_isPerspective = true;
+
+        TVector<LightBounds>                    m_lightBounds;
+        TVector<TVector<uint32_t>>              m_sliceLightIndices;            // Light indices per depth slice, these are merged once all slices are binned
+        TVector<LightCluster>                   m_clusters;
+        TVector<uint32_t>                       m_lightIndices;
+        LightClusterShaderParams                m_shaderParams;
+        Stats                                   m_stats;
+    };
+}
@@ -0,0 +1,86 @@
+#include "MeshLODSelection.h"
+#include "Base/Render/RenderViewport.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render::MeshLODSelection
+{
+    float CalculatePixelsPerUnit( Viewport const& viewport, float distance )
+    {
+        Math::ViewVolume const& viewVolume = viewport.GetViewVolume();
+        float const viewportWidth = viewport.GetDimensions().m_x;
+
+        // Orthographic views have a constant projected size
+        if ( viewVolume.IsOrthographic() )
+        {
+            return viewportWidth / viewVolume.GetViewDimensions().m_x;
+        }
+
+        float const clampedDistance = Math::Max( distance, viewVolume.GetDepthRange().m_begin );
+        float const halfWidthAtDistance = clampedDistance * Math::Tan( viewVolume.GetFOV().ToFloat() * 0.5f );
+        return viewportWidth / ( 2.0f * halfWidthAtDistance );
+    }
+
+    int32_t SelectLOD( float const* pLODErrors, int32_t numLODs, float pixelsPerUnit, int32_t currentLOD, Settings const& settings )
+    {
+        EE_ASSERT( pLODErrors != nullptr && numLODs > 0 );
+        EE_ASSERT( settings.m_maxScreenSpaceError > 0.0f && settings.m_hysteresis >= 0.0f && settings.m_hysteresis <= 1.0f );
+
+        currentLOD = Math::Clamp( currentLOD, 0, numLODs - 1 );
+
+        // Find the coarsest LOD that is within the error threshold, LOD errors are increasing so we can stop at the first LOD that exceeds it
+        int32_t targetLOD = 0;
+        for ( int32_t i = 1; i < numLODs; i++ )
+        {
+            if ( pLODErrors[i] * pixelsPerUnit > settings.m_maxScreenSpaceError )
+            {
+                break;
+            }
+
+            targetLOD = i;
+        }
+
+        // The current LOD is too coarse, so switch immediately
+        if ( targetLOD <= currentLOD )
+        {
+            return targetLOD;
+        }
+
+        // Only switch to a coarser LOD once its error is comfortably within the threshold
+        float const coarsenThreshold = settings.m_maxScreenSpaceError * ( 1.0f - settings.m_hysteresis );
+        int32_t selectedLOD = currentLOD;
+        for ( int32_t i = currentLOD + 1; i <= targetLOD; i++ )
+        {
+            if ( pLODErrors[i] * pixelsPerUnit > coarsenThreshold )
+            {
+                break;
+            }
+
+            selectedLOD = i;
+        }
+
+        return selectedLOD;
+    }
+
+    int32_t SelectLOD( Mesh const& mesh, OBB const& worldBounds, float worldScale, Viewport const& viewport, int32_t currentLOD, Settings const& settings )
+    {
+        int32_t const numLODs = mesh.GetNumLODs();
+        if ( numLODs == 1 )
+        {
+            return 0;
+        }
+
+        // Use the distance to the bounding sphere, so that the error is never underestimated for any part of the mesh
+        float const boundingRadius = worldBounds.m_extents.GetLength3();
+        float const distance = viewport.GetViewPosition().GetDistance3( worldBounds.m_center ) - boundingRadius;
+        float const pixelsPerUnit = CalculatePixelsPerUnit( viewport, distance ) * worldScale;
+
+        TInlineVector<float, 8> LODErrors;
+        for ( int32_t i = 0; i < numLODs; i++ )
+        {
+            LODErrors.emplace_back( mesh.GetLODError( i ) );
+        }
+
+        return SelectLOD( LODErrors.data(), numLODs, pixelsPerUnit, currentLOD, settings );
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "RenderMesh.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render { class Viewport; }
+
+//-------------------------------------------------------------------------
+// Mesh LOD Selection
+//-------------------------------------------------------------------------
+// Selects the coarsest LOD whose error, projected onto the screen, is below a pixel threshold
+//
+// Switching to a coarser LOD requires the projected error to be below a lower threshold (defined by the hysteresis),
+// this prevents meshes from flickering between LODs when the view distance hovers around a switch point
+// Switching to a finer LOD always happens immediately, so the projected error never exceeds the threshold
+
+namespace EE::Render::MeshLODSelection
+{
+    struct Settings
+    {
+        float                               m_maxScreenSpaceError = 1.0f;   // In pixels
+        float                               m_hysteresis = 0.25f;           // [0,1] The fraction of the max error that we need to drop below before switching to a coarser LOD
+    };
+
+    // Get the number of pixels covered by a world space unit at a given distance from the view
+    EE_ENGINE_API float CalculatePixelsPerUnit( Viewport const& viewport, float distance );
+
+    // Select a LOD given the errors for each LOD (in mesh space units, increasing per LOD) and the projected size of a mesh space unit
+    EE_ENGINE_API int32_t SelectLOD( float const* pLODErrors, int32_t numLODs, float pixelsPerUnit, int32_t currentLOD, Settings const& settings = Settings() );
+
+    // Select a LOD for a mesh instance
+    EE_ENGINE_API int32_t SelectLOD( Mesh const& mesh, OBB const& worldBounds, float worldScale, Viewport const& viewport, int32_t currentLOD, Settings const& settings = Settings() );
+}
@@ -0,0 +1,110 @@
+#include "MeshletCulling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render::MeshletCulling
+{
+    bool IsMeshletVisible( Mesh::Meshlet const& meshlet, Transform const& worldTransform, Math::ViewVolume const& viewVolume, bool cullBackfaces, Stats* pStats )
+    {
+        // Frustum test
+        //-------------------------------------------------------------------------
+
+        Vector const center = worldTransform.TransformPoint( Vector( meshlet.m_boundingSphereCenter ) );
+        float const radius = meshlet.m_boundingSphereRadius * worldTransform.GetScale();
+
+        for ( auto i = 0u; i < 6; i++ )
+        {
+            if ( viewVolume.GetViewPlane( i ).GetSignedDistanceToPoint( center ) < -radius )
+            {
+                if ( pStats != nullptr )
+                {
+                    pStats->m_numFrustumCulled++;
+                }
+                return false;
+            }
+        }
+
+        // Backface test - the meshlet is backfacing if the view direction to the cone apex lies within the normal cone
+        //-------------------------------------------------------------------------
+
+        if ( cullBackfaces )
+        {
+            Vector const coneAxis = worldTransform.RotateVector( Vector( meshlet.m_coneAxis, 0.0f ) );
+
+            Vector viewDirection;
+            if ( viewVolume.IsPerspective() )
+            {
+                Vector const coneApex = worldTransform.TransformPoint( Vector( meshlet.m_coneApex ) );
+                viewDirection = ( coneApex - viewVolume.GetViewPosition() ).GetNormalized3();
+            }
+            else
+            {
+                viewDirection = viewVolume.GetViewForwardVector();
+            }
+
+            if ( viewDirection.GetDot3( coneAxis ) >= meshlet.m_coneCutoff )
+            {
+                if ( pStats != nullptr )
+                {
+                    pStats->m_numBackfaceCulled++;
+                }
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void CullMeshlets( TVector<Mesh::Meshlet> const& meshlets, uint32_t startMeshlet, uint32_t numMeshlets, Transform const& worldTransform, Math::ViewVolume const& viewVolume, bool cullBackfaces, TVector<uint32_t>& outVisibleMeshlets, Stats* pStats )
+    {
+        EE_ASSERT( ( startMeshlet + numMeshlets ) <= meshlets.size() );
+
+        if ( pStats != nullptr )
+        {
+            pStats->m_numMeshlets += (int32_t) numMeshlets;
+        }
+
+        uint32_t const endMeshlet = startMeshlet + numMeshlets;
+        for ( uint32_t i = startMeshlet; i < endMeshlet; i++ )
+        {
+            if ( pStats != nullptr )
+            {
+                pStats->m_numInputIndices += (int32_t) meshlets[i].m_numIndices;
+            }
+
+            if ( IsMeshletVisible( meshlets[i], worldTransform, viewVolume, cullBackfaces, pStats ) )
+            {
+                outVisibleMeshlets.emplace_back( i );
+            }
+        }
+    }
+
+    uint32_t CompactIndices( TVector<uint32_t> const& indices, TVector<Mesh::Meshlet> const& meshlets, TVector<uint32_t> const& visibleMeshlets, TVector<uint32_t>& outIndices, Stats* pStats )
+    {
+        // Size the output once, so that we only need to copy the index ranges
+        uint32_t numIndicesToAdd = 0;
+        for ( uint32_t meshletIdx : visibleMeshlets )
+        {
+            numIndicesToAdd += meshlets[meshletIdx].m_numIndices;
+        }
+
+        size_t const startIndex = outIndices.size();
+        outIndices.resize( startIndex + numIndicesToAdd );
+
+        uint32_t* pOutIndex = outIndices.data() + startIndex;
+        for ( uint32_t meshletIdx : visibleMeshlets )
+        {
+            Mesh::Meshlet const& meshlet = meshlets[meshletIdx];
+            EE_ASSERT( ( meshlet.m_startIndex + meshlet.m_numIndices ) <= indices.size() );
+            memcpy( pOutIndex, indices.data() + meshlet.m_startIndex, meshlet.m_numIndices * sizeof( uint32_t ) );
+            pOutIndex += meshlet.m_numIndices;
+        }
+
+        if ( pStats != nullptr )
+        {
+            pStats->m_numOutputIndices += (int32_t) numIndicesToAdd;
+        }
+
+        return numIndicesToAdd;
+    }
+}
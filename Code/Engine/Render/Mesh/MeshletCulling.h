@@ -0,0 +1,39 @@
+#pragma once
+
+#include "RenderMesh.h"
+#include "Base/Math/ViewVolume.h"
+#include "Base/Math/Transform.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Meshlet Culling
+//-------------------------------------------------------------------------
+// CPU culling of mesh meshlets against a view volume (bounding spheres) and the camera position (normal cones)
+// The visible meshlets are then compacted into a single index list that can be uploaded to a dynamic index buffer
+//
+// Notes:
+// * The mesh world transform is expected to have a uniform scale (as the engine doesnt support non-uniform scaling)
+// * Backface culling should be disabled for meshes with double-sided materials
+
+namespace EE::Render::MeshletCulling
+{
+    struct Stats
+    {
+        inline void Reset() { *this = Stats(); }
+
+        int32_t                             m_numMeshlets = 0;
+        int32_t                             m_numFrustumCulled = 0;
+        int32_t                             m_numBackfaceCulled = 0;
+        int32_t                             m_numInputIndices = 0;
+        int32_t                             m_numOutputIndices = 0;
+    };
+
+    // Is the meshlet potentially visible
+    EE_ENGINE_API bool IsMeshletVisible( Mesh::Meshlet const& meshlet, Transform const& worldTransform, Math::ViewVolume const& viewVolume, bool cullBackfaces, Stats* pStats = nullptr );
+
+    // Cull a range of meshlets, the indices of the visible meshlets are appended to the output list
+    EE_ENGINE_API void CullMeshlets( TVector<Mesh::Meshlet> const& meshlets, uint32_t startMeshlet, uint32_t numMeshlets, Transform const& worldTransform, Math::ViewVolume const& viewVolume, bool cullBackfaces, TVector<uint32_t>& outVisibleMeshlets, Stats* pStats = nullptr );
+
+    // Append the indices of the visible meshlets to the output index list, returns the number of indices added
+    EE_ENGINE_API uint32_t CompactIndices( TVector<uint32_t> const& indices, TVector<Mesh::Meshlet> const& meshlets, TVector<uint32_t> const& visibleMeshlets, TVector<uint32_t>& outIndices, Stats* pStats = nullptr );
+}
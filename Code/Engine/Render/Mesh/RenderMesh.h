@@ -3,6 +3,7 @@
 #include "Engine/_Module/API.h"
 #include "Engine/Render/Material/RenderMaterial.h"
 #include "Base/Render/RenderBuffer.h"
+#include "Base/Render/RenderVertexCompression.h"
 #include "Base/Render/RenderStates.h"
 #include "Base/Resource/ResourcePtr.h"
 #include "Base/Math/BoundingVolumes.h"
@@ -20,6 +21,9 @@ namespace EE::Drawing { class DrawContext; }
 // Notes:
 // * EE uses CCW to determine the facing direction
 // * Meshes use the triangle list topology
+// * Meshes can optionally be split into meshlets (small clusters of triangles), each meshlet is a contiguous range of the index buffer
+// * Meshes can optionally have simplified LODs, all LODs share the vertex buffer and have the same sections as the base mesh (LOD 0)
+// * Meshes can optionally use a compressed vertex format, compressed positions are quantized to the mesh bounds (see RenderVertexCompression.h)
 
 namespace EE::Render
 {
@@ -27,14 +31,15 @@ namespace EE::Render
     {
         friend class MeshCompiler;
         friend class MeshLoader;
+        friend class RenderSubmitBenchmark;
 
-        EE_SERIALIZE( m_vertices, m_indices, m_sections, m_materials, m_vertexBuffer, m_indexBuffer, m_bounds );
+        EE_SERIALIZE( m_vertices, m_indices, m_sections, m_meshlets, m_LODs, m_materials, m_vertexBuffer, m_indexBuffer, m_bounds, m_vertexPositionRange );
 
     public:
 
         struct EE_ENGINE_API GeometrySection
         {
-            EE_SERIALIZE( m_ID, m_startIndex, m_numIndices );
+            EE_SERIALIZE( m_ID, m_startIndex, m_numIndices, m_startMeshlet, m_numMeshlets );
 
             GeometrySection() = default;
             GeometrySection( StringID ID, uint32_t startIndex, uint32_t numIndices );
@@ -42,6 +47,31 @@ namespace EE::Render
             StringID                        m_ID;
             uint32_t                        m_startIndex = 0;
             uint32_t                        m_numIndices = 0;
+            uint32_t                        m_startMeshlet = 0;
+            uint32_t                        m_numMeshlets = 0;         // Zero if the mesh has no meshlets
+        };
+
+        // A cluster of triangles with its culling data, all culling data is in mesh space
+        struct EE_ENGINE_API Meshlet
+        {
+            EE_SERIALIZE( m_boundingSphereCenter, m_boundingSphereRadius, m_coneApex, m_coneAxis, m_coneCutoff, m_startIndex, m_numIndices );
+
+            Float3                          m_boundingSphereCenter = Float3::Zero;
+            float                           m_boundingSphereRadius = 0.0f;
+            Float3                          m_coneApex = Float3::Zero;
+            Float3                          m_coneAxis = Float3::Zero;
+            float                           m_coneCutoff = 1.0f;       // cos( cone angle ), the meshlet is backfacing when viewed from inside the cone
+            uint32_t                        m_startIndex = 0;
+            uint32_t                        m_numIndices = 0;
+        };
+
+        // A simplified version of the mesh sections, the error is the max geometric deviation from the base mesh in mesh space units
+        struct EE_ENGINE_API LOD
+        {
+            EE_SERIALIZE( m_sections, m_error );
+
+            TVector<GeometrySection>        m_sections;
+            float                           m_error = 0.0f;
         };
 
     public:
@@ -59,6 +89,13 @@ namespace EE::Render
         inline int32_t GetNumVertices() const { return m_vertexBuffer.m_byteSize / m_vertexBuffer.m_byteStride; }
         inline VertexFormat const& GetVertexFormat() const { return m_vertexBuffer.m_vertexFormat; }
         inline RenderBuffer const& GetVertexBuffer() const { return m_vertexBuffer; }
+        inline bool HasCompressedVertices() const { return IsCompressedVertexFormat( m_vertexBuffer.m_vertexFormat ); }
+
+        // The range that compressed vertex positions are quantized to, only relevant for compressed vertex formats
+        inline VertexCompression::QuantizationRange const& GetVertexPositionRange() const { return m_vertexPositionRange; }
+
+        // Get the (decompressed) position, normal and UVs of a vertex
+        inline StaticMeshVertex GetVertex( int32_t vertexIdx ) const { EE_ASSERT( vertexIdx >= 0 && vertexIdx < GetNumVertices() ); return VertexCompression::DecodeVertex( GetVertexFormat(), m_vertices.data(), vertexIdx, m_vertexPositionRange ); }
 
         // Indices
         inline TVector<uint32_t> const& GetIndices() const { return m_indices; }
@@ -70,6 +107,16 @@ namespace EE::Render
         inline uint32_t GetNumSections() const { return (uint32_t) m_sections.size(); }
         inline GeometrySection const& GetSection( uint32_t i ) const { EE_ASSERT( i < GetNumSections() ); return m_sections[i]; }
 
+        // Meshlets - only the base LOD has meshlets
+        inline bool HasMeshlets() const { return !m_meshlets.empty(); }
+        inline TVector<Meshlet> const& GetMeshlets() const { return m_meshlets; }
+
+        // LODs - LOD 0 is the base mesh, the simplified LODs are ordered by increasing error
+        inline int32_t GetNumLODs() const { return 1 + (int32_t) m_LODs.size(); }
+        inline float GetLODError( int32_t LOD ) const { EE_ASSERT( LOD >= 0 && LOD < GetNumLODs() ); return ( LOD == 0 ) ? 0.0f : m_LODs[LOD - 1].m_error; }
+        inline TVector<GeometrySection> const& GetLODSections( int32_t LOD ) const { EE_ASSERT( LOD >= 0 && LOD < GetNumLODs() ); return ( LOD == 0 ) ? m_sections : m_LODs[LOD - 1].m_sections; }
+        inline GeometrySection const& GetLODSection( int32_t LOD, uint32_t i ) const { EE_ASSERT( i < GetNumSections() ); return GetLODSections( LOD )[i]; }
+
         // Materials
         TVector<TResourcePtr<Material>> const& GetMaterials() const { return m_materials; }
 
@@ -83,9 +130,12 @@ namespace EE::Render
         Blob                                m_vertices;
         TVector<uint32_t>                   m_indices;
         TVector<GeometrySection>            m_sections;
+        TVector<Meshlet>                    m_meshlets;
+        TVector<LOD>                        m_LODs;
         TVector<TResourcePtr<Material>>     m_materials;
         VertexBuffer                        m_vertexBuffer;
         RenderBuffer                        m_indexBuffer;
         OBB                                 m_bounds;
+        VertexCompression::QuantizationRange m_vertexPositionRange;
     };
 }
\ No newline at end of file
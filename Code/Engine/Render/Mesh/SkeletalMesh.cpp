@@ -5,6 +5,11 @@
 
 namespace EE::Render
 {
+    SkeletalMesh::~SkeletalMesh()
+    {
+        EE_ASSERT( m_boneMaps.empty() ); // Bone maps need to be released before the mesh is unloaded
+    }
+
     bool SkeletalMesh::IsValid() const
     {
         return m_indexBuffer.IsValid() && m_vertexBuffer.IsValid() && ( m_boneIDs.size() == m_parentBoneIndices.size() ) && ( m_boneIDs.size() == m_bindPose.size() );
@@ -12,16 +17,8 @@ namespace EE::Render
 
     int32_t SkeletalMesh::GetBoneIndex( StringID const& boneID ) const
     {
-        auto const numBones = m_boneIDs.size();
-        for ( auto i = 0; i < numBones; i++ )
-        {
-            if ( m_boneIDs[i] == boneID )
-            {
-                return i;
-            }
-        }
-
-        return InvalidIndex;
+        auto iter = m_boneIndexLookupMap.find( boneID );
+        return ( iter != m_boneIndexLookupMap.end() ) ? iter->second : InvalidIndex;
     }
 
     //-------------------------------------------------------------------------
@@ -1,20 +1,34 @@
 #pragma once
 #include "RenderMesh.h"
+#include "Base/Types/HashMap.h"
+#include "Base/Threading/Threading.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation { class Skeleton; }
 
 //-------------------------------------------------------------------------
 
 namespace EE::Render
 {
+    struct AnimationBoneMap;
+
+    //-------------------------------------------------------------------------
+
     class EE_ENGINE_API SkeletalMesh : public Mesh
     {
         friend class SkeletalMeshCompiler;
         friend class MeshLoader;
+        friend class RenderSubmitBenchmark;
+        friend class AnimationBoneMapCache;
 
         EE_RESOURCE( 'smsh', "Skeletal Mesh" );
         EE_SERIALIZE( EE_SERIALIZE_BASE( Mesh ), m_boneIDs, m_parentBoneIndices, m_bindPose, m_inverseBindPose );
 
     public:
 
+        ~SkeletalMesh();
+
         virtual bool IsValid() const override;
 
         // Bone Info
@@ -27,6 +41,7 @@ namespace EE::Render
         // Bind Poses
         inline TVector<Transform> const& GetBindPose() const { return m_bindPose; }
         inline TVector<Transform> const& GetInverseBindPose() const { return m_inverseBindPose; }
+        inline TVector<Matrix> const& GetInverseBindPoseMatrices() const { return m_inverseBindPoseMatrices; }
 
         // Debug
         #if EE_DEVELOPMENT_TOOLS
@@ -39,5 +54,11 @@ namespace EE::Render
         TVector<int32_t>                    m_parentBoneIndices;
         TVector<Transform>                  m_bindPose;             // Note: bind pose is in global space
         TVector<Transform>                  m_inverseBindPose;
+        TVector<Matrix>                     m_inverseBindPoseMatrices;  // Generated at load time, used for skinning
+        THashMap<StringID, int32_t>         m_boneIndexLookupMap;       // Generated at load time
+
+        // The shared animation bone maps for this mesh, see AnimationBoneMapCache
+        mutable Threading::Mutex                                            m_boneMapMutex;
+        mutable THashMap<Animation::Skeleton const*, AnimationBoneMap*>     m_boneMaps;
     };
 }
\ No newline at end of file
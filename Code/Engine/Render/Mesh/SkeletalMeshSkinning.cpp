@@ -0,0 +1,130 @@
+#include "SkeletalMeshSkinning.h"
+#include "SkeletalMesh.h"
+#include "Engine/Animation/AnimationSkeleton.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render
+{
+    AnimationBoneMap const* AnimationBoneMapCache::Acquire( Animation::Skeleton const* pSkeleton, SkeletalMesh const* pMesh )
+    {
+        EE_ASSERT( pSkeleton != nullptr && pMesh != nullptr );
+
+        Threading::ScopeLock lock( pMesh->m_boneMapMutex );
+
+        // Try to find an existing map
+        //-------------------------------------------------------------------------
+
+        auto foundIter = pMesh->m_boneMaps.find( pSkeleton );
+        if ( foundIter != pMesh->m_boneMaps.end() )
+        {
+            foundIter->second->m_refCount++;
+            return foundIter->second;
+        }
+
+        // Create new map
+        //-------------------------------------------------------------------------
+
+        auto pBoneMap = EE::New<AnimationBoneMap>();
+        pBoneMap->m_pSkeleton = pSkeleton;
+        pBoneMap->m_pMesh = pMesh;
+        pBoneMap->m_refCount = 1;
+
+        int32_t const numAnimBones = pSkeleton->GetNumBones();
+        pBoneMap->m_animToMeshBoneMap.resize( numAnimBones, InvalidIndex );
+        for ( auto animBoneIdx = 0; animBoneIdx < numAnimBones; animBoneIdx++ )
+        {
+            pBoneMap->m_animToMeshBoneMap[animBoneIdx] = pMesh->GetBoneIndex( pSkeleton->GetBoneID( animBoneIdx ) );
+        }
+
+        int32_t const numMeshBones = pMesh->GetNumBones();
+        pBoneMap->m_meshToAnimBoneMap.resize( numMeshBones, InvalidIndex );
+        for ( auto meshBoneIdx = 0; meshBoneIdx < numMeshBones; meshBoneIdx++ )
+        {
+            pBoneMap->m_meshToAnimBoneMap[meshBoneIdx] = pSkeleton->GetBoneIndex( pMesh->GetBoneID( meshBoneIdx ) );
+        }
+
+        pMesh->m_boneMaps.insert( TPair<Animation::Skeleton const*, AnimationBoneMap*>( pSkeleton, pBoneMap ) );
+        return pBoneMap;
+    }
+
+    void AnimationBoneMapCache::Release( AnimationBoneMap const*& pBoneMap )
+    {
+        EE_ASSERT( pBoneMap != nullptr && pBoneMap->m_pMesh != nullptr );
+
+        SkeletalMesh const* pMesh = pBoneMap->m_pMesh;
+        Threading::ScopeLock lock( pMesh->m_boneMapMutex );
+
+        auto foundIter = pMesh->m_boneMaps.find( pBoneMap->m_pSkeleton );
+        EE_ASSERT( foundIter != pMesh->m_boneMaps.end() && foundIter->second == pBoneMap );
+
+        AnimationBoneMap* pMutableBoneMap = foundIter->second;
+        EE_ASSERT( pMutableBoneMap->m_refCount > 0 );
+        pMutableBoneMap->m_refCount--;
+
+        if ( pMutableBoneMap->m_refCount == 0 )
+        {
+            pMesh->m_boneMaps.erase( foundIter );
+            EE::Delete( pMutableBoneMap );
+        }
+
+        pBoneMap = nullptr;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void GenerateSkinningTransforms( SkinningBatchElement const* pElements, int32_t numElements )
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+        EE_ASSERT( pElements != nullptr || numElements == 0 );
+
+        for ( int32_t e = 0; e < numElements; e++ )
+        {
+            SkinningBatchElement const& element = pElements[e];
+            EE_ASSERT( element.m_pBoneTransforms != nullptr && element.m_pInverseBindPose != nullptr && element.m_pSkinningTransforms != nullptr );
+
+            Transform const* const pBoneTransforms = element.m_pBoneTransforms;
+            Matrix const* const pInverseBindPose = element.m_pInverseBindPose;
+            Matrix* const pSkinningTransforms = element.m_pSkinningTransforms;
+
+            // Generate skinning matrices
+            //-------------------------------------------------------------------------
+            // Composing in matrix form avoids the quaternion product, renormalization and negative scale branch of the transform multiply
+            // The inverse bind pose is constant so we only need to convert the bone transform and do a single 4x4 multiply per bone
+
+            for ( int32_t i = 0; i < element.m_numBones; i++ )
+            {
+                Matrix const boneMatrix = pBoneTransforms[i].ToMatrix();
+                Matrix const& inverseBindMatrix = pInverseBindPose[i];
+
+                __m128 vX = _mm_shuffle_ps( inverseBindMatrix[0], inverseBindMatrix[0], _MM_SHUFFLE( 0, 0, 0, 0 ) );
+                __m128 vY = _mm_shuffle_ps( inverseBindMatrix[0], inverseBindMatrix[0], _MM_SHUFFLE( 1, 1, 1, 1 ) );
+                __m128 vZ = _mm_shuffle_ps( inverseBindMatrix[0], inverseBindMatrix[0], _MM_SHUFFLE( 2, 2, 2, 2 ) );
+                __m128 const row0 = _mm_add_ps( _mm_add_ps( _mm_mul_ps( vX, boneMatrix[0] ), _mm_mul_ps( vY, boneMatrix[1] ) ), _mm_mul_ps( vZ, boneMatrix[2] ) );
+
+                vX = _mm_shuffle_ps( inverseBindMatrix[1], inverseBindMatrix[1], _MM_SHUFFLE( 0, 0, 0, 0 ) );
+                vY = _mm_shuffle_ps( inverseBindMatrix[1], inverseBindMatrix[1], _MM_SHUFFLE( 1, 1, 1, 1 ) );
+                vZ = _mm_shuffle_ps( inverseBindMatrix[1], inverseBindMatrix[1], _MM_SHUFFLE( 2, 2, 2, 2 ) );
+                __m128 const row1 = _mm_add_ps( _mm_add_ps( _mm_mul_ps( vX, boneMatrix[0] ), _mm_mul_ps( vY, boneMatrix[1] ) ), _mm_mul_ps( vZ, boneMatrix[2] ) );
+
+                vX = _mm_shuffle_ps( inverseBindMatrix[2], inverseBindMatrix[2], _MM_SHUFFLE( 0, 0, 0, 0 ) );
+                vY = _mm_shuffle_ps( inverseBindMatrix[2], inverseBindMatrix[2], _MM_SHUFFLE( 1, 1, 1, 1 ) );
+                vZ = _mm_shuffle_ps( inverseBindMatrix[2], inverseBindMatrix[2], _MM_SHUFFLE( 2, 2, 2, 2 ) );
+                __m128 const row2 = _mm_add_ps( _mm_add_ps( _mm_mul_ps( vX, boneMatrix[0] ), _mm_mul_ps( vY, boneMatrix[1] ) ), _mm_mul_ps( vZ, boneMatrix[2] ) );
+
+                // The inverse bind translation row has W = 1 so the bone translation is simply added
+                vX = _mm_shuffle_ps( inverseBindMatrix[3], inverseBindMatrix[3], _MM_SHUFFLE( 0, 0, 0, 0 ) );
+                vY = _mm_shuffle_ps( inverseBindMatrix[3], inverseBindMatrix[3], _MM_SHUFFLE( 1, 1, 1, 1 ) );
+                vZ = _mm_shuffle_ps( inverseBindMatrix[3], inverseBindMatrix[3], _MM_SHUFFLE( 2, 2, 2, 2 ) );
+                __m128 const row3 = _mm_add_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( vX, boneMatrix[0] ), _mm_mul_ps( vY, boneMatrix[1] ) ), _mm_mul_ps( vZ, boneMatrix[2] ) ), boneMatrix[3] );
+
+                pSkinningTransforms[i][0] = row0;
+                pSkinningTransforms[i][1] = row1;
+                pSkinningTransforms[i][2] = row2;
+                pSkinningTransforms[i][3] = row3;
+            }
+        }
+    }
+}
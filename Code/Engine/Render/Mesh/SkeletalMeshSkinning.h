@@ -0,0 +1,58 @@
+#pragma once
+#include "Engine/_Module/API.h"
+#include "Base/Math/Matrix.h"
+#include "Base/Math/Transform.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation { class Skeleton; }
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render
+{
+    class SkeletalMesh;
+
+    //-------------------------------------------------------------------------
+    // Animation Bone Map
+    //-------------------------------------------------------------------------
+    // The mapping between an animation skeleton and a skeletal mesh, this is shared by all components using the same (skeleton, mesh) pair
+    // Bone maps are stored on the mesh in a hash map keyed by skeleton, so acquiring a map only locks the mesh in question rather than a global cache
+    // Bone maps are ref-counted and need to be released before either of the resources are unloaded
+
+    struct AnimationBoneMap
+    {
+        Animation::Skeleton const*          m_pSkeleton = nullptr;
+        SkeletalMesh const*                 m_pMesh = nullptr;
+        TVector<int32_t>                    m_animToMeshBoneMap;
+        TVector<int32_t>                    m_meshToAnimBoneMap;
+        int32_t                             m_refCount = 0;         // Protected by the owning mesh's bone map mutex
+    };
+
+    class EE_ENGINE_API AnimationBoneMapCache
+    {
+    public:
+
+        // Get the shared bone map for a given skeleton and mesh, this will create the map if it doesnt exist
+        static AnimationBoneMap const* Acquire( Animation::Skeleton const* pSkeleton, SkeletalMesh const* pMesh );
+
+        // Release a previously acquired bone map
+        static void Release( AnimationBoneMap const*& pBoneMap );
+    };
+
+    //-------------------------------------------------------------------------
+    // Skinning
+    //-------------------------------------------------------------------------
+
+    struct SkinningBatchElement
+    {
+        Transform const*                    m_pBoneTransforms = nullptr;        // The global space mesh bone transforms
+        Matrix const*                       m_pInverseBindPose = nullptr;
+        Matrix*                             m_pSkinningTransforms = nullptr;
+        int32_t                             m_numBones = 0;
+    };
+
+    // Generate the skinning transforms for a set of meshes in a single pass
+    EE_ENGINE_API void GenerateSkinningTransforms( SkinningBatchElement const* pElements, int32_t numElements );
+}
@@ -0,0 +1,213 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Engine/Render/LightClustering.h"
+#include "Base/Render/RenderViewport.h"
+#include "Base/Math/Matrix.h"
+#include "Base/Math/Transform.h"
+#include "Base/Time/Time.h"
+#include "Base/Types/Arrays.h"
+
+#if EE_DEVELOPMENT_TOOLS
+#include "Base/Drawing/DebugDrawingCommands.h"
+#include "imgui.h"
+#endif
+
+//-------------------------------------------------------------------------
+// Render Frame Packet
+//-------------------------------------------------------------------------
+// A snapshot of all the state needed to render a frame, extracted on the main thread at the end of the frame
+// Renderers only read from the packet so that a frame can be submitted while the next frame is being simulated
+// Packets only store copies of component state and pointers to resources, never pointers to components or worlds
+
+namespace EE::Render
+{
+    class StaticMesh;
+    class SkeletalMesh;
+    class Material;
+    class CubemapTexture;
+    class RenderTarget;
+
+    //-------------------------------------------------------------------------
+    // Lighting
+    //-------------------------------------------------------------------------
+    // These match the layout of the lighting constant buffers
+
+    struct PunctualLight
+    {
+        Vector                                  m_positionInvRadiusSqr;
+        Vector                                  m_dir;
+        Vector                                  m_color;
+        Vector                                  m_spotAngles;
+    };
+
+    // Punctual lights are not stored in the constant buffer, they are uploaded as a structured buffer and looked up via the light clusters
+    struct LightData
+    {
+        Vector                                  m_SunDirIndirectIntensity = Vector::Zero;// TODO: refactor to Float3 and float
+        Vector                                  m_SunColorRoughnessOneLevel = Vector::Zero;// TODO: refactor to Float3 and float
+        Matrix                                  m_sunShadowMapMatrix = Matrix( ZeroInit );
+        float                                   m_manualExposure = -1.0f;
+        uint32_t                                m_lightingFlags = 0;
+        uint32_t                                m_numPunctualLights = 0;
+        uint32_t                                m_padding = 0;
+        LightClusterShaderParams                m_lightClusters;                // Set by the renderer once the lights have been binned
+    };
+
+    //-------------------------------------------------------------------------
+    // Mesh Instances
+    //-------------------------------------------------------------------------
+
+    struct StaticMeshInstance
+    {
+        StaticMesh const*                       m_pMesh = nullptr;
+        Transform                               m_worldTransform;
+        Vector                                  m_localScale = Vector::One;
+        uint64_t                                m_sectionVisibilityMask = 0;
+        uint64_t                                m_entityID = 0;
+        uint64_t                                m_componentID = 0;
+        int32_t                                 m_firstMaterialIdx = 0;         // Index into the packet material list
+        int32_t                                 m_numMaterials = 0;
+        int32_t                                 m_LOD = 0;
+    };
+
+    struct SkeletalMeshInstance
+    {
+        SkeletalMesh const*                     m_pMesh = nullptr;
+        Transform                               m_worldTransform;
+        uint64_t                                m_sectionVisibilityMask = 0;
+        uint64_t                                m_entityID = 0;
+        uint64_t                                m_componentID = 0;
+        int32_t                                 m_firstMaterialIdx = 0;         // Index into the packet material list
+        int32_t                                 m_numMaterials = 0;
+        int32_t                                 m_firstSkinningTransformIdx = 0;// Index into the packet skinning palette, the mesh bone count defines the palette size
+        int32_t                                 m_LOD = 0;
+    };
+
+    //-------------------------------------------------------------------------
+    // World Packet
+    //-------------------------------------------------------------------------
+
+    struct WorldRenderPacket
+    {
+        // Clear all instance data but keep the allocated memory around for the next frame
+        inline void Reset()
+        {
+            m_pRenderTarget = nullptr;
+            m_clearRenderTarget = false;
+            m_lightData = LightData();
+            m_punctualLights.clear();
+            m_pSkyboxRadianceTexture = nullptr;
+            m_pSkyboxTexture = nullptr;
+            m_staticMeshes.clear();
+            m_skeletalMeshes.clear();
+            m_materials.clear();
+            m_skinningTransforms.clear();
+
+            #if EE_DEVELOPMENT_TOOLS
+            m_debugDrawCommands.Clear();
+            #endif
+        }
+
+        inline Material const* const* GetMaterials( int32_t firstMaterialIdx ) const { return m_materials.data() + firstMaterialIdx; }
+
+    public:
+
+        Viewport                                m_viewport;
+        RenderTarget*                           m_pRenderTarget = nullptr;
+        bool                                    m_clearRenderTarget = false;
+
+        Matrix                                  m_viewProjectionMatrix = Matrix( ZeroInit );
+        LightData                               m_lightData;
+        TVector<PunctualLight>                  m_punctualLights;               // All lights potentially affecting the view
+        CubemapTexture const*                   m_pSkyboxRadianceTexture = nullptr;
+        CubemapTexture const*                   m_pSkyboxTexture = nullptr;
+
+        TVector<StaticMeshInstance>             m_staticMeshes;
+        TVector<SkeletalMeshInstance>           m_skeletalMeshes;
+        TVector<Material const*>                m_materials;
+        TVector<Matrix>                         m_skinningTransforms;
+
+        #if EE_DEVELOPMENT_TOOLS
+        Drawing::FrameCommandBuffer             m_debugDrawCommands;
+        #endif
+    };
+
+    //-------------------------------------------------------------------------
+    // Imgui Packet
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    struct ImguiRenderPacket
+    {
+        struct CommandList
+        {
+            int32_t                             m_firstCommandIdx = 0;
+            int32_t                             m_numCommands = 0;
+            int32_t                             m_numVertices = 0;
+            int32_t                             m_numIndices = 0;
+        };
+
+        inline void Reset()
+        {
+            m_commandLists.clear();
+            m_commands.clear();
+            m_vertices.clear();
+            m_indices.clear();
+            m_displayPos = ImVec2( 0, 0 );
+            m_displaySize = ImVec2( 0, 0 );
+        }
+
+    public:
+
+        TVector<CommandList>                    m_commandLists;
+        TVector<ImDrawCmd>                      m_commands;
+        TVector<ImDrawVert>                     m_vertices;
+        TVector<ImDrawIdx>                      m_indices;
+        ImVec2                                  m_displayPos = ImVec2( 0, 0 );
+        ImVec2                                  m_displaySize = ImVec2( 0, 0 );
+    };
+    #endif
+
+    //-------------------------------------------------------------------------
+    // Frame Packet
+    //-------------------------------------------------------------------------
+
+    struct RenderFramePacket
+    {
+        inline void Reset( Seconds deltaTime )
+        {
+            m_deltaTime = deltaTime;
+            m_numWorlds = 0;
+
+            #if EE_DEVELOPMENT_TOOLS
+            m_pToolsRenderTarget = nullptr;
+            m_imgui.Reset();
+            #endif
+        }
+
+        // Get a world packet to fill, world packets are never freed so that their memory can be reused
+        inline WorldRenderPacket& AddWorld()
+        {
+            if ( m_numWorlds == (int32_t) m_worlds.size() )
+            {
+                m_worlds.emplace_back();
+            }
+
+            WorldRenderPacket& worldPacket = m_worlds[m_numWorlds++];
+            worldPacket.Reset();
+            return worldPacket;
+        }
+
+    public:
+
+        Seconds                                 m_deltaTime = 0.0f;
+        TVector<WorldRenderPacket>              m_worlds;
+        int32_t                                 m_numWorlds = 0;
+
+        #if EE_DEVELOPMENT_TOOLS
+        RenderTarget*                           m_pToolsRenderTarget = nullptr;
+        ImguiRenderPacket                       m_imgui;
+        #endif
+    };
+}
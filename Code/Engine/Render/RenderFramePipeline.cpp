@@ -0,0 +1,106 @@
+#include "RenderFramePipeline.h"
+#include "Base/Time/Timers.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render
+{
+    void FramePipeline::RenderTask::Execute()
+    {
+        EE_ASSERT( m_pPipeline != nullptr && m_pPacket != nullptr );
+
+        ScopedTimer<PlatformClock> timer( m_renderTime );
+        m_pPipeline->m_renderFunction( *m_pPacket, true );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void FramePipeline::Initialize( TaskSystem* pTaskSystem, RenderFunction&& renderFunction )
+    {
+        EE_ASSERT( m_pTaskSystem == nullptr );
+        EE_ASSERT( pTaskSystem != nullptr && renderFunction != nullptr );
+
+        m_pTaskSystem = pTaskSystem;
+        m_renderFunction = eastl::move( renderFunction );
+
+        // The render task is always pinned to the last worker so that frames are submitted from a single thread
+        m_renderTask.threadNum = m_pTaskSystem->GetNumWorkers();
+        m_renderTask.m_pPipeline = this;
+
+        m_currentPacketIdx = 0;
+        m_frameStats = FrameStats();
+    }
+
+    void FramePipeline::Shutdown()
+    {
+        WaitForRenderCompletion();
+
+        m_renderFunction = nullptr;
+        m_pTaskSystem = nullptr;
+    }
+
+    void FramePipeline::SetPipeliningEnabled( bool isEnabled )
+    {
+        if ( !isEnabled )
+        {
+            WaitForRenderCompletion();
+        }
+
+        m_isPipeliningEnabled = isEnabled;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void FramePipeline::ExtractFrame( TFunction<void( RenderFramePacket& )> const& extractFunction )
+    {
+        EE_ASSERT( m_pTaskSystem != nullptr );
+
+        ScopedTimer<PlatformClock> timer( m_frameStats.m_extractionTime );
+        extractFunction( m_framePackets[m_currentPacketIdx] );
+    }
+
+    void FramePipeline::WaitForPreviousFrame()
+    {
+        ScopedTimer<PlatformClock> timer( m_frameStats.m_waitTime );
+        WaitForRenderCompletion();
+    }
+
+    void FramePipeline::SubmitFrame( bool canPipelineFrame )
+    {
+        EE_ASSERT( m_pTaskSystem != nullptr );
+        EE_ASSERT( !m_isRenderTaskInFlight );
+
+        RenderFramePacket& packet = m_framePackets[m_currentPacketIdx];
+
+        m_frameStats.m_wasPipelined = m_isPipeliningEnabled && canPipelineFrame;
+        if ( m_frameStats.m_wasPipelined )
+        {
+            m_renderTask.m_pPacket = &packet;
+            m_pTaskSystem->ScheduleTask( &m_renderTask );
+            m_isRenderTaskInFlight = true;
+        }
+        else
+        {
+            ScopedTimer<PlatformClock> timer( m_frameStats.m_renderTime );
+            m_renderFunction( packet, false );
+        }
+
+        m_currentPacketIdx = ( m_currentPacketIdx + 1 ) % 2;
+    }
+
+    void FramePipeline::WaitForRenderCompletion()
+    {
+        EE_ASSERT( Threading::IsMainThread() );
+
+        if ( !m_isRenderTaskInFlight )
+        {
+            return;
+        }
+
+        EE_PROFILE_SCOPE_RENDER( "Wait For Render Completion" );
+        m_pTaskSystem->WaitForTask( &m_renderTask );
+        m_frameStats.m_renderTime = m_renderTask.m_renderTime;
+        m_isRenderTaskInFlight = false;
+    }
+}
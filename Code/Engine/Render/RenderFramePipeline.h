@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Engine/Render/RenderFramePacket.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Types/Function.h"
+
+//-------------------------------------------------------------------------
+// Render Frame Pipeline
+//-------------------------------------------------------------------------
+// Double-buffers the frame packets and renders each extracted packet either immediately or on a dedicated worker
+// When pipelining is enabled, a packet is rendered while the next frame is being simulated and extracted into the other packet
+// This has no knowledge of worlds or renderers so that both modes can also be driven headless
+
+namespace EE::Render
+{
+    class EE_ENGINE_API FramePipeline
+    {
+    public:
+
+        // Renders a packet, the second argument is whether we are on the render worker (i.e. we cant access any world state)
+        using RenderFunction = TFunction<void( RenderFramePacket const&, bool )>;
+
+        // Frame timings, used to compare pipelined and synchronous frame submission
+        struct FrameStats
+        {
+            Milliseconds            m_extractionTime = 0;       // Main thread time spent snapshotting the frame into the packet
+            Milliseconds            m_waitTime = 0;             // Main thread time spent waiting for the previous frame to finish rendering
+            Milliseconds            m_renderTime = 0;           // Time spent rendering the last completed frame, this is on the render worker when pipelined
+            bool                    m_wasPipelined = false;
+        };
+
+    private:
+
+        struct RenderTask final : public IPinnedTask
+        {
+            virtual void Execute() override final;
+
+            FramePipeline*          m_pPipeline = nullptr;
+            RenderFramePacket*      m_pPacket = nullptr;
+            Milliseconds            m_renderTime = 0;
+        };
+
+    public:
+
+        void Initialize( TaskSystem* pTaskSystem, RenderFunction&& renderFunction );
+        void Shutdown();
+
+        // Should we render each frame while simulating the next one
+        void SetPipeliningEnabled( bool isEnabled );
+        inline bool IsPipeliningEnabled() const { return m_isPipeliningEnabled; }
+
+        // Extract the next frame into the packet that isnt being rendered
+        void ExtractFrame( TFunction<void( RenderFramePacket& )> const& extractFunction );
+
+        // Wait for the previous frame, we only have two packets so can never be more than one frame ahead
+        void WaitForPreviousFrame();
+
+        // Render the last extracted packet, this will only be pipelined if pipelining is enabled and the frame allows it
+        void SubmitFrame( bool canPipelineFrame );
+
+        // Block until the in-flight frame (if any) has completed rendering, needs to be called before freeing any resources a frame packet might reference
+        void WaitForRenderCompletion();
+
+        inline FrameStats const& GetFrameStats() const { return m_frameStats; }
+
+    private:
+
+        TaskSystem*                 m_pTaskSystem = nullptr;
+        RenderFunction              m_renderFunction;
+        RenderFramePacket           m_framePackets[2];
+        int32_t                     m_currentPacketIdx = 0;
+        RenderTask                  m_renderTask;
+        FrameStats                  m_frameStats;
+        bool                        m_isPipeliningEnabled = false;
+        bool                        m_isRenderTaskInFlight = false;
+    };
+}
@@ -0,0 +1,550 @@
+#include "RenderSubmitBenchmark.h"
+#include "Engine/Render/Renderers/WorldRenderer.h"
+#include "Engine/Render/RenderFramePipeline.h"
+#include "Engine/Render/Mesh/StaticMesh.h"
+#include "Engine/Render/Mesh/SkeletalMesh.h"
+#include "Engine/Render/Material/RenderMaterial.h"
+#include "Base/Render/RenderVertexFormats.h"
+#include "Base/Math/MathRandom.h"
+#include "Base/Time/Timers.h"
+#include "EASTL/sort.h"
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+namespace EE::Render
+{
+    RenderSubmitBenchmark::RenderSubmitBenchmark( RenderDevice* pRenderDevice, Settings const& settings )
+        : m_pRenderDevice( pRenderDevice )
+        , m_settings( settings )
+    {
+        EE_ASSERT( m_pRenderDevice != nullptr && m_pRenderDevice->IsInitialized() );
+    }
+
+    RenderSubmitBenchmark::~RenderSubmitBenchmark()
+    {
+        EE_ASSERT( m_staticMeshes.empty() && m_skeletalMeshes.empty() && m_materials.empty() );
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool RenderSubmitBenchmark::CreateScene()
+    {
+        if ( m_settings.m_numSectionsPerMesh <= 0 || m_settings.m_numSectionsPerMesh > 64 || m_settings.m_numTrianglesPerSection <= 0 )
+        {
+            EE_LOG_ERROR( "Render", "Render Submit Benchmark", "Invalid mesh settings (sections need to be in the range [1, 64])" );
+            return false;
+        }
+
+        // The skinning constant buffer holds 255 matrices
+        if ( m_settings.m_numBonesPerMesh <= 0 || m_settings.m_numBonesPerMesh > 255 )
+        {
+            EE_LOG_ERROR( "Render", "Render Submit Benchmark", "Invalid bone count (needs to be in the range [1, 255])" );
+            return false;
+        }
+
+        Math::RNG rng( m_settings.m_seed );
+
+        // Materials
+        //-------------------------------------------------------------------------
+
+        for ( int32_t i = 0; i < m_settings.m_numMaterials; i++ )
+        {
+            m_materials.emplace_back( EE::New<Material>() );
+        }
+
+        // Shared geometry
+        //-------------------------------------------------------------------------
+        // All meshes share the same topology, only the GPU buffers are unique
+
+        int32_t const numIndicesPerSection = m_settings.m_numTrianglesPerSection * 3;
+        int32_t const numIndices = numIndicesPerSection * m_settings.m_numSectionsPerMesh;
+        int32_t const numVertices = Math::Max( 3, numIndices / 2 );
+
+        TVector<uint32_t> indices;
+        indices.resize( numIndices );
+        for ( int32_t i = 0; i < numIndices; i++ )
+        {
+            indices[i] = (uint32_t) ( i % numVertices );
+        }
+
+        auto InitializeMesh = [&] ( Mesh* pMesh, VertexFormat vertexFormat )
+        {
+            uint32_t const vertexStride = VertexLayoutRegistry::GetDescriptorForFormat( vertexFormat ).m_byteSize;
+
+            pMesh->m_vertices.resize( numVertices * vertexStride, 0 );
+            pMesh->m_indices = indices;
+
+            for ( int32_t s = 0; s < m_settings.m_numSectionsPerMesh; s++ )
+            {
+                pMesh->m_sections.emplace_back( StringID( (uint32_t) s + 1 ), s * numIndicesPerSection, numIndicesPerSection );
+            }
+
+            pMesh->m_vertexBuffer.m_vertexFormat = vertexFormat;
+            pMesh->m_vertexBuffer.m_byteStride = vertexStride;
+            pMesh->m_vertexBuffer.m_byteSize = (uint32_t) pMesh->m_vertices.size();
+            pMesh->m_vertexBuffer.m_usage = RenderBuffer::Usage::GPU_only;
+            m_pRenderDevice->CreateBuffer( pMesh->m_vertexBuffer, pMesh->m_vertices.data() );
+
+            pMesh->m_indexBuffer.m_type = RenderBuffer::Type::Index;
+            pMesh->m_indexBuffer.m_byteStride = sizeof( uint32_t );
+            pMesh->m_indexBuffer.m_byteSize = (uint32_t) ( pMesh->m_indices.size() * sizeof( uint32_t ) );
+            pMesh->m_indexBuffer.m_usage = RenderBuffer::Usage::GPU_only;
+            m_pRenderDevice->CreateBuffer( pMesh->m_indexBuffer, pMesh->m_indices.data() );
+
+            return pMesh->m_vertexBuffer.IsValid() && pMesh->m_indexBuffer.IsValid();
+        };
+
+        // Static Meshes
+        //-------------------------------------------------------------------------
+
+        m_pRenderDevice->LockDevice();
+
+        bool meshesCreated = true;
+        for ( int32_t i = 0; i < m_settings.m_numStaticMeshes; i++ )
+        {
+            StaticMesh* pMesh = m_staticMeshes.emplace_back( EE::New<StaticMesh>() );
+            meshesCreated &= InitializeMesh( pMesh, VertexFormat::StaticMesh );
+        }
+
+        // Skeletal Meshes
+        //-------------------------------------------------------------------------
+
+        for ( int32_t i = 0; i < m_settings.m_numSkeletalMeshes; i++ )
+        {
+            SkeletalMesh* pMesh = m_skeletalMeshes.emplace_back( EE::New<SkeletalMesh>() );
+            meshesCreated &= InitializeMesh( pMesh, VertexFormat::SkeletalMesh );
+
+            // Simple chain
+            for ( int32_t boneIdx = 0; boneIdx < m_settings.m_numBonesPerMesh; boneIdx++ )
+            {
+                pMesh->m_boneIDs.emplace_back( StringID( (uint32_t) boneIdx + 1 ) );
+                pMesh->m_parentBoneIndices.emplace_back( boneIdx - 1 );
+                pMesh->m_bindPose.emplace_back( Transform( Quaternion::Identity, Vector( 0, 0, (float) boneIdx ) ) );
+                pMesh->m_inverseBindPose.emplace_back( pMesh->m_bindPose.back().GetInverse() );
+                pMesh->m_inverseBindPoseMatrices.emplace_back( pMesh->m_inverseBindPose.back().ToMatrix() );
+                pMesh->m_boneIndexLookupMap.insert( TPair<StringID, int32_t>( pMesh->m_boneIDs.back(), boneIdx ) );
+            }
+
+            meshesCreated &= pMesh->IsValid();
+        }
+
+        m_pRenderDevice->UnlockDevice();
+
+        if ( !meshesCreated )
+        {
+            EE_LOG_ERROR( "Render", "Render Submit Benchmark", "Failed to create the benchmark meshes" );
+            return false;
+        }
+
+        return true;
+    }
+
+    void RenderSubmitBenchmark::DestroyScene()
+    {
+        m_pRenderDevice->LockDevice();
+
+        auto DestroyMesh = [this] ( Mesh* pMesh )
+        {
+            m_pRenderDevice->DestroyBuffer( pMesh->m_vertexBuffer );
+            m_pRenderDevice->DestroyBuffer( pMesh->m_indexBuffer );
+            EE::Delete( pMesh );
+        };
+
+        for ( auto pMesh : m_staticMeshes )
+        {
+            DestroyMesh( pMesh );
+        }
+        m_staticMeshes.clear();
+
+        for ( auto pMesh : m_skeletalMeshes )
+        {
+            DestroyMesh( pMesh );
+        }
+        m_skeletalMeshes.clear();
+
+        m_pRenderDevice->UnlockDevice();
+
+        for ( auto pMaterial : m_materials )
+        {
+            EE::Delete( pMaterial );
+        }
+        m_materials.clear();
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderSubmitBenchmark::FillPacket( WorldRenderPacket& packet ) const
+    {
+        Math::RNG rng( m_settings.m_seed );
+
+        // View
+        //-------------------------------------------------------------------------
+
+        float const sceneExtents = Math::Max( 10.0f, Math::Sqrt( (float) ( m_settings.m_numStaticMeshInstances + m_settings.m_numSkeletalMeshInstances ) ) * 2.0f );
+        Transform const cameraTransform( Quaternion( EulerAngles( -30.0f, 0.0f, 0.0f ) ), Vector( 0.0f, -sceneExtents, sceneExtents * 0.5f ) );
+        Math::ViewVolume const viewVolume( Float2( m_settings.m_resolution ), FloatRange( 0.1f, sceneExtents * 4.0f ), Degrees( 90.0f ).ToRadians(), cameraTransform.ToMatrix() );
+
+        packet.Reset();
+        packet.m_viewport = Viewport( Int2( 0, 0 ), m_settings.m_resolution, viewVolume );
+        packet.m_viewProjectionMatrix = viewVolume.GetViewProjectionMatrix();
+
+        // Lights
+        //-------------------------------------------------------------------------
+
+        LightData& lightData = packet.m_lightData;
+        lightData.m_lightingFlags = WorldRenderer::LIGHTING_ENABLE_SUN;
+        lightData.m_SunDirIndirectIntensity = Vector( 0.3f, 0.3f, -1.0f ).GetNormalized3();
+        lightData.m_SunColorRoughnessOneLevel = Vector( 1.0f, 1.0f, 1.0f, 0.0f );
+
+        if ( m_settings.m_enableSunShadows )
+        {
+            lightData.m_lightingFlags |= WorldRenderer::LIGHTING_ENABLE_SUN_SHADOW;
+            lightData.m_sunShadowMapMatrix = packet.m_viewProjectionMatrix;
+        }
+
+        // Lights are scattered over the scene, spot lights point down at the ground
+        float const cosInner = Math::Cos( Degrees( 30.0f ).ToRadians().ToFloat() );
+        float const cosOuter = Math::Cos( Degrees( 45.0f ).ToRadians().ToFloat() );
+
+        packet.m_punctualLights.reserve( m_settings.m_numPunctualLights );
+        for ( int32_t i = 0; i < m_settings.m_numPunctualLights; i++ )
+        {
+            PunctualLight& light = packet.m_punctualLights.emplace_back();
+            light.m_positionInvRadiusSqr = Vector( rng.GetFloat( -sceneExtents, sceneExtents ), rng.GetFloat( -sceneExtents, sceneExtents ), rng.GetFloat( 1.0f, 5.0f ), Math::Sqr( 1.0f / rng.GetFloat( 5.0f, 15.0f ) ) );
+            light.m_color = Vector( rng.GetFloat(), rng.GetFloat(), rng.GetFloat() );
+
+            bool const isSpotLight = rng.GetFloat() < m_settings.m_spotLightRatio;
+            if ( isSpotLight )
+            {
+                light.m_dir = Vector::UnitZ;
+                light.m_spotAngles = Vector( cosOuter, 1.0f / ( cosInner - cosOuter ), 0.0f );
+            }
+            else
+            {
+                light.m_dir = Vector::Zero;
+                light.m_spotAngles = Vector( -1.0f, 1.0f, 0.0f );
+            }
+        }
+
+        lightData.m_numPunctualLights = (uint32_t) packet.m_punctualLights.size();
+
+        // Materials are assigned per section, with an occasional default material
+        //-------------------------------------------------------------------------
+
+        auto AddMaterials = [&] ()
+        {
+            for ( int32_t s = 0; s < m_settings.m_numSectionsPerMesh; s++ )
+            {
+                bool const useDefaultMaterial = m_materials.empty() || rng.GetUInt( 0, 9 ) == 0;
+                packet.m_materials.emplace_back( useDefaultMaterial ? nullptr : m_materials[rng.GetUInt( 0, (uint32_t) m_materials.size() - 1 )] );
+            }
+        };
+
+        uint64_t const visibilityMask = ( m_settings.m_numSectionsPerMesh == 64 ) ? ~0ull : ( ( 1ull << m_settings.m_numSectionsPerMesh ) - 1 );
+
+        // Static Meshes
+        //-------------------------------------------------------------------------
+
+        if ( !m_staticMeshes.empty() )
+        {
+            packet.m_staticMeshes.reserve( m_settings.m_numStaticMeshInstances );
+            for ( int32_t i = 0; i < m_settings.m_numStaticMeshInstances; i++ )
+            {
+                StaticMeshInstance& instance = packet.m_staticMeshes.emplace_back();
+                instance.m_pMesh = m_staticMeshes[rng.GetUInt( 0, (uint32_t) m_staticMeshes.size() - 1 )];
+                instance.m_worldTransform = Transform( Quaternion( EulerAngles( 0.0f, 0.0f, rng.GetFloat( 0.0f, 360.0f ) ) ), Vector( rng.GetFloat( -sceneExtents, sceneExtents ), rng.GetFloat( -sceneExtents, sceneExtents ), 0.0f ) );
+                instance.m_sectionVisibilityMask = visibilityMask;
+                instance.m_entityID = i + 1;
+                instance.m_componentID = i + 1;
+                instance.m_firstMaterialIdx = (int32_t) packet.m_materials.size();
+                instance.m_numMaterials = m_settings.m_numSectionsPerMesh;
+                AddMaterials();
+            }
+        }
+
+        // Skeletal Meshes
+        //-------------------------------------------------------------------------
+
+        if ( !m_skeletalMeshes.empty() )
+        {
+            packet.m_skeletalMeshes.reserve( m_settings.m_numSkeletalMeshInstances );
+            for ( int32_t i = 0; i < m_settings.m_numSkeletalMeshInstances; i++ )
+            {
+                SkeletalMesh const* pMesh = m_skeletalMeshes[rng.GetUInt( 0, (uint32_t) m_skeletalMeshes.size() - 1 )];
+
+                SkeletalMeshInstance& instance = packet.m_skeletalMeshes.emplace_back();
+                instance.m_pMesh = pMesh;
+                instance.m_worldTransform = Transform( Quaternion::Identity, Vector( rng.GetFloat( -sceneExtents, sceneExtents ), rng.GetFloat( -sceneExtents, sceneExtents ), 0.0f ) );
+                instance.m_sectionVisibilityMask = visibilityMask;
+                instance.m_entityID = m_settings.m_numStaticMeshInstances + i + 1;
+                instance.m_componentID = m_settings.m_numStaticMeshInstances + i + 1;
+                instance.m_firstMaterialIdx = (int32_t) packet.m_materials.size();
+                instance.m_numMaterials = m_settings.m_numSectionsPerMesh;
+                instance.m_firstSkinningTransformIdx = (int32_t) packet.m_skinningTransforms.size();
+                AddMaterials();
+
+                packet.m_skinningTransforms.resize( packet.m_skinningTransforms.size() + pMesh->GetNumBones(), Matrix::Identity );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool RenderSubmitBenchmark::Run( RenderDevice* pRenderDevice, Settings const& settings, Results& outResults, TaskSystem* pTaskSystem )
+    {
+        EE_ASSERT( pRenderDevice != nullptr && pRenderDevice->IsInitialized() );
+        EE_ASSERT( settings.m_numFrames > 0 && settings.m_numWarmupFrames >= 0 );
+
+        outResults = Results();
+
+        // Setup
+        //-------------------------------------------------------------------------
+
+        RenderSubmitBenchmark benchmark( pRenderDevice, settings );
+        if ( !benchmark.CreateScene() )
+        {
+            benchmark.DestroyScene();
+            return false;
+        }
+
+        WorldRenderer worldRenderer;
+        if ( !worldRenderer.Initialize( pRenderDevice, pTaskSystem ) )
+        {
+            EE_LOG_ERROR( "Render", "Render Submit Benchmark", "Failed to initialize world renderer" );
+            worldRenderer.Shutdown();
+            benchmark.DestroyScene();
+            return false;
+        }
+
+        RenderTarget renderTarget;
+        pRenderDevice->CreateRenderTarget( renderTarget, settings.m_resolution );
+
+        WorldRenderPacket packet;
+        benchmark.FillPacket( packet );
+
+        // Run
+        //-------------------------------------------------------------------------
+        // Only the packet submission is timed, presenting is excluded since it would measure the GPU/driver and not our code
+
+        TVector<float> submitTimes;
+        submitTimes.reserve( settings.m_numFrames );
+
+        // Light binning is also run standalone so that its cost can be tracked independently of the draw submission
+        LightClusterGrid lightClusterGrid;
+        TVector<float> lightBinningTimes;
+        lightBinningTimes.reserve( settings.m_numFrames );
+
+        int32_t const totalFrames = settings.m_numWarmupFrames + settings.m_numFrames;
+        for ( int32_t frameIdx = 0; frameIdx < totalFrames; frameIdx++ )
+        {
+            #if EE_RENDER_NULL_DEVICE
+            pRenderDevice->ResetStats();
+            #endif
+
+            Nanoseconds const startTime = PlatformClock::GetTime();
+            worldRenderer.RenderPacket( packet, renderTarget );
+            Nanoseconds const endTime = PlatformClock::GetTime();
+
+            outResults.m_drawStats = worldRenderer.GetDrawStats();
+            outResults.m_lightClusterStats = worldRenderer.GetLightClusterStats();
+
+            #if EE_RENDER_NULL_DEVICE
+            outResults.m_stats = pRenderDevice->GetStats();
+            #endif
+
+            pRenderDevice->PresentFrame();
+
+            Nanoseconds const binningStartTime = PlatformClock::GetTime();
+            lightClusterGrid.Build( packet.m_viewport, packet.m_punctualLights, pTaskSystem );
+            Nanoseconds const binningEndTime = PlatformClock::GetTime();
+
+            if ( frameIdx >= settings.m_numWarmupFrames )
+            {
+                submitTimes.emplace_back( ( endTime - startTime ).ToMilliseconds().ToFloat() );
+                lightBinningTimes.emplace_back( ( binningEndTime - binningStartTime ).ToMilliseconds().ToFloat() );
+            }
+        }
+
+        // Results
+        //-------------------------------------------------------------------------
+
+        eastl::sort( submitTimes.begin(), submitTimes.end() );
+
+        float totalTime = 0.0f;
+        for ( float submitTime : submitTimes )
+        {
+            totalTime += submitTime;
+        }
+
+        outResults.m_numFrames = (int32_t) submitTimes.size();
+        outResults.m_averageSubmitTime = totalTime / submitTimes.size();
+        outResults.m_medianSubmitTime = submitTimes[submitTimes.size() / 2];
+        outResults.m_minSubmitTime = submitTimes.front();
+        outResults.m_maxSubmitTime = submitTimes.back();
+
+        eastl::sort( lightBinningTimes.begin(), lightBinningTimes.end() );
+
+        float totalBinningTime = 0.0f;
+        for ( float binningTime : lightBinningTimes )
+        {
+            totalBinningTime += binningTime;
+        }
+
+        outResults.m_averageLightBinningTime = totalBinningTime / lightBinningTimes.size();
+        outResults.m_medianLightBinningTime = lightBinningTimes[lightBinningTimes.size() / 2];
+
+        // Shutdown
+        //-------------------------------------------------------------------------
+
+        pRenderDevice->DestroyRenderTarget( renderTarget );
+        worldRenderer.Shutdown();
+        benchmark.DestroyScene();
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RenderSubmitBenchmark::RunFrames( WorldRenderer& worldRenderer, RenderTarget& renderTarget, TaskSystem* pTaskSystem, bool enablePipelining, PipelineResults::Timings& outTimings ) const
+    {
+        FramePipeline framePipeline;
+        framePipeline.Initialize( pTaskSystem, [&] ( RenderFramePacket const& packet, bool isPipelined )
+        {
+            m_pRenderDevice->LockDevice();
+            for ( int32_t i = 0; i < packet.m_numWorlds; i++ )
+            {
+                worldRenderer.RenderPacket( packet.m_worlds[i], renderTarget );
+            }
+            m_pRenderDevice->PresentFrame();
+            m_pRenderDevice->UnlockDevice();
+        } );
+
+        framePipeline.SetPipeliningEnabled( enablePipelining );
+
+        // Run
+        //-------------------------------------------------------------------------
+        // Frame times are measured from the start of one frame to the start of the next, so they include waiting for the previous frame's render
+
+        TVector<float> frameTimes;
+        frameTimes.reserve( m_settings.m_numFrames );
+
+        outTimings = PipelineResults::Timings();
+
+        int32_t const totalFrames = m_settings.m_numWarmupFrames + m_settings.m_numFrames;
+        Nanoseconds frameStartTime = PlatformClock::GetTime();
+        for ( int32_t frameIdx = 0; frameIdx <= totalFrames; frameIdx++ )
+        {
+            // Record the previous frame
+            //-------------------------------------------------------------------------
+
+            Nanoseconds const currentTime = PlatformClock::GetTime();
+            if ( frameIdx > m_settings.m_numWarmupFrames )
+            {
+                FramePipeline::FrameStats const& frameStats = framePipeline.GetFrameStats();
+                frameTimes.emplace_back( ( currentTime - frameStartTime ).ToMilliseconds().ToFloat() );
+                outTimings.m_averageExtractionTime += frameStats.m_extractionTime;
+                outTimings.m_averageWaitTime += frameStats.m_waitTime;
+                outTimings.m_averageRenderTime += frameStats.m_renderTime;
+                outTimings.m_numPipelinedFrames += frameStats.m_wasPipelined ? 1 : 0;
+            }
+
+            if ( frameIdx == totalFrames )
+            {
+                break;
+            }
+
+            frameStartTime = currentTime;
+
+            // Simulate
+            //-------------------------------------------------------------------------
+
+            while ( ( PlatformClock::GetTime() - frameStartTime ).ToMilliseconds() < m_settings.m_simulationTime )
+            {
+                // Busy wait
+            }
+
+            // Render
+            //-------------------------------------------------------------------------
+
+            framePipeline.ExtractFrame( [this] ( RenderFramePacket& packet )
+            {
+                packet.Reset( Seconds( 1.0f / 60 ) );
+                FillPacket( packet.AddWorld() );
+            } );
+
+            framePipeline.WaitForPreviousFrame();
+            framePipeline.SubmitFrame( true );
+        }
+
+        framePipeline.Shutdown();
+
+        // Results
+        //-------------------------------------------------------------------------
+
+        float const numFrames = (float) frameTimes.size();
+        outTimings.m_averageExtractionTime = outTimings.m_averageExtractionTime / numFrames;
+        outTimings.m_averageWaitTime = outTimings.m_averageWaitTime / numFrames;
+        outTimings.m_averageRenderTime = outTimings.m_averageRenderTime / numFrames;
+
+        eastl::sort( frameTimes.begin(), frameTimes.end() );
+
+        float totalTime = 0.0f;
+        for ( float frameTime : frameTimes )
+        {
+            totalTime += frameTime;
+        }
+
+        outTimings.m_averageFrameTime = totalTime / numFrames;
+        outTimings.m_medianFrameTime = frameTimes[frameTimes.size() / 2];
+        outTimings.m_maxFrameTime = frameTimes.back();
+    }
+
+    bool RenderSubmitBenchmark::RunPipelined( RenderDevice* pRenderDevice, Settings const& settings, PipelineResults& outResults, TaskSystem* pTaskSystem )
+    {
+        EE_ASSERT( pRenderDevice != nullptr && pRenderDevice->IsInitialized() );
+        EE_ASSERT( pTaskSystem != nullptr );
+        EE_ASSERT( settings.m_numFrames > 0 && settings.m_numWarmupFrames >= 0 );
+
+        outResults = PipelineResults();
+
+        // Setup
+        //-------------------------------------------------------------------------
+
+        RenderSubmitBenchmark benchmark( pRenderDevice, settings );
+        if ( !benchmark.CreateScene() )
+        {
+            benchmark.DestroyScene();
+            return false;
+        }
+
+        WorldRenderer worldRenderer;
+        if ( !worldRenderer.Initialize( pRenderDevice, pTaskSystem ) )
+        {
+            EE_LOG_ERROR( "Render", "Render Submit Benchmark", "Failed to initialize world renderer" );
+            worldRenderer.Shutdown();
+            benchmark.DestroyScene();
+            return false;
+        }
+
+        RenderTarget renderTarget;
+        pRenderDevice->CreateRenderTarget( renderTarget, settings.m_resolution );
+
+        // Run
+        //-------------------------------------------------------------------------
+
+        benchmark.RunFrames( worldRenderer, renderTarget, pTaskSystem, false, outResults.m_synchronous );
+        benchmark.RunFrames( worldRenderer, renderTarget, pTaskSystem, true, outResults.m_pipelined );
+        outResults.m_numFrames = settings.m_numFrames;
+
+        // Shutdown
+        //-------------------------------------------------------------------------
+
+        pRenderDevice->DestroyRenderTarget( renderTarget );
+        worldRenderer.Shutdown();
+        benchmark.DestroyScene();
+
+        return true;
+    }
+}
+#endif
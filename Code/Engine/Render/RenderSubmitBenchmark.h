@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Engine/Render/RenderFramePacket.h"
+#include "Engine/Render/Renderers/DrawList.h"
+#include "Base/Render/RenderDevice.h"
+#include "Base/Time/Time.h"
+
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+// Render Submit Benchmark
+//-------------------------------------------------------------------------
+// Renders a synthetic scene through the real world renderer to measure the CPU cost of submitting a frame
+// All meshes and materials are generated by the benchmark so no resources or worlds are needed
+// When run on the null device, the submitted work (draws, state changes, uploads) is reported alongside the timings
+// The pipeline benchmark runs the same scene through the frame pipeline to compare pipelined and synchronous frame times
+
+#if EE_DEVELOPMENT_TOOLS
+namespace EE::Render
+{
+    class WorldRenderer;
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API RenderSubmitBenchmark
+    {
+    public:
+
+        struct Settings
+        {
+            int32_t                             m_numWarmupFrames = 10;
+            int32_t                             m_numFrames = 200;
+            int32_t                             m_numStaticMeshes = 32;             // Number of unique static meshes
+            int32_t                             m_numStaticMeshInstances = 4000;
+            int32_t                             m_numSkeletalMeshes = 4;            // Number of unique skeletal meshes
+            int32_t                             m_numSkeletalMeshInstances = 100;
+            int32_t                             m_numSectionsPerMesh = 3;
+            int32_t                             m_numTrianglesPerSection = 1000;
+            int32_t                             m_numBonesPerMesh = 64;
+            int32_t                             m_numMaterials = 16;                // Meshes will randomly be assigned these materials, some sections will use the default material
+            int32_t                             m_numPunctualLights = 256;
+            float                               m_spotLightRatio = 0.25f;           // The fraction of the punctual lights that are spot lights
+            bool                                m_enableSunShadows = true;
+            Int2                                m_resolution = Int2( 1920, 1080 );
+            uint32_t                            m_seed = 0;
+            Milliseconds                        m_simulationTime = 8.0f;            // Pipeline benchmark only: main thread time spent per frame in place of the game update
+        };
+
+        struct Results
+        {
+            Milliseconds                        m_averageSubmitTime = 0.0f;
+            Milliseconds                        m_medianSubmitTime = 0.0f;
+            Milliseconds                        m_minSubmitTime = 0.0f;
+            Milliseconds                        m_maxSubmitTime = 0.0f;
+            int32_t                             m_numFrames = 0;
+            Milliseconds                        m_averageLightBinningTime = 0.0f;   // Light binning is timed separately but is also part of the submit time
+            Milliseconds                        m_medianLightBinningTime = 0.0f;
+            DrawStats                           m_drawStats;                        // Stats for a single frame
+            LightClusterGrid::Stats             m_lightClusterStats;                // Stats for a single frame
+
+            #if EE_RENDER_NULL_DEVICE
+            RenderStats                         m_stats;                            // Stats for a single frame
+            #endif
+        };
+
+        struct PipelineResults
+        {
+            struct Timings
+            {
+                Milliseconds                    m_averageFrameTime = 0.0f;
+                Milliseconds                    m_medianFrameTime = 0.0f;
+                Milliseconds                    m_maxFrameTime = 0.0f;
+                Milliseconds                    m_averageExtractionTime = 0.0f;
+                Milliseconds                    m_averageWaitTime = 0.0f;
+                Milliseconds                    m_averageRenderTime = 0.0f;
+                int32_t                         m_numPipelinedFrames = 0;
+            };
+
+            Timings                             m_synchronous;
+            Timings                             m_pipelined;
+            int32_t                             m_numFrames = 0;
+        };
+
+    public:
+
+        // Runs the benchmark on an initialized device, returns false if the renderer or scene could not be created
+        // If a task system is supplied, the renderer will use it to bin lights in parallel
+        static bool Run( RenderDevice* pRenderDevice, Settings const& settings, Results& outResults, TaskSystem* pTaskSystem = nullptr );
+
+        // Runs whole frames (simulation, extraction and rendering) through a frame pipeline, once synchronously and once pipelined
+        // The task system is required since pipelined frames are rendered on a pinned worker
+        static bool RunPipelined( RenderDevice* pRenderDevice, Settings const& settings, PipelineResults& outResults, TaskSystem* pTaskSystem );
+
+    private:
+
+        RenderSubmitBenchmark( RenderDevice* pRenderDevice, Settings const& settings );
+        ~RenderSubmitBenchmark();
+
+        bool CreateScene();
+        void DestroyScene();
+        void FillPacket( WorldRenderPacket& packet ) const;
+        void RunFrames( WorldRenderer& worldRenderer, RenderTarget& renderTarget, TaskSystem* pTaskSystem, bool enablePipelining, PipelineResults::Timings& outTimings ) const;
+
+    private:
+
+        RenderDevice*                           m_pRenderDevice = nullptr;
+        Settings                                m_settings;
+        TVector<StaticMesh*>                    m_staticMeshes;
+        TVector<SkeletalMesh*>                  m_skeletalMeshes;
+        TVector<Material*>                      m_materials;
+    };
+}
+#endif
@@ -404,6 +404,32 @@ namespace EE::Render
         EE_ASSERT( pDebugDrawingSystem != nullptr );
         pDebugDrawingSystem->ReflectFrameCommandBuffer( deltaTime, m_drawCommands );
 
+        RenderCommands( viewport, renderTarget, m_drawCommands );
+    }
+
+    void DebugRenderer::ExtractWorld( Seconds const deltaTime, EntityWorld* pWorld, Drawing::FrameCommandBuffer& outCommands )
+    {
+        EE_ASSERT( IsInitialized() && Threading::IsMainThread() );
+        EE_PROFILE_FUNCTION_RENDER();
+
+        auto pDebugDrawingSystem = pWorld->GetDebugDrawingSystem();
+        EE_ASSERT( pDebugDrawingSystem != nullptr );
+        pDebugDrawingSystem->ReflectFrameCommandBuffer( deltaTime, m_drawCommands );
+
+        // We need to keep our own copy of the commands since any commands with a TTL will be drawn again next frame
+        outCommands = m_drawCommands;
+    }
+
+    void DebugRenderer::RenderCommands( Viewport const& viewport, RenderTarget const& renderTarget, Drawing::FrameCommandBuffer const& drawCommands )
+    {
+        EE_ASSERT( IsInitialized() );
+        EE_PROFILE_FUNCTION_RENDER();
+
+        if ( !viewport.IsValid() )
+        {
+            return;
+        }
+
         //-------------------------------------------------------------------------
 
         auto const& renderContext = m_pRenderDevice->GetImmediateContext();
@@ -419,18 +445,18 @@ namespace EE::Render
             m_pointRS.SetState( renderContext, viewport );
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DebugRenderer::DrawPoints( renderContext, viewport, m_drawCommands.m_opaqueDepthOn.m_pointCommands );
+            DebugRenderer::DrawPoints( renderContext, viewport, drawCommands.m_opaqueDepthOn.m_pointCommands );
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DebugRenderer::DrawPoints( renderContext, viewport, m_drawCommands.m_opaqueDepthOff.m_pointCommands );
+            DebugRenderer::DrawPoints( renderContext, viewport, drawCommands.m_opaqueDepthOff.m_pointCommands );
 
             //-------------------------------------------------------------------------
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DebugRenderer::DrawPoints( renderContext, viewport, m_drawCommands.m_transparentDepthOn.m_pointCommands );
+            DebugRenderer::DrawPoints( renderContext, viewport, drawCommands.m_transparentDepthOn.m_pointCommands );
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DebugRenderer::DrawPoints( renderContext, viewport, m_drawCommands.m_transparentDepthOff.m_pointCommands );
+            DebugRenderer::DrawPoints( renderContext, viewport, drawCommands.m_transparentDepthOff.m_pointCommands );
         }
 
         //-------------------------------------------------------------------------
@@ -442,18 +468,18 @@ namespace EE::Render
             m_lineRS.SetState( renderContext, viewport );
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DebugRenderer::DrawLines( renderContext, viewport, m_drawCommands.m_opaqueDepthOn.m_lineCommands );
+            DebugRenderer::DrawLines( renderContext, viewport, drawCommands.m_opaqueDepthOn.m_lineCommands );
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DebugRenderer::DrawLines( renderContext, viewport, m_drawCommands.m_opaqueDepthOff.m_lineCommands );
+            DebugRenderer::DrawLines( renderContext, viewport, drawCommands.m_opaqueDepthOff.m_lineCommands );
 
             //-------------------------------------------------------------------------
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DebugRenderer::DrawLines( renderContext, viewport, m_drawCommands.m_transparentDepthOn.m_lineCommands );
+            DebugRenderer::DrawLines( renderContext, viewport, drawCommands.m_transparentDepthOn.m_lineCommands );
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DebugRenderer::DrawLines( renderContext, viewport, m_drawCommands.m_transparentDepthOff.m_lineCommands );
+            DebugRenderer::DrawLines( renderContext, viewport, drawCommands.m_transparentDepthOff.m_lineCommands );
         }
 
         //-------------------------------------------------------------------------
@@ -465,18 +491,18 @@ namespace EE::Render
             m_primitiveRS.SetState( renderContext, viewport );
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DebugRenderer::DrawTriangles( renderContext, viewport, m_drawCommands.m_opaqueDepthOn.m_triangleCommands );
+            DebugRenderer::DrawTriangles( renderContext, viewport, drawCommands.m_opaqueDepthOn.m_triangleCommands );
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DebugRenderer::DrawTriangles( renderContext, viewport, m_drawCommands.m_opaqueDepthOff.m_triangleCommands );
+            DebugRenderer::DrawTriangles( renderContext, viewport, drawCommands.m_opaqueDepthOff.m_triangleCommands );
 
             //-------------------------------------------------------------------------
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DebugRenderer::DrawTriangles( renderContext, viewport, m_drawCommands.m_transparentDepthOn.m_triangleCommands );
+            DebugRenderer::DrawTriangles( renderContext, viewport, drawCommands.m_transparentDepthOn.m_triangleCommands );
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DebugRenderer::DrawTriangles( renderContext, viewport, m_drawCommands.m_transparentDepthOff.m_triangleCommands );
+            DebugRenderer::DrawTriangles( renderContext, viewport, drawCommands.m_transparentDepthOff.m_triangleCommands );
         }
 
         //-------------------------------------------------------------------------
@@ -490,12 +516,12 @@ namespace EE::Render
             auto textRenderfunc = [this] ( RenderContext const& renderContext, Viewport const& viewport, TVector<TextCommand> const& commands, IntRange cmdRange ) { DebugRenderer::DrawText( renderContext, viewport, commands, cmdRange ); };
 
             renderContext.SetDepthTestMode( DepthTestMode::On );
-            DrawTextCommands( m_drawCommands.m_opaqueDepthOn.m_textCommands, renderContext, viewport, textRenderfunc );
-            DrawTextCommands( m_drawCommands.m_transparentDepthOn.m_textCommands, renderContext, viewport, textRenderfunc );
+            DrawTextCommands( drawCommands.m_opaqueDepthOn.m_textCommands, renderContext, viewport, textRenderfunc );
+            DrawTextCommands( drawCommands.m_transparentDepthOn.m_textCommands, renderContext, viewport, textRenderfunc );
 
             renderContext.SetDepthTestMode( DepthTestMode::Off );
-            DrawTextCommands( m_drawCommands.m_opaqueDepthOff.m_textCommands, renderContext, viewport, textRenderfunc );
-            DrawTextCommands( m_drawCommands.m_transparentDepthOff.m_textCommands, renderContext, viewport, textRenderfunc );
+            DrawTextCommands( drawCommands.m_opaqueDepthOff.m_textCommands, renderContext, viewport, textRenderfunc );
+            DrawTextCommands( drawCommands.m_transparentDepthOff.m_textCommands, renderContext, viewport, textRenderfunc );
         }
     }
 }
@@ -23,6 +23,15 @@ namespace EE::Render
         void Shutdown();
         void RenderWorld( Seconds const deltaTime, Viewport const& viewport, RenderTarget const& renderTarget, EntityWorld* pWorld ) override final;
 
+        // Rendering a world reflects the world's debug drawing commands, the rendering system uses the extracted commands instead so this doesnt block pipelining
+        bool RequiresWorldAccess( EntityWorld const* pWorld ) const override final { return true; }
+
+        // Reflect this frame's debug drawing commands for the world into the supplied buffer
+        void ExtractWorld( Seconds const deltaTime, EntityWorld* pWorld, Drawing::FrameCommandBuffer& outCommands );
+
+        // Draw a previously extracted set of commands, doesnt touch any world state
+        void RenderCommands( Viewport const& viewport, RenderTarget const& renderTarget, Drawing::FrameCommandBuffer const& drawCommands );
+
     private:
 
         void DrawPoints( RenderContext const& renderContext, Viewport const& viewport, TVector<Drawing::PointCommand> const& commands );
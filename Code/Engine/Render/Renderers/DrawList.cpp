@@ -0,0 +1,119 @@
+#include "DrawList.h"
+#include "Base/Math/Math.h"
+#include "EASTL/sort.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render
+{
+    DrawStats& DrawStats::operator+=( DrawStats const& rhs )
+    {
+        m_numSections += rhs.m_numSections;
+        m_numDraws += rhs.m_numDraws;
+        m_numInstancesMerged += rhs.m_numInstancesMerged;
+        m_numMaterialBinds += rhs.m_numMaterialBinds;
+        m_numMaterialBindsSkipped += rhs.m_numMaterialBindsSkipped;
+        m_numMeshBinds += rhs.m_numMeshBinds;
+        m_numMeshBindsSkipped += rhs.m_numMeshBindsSkipped;
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void DrawList::Reset()
+    {
+        m_items.clear();
+        m_batches.clear();
+        m_materialIDs.clear();
+        m_meshIDs.clear();
+        m_isSorted = false;
+    }
+
+    uint16_t DrawList::GetMaterialID( Material const* pMaterial )
+    {
+        // The default material always has ID 0
+        if ( pMaterial == nullptr )
+        {
+            return 0;
+        }
+
+        auto iter = m_materialIDs.find( pMaterial );
+        if ( iter != m_materialIDs.end() )
+        {
+            return iter->second;
+        }
+
+        // If we run out of IDs, all remaining materials share the last one - this only affects the sort order and not correctness
+        uint16_t const materialID = (uint16_t) Math::Min( (uint32_t) m_materialIDs.size() + 1, s_maxMaterials );
+        m_materialIDs.insert( TPair<void const*, uint16_t>( pMaterial, materialID ) );
+        return materialID;
+    }
+
+    uint16_t DrawList::GetMeshID( void const* pMesh )
+    {
+        EE_ASSERT( pMesh != nullptr );
+
+        auto iter = m_meshIDs.find( pMesh );
+        if ( iter != m_meshIDs.end() )
+        {
+            return iter->second;
+        }
+
+        uint16_t const meshID = (uint16_t) Math::Min( (uint32_t) m_meshIDs.size(), s_maxMeshes );
+        m_meshIDs.insert( TPair<void const*, uint16_t>( pMesh, meshID ) );
+        return meshID;
+    }
+
+    void DrawList::AddItem( Pass pass, uint8_t shaderID, void const* pMesh, Material const* pMaterial, uint32_t sectionIdx, uint32_t LOD, int32_t instanceIdx )
+    {
+        EE_ASSERT( shaderID < 16 && sectionIdx < 64 && LOD < 16 );
+
+        // Key layout: | pass (4) | shader (4) | material (16) | mesh (16) | section (6) | LOD (4) | unused (14) |
+        uint64_t sortKey = 0;
+        sortKey |= ( (uint64_t) pass & 0xF ) << 60;
+        sortKey |= ( (uint64_t) shaderID & 0xF ) << 56;
+        sortKey |= ( (uint64_t) GetMaterialID( pMaterial ) ) << 40;
+        sortKey |= ( (uint64_t) GetMeshID( pMesh ) ) << 24;
+        sortKey |= ( (uint64_t) sectionIdx & 0x3F ) << 18;
+        sortKey |= ( (uint64_t) LOD & 0xF ) << 14;
+
+        Item& item = m_items.emplace_back();
+        item.m_sortKey = sortKey;
+        item.m_pMesh = pMesh;
+        item.m_pMaterial = pMaterial;
+        item.m_instanceIdx = instanceIdx;
+        item.m_sectionIdx = sectionIdx;
+        item.m_LOD = LOD;
+
+        m_isSorted = false;
+    }
+
+    void DrawList::Sort()
+    {
+        eastl::sort( m_items.begin(), m_items.end() );
+
+        // Since mesh and material IDs can be clamped, we also need to compare the actual pointers when building batches
+        m_batches.clear();
+
+        int32_t const numItems = (int32_t) m_items.size();
+        for ( int32_t i = 0; i < numItems; i++ )
+        {
+            if ( !m_batches.empty() )
+            {
+                Item const& batchItem = m_items[m_batches.back().m_firstItemIdx];
+                Item const& item = m_items[i];
+                if ( batchItem.m_sortKey == item.m_sortKey && batchItem.m_pMesh == item.m_pMesh && batchItem.m_pMaterial == item.m_pMaterial )
+                {
+                    m_batches.back().m_numItems++;
+                    continue;
+                }
+            }
+
+            Batch& batch = m_batches.emplace_back();
+            batch.m_firstItemIdx = i;
+            batch.m_numItems = 1;
+        }
+
+        m_isSorted = true;
+    }
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Base/Types/Arrays.h"
+#include "Base/Types/HashMap.h"
+
+//-------------------------------------------------------------------------
+// Draw List
+//-------------------------------------------------------------------------
+// Collects all the mesh sections to draw for a pass and sorts them by ( pass, shader, material, mesh, section, LOD )
+// Once sorted, all items with the same key are adjacent and can be drawn as a single instanced draw
+// Mesh and material IDs are assigned per-frame in the order they are first added so that they fit in the key
+
+namespace EE::Render
+{
+    class Material;
+
+    //-------------------------------------------------------------------------
+
+    struct DrawStats
+    {
+        inline void Reset() { *this = DrawStats(); }
+
+        DrawStats& operator+=( DrawStats const& rhs );
+
+    public:
+
+        uint32_t                                m_numSections = 0;                  // The number of draws we would have issued without sorting/merging
+        uint32_t                                m_numDraws = 0;
+        uint32_t                                m_numInstancesMerged = 0;           // Sections that were drawn as part of another draw
+        uint32_t                                m_numMaterialBinds = 0;
+        uint32_t                                m_numMaterialBindsSkipped = 0;
+        uint32_t                                m_numMeshBinds = 0;
+        uint32_t                                m_numMeshBindsSkipped = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API DrawList
+    {
+        constexpr static uint32_t const s_maxMaterials = 0xFFFF;
+        constexpr static uint32_t const s_maxMeshes = 0xFFFF;
+
+    public:
+
+        enum class Pass : uint8_t
+        {
+            Shadow = 0,
+            Opaque,
+        };
+
+        struct Item
+        {
+            inline bool operator<( Item const& rhs ) const
+            {
+                return ( m_sortKey != rhs.m_sortKey ) ? m_sortKey < rhs.m_sortKey : m_instanceIdx < rhs.m_instanceIdx;
+            }
+
+        public:
+
+            uint64_t                            m_sortKey = 0;
+            void const*                         m_pMesh = nullptr;
+            Material const*                     m_pMaterial = nullptr;              // Null for the default material
+            int32_t                             m_instanceIdx = -1;                 // Index into the packet instance list
+            uint32_t                            m_sectionIdx = 0;
+            uint32_t                            m_LOD = 0;
+        };
+
+        // A range of items with the same key, i.e. the same mesh section (and LOD) drawn with the same material
+        struct Batch
+        {
+            int32_t                             m_firstItemIdx = 0;
+            int32_t                             m_numItems = 0;
+        };
+
+    public:
+
+        // Clear all items but keep the allocated memory for the next frame
+        void Reset();
+
+        // Add a single mesh section to draw
+        void AddItem( Pass pass, uint8_t shaderID, void const* pMesh, Material const* pMaterial, uint32_t sectionIdx, uint32_t LOD, int32_t instanceIdx );
+
+        // Sort the items and build the batches, the instance index is used as a tie-breaker so the order is deterministic
+        void Sort();
+
+        inline bool IsEmpty() const { return m_items.empty(); }
+        inline TVector<Item> const& GetItems() const { return m_items; }
+        inline TVector<Batch> const& GetBatches() const { EE_ASSERT( m_isSorted ); return m_batches; }
+        inline Item const& GetItem( int32_t itemIdx ) const { return m_items[itemIdx]; }
+
+    private:
+
+        uint16_t GetMaterialID( Material const* pMaterial );
+        uint16_t GetMeshID( void const* pMesh );
+
+    private:
+
+        TVector<Item>                           m_items;
+        TVector<Batch>                          m_batches;
+        THashMap<void const*, uint16_t>         m_materialIDs;
+        THashMap<void const*, uint16_t>         m_meshIDs;
+        bool                                    m_isSorted = false;
+    };
+}
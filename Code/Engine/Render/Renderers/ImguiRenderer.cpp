@@ -261,99 +261,174 @@ namespace EE::Render
         EE_ASSERT( IsInitialized() && Threading::IsMainThread() );
         EE_PROFILE_FUNCTION_RENDER();
 
-        ImGuiIO& io = ImGui::GetIO();
-
         // Render main imgui viewport
         //-------------------------------------------------------------------------
 
-        ImGui::Render();
+        ExtractDrawData( m_immediateModePacket );
+        RenderPacket( m_immediateModePacket, renderTarget );
 
-        auto const& renderContext = m_pRenderDevice->GetImmediateContext();
-        renderContext.SetRenderTarget( renderTarget );
+        // Viewport Support
+        //-------------------------------------------------------------------------
+
+        UpdatePlatformWindows();
+        RenderPlatformWindows();
+    }
+
+    void ImguiRenderer::ExtractDrawData( ImguiRenderPacket& packet )
+    {
+        EE_ASSERT( IsInitialized() && Threading::IsMainThread() );
+        EE_PROFILE_FUNCTION_RENDER();
+
+        ImGui::Render();
 
+        packet.Reset();
         ImDrawData const* pData = ImGui::GetDrawData();
         if ( pData != nullptr )
         {
-            RenderImguiData( renderContext, pData );
+            RecordDrawData( pData, packet );
         }
+    }
 
-        // Viewport Support
-        //-------------------------------------------------------------------------
+    void ImguiRenderer::RenderPacket( ImguiRenderPacket const& packet, RenderTarget const& renderTarget )
+    {
+        EE_ASSERT( IsInitialized() );
+        EE_PROFILE_FUNCTION_RENDER();
 
+        auto const& renderContext = m_pRenderDevice->GetImmediateContext();
+        renderContext.SetRenderTarget( renderTarget );
+        RenderImguiData( renderContext, packet );
+    }
+
+    void ImguiRenderer::UpdatePlatformWindows()
+    {
+        EE_ASSERT( IsInitialized() && Threading::IsMainThread() );
+
+        ImGuiIO& io = ImGui::GetIO();
         if ( io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable )
         {
             ImGui::UpdatePlatformWindows();
+        }
+    }
 
-            //-------------------------------------------------------------------------
+    bool ImguiRenderer::HasPlatformWindowsToRender() const
+    {
+        ImGuiIO& io = ImGui::GetIO();
+        if ( ( io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable ) == 0 )
+        {
+            return false;
+        }
 
-            ImGuiPlatformIO& platformIO = ImGui::GetPlatformIO();
+        ImGuiPlatformIO& platformIO = ImGui::GetPlatformIO();
+        for ( int i = 1; i < platformIO.Viewports.Size; i++ )
+        {
+            if ( ( platformIO.Viewports[i]->Flags & ImGuiViewportFlags_IsMinimized ) == 0 )
+            {
+                return true;
+            }
+        }
 
-            for ( int i = 1; i < platformIO.Viewports.Size; i++ )
+        return false;
+    }
+
+    void ImguiRenderer::RenderPlatformWindows()
+    {
+        EE_ASSERT( IsInitialized() && Threading::IsMainThread() );
+
+        ImGuiIO& io = ImGui::GetIO();
+        if ( ( io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable ) == 0 )
+        {
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        auto const& renderContext = m_pRenderDevice->GetImmediateContext();
+        ImGuiPlatformIO& platformIO = ImGui::GetPlatformIO();
+
+        for ( int i = 1; i < platformIO.Viewports.Size; i++ )
+        {
+            ImGuiViewport* pViewport = platformIO.Viewports[i];
+            if ( pViewport->Flags & ImGuiViewportFlags_IsMinimized )
             {
-                ImGuiViewport* pViewport = platformIO.Viewports[i];
-                if ( pViewport->Flags & ImGuiViewportFlags_IsMinimized )
-                {
-                    continue;
-                }
+                continue;
+            }
 
-                auto pSecondarySwapChain = (RenderWindow*) pViewport->RendererUserData;
-                EE_ASSERT( pSecondarySwapChain != nullptr );
+            auto pSecondarySwapChain = (RenderWindow*) pViewport->RendererUserData;
+            EE_ASSERT( pSecondarySwapChain != nullptr );
 
-                renderContext.SetRenderTarget( *pSecondarySwapChain->GetRenderTarget() );
-                if ( !( pViewport->Flags & ImGuiViewportFlags_NoRendererClear ) )
-                {
-                    renderContext.ClearRenderTargetViews( *pSecondarySwapChain->GetRenderTarget() );
-                }
-                RenderImguiData( renderContext, pViewport->DrawData );
-                renderContext.Present( *pSecondarySwapChain );
+            renderContext.SetRenderTarget( *pSecondarySwapChain->GetRenderTarget() );
+            if ( !( pViewport->Flags & ImGuiViewportFlags_NoRendererClear ) )
+            {
+                renderContext.ClearRenderTargetViews( *pSecondarySwapChain->GetRenderTarget() );
             }
+
+            m_platformWindowPacket.Reset();
+            RecordDrawData( pViewport->DrawData, m_platformWindowPacket );
+            RenderImguiData( renderContext, m_platformWindowPacket );
+            renderContext.Present( *pSecondarySwapChain );
+        }
+    }
+
+    void ImguiRenderer::RecordDrawData( ImDrawData const* pDrawData, ImguiRenderPacket& packet )
+    {
+        EE_ASSERT( pDrawData != nullptr );
+
+        packet.m_displayPos = pDrawData->DisplayPos;
+        packet.m_displaySize = pDrawData->DisplaySize;
+
+        packet.m_vertices.reserve( pDrawData->TotalVtxCount );
+        packet.m_indices.reserve( pDrawData->TotalIdxCount );
+        packet.m_commandLists.reserve( pDrawData->CmdListsCount );
+
+        for ( int32_t n = 0; n < pDrawData->CmdListsCount; n++ )
+        {
+            ImDrawList const* pCmdList = pDrawData->CmdLists[n];
+
+            auto& commandList = packet.m_commandLists.emplace_back();
+            commandList.m_firstCommandIdx = (int32_t) packet.m_commands.size();
+            commandList.m_numCommands = pCmdList->CmdBuffer.Size;
+            commandList.m_numVertices = pCmdList->VtxBuffer.Size;
+            commandList.m_numIndices = pCmdList->IdxBuffer.Size;
+
+            packet.m_commands.insert( packet.m_commands.end(), pCmdList->CmdBuffer.begin(), pCmdList->CmdBuffer.end() );
+            packet.m_vertices.insert( packet.m_vertices.end(), pCmdList->VtxBuffer.begin(), pCmdList->VtxBuffer.end() );
+            packet.m_indices.insert( packet.m_indices.end(), pCmdList->IdxBuffer.begin(), pCmdList->IdxBuffer.end() );
         }
     }
 
-    void ImguiRenderer::RenderImguiData( RenderContext const& renderContext, ImDrawData const* pDrawData )
+    void ImguiRenderer::RenderImguiData( RenderContext const& renderContext, ImguiRenderPacket const& packet )
     {
-        if ( pDrawData->DisplaySize.x <= 0.0f || pDrawData->DisplaySize.y <= 0.0f )
+        if ( packet.m_displaySize.x <= 0.0f || packet.m_displaySize.y <= 0.0f )
         {
             return;
         }
 
+        int32_t const totalVertexCount = (int32_t) packet.m_vertices.size();
+        int32_t const totalIndexCount = (int32_t) packet.m_indices.size();
+
         // Buffer management
         //-------------------------------------------------------------------------
 
         // Check if our vertex and index buffers are large enough, if not then grow them
-        if ( (int32_t) m_vertexBuffer.GetNumElements() < pDrawData->TotalVtxCount )
+        if ( (int32_t) m_vertexBuffer.GetNumElements() < totalVertexCount )
         {
-            m_pRenderDevice->ResizeBuffer( m_vertexBuffer, sizeof( ImDrawVert ) * pDrawData->TotalVtxCount );
+            m_pRenderDevice->ResizeBuffer( m_vertexBuffer, sizeof( ImDrawVert ) * totalVertexCount );
         }
 
-        if ( (int32_t) m_indexBuffer.GetNumElements() < pDrawData->TotalIdxCount )
+        if ( (int32_t) m_indexBuffer.GetNumElements() < totalIndexCount )
         {
-            m_pRenderDevice->ResizeBuffer( m_indexBuffer, sizeof( ImDrawIdx ) * pDrawData->TotalIdxCount );
+            m_pRenderDevice->ResizeBuffer( m_indexBuffer, sizeof( ImDrawIdx ) * totalIndexCount );
         }
 
         // Transfer buffer data
         //-------------------------------------------------------------------------
 
-        // Copy vertices into our vertex and index buffers and record the command lists
+        // The recorded vertices and indices are already laid out contiguously so we can copy them in one go
         ImDrawVert* pVB = (ImDrawVert*) renderContext.MapBuffer( m_vertexBuffer );
-        int32_t VBWriteIdx = 0;
+        memcpy( pVB, packet.m_vertices.data(), totalVertexCount * sizeof( ImDrawVert ) );
 
         ImDrawIdx* pIB = (ImDrawIdx*) renderContext.MapBuffer( m_indexBuffer );
-        int32_t IBWriteIdx = 0;
-
-        for ( int32_t n = 0; n < pDrawData->CmdListsCount; n++ )
-        {
-            ImDrawList const* pCmdList = pDrawData->CmdLists[n];
-
-            // Copy vertex / index data
-            EE_ASSERT( VBWriteIdx + pCmdList->VtxBuffer.Size <= (int32_t) m_vertexBuffer.GetNumElements() );
-            memcpy( &pVB[VBWriteIdx], pCmdList->VtxBuffer.Data, pCmdList->VtxBuffer.Size * sizeof( ImDrawVert ) );
-            VBWriteIdx += pCmdList->VtxBuffer.Size;
-
-            EE_ASSERT( IBWriteIdx + pCmdList->IdxBuffer.Size <= (int32_t) m_indexBuffer.GetNumElements() );
-            memcpy( &pIB[IBWriteIdx], pCmdList->IdxBuffer.Data, pCmdList->IdxBuffer.Size * sizeof( ImDrawIdx ) );
-            IBWriteIdx += pCmdList->IdxBuffer.Size;
-        }
+        memcpy( pIB, packet.m_indices.data(), totalIndexCount * sizeof( ImDrawIdx ) );
 
         renderContext.UnmapBuffer( m_vertexBuffer );
         renderContext.UnmapBuffer( m_indexBuffer );
@@ -361,7 +436,7 @@ namespace EE::Render
         // Set pipeline and render state
         //-------------------------------------------------------------------------
 
-        renderContext.SetViewport( Float2( pDrawData->DisplaySize.x, pDrawData->DisplaySize.y ), Float2( 0, 0 ) );
+        renderContext.SetViewport( Float2( packet.m_displaySize.x, packet.m_displaySize.y ), Float2( 0, 0 ) );
         renderContext.SetPipelineState( m_PSO );
         renderContext.SetShaderInputBinding( m_inputBinding );
         renderContext.SetPrimitiveTopology( Topology::TriangleList );
@@ -373,10 +448,10 @@ namespace EE::Render
         // Set MVP matrix
         //-------------------------------------------------------------------------
 
-        float const L = pDrawData->DisplayPos.x;
-        float const R = pDrawData->DisplayPos.x + pDrawData->DisplaySize.x;
-        float const T = pDrawData->DisplayPos.y;
-        float const B = pDrawData->DisplayPos.y + pDrawData->DisplaySize.y;
+        float const L = packet.m_displayPos.x;
+        float const R = packet.m_displayPos.x + packet.m_displaySize.x;
+        float const T = packet.m_displayPos.y;
+        float const B = packet.m_displayPos.y + packet.m_displaySize.y;
         float mvp[4][4] =
         {
             { 2.0f / ( R - L ),   0.0f,           0.0f,       0.0f },
@@ -391,13 +466,11 @@ namespace EE::Render
 
         int32_t vertexOffset = 0;
         int32_t indexOffset = 0;
-        for ( int32_t n = 0; n < pDrawData->CmdListsCount; n++ )
+        for ( auto const& commandList : packet.m_commandLists )
         {
-            ImDrawList const* pCmdList = pDrawData->CmdLists[n];
-
-            for ( int32_t cmdIdx = 0; cmdIdx < pCmdList->CmdBuffer.Size; cmdIdx++ )
+            for ( int32_t cmdIdx = 0; cmdIdx < commandList.m_numCommands; cmdIdx++ )
             {
-                ImDrawCmd const* pCmd = &pCmdList->CmdBuffer[cmdIdx];
+                ImDrawCmd const* pCmd = &packet.m_commands[commandList.m_firstCommandIdx + cmdIdx];
                 if ( pCmd->UserCallback != nullptr )
                 {
                     EE_UNIMPLEMENTED_FUNCTION();
@@ -405,7 +478,7 @@ namespace EE::Render
                 else
                 {
                     // Project scissor/clipping rectangles into frame buffer space
-                    ImVec2 const& clipOffset = pDrawData->DisplayPos;
+                    ImVec2 const& clipOffset = packet.m_displayPos;
                     ImVec2 clip_min( pCmd->ClipRect.x - clipOffset.x, pCmd->ClipRect.y - clipOffset.y );
                     ImVec2 clip_max( pCmd->ClipRect.z - clipOffset.x, pCmd->ClipRect.w - clipOffset.y );
                     if ( clip_max.x < clip_min.x || clip_max.y < clip_min.y )
@@ -430,8 +503,8 @@ namespace EE::Render
                 }
             }
 
-            indexOffset += pCmdList->IdxBuffer.Size;
-            vertexOffset += pCmdList->VtxBuffer.Size;
+            indexOffset += commandList.m_numIndices;
+            vertexOffset += commandList.m_numVertices;
         }
 
         // Clear texture binding
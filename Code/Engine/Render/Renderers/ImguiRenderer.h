@@ -3,6 +3,7 @@
 #include "Engine/_Module/API.h"
 #include "imgui.h"
 #include "Engine/Render/IRenderer.h"
+#include "Engine/Render/RenderFramePacket.h"
 #include "Base/Render/RenderDevice.h"
 
 //-------------------------------------------------------------------------
@@ -35,9 +36,24 @@ namespace EE::Render
         void Shutdown();
         void RenderViewport( Seconds const deltaTime, Viewport const& viewport, RenderTarget const& renderTarget ) override final;
 
+        // Imgui never reads world state, the platform windows are handled separately (see HasPlatformWindowsToRender)
+        bool RequiresWorldAccess( EntityWorld const* pWorld ) const override final { return false; }
+
+        // Finalize the imgui frame and copy the main viewport draw data into the supplied packet
+        void ExtractDrawData( ImguiRenderPacket& packet );
+
+        // Render previously extracted draw data, this doesnt touch the imgui context so can be run on any thread that owns the device
+        void RenderPacket( ImguiRenderPacket const& packet, RenderTarget const& renderTarget );
+
+        // Additional platform windows are created, updated and rendered directly from the imgui context so need to be handled on the main thread
+        void UpdatePlatformWindows();
+        bool HasPlatformWindowsToRender() const;
+        void RenderPlatformWindows();
+
     private:
 
-        void RenderImguiData( RenderContext const& renderContext, ImDrawData const* pDrawData );
+        static void RecordDrawData( ImDrawData const* pDrawData, ImguiRenderPacket& packet );
+        void RenderImguiData( RenderContext const& renderContext, ImguiRenderPacket const& packet );
 
     private:
 
@@ -55,6 +71,8 @@ namespace EE::Render
         Texture                         m_fontTexture;
 
         PipelineState                   m_PSO;
+        ImguiRenderPacket               m_immediateModePacket;
+        ImguiRenderPacket               m_platformWindowPacket;
         bool                            m_initialized = false;
     };
 }
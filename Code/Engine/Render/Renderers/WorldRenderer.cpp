@@ -11,6 +11,7 @@
 #include "Base/Render/RenderCoreResources.h"
 #include "Base/Render/RenderViewport.h"
 #include "Base/Profiling.h"
+#include "EASTL/sort.h"
 
 //-------------------------------------------------------------------------
 
@@ -66,10 +67,11 @@ namespace EE::Render
 
     //-------------------------------------------------------------------------
 
-    bool WorldRenderer::Initialize( RenderDevice* pRenderDevice )
+    bool WorldRenderer::Initialize( RenderDevice* pRenderDevice, TaskSystem* pTaskSystem )
     {
         EE_ASSERT( m_pRenderDevice == nullptr && pRenderDevice != nullptr );
         m_pRenderDevice = pRenderDevice;
+        m_pTaskSystem = pTaskSystem;
 
         TVector<RenderBuffer> cbuffers;
         RenderBuffer buffer;
@@ -87,14 +89,29 @@ namespace EE::Render
         buffer.m_slot = 0;
         cbuffers.push_back( buffer );
 
+        // Instance transforms const buffer
+        RenderBuffer instanceBuffer;
+        instanceBuffer.m_byteSize = sizeof( InstanceTransforms ) * s_maxInstancesPerDraw;
+        instanceBuffer.m_byteStride = sizeof( Matrix ); // Vector4 aligned
+        instanceBuffer.m_usage = RenderBuffer::Usage::CPU_and_GPU;
+        instanceBuffer.m_type = RenderBuffer::Type::Constant;
+        instanceBuffer.m_slot = 1;
+        cbuffers.push_back( instanceBuffer );
+
         // Shaders
         auto const vertexLayoutDescStatic = VertexLayoutRegistry::GetDescriptorForFormat( VertexFormat::StaticMesh );
         m_vertexShaderStatic = VertexShader( g_byteCode_VS_StaticPrimitive, sizeof( g_byteCode_VS_StaticPrimitive ), cbuffers, vertexLayoutDescStatic );
         m_pRenderDevice->CreateShader( m_vertexShaderStatic );
 
+        auto const vertexLayoutDescStaticCompressed = VertexLayoutRegistry::GetDescriptorForFormat( VertexFormat::StaticMeshCompressed );
+        m_vertexShaderStaticCompressed = VertexShader( g_byteCode_VS_StaticPrimitiveCompressed, sizeof( g_byteCode_VS_StaticPrimitiveCompressed ), cbuffers, vertexLayoutDescStaticCompressed );
+        m_pRenderDevice->CreateShader( m_vertexShaderStaticCompressed );
+
         // Create Skeletal Mesh Vertex Shader
         //-------------------------------------------------------------------------
 
+        cbuffers.pop_back();
+
         // Vertex shader constant buffer - contains the world view projection matrix and bone transforms
         buffer.m_byteSize = sizeof( Matrix ) * 255; // ( 1 WVP matrix + 255 bone matrices )
         buffer.m_byteStride = sizeof( Matrix ); // Vector4 aligned
@@ -107,7 +124,11 @@ namespace EE::Render
         m_vertexShaderSkeletal = VertexShader( g_byteCode_VS_SkinnedPrimitive, sizeof( g_byteCode_VS_SkinnedPrimitive ), cbuffers, vertexLayoutDescSkeletal );
         pRenderDevice->CreateShader( m_vertexShaderSkeletal );
 
-        if ( !m_vertexShaderStatic.IsValid() )
+        auto const vertexLayoutDescSkeletalCompressed = VertexLayoutRegistry::GetDescriptorForFormat( VertexFormat::SkeletalMeshCompressed );
+        m_vertexShaderSkeletalCompressed = VertexShader( g_byteCode_VS_SkinnedPrimitiveCompressed, sizeof( g_byteCode_VS_SkinnedPrimitiveCompressed ), cbuffers, vertexLayoutDescSkeletalCompressed );
+        pRenderDevice->CreateShader( m_vertexShaderSkeletalCompressed );
+
+        if ( !m_vertexShaderStatic.IsValid() || !m_vertexShaderStaticCompressed.IsValid() || !m_vertexShaderSkeletalCompressed.IsValid() )
         {
             return false;
         }
@@ -287,6 +308,18 @@ namespace EE::Render
             return false;
         }
 
+        m_pRenderDevice->CreateShaderInputBinding( m_vertexShaderStaticCompressed, vertexLayoutDescStaticCompressed, m_inputBindingStaticCompressed );
+        if ( !m_inputBindingStaticCompressed.IsValid() )
+        {
+            return false;
+        }
+
+        m_pRenderDevice->CreateShaderInputBinding( m_vertexShaderSkeletalCompressed, vertexLayoutDescSkeletalCompressed, m_inputBindingSkeletalCompressed );
+        if ( !m_inputBindingSkeletalCompressed.IsValid() )
+        {
+            return false;
+        }
+
         // Set up pipeline states
         //-------------------------------------------------------------------------
 
@@ -319,6 +352,32 @@ namespace EE::Render
         m_pipelineSkybox.m_pVertexShader = &m_vertexShaderSkybox;
         m_pipelineSkybox.m_pPixelShader = &m_pixelShaderSkybox;
 
+        // Set up light cluster buffers
+        //-------------------------------------------------------------------------
+
+        m_punctualLightsBuffer.m_byteStride = sizeof( PunctualLight );
+        m_punctualLightsBuffer.m_byteSize = sizeof( PunctualLight ) * s_initialNumPunctualLights;
+        m_punctualLightsBuffer.m_type = RenderBuffer::Type::Structured;
+        m_punctualLightsBuffer.m_usage = RenderBuffer::Usage::CPU_and_GPU;
+        m_pRenderDevice->CreateBuffer( m_punctualLightsBuffer );
+
+        m_lightClustersBuffer.m_byteStride = sizeof( LightCluster );
+        m_lightClustersBuffer.m_byteSize = sizeof( LightCluster ) * m_lightClusterGrid.GetNumClusters();
+        m_lightClustersBuffer.m_type = RenderBuffer::Type::Structured;
+        m_lightClustersBuffer.m_usage = RenderBuffer::Usage::CPU_and_GPU;
+        m_pRenderDevice->CreateBuffer( m_lightClustersBuffer );
+
+        m_lightIndicesBuffer.m_byteStride = sizeof( uint32_t );
+        m_lightIndicesBuffer.m_byteSize = sizeof( uint32_t ) * s_initialNumLightIndices;
+        m_lightIndicesBuffer.m_type = RenderBuffer::Type::Structured;
+        m_lightIndicesBuffer.m_usage = RenderBuffer::Usage::CPU_and_GPU;
+        m_pRenderDevice->CreateBuffer( m_lightIndicesBuffer );
+
+        if ( !m_punctualLightsBuffer.IsValid() || !m_lightClustersBuffer.IsValid() || !m_lightIndicesBuffer.IsValid() )
+        {
+            return false;
+        }
+
         m_pRenderDevice->CreateTexture( m_precomputedBRDF, DataFormat::Float_R16G16, Float2( 512, 512 ), USAGE_UAV | USAGE_SRV ); // TODO: load from memory?
         m_pipelinePrecomputeBRDF.m_pComputeShader = &m_precomputeDFGComputeShader;
 
@@ -352,6 +411,16 @@ namespace EE::Render
             m_pRenderDevice->DestroyShaderInputBinding( m_inputBindingSkeletal );
         }
 
+        if ( m_inputBindingStaticCompressed.IsValid() )
+        {
+            m_pRenderDevice->DestroyShaderInputBinding( m_inputBindingStaticCompressed );
+        }
+
+        if ( m_inputBindingSkeletalCompressed.IsValid() )
+        {
+            m_pRenderDevice->DestroyShaderInputBinding( m_inputBindingSkeletalCompressed );
+        }
+
         if ( m_rasterizerState.IsValid() )
         {
             m_pRenderDevice->DestroyRasterizerState( m_rasterizerState );
@@ -387,6 +456,16 @@ namespace EE::Render
             m_pRenderDevice->DestroyShader( m_vertexShaderSkeletal );
         }
 
+        if ( m_vertexShaderStaticCompressed.IsValid() )
+        {
+            m_pRenderDevice->DestroyShader( m_vertexShaderStaticCompressed );
+        }
+
+        if ( m_vertexShaderSkeletalCompressed.IsValid() )
+        {
+            m_pRenderDevice->DestroyShader( m_vertexShaderSkeletalCompressed );
+        }
+
         if ( m_pixelShader.IsValid() )
         {
             m_pRenderDevice->DestroyShader( m_pixelShader );
@@ -427,7 +506,24 @@ namespace EE::Render
             m_pRenderDevice->DestroyShader( m_pixelShaderPicking );
         }
 
+        if ( m_punctualLightsBuffer.IsValid() )
+        {
+            m_pRenderDevice->DestroyBuffer( m_punctualLightsBuffer );
+        }
+
+        if ( m_lightClustersBuffer.IsValid() )
+        {
+            m_pRenderDevice->DestroyBuffer( m_lightClustersBuffer );
+        }
+
+        if ( m_lightIndicesBuffer.IsValid() )
+        {
+            m_pRenderDevice->DestroyBuffer( m_lightIndicesBuffer );
+        }
+
+        m_lightClusterGrid.Reset();
         m_pRenderDevice = nullptr;
+        m_pTaskSystem = nullptr;
         m_initialized = false;
     }
 
@@ -481,22 +577,27 @@ namespace EE::Render
 
     //-------------------------------------------------------------------------
 
-    void WorldRenderer::SetupRenderStates( Viewport const& viewport, PixelShader* pShader, RenderData const& data )
+    void WorldRenderer::SetupRenderStates( PixelShader* pShader, WorldRenderPacket const& packet )
     {
         EE_ASSERT( pShader != nullptr && pShader->IsValid() );
         auto const& renderContext = m_pRenderDevice->GetImmediateContext();
 
-        renderContext.SetViewport( Float2( viewport.GetDimensions() ), Float2( viewport.GetTopLeftPosition() ) );
+        renderContext.SetViewport( Float2( packet.m_viewport.GetDimensions() ), Float2( packet.m_viewport.GetTopLeftPosition() ) );
         renderContext.SetDepthTestMode( DepthTestMode::On );
 
         renderContext.SetSampler( PipelineStage::Pixel, 0, m_bilinearSampler );
         renderContext.SetSampler( PipelineStage::Pixel, 1, m_bilinearClampedSampler );
         renderContext.SetSampler( PipelineStage::Pixel, 2, m_shadowSampler );
 
-        renderContext.WriteToBuffer( pShader->GetConstBuffer( 0 ), &data.m_lightData, sizeof( data.m_lightData ) );
+        renderContext.WriteToBuffer( pShader->GetConstBuffer( 0 ), &m_lightData, sizeof( m_lightData ) );
+
+        // Light clusters
+        renderContext.SetShaderResource( PipelineStage::Pixel, 13, m_punctualLightsBuffer.GetShaderResourceView() );
+        renderContext.SetShaderResource( PipelineStage::Pixel, 14, m_lightClustersBuffer.GetShaderResourceView() );
+        renderContext.SetShaderResource( PipelineStage::Pixel, 15, m_lightIndicesBuffer.GetShaderResourceView() );
 
         // Shadows
-        if ( data.m_lightData.m_lightingFlags & LIGHTING_ENABLE_SUN_SHADOW )
+        if ( packet.m_lightData.m_lightingFlags & LIGHTING_ENABLE_SUN_SHADOW )
         {
             renderContext.SetShaderResource( PipelineStage::Pixel, 10, m_shadowMap.GetShaderResourceView() );
         }
@@ -506,10 +607,10 @@ namespace EE::Render
         }
 
         // Skybox
-        if ( data.m_pSkyboxRadianceTexture )
+        if ( packet.m_pSkyboxRadianceTexture )
         {
             renderContext.SetShaderResource( PipelineStage::Pixel, 11, m_precomputedBRDF.GetShaderResourceView() );
-            renderContext.SetShaderResource( PipelineStage::Pixel, 12, data.m_pSkyboxRadianceTexture->GetShaderResourceView() );
+            renderContext.SetShaderResource( PipelineStage::Pixel, 12, packet.m_pSkyboxRadianceTexture->GetShaderResourceView() );
         }
         else
         {
@@ -518,75 +619,269 @@ namespace EE::Render
         }
     }
 
-    void WorldRenderer::RenderStaticMeshes( Viewport const& viewport, RenderTarget const& renderTarget, RenderData const& data )
+    void WorldRenderer::PrepareLightClusters( WorldRenderPacket const& packet )
     {
         EE_PROFILE_FUNCTION_RENDER();
 
         auto const& renderContext = m_pRenderDevice->GetImmediateContext();
 
-        // Set primary render state and clear the render buffer
+        // Bin the lights for this view
         //-------------------------------------------------------------------------
 
-        PipelineState* pPipelineState = renderTarget.HasPickingRT() ? &m_pipelineStateStaticPicking : &m_pipelineStateStatic;
-        SetupRenderStates( viewport, pPipelineState->m_pPixelShader, data );
+        m_lightClusterGrid.Build( packet.m_viewport, packet.m_punctualLights, m_pTaskSystem );
 
-        renderContext.SetPipelineState( *pPipelineState );
-        renderContext.SetShaderInputBinding( m_inputBindingStatic );
-        renderContext.SetPrimitiveTopology( Topology::TriangleList );
+        m_lightData = packet.m_lightData;
+        m_lightData.m_numPunctualLights = (uint32_t) packet.m_punctualLights.size();
+        m_lightData.m_lightClusters = m_lightClusterGrid.GetShaderParams();
 
+        // Upload the binned data, growing the buffers as needed
         //-------------------------------------------------------------------------
 
-        for ( StaticMeshComponent const* pMeshComponent : data.m_staticMeshComponents )
+        uint32_t const numLights = (uint32_t) packet.m_punctualLights.size();
+        if ( m_punctualLightsBuffer.GetNumElements() < numLights )
         {
-            auto pMesh = pMeshComponent->GetMesh();
-            Vector const finalScale = pMeshComponent->GetLocalScale() * pMeshComponent->GetWorldTransform().GetScale();
-            Matrix const worldTransform = Matrix( pMeshComponent->GetWorldTransform().GetRotation(), pMeshComponent->GetWorldTransform().GetTranslation(), finalScale );
+            m_pRenderDevice->ResizeBuffer( m_punctualLightsBuffer, sizeof( PunctualLight ) * numLights );
+        }
 
-            ObjectTransforms transforms = data.m_transforms;
-            transforms.m_worldTransform = worldTransform;
-            transforms.m_worldTransform.SetTranslation( worldTransform.GetTranslation() );
+        TVector<LightCluster> const& clusters = m_lightClusterGrid.GetClusters();
+        if ( m_lightClustersBuffer.GetNumElements() < (uint32_t) clusters.size() )
+        {
+            m_pRenderDevice->ResizeBuffer( m_lightClustersBuffer, sizeof( LightCluster ) * (uint32_t) clusters.size() );
+        }
+
+        TVector<uint32_t> const& lightIndices = m_lightClusterGrid.GetLightIndices();
+        if ( m_lightIndicesBuffer.GetNumElements() < (uint32_t) lightIndices.size() )
+        {
+            m_pRenderDevice->ResizeBuffer( m_lightIndicesBuffer, sizeof( uint32_t ) * (uint32_t) lightIndices.size() );
+        }
+
+        if ( numLights > 0 )
+        {
+            renderContext.WriteToBuffer( m_punctualLightsBuffer, packet.m_punctualLights.data(), sizeof( PunctualLight ) * numLights );
+        }
+
+        renderContext.WriteToBuffer( m_lightClustersBuffer, clusters.data(), sizeof( LightCluster ) * clusters.size() );
+
+        if ( !lightIndices.empty() )
+        {
+            renderContext.WriteToBuffer( m_lightIndicesBuffer, lightIndices.data(), sizeof( uint32_t ) * lightIndices.size() );
+        }
+    }
+
+    void WorldRenderer::PrepareInstanceData( WorldRenderPacket const& packet )
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        // Static mesh transforms are shared by all passes so only calculate them once
+        //-------------------------------------------------------------------------
+
+        m_staticInstanceTransforms.resize( packet.m_staticMeshes.size() );
+
+        int32_t const numStaticMeshes = (int32_t) packet.m_staticMeshes.size();
+        for ( int32_t i = 0; i < numStaticMeshes; i++ )
+        {
+            StaticMeshInstance const& instance = packet.m_staticMeshes[i];
+            Vector const finalScale = instance.m_localScale * instance.m_worldTransform.GetScale();
+
+            InstanceTransforms& transforms = m_staticInstanceTransforms[i];
+            transforms.m_worldTransform = Matrix( instance.m_worldTransform.GetRotation(), instance.m_worldTransform.GetTranslation(), finalScale );
             transforms.m_normalTransform = transforms.m_worldTransform.GetInverse().Transpose();
-            renderContext.WriteToBuffer( m_vertexShaderStatic.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
 
-            if ( renderTarget.HasPickingRT() )
+            // Compressed positions are quantized to the mesh bounds, so fold the dequantization into the world transform (normals are unaffected)
+            if ( instance.m_pMesh->HasCompressedVertices() )
             {
-                PickingData const pd( pMeshComponent->GetEntityID().m_value, pMeshComponent->GetID().m_value );
-                renderContext.WriteToBuffer( m_pixelShaderPicking.GetConstBuffer( 2 ), &pd, sizeof( PickingData ) );
+                VertexCompression::QuantizationRange const& positionRange = instance.m_pMesh->GetVertexPositionRange();
+                Matrix const decodeTransform( Quaternion::Identity, Vector( positionRange.m_offset ), Vector( positionRange.m_scale ) );
+                transforms.m_worldTransform = decodeTransform * transforms.m_worldTransform;
             }
+        }
 
-            renderContext.SetVertexBuffer( pMesh->GetVertexBuffer() );
-            renderContext.SetIndexBuffer( pMesh->GetIndexBuffer() );
+        // Sort skeletal meshes by vertex format and mesh so we can skip redundant shader and buffer binds
+        //-------------------------------------------------------------------------
+        // Each instance has its own skinning palette so these can't be merged into instanced draws
 
-            TVector<Material const*> const& materials = pMeshComponent->GetMaterials();
-            uint64_t const visibility = pMeshComponent->GetSectionVisibilityMask();
+        int32_t const numSkeletalMeshes = (int32_t) packet.m_skeletalMeshes.size();
+        m_skeletalMeshDrawOrder.resize( numSkeletalMeshes );
+        for ( int32_t i = 0; i < numSkeletalMeshes; i++ )
+        {
+            m_skeletalMeshDrawOrder[i] = i;
+        }
 
-            auto const numSubMeshes = pMesh->GetNumSections();
-            for ( auto i = 0u; i < numSubMeshes; i++ )
+        auto SortPredicate = [&packet] ( int32_t a, int32_t b )
+        {
+            SkeletalMesh const* pMeshA = packet.m_skeletalMeshes[a].m_pMesh;
+            SkeletalMesh const* pMeshB = packet.m_skeletalMeshes[b].m_pMesh;
+            if ( pMeshA->GetVertexFormat() != pMeshB->GetVertexFormat() )
+            {
+                return pMeshA->GetVertexFormat() < pMeshB->GetVertexFormat();
+            }
+
+            return ( pMeshA != pMeshB ) ? pMeshA < pMeshB : a < b;
+        };
+
+        eastl::sort( m_skeletalMeshDrawOrder.begin(), m_skeletalMeshDrawOrder.end(), SortPredicate );
+    }
+
+    void WorldRenderer::SubmitStaticMeshDrawList( DrawList const& drawList, WorldRenderPacket const& packet, PipelineState const& pipelineState, PixelShader* pPixelShader, bool isPickingEnabled )
+    {
+        auto const& renderContext = m_pRenderDevice->GetImmediateContext();
+        RenderBuffer const* pInstanceConstBuffer = nullptr;
+        VertexFormat currentVertexFormat = VertexFormat::Unknown;
+
+        // Picking IDs are set per draw, so we cant merge instances when picking
+        int32_t const maxInstancesPerDraw = isPickingEnabled ? 1 : s_maxInstancesPerDraw;
+
+        StaticMesh const* pCurrentMesh = nullptr;
+        Material const* pCurrentMaterial = nullptr;
+        bool isMaterialSet = false;
+
+        for ( DrawList::Batch const& batch : drawList.GetBatches() )
+        {
+            DrawList::Item const& firstItem = drawList.GetItem( batch.m_firstItemIdx );
+            m_drawStats.m_numSections += batch.m_numItems;
+
+            // Set mesh
+            //-------------------------------------------------------------------------
+
+            auto pMesh = reinterpret_cast<StaticMesh const*>( firstItem.m_pMesh );
+            if ( pMesh != pCurrentMesh )
             {
-                // Skip hidden sections
-                if ( ( visibility & ( 1ull << i ) ) == 0 )
+                // The vertex format is part of the shader ID, so this only switches once per format
+                if ( pMesh->GetVertexFormat() != currentVertexFormat )
                 {
-                    continue;
+                    currentVertexFormat = pMesh->GetVertexFormat();
+                    SetMeshPipelineState( renderContext, pipelineState, currentVertexFormat );
+                    pInstanceConstBuffer = &GetMeshVertexShader( currentVertexFormat ).GetConstBuffer( 1 );
                 }
 
-                // Set material
-                if ( i < materials.size() && materials[i] )
+                renderContext.SetVertexBuffer( pMesh->GetVertexBuffer() );
+                renderContext.SetIndexBuffer( pMesh->GetIndexBuffer() );
+                pCurrentMesh = pMesh;
+                m_drawStats.m_numMeshBinds++;
+            }
+            else
+            {
+                m_drawStats.m_numMeshBindsSkipped++;
+            }
+
+            // Set material
+            //-------------------------------------------------------------------------
+            // Depth only passes dont have a pixel shader
+
+            if ( pPixelShader != nullptr )
+            {
+                if ( !isMaterialSet || firstItem.m_pMaterial != pCurrentMaterial )
                 {
-                    SetMaterial( renderContext, *pPipelineState->m_pPixelShader, materials[i] );
+                    if ( firstItem.m_pMaterial != nullptr )
+                    {
+                        SetMaterial( renderContext, *pPixelShader, firstItem.m_pMaterial );
+                    }
+                    else // Use default material
+                    {
+                        SetDefaultMaterial( renderContext, *pPixelShader );
+                    }
+
+                    pCurrentMaterial = firstItem.m_pMaterial;
+                    isMaterialSet = true;
+                    m_drawStats.m_numMaterialBinds++;
                 }
-                else // Use default material
+                else
                 {
-                    SetDefaultMaterial( renderContext, *pPipelineState->m_pPixelShader );
+                    m_drawStats.m_numMaterialBindsSkipped++;
                 }
+            }
 
-                auto const& subMesh = pMesh->GetSection( i );
-                renderContext.DrawIndexed( subMesh.m_numIndices, subMesh.m_startIndex );
+            // Draw all instances
+            //-------------------------------------------------------------------------
+
+            auto const& subMesh = pMesh->GetLODSection( firstItem.m_LOD, firstItem.m_sectionIdx );
+
+            for ( int32_t firstInstanceIdx = 0; firstInstanceIdx < batch.m_numItems; firstInstanceIdx += maxInstancesPerDraw )
+            {
+                int32_t const numInstances = Math::Min( batch.m_numItems - firstInstanceIdx, maxInstancesPerDraw );
+
+                m_batchInstanceTransforms.clear();
+                for ( int32_t i = 0; i < numInstances; i++ )
+                {
+                    DrawList::Item const& item = drawList.GetItem( batch.m_firstItemIdx + firstInstanceIdx + i );
+                    m_batchInstanceTransforms.emplace_back( m_staticInstanceTransforms[item.m_instanceIdx] );
+                }
+                renderContext.WriteToBuffer( *pInstanceConstBuffer, m_batchInstanceTransforms.data(), sizeof( InstanceTransforms ) * numInstances );
+
+                if ( isPickingEnabled )
+                {
+                    StaticMeshInstance const& instance = packet.m_staticMeshes[drawList.GetItem( batch.m_firstItemIdx + firstInstanceIdx ).m_instanceIdx];
+                    PickingData const pd( instance.m_entityID, instance.m_componentID );
+                    renderContext.WriteToBuffer( m_pixelShaderPicking.GetConstBuffer( 2 ), &pd, sizeof( PickingData ) );
+                }
+
+                renderContext.DrawIndexedInstanced( subMesh.m_numIndices, numInstances, subMesh.m_startIndex );
+                m_drawStats.m_numDraws++;
+                m_drawStats.m_numInstancesMerged += numInstances - 1;
+            }
+        }
+    }
+
+    void WorldRenderer::RenderStaticMeshes( WorldRenderPacket const& packet, RenderTarget const& renderTarget )
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        auto const& renderContext = m_pRenderDevice->GetImmediateContext();
+
+        // Set primary render state and clear the render buffer
+        //-------------------------------------------------------------------------
+
+        bool const isPickingEnabled = renderTarget.HasPickingRT();
+        PipelineState* pPipelineState = isPickingEnabled ? &m_pipelineStateStaticPicking : &m_pipelineStateStatic;
+        SetupRenderStates( pPipelineState->m_pPixelShader, packet );
+
+        renderContext.SetPrimitiveTopology( Topology::TriangleList );
+
+        // The pipeline state is set per vertex format when submitting
+        ObjectTransforms transforms;
+        transforms.m_viewprojTransform = packet.m_viewProjectionMatrix;
+        renderContext.WriteToBuffer( m_vertexShaderStatic.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
+        renderContext.WriteToBuffer( m_vertexShaderStaticCompressed.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
+
+        // Build draw list
+        //-------------------------------------------------------------------------
+
+        uint8_t const shaderID = isPickingEnabled ? SHADER_ID_LIT_PICKING : SHADER_ID_LIT;
+
+        m_opaqueDrawList.Reset();
+
+        int32_t const numInstances = (int32_t) packet.m_staticMeshes.size();
+        for ( int32_t instanceIdx = 0; instanceIdx < numInstances; instanceIdx++ )
+        {
+            StaticMeshInstance const& instance = packet.m_staticMeshes[instanceIdx];
+            Material const* const* pMaterials = packet.GetMaterials( instance.m_firstMaterialIdx );
+            uint64_t const visibility = instance.m_sectionVisibilityMask;
+            uint8_t const meshShaderID = instance.m_pMesh->HasCompressedVertices() ? ( shaderID | SHADER_ID_COMPRESSED_VERTICES ) : shaderID;
+
+            uint32_t const numSubMeshes = Math::Min( instance.m_pMesh->GetNumSections(), 64u );
+            for ( auto i = 0u; i < numSubMeshes; i++ )
+            {
+                // Skip hidden sections and sections that were simplified away
+                if ( ( visibility & ( 1ull << i ) ) == 0 || instance.m_pMesh->GetLODSection( instance.m_LOD, i ).m_numIndices == 0 )
+                {
+                    continue;
+                }
+
+                Material const* pMaterial = ( (int32_t) i < instance.m_numMaterials ) ? pMaterials[i] : nullptr;
+                m_opaqueDrawList.AddItem( DrawList::Pass::Opaque, meshShaderID, instance.m_pMesh, pMaterial, i, instance.m_LOD, instanceIdx );
             }
         }
+
+        m_opaqueDrawList.Sort();
+
+        // Submit
+        //-------------------------------------------------------------------------
+
+        SubmitStaticMeshDrawList( m_opaqueDrawList, packet, *pPipelineState, pPipelineState->m_pPixelShader, isPickingEnabled );
         renderContext.ClearShaderResource( PipelineStage::Pixel, 10 );
     }
 
-    void WorldRenderer::RenderSkeletalMeshes( Viewport const& viewport, RenderTarget const& renderTarget, RenderData const& data )
+    void WorldRenderer::RenderSkeletalMeshes( WorldRenderPacket const& packet, RenderTarget const& renderTarget )
     {
         EE_PROFILE_FUNCTION_RENDER();
 
@@ -596,108 +891,143 @@ namespace EE::Render
         //-------------------------------------------------------------------------
 
         PipelineState* pPipelineState = renderTarget.HasPickingRT() ? &m_pipelineStateSkeletalPicking : &m_pipelineStateSkeletal;
-        SetupRenderStates( viewport, pPipelineState->m_pPixelShader, data );
+        SetupRenderStates( pPipelineState->m_pPixelShader, packet );
 
-        renderContext.SetPipelineState( *pPipelineState );
-        renderContext.SetShaderInputBinding( m_inputBindingSkeletal );
         renderContext.SetPrimitiveTopology( Topology::TriangleList );
 
         //-------------------------------------------------------------------------
+        // The pipeline state is set per vertex format, the draw order is sorted by vertex format so this only switches once per format
 
         SkeletalMesh const* pCurrentMesh = nullptr;
+        VertexFormat currentVertexFormat = VertexFormat::Unknown;
+        Material const* pCurrentMaterial = nullptr;
+        bool isMaterialSet = false;
+
+        ObjectTransforms transforms;
+        transforms.m_viewprojTransform = packet.m_viewProjectionMatrix;
 
-        for ( SkeletalMeshComponent const* pMeshComponent : data.m_skeletalMeshComponents )
+        for ( int32_t instanceIdx : m_skeletalMeshDrawOrder )
         {
-            if ( pMeshComponent->GetMesh() != pCurrentMesh )
+            SkeletalMeshInstance const& instance = packet.m_skeletalMeshes[instanceIdx];
+            if ( instance.m_pMesh != pCurrentMesh )
             {
-                pCurrentMesh = pMeshComponent->GetMesh();
+                pCurrentMesh = instance.m_pMesh;
                 EE_ASSERT( pCurrentMesh != nullptr && pCurrentMesh->IsValid() );
 
+                if ( pCurrentMesh->GetVertexFormat() != currentVertexFormat )
+                {
+                    currentVertexFormat = pCurrentMesh->GetVertexFormat();
+                    SetMeshPipelineState( renderContext, *pPipelineState, currentVertexFormat );
+                }
+
                 renderContext.SetVertexBuffer( pCurrentMesh->GetVertexBuffer() );
                 renderContext.SetIndexBuffer( pCurrentMesh->GetIndexBuffer() );
+                m_drawStats.m_numMeshBinds++;
+            }
+            else
+            {
+                m_drawStats.m_numMeshBindsSkipped++;
             }
 
             // Update Bones and Transforms
             //-------------------------------------------------------------------------
 
-            Matrix worldTransform = pMeshComponent->GetWorldTransform().ToMatrix();
-            ObjectTransforms transforms = data.m_transforms;
+            VertexShader const& vertexShader = GetMeshVertexShader( currentVertexFormat );
+            VertexCompression::QuantizationRange const& positionRange = pCurrentMesh->GetVertexPositionRange();
+
+            Matrix worldTransform = instance.m_worldTransform.ToMatrix();
             transforms.m_worldTransform = worldTransform;
             transforms.m_worldTransform.SetTranslation( worldTransform.GetTranslation() );
             transforms.m_normalTransform = transforms.m_worldTransform.GetInverse().Transpose();
-            renderContext.WriteToBuffer( m_vertexShaderSkeletal.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
+            transforms.m_positionDecodeScale = Float4( positionRange.m_scale, 0.0f );
+            transforms.m_positionDecodeOffset = Float4( positionRange.m_offset, 0.0f );
+            renderContext.WriteToBuffer( vertexShader.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
 
-            auto const& bonesConstBuffer = m_vertexShaderSkeletal.GetConstBuffer( 1 );
-            auto const& boneTransforms = pMeshComponent->GetSkinningTransforms();
-            EE_ASSERT( boneTransforms.size() == pCurrentMesh->GetNumBones() );
-            renderContext.WriteToBuffer( bonesConstBuffer, boneTransforms.data(), sizeof( Matrix ) * pCurrentMesh->GetNumBones() );
+            auto const& bonesConstBuffer = vertexShader.GetConstBuffer( 1 );
+            EE_ASSERT( instance.m_firstSkinningTransformIdx + pCurrentMesh->GetNumBones() <= packet.m_skinningTransforms.size() );
+            renderContext.WriteToBuffer( bonesConstBuffer, &packet.m_skinningTransforms[instance.m_firstSkinningTransformIdx], sizeof( Matrix ) * pCurrentMesh->GetNumBones() );
 
             if ( renderTarget.HasPickingRT() )
             {
-                PickingData const pd( pMeshComponent->GetEntityID().m_value, pMeshComponent->GetID().m_value );
+                PickingData const pd( instance.m_entityID, instance.m_componentID );
                 renderContext.WriteToBuffer( m_pixelShaderPicking.GetConstBuffer( 2 ), &pd, sizeof( PickingData ) );
             }
 
             // Draw sub-meshes
             //-------------------------------------------------------------------------
 
-            TVector<Material const*> const& materials = pMeshComponent->GetMaterials();
-            uint64_t const visibility = pMeshComponent->GetSectionVisibilityMask();
+            Material const* const* pMaterials = packet.GetMaterials( instance.m_firstMaterialIdx );
+            uint64_t const visibility = instance.m_sectionVisibilityMask;
 
             auto const numSubMeshes = pCurrentMesh->GetNumSections();
             for ( auto i = 0u; i < numSubMeshes; i++ )
             {
-                // Skip hidden sections
-                if ( ( visibility & ( 1ull << i ) ) == 0 )
+                // Skip hidden sections and sections that were simplified away
+                if ( ( visibility & ( 1ull << i ) ) == 0 || pCurrentMesh->GetLODSection( instance.m_LOD, i ).m_numIndices == 0 )
                 {
                     continue;
                 }
 
                 // Set material
-                if ( i < materials.size() && materials[i] )
+                Material const* pMaterial = ( (int32_t) i < instance.m_numMaterials ) ? pMaterials[i] : nullptr;
+                if ( !isMaterialSet || pMaterial != pCurrentMaterial )
                 {
-                    SetMaterial( renderContext, *pPipelineState->m_pPixelShader, materials[i] );
+                    if ( pMaterial != nullptr )
+                    {
+                        SetMaterial( renderContext, *pPipelineState->m_pPixelShader, pMaterial );
+                    }
+                    else // Use default material
+                    {
+                        SetDefaultMaterial( renderContext, *pPipelineState->m_pPixelShader );
+                    }
+
+                    pCurrentMaterial = pMaterial;
+                    isMaterialSet = true;
+                    m_drawStats.m_numMaterialBinds++;
                 }
-                else // Use default material
+                else
                 {
-                    SetDefaultMaterial( renderContext, *pPipelineState->m_pPixelShader );
+                    m_drawStats.m_numMaterialBindsSkipped++;
                 }
 
                 // Draw mesh
-                auto const& subMesh = pCurrentMesh->GetSection( i );
+                auto const& subMesh = pCurrentMesh->GetLODSection( instance.m_LOD, i );
                 renderContext.DrawIndexed( subMesh.m_numIndices, subMesh.m_startIndex );
+                m_drawStats.m_numSections++;
+                m_drawStats.m_numDraws++;
             }
         }
         renderContext.ClearShaderResource( PipelineStage::Pixel, 10 );
     }
 
-    void WorldRenderer::RenderSkybox( Viewport const& viewport, RenderData const& data )
+    void WorldRenderer::RenderSkybox( WorldRenderPacket const& packet )
     {
         EE_PROFILE_FUNCTION_RENDER();
 
         auto const& renderContext = m_pRenderDevice->GetImmediateContext();
-        if ( data.m_pSkyboxTexture )
+        if ( packet.m_pSkyboxTexture )
         {
-            Matrix const skyboxTransform = Matrix( Quaternion::Identity, viewport.GetViewPosition(), Vector::One ) * data.m_transforms.m_viewprojTransform;
+            Viewport const& viewport = packet.m_viewport;
+            Matrix const skyboxTransform = Matrix( Quaternion::Identity, viewport.GetViewPosition(), Vector::One ) * packet.m_viewProjectionMatrix;
 
             renderContext.SetViewport( Float2( viewport.GetDimensions() ), Float2( viewport.GetTopLeftPosition() ), Float2( 1, 1 )/*TODO: fix for inv z*/ );
             renderContext.SetPipelineState( m_pipelineSkybox );
             renderContext.SetShaderInputBinding( ShaderInputBindingHandle() );
             renderContext.SetPrimitiveTopology( Topology::TriangleStrip );
             renderContext.WriteToBuffer( m_vertexShaderSkybox.GetConstBuffer( 0 ), &skyboxTransform, sizeof( Matrix ) );
-            renderContext.WriteToBuffer( m_pixelShaderSkybox.GetConstBuffer( 0 ), &data.m_lightData, sizeof( data.m_lightData ) );
-            renderContext.SetShaderResource( PipelineStage::Pixel, 0, data.m_pSkyboxTexture->GetShaderResourceView() );
+            renderContext.WriteToBuffer( m_pixelShaderSkybox.GetConstBuffer( 0 ), &m_lightData, sizeof( m_lightData ) );
+            renderContext.SetShaderResource( PipelineStage::Pixel, 0, packet.m_pSkyboxTexture->GetShaderResourceView() );
             renderContext.Draw( 14, 0 );
         }
     }
 
-    void WorldRenderer::RenderSunShadows( Viewport const& viewport, DirectionalLightComponent* pDirectionalLightComponent, RenderData const& data )
+    void WorldRenderer::RenderSunShadows( WorldRenderPacket const& packet )
     {
         EE_PROFILE_FUNCTION_RENDER();
 
         auto const& renderContext = m_pRenderDevice->GetImmediateContext();
 
-        if ( !pDirectionalLightComponent || !pDirectionalLightComponent->GetShadowed() ) return;
+        if ( ( packet.m_lightData.m_lightingFlags & LIGHTING_ENABLE_SUN_SHADOW ) == 0 ) return;
 
         // Set primary render state and clear the render buffer
         //-------------------------------------------------------------------------
@@ -708,59 +1038,84 @@ namespace EE::Render
         renderContext.SetDepthTestMode( DepthTestMode::On );
 
         ObjectTransforms transforms;
-        transforms.m_viewprojTransform = data.m_lightData.m_sunShadowMapMatrix;
+        transforms.m_viewprojTransform = packet.m_lightData.m_sunShadowMapMatrix;
 
         // Static Meshes
         //-------------------------------------------------------------------------
+        // Materials are irrelevant for depth only rendering, so all instances of a mesh section get merged
 
-        renderContext.SetPipelineState( m_pipelineStateStaticShadow );
-        renderContext.SetShaderInputBinding( m_inputBindingStatic );
         renderContext.SetPrimitiveTopology( Topology::TriangleList );
+        renderContext.WriteToBuffer( m_vertexShaderStatic.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
+        renderContext.WriteToBuffer( m_vertexShaderStaticCompressed.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
 
-        for ( StaticMeshComponent const* pMeshComponent : data.m_staticMeshComponents )
-        {
-            auto pMesh = pMeshComponent->GetMesh();
-            Matrix worldTransform = pMeshComponent->GetWorldTransform().ToMatrix();
-            transforms.m_worldTransform = worldTransform;
-            renderContext.WriteToBuffer( m_vertexShaderStatic.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
+        m_shadowDrawList.Reset();
 
-            renderContext.SetVertexBuffer( pMesh->GetVertexBuffer() );
-            renderContext.SetIndexBuffer( pMesh->GetIndexBuffer() );
+        int32_t const numStaticMeshes = (int32_t) packet.m_staticMeshes.size();
+        for ( int32_t instanceIdx = 0; instanceIdx < numStaticMeshes; instanceIdx++ )
+        {
+            StaticMeshInstance const& instance = packet.m_staticMeshes[instanceIdx];
+            uint8_t const meshShaderID = instance.m_pMesh->HasCompressedVertices() ? ( SHADER_ID_DEPTH_ONLY | SHADER_ID_COMPRESSED_VERTICES ) : SHADER_ID_DEPTH_ONLY;
 
-            auto const numSubMeshes = pMesh->GetNumSections();
+            uint32_t const numSubMeshes = Math::Min( instance.m_pMesh->GetNumSections(), 64u );
             for ( auto i = 0u; i < numSubMeshes; i++ )
             {
-                auto const& subMesh = pMesh->GetSection( i );
-                renderContext.DrawIndexed( subMesh.m_numIndices, subMesh.m_startIndex );
+                if ( instance.m_pMesh->GetLODSection( instance.m_LOD, i ).m_numIndices > 0 )
+                {
+                    m_shadowDrawList.AddItem( DrawList::Pass::Shadow, meshShaderID, instance.m_pMesh, nullptr, i, instance.m_LOD, instanceIdx );
+                }
             }
         }
 
+        m_shadowDrawList.Sort();
+        SubmitStaticMeshDrawList( m_shadowDrawList, packet, m_pipelineStateStaticShadow, nullptr, false );
+
         // Skeletal Meshes
         //-------------------------------------------------------------------------
 
-        renderContext.SetPipelineState( m_pipelineStateSkeletalShadow );
-        renderContext.SetShaderInputBinding( m_inputBindingSkeletal );
         renderContext.SetPrimitiveTopology( Topology::TriangleList );
 
-        for ( SkeletalMeshComponent const* pMeshComponent : data.m_skeletalMeshComponents )
+        SkeletalMesh const* pCurrentMesh = nullptr;
+        VertexFormat currentVertexFormat = VertexFormat::Unknown;
+
+        for ( int32_t instanceIdx : m_skeletalMeshDrawOrder )
         {
-            auto pMesh = pMeshComponent->GetMesh();
+            SkeletalMeshInstance const& instance = packet.m_skeletalMeshes[instanceIdx];
+            auto pMesh = instance.m_pMesh;
+
+            if ( pMesh != pCurrentMesh )
+            {
+                if ( pMesh->GetVertexFormat() != currentVertexFormat )
+                {
+                    currentVertexFormat = pMesh->GetVertexFormat();
+                    SetMeshPipelineState( renderContext, m_pipelineStateSkeletalShadow, currentVertexFormat );
+                }
+
+                renderContext.SetVertexBuffer( pMesh->GetVertexBuffer() );
+                renderContext.SetIndexBuffer( pMesh->GetIndexBuffer() );
+                pCurrentMesh = pMesh;
+                m_drawStats.m_numMeshBinds++;
+            }
+            else
+            {
+                m_drawStats.m_numMeshBindsSkipped++;
+            }
 
             // Update Bones and Transforms
             //-------------------------------------------------------------------------
 
-            Matrix worldTransform = pMeshComponent->GetWorldTransform().ToMatrix();
+            VertexShader const& vertexShader = GetMeshVertexShader( currentVertexFormat );
+            VertexCompression::QuantizationRange const& positionRange = pMesh->GetVertexPositionRange();
+
+            Matrix worldTransform = instance.m_worldTransform.ToMatrix();
             transforms.m_worldTransform = worldTransform;
             transforms.m_worldTransform.SetTranslation( worldTransform.GetTranslation() );
-            renderContext.WriteToBuffer( m_vertexShaderSkeletal.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
-
-            auto const& bonesConstBuffer = m_vertexShaderSkeletal.GetConstBuffer( 1 );
-            auto const& boneTransforms = pMeshComponent->GetSkinningTransforms();
-            EE_ASSERT( boneTransforms.size() == pMesh->GetNumBones() );
-            renderContext.WriteToBuffer( bonesConstBuffer, boneTransforms.data(), sizeof( Matrix ) * pMesh->GetNumBones() );
+            transforms.m_positionDecodeScale = Float4( positionRange.m_scale, 0.0f );
+            transforms.m_positionDecodeOffset = Float4( positionRange.m_offset, 0.0f );
+            renderContext.WriteToBuffer( vertexShader.GetConstBuffer( 0 ), &transforms, sizeof( transforms ) );
 
-            renderContext.SetVertexBuffer( pMesh->GetVertexBuffer() );
-            renderContext.SetIndexBuffer( pMesh->GetIndexBuffer() );
+            auto const& bonesConstBuffer = vertexShader.GetConstBuffer( 1 );
+            EE_ASSERT( instance.m_firstSkinningTransformIdx + pMesh->GetNumBones() <= packet.m_skinningTransforms.size() );
+            renderContext.WriteToBuffer( bonesConstBuffer, &packet.m_skinningTransforms[instance.m_firstSkinningTransformIdx], sizeof( Matrix ) * pMesh->GetNumBones() );
 
             // Draw sub-meshes
             //-------------------------------------------------------------------------
@@ -768,14 +1123,61 @@ namespace EE::Render
             for ( auto i = 0u; i < numSubMeshes; i++ )
             {
                 // Draw mesh
-                auto const& subMesh = pMesh->GetSection( i );
+                auto const& subMesh = pMesh->GetLODSection( instance.m_LOD, i );
+                if ( subMesh.m_numIndices == 0 )
+                {
+                    continue;
+                }
+
                 renderContext.DrawIndexed( subMesh.m_numIndices, subMesh.m_startIndex );
+                m_drawStats.m_numSections++;
+                m_drawStats.m_numDraws++;
             }
         }
     }
 
     //-------------------------------------------------------------------------
 
+    VertexShader& WorldRenderer::GetMeshVertexShader( VertexFormat vertexFormat )
+    {
+        switch ( vertexFormat )
+        {
+            case VertexFormat::StaticMesh: return m_vertexShaderStatic;
+            case VertexFormat::SkeletalMesh: return m_vertexShaderSkeletal;
+            case VertexFormat::StaticMeshCompressed: return m_vertexShaderStaticCompressed;
+            case VertexFormat::SkeletalMeshCompressed: return m_vertexShaderSkeletalCompressed;
+
+            default:
+            EE_UNREACHABLE_CODE();
+            return m_vertexShaderStatic;
+        }
+    }
+
+    ShaderInputBindingHandle const& WorldRenderer::GetMeshInputBinding( VertexFormat vertexFormat ) const
+    {
+        switch ( vertexFormat )
+        {
+            case VertexFormat::StaticMesh: return m_inputBindingStatic;
+            case VertexFormat::SkeletalMesh: return m_inputBindingSkeletal;
+            case VertexFormat::StaticMeshCompressed: return m_inputBindingStaticCompressed;
+            case VertexFormat::SkeletalMeshCompressed: return m_inputBindingSkeletalCompressed;
+
+            default:
+            EE_UNREACHABLE_CODE();
+            return m_inputBindingStatic;
+        }
+    }
+
+    void WorldRenderer::SetMeshPipelineState( RenderContext const& renderContext, PipelineState const& pipelineState, VertexFormat vertexFormat )
+    {
+        PipelineState meshPipelineState = pipelineState;
+        meshPipelineState.m_pVertexShader = &GetMeshVertexShader( vertexFormat );
+        renderContext.SetPipelineState( meshPipelineState );
+        renderContext.SetShaderInputBinding( GetMeshInputBinding( vertexFormat ) );
+    }
+
+    //-------------------------------------------------------------------------
+
     void WorldRenderer::RenderWorld( Seconds const deltaTime, Viewport const& viewport, RenderTarget const& renderTarget, EntityWorld* pWorld )
     {
         EE_ASSERT( IsInitialized() && Threading::IsMainThread() );
@@ -786,80 +1188,95 @@ namespace EE::Render
             return;
         }
 
-        //-------------------------------------------------------------------------
+        m_immediateModePacket.Reset();
+        ExtractWorld( viewport, pWorld, m_immediateModePacket );
+        RenderPacket( m_immediateModePacket, renderTarget );
+    }
+
+    void WorldRenderer::ExtractWorld( Viewport const& viewport, EntityWorld* pWorld, WorldRenderPacket& packet ) const
+    {
+        EE_ASSERT( IsInitialized() && Threading::IsMainThread() );
+        EE_PROFILE_FUNCTION_RENDER();
 
         auto pWorldSystem = pWorld->GetWorldSystem<RendererWorldSystem>();
         EE_ASSERT( pWorldSystem != nullptr );
 
         //-------------------------------------------------------------------------
 
-        RenderData renderData
-        {
-            ObjectTransforms(),
-            LightData(),
-            nullptr,
-            nullptr,
-            pWorldSystem->m_visibleStaticMeshComponents,
-            pWorldSystem->m_visibleSkeletalMeshComponents,
-        };
+        packet.m_viewport = viewport;
+        packet.m_viewProjectionMatrix = viewport.GetViewVolume().GetViewProjectionMatrix();
 
-        renderData.m_transforms.m_viewprojTransform = viewport.GetViewVolume().GetViewProjectionMatrix();
+        if ( !viewport.IsValid() )
+        {
+            return;
+        }
 
+        // Lights
         //-------------------------------------------------------------------------
 
+        LightData& lightData = packet.m_lightData;
         uint32_t lightingFlags = 0;
 
-        DirectionalLightComponent* pDirectionalLightComponent = nullptr;
         if ( !pWorldSystem->m_registeredDirectionLightComponents.empty() )
         {
-            pDirectionalLightComponent = pWorldSystem->m_registeredDirectionLightComponents[0];
+            DirectionalLightComponent* pDirectionalLightComponent = pWorldSystem->m_registeredDirectionLightComponents[0];
             lightingFlags |= LIGHTING_ENABLE_SUN;
             lightingFlags |= pDirectionalLightComponent->GetShadowed() ? LIGHTING_ENABLE_SUN_SHADOW : 0;
-            renderData.m_lightData.m_SunDirIndirectIntensity = -pDirectionalLightComponent->GetLightDirection();
+            lightData.m_SunDirIndirectIntensity = -pDirectionalLightComponent->GetLightDirection();
             Float4 colorIntensity = pDirectionalLightComponent->GetLightColor();
-            renderData.m_lightData.m_SunColorRoughnessOneLevel = colorIntensity * pDirectionalLightComponent->GetLightIntensity();
+            lightData.m_SunColorRoughnessOneLevel = colorIntensity * pDirectionalLightComponent->GetLightIntensity();
             // TODO: conditional
-            renderData.m_lightData.m_sunShadowMapMatrix = ComputeShadowMatrix( viewport, pDirectionalLightComponent->GetWorldTransform(), 50.0f/*TODO: configure*/ );
+            lightData.m_sunShadowMapMatrix = ComputeShadowMatrix( viewport, pDirectionalLightComponent->GetWorldTransform(), 50.0f/*TODO: configure*/ );
         }
 
-        renderData.m_lightData.m_SunColorRoughnessOneLevel.SetW0();
+        lightData.m_SunColorRoughnessOneLevel.SetW0();
         if ( !pWorldSystem->m_registeredGlobalEnvironmentMaps.empty() )
         {
             GlobalEnvironmentMapComponent* pGlobalEnvironmentMapComponent = pWorldSystem->m_registeredGlobalEnvironmentMaps[0];
             if ( pGlobalEnvironmentMapComponent->HasSkyboxRadianceTexture() && pGlobalEnvironmentMapComponent->HasSkyboxTexture() )
             {
                 lightingFlags |= LIGHTING_ENABLE_SKYLIGHT;
-                renderData.m_pSkyboxRadianceTexture = pGlobalEnvironmentMapComponent->GetSkyboxRadianceTexture();
-                renderData.m_pSkyboxTexture = pGlobalEnvironmentMapComponent->GetSkyboxTexture();
-                renderData.m_lightData.m_SunColorRoughnessOneLevel.SetW( Math::Max( Math::Floor( Math::Log2f( (float) renderData.m_pSkyboxRadianceTexture->GetDimensions().m_x ) ) - 1.0f, 0.0f ) );
-                renderData.m_lightData.m_SunDirIndirectIntensity.SetW( pGlobalEnvironmentMapComponent->GetSkyboxIntensity() );
-                renderData.m_lightData.m_manualExposure = pGlobalEnvironmentMapComponent->GetExposure();
+                packet.m_pSkyboxRadianceTexture = pGlobalEnvironmentMapComponent->GetSkyboxRadianceTexture();
+                packet.m_pSkyboxTexture = pGlobalEnvironmentMapComponent->GetSkyboxTexture();
+                lightData.m_SunColorRoughnessOneLevel.SetW( Math::Max( Math::Floor( Math::Log2f( (float) packet.m_pSkyboxRadianceTexture->GetDimensions().m_x ) ) - 1.0f, 0.0f ) );
+                lightData.m_SunDirIndirectIntensity.SetW( pGlobalEnvironmentMapComponent->GetSkyboxIntensity() );
+                lightData.m_manualExposure = pGlobalEnvironmentMapComponent->GetExposure();
             }
         }
 
-        int32_t const numPointLights = Math::Min( pWorldSystem->m_registeredPointLightComponents.size(), (int32_t) s_maxPunctualLights );
-        uint32_t lightIndex = 0;
-        for ( int32_t i = 0; i < numPointLights; ++i )
+        // Gather all the punctual lights that can affect the view, these get binned into clusters when rendering
+        Math::ViewVolume const& viewVolume = viewport.GetViewVolume();
+        packet.m_punctualLights.reserve( pWorldSystem->m_registeredPointLightComponents.size() + pWorldSystem->m_registeredSpotLightComponents.size() );
+
+        for ( PointLightComponent* pPointLightComponent : pWorldSystem->m_registeredPointLightComponents )
         {
-            EE_ASSERT( lightIndex < s_maxPunctualLights );
-            PointLightComponent* pPointLightComponent = pWorldSystem->m_registeredPointLightComponents[i];
-            renderData.m_lightData.m_punctualLights[lightIndex].m_positionInvRadiusSqr = pPointLightComponent->GetLightPosition();
-            renderData.m_lightData.m_punctualLights[lightIndex].m_positionInvRadiusSqr.SetW( Math::Sqr( 1.0f / pPointLightComponent->GetLightRadius() ) );
-            renderData.m_lightData.m_punctualLights[lightIndex].m_dir = Vector::Zero;
-            renderData.m_lightData.m_punctualLights[lightIndex].m_color = Vector( pPointLightComponent->GetLightColor().ToFloat4() ) * pPointLightComponent->GetLightIntensity();
-            renderData.m_lightData.m_punctualLights[lightIndex].m_spotAngles = Vector( -1.0f, 1.0f, 0.0f );
-            ++lightIndex;
+            float const radius = pPointLightComponent->GetLightRadius();
+            if ( !viewVolume.Contains( AABB( pPointLightComponent->GetLightPosition(), radius ) ) )
+            {
+                continue;
+            }
+
+            PunctualLight& light = packet.m_punctualLights.emplace_back();
+            light.m_positionInvRadiusSqr = pPointLightComponent->GetLightPosition();
+            light.m_positionInvRadiusSqr.SetW( Math::Sqr( 1.0f / radius ) );
+            light.m_dir = Vector::Zero;
+            light.m_color = Vector( pPointLightComponent->GetLightColor().ToFloat4() ) * pPointLightComponent->GetLightIntensity();
+            light.m_spotAngles = Vector( -1.0f, 1.0f, 0.0f );
         }
 
-        int32_t const numSpotLights = Math::Min( pWorldSystem->m_registeredSpotLightComponents.size(), (int32_t) s_maxPunctualLights - numPointLights );
-        for ( int32_t i = 0; i < numSpotLights; ++i )
+        for ( SpotLightComponent* pSpotLightComponent : pWorldSystem->m_registeredSpotLightComponents )
         {
-            EE_ASSERT( lightIndex < s_maxPunctualLights );
-            SpotLightComponent* pSpotLightComponent = pWorldSystem->m_registeredSpotLightComponents[i];
-            renderData.m_lightData.m_punctualLights[lightIndex].m_positionInvRadiusSqr = pSpotLightComponent->GetLightPosition();
-            renderData.m_lightData.m_punctualLights[lightIndex].m_positionInvRadiusSqr.SetW( Math::Sqr( 1.0f / pSpotLightComponent->GetLightRadius() ) );
-            renderData.m_lightData.m_punctualLights[lightIndex].m_dir = -pSpotLightComponent->GetLightDirection();
-            renderData.m_lightData.m_punctualLights[lightIndex].m_color = Vector( pSpotLightComponent->GetLightColor().ToFloat4() ) * pSpotLightComponent->GetLightIntensity();
+            float const radius = pSpotLightComponent->GetLightRadius();
+            if ( !viewVolume.Contains( AABB( pSpotLightComponent->GetLightPosition(), radius ) ) )
+            {
+                continue;
+            }
+
+            PunctualLight& light = packet.m_punctualLights.emplace_back();
+            light.m_positionInvRadiusSqr = pSpotLightComponent->GetLightPosition();
+            light.m_positionInvRadiusSqr.SetW( Math::Sqr( 1.0f / radius ) );
+            light.m_dir = -pSpotLightComponent->GetLightDirection();
+            light.m_color = Vector( pSpotLightComponent->GetLightColor().ToFloat4() ) * pSpotLightComponent->GetLightIntensity();
             Radians innerAngle = pSpotLightComponent->GetLightInnerUmbraAngle().ToRadians();
             Radians outerAngle = pSpotLightComponent->GetLightOuterUmbraAngle().ToRadians();
             innerAngle.Clamp( 0, Math::PiDivTwo );
@@ -867,30 +1284,86 @@ namespace EE::Render
 
             float cosInner = Math::Cos( (float) innerAngle );
             float cosOuter = Math::Cos( (float) outerAngle );
-            renderData.m_lightData.m_punctualLights[lightIndex].m_spotAngles = Vector( cosOuter, 1.0f / Math::Max( cosInner - cosOuter, 0.001f ), 0.0f );
-            ++lightIndex;
+            light.m_spotAngles = Vector( cosOuter, 1.0f / Math::Max( cosInner - cosOuter, 0.001f ), 0.0f );
         }
 
-        renderData.m_lightData.m_numPunctualLights = lightIndex;
+        lightData.m_numPunctualLights = (uint32_t) packet.m_punctualLights.size();
+        lightData.m_lightingFlags = lightingFlags;
+
+        #if EE_DEVELOPMENT_TOOLS
+        lightData.m_lightingFlags = lightData.m_lightingFlags | ( (int32_t) pWorldSystem->GetVisualizationMode() << (int32_t) RendererWorldSystem::VisualizationMode::BitShift );
+        #endif
 
+        // Static Meshes
         //-------------------------------------------------------------------------
 
-        renderData.m_lightData.m_lightingFlags = lightingFlags;
+        packet.m_staticMeshes.reserve( pWorldSystem->m_visibleStaticMeshComponents.size() );
+        for ( StaticMeshComponent const* pMeshComponent : pWorldSystem->m_visibleStaticMeshComponents )
+        {
+            TVector<Material const*> const& materials = pMeshComponent->GetMaterials();
 
-        #if EE_DEVELOPMENT_TOOLS
-        renderData.m_lightData.m_lightingFlags = renderData.m_lightData.m_lightingFlags | ( (int32_t) pWorldSystem->GetVisualizationMode() << (int32_t) RendererWorldSystem::VisualizationMode::BitShift );
-        #endif
+            StaticMeshInstance& instance = packet.m_staticMeshes.emplace_back();
+            instance.m_pMesh = pMeshComponent->GetMesh();
+            instance.m_worldTransform = pMeshComponent->GetWorldTransform();
+            instance.m_localScale = pMeshComponent->GetLocalScale();
+            instance.m_sectionVisibilityMask = pMeshComponent->GetSectionVisibilityMask();
+            instance.m_entityID = pMeshComponent->GetEntityID().m_value;
+            instance.m_componentID = pMeshComponent->GetID().m_value;
+            instance.m_firstMaterialIdx = (int32_t) packet.m_materials.size();
+            instance.m_numMaterials = (int32_t) materials.size();
+            instance.m_LOD = pMeshComponent->GetLOD();
+            packet.m_materials.insert( packet.m_materials.end(), materials.begin(), materials.end() );
+        }
+
+        // Skeletal Meshes
+        //-------------------------------------------------------------------------
+
+        packet.m_skeletalMeshes.reserve( pWorldSystem->m_visibleSkeletalMeshComponents.size() );
+        for ( SkeletalMeshComponent const* pMeshComponent : pWorldSystem->m_visibleSkeletalMeshComponents )
+        {
+            TVector<Material const*> const& materials = pMeshComponent->GetMaterials();
+            TVector<Matrix> const& skinningTransforms = pMeshComponent->GetSkinningTransforms();
+            EE_ASSERT( skinningTransforms.size() == pMeshComponent->GetMesh()->GetNumBones() );
+
+            SkeletalMeshInstance& instance = packet.m_skeletalMeshes.emplace_back();
+            instance.m_pMesh = pMeshComponent->GetMesh();
+            instance.m_worldTransform = pMeshComponent->GetWorldTransform();
+            instance.m_sectionVisibilityMask = pMeshComponent->GetSectionVisibilityMask();
+            instance.m_entityID = pMeshComponent->GetEntityID().m_value;
+            instance.m_componentID = pMeshComponent->GetID().m_value;
+            instance.m_firstMaterialIdx = (int32_t) packet.m_materials.size();
+            instance.m_numMaterials = (int32_t) materials.size();
+            instance.m_firstSkinningTransformIdx = (int32_t) packet.m_skinningTransforms.size();
+            instance.m_LOD = pMeshComponent->GetLOD();
+            packet.m_materials.insert( packet.m_materials.end(), materials.begin(), materials.end() );
+            packet.m_skinningTransforms.insert( packet.m_skinningTransforms.end(), skinningTransforms.begin(), skinningTransforms.end() );
+        }
+    }
+
+    void WorldRenderer::RenderPacket( WorldRenderPacket const& packet, RenderTarget const& renderTarget )
+    {
+        EE_ASSERT( IsInitialized() );
+        EE_PROFILE_FUNCTION_RENDER();
+
+        if ( !packet.m_viewport.IsValid() )
+        {
+            return;
+        }
 
         //-------------------------------------------------------------------------
 
         auto const& immediateContext = m_pRenderDevice->GetImmediateContext();
 
-        RenderSunShadows( viewport, pDirectionalLightComponent, renderData );
+        m_drawStats.Reset();
+        PrepareLightClusters( packet );
+        PrepareInstanceData( packet );
+
+        RenderSunShadows( packet );
         {
             immediateContext.SetRenderTarget( renderTarget );
-            RenderStaticMeshes( viewport, renderTarget, renderData );
-            RenderSkeletalMeshes( viewport, renderTarget, renderData );
+            RenderStaticMeshes( packet, renderTarget );
+            RenderSkeletalMeshes( packet, renderTarget );
         }
-        RenderSkybox( viewport, renderData );
+        RenderSkybox( packet );
     }
-}
\ No newline at end of file
+}
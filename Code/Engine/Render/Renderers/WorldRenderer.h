@@ -1,11 +1,17 @@
 #pragma once
 
+#include "DrawList.h"
 #include "Engine/Render/IRenderer.h"
+#include "Engine/Render/RenderFramePacket.h"
 #include "Base/Render/RenderDevice.h"
 #include "Base/Math/Matrix.h"
 
 //-------------------------------------------------------------------------
 
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+
 namespace EE::Render
 {
     class DirectionalLightComponent;
@@ -22,6 +28,9 @@ namespace EE::Render
 
     class EE_ENGINE_API WorldRenderer : public IRenderer
     {
+    public:
+
+        // Flags stored in the packet light data
         enum
         {
             LIGHTING_ENABLE_SUN = ( 1 << 0 ),
@@ -29,6 +38,25 @@ namespace EE::Render
             LIGHTING_ENABLE_SKYLIGHT = ( 1 << 2 ),
         };
 
+        // Max number of instances that can be drawn in a single instanced draw, must match the static mesh vertex shader
+        constexpr static int32_t const s_maxInstancesPerDraw = 256;
+
+        // Initial capacity of the light cluster structured buffers, these grow as needed
+        constexpr static uint32_t const s_initialNumPunctualLights = 64;
+        constexpr static uint32_t const s_initialNumLightIndices = 4096;
+
+    private:
+
+        enum ShaderID : uint8_t
+        {
+            SHADER_ID_LIT = 0,
+            SHADER_ID_LIT_PICKING,
+            SHADER_ID_DEPTH_ONLY,
+
+            // Flag for meshes with compressed vertices, these use a different vertex shader so are sorted separately
+            SHADER_ID_COMPRESSED_VERTICES = ( 1 << 3 ),
+        };
+
         enum
         {
             MATERIAL_USE_ALBEDO_TEXTURE = ( 1 << 0 ),
@@ -38,27 +66,6 @@ namespace EE::Render
             MATERIAL_USE_AO_TEXTURE = ( 1 << 4 ),
         };
 
-        constexpr static int32_t const s_maxPunctualLights = 16;
-
-        struct PunctualLight
-        {
-            Vector m_positionInvRadiusSqr;
-            Vector m_dir;
-            Vector m_color;
-            Vector m_spotAngles;
-        };
-
-        struct LightData
-        {
-            Vector          m_SunDirIndirectIntensity = Vector::Zero;// TODO: refactor to Float3 and float
-            Vector          m_SunColorRoughnessOneLevel = Vector::Zero;// TODO: refactor to Float3 and float
-            Matrix          m_sunShadowMapMatrix = Matrix( ZeroInit );
-            float           m_manualExposure = -1.0f;
-            uint32_t          m_lightingFlags = 0;
-            uint32_t          m_numPunctualLights = 0;
-            PunctualLight   m_punctualLights[s_maxPunctualLights];
-        };
-
         struct alignas(16) PickingData
         {
             PickingData() = default;
@@ -89,16 +96,14 @@ namespace EE::Render
             Matrix  m_worldTransform = Matrix( ZeroInit );
             Matrix  m_normalTransform = Matrix( ZeroInit );
             Matrix  m_viewprojTransform = Matrix( ZeroInit );
+            Float4  m_positionDecodeScale = Float4::One;            // Only used for skeletal meshes with compressed vertices
+            Float4  m_positionDecodeOffset = Float4::Zero;
         };
 
-        struct RenderData //TODO: optimize - there should not be per frame updates
+        struct InstanceTransforms
         {
-            ObjectTransforms                        m_transforms;
-            LightData                               m_lightData;
-            CubemapTexture const*                   m_pSkyboxRadianceTexture;
-            CubemapTexture const*                   m_pSkyboxTexture;
-            TVector<StaticMeshComponent const*>&    m_staticMeshComponents;
-            TVector<SkeletalMeshComponent const*>&  m_skeletalMeshComponents;
+            Matrix  m_worldTransform = Matrix( ZeroInit );
+            Matrix  m_normalTransform = Matrix( ZeroInit );
         };
 
     public:
@@ -111,19 +116,46 @@ namespace EE::Render
     public:
 
         inline bool IsInitialized() const { return m_initialized; }
-        bool Initialize( RenderDevice* pRenderDevice );
+        bool Initialize( RenderDevice* pRenderDevice, TaskSystem* pTaskSystem = nullptr );
         void Shutdown();
 
+        // Extract and immediately render a world, this will read directly from the world and so needs to be run on the main thread
         virtual void RenderWorld( Seconds const deltaTime, Viewport const& viewport, RenderTarget const& renderTarget, EntityWorld* pWorld ) override final;
 
+        // Immediate mode rendering reads from the world, the rendering system uses the extract/render packet path instead so this doesnt block pipelining
+        virtual bool RequiresWorldAccess( EntityWorld const* pWorld ) const override final { return true; }
+
+        // Snapshot all the visible meshes, skinning palettes and lights for a world into the supplied packet
+        void ExtractWorld( Viewport const& viewport, EntityWorld* pWorld, WorldRenderPacket& packet ) const;
+
+        // Render a previously extracted world packet, this doesnt touch any world state so can be run on any thread that owns the device
+        void RenderPacket( WorldRenderPacket const& packet, RenderTarget const& renderTarget );
+
+        // Draw/bind counters for the last rendered packet
+        inline DrawStats const& GetDrawStats() const { return m_drawStats; }
+
+        // Light binning info for the last rendered packet
+        inline LightClusterGrid::Stats const& GetLightClusterStats() const { return m_lightClusterGrid.GetStats(); }
+
     private:
 
-        void RenderSunShadows( Viewport const& viewport, DirectionalLightComponent* pDirectionalLightComponent, RenderData const& data );
-        void RenderStaticMeshes( Viewport const& viewport, RenderTarget const& renderTarget, RenderData const& data );
-        void RenderSkeletalMeshes( Viewport const& viewport, RenderTarget const& renderTarget, RenderData const& data );
-        void RenderSkybox( Viewport const& viewport, RenderData const& data );
+        void PrepareInstanceData( WorldRenderPacket const& packet );
+        void PrepareLightClusters( WorldRenderPacket const& packet );
+        void SubmitStaticMeshDrawList( DrawList const& drawList, WorldRenderPacket const& packet, PipelineState const& pipelineState, PixelShader* pPixelShader, bool isPickingEnabled );
+
+        // Get the vertex shader and input binding for a mesh vertex format
+        VertexShader& GetMeshVertexShader( VertexFormat vertexFormat );
+        ShaderInputBindingHandle const& GetMeshInputBinding( VertexFormat vertexFormat ) const;
 
-        void SetupRenderStates( Viewport const& viewport, PixelShader* pShader, RenderData const& data );
+        // Set a mesh pipeline state, the vertex shader is replaced with the one matching the mesh vertex format
+        void SetMeshPipelineState( RenderContext const& renderContext, PipelineState const& pipelineState, VertexFormat vertexFormat );
+
+        void RenderSunShadows( WorldRenderPacket const& packet );
+        void RenderStaticMeshes( WorldRenderPacket const& packet, RenderTarget const& renderTarget );
+        void RenderSkeletalMeshes( WorldRenderPacket const& packet, RenderTarget const& renderTarget );
+        void RenderSkybox( WorldRenderPacket const& packet );
+
+        void SetupRenderStates( PixelShader* pShader, WorldRenderPacket const& packet );
 
     private:
 
@@ -133,8 +165,11 @@ namespace EE::Render
         VertexShader                                            m_vertexShaderSkybox;
         PixelShader                                             m_pixelShaderSkybox;
         RenderDevice*                                           m_pRenderDevice = nullptr;
+        TaskSystem*                                             m_pTaskSystem = nullptr;
         VertexShader                                            m_vertexShaderStatic;
         VertexShader                                            m_vertexShaderSkeletal;
+        VertexShader                                            m_vertexShaderStaticCompressed;
+        VertexShader                                            m_vertexShaderSkeletalCompressed;
         PixelShader                                             m_pixelShader;
         PixelShader                                             m_emptyPixelShader;
         BlendState                                              m_blendState;
@@ -144,6 +179,8 @@ namespace EE::Render
         SamplerState                                            m_shadowSampler;
         ShaderInputBindingHandle                                m_inputBindingStatic;
         ShaderInputBindingHandle                                m_inputBindingSkeletal;
+        ShaderInputBindingHandle                                m_inputBindingStaticCompressed;
+        ShaderInputBindingHandle                                m_inputBindingSkeletalCompressed;
         PipelineState                                           m_pipelineStateStatic;
         PipelineState                                           m_pipelineStateSkeletal;
         PipelineState                                           m_pipelineStateStaticShadow;
@@ -157,5 +194,22 @@ namespace EE::Render
         PixelShader                                             m_pixelShaderPicking;
         PipelineState                                           m_pipelineStateStaticPicking;
         PipelineState                                           m_pipelineStateSkeletalPicking;
+
+        WorldRenderPacket                                       m_immediateModePacket;
+
+        // Draw submission
+        DrawList                                                m_opaqueDrawList;
+        DrawList                                                m_shadowDrawList;
+        TVector<InstanceTransforms>                             m_staticInstanceTransforms;     // Per static mesh instance in the packet
+        TVector<InstanceTransforms>                             m_batchInstanceTransforms;      // Scratch buffer for a single instanced draw
+        TVector<int32_t>                                        m_skeletalMeshDrawOrder;        // Skeletal mesh instance indices sorted by mesh
+        DrawStats                                               m_drawStats;
+
+        // Clustered lighting
+        LightClusterGrid                                        m_lightClusterGrid;
+        LightData                                               m_lightData;                    // The packet light data with the cluster info for the current view
+        RenderBuffer                                            m_punctualLightsBuffer;
+        RenderBuffer                                            m_lightClustersBuffer;
+        RenderBuffer                                            m_lightIndicesBuffer;
     };
 }
\ No newline at end of file
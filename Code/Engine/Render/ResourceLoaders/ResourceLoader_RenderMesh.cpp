@@ -33,6 +33,16 @@ namespace EE::Render
             SkeletalMesh* pSkeletalMesh = EE::New<SkeletalMesh>();
             archive << *pSkeletalMesh;
             pMeshResource = pSkeletalMesh;
+
+            // Create runtime lookups
+            int32_t const numBones = pSkeletalMesh->GetNumBones();
+            pSkeletalMesh->m_boneIndexLookupMap.reserve( numBones );
+            pSkeletalMesh->m_inverseBindPoseMatrices.resize( numBones );
+            for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            {
+                pSkeletalMesh->m_boneIndexLookupMap.insert( TPair<StringID, int32_t>( pSkeletalMesh->m_boneIDs[boneIdx], boneIdx ) );
+                pSkeletalMesh->m_inverseBindPoseMatrices[boneIdx] = pSkeletalMesh->m_inverseBindPose[boneIdx].ToMatrix();
+            }
         }
 
         EE_ASSERT( !pMeshResource->m_vertices.empty() );
@@ -3,6 +3,8 @@ cbuffer Transforms : register( b0 )
     matrix m_worldTransform; // TODO: move to per instance data and apply camera centric world transform in veretx shader(campos=(0, 0, 0)), currently done on CPU
     matrix m_normalTransform;
     matrix m_viewprojTransform;
+    float4 m_positionDecodeScale;  // Compressed vertex position dequantization: position * scale + offset
+    float4 m_positionDecodeOffset;
 };
 
 // TODO sync with ENGINE, via header file!!!!
@@ -26,15 +28,19 @@ static const uint VISUALIZATION_MODE_AO = 5;
 
 static const uint VISUALIZATION_MODE_BITS_SHIFT = 32 - 3;
 
-static const uint MAX_PUNCTUAL_LIGHTS = 16;
-
+// Must match the C++ PunctualLight struct, structured buffers are tightly packed so everything is stored as float4
 struct PunctualLight
 {
-    float3 m_position;
-    float  m_invRadiusSqr;
-    float3 m_dir;
-    float3 m_color;
-    float2 m_spotAngles;
+    float4 m_positionInvRadiusSqr;
+    float4 m_dir;
+    float4 m_color;
+    float4 m_spotAngles;
+};
+
+struct LightCluster
+{
+    uint m_firstLightIdx;
+    uint m_numLights;
 };
 
 cbuffer Lights : register( b0 )
@@ -47,9 +53,30 @@ cbuffer Lights : register( b0 )
     float         m_manualExposure;
     uint          m_lightingFlags;
     uint          m_numPunctualLights;
-    PunctualLight m_punctualLights[MAX_PUNCTUAL_LIGHTS];
+    uint          m_padding;
+    float4        m_clusterViewPosition;
+    float4        m_clusterViewForward;
+    float4        m_clusterScreenParams;  // XY: viewport top left, ZW: number of tiles per pixel
+    float4        m_clusterDepthParams;   // X: depth slice scale, Y: depth slice bias
+    uint4         m_clusterDimensions;    // XYZ: number of tiles in X, Y and number of depth slices
 };
 
+StructuredBuffer<PunctualLight> m_punctualLights : register( t13 );
+StructuredBuffer<LightCluster>  m_lightClusters : register( t14 );
+StructuredBuffer<uint>          m_lightIndices : register( t15 );
+
+// Find the light cluster for a pixel from its screen position and world position
+LightCluster GetLightCluster( float2 screenPos, float3 worldPos )
+{
+    uint2 tile = (uint2) max( floor( ( screenPos - m_clusterScreenParams.xy ) * m_clusterScreenParams.zw ), 0.0 );
+    tile = min( tile, m_clusterDimensions.xy - 1 );
+
+    const float depth = max( dot( worldPos - m_clusterViewPosition.xyz, m_clusterViewForward.xyz ), 1e-4 );
+    const uint slice = (uint) clamp( floor( log( depth ) * m_clusterDepthParams.x + m_clusterDepthParams.y ), 0.0, (float) ( m_clusterDimensions.z - 1 ) );
+
+    return m_lightClusters[( slice * m_clusterDimensions.y + tile.y ) * m_clusterDimensions.x + tile.x];
+}
+
 sampler bilinearSampler : register( s0 );
 sampler bilinearClampedSampler : register( s1 );
 
@@ -63,6 +90,15 @@ struct PixelShaderInput
     float2 m_uv : TEXCOORD;
 };
 
+// Must match the CPU decoding in RenderVertexCompression.cpp
+float3 DecodeOctahedralNormal( float2 encodedNormal )
+{
+    float3 normal = float3( encodedNormal.xy, 1.0 - abs( encodedNormal.x ) - abs( encodedNormal.y ) );
+    float t = saturate( -normal.z );
+    normal.xy += ( normal.xy >= 0.0 ) ? -t : t;
+    return normalize( normal );
+}
+
 PixelShaderInput GeneratePixelShaderInput(float3 objectPos, float3 objectNormal, float2 uv)
 {
     PixelShaderInput output;
@@ -299,18 +299,21 @@ PS_OUTPUT main(PixelShaderInput psInput)
 	//		Lo += _albedo * (_ao  * Get(fAOIntensity) + (1.0f - Get(fAOIntensity))) * Get(fAmbientLightIntensity);
 	//}
 
-	for (uint i = 0; i < m_numPunctualLights; ++i)
+	// Only shade the lights that were binned into this pixel's cluster
+	const LightCluster cluster = GetLightCluster(psInput.m_pos.xy, P);
+	for (uint i = 0; i < cluster.m_numLights; ++i)
 	{
-		const float3 lD = m_punctualLights[i].m_position - P;
-		const float  invR2 = m_punctualLights[i].m_invRadiusSqr;
+		const PunctualLight light = m_punctualLights[m_lightIndices[cluster.m_firstLightIdx + i]];
+		const float3 lD = light.m_positionInvRadiusSqr.xyz - P;
+		const float  invR2 = light.m_positionInvRadiusSqr.w;
 		const float3 L = normalize(lD);
-		const float  attenuation = getDistanceAtt(lD, invR2) * getAngleAtt(L, m_punctualLights[i].m_dir, m_punctualLights[i].m_spotAngles);
+		const float  attenuation = getDistanceAtt(lD, invR2) * getAngleAtt(L, light.m_dir.xyz, light.m_spotAngles.xy);
 		const float3 H = normalize(V + L);
 		const float  NoL = max(dot(N, L), 0.0);
 		const float  NoH = max(dot(N, H), 0.0);
 		const float  VoH = max(dot(V, H), 0.0);
 
-		Lo += BRDF(NoL, NoV, NoH, VoH, surfaceParams) * m_punctualLights[i].m_color * (attenuation * NoL);
+		Lo += BRDF(NoL, NoV, NoH, VoH, surfaceParams) * light.m_color.rgb * (attenuation * NoL);
 	}
 
 	if (m_lightingFlags&LIGHTING_ENABLE_SUN)
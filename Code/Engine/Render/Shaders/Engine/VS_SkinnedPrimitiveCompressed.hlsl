@@ -0,0 +1,38 @@
+#include "Common_Lit.hlsli"
+
+cbuffer Skeleton : register( b1 )
+{
+    matrix m_boneTransforms[255];
+};
+
+// Must match VertexFormat::SkeletalMeshCompressed
+struct VertexShaderInput
+{
+    float4 m_pos : POSITION;                // Normalized position within the mesh quantization range
+    float2 m_normal : NORMAL;               // Octahedral encoded
+    float2 m_uv0 : TEXCOORD0;
+    float2 m_uv1 : TEXCOORD1;
+    uint4  m_boneIndices : BLENDINDICES0;   // 255 is an invalid bone index
+    float4 m_boneWeights : BLENDWEIGHTS0;
+};
+
+PixelShaderInput main( VertexShaderInput vsInput )
+{
+    float3 pos = vsInput.m_pos.xyz * m_positionDecodeScale.xyz + m_positionDecodeOffset.xyz;
+    float3 normal = DecodeOctahedralNormal( vsInput.m_normal );
+
+    float3 blendPos = float3(0, 0, 0);
+    float3 blendNormal = float3(0, 0, 0);
+
+    for ( int i = 0; i < 4; ++i )
+    {
+        if ( vsInput.m_boneIndices[i] != 255 )
+        {
+            matrix boneTransform = m_boneTransforms[vsInput.m_boneIndices[i]];
+            blendPos += mul( boneTransform, float4( pos, 1.0 ) ).xyz * vsInput.m_boneWeights[i];
+            blendNormal += mul( boneTransform, float4( normal, 0.0 ) ).xyz * vsInput.m_boneWeights[i]; // Assumes orthonormal bone transforms, same as the uncompressed shader
+        }
+    }
+
+    return GeneratePixelShaderInput( blendPos, blendNormal, vsInput.m_uv0 );
+}
@@ -1,5 +1,19 @@
 #include "Common_Lit.hlsli"
 
+// Must match WorldRenderer::s_maxInstancesPerDraw
+static const uint MAX_INSTANCES_PER_DRAW = 256;
+
+struct InstanceTransforms
+{
+    matrix m_worldTransform;
+    matrix m_normalTransform;
+};
+
+cbuffer Instances : register( b1 )
+{
+    InstanceTransforms m_instances[MAX_INSTANCES_PER_DRAW];
+};
+
 struct VertexShaderInput
 {
     float3 m_pos : POSITION;
@@ -7,8 +21,15 @@ struct VertexShaderInput
     float2 m_uv0 : TEXCOORD0;
     float2 m_uv1 : TEXCOORD1;
 };
- 
-PixelShaderInput main( VertexShaderInput vsInput )
+
+PixelShaderInput main( VertexShaderInput vsInput, uint instanceID : SV_InstanceID )
 {
-    return GeneratePixelShaderInput(vsInput.m_pos, vsInput.m_normal, vsInput.m_uv0);
-}
\ No newline at end of file
+    InstanceTransforms instance = m_instances[instanceID];
+
+    PixelShaderInput output;
+    output.m_wpos = mul( instance.m_worldTransform, float4( vsInput.m_pos, 1.0 ) ).xyz;
+    output.m_normal = mul( instance.m_normalTransform, float4( vsInput.m_normal, 0.0 ) ).xyz;
+    output.m_pos = mul( m_viewprojTransform, float4( output.m_wpos, 1.0 ) );
+    output.m_uv = vsInput.m_uv0;
+    return output;
+}
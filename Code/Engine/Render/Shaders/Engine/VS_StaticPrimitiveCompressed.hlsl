@@ -0,0 +1,37 @@
+#include "Common_Lit.hlsli"
+
+// Must match WorldRenderer::s_maxInstancesPerDraw
+static const uint MAX_INSTANCES_PER_DRAW = 256;
+
+struct InstanceTransforms
+{
+    matrix m_worldTransform;    // Includes the position dequantization for the mesh
+    matrix m_normalTransform;
+};
+
+cbuffer Instances : register( b1 )
+{
+    InstanceTransforms m_instances[MAX_INSTANCES_PER_DRAW];
+};
+
+// Must match VertexFormat::StaticMeshCompressed
+struct VertexShaderInput
+{
+    float4 m_pos : POSITION;    // Normalized position within the mesh quantization range
+    float2 m_normal : NORMAL;   // Octahedral encoded
+    float2 m_uv0 : TEXCOORD0;
+    float2 m_uv1 : TEXCOORD1;
+};
+
+PixelShaderInput main( VertexShaderInput vsInput, uint instanceID : SV_InstanceID )
+{
+    InstanceTransforms instance = m_instances[instanceID];
+    float3 normal = DecodeOctahedralNormal( vsInput.m_normal );
+
+    PixelShaderInput output;
+    output.m_wpos = mul( instance.m_worldTransform, float4( vsInput.m_pos.xyz, 1.0 ) ).xyz;
+    output.m_normal = mul( instance.m_normalTransform, float4( normal, 0.0 ) ).xyz;
+    output.m_pos = mul( m_viewprojTransform, float4( output.m_wpos, 1.0 ) );
+    output.m_uv = vsInput.m_uv0;
+    return output;
+}
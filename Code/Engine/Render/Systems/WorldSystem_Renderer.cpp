@@ -40,6 +40,16 @@ namespace EE::Render
         EE_ASSERT( m_registeredGlobalEnvironmentMaps.empty() );
     }
 
+    bool RendererWorldSystem::GetComponentInterests( WorldSystemComponentInterests& outInterests ) const
+    {
+        outInterests.Includes<StaticMeshComponent>();
+        outInterests.Includes<SkeletalMeshComponent>();
+        outInterests.Includes<LightComponent>();
+        outInterests.Includes<LocalEnvironmentMapComponent>();
+        outInterests.Includes<GlobalEnvironmentMapComponent>();
+        return true;
+    }
+
     void RendererWorldSystem::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
     {
         // Meshes
@@ -237,6 +247,13 @@ namespace EE::Render
 
     //-------------------------------------------------------------------------
 
+    bool RendererWorldSystem::GetUpdateDependencies( UpdateStage stage, WorldSystemUpdateDependencies& outDependencies ) const
+    {
+        // The update writes the selected mesh LODs and the skinning transforms of the visible skeletal meshes, the mobility lists are guarded by their own lock
+        outDependencies.Writes<StaticMeshComponent>().Writes<SkeletalMeshComponent>();
+        return true;
+    }
+
     void RendererWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         EE_PROFILE_FUNCTION_RENDER();
@@ -335,6 +352,48 @@ namespace EE::Render
             }
         }
 
+        //-------------------------------------------------------------------------
+        // Skinning
+        //-------------------------------------------------------------------------
+
+        // Generate the skinning transforms for all visible skeletal meshes in a single batch, hidden meshes are only updated once they become visible
+        SkeletalMeshComponent::UpdateSkinningTransforms( m_visibleSkeletalMeshComponents );
+
+        //-------------------------------------------------------------------------
+        // LOD Selection
+        //-------------------------------------------------------------------------
+
+        {
+            EE_PROFILE_SCOPE_RENDER( "Mesh LOD Selection" );
+
+            Viewport const& viewport = *ctx.GetViewport();
+
+            auto SelectLOD = [this, &viewport] ( MeshComponent* pMeshComponent, Mesh const* pMesh, float worldScale )
+            {
+                #if EE_DEVELOPMENT_TOOLS
+                if ( m_forcedMeshLOD >= 0 )
+                {
+                    pMeshComponent->m_LOD = Math::Min( m_forcedMeshLOD, pMesh->GetNumLODs() - 1 );
+                    return;
+                }
+                #endif
+
+                pMeshComponent->m_LOD = MeshLODSelection::SelectLOD( *pMesh, pMeshComponent->GetWorldBounds(), worldScale, viewport, pMeshComponent->m_LOD, m_LODSelectionSettings );
+            };
+
+            for ( auto pMeshComponent : m_visibleStaticMeshComponents )
+            {
+                Float3 const& localScale = pMeshComponent->GetLocalScale();
+                float const worldScale = pMeshComponent->GetWorldTransform().GetScale() * Math::Max( Math::Abs( localScale.m_x ), Math::Max( Math::Abs( localScale.m_y ), Math::Abs( localScale.m_z ) ) );
+                SelectLOD( pMeshComponent, pMeshComponent->GetMesh(), worldScale );
+            }
+
+            for ( auto pMeshComponent : m_visibleSkeletalMeshComponents )
+            {
+                SelectLOD( pMeshComponent, pMeshComponent->GetMesh(), pMeshComponent->GetWorldTransform().GetScale() );
+            }
+        }
+
         //-------------------------------------------------------------------------
         // Debug
         //-------------------------------------------------------------------------
@@ -4,6 +4,7 @@
 #include "Engine/Entity/EntityWorldSystem.h"
 #include "Engine/Render/Components/Component_StaticMesh.h"
 #include "Engine/Render/Mesh/SkeletalMesh.h"
+#include "Engine/Render/Mesh/MeshLODSelection.h"
 #include "Base/Render/RenderDevice.h"
 #include "Base/Math/AABBTree.h"
 #include "Base/Types/Event.h"
@@ -79,7 +80,9 @@ namespace EE::Render
         virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override final;
         virtual void ShutdownSystem() override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override final;
+        virtual bool GetUpdateDependencies( UpdateStage stage, WorldSystemUpdateDependencies& outDependencies ) const override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual bool GetComponentInterests( WorldSystemComponentInterests& outInterests ) const override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
 
         // Static Meshes
@@ -102,7 +105,7 @@ namespace EE::Render
         TIDVector<ComponentID, StaticMeshComponent*>                    m_registeredStaticMeshComponents;
         TIDVector<ComponentID, StaticMeshComponent*>                    m_staticStaticMeshComponents;
         TIDVector<ComponentID, StaticMeshComponent*>                    m_dynamicStaticMeshComponents;
-        TVector<StaticMeshComponent const*>                             m_visibleStaticMeshComponents;
+        TVector<StaticMeshComponent*>                                   m_visibleStaticMeshComponents;
         EventBindingID                                                  m_staticMeshMobilityChangedEventBinding;
         EventBindingID                                                  m_staticMeshStaticTransformUpdatedEventBinding;
         Threading::Mutex                                                m_mobilityUpdateListLock;               // Mobility switches can occur on any thread so the list needs to be threadsafe. We use a simple lock for now since we dont expect too many switches
@@ -113,7 +116,7 @@ namespace EE::Render
         // Skeletal meshes
         TIDVector<ComponentID, SkeletalMeshComponent*>                  m_registeredSkeletalMeshComponents;
         TIDVector<uint32_t, SkeletalMeshGroup>                          m_skeletalMeshGroups;
-        TVector<SkeletalMeshComponent const*>                           m_visibleSkeletalMeshComponents;
+        TVector<SkeletalMeshComponent*>                                 m_visibleSkeletalMeshComponents;
 
         // Lights
         TIDVector<ComponentID, DirectionalLightComponent*>              m_registeredDirectionLightComponents;
@@ -122,8 +125,12 @@ namespace EE::Render
         TIDVector<ComponentID, LocalEnvironmentMapComponent*>           m_registeredLocalEnvironmentMaps;
         TIDVector<ComponentID, GlobalEnvironmentMapComponent*>          m_registeredGlobalEnvironmentMaps;
 
+        // LODs
+        MeshLODSelection::Settings                                      m_LODSelectionSettings;
+
         #if EE_DEVELOPMENT_TOOLS
         VisualizationMode                                               m_visualizationMode = VisualizationMode::Lighting;
+        int32_t                                                         m_forcedMeshLOD = -1;                   // Forces all meshes to use this LOD (clamped to the available LODs), disabled if negative
         bool                                                            m_showStaticMeshBounds = false;
         bool                                                            m_showSkeletalMeshBounds = false;
         bool                                                            m_showSkeletalMeshBones = false;
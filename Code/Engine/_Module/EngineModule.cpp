@@ -160,7 +160,7 @@ namespace EE
         // Initialize and register renderers
         //-------------------------------------------------------------------------
 
-        if ( m_worldRenderer.Initialize( m_pRenderDevice ) )
+        if ( m_worldRenderer.Initialize( m_pRenderDevice, &m_taskSystem ) )
         {
             m_rendererRegistry.RegisterRenderer( &m_worldRenderer );
         }
@@ -193,7 +193,7 @@ namespace EE::Animation
             return Error( "Invalid skeleton FBX data path: %s", skeletonResourceDescriptor.m_skeletonPath.GetString().c_str() );
         }
 
-        RawAssets::ReaderContext readerCtx = { [this]( char const* pString ) { Warning( pString ); }, [this] ( char const* pString ) { Error( pString ); } };
+        RawAssets::ReaderContext readerCtx = { [this]( char const* pString ) { Warning( pString ); }, [this] ( char const* pString ) { Error( pString ); }, ctx.m_rawAssetCacheDirectoryPath, ctx.m_pTaskSystem };
         auto pRawSkeleton = RawAssets::ReadSkeleton( readerCtx, skeletonFilePath, skeletonResourceDescriptor.m_skeletonRootBoneName, skeletonResourceDescriptor.m_highLODBones );
         if ( pRawSkeleton == nullptr || !pRawSkeleton->IsValid() )
         {
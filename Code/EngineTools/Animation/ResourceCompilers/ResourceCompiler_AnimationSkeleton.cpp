@@ -33,7 +33,7 @@ namespace EE::Animation
             return Error( "Invalid skeleton data path: %s", resourceDescriptor.m_skeletonPath.c_str() );
         }
 
-        RawAssets::ReaderContext readerCtx = { [this]( char const* pString ) { Warning( pString ); }, [this] ( char const* pString ) { Error( pString ); } };
+        RawAssets::ReaderContext readerCtx = { [this]( char const* pString ) { Warning( pString ); }, [this] ( char const* pString ) { Error( pString ); }, ctx.m_rawAssetCacheDirectoryPath, ctx.m_pTaskSystem };
         TUniquePtr<RawAssets::RawSkeleton> pRawSkeleton = RawAssets::ReadSkeleton( readerCtx, skeletonFilePath, resourceDescriptor.m_skeletonRootBoneName, resourceDescriptor.m_highLODBones );
         if ( pRawSkeleton == nullptr )
         {
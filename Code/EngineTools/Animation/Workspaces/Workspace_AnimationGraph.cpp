@@ -925,18 +925,47 @@ namespace EE::Animation
         EE_ASSERT( m_pWorkspace != nullptr );
     }
 
+    static void SerializeVariations( TypeSystem::TypeRegistry const& typeRegistry, ToolsGraphDefinition const& graphDefinition, String& outString )
+    {
+        Serialization::JsonArchiveWriter archive;
+        graphDefinition.GetVariationHierarchy().Serialize( typeRegistry, *archive.GetWriter() );
+        outString.assign( archive.GetStringBuffer().GetString(), archive.GetStringBuffer().GetSize() );
+    }
+
     void GraphUndoableAction::Undo()
     {
-        Serialization::JsonArchiveReader archive;
-        archive.ReadFromString( m_valueBefore.c_str() );
-        m_pWorkspace->GetEditedGraphData()->m_graphDefinition.LoadFromJson( *m_pWorkspace->m_pToolsContext->m_pTypeRegistry, archive.GetDocument() );
+        ApplyDelta( true );
     }
 
     void GraphUndoableAction::Redo()
     {
-        Serialization::JsonArchiveReader archive;
-        archive.ReadFromString( m_valueAfter.c_str() );
-        m_pWorkspace->GetEditedGraphData()->m_graphDefinition.LoadFromJson( *m_pWorkspace->m_pToolsContext->m_pTypeRegistry, archive.GetDocument() );
+        ApplyDelta( false );
+    }
+
+    void GraphUndoableAction::ApplyDelta( bool revert )
+    {
+        auto const& typeRegistry = *m_pWorkspace->m_pToolsContext->m_pTypeRegistry;
+        auto& graphDefinition = m_pWorkspace->GetEditedGraphData()->m_graphDefinition;
+
+        Milliseconds applyTime = 0;
+        {
+            ScopedTimer<PlatformClock> timer( applyTime );
+
+            String const& variations = revert ? m_variationsBefore : m_variationsAfter;
+            if ( !variations.empty() )
+            {
+                Serialization::JsonArchiveReader archive;
+                archive.ReadFromString( variations.c_str() );
+                graphDefinition.GetVariationHierarchy().Serialize( typeRegistry, archive.GetDocument() );
+                m_pWorkspace->m_undoVariationsSnapshot = variations;
+            }
+
+            // Only the changed nodes and graphs are recreated, this also moves the workspace snapshot to the restored state
+            m_pWorkspace->m_undoGraphSnapshot.ApplyDelta( typeRegistry, graphDefinition.GetRootGraph(), m_graphDelta, revert );
+            graphDefinition.RefreshParameterReferences();
+        }
+
+        m_pWorkspace->m_undoStats.m_lastApplyTime = applyTime;
     }
 
     void GraphUndoableAction::SerializeBeforeState()
@@ -946,18 +975,48 @@ namespace EE::Animation
             m_pWorkspace->StopDebugging();
         }
 
-        Serialization::JsonArchiveWriter archive;
-        m_pWorkspace->GetEditedGraphData()->m_graphDefinition.SaveToJson( *m_pWorkspace->m_pToolsContext->m_pTypeRegistry, *archive.GetWriter() );
-        m_valueBefore.resize( archive.GetStringBuffer().GetSize() );
-        memcpy( m_valueBefore.data(), archive.GetStringBuffer().GetString(), archive.GetStringBuffer().GetSize() );
+        // The workspace keeps the serialized current state, so we only need to serialize the graph if this is the first modification
+        if ( !m_pWorkspace->m_undoGraphSnapshot.IsValid() )
+        {
+            auto const& typeRegistry = *m_pWorkspace->m_pToolsContext->m_pTypeRegistry;
+            auto const& graphDefinition = m_pWorkspace->GetEditedGraphData()->m_graphDefinition;
+            m_pWorkspace->m_undoGraphSnapshot.Capture( typeRegistry, graphDefinition.GetRootGraph() );
+            SerializeVariations( typeRegistry, graphDefinition, m_pWorkspace->m_undoVariationsSnapshot );
+        }
     }
 
     void GraphUndoableAction::SerializeAfterState()
     {
-        Serialization::JsonArchiveWriter archive;
-        m_pWorkspace->GetEditedGraphData()->m_graphDefinition.SaveToJson( *m_pWorkspace->m_pToolsContext->m_pTypeRegistry, *archive.GetWriter() );
-        m_valueAfter.resize( archive.GetStringBuffer().GetSize() );
-        memcpy( m_valueAfter.data(), archive.GetStringBuffer().GetString(), archive.GetStringBuffer().GetSize() );
+        auto const& typeRegistry = *m_pWorkspace->m_pToolsContext->m_pTypeRegistry;
+        auto const& graphDefinition = m_pWorkspace->GetEditedGraphData()->m_graphDefinition;
+        EE_ASSERT( m_pWorkspace->m_undoGraphSnapshot.IsValid() );
+
+        Milliseconds recordTime = 0;
+        {
+            ScopedTimer<PlatformClock> timer( recordTime );
+
+            // Only store the records that changed since the last modification
+            VisualGraph::GraphSnapshot newSnapshot;
+            newSnapshot.Capture( typeRegistry, graphDefinition.GetRootGraph() );
+            m_pWorkspace->m_undoGraphSnapshot.CalculateDelta( newSnapshot, m_graphDelta );
+            m_pWorkspace->m_undoGraphSnapshot = eastl::move( newSnapshot );
+
+            String variations;
+            SerializeVariations( typeRegistry, graphDefinition, variations );
+            if ( variations != m_pWorkspace->m_undoVariationsSnapshot )
+            {
+                m_variationsBefore = eastl::move( m_pWorkspace->m_undoVariationsSnapshot );
+                m_variationsAfter = variations;
+                m_pWorkspace->m_undoVariationsSnapshot = eastl::move( variations );
+            }
+        }
+
+        // A full snapshot action stores the entire graph twice (before and after)
+        auto& undoStats = m_pWorkspace->m_undoStats;
+        undoStats.m_numActions++;
+        undoStats.m_deltaMemoryUsage += GetMemoryUsage();
+        undoStats.m_fullSnapshotMemoryUsage += 2 * ( m_pWorkspace->m_undoGraphSnapshot.GetMemoryUsage() + m_pWorkspace->m_undoVariationsSnapshot.capacity() );
+        undoStats.m_lastRecordTime = recordTime;
     }
 
     //-------------------------------------------------------------------------
@@ -1176,6 +1235,8 @@ namespace EE::Animation
         EE_ASSERT( !m_previewGraphVariationPtr.IsSet() );
 
         ClearGraphStack();
+        m_undoGraphSnapshot.Clear();
+        m_undoVariationsSnapshot.clear();
 
         //-------------------------------------------------------------------------
 
@@ -1438,6 +1499,19 @@ namespace EE::Animation
                 CopyAllGraphIDsToClipboard();
             }
 
+            ImGui::Separator();
+
+            if ( ImGui::BeginMenu( EE_ICON_UNDO" Undo Stats" ) )
+            {
+                ImGui::Text( "Recorded Actions: %d", m_undoStats.m_numActions );
+                ImGui::Text( "Delta Memory: %.2f KB", m_undoStats.m_deltaMemoryUsage / 1024.0f );
+                ImGui::Text( "Full Snapshot Memory: %.2f KB", m_undoStats.m_fullSnapshotMemoryUsage / 1024.0f );
+                ImGui::Text( "Current Snapshot: %d records, %.2f KB", m_undoGraphSnapshot.GetNumRecords(), m_undoGraphSnapshot.GetMemoryUsage() / 1024.0f );
+                ImGui::Text( "Last Record Time: %.3fms", m_undoStats.m_lastRecordTime.ToFloat() );
+                ImGui::Text( "Last Undo/Redo Time: %.3fms", m_undoStats.m_lastApplyTime.ToFloat() );
+                ImGui::EndMenu();
+            }
+
             ImGui::EndMenu();
         }
 
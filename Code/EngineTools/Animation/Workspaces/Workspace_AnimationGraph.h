@@ -6,6 +6,7 @@
 #include "EngineTools/Core/Workspace.h"
 #include "EngineTools/Core/Widgets/TreeListView.h"
 #include "EngineTools/Core/VisualGraph/VisualGraph_View.h"
+#include "EngineTools/Core/VisualGraph/VisualGraph_Snapshot.h"
 #include "EngineTools/Core/CategoryTree.h"
 #include "Engine/Animation/Graph/Animation_RuntimeGraph_Definition.h"
 #include "Engine/Animation/TaskSystem/Animation_TaskSystem.h"
@@ -83,6 +84,16 @@ namespace EE::Animation
             bool                                    m_isSecondaryViewSelection = false;
         };
 
+        // The cost of the recorded graph undo actions
+        struct UndoStats
+        {
+            int32_t                                 m_numActions = 0;
+            size_t                                  m_deltaMemoryUsage = 0;             // The memory used by all recorded deltas
+            size_t                                  m_fullSnapshotMemoryUsage = 0;      // The memory the same actions would need if they stored full before/after snapshots
+            Milliseconds                            m_lastRecordTime = 0;
+            Milliseconds                            m_lastApplyTime = 0;
+        };
+
         //-------------------------------------------------------------------------
 
         class IDComboWidget : public ImGuiX::ComboWithFilterWidget<StringID>
@@ -511,6 +522,9 @@ namespace EE::Animation
         // Undo/Redo
         TVector<UUID>                                                       m_viewedGraphPathPreUndoRedo;
         RecordedSelectionForUndoRedo                                        m_selectedNodesPreUndoRedo;
+        VisualGraph::GraphSnapshot                                          m_undoGraphSnapshot;            // The current edited graph state, undo actions only store their delta from this
+        String                                                              m_undoVariationsSnapshot;
+        UndoStats                                                           m_undoStats;
 
         // User Context
         ToolsGraphUserContext                                               m_userContext;
@@ -622,10 +636,18 @@ namespace EE::Animation
         void SerializeBeforeState();
         void SerializeAfterState();
 
+        // Get the memory needed to store this action
+        size_t GetMemoryUsage() const { return sizeof( GraphUndoableAction ) + m_graphDelta.GetMemoryUsage() + m_variationsBefore.capacity() + m_variationsAfter.capacity(); }
+
+    private:
+
+        void ApplyDelta( bool revert );
+
     private:
 
         AnimationGraphWorkspace*                                        m_pWorkspace = nullptr;
-        String                                                          m_valueBefore;
-        String                                                          m_valueAfter;
+        VisualGraph::GraphDelta                                         m_graphDelta;
+        String                                                          m_variationsBefore;     // Only set if the variations were modified
+        String                                                          m_variationsAfter;
     };
 }
\ No newline at end of file
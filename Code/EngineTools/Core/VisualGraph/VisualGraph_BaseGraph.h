@@ -35,6 +35,7 @@ namespace EE::VisualGraph
     {
         friend BaseGraph;
         friend class GraphView;
+        friend class GraphSnapshot;
 
         // Serialization Keys
         //-------------------------------------------------------------------------
@@ -362,6 +363,7 @@ namespace EE::VisualGraph
     {
         friend class GraphView;
         friend class ScopedNodeModification;
+        friend class GraphSnapshot;
 
         constexpr static char const* const s_nodesKey = "Nodes";
 
@@ -0,0 +1,528 @@
+#include "VisualGraph_Snapshot.h"
+#include "VisualGraph_BaseGraph.h"
+#include "Base/Serialization/TypeSerialization.h"
+#include "Base/Encoding/Hash.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::VisualGraph
+{
+    static void ReadViewOffset( Serialization::JsonValue const& graphObjectValue, Float2& viewOffset )
+    {
+        auto viewOffsetIter = graphObjectValue.FindMember( "ViewOffsetX" );
+        if ( viewOffsetIter != graphObjectValue.MemberEnd() )
+        {
+            viewOffset.m_x = (float) viewOffsetIter->value.GetDouble();
+        }
+
+        viewOffsetIter = graphObjectValue.FindMember( "ViewOffsetY" );
+        if ( viewOffsetIter != graphObjectValue.MemberEnd() )
+        {
+            viewOffset.m_y = (float) viewOffsetIter->value.GetDouble();
+        }
+    }
+
+    static void FinalizeRecord( Serialization::JsonStringBuffer const& buffer, GraphSnapshotRecord& record )
+    {
+        record.m_data.assign( buffer.GetString(), buffer.GetSize() );
+        record.m_hash = Hash::XXHash::GetHash64( record.m_data );
+    }
+
+    //-------------------------------------------------------------------------
+
+    size_t GraphDelta::GetMemoryUsage() const
+    {
+        size_t memoryUsage = sizeof( GraphDelta ) + ( m_changes.capacity() * sizeof( RecordChange ) );
+        for ( auto const& change : m_changes )
+        {
+            memoryUsage += change.m_before.m_data.capacity() + change.m_after.m_data.capacity();
+        }
+
+        return memoryUsage;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void GraphSnapshot::Clear()
+    {
+        for ( auto& records : m_records )
+        {
+            records.clear();
+        }
+
+        m_isValid = false;
+    }
+
+    size_t GraphSnapshot::GetMemoryUsage() const
+    {
+        size_t memoryUsage = sizeof( GraphSnapshot );
+        for ( auto const& records : m_records )
+        {
+            for ( auto const& recordPair : records )
+            {
+                memoryUsage += sizeof( UUID ) + recordPair.second.GetMemoryUsage();
+            }
+        }
+
+        return memoryUsage;
+    }
+
+    int32_t GraphSnapshot::GetNumRecords() const
+    {
+        int32_t numRecords = 0;
+        for ( auto const& records : m_records )
+        {
+            numRecords += (int32_t) records.size();
+        }
+
+        return numRecords;
+    }
+
+    GraphSnapshotRecord const* GraphSnapshot::FindRecord( GraphSnapshotRecordType type, UUID const& ID ) const
+    {
+        auto const& records = m_records[(int32_t) type];
+        auto iter = records.find( ID );
+        return ( iter != records.end() ) ? &iter->second : nullptr;
+    }
+
+    //-------------------------------------------------------------------------
+    // Capture
+    //-------------------------------------------------------------------------
+
+    void GraphSnapshot::Capture( TypeSystem::TypeRegistry const& typeRegistry, BaseGraph const* pRootGraph )
+    {
+        EE_ASSERT( pRootGraph != nullptr && !pRootGraph->HasParentNode() );
+
+        Clear();
+
+        Serialization::JsonStringBuffer buffer;
+        Serialization::JsonWriter writer( buffer );
+        CaptureGraph( typeRegistry, writer, buffer, pRootGraph, GraphSnapshotRecordType::ChildGraph, UUID() );
+
+        m_isValid = true;
+    }
+
+    void GraphSnapshot::CaptureGraph( TypeSystem::TypeRegistry const& typeRegistry, Serialization::JsonWriter& writer, Serialization::JsonStringBuffer& buffer, BaseGraph const* pGraph, GraphSnapshotRecordType type, UUID const& ownerID )
+    {
+        EE_ASSERT( pGraph != nullptr && type != GraphSnapshotRecordType::Node );
+
+        buffer.Clear();
+        writer.Reset( buffer );
+
+        writer.StartObject();
+
+        writer.Key( BaseNode::s_typeDataKey );
+        Serialization::WriteNativeType( typeRegistry, pGraph, writer );
+
+        writer.Key( "ViewOffsetX" );
+        writer.Double( pGraph->m_viewOffset.m_x );
+        writer.Key( "ViewOffsetY" );
+        writer.Double( pGraph->m_viewOffset.m_y );
+
+        // Only the node IDs are stored, the nodes have their own records
+        writer.Key( BaseGraph::s_nodesKey );
+        writer.StartArray();
+        for ( auto pNode : pGraph->m_nodes )
+        {
+            writer.String( pNode->GetID().ToString().c_str() );
+        }
+        writer.EndArray();
+
+        pGraph->SerializeCustom( typeRegistry, writer );
+
+        writer.EndObject();
+
+        FinalizeRecord( buffer, m_records[(int32_t) type][ownerID] );
+
+        //-------------------------------------------------------------------------
+
+        for ( auto pNode : pGraph->m_nodes )
+        {
+            CaptureNode( typeRegistry, writer, buffer, pNode );
+        }
+    }
+
+    void GraphSnapshot::CaptureNode( TypeSystem::TypeRegistry const& typeRegistry, Serialization::JsonWriter& writer, Serialization::JsonStringBuffer& buffer, BaseNode const* pNode )
+    {
+        EE_ASSERT( pNode != nullptr && pNode->GetID().IsValid() );
+
+        buffer.Clear();
+        writer.Reset( buffer );
+
+        writer.StartObject();
+
+        writer.Key( BaseNode::s_typeDataKey );
+        Serialization::WriteNativeType( typeRegistry, pNode, writer );
+
+        pNode->SerializeCustom( typeRegistry, writer );
+
+        writer.EndObject();
+
+        FinalizeRecord( buffer, m_records[(int32_t) GraphSnapshotRecordType::Node][pNode->GetID()] );
+
+        //-------------------------------------------------------------------------
+
+        if ( pNode->HasChildGraph() )
+        {
+            CaptureGraph( typeRegistry, writer, buffer, pNode->GetChildGraph(), GraphSnapshotRecordType::ChildGraph, pNode->GetID() );
+        }
+
+        if ( pNode->HasSecondaryGraph() )
+        {
+            CaptureGraph( typeRegistry, writer, buffer, pNode->GetSecondaryGraph(), GraphSnapshotRecordType::SecondaryGraph, pNode->GetID() );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Delta
+    //-------------------------------------------------------------------------
+
+    void GraphSnapshot::CalculateDelta( GraphSnapshot const& newSnapshot, GraphDelta& outDelta ) const
+    {
+        EE_ASSERT( m_isValid && newSnapshot.m_isValid );
+
+        outDelta.m_changes.clear();
+
+        for ( int32_t i = 0; i < (int32_t) GraphSnapshotRecordType::NumTypes; i++ )
+        {
+            RecordMap const& oldRecords = m_records[i];
+            RecordMap const& newRecords = newSnapshot.m_records[i];
+
+            // Added or modified records
+            for ( auto const& newRecordPair : newRecords )
+            {
+                auto oldIter = oldRecords.find( newRecordPair.first );
+                if ( oldIter != oldRecords.end() && oldIter->second.m_hash == newRecordPair.second.m_hash )
+                {
+                    continue;
+                }
+
+                GraphDelta::RecordChange& change = outDelta.m_changes.emplace_back();
+                change.m_ID = newRecordPair.first;
+                change.m_type = (GraphSnapshotRecordType) i;
+                change.m_after = newRecordPair.second;
+
+                if ( oldIter != oldRecords.end() )
+                {
+                    change.m_before = oldIter->second;
+                }
+            }
+
+            // Removed records
+            for ( auto const& oldRecordPair : oldRecords )
+            {
+                if ( newRecords.find( oldRecordPair.first ) == newRecords.end() )
+                {
+                    GraphDelta::RecordChange& change = outDelta.m_changes.emplace_back();
+                    change.m_ID = oldRecordPair.first;
+                    change.m_type = (GraphSnapshotRecordType) i;
+                    change.m_before = oldRecordPair.second;
+                }
+            }
+        }
+    }
+
+    void GraphSnapshot::ApplyDelta( TypeSystem::TypeRegistry const& typeRegistry, BaseGraph* pRootGraph, GraphDelta const& delta, bool revert )
+    {
+        EE_ASSERT( m_isValid );
+        EE_ASSERT( pRootGraph != nullptr && !pRootGraph->HasParentNode() );
+
+        // Move the records to the target state, all nodes and graphs are (re)created from these
+        //-------------------------------------------------------------------------
+
+        for ( auto const& change : delta.m_changes )
+        {
+            GraphSnapshotRecord const& targetRecord = revert ? change.m_before : change.m_after;
+            RecordMap& records = m_records[(int32_t) change.m_type];
+
+            if ( targetRecord.IsValid() )
+            {
+                records[change.m_ID] = targetRecord;
+            }
+            else
+            {
+                records.erase( change.m_ID );
+            }
+        }
+
+        // Graphs - Update graph data and add/remove nodes
+        //-------------------------------------------------------------------------
+        // Any nodes created here are built directly from the target records, so we need to skip any further changes to them
+
+        TVector<UUID> createdNodeIDs;
+
+        for ( auto const& change : delta.m_changes )
+        {
+            if ( change.m_type == GraphSnapshotRecordType::Node )
+            {
+                continue;
+            }
+
+            GraphSnapshotRecord const& targetRecord = revert ? change.m_before : change.m_after;
+
+            // Root graph
+            if ( !change.m_ID.IsValid() )
+            {
+                EE_ASSERT( change.m_type == GraphSnapshotRecordType::ChildGraph && targetRecord.IsValid() );
+
+                Serialization::JsonArchiveReader reader;
+                reader.ReadFromString( targetRecord.m_data.c_str() );
+                Serialization::ReadNativeType( typeRegistry, reader.GetDocument()[BaseNode::s_typeDataKey], pRootGraph );
+                UpdateGraph( typeRegistry, pRootGraph, reader.GetDocument(), createdNodeIDs );
+                continue;
+            }
+
+            // If the owner node doesnt exist it is either being created (from the target records) or destroyed, so there is nothing to do
+            if ( VectorContains( createdNodeIDs, change.m_ID ) )
+            {
+                continue;
+            }
+
+            BaseNode* pOwnerNode = pRootGraph->FindNode( change.m_ID, true );
+            if ( pOwnerNode == nullptr )
+            {
+                continue;
+            }
+
+            BaseGraph*& pGraph = ( change.m_type == GraphSnapshotRecordType::ChildGraph ) ? pOwnerNode->m_pChildGraph : pOwnerNode->m_pSecondaryGraph;
+            if ( targetRecord.IsValid() )
+            {
+                if ( pGraph == nullptr )
+                {
+                    pGraph = CreateGraph( typeRegistry, change.m_type, change.m_ID, pOwnerNode, createdNodeIDs );
+                }
+                else
+                {
+                    Serialization::JsonArchiveReader reader;
+                    reader.ReadFromString( targetRecord.m_data.c_str() );
+                    Serialization::ReadNativeType( typeRegistry, reader.GetDocument()[BaseNode::s_typeDataKey], pGraph );
+                    UpdateGraph( typeRegistry, pGraph, reader.GetDocument(), createdNodeIDs );
+                }
+            }
+            else if ( pGraph != nullptr )
+            {
+                pGraph->Shutdown();
+                EE::Delete( pGraph );
+            }
+        }
+
+        // Nodes - Recreate all modified nodes
+        //-------------------------------------------------------------------------
+        // Graphs store direct pointers to their nodes (e.g. connections) so we need to refresh the custom data of any graph whose nodes were replaced
+
+        TInlineVector<BaseGraph*, 16> graphsToRefresh;
+
+        for ( auto const& change : delta.m_changes )
+        {
+            if ( change.m_type != GraphSnapshotRecordType::Node )
+            {
+                continue;
+            }
+
+            // Added and removed nodes were handled by their parent graph's node list
+            if ( !change.m_before.IsValid() || !change.m_after.IsValid() )
+            {
+                continue;
+            }
+
+            if ( VectorContains( createdNodeIDs, change.m_ID ) )
+            {
+                continue;
+            }
+
+            BaseNode* pNode = pRootGraph->FindNode( change.m_ID, true );
+            if ( pNode == nullptr )
+            {
+                continue;
+            }
+
+            BaseNode* pNewNode = ReplaceNode( typeRegistry, pNode, revert ? change.m_before : change.m_after );
+            if ( !VectorContains( graphsToRefresh, pNewNode->m_pParentGraph ) )
+            {
+                graphsToRefresh.emplace_back( pNewNode->m_pParentGraph );
+            }
+        }
+
+        for ( BaseGraph* pGraph : graphsToRefresh )
+        {
+            GraphSnapshotRecord const* pRecord = nullptr;
+
+            BaseNode const* pOwnerNode = pGraph->m_pParentNode;
+            if ( pOwnerNode == nullptr )
+            {
+                pRecord = FindRecord( GraphSnapshotRecordType::ChildGraph, UUID() );
+            }
+            else
+            {
+                pRecord = FindRecord( ( pOwnerNode->m_pChildGraph == pGraph ) ? GraphSnapshotRecordType::ChildGraph : GraphSnapshotRecordType::SecondaryGraph, pOwnerNode->GetID() );
+            }
+
+            EE_ASSERT( pRecord != nullptr );
+            Serialization::JsonArchiveReader reader;
+            reader.ReadFromString( pRecord->m_data.c_str() );
+            pGraph->SerializeCustom( typeRegistry, reader.GetDocument() );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Graph Reconstruction
+    //-------------------------------------------------------------------------
+
+    BaseNode* GraphSnapshot::CreateNode( TypeSystem::TypeRegistry const& typeRegistry, UUID const& nodeID, BaseGraph* pParentGraph, TVector<UUID>& createdNodeIDs ) const
+    {
+        EE_ASSERT( pParentGraph != nullptr );
+
+        GraphSnapshotRecord const* pRecord = FindRecord( GraphSnapshotRecordType::Node, nodeID );
+        if ( pRecord == nullptr )
+        {
+            EE_LOG_ERROR( "Tools", "Visual Graph", "Missing undo record for node: %s", nodeID.ToString().c_str() );
+            return nullptr;
+        }
+
+        Serialization::JsonArchiveReader reader;
+        reader.ReadFromString( pRecord->m_data.c_str() );
+        auto const& nodeObjectValue = reader.GetDocument();
+
+        BaseNode* pNode = Serialization::TryCreateAndReadNativeType<BaseNode>( typeRegistry, nodeObjectValue[BaseNode::s_typeDataKey] );
+        if ( pNode == nullptr )
+        {
+            return nullptr;
+        }
+
+        pNode->m_pParentGraph = pParentGraph;
+        createdNodeIDs.emplace_back( nodeID );
+
+        if ( FindRecord( GraphSnapshotRecordType::ChildGraph, nodeID ) != nullptr )
+        {
+            pNode->m_pChildGraph = CreateGraph( typeRegistry, GraphSnapshotRecordType::ChildGraph, nodeID, pNode, createdNodeIDs );
+        }
+
+        if ( FindRecord( GraphSnapshotRecordType::SecondaryGraph, nodeID ) != nullptr )
+        {
+            pNode->m_pSecondaryGraph = CreateGraph( typeRegistry, GraphSnapshotRecordType::SecondaryGraph, nodeID, pNode, createdNodeIDs );
+        }
+
+        pNode->SerializeCustom( typeRegistry, nodeObjectValue );
+        return pNode;
+    }
+
+    BaseGraph* GraphSnapshot::CreateGraph( TypeSystem::TypeRegistry const& typeRegistry, GraphSnapshotRecordType type, UUID const& ownerID, BaseNode* pParentNode, TVector<UUID>& createdNodeIDs ) const
+    {
+        EE_ASSERT( pParentNode != nullptr );
+
+        GraphSnapshotRecord const* pRecord = FindRecord( type, ownerID );
+        EE_ASSERT( pRecord != nullptr );
+
+        Serialization::JsonArchiveReader reader;
+        reader.ReadFromString( pRecord->m_data.c_str() );
+        auto const& graphObjectValue = reader.GetDocument();
+
+        // Unlike regular graph loading, we keep the serialized graph ID since this graph is being restored
+        BaseGraph* pGraph = Serialization::TryCreateAndReadNativeType<BaseGraph>( typeRegistry, graphObjectValue[BaseNode::s_typeDataKey] );
+        EE_ASSERT( pGraph != nullptr );
+        pGraph->m_pParentNode = pParentNode;
+
+        UpdateGraph( typeRegistry, pGraph, graphObjectValue, createdNodeIDs );
+        return pGraph;
+    }
+
+    void GraphSnapshot::UpdateGraph( TypeSystem::TypeRegistry const& typeRegistry, BaseGraph* pGraph, Serialization::JsonValue const& graphObjectValue, TVector<UUID>& createdNodeIDs ) const
+    {
+        EE_ASSERT( pGraph != nullptr && graphObjectValue.IsObject() );
+
+        ReadViewOffset( graphObjectValue, pGraph->m_viewOffset );
+
+        // Reconcile nodes
+        //-------------------------------------------------------------------------
+
+        TVector<BaseNode*> previousNodes;
+        previousNodes.swap( pGraph->m_nodes );
+
+        for ( auto const& nodeIDValue : graphObjectValue[BaseGraph::s_nodesKey].GetArray() )
+        {
+            UUID const nodeID( nodeIDValue.GetString() );
+
+            BaseNode* pNode = nullptr;
+            for ( auto& pPreviousNode : previousNodes )
+            {
+                if ( pPreviousNode != nullptr && pPreviousNode->GetID() == nodeID )
+                {
+                    pNode = pPreviousNode;
+                    pPreviousNode = nullptr;
+                    break;
+                }
+            }
+
+            if ( pNode == nullptr )
+            {
+                pNode = CreateNode( typeRegistry, nodeID, pGraph, createdNodeIDs );
+            }
+
+            if ( pNode != nullptr )
+            {
+                pGraph->m_nodes.emplace_back( pNode );
+            }
+        }
+
+        // Destroy all nodes that are no longer present
+        for ( auto pPreviousNode : previousNodes )
+        {
+            if ( pPreviousNode != nullptr )
+            {
+                pPreviousNode->Shutdown();
+                EE::Delete( pPreviousNode );
+            }
+        }
+
+        // Custom Data
+        //-------------------------------------------------------------------------
+
+        pGraph->SerializeCustom( typeRegistry, graphObjectValue );
+    }
+
+    BaseNode* GraphSnapshot::ReplaceNode( TypeSystem::TypeRegistry const& typeRegistry, BaseNode* pNode, GraphSnapshotRecord const& record ) const
+    {
+        EE_ASSERT( pNode != nullptr && pNode->m_pParentGraph != nullptr );
+
+        Serialization::JsonArchiveReader reader;
+        reader.ReadFromString( record.m_data.c_str() );
+        auto const& nodeObjectValue = reader.GetDocument();
+
+        BaseNode* pNewNode = Serialization::TryCreateAndReadNativeType<BaseNode>( typeRegistry, nodeObjectValue[BaseNode::s_typeDataKey] );
+        if ( pNewNode == nullptr )
+        {
+            EE_LOG_ERROR( "Tools", "Visual Graph", "Failed to restore node: %s", pNode->GetID().ToString().c_str() );
+            return pNode;
+        }
+
+        BaseGraph* pParentGraph = pNode->m_pParentGraph;
+        pNewNode->m_pParentGraph = pParentGraph;
+
+        // Transfer the child graphs, any changes to them are part of their own records
+        pNewNode->m_pChildGraph = pNode->m_pChildGraph;
+        pNode->m_pChildGraph = nullptr;
+        if ( pNewNode->m_pChildGraph != nullptr )
+        {
+            pNewNode->m_pChildGraph->m_pParentNode = pNewNode;
+        }
+
+        pNewNode->m_pSecondaryGraph = pNode->m_pSecondaryGraph;
+        pNode->m_pSecondaryGraph = nullptr;
+        if ( pNewNode->m_pSecondaryGraph != nullptr )
+        {
+            pNewNode->m_pSecondaryGraph->m_pParentNode = pNewNode;
+        }
+
+        pNewNode->SerializeCustom( typeRegistry, nodeObjectValue );
+
+        // Swap the nodes
+        int32_t const nodeIdx = VectorFindIndex( pParentGraph->m_nodes, pNode );
+        EE_ASSERT( nodeIdx != InvalidIndex );
+        pParentGraph->m_nodes[nodeIdx] = pNewNode;
+
+        pNode->Shutdown();
+        EE::Delete( pNode );
+
+        return pNewNode;
+    }
+}
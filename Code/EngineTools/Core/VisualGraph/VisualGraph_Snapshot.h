@@ -0,0 +1,121 @@
+#pragma once
+
+#include "EngineTools/_Module/API.h"
+#include "Base/Serialization/JsonSerialization.h"
+#include "Base/Types/UUID.h"
+#include "Base/Types/HashMap.h"
+#include "Base/Types/String.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Graph Snapshot
+//-------------------------------------------------------------------------
+// A flattened serialized copy of a graph hierarchy used to record undo/redo deltas
+//
+// Every node and every graph is stored as its own record (keyed by node ID, graphs are keyed by the ID of the node that owns them)
+// Node records only contain the node's own data and graph records only contain the graph's own data and the IDs of its nodes
+// This means that a modification only changes the records of the nodes and graphs that were actually touched
+//
+// Comparing two snapshots produces a delta containing only the changed records, which can then be applied in either direction to a live graph
+// Applying a delta only recreates the affected nodes, the rest of the graph (and all pointers to it) is left untouched
+
+namespace EE::TypeSystem { class TypeRegistry; }
+
+//-------------------------------------------------------------------------
+
+namespace EE::VisualGraph
+{
+    class BaseGraph;
+    class BaseNode;
+
+    //-------------------------------------------------------------------------
+
+    enum class GraphSnapshotRecordType : uint8_t
+    {
+        Node = 0,
+        ChildGraph,
+        SecondaryGraph,
+
+        NumTypes
+    };
+
+    struct GraphSnapshotRecord
+    {
+        inline bool IsValid() const { return !m_data.empty(); }
+        inline size_t GetMemoryUsage() const { return sizeof( GraphSnapshotRecord ) + m_data.capacity(); }
+
+    public:
+
+        String                                  m_data;         // The serialized record (graph records list their node IDs), empty if the record doesnt exist
+        uint64_t                                m_hash = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct GraphDelta
+    {
+        struct RecordChange
+        {
+            UUID                                m_ID;           // The node ID, for graphs this is the ID of the owning node (cleared for the root graph)
+            GraphSnapshotRecordType             m_type = GraphSnapshotRecordType::Node;
+            GraphSnapshotRecord                 m_before;       // Invalid if the record was added
+            GraphSnapshotRecord                 m_after;        // Invalid if the record was removed
+        };
+
+    public:
+
+        inline bool IsEmpty() const { return m_changes.empty(); }
+        size_t GetMemoryUsage() const;
+
+    public:
+
+        TVector<RecordChange>                   m_changes;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINETOOLS_API GraphSnapshot
+    {
+        using RecordMap = THashMap<UUID, GraphSnapshotRecord>;
+
+    public:
+
+        inline bool IsValid() const { return m_isValid; }
+        void Clear();
+
+        // Serialize the full graph hierarchy
+        void Capture( TypeSystem::TypeRegistry const& typeRegistry, BaseGraph const* pRootGraph );
+
+        // Get all the records that differ between this snapshot and a newer one
+        void CalculateDelta( GraphSnapshot const& newSnapshot, GraphDelta& outDelta ) const;
+
+        // Apply a delta to a live graph (and to this snapshot), this snapshot must match the live graph state
+        // Reverting a delta restores the before state, otherwise the after state is restored
+        void ApplyDelta( TypeSystem::TypeRegistry const& typeRegistry, BaseGraph* pRootGraph, GraphDelta const& delta, bool revert );
+
+        size_t GetMemoryUsage() const;
+        int32_t GetNumRecords() const;
+
+    private:
+
+        void CaptureGraph( TypeSystem::TypeRegistry const& typeRegistry, Serialization::JsonWriter& writer, Serialization::JsonStringBuffer& buffer, BaseGraph const* pGraph, GraphSnapshotRecordType type, UUID const& ownerID );
+        void CaptureNode( TypeSystem::TypeRegistry const& typeRegistry, Serialization::JsonWriter& writer, Serialization::JsonStringBuffer& buffer, BaseNode const* pNode );
+
+        // Create a node (and its child graphs) from the records, all created node IDs are added to the supplied list
+        BaseNode* CreateNode( TypeSystem::TypeRegistry const& typeRegistry, UUID const& nodeID, BaseGraph* pParentGraph, TVector<UUID>& createdNodeIDs ) const;
+        BaseGraph* CreateGraph( TypeSystem::TypeRegistry const& typeRegistry, GraphSnapshotRecordType type, UUID const& ownerID, BaseNode* pParentNode, TVector<UUID>& createdNodeIDs ) const;
+
+        // Update a live graph's data and reconcile its node list against a record, existing nodes are kept as is
+        void UpdateGraph( TypeSystem::TypeRegistry const& typeRegistry, BaseGraph* pGraph, Serialization::JsonValue const& graphObjectValue, TVector<UUID>& createdNodeIDs ) const;
+
+        // Recreate a single node from its record, the node's child graphs are transferred to the new node
+        BaseNode* ReplaceNode( TypeSystem::TypeRegistry const& typeRegistry, BaseNode* pNode, GraphSnapshotRecord const& record ) const;
+
+        GraphSnapshotRecord const* FindRecord( GraphSnapshotRecordType type, UUID const& ID ) const;
+
+    private:
+
+        RecordMap                               m_records[(int32_t) GraphSnapshotRecordType::NumTypes];
+        bool                                    m_isValid = false;
+    };
+}
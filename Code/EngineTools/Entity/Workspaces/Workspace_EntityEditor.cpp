@@ -88,6 +88,7 @@ namespace EE::EntityModel
             CreateEntities,
             DeleteEntities,
             ModifyEntities,
+            ModifyProperties,
             TransformUpdate,
         };
 
@@ -105,6 +106,8 @@ namespace EE::EntityModel
         void RecordDelete( TVector<Entity*> entitiesToDelete );
         void RecordBeginEdit( TVector<Entity*> entitiesToBeModified );
         void RecordEndEdit();
+        void RecordBeginPropertyEdit( EntityComponent* pComponentToBeModified );
+        void RecordEndPropertyEdit();
         void RecordBeginTransformEdit( TVector<Entity*> entitiesToBeModified, bool wereEntitiesDuplicated = false );
         void RecordEndTransformEdit();
 
@@ -113,6 +116,7 @@ namespace EE::EntityModel
     private:
 
         void RecordSelection();
+        void ApplyPropertyDeltas( bool applyValuesBefore );
 
         virtual void Undo() override;
         virtual void Redo() override;
@@ -136,6 +140,12 @@ namespace EE::EntityModel
         TVector<SerializedComponentTransform>               m_transformsPreModification;
         TVector<SerializedComponentTransform>               m_transformsPostModification;
         bool                                                m_entitiesWereDuplicated = false;
+
+        // Data: Modify Properties
+        EntityID                                            m_editedEntityID;
+        ComponentID                                         m_editedComponentID;
+        TypeSystem::TypeDescriptor                          m_componentDescPreModification; // Temporary storage that is only valid between a Begin and End call
+        TypeSystem::TypeDescriptorDelta                     m_propertyDelta;
     };
 
     //-------------------------------------------------------------------------
@@ -220,6 +230,64 @@ namespace EE::EntityModel
 
     //-------------------------------------------------------------------------
 
+    void EntityUndoableAction::RecordBeginPropertyEdit( EntityComponent* pComponentToBeModified )
+    {
+        EE_ASSERT( pComponentToBeModified != nullptr );
+        EE_ASSERT( m_actionType == Invalid );
+
+        m_actionType = Type::ModifyProperties;
+        m_editedEntityID = pComponentToBeModified->GetEntityID();
+        m_editedComponentID = pComponentToBeModified->GetID();
+        m_componentDescPreModification.DescribeTypeInstance( *m_pWorkspace->m_pToolsContext->m_pTypeRegistry, pComponentToBeModified, false );
+
+        RecordSelection();
+    }
+
+    void EntityUndoableAction::RecordEndPropertyEdit()
+    {
+        EE_ASSERT( m_actionType == ModifyProperties );
+        EE_ASSERT( m_componentDescPreModification.IsValid() );
+
+        auto pEntity = m_pWorkspace->m_pWorld->FindEntity( m_editedEntityID );
+        EE_ASSERT( pEntity != nullptr );
+        auto pComponent = pEntity->FindComponent( m_editedComponentID );
+        EE_ASSERT( pComponent != nullptr );
+
+        TypeSystem::TypeDescriptor const componentDescPostModification( *m_pWorkspace->m_pToolsContext->m_pTypeRegistry, pComponent, false );
+        m_propertyDelta = TypeSystem::TypeDescriptorDelta( m_componentDescPreModification, componentDescPostModification );
+        m_componentDescPreModification = TypeSystem::TypeDescriptor();
+    }
+
+    void EntityUndoableAction::ApplyPropertyDeltas( bool applyValuesBefore )
+    {
+        EE_ASSERT( m_actionType == ModifyProperties );
+
+        EntityWorld* pWorld = m_pWorkspace->m_pWorld;
+        auto pEntity = pWorld->FindEntity( m_editedEntityID );
+        EE_ASSERT( pEntity != nullptr );
+        auto pComponent = pEntity->FindComponent( m_editedComponentID );
+        EE_ASSERT( pComponent != nullptr );
+
+        TypeSystem::TypeRegistry const& typeRegistry = *m_pWorkspace->m_pToolsContext->m_pTypeRegistry;
+
+        // The component is unloaded for the duration of the edit, so its resource ptrs can be safely reset
+        pWorld->BeginComponentEdit( pComponent );
+
+        TypeSystem::TypeDescriptor componentDesc( typeRegistry, pComponent, false );
+        m_propertyDelta.Apply( componentDesc, applyValuesBefore );
+        componentDesc.ResetTypeInstance( typeRegistry, pComponent->GetTypeInfo(), pComponent, true );
+
+        // Reset the local transform to ensure that the world transform is recalculated
+        if ( auto pSpatialComponent = TryCast<SpatialEntityComponent>( pComponent ) )
+        {
+            pSpatialComponent->SetLocalTransform( pSpatialComponent->GetLocalTransform() );
+        }
+
+        pWorld->EndComponentEdit( pComponent );
+    }
+
+    //-------------------------------------------------------------------------
+
     void EntityUndoableAction::RecordBeginTransformEdit( TVector<Entity*> entitiesToBeModified, bool wereEntitiesDuplicated )
     {
         EE_ASSERT( entitiesToBeModified.size() > 0 );
@@ -422,6 +490,12 @@ namespace EE::EntityModel
             }
             break;
 
+            case EntityUndoableAction::ModifyProperties:
+            {
+                ApplyPropertyDeltas( true );
+            }
+            break;
+
             case EntityUndoableAction::TransformUpdate:
             {
                 int32_t const numEntities = (int32_t) m_entityDescPostModification.size();
@@ -582,6 +656,12 @@ namespace EE::EntityModel
             }
             break;
 
+            case EntityUndoableAction::ModifyProperties:
+            {
+                ApplyPropertyDeltas( false );
+            }
+            break;
+
             case EntityUndoableAction::TransformUpdate:
             {
                 int32_t const numEntities = (int32_t) m_entityDescPreModification.size();
@@ -2693,7 +2773,17 @@ namespace EE::EntityModel
         auto pMap = m_pWorld->GetMap( pEntity->GetMapID() );
         EE_ASSERT( pMap != nullptr );
         auto pUndoAction = EE::New<EntityUndoableAction>( this );
-        pUndoAction->RecordBeginEdit( { pEntity } );
+
+        // Component property edits only record the changed property values, entity property edits can affect the spatial hierarchy so record the whole entity
+        if ( auto pComponent = TryCast<EntityComponent>( eventInfo.m_pOwnerTypeInstance ) )
+        {
+            pUndoAction->RecordBeginPropertyEdit( pComponent );
+        }
+        else
+        {
+            pUndoAction->RecordBeginEdit( { pEntity } );
+        }
+
         m_pActiveUndoableAction = pUndoAction;
 
         //-------------------------------------------------------------------------
@@ -2720,7 +2810,14 @@ namespace EE::EntityModel
         //-------------------------------------------------------------------------
 
         auto pUndoAction = (EntityUndoableAction*) m_pActiveUndoableAction;
-        pUndoAction->RecordEndEdit();
+        if ( pUndoAction->GetActionType() == EntityUndoableAction::ModifyProperties )
+        {
+            pUndoAction->RecordEndPropertyEdit();
+        }
+        else
+        {
+            pUndoAction->RecordEndEdit();
+        }
         m_undoStack.RegisterAction( pUndoAction );
         m_pActiveUndoableAction = nullptr;
 
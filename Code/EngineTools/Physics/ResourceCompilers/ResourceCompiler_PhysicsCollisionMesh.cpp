@@ -72,7 +72,7 @@ namespace EE::Physics
             return Error( "Invalid source data path: %s", resourceDescriptor.m_sourcePath.c_str() );
         }
 
-        RawAssets::ReaderContext readerCtx = { [this]( char const* pString ) { Warning( pString ); }, [this] ( char const* pString ) { Error( pString ); } };
+        RawAssets::ReaderContext readerCtx = { [this]( char const* pString ) { Warning( pString ); }, [this] ( char const* pString ) { Error( pString ); }, ctx.m_rawAssetCacheDirectoryPath, ctx.m_pTaskSystem };
         TUniquePtr<RawAssets::RawMesh> pRawMesh = RawAssets::ReadStaticMesh( readerCtx, meshFilePath, resourceDescriptor.m_meshesToInclude );
         if ( pRawMesh == nullptr )
         {
@@ -2,6 +2,7 @@
 #include "EngineTools/RawAssets/RawSkeleton.h"
 #include "EngineTools/RawAssets/RawAnimation.h"
 #include "EngineTools/RawAssets/RawMesh.h"
+#include "Base/Threading/TaskSystem.h"
 
 //-------------------------------------------------------------------------
 
@@ -14,9 +15,71 @@ using namespace EE::RawAssets;
 
 namespace EE::Fbx
 {
+    // Read-only stream over an already loaded binary FBX file, so that the importer doesnt need to read the file from disk again
+    class FbxMemoryStream final : public FbxStream
+    {
+    public:
+
+        FbxMemoryStream( FbxManager* pManager, Blob const* pData )
+            : m_pData( pData )
+            , m_readerID( pManager->GetIOPluginRegistry()->FindReaderIDByExtension( "fbx" ) )
+        {}
+
+        virtual EState GetState() override { return m_isOpen ? FbxStream::eOpen : FbxStream::eClosed; }
+        virtual bool Open( void* pStreamData ) override { m_isOpen = true; m_position = 0; return true; }
+        virtual bool Close() override { m_isOpen = false; return true; }
+        virtual bool Flush() override { return true; }
+        virtual size_t Write( void const* pData, FbxUInt64 size ) override { return 0; }
+
+        virtual size_t Read( void* pData, FbxUInt64 size ) const override
+        {
+            EE_ASSERT( m_pData != nullptr );
+            size_t const numBytesToRead = Math::Min( (size_t) size, m_pData->size() - (size_t) m_position );
+            memcpy( pData, m_pData->data() + m_position, numBytesToRead );
+            m_position += numBytesToRead;
+            return numBytesToRead;
+        }
+
+        virtual int GetReaderID() const override { return m_readerID; }
+        virtual int GetWriterID() const override { return -1; }
+
+        virtual void Seek( FbxInt64 const& offset, FbxFile::ESeekPos const& seekPos ) override
+        {
+            switch ( seekPos )
+            {
+                case FbxFile::eBegin: SetPosition( offset ); break;
+                case FbxFile::eCurrent: SetPosition( m_position + offset ); break;
+                case FbxFile::eEnd: SetPosition( GetSize() + offset ); break;
+            }
+        }
+
+        virtual FbxInt64 GetPosition() const override { return m_position; }
+        virtual void SetPosition( FbxInt64 position ) override { m_position = Math::Clamp( position, (FbxInt64) 0, GetSize() ); }
+        virtual int GetError() const override { return 0; }
+        virtual void ClearError() override {}
+
+    private:
+
+        inline FbxInt64 GetSize() const { return ( m_pData != nullptr ) ? (FbxInt64) m_pData->size() : 0; }
+
+    private:
+
+        Blob const*                         m_pData = nullptr;
+        mutable FbxInt64                    m_position = 0;
+        int                                 m_readerID = -1;
+        bool                                m_isOpen = false;
+    };
+
+    //-------------------------------------------------------------------------
+
     SceneContext::SceneContext( FileSystem::Path const& filePath, float additionalScalingFactor )
     {
-        Initialize( filePath, additionalScalingFactor );
+        Initialize( filePath, nullptr, additionalScalingFactor );
+    }
+
+    SceneContext::SceneContext( FileSystem::Path const& filePath, Blob const* pFileData, float additionalScalingFactor )
+    {
+        Initialize( filePath, pFileData, additionalScalingFactor );
     }
 
     SceneContext::~SceneContext()
@@ -29,28 +92,57 @@ namespace EE::Fbx
     void SceneContext::LoadFile( FileSystem::Path const& filePath, float additionalScalingFactor )
     {
         Shutdown();
-        Initialize( filePath, additionalScalingFactor );
+        Initialize( filePath, nullptr, additionalScalingFactor );
     }
 
     //-------------------------------------------------------------------------
 
-    void SceneContext::Initialize( FileSystem::Path const& filePath, float additionalScalingFactor )
+    void SceneContext::Initialize( FileSystem::Path const& filePath, Blob const* pFileData, float additionalScalingFactor )
     {
         m_filePath = filePath;
 
-        if ( !FileSystem::Exists( m_filePath ) )
+        if ( pFileData == nullptr && !FileSystem::Exists( m_filePath ) )
         {
             m_error.sprintf( "Specified FBX file doesn't exist: %s", m_filePath.c_str() );
             return;
         }
 
+        // Check file format
+        //-------------------------------------------------------------------------
+
+        char cmpBuffer[19] = { 0 };
+        if ( pFileData != nullptr )
+        {
+            memcpy( cmpBuffer, pFileData->data(), Math::Min( pFileData->size(), (size_t) 18 ) );
+        }
+        else
+        {
+            FILE* fp = nullptr;
+            int32_t errcode = fopen_s( &fp, m_filePath.c_str(), "r" );
+            EE_ASSERT( errcode == 0 );
+
+            fread( cmpBuffer, 1, 18, fp );
+            fclose( fp );
+        }
+
+        bool const isBinaryFile = strcmp( cmpBuffer, "Kaydara FBX Binary" ) == 0;
+        if ( !isBinaryFile )
+        {
+            m_warning.sprintf( "Reading ASCII FBX files will be slower than binary. It is highly recommended that you convert all FBX input files to binary!" );
+        }
+
         // Import the FBX file
         //-------------------------------------------------------------------------
 
         m_pManager = FbxManager::Create();
 
+        // Binary files are imported from the supplied data, the ASCII reader doesnt support streams so those are always read from disk
+        bool const importFromMemory = pFileData != nullptr && isBinaryFile;
+        FbxMemoryStream memoryStream( m_pManager, importFromMemory ? pFileData : nullptr );
+
         auto pImporter = FbxImporter::Create( m_pManager, "EE Importer" );
-        if ( !pImporter->Initialize( m_filePath, -1, m_pManager->GetIOSettings() ) )
+        bool const importerInitialized = importFromMemory ? pImporter->Initialize( &memoryStream, nullptr, memoryStream.GetReaderID(), m_pManager->GetIOSettings() ) : pImporter->Initialize( m_filePath, -1, m_pManager->GetIOSettings() );
+        if ( !importerInitialized )
         {
             m_error.sprintf( "Failed to load specified FBX file ( %s ) : %s", m_filePath.c_str(), pImporter->GetStatus().GetErrorString() );
             return;
@@ -67,22 +159,6 @@ namespace EE::Fbx
 
         m_pGeometryConvertor = EE::New<FbxGeometryConverter>( m_pManager );
 
-        // Check file format
-        //-------------------------------------------------------------------------
-
-        FILE* fp = nullptr;
-        int32_t errcode = fopen_s( &fp, m_filePath.c_str(), "r" );
-        EE_ASSERT( errcode == 0 );
-
-        char cmpBuffer[19] = { 0 };
-        fread( cmpBuffer, 1, 18, fp );
-        fclose( fp );
-
-        if ( strcmp( cmpBuffer, "Kaydara FBX Binary" ) != 0 )
-        {
-            m_warning.sprintf( "Reading ASCII FBX files will be slower than binary. It is highly recommended that you convert all FBX input files to binary!" );
-        }
-
         // Co-ordinate system scene conversion
         //-------------------------------------------------------------------------
 
@@ -286,7 +362,7 @@ namespace EE::Fbx
     {
     public:
 
-        static TUniquePtr<RawSkeleton> ReadSkeleton( FileSystem::Path const& sourceFilePath, String const& skeletonRootBoneName )
+        static TUniquePtr<RawSkeleton> ReadSkeleton( FileSystem::Path const& sourceFilePath, String const& skeletonRootBoneName, Blob const* pSourceFileData )
         {
             EE_ASSERT( sourceFilePath.IsValid() );
 
@@ -296,7 +372,7 @@ namespace EE::Fbx
 
             //-------------------------------------------------------------------------
 
-            Fbx::SceneContext sceneCtx( sourceFilePath );
+            Fbx::SceneContext sceneCtx( sourceFilePath, pSourceFileData );
             if ( sceneCtx.IsValid() )
             {
                 if ( sceneCtx.HasWarningOccurred() )
@@ -401,9 +477,9 @@ namespace EE::Fbx
 
     //-------------------------------------------------------------------------
 
-    TUniquePtr<RawSkeleton> ReadSkeleton( FileSystem::Path const& sourceFilePath, String const& skeletonRootBoneName )
+    TUniquePtr<RawSkeleton> ReadSkeleton( FileSystem::Path const& sourceFilePath, String const& skeletonRootBoneName, Blob const* pSourceFileData )
     {
-        return FbxSkeletonFileReader::ReadSkeleton( sourceFilePath, skeletonRootBoneName );
+        return FbxSkeletonFileReader::ReadSkeleton( sourceFilePath, skeletonRootBoneName, pSourceFileData );
     }
 
     void ReadSkeleton( SceneContext const& sceneCtx, String const& skeletonRootBoneName, RawSkeleton& skeleton )
@@ -430,14 +506,14 @@ namespace EE::Fbx
 
     public:
 
-        static TUniquePtr<RawAnimation> ReadAnimation( FileSystem::Path const& sourceFilePath, RawSkeleton const& rawSkeleton, String const& animationName )
+        static TUniquePtr<RawAnimation> ReadAnimation( FileSystem::Path const& sourceFilePath, RawSkeleton const& rawSkeleton, String const& animationName, Blob const* pSourceFileData )
         {
             EE_ASSERT( sourceFilePath.IsValid() && rawSkeleton.IsValid() );
 
             TUniquePtr<RawAnimation> pAnimation( EE::New<RawAnimation>( rawSkeleton ) );
             FbxRawAnimation* pRawAnimation = (FbxRawAnimation*) pAnimation.get();
 
-            Fbx::SceneContext sceneCtx( sourceFilePath );
+            Fbx::SceneContext sceneCtx( sourceFilePath, pSourceFileData );
             if ( sceneCtx.IsValid() )
             {
                 if ( sceneCtx.HasWarningOccurred() )
@@ -663,9 +739,9 @@ namespace EE::Fbx
 
     //-------------------------------------------------------------------------
 
-    TUniquePtr<RawAnimation> ReadAnimation( FileSystem::Path const& animationFilePath, RawSkeleton const& rawSkeleton, String const& takeName )
+    TUniquePtr<RawAnimation> ReadAnimation( FileSystem::Path const& animationFilePath, RawSkeleton const& rawSkeleton, String const& takeName, Blob const* pSourceFileData )
     {
-        return FbxAnimationFileReader::ReadAnimation( animationFilePath, rawSkeleton, takeName );
+        return FbxAnimationFileReader::ReadAnimation( animationFilePath, rawSkeleton, takeName, pSourceFileData );
     }
 }
 
@@ -747,7 +823,7 @@ namespace EE::Fbx
 
         //-------------------------------------------------------------------------
 
-        static TUniquePtr<RawMesh> ReadStaticMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude )
+        static TUniquePtr<RawMesh> ReadStaticMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude, Blob const* pSourceFileData )
         {
             EE_ASSERT( sourceFilePath.IsValid() );
 
@@ -756,7 +832,7 @@ namespace EE::Fbx
 
             //-------------------------------------------------------------------------
 
-            Fbx::SceneContext sceneCtx( sourceFilePath );
+            Fbx::SceneContext sceneCtx( sourceFilePath, pSourceFileData );
             if ( sceneCtx.IsValid() )
             {
                 if ( sceneCtx.HasWarningOccurred() )
@@ -774,7 +850,7 @@ namespace EE::Fbx
             return pMesh;
         }
 
-        static TUniquePtr<RawMesh> ReadSkeletalMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude, int32_t maxBoneInfluences = 4 )
+        static TUniquePtr<RawMesh> ReadSkeletalMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude, int32_t maxBoneInfluences, Blob const* pSourceFileData, TaskSystem* pTaskSystem )
         {
             EE_ASSERT( sourceFilePath.IsValid() );
 
@@ -783,7 +859,7 @@ namespace EE::Fbx
 
             //-------------------------------------------------------------------------
 
-            Fbx::SceneContext sceneCtx( sourceFilePath );
+            Fbx::SceneContext sceneCtx( sourceFilePath, pSourceFileData );
             if ( sceneCtx.IsValid() )
             {
                 if ( sceneCtx.HasWarningOccurred() )
@@ -804,6 +880,8 @@ namespace EE::Fbx
                     return pMesh;
                 }
 
+                ReduceSkinningInfluences( *pRawMesh, pTaskSystem );
+
                 // Since the bind pose is in global space, calculate the local space transforms for the skeleton
                 FbxRawSkeleton& rawSkeleton = (FbxRawSkeleton&) pRawMesh->m_skeleton;
                 rawSkeleton.CalculateLocalTransforms();
@@ -1311,66 +1389,132 @@ namespace EE::Fbx
                 }
             }
 
-            // Ensure we have <= the max number of skinning influences per vertex
             //-------------------------------------------------------------------------
 
-            bool vertexInfluencesReduced = false;
-            auto const numVerts = geometryData.m_vertices.size();
-            for ( auto v = 0; v < numVerts; v++ )
+            rawSkeleton.CalculateLocalTransforms();
+            return true;
+        }
+
+        //-------------------------------------------------------------------------
+
+        // Returns true if the vertex had more than the max number of influences
+        static bool ReduceVertexInfluences( RawMesh::VertexData& vert, int32_t const maxNumberOfBoneInfluences )
+        {
+            auto const numInfluences = (int32_t) vert.m_boneIndices.size();
+            if ( numInfluences <= maxNumberOfBoneInfluences )
             {
-                auto& vert = geometryData.m_vertices[v];
-                auto numInfluences = vert.m_boneIndices.size();
+                return false;
+            }
 
-                if ( numInfluences > rawMesh.m_maxNumberOfBoneInfluences )
+            // Move the largest influences to the front (selection sort, the number of influences is tiny) and drop the rest
+            for ( auto i = 0; i < maxNumberOfBoneInfluences; i++ )
+            {
+                int32_t largestWeightIdx = i;
+                for ( auto f = i + 1; f < numInfluences; f++ )
                 {
-                    while ( vert.m_boneIndices.size() > rawMesh.m_maxNumberOfBoneInfluences )
+                    if ( vert.m_boneWeights[f] > vert.m_boneWeights[largestWeightIdx] )
                     {
-                        // Remove lowest influence
-                        int32_t smallestWeightIdx = 0;
-                        for ( auto f = 1; f < vert.m_boneIndices.size(); f++ )
-                        {
-                            if ( vert.m_boneWeights[f] < vert.m_boneWeights[smallestWeightIdx] )
-                            {
-                                smallestWeightIdx = f;
-                            }
-                        }
-
-                        vert.m_boneWeights.erase( vert.m_boneWeights.begin() + smallestWeightIdx );
-                        vert.m_boneIndices.erase( vert.m_boneIndices.begin() + smallestWeightIdx );
+                        largestWeightIdx = f;
                     }
+                }
 
-                    vertexInfluencesReduced = true;
+                eastl::swap( vert.m_boneWeights[i], vert.m_boneWeights[largestWeightIdx] );
+                eastl::swap( vert.m_boneIndices[i], vert.m_boneIndices[largestWeightIdx] );
+            }
 
-                    // Re-normalize weights
-                    float const totalWeight = vert.m_boneWeights[0] + vert.m_boneWeights[1] + vert.m_boneWeights[2] + vert.m_boneWeights[3];
-                    for ( auto i = 1; i < rawMesh.m_maxNumberOfBoneInfluences; i++ )
-                    {
-                        vert.m_boneWeights[i] /= totalWeight;
-                    }
-                }
+            vert.m_boneWeights.resize( maxNumberOfBoneInfluences );
+            vert.m_boneIndices.resize( maxNumberOfBoneInfluences );
+
+            // Re-normalize weights
+            float totalWeight = 0.0f;
+            for ( auto i = 0; i < maxNumberOfBoneInfluences; i++ )
+            {
+                totalWeight += vert.m_boneWeights[i];
             }
 
-            if ( vertexInfluencesReduced )
+            for ( auto i = 0; i < maxNumberOfBoneInfluences; i++ )
             {
-                rawMesh.LogWarning( "More than %d skinning influences detected per bone for mesh (%s), this is not supported - influences have been reduced to %d", rawMesh.m_maxNumberOfBoneInfluences, geometryData.m_name.c_str(), rawMesh.m_maxNumberOfBoneInfluences );
+                vert.m_boneWeights[i] /= totalWeight;
             }
 
+            return true;
+        }
+
+        // Ensure we have <= the max number of skinning influences per vertex
+        // This runs once all the sections have been extracted (the FBX SDK is single threaded), the vertices are independent so we reduce them in parallel when we have a task system
+        static void ReduceSkinningInfluences( FbxRawMesh& rawMesh, TaskSystem* pTaskSystem )
+        {
+            struct InfluenceReductionTask final : public ITaskSet
+            {
+                InfluenceReductionTask( RawMesh::GeometrySection& geometrySection, int32_t maxNumberOfBoneInfluences )
+                    : m_geometrySection( geometrySection )
+                    , m_maxNumberOfBoneInfluences( maxNumberOfBoneInfluences )
+                {
+                    m_SetSize = (uint32_t) geometrySection.m_vertices.size();
+                    m_MinRange = s_minVerticesPerRange;
+                }
+
+                virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+                {
+                    bool vertexInfluencesReduced = false;
+                    for ( uint64_t i = range.start; i < range.end; ++i )
+                    {
+                        vertexInfluencesReduced |= ReduceVertexInfluences( m_geometrySection.m_vertices[i], m_maxNumberOfBoneInfluences );
+                    }
+
+                    if ( vertexInfluencesReduced )
+                    {
+                        m_vertexInfluencesReduced = true;
+                    }
+                }
+
+            public:
+
+                constexpr static uint32_t const     s_minVerticesPerRange = 4096;
+
+                RawMesh::GeometrySection&           m_geometrySection;
+                int32_t                             m_maxNumberOfBoneInfluences;
+                std::atomic<bool>                   m_vertexInfluencesReduced = false;
+            };
+
             //-------------------------------------------------------------------------
 
-            rawSkeleton.CalculateLocalTransforms();
-            return true;
+            for ( auto& geometrySection : rawMesh.m_geometrySections )
+            {
+                bool vertexInfluencesReduced = false;
+
+                if ( pTaskSystem != nullptr && geometrySection.m_vertices.size() > InfluenceReductionTask::s_minVerticesPerRange )
+                {
+                    InfluenceReductionTask reductionTask( geometrySection, rawMesh.m_maxNumberOfBoneInfluences );
+                    pTaskSystem->ScheduleTask( &reductionTask );
+                    pTaskSystem->WaitForTask( &reductionTask );
+                    vertexInfluencesReduced = reductionTask.m_vertexInfluencesReduced;
+                }
+                else
+                {
+                    for ( auto& vert : geometrySection.m_vertices )
+                    {
+                        vertexInfluencesReduced |= ReduceVertexInfluences( vert, rawMesh.m_maxNumberOfBoneInfluences );
+                    }
+                }
+
+                if ( vertexInfluencesReduced )
+                {
+                    rawMesh.LogWarning( "More than %d skinning influences detected per bone for mesh (%s), this is not supported - influences have been reduced to %d", rawMesh.m_maxNumberOfBoneInfluences, geometrySection.m_name.c_str(), rawMesh.m_maxNumberOfBoneInfluences );
+                }
+            }
         }
     };
 
     //-------------------------------------------------------------------------
 
-    TUniquePtr<RawMesh> Fbx::ReadStaticMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude )
+    TUniquePtr<RawMesh> Fbx::ReadStaticMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude, Blob const* pSourceFileData )
     {
-        return FbxMeshFileReader::ReadStaticMesh( sourceFilePath, meshesToInclude );
+        return FbxMeshFileReader::ReadStaticMesh( sourceFilePath, meshesToInclude, pSourceFileData );
     }
 
-    TUniquePtr<RawMesh> Fbx::ReadSkeletalMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude, int32_t maxBoneInfluences )
+    TUniquePtr<RawMesh> Fbx::ReadSkeletalMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude, int32_t maxBoneInfluences, Blob const* pSourceFileData, TaskSystem* pTaskSystem )
     {
-        return FbxMeshFileReader::ReadSkeletalMesh( sourceFilePath, meshesToInclude, maxBoneInfluences );
+        return FbxMeshFileReader::ReadSkeletalMesh( sourceFilePath, meshesToInclude, maxBoneInfluences, pSourceFileData, pTaskSystem );
     }
 }
\ No newline at end of file
@@ -6,10 +6,16 @@
 #include "Base/FileSystem/FileSystemPath.h"
 #include "Base/Types/StringID.h"
 #include "Base/Memory/Pointers.h"
+#include "Base/Types/Arrays.h"
 #include <fbxsdk.h>
 
 //-------------------------------------------------------------------------
 
+namespace EE
+{
+    class TaskSystem;
+}
+
 namespace EE::RawAssets
 {
     class RawMesh;
@@ -41,6 +47,10 @@ namespace EE::Fbx
 
         SceneContext() = default;
         SceneContext( FileSystem::Path const& filePath, float additionalScalingFactor = 1.0f );
+
+        // Import the scene from an already loaded copy of the file (if set), only binary files are imported from memory
+        SceneContext( FileSystem::Path const& filePath, Blob const* pFileData, float additionalScalingFactor = 1.0f );
+
         ~SceneContext();
 
         void LoadFile( FileSystem::Path const& filePath, float additionalScalingFactor = 1.0f );
@@ -139,7 +149,7 @@ namespace EE::Fbx
 
     private:
 
-        void Initialize( FileSystem::Path const& filePath, float additionalScalingFactor );
+        void Initialize( FileSystem::Path const& filePath, Blob const* pFileData, float additionalScalingFactor );
         void Shutdown();
 
         SceneContext( SceneContext const& ) = delete;
@@ -173,9 +183,11 @@ namespace EE::Fbx
     //-------------------------------------------------------------------------
     // Import Functions
     //-------------------------------------------------------------------------
+    // Optional: 'pSourceFileData' is an already loaded copy of the source file, the file is read from disk if it isnt set
+    // Optional: 'pTaskSystem' is used to post-process the skinning influences of the extracted mesh in parallel
 
-    EE_ENGINETOOLS_API TUniquePtr<RawAssets::RawSkeleton> ReadSkeleton( FileSystem::Path const& sourceFilePath, String const& skeletonRootBoneName );
-    EE_ENGINETOOLS_API TUniquePtr<RawAssets::RawAnimation> ReadAnimation( FileSystem::Path const& animationFilePath, RawAssets::RawSkeleton const& rawSkeleton, String const& animationName );
-    EE_ENGINETOOLS_API TUniquePtr<RawAssets::RawMesh> ReadStaticMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude );
-    EE_ENGINETOOLS_API TUniquePtr<RawAssets::RawMesh> ReadSkeletalMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude, int32_t maxBoneInfluences );
+    EE_ENGINETOOLS_API TUniquePtr<RawAssets::RawSkeleton> ReadSkeleton( FileSystem::Path const& sourceFilePath, String const& skeletonRootBoneName, Blob const* pSourceFileData = nullptr );
+    EE_ENGINETOOLS_API TUniquePtr<RawAssets::RawAnimation> ReadAnimation( FileSystem::Path const& animationFilePath, RawAssets::RawSkeleton const& rawSkeleton, String const& animationName, Blob const* pSourceFileData = nullptr );
+    EE_ENGINETOOLS_API TUniquePtr<RawAssets::RawMesh> ReadStaticMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude, Blob const* pSourceFileData = nullptr );
+    EE_ENGINETOOLS_API TUniquePtr<RawAssets::RawMesh> ReadSkeletalMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude, int32_t maxBoneInfluences, Blob const* pSourceFileData = nullptr, TaskSystem* pTaskSystem = nullptr );
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "EngineTools/RawAssets/RawSkeleton.h"
 #include "EngineTools/RawAssets/RawAnimation.h"
 #include "EngineTools/RawAssets/RawMesh.h"
+#include "Base/Threading/TaskSystem.h"
 
 #define CGLTF_IMPLEMENTATION
 #include "EngineTools/ThirdParty/cgltf/cgltf.h"
@@ -34,7 +35,12 @@ namespace EE::gltf
 
     SceneContext::SceneContext( FileSystem::Path const& filePath, float additionalScalingFactor )
     {
-        Initialize( filePath, additionalScalingFactor );
+        Initialize( filePath, nullptr, additionalScalingFactor );
+    }
+
+    SceneContext::SceneContext( FileSystem::Path const& filePath, Blob const* pFileData, float additionalScalingFactor )
+    {
+        Initialize( filePath, pFileData, additionalScalingFactor );
     }
 
     SceneContext::~SceneContext()
@@ -47,19 +53,20 @@ namespace EE::gltf
     void SceneContext::LoadFile( FileSystem::Path const& filePath, float additionalScalingFactor )
     {
         Shutdown();
-        Initialize( filePath, additionalScalingFactor );
+        Initialize( filePath, nullptr, additionalScalingFactor );
     }
 
     //-------------------------------------------------------------------------
 
-    void SceneContext::Initialize( FileSystem::Path const& filePath, float additionalScalingFactor )
+    void SceneContext::Initialize( FileSystem::Path const& filePath, Blob const* pFileData, float additionalScalingFactor )
     {
         cgltf_options options = { cgltf_file_type_invalid, 0 };
 
         // Parse gltf/glb files
         //-------------------------------------------------------------------------
 
-        cgltf_result const parseResult = cgltf_parse_file( &options, filePath.c_str(), &m_pSceneData );
+        // When parsing from memory, the scene data (i.e. the glb binary chunk) points directly into the supplied data
+        cgltf_result const parseResult = ( pFileData != nullptr ) ? cgltf_parse( &options, pFileData->data(), pFileData->size(), &m_pSceneData ) : cgltf_parse_file( &options, filePath.c_str(), &m_pSceneData );
         if ( parseResult != cgltf_result_success )
         {
             m_error.sprintf( "Failed to load specified gltf file ( %s ) : %s", filePath.c_str(), g_errorStrings[parseResult] );
@@ -110,7 +117,7 @@ namespace EE::gltf
 
     public:
 
-        static TUniquePtr<RawSkeleton> ReadSkeleton( FileSystem::Path const& sourceFilePath, String const& skeletonRootBoneName )
+        static TUniquePtr<RawSkeleton> ReadSkeleton( FileSystem::Path const& sourceFilePath, String const& skeletonRootBoneName, Blob const* pSourceFileData )
         {
             EE_ASSERT( sourceFilePath.IsValid() );
 
@@ -119,7 +126,7 @@ namespace EE::gltf
 
             //-------------------------------------------------------------------------
 
-            gltf::SceneContext sceneCtx( sourceFilePath );
+            gltf::SceneContext sceneCtx( sourceFilePath, pSourceFileData );
             if ( sceneCtx.IsValid() )
             {
                 ReadSkeleton( sceneCtx, skeletonRootBoneName, *pRawSkeleton );
@@ -209,9 +216,9 @@ namespace EE::gltf
 
     //-------------------------------------------------------------------------
 
-    TUniquePtr<RawSkeleton> ReadSkeleton( FileSystem::Path const& sourceFilePath, String const& skeletonRootBoneName )
+    TUniquePtr<RawSkeleton> ReadSkeleton( FileSystem::Path const& sourceFilePath, String const& skeletonRootBoneName, Blob const* pSourceFileData )
     {
-        return gltfSkeletonFileReader::ReadSkeleton( sourceFilePath, skeletonRootBoneName );
+        return gltfSkeletonFileReader::ReadSkeleton( sourceFilePath, skeletonRootBoneName, pSourceFileData );
     }
 }
 
@@ -239,14 +246,14 @@ namespace EE::gltf
 
     public:
 
-        static TUniquePtr<RawAnimation> ReadAnimation( FileSystem::Path const& sourceFilePath, RawSkeleton const& rawSkeleton, String const& animationName )
+        static TUniquePtr<RawAnimation> ReadAnimation( FileSystem::Path const& sourceFilePath, RawSkeleton const& rawSkeleton, String const& animationName, Blob const* pSourceFileData )
         {
             EE_ASSERT( sourceFilePath.IsValid() && rawSkeleton.IsValid() );
 
             TUniquePtr<RawAnimation> pAnimation( EE::New<RawAnimation>( rawSkeleton ) );
             gltfRawAnimation* pRawAnimation = (gltfRawAnimation*) pAnimation.get();
 
-            gltf::SceneContext sceneCtx( sourceFilePath );
+            gltf::SceneContext sceneCtx( sourceFilePath, pSourceFileData );
             if ( sceneCtx.IsValid() )
             {
                 auto pSceneData = sceneCtx.GetSceneData();
@@ -422,9 +429,9 @@ namespace EE::gltf
 
     //-------------------------------------------------------------------------
 
-    TUniquePtr<RawAnimation> ReadAnimation( FileSystem::Path const& animationFilePath, RawSkeleton const& rawSkeleton, String const& takeName )
+    TUniquePtr<RawAnimation> ReadAnimation( FileSystem::Path const& animationFilePath, RawSkeleton const& rawSkeleton, String const& takeName, Blob const* pSourceFileData )
     {
-        return gltfAnimationFileReader::ReadAnimation( animationFilePath, rawSkeleton, takeName );
+        return gltfAnimationFileReader::ReadAnimation( animationFilePath, rawSkeleton, takeName, pSourceFileData );
     }
 }
 
@@ -466,176 +473,223 @@ namespace EE::gltf
             return true;
         }
 
-        static void ReadMeshGeometry( gltf::SceneContext const& ctx, gltfRawMesh& rawMesh, cgltf_mesh const& meshData )
+        // Create a geometry section per primitive, the sections are converted once all of them have been created (see 'ReadGeometrySections')
+        static void AddGeometrySections( gltfRawMesh& rawMesh, cgltf_mesh const& meshData, TVector<cgltf_primitive const*>& sectionPrimitives )
         {
             EE_ASSERT( IsValidTriangleMesh( meshData ) );
 
             for ( auto p = 0; p < meshData.primitives_count; p++ )
             {
-                cgltf_primitive const& primitive = meshData.primitives[p];
-
-                // Create new geometry section and allocate vertex memory
-                //-------------------------------------------------------------------------
-
                 auto& geometrySection = rawMesh.m_geometrySections.emplace_back( RawMesh::GeometrySection() );
                 geometrySection.m_name = meshData.name;
                 geometrySection.m_clockwiseWinding = false;
+                sectionPrimitives.emplace_back( &meshData.primitives[p] );
+            }
+        }
 
-                EE_ASSERT( primitive.attributes_count > 0 );
-                size_t const numVertices = primitive.attributes[0].data->count;
-                geometrySection.m_vertices.resize( numVertices );
+        static void ReadPrimitiveGeometry( gltf::SceneContext const& ctx, cgltf_primitive const& primitive, RawMesh::GeometrySection& geometrySection )
+        {
+            EE_ASSERT( primitive.attributes_count > 0 );
+            size_t const numVertices = primitive.attributes[0].data->count;
+            geometrySection.m_vertices.resize( numVertices );
 
-                // Read vertex data
-                //-------------------------------------------------------------------------
+            // Read vertex data
+            //-------------------------------------------------------------------------
 
-                // Check how many texture coordinate attributes do we have?
-                uint32_t numTexcoordAttributes = 0;
-                for ( auto a = 0; a < primitive.attributes_count; a++ )
+            // Check how many texture coordinate attributes do we have?
+            uint32_t numTexcoordAttributes = 0;
+            for ( auto a = 0; a < primitive.attributes_count; a++ )
+            {
+                if ( primitive.attributes[a].type == cgltf_attribute_type_texcoord )
                 {
-                    if ( primitive.attributes[a].type == cgltf_attribute_type_texcoord )
-                    {
-                        numTexcoordAttributes++;
-                    }
+                    numTexcoordAttributes++;
                 }
+            }
 
-                if ( numTexcoordAttributes > 0 )
+            if ( numTexcoordAttributes > 0 )
+            {
+                for ( auto v = 0; v < numVertices; v++ )
                 {
-                    for ( auto v = 0; v < numVertices; v++ )
-                    {
-                        geometrySection.m_vertices[v].m_texCoords.resize( numTexcoordAttributes );
-                    }
+                    geometrySection.m_vertices[v].m_texCoords.resize( numTexcoordAttributes );
                 }
+            }
 
-                geometrySection.m_numUVChannels = numTexcoordAttributes;
+            geometrySection.m_numUVChannels = numTexcoordAttributes;
 
-                //-------------------------------------------------------------------------
+            //-------------------------------------------------------------------------
 
-                for ( auto a = 0; a < primitive.attributes_count; a++ )
+            for ( auto a = 0; a < primitive.attributes_count; a++ )
+            {
+                switch ( primitive.attributes[a].type )
                 {
-                    switch ( primitive.attributes[a].type )
+                    case cgltf_attribute_type_position:
                     {
-                        case cgltf_attribute_type_position:
-                        {
-                            EE_ASSERT( primitive.attributes[a].data->type == cgltf_type_vec3 );
+                        EE_ASSERT( primitive.attributes[a].data->type == cgltf_type_vec3 );
 
-                            for ( auto i = 0; i < numVertices; i++ )
-                            {
-                                Float3 position;
-                                cgltf_accessor_read_float( primitive.attributes[a].data, i, &position.m_x, 3 );
-                                geometrySection.m_vertices[i].m_position = ctx.ApplyUpAxisCorrection( Vector( position ) );
-                                geometrySection.m_vertices[i].m_position.m_w = 1.0f;
-                            }
-                        }
-                        break;
-
-                        case cgltf_attribute_type_normal:
+                        for ( auto i = 0; i < numVertices; i++ )
                         {
-                            EE_ASSERT( primitive.attributes[a].data->type == cgltf_type_vec3 );
-
-                            for ( auto i = 0; i < numVertices; i++ )
-                            {
-                                Float3 normal;
-                                cgltf_accessor_read_float( primitive.attributes[a].data, i, &normal.m_x, 3 );
-                                geometrySection.m_vertices[i].m_normal = ctx.ApplyUpAxisCorrection( Vector( normal ) );
-                                geometrySection.m_vertices[i].m_position.m_w = 0.0f;
-                            }
+                            Float3 position;
+                            cgltf_accessor_read_float( primitive.attributes[a].data, i, &position.m_x, 3 );
+                            geometrySection.m_vertices[i].m_position = ctx.ApplyUpAxisCorrection( Vector( position ) );
+                            geometrySection.m_vertices[i].m_position.m_w = 1.0f;
                         }
-                        break;
+                    }
+                    break;
 
-                        case cgltf_attribute_type_tangent:
-                        {
-                            EE_ASSERT( primitive.attributes[a].data->type == cgltf_type_vec4 );
+                    case cgltf_attribute_type_normal:
+                    {
+                        EE_ASSERT( primitive.attributes[a].data->type == cgltf_type_vec3 );
 
-                            for ( auto i = 0; i < numVertices; i++ )
-                            {
-                                Float4 tangent;
-                                cgltf_accessor_read_float( primitive.attributes[a].data, i, &tangent.m_x, 4 );
-                                geometrySection.m_vertices[i].m_tangent = ctx.ApplyUpAxisCorrection( Vector( tangent ) );
-                                geometrySection.m_vertices[i].m_position.m_w = tangent.m_w;
-                            }
+                        for ( auto i = 0; i < numVertices; i++ )
+                        {
+                            Float3 normal;
+                            cgltf_accessor_read_float( primitive.attributes[a].data, i, &normal.m_x, 3 );
+                            geometrySection.m_vertices[i].m_normal = ctx.ApplyUpAxisCorrection( Vector( normal ) );
+                            geometrySection.m_vertices[i].m_position.m_w = 0.0f;
                         }
-                        break;
+                    }
+                    break;
 
-                        case cgltf_attribute_type_texcoord:
-                        {
-                            EE_ASSERT( primitive.attributes[a].data->type == cgltf_type_vec2 );
+                    case cgltf_attribute_type_tangent:
+                    {
+                        EE_ASSERT( primitive.attributes[a].data->type == cgltf_type_vec4 );
 
-                            for ( auto i = 0; i < numVertices; i++ )
-                            {
-                                Float2 texcoord;
-                                cgltf_accessor_read_float( primitive.attributes[a].data, i, &texcoord.m_x, 3 );
-                                geometrySection.m_vertices[i].m_texCoords[primitive.attributes[a].index] = texcoord;
-                            }
+                        for ( auto i = 0; i < numVertices; i++ )
+                        {
+                            Float4 tangent;
+                            cgltf_accessor_read_float( primitive.attributes[a].data, i, &tangent.m_x, 4 );
+                            geometrySection.m_vertices[i].m_tangent = ctx.ApplyUpAxisCorrection( Vector( tangent ) );
+                            geometrySection.m_vertices[i].m_position.m_w = tangent.m_w;
                         }
-                        break;
+                    }
+                    break;
 
-                        case cgltf_attribute_type_color:
+                    case cgltf_attribute_type_texcoord:
+                    {
+                        EE_ASSERT( primitive.attributes[a].data->type == cgltf_type_vec2 );
+
+                        for ( auto i = 0; i < numVertices; i++ )
                         {
-                            // Not implemented
+                            Float2 texcoord;
+                            cgltf_accessor_read_float( primitive.attributes[a].data, i, &texcoord.m_x, 3 );
+                            geometrySection.m_vertices[i].m_texCoords[primitive.attributes[a].index] = texcoord;
                         }
-                        break;
+                    }
+                    break;
+
+                    case cgltf_attribute_type_color:
+                    {
+                        // Not implemented
+                    }
+                    break;
+
+                    case cgltf_attribute_type_joints:
+                    {
+                        EE_ASSERT( primitive.attributes[a].data->type == cgltf_type_vec4 );
 
-                        case cgltf_attribute_type_joints:
+                        for ( auto i = 0; i < numVertices; i++ )
                         {
-                            EE_ASSERT( primitive.attributes[a].data->type == cgltf_type_vec4 );
+                            uint32_t joints[4] = { 0, 0, 0, 0 };
+                            cgltf_accessor_read_uint( primitive.attributes[a].data, i, joints, 4 );
 
-                            for ( auto i = 0; i < numVertices; i++ )
+                            for ( auto j = 0; j < 4; j++ )
                             {
-                                uint32_t joints[4] = { 0, 0, 0, 0 };
-                                cgltf_accessor_read_uint( primitive.attributes[a].data, i, joints, 4 );
-
-                                for ( auto j = 0; j < 4; j++ )
-                                {
-                                    geometrySection.m_vertices[i].m_boneIndices.emplace_back( joints[j] );
-                                }
+                                geometrySection.m_vertices[i].m_boneIndices.emplace_back( joints[j] );
                             }
                         }
-                        break;
+                    }
+                    break;
 
-                        case cgltf_attribute_type_weights:
-                        {
-                            EE_ASSERT( primitive.attributes[a].data->type == cgltf_type_vec4 );
+                    case cgltf_attribute_type_weights:
+                    {
+                        EE_ASSERT( primitive.attributes[a].data->type == cgltf_type_vec4 );
 
-                            for ( auto i = 0; i < numVertices; i++ )
+                        for ( auto i = 0; i < numVertices; i++ )
+                        {
+                            float weights[4] = { 0, 0, 0, 0 };
+                            // This should also support reading weights stored as normalized uints
+                            cgltf_accessor_read_float( primitive.attributes[a].data, i, weights, 4 );
+                            for ( auto w = 0; w < 4; w++ )
                             {
-                                float weights[4] = { 0, 0, 0, 0 };
-                                // This should also support reading weights stored as normalized uints
-                                cgltf_accessor_read_float( primitive.attributes[a].data, i, weights, 4 );
-                                for ( auto w = 0; w < 4; w++ )
-                                {
-                                    geometrySection.m_vertices[i].m_boneWeights.emplace_back( weights[w] );
-                                }
+                                geometrySection.m_vertices[i].m_boneWeights.emplace_back( weights[w] );
                             }
                         }
-                        break;
-
-                        default:
-                        break;
                     }
+                    break;
+
+                    default:
+                    break;
                 }
+            }
 
-                // Read indices
-                //-------------------------------------------------------------------------
+            // Read indices
+            //-------------------------------------------------------------------------
 
-                if ( primitive.indices->component_type == cgltf_component_type_r_16u )
+            if ( primitive.indices->component_type == cgltf_component_type_r_16u )
+            {
+                for ( auto i = 0; i < primitive.indices->count; i++ )
                 {
-                    for ( auto i = 0; i < primitive.indices->count; i++ )
-                    {
-                        geometrySection.m_indices.emplace_back( (uint16_t) cgltf_accessor_read_index( primitive.indices, i ) );
-                    }
+                    geometrySection.m_indices.emplace_back( (uint16_t) cgltf_accessor_read_index( primitive.indices, i ) );
                 }
-                else if ( primitive.indices->component_type == cgltf_component_type_r_32u )
+            }
+            else if ( primitive.indices->component_type == cgltf_component_type_r_32u )
+            {
+                for ( auto i = 0; i < primitive.indices->count; i++ )
                 {
-                    for ( auto i = 0; i < primitive.indices->count; i++ )
-                    {
-                        geometrySection.m_indices.emplace_back( (uint32_t) cgltf_accessor_read_index( primitive.indices, i ) );
-                    }
+                    geometrySection.m_indices.emplace_back( (uint32_t) cgltf_accessor_read_index( primitive.indices, i ) );
                 }
-                else
+            }
+            else
+            {
+                EE_HALT();
+            }
+        }
+
+        // Convert all the geometry sections (vertex attributes, skin weights and indices), the sections are independent so we convert them in parallel when we have a task system
+        static void ReadGeometrySections( gltf::SceneContext const& ctx, gltfRawMesh& rawMesh, TVector<cgltf_primitive const*> const& sectionPrimitives, TaskSystem* pTaskSystem )
+        {
+            EE_ASSERT( rawMesh.m_geometrySections.size() == sectionPrimitives.size() );
+
+            if ( pTaskSystem == nullptr || sectionPrimitives.size() < 2 )
+            {
+                for ( auto i = 0u; i < sectionPrimitives.size(); i++ )
                 {
-                    EE_HALT();
+                    ReadPrimitiveGeometry( ctx, *sectionPrimitives[i], rawMesh.m_geometrySections[i] );
                 }
+
+                return;
             }
+
+            //-------------------------------------------------------------------------
+
+            struct GeometryConversionTask final : public ITaskSet
+            {
+                GeometryConversionTask( gltf::SceneContext const& ctx, gltfRawMesh& rawMesh, TVector<cgltf_primitive const*> const& sectionPrimitives )
+                    : m_ctx( ctx )
+                    , m_rawMesh( rawMesh )
+                    , m_sectionPrimitives( sectionPrimitives )
+                {
+                    m_SetSize = (uint32_t) sectionPrimitives.size();
+                }
+
+                virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+                {
+                    for ( uint64_t i = range.start; i < range.end; ++i )
+                    {
+                        ReadPrimitiveGeometry( m_ctx, *m_sectionPrimitives[i], m_rawMesh.m_geometrySections[i] );
+                    }
+                }
+
+            private:
+
+                gltf::SceneContext const&                   m_ctx;
+                gltfRawMesh&                                m_rawMesh;
+                TVector<cgltf_primitive const*> const&      m_sectionPrimitives;
+            };
+
+            GeometryConversionTask conversionTask( ctx, rawMesh, sectionPrimitives );
+            pTaskSystem->ScheduleTask( &conversionTask );
+            pTaskSystem->WaitForTask( &conversionTask );
         }
 
         static TVector<SkinInfo> GetSkeletalMeshDefitions( gltf::SceneContext const& ctx )
@@ -702,7 +756,7 @@ namespace EE::gltf
 
         //-------------------------------------------------------------------------
 
-        static TUniquePtr<RawMesh> ReadStaticMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude )
+        static TUniquePtr<RawMesh> ReadStaticMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude, Blob const* pSourceFileData, TaskSystem* pTaskSystem )
         {
             EE_ASSERT( sourceFilePath.IsValid() );
 
@@ -711,9 +765,11 @@ namespace EE::gltf
 
             //-------------------------------------------------------------------------
 
-            gltf::SceneContext sceneCtx( sourceFilePath );
+            gltf::SceneContext sceneCtx( sourceFilePath, pSourceFileData );
             if ( sceneCtx.IsValid() )
             {
+                TVector<cgltf_primitive const*> sectionPrimitives;
+
                 auto pSceneData = sceneCtx.GetSceneData();
                 if ( meshesToInclude.empty() )
                 {
@@ -721,7 +777,7 @@ namespace EE::gltf
                     {
                         if ( IsValidTriangleMesh( pSceneData->meshes[m] ) )
                         {
-                            ReadMeshGeometry( sceneCtx, *pRawMesh, pSceneData->meshes[m] );
+                            AddGeometrySections( *pRawMesh, pSceneData->meshes[m], sectionPrimitives );
                         }
                         else
                         {
@@ -738,7 +794,7 @@ namespace EE::gltf
                         {
                             if ( IsValidTriangleMesh( pSceneData->meshes[m] ) )
                             {
-                                ReadMeshGeometry( sceneCtx, *pRawMesh, pSceneData->meshes[m] );
+                                AddGeometrySections( *pRawMesh, pSceneData->meshes[m], sectionPrimitives );
                             }
                             else
                             {
@@ -762,6 +818,8 @@ namespace EE::gltf
                         pRawMesh->LogError( "Failed to find any of the specified meshes in gltf file: %s", meshNames.c_str() );
                     }
                 }
+
+                ReadGeometrySections( sceneCtx, *pRawMesh, sectionPrimitives, pTaskSystem );
             }
             else
             {
@@ -771,7 +829,7 @@ namespace EE::gltf
             return pMesh;
         }
 
-        static TUniquePtr<RawMesh> ReadSkeletalMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude, int32_t maxBoneInfluences = 4 )
+        static TUniquePtr<RawMesh> ReadSkeletalMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude, int32_t maxBoneInfluences, Blob const* pSourceFileData, TaskSystem* pTaskSystem )
         {
             EE_ASSERT( sourceFilePath.IsValid() );
 
@@ -781,7 +839,7 @@ namespace EE::gltf
 
             //-------------------------------------------------------------------------
 
-            gltf::SceneContext sceneCtx( sourceFilePath );
+            gltf::SceneContext sceneCtx( sourceFilePath, pSourceFileData );
             if ( sceneCtx.IsValid() )
             {
                 TVector<SkinInfo> skins = GetSkeletalMeshDefitions( sceneCtx );
@@ -831,6 +889,7 @@ namespace EE::gltf
                         rawSkeleton.CalculateGlobalTransforms();
                     }
 
+                    TVector<cgltf_primitive const*> sectionPrimitives;
                     for ( auto pMeshData : skins[0].m_meshes )
                     {
                         if ( !meshesToInclude.empty() )
@@ -841,8 +900,10 @@ namespace EE::gltf
                             }
                         }
 
-                        ReadMeshGeometry( sceneCtx, *pRawMesh, *pMeshData );
+                        AddGeometrySections( *pRawMesh, *pMeshData, sectionPrimitives );
                     }
+
+                    ReadGeometrySections( sceneCtx, *pRawMesh, sectionPrimitives, pTaskSystem );
                 }
             }
             else
@@ -856,13 +917,13 @@ namespace EE::gltf
 
     //-------------------------------------------------------------------------
 
-    TUniquePtr<RawMesh> ReadStaticMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude )
+    TUniquePtr<RawMesh> ReadStaticMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude, Blob const* pSourceFileData, TaskSystem* pTaskSystem )
     {
-        return gltfMeshFileReader::ReadStaticMesh( sourceFilePath, meshesToInclude );
+        return gltfMeshFileReader::ReadStaticMesh( sourceFilePath, meshesToInclude, pSourceFileData, pTaskSystem );
     }
 
-    TUniquePtr<RawMesh> ReadSkeletalMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude, int32_t maxBoneInfluences )
+    TUniquePtr<RawMesh> ReadSkeletalMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude, int32_t maxBoneInfluences, Blob const* pSourceFileData, TaskSystem* pTaskSystem )
     {
-        return gltfMeshFileReader::ReadSkeletalMesh( sourceFilePath, meshesToInclude, maxBoneInfluences );
+        return gltfMeshFileReader::ReadSkeletalMesh( sourceFilePath, meshesToInclude, maxBoneInfluences, pSourceFileData, pTaskSystem );
     }
 }
\ No newline at end of file
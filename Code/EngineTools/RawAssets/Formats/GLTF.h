@@ -5,9 +5,15 @@
 #include "Base/FileSystem/FileSystemPath.h"
 #include "Base/Math/Transform.h"
 #include "Base/Memory/Pointers.h"
+#include "Base/Types/Arrays.h"
 
 //-------------------------------------------------------------------------
 
+namespace EE
+{
+    class TaskSystem;
+}
+
 namespace EE::RawAssets
 {
     class RawMesh;
@@ -35,6 +41,10 @@ namespace EE::gltf
 
         SceneContext() = default;
         SceneContext( FileSystem::Path const& filePath, float additionalScalingFactor = 1.0f );
+
+        // Parse the scene from an already loaded copy of the file (if set), the scene references this data so it needs to outlive the context
+        SceneContext( FileSystem::Path const& filePath, Blob const* pFileData, float additionalScalingFactor = 1.0f );
+
         ~SceneContext();
 
         void LoadFile( FileSystem::Path const& filePath, float additionalScalingFactor = 1.0f );
@@ -127,7 +137,7 @@ namespace EE::gltf
 
     private:
 
-        void Initialize( FileSystem::Path const& filePath, float additionalScalingFactor );
+        void Initialize( FileSystem::Path const& filePath, Blob const* pFileData, float additionalScalingFactor );
         void Shutdown();
 
     private:
@@ -142,9 +152,11 @@ namespace EE::gltf
     //-------------------------------------------------------------------------
     // Import Functions
     //-------------------------------------------------------------------------
+    // Optional: 'pSourceFileData' is an already loaded copy of the source file, the file is read from disk if it isnt set
+    // Optional: 'pTaskSystem' is used to convert the mesh geometry sections in parallel
 
-    EE_ENGINETOOLS_API TUniquePtr<RawAssets::RawSkeleton> ReadSkeleton( FileSystem::Path const& sourceFilePath, String const& skeletonRootBoneName );
-    EE_ENGINETOOLS_API TUniquePtr<RawAssets::RawAnimation> ReadAnimation( FileSystem::Path const& animationFilePath, RawAssets::RawSkeleton const& rawSkeleton, String const& animationName = String() );
-    EE_ENGINETOOLS_API TUniquePtr<RawAssets::RawMesh> ReadStaticMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude );
-    EE_ENGINETOOLS_API TUniquePtr<RawAssets::RawMesh> ReadSkeletalMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude, int32_t maxBoneInfluences );
+    EE_ENGINETOOLS_API TUniquePtr<RawAssets::RawSkeleton> ReadSkeleton( FileSystem::Path const& sourceFilePath, String const& skeletonRootBoneName, Blob const* pSourceFileData = nullptr );
+    EE_ENGINETOOLS_API TUniquePtr<RawAssets::RawAnimation> ReadAnimation( FileSystem::Path const& animationFilePath, RawAssets::RawSkeleton const& rawSkeleton, String const& animationName = String(), Blob const* pSourceFileData = nullptr );
+    EE_ENGINETOOLS_API TUniquePtr<RawAssets::RawMesh> ReadStaticMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude, Blob const* pSourceFileData = nullptr, TaskSystem* pTaskSystem = nullptr );
+    EE_ENGINETOOLS_API TUniquePtr<RawAssets::RawMesh> ReadSkeletalMesh( FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude, int32_t maxBoneInfluences, Blob const* pSourceFileData = nullptr, TaskSystem* pTaskSystem = nullptr );
 }
\ No newline at end of file
@@ -14,11 +14,15 @@ namespace EE::RawAssets
 {
     class EE_ENGINETOOLS_API RawAnimation : public RawAsset
     {
+        // Note: the skeleton is not serialized, animations are always read against an existing skeleton
+        EE_SERIALIZE( EE_SERIALIZE_BASE( RawAsset ), m_samplingFrameRate, m_duration, m_numFrames, m_tracks, m_rootTransforms, m_isAdditive );
 
     public:
 
         struct TrackData
         {
+            EE_SERIALIZE( m_localTransforms, m_globalTransforms, m_translationValueRangeX, m_translationValueRangeY, m_translationValueRangeZ, m_scaleValueRange, m_isRotationConstant );
+
             TVector<Transform>                 m_localTransforms; // Ground truth transforms
             TVector<Transform>                 m_globalTransforms; // Generated from the local transforms
             FloatRange                         m_translationValueRangeX;
@@ -5,6 +5,7 @@
 #include "Base/Math/Matrix.h"
 #include "Base/Types/String.h"
 #include "Base/Types/StringID.h"
+#include "Base/Serialization/BinarySerialization.h"
 
 //-------------------------------------------------------------------------
 
@@ -12,6 +13,7 @@ namespace EE::RawAssets
 {
     class EE_ENGINETOOLS_API RawAsset
     {
+        EE_SERIALIZE( m_warnings, m_errors );
 
     public:
 
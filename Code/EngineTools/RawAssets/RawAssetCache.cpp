@@ -0,0 +1,110 @@
+#include "RawAssetCache.h"
+#include "Base/FileSystem/FileSystem.h"
+#include "Base/Encoding/Hash.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::RawAssets
+{
+    RawAssetCacheKey::RawAssetCacheKey( AssetType type, FileSystem::Path const& sourceFilePath, Blob const& sourceFileData )
+    {
+        EE_ASSERT( sourceFilePath.IsValid() );
+
+        // Only self contained source files can be cached, since we only hash the contents of the source file itself (i.e. not external gltf buffers)
+        auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
+        if ( extension != "fbx" && extension != "glb" )
+        {
+            return;
+        }
+
+        if ( sourceFileData.empty() )
+        {
+            return;
+        }
+
+        m_keyData.emplace_back( s_version );
+        m_keyData.emplace_back( (uint64_t) type );
+        m_keyData.emplace_back( Hash::XXHash::GetHash64( sourceFileData ) );
+        m_isValid = true;
+    }
+
+    void RawAssetCacheKey::Add( String const& string )
+    {
+        m_keyData.emplace_back( Hash::XXHash::GetHash64( string ) );
+    }
+
+    void RawAssetCacheKey::Add( TVector<String> const& strings )
+    {
+        m_keyData.emplace_back( strings.size() );
+        for ( auto const& string : strings )
+        {
+            Add( string );
+        }
+    }
+
+    uint64_t RawAssetCacheKey::GetKey() const
+    {
+        EE_ASSERT( m_isValid );
+        return Hash::XXHash::GetHash64( m_keyData.data(), m_keyData.size() * sizeof( uint64_t ) );
+    }
+
+    //-------------------------------------------------------------------------
+
+    FileSystem::Path RawAssetCache::GetEntryFilePath( RawAssetCacheKey const& key ) const
+    {
+        TInlineString<32> const fileName( TInlineString<32>::CtorSprintf(), "%016llx.rawasset", key.GetKey() );
+        return m_cacheDirectoryPath + fileName.c_str();
+    }
+
+    bool RawAssetCache::TryReadEntry( RawAssetCacheKey const& key, Blob& outPayload ) const
+    {
+        EE_ASSERT( IsValid() && key.IsValid() );
+
+        FileSystem::Path const entryFilePath = GetEntryFilePath( key );
+        if ( !FileSystem::Exists( entryFilePath ) )
+        {
+            return false;
+        }
+
+        Blob fileData;
+        if ( !FileSystem::LoadFile( entryFilePath, fileData ) || fileData.size() <= sizeof( uint64_t ) )
+        {
+            return false;
+        }
+
+        // Validate payload
+        //-------------------------------------------------------------------------
+
+        uint64_t payloadHash = 0;
+        memcpy( &payloadHash, fileData.data(), sizeof( uint64_t ) );
+
+        uint8_t const* pPayloadData = fileData.data() + sizeof( uint64_t );
+        size_t const payloadSize = fileData.size() - sizeof( uint64_t );
+        if ( Hash::XXHash::GetHash64( pPayloadData, payloadSize ) != payloadHash )
+        {
+            return false;
+        }
+
+        outPayload.assign( pPayloadData, pPayloadData + payloadSize );
+        return true;
+    }
+
+    bool RawAssetCache::WriteEntry( RawAssetCacheKey const& key, Blob const& payload ) const
+    {
+        EE_ASSERT( IsValid() && key.IsValid() );
+
+        FileSystem::Path const entryFilePath = GetEntryFilePath( key );
+        if ( !entryFilePath.EnsureDirectoryExists() )
+        {
+            return false;
+        }
+
+        uint64_t const payloadHash = Hash::XXHash::GetHash64( payload );
+
+        Blob fileData;
+        fileData.resize( sizeof( uint64_t ) + payload.size() );
+        memcpy( fileData.data(), &payloadHash, sizeof( uint64_t ) );
+        memcpy( fileData.data() + sizeof( uint64_t ), payload.data(), payload.size() );
+        return FileSystem::SaveFile( entryFilePath, fileData );
+    }
+}
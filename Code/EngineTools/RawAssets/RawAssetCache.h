@@ -0,0 +1,106 @@
+#pragma once
+
+#include "EngineTools/_Module/API.h"
+#include "Base/FileSystem/FileSystemPath.h"
+#include "Base/Serialization/BinarySerialization.h"
+#include "Base/Types/Arrays.h"
+#include "Base/Types/String.h"
+
+//-------------------------------------------------------------------------
+// Raw Asset Cache
+//-------------------------------------------------------------------------
+// A disk cache of the raw assets read from source files (FBX/GLB), so that a source file is only parsed once for all the resources that reference it
+//
+// Entries are keyed on the contents of the source file and the reader parameters, so they never need to be invalidated
+// Each entry stores a hash of its payload, so partially written entries (i.e. from concurrent compiler processes) are simply ignored
+
+namespace EE::RawAssets
+{
+    class EE_ENGINETOOLS_API RawAssetCacheKey
+    {
+    public:
+
+        // Bump this whenever the raw asset readers or the raw asset formats change
+        constexpr static uint64_t const s_version = 1;
+
+        enum class AssetType : uint8_t
+        {
+            StaticMesh,
+            SkeletalMesh,
+            Skeleton,
+            Animation,
+        };
+
+    public:
+
+        RawAssetCacheKey() = default;
+        RawAssetCacheKey( AssetType type, FileSystem::Path const& sourceFilePath, Blob const& sourceFileData );
+
+        // Is this a valid key, this will be false for unsupported or unreadable source files
+        inline bool IsValid() const { return m_isValid; }
+
+        void Add( uint64_t value ) { m_keyData.emplace_back( value ); }
+        void Add( String const& string );
+        void Add( TVector<String> const& strings );
+
+        uint64_t GetKey() const;
+
+    private:
+
+        TVector<uint64_t>                   m_keyData;
+        bool                                m_isValid = false;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINETOOLS_API RawAssetCache
+    {
+    public:
+
+        RawAssetCache( FileSystem::Path const& cacheDirectoryPath ) : m_cacheDirectoryPath( cacheDirectoryPath ) {}
+
+        inline bool IsValid() const { return m_cacheDirectoryPath.IsValid(); }
+
+        // Create a key from the loaded contents of a source file, returns an invalid key if the cache is disabled
+        inline RawAssetCacheKey CreateKey( RawAssetCacheKey::AssetType type, FileSystem::Path const& sourceFilePath, Blob const& sourceFileData ) const
+        {
+            return IsValid() ? RawAssetCacheKey( type, sourceFilePath, sourceFileData ) : RawAssetCacheKey();
+        }
+
+        template<typename T>
+        bool TryLoad( RawAssetCacheKey const& key, T& outRawAsset ) const
+        {
+            Blob payload;
+            if ( !TryReadEntry( key, payload ) )
+            {
+                return false;
+            }
+
+            Serialization::BinaryInputArchive archive;
+            archive.ReadFromBlob( payload );
+            archive << outRawAsset;
+            return true;
+        }
+
+        template<typename T>
+        bool Save( RawAssetCacheKey const& key, T const& rawAsset ) const
+        {
+            Serialization::BinaryOutputArchive archive;
+            archive << rawAsset;
+
+            Blob payload;
+            archive.GetAsBinaryBlob( payload );
+            return WriteEntry( key, payload );
+        }
+
+    private:
+
+        FileSystem::Path GetEntryFilePath( RawAssetCacheKey const& key ) const;
+        bool TryReadEntry( RawAssetCacheKey const& key, Blob& outPayload ) const;
+        bool WriteEntry( RawAssetCacheKey const& key, Blob const& payload ) const;
+
+    private:
+
+        FileSystem::Path                    m_cacheDirectoryPath;
+    };
+}
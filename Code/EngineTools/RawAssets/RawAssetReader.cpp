@@ -3,7 +3,10 @@
 #include "RawSkeleton.h"
 #include "RawAnimation.h"
 #include "Formats/FBX.h"
+#include "RawAssetCache.h"
 #include "Formats/GLTF.h"
+#include "Base/Encoding/Hash.h"
+#include "Base/FileSystem/FileSystem.h"
 
 //-------------------------------------------------------------------------
 
@@ -29,28 +32,81 @@ namespace EE::RawAssets
         return false;
     }
 
-    //-------------------------------------------------------------------------
-
-    TUniquePtr<RawMesh> ReadStaticMesh( ReaderContext const& ctx, FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude )
+    template<typename T>
+    static bool TryLoadFromCache( RawAssetCache const& cache, RawAssetCacheKey const& cacheKey, TUniquePtr<T>& pRawAsset )
     {
-        EE_ASSERT( sourceFilePath.IsValid() && ctx.IsValid() );
+        EE_ASSERT( pRawAsset != nullptr );
+
+        if ( cacheKey.IsValid() && cache.TryLoad( cacheKey, *pRawAsset ) )
+        {
+            return true;
+        }
 
-        TUniquePtr<RawMesh> pRawMesh = nullptr;
+        pRawAsset = nullptr;
+        return false;
+    }
 
+    // Only successfully read assets are cached, so that errors are always reported against the source file
+    template<typename T>
+    static void SaveToCache( RawAssetCache const& cache, RawAssetCacheKey const& cacheKey, TUniquePtr<T> const& pRawAsset )
+    {
+        if ( cacheKey.IsValid() && pRawAsset != nullptr && !pRawAsset->HasErrors() )
+        {
+            cache.Save( cacheKey, *pRawAsset );
+        }
+    }
+
+    // Self contained source files are only loaded once, the cache key is hashed from the same data that the format readers then parse
+    static Blob const* LoadSourceFile( FileSystem::Path const& sourceFilePath, Blob& outSourceFileData )
+    {
         auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
-        if ( extension == "fbx" )
+        if ( extension != "fbx" && extension != "glb" )
         {
-            pRawMesh = Fbx::ReadStaticMesh( sourceFilePath, meshesToInclude );
+            return nullptr;
         }
-        else if ( extension == "gltf" || extension == "glb" )
+
+        if ( !FileSystem::LoadFile( sourceFilePath, outSourceFileData ) )
         {
-            pRawMesh = gltf::ReadStaticMesh( sourceFilePath, meshesToInclude );
+            outSourceFileData.clear();
+            return nullptr;
         }
-        else
+
+        return &outSourceFileData;
+    }
+
+    //-------------------------------------------------------------------------
+
+    TUniquePtr<RawMesh> ReadStaticMesh( ReaderContext const& ctx, FileSystem::Path const& sourceFilePath, TVector<String> const& meshesToInclude )
+    {
+        EE_ASSERT( sourceFilePath.IsValid() && ctx.IsValid() );
+
+        Blob sourceFileData;
+        Blob const* pSourceFileData = LoadSourceFile( sourceFilePath, sourceFileData );
+
+        RawAssetCache const cache( ctx.m_cacheDirectoryPath );
+        RawAssetCacheKey cacheKey = cache.CreateKey( RawAssetCacheKey::AssetType::StaticMesh, sourceFilePath, sourceFileData );
+        cacheKey.Add( meshesToInclude );
+
+        TUniquePtr<RawMesh> pRawMesh( EE::New<RawMesh>() );
+        if ( !TryLoadFromCache( cache, cacheKey, pRawMesh ) )
         {
-            char buffer[512];
-            Printf( buffer, 512, "unsupported extension: %s", sourceFilePath.c_str() );
-            ctx.m_errorDelegate( buffer );
+            auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
+            if ( extension == "fbx" )
+            {
+                pRawMesh = Fbx::ReadStaticMesh( sourceFilePath, meshesToInclude, pSourceFileData );
+            }
+            else if ( extension == "gltf" || extension == "glb" )
+            {
+                pRawMesh = gltf::ReadStaticMesh( sourceFilePath, meshesToInclude, pSourceFileData, ctx.m_pTaskSystem );
+            }
+            else
+            {
+                char buffer[512];
+                Printf( buffer, 512, "unsupported extension: %s", sourceFilePath.c_str() );
+                ctx.m_errorDelegate( buffer );
+            }
+
+            SaveToCache( cache, cacheKey, pRawMesh );
         }
 
         //-------------------------------------------------------------------------
@@ -69,22 +125,34 @@ namespace EE::RawAssets
     {
         EE_ASSERT( sourceFilePath.IsValid() && ctx.IsValid() );
 
-        TUniquePtr<RawMesh> pRawMesh = nullptr;
+        Blob sourceFileData;
+        Blob const* pSourceFileData = LoadSourceFile( sourceFilePath, sourceFileData );
 
-        auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
-        if ( extension == "fbx" )
-        {
-            pRawMesh = Fbx::ReadSkeletalMesh( sourceFilePath, meshesToInclude, maxBoneInfluences );
-        }
-        else if ( extension == "gltf" || extension == "glb" )
-        {
-            pRawMesh = gltf::ReadSkeletalMesh( sourceFilePath, meshesToInclude, maxBoneInfluences );
-        }
-        else
+        RawAssetCache const cache( ctx.m_cacheDirectoryPath );
+        RawAssetCacheKey cacheKey = cache.CreateKey( RawAssetCacheKey::AssetType::SkeletalMesh, sourceFilePath, sourceFileData );
+        cacheKey.Add( meshesToInclude );
+        cacheKey.Add( (uint64_t) maxBoneInfluences );
+
+        TUniquePtr<RawMesh> pRawMesh( EE::New<RawMesh>() );
+        if ( !TryLoadFromCache( cache, cacheKey, pRawMesh ) )
         {
-            char buffer[512];
-            Printf( buffer, 512, "unsupported extension: %s", sourceFilePath.c_str() );
-            ctx.m_errorDelegate( buffer );
+            auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
+            if ( extension == "fbx" )
+            {
+                pRawMesh = Fbx::ReadSkeletalMesh( sourceFilePath, meshesToInclude, maxBoneInfluences, pSourceFileData, ctx.m_pTaskSystem );
+            }
+            else if ( extension == "gltf" || extension == "glb" )
+            {
+                pRawMesh = gltf::ReadSkeletalMesh( sourceFilePath, meshesToInclude, maxBoneInfluences, pSourceFileData, ctx.m_pTaskSystem );
+            }
+            else
+            {
+                char buffer[512];
+                Printf( buffer, 512, "unsupported extension: %s", sourceFilePath.c_str() );
+                ctx.m_errorDelegate( buffer );
+            }
+
+            SaveToCache( cache, cacheKey, pRawMesh );
         }
 
         //-------------------------------------------------------------------------
@@ -103,22 +171,34 @@ namespace EE::RawAssets
     {
         EE_ASSERT( sourceFilePath.IsValid() && ctx.IsValid() );
 
-        TUniquePtr<RawSkeleton> pRawSkeleton = nullptr;
+        Blob sourceFileData;
+        Blob const* pSourceFileData = LoadSourceFile( sourceFilePath, sourceFileData );
 
-        auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
-        if ( extension == "fbx" )
-        {
-            pRawSkeleton = Fbx::ReadSkeleton( sourceFilePath, skeletonRootBoneName );
-        }
-        else if ( extension == "gltf" || extension == "glb" )
-        {
-            pRawSkeleton = gltf::ReadSkeleton( sourceFilePath, skeletonRootBoneName );
-        }
-        else
+        // The cached skeleton is the one read from the source file, the LOD setup is always applied afterwards
+        RawAssetCache const cache( ctx.m_cacheDirectoryPath );
+        RawAssetCacheKey cacheKey = cache.CreateKey( RawAssetCacheKey::AssetType::Skeleton, sourceFilePath, sourceFileData );
+        cacheKey.Add( skeletonRootBoneName );
+
+        TUniquePtr<RawSkeleton> pRawSkeleton( EE::New<RawSkeleton>() );
+        if ( !TryLoadFromCache( cache, cacheKey, pRawSkeleton ) )
         {
-            char buffer[512];
-            Printf( buffer, 512, "unsupported extension: %s", sourceFilePath.c_str() );
-            ctx.m_errorDelegate( buffer );
+            auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
+            if ( extension == "fbx" )
+            {
+                pRawSkeleton = Fbx::ReadSkeleton( sourceFilePath, skeletonRootBoneName, pSourceFileData );
+            }
+            else if ( extension == "gltf" || extension == "glb" )
+            {
+                pRawSkeleton = gltf::ReadSkeleton( sourceFilePath, skeletonRootBoneName, pSourceFileData );
+            }
+            else
+            {
+                char buffer[512];
+                Printf( buffer, 512, "unsupported extension: %s", sourceFilePath.c_str() );
+                ctx.m_errorDelegate( buffer );
+            }
+
+            SaveToCache( cache, cacheKey, pRawSkeleton );
         }
 
         pRawSkeleton->Finalize( listOfHighLODBones );
@@ -139,22 +219,44 @@ namespace EE::RawAssets
     {
         EE_ASSERT( ctx.IsValid() && sourceFilePath.IsValid() && rawSkeleton.IsValid() );
 
-        TUniquePtr<RawAnimation> pRawAnimation = nullptr;
+        Blob sourceFileData;
+        Blob const* pSourceFileData = LoadSourceFile( sourceFilePath, sourceFileData );
 
-        auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
-        if ( extension == "fbx" )
-        {
-            pRawAnimation = Fbx::ReadAnimation( sourceFilePath, rawSkeleton, animationName );
-        }
-        else if ( extension == "gltf" || extension == "glb" )
+        // The track data depends on the skeleton the animation is read against, so the skeleton is part of the key
+        RawAssetCache const cache( ctx.m_cacheDirectoryPath );
+        RawAssetCacheKey cacheKey = cache.CreateKey( RawAssetCacheKey::AssetType::Animation, sourceFilePath, sourceFileData );
+        cacheKey.Add( animationName );
+
+        if ( cacheKey.IsValid() )
         {
-            pRawAnimation = gltf::ReadAnimation( sourceFilePath, rawSkeleton, animationName );
+            for ( auto const& boneData : rawSkeleton.GetBoneData() )
+            {
+                cacheKey.Add( (uint64_t) boneData.m_name.ToUint() );
+                cacheKey.Add( (uint64_t) boneData.m_parentBoneIdx );
+                cacheKey.Add( Hash::XXHash::GetHash64( &boneData.m_localTransform, sizeof( Transform ) ) );
+            }
         }
-        else
+
+        TUniquePtr<RawAnimation> pRawAnimation( EE::New<RawAnimation>( rawSkeleton ) );
+        if ( !TryLoadFromCache( cache, cacheKey, pRawAnimation ) )
         {
-            TInlineString<512> errorString;
-            errorString.sprintf( "unsupported extension: %s", sourceFilePath.c_str() );
-            ctx.m_errorDelegate( errorString.c_str() );
+            auto const extension = sourceFilePath.GetLowercaseExtensionAsString();
+            if ( extension == "fbx" )
+            {
+                pRawAnimation = Fbx::ReadAnimation( sourceFilePath, rawSkeleton, animationName, pSourceFileData );
+            }
+            else if ( extension == "gltf" || extension == "glb" )
+            {
+                pRawAnimation = gltf::ReadAnimation( sourceFilePath, rawSkeleton, animationName, pSourceFileData );
+            }
+            else
+            {
+                TInlineString<512> errorString;
+                errorString.sprintf( "unsupported extension: %s", sourceFilePath.c_str() );
+                ctx.m_errorDelegate( errorString.c_str() );
+            }
+
+            SaveToCache( cache, cacheKey, pRawAnimation );
         }
 
         //-------------------------------------------------------------------------
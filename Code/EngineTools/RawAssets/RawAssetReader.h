@@ -8,6 +8,11 @@
 
 //-------------------------------------------------------------------------
 
+namespace EE
+{
+    class TaskSystem;
+}
+
 namespace EE::RawAssets
 {
     class RawMesh;
@@ -22,6 +27,8 @@ namespace EE::RawAssets
 
         TFunction<void( char const* )>  m_warningDelegate;
         TFunction<void( char const* )>  m_errorDelegate;
+        FileSystem::Path                m_cacheDirectoryPath; // Optional: if set, raw assets are read from/written to a raw asset cache in this directory
+        TaskSystem*                     m_pTaskSystem = nullptr; // Optional: if set, mesh geometry is converted in parallel
     };
 
     //-------------------------------------------------------------------------
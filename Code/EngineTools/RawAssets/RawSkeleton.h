@@ -10,11 +10,15 @@ namespace EE::RawAssets
 {
     class EE_ENGINETOOLS_API RawSkeleton : public RawAsset
     {
+        EE_SERIALIZE( EE_SERIALIZE_BASE( RawAsset ), m_name, m_bones, m_numBonesToSampleAtLowLOD );
 
     public:
 
         struct BoneData
         {
+            EE_SERIALIZE( m_name, m_localTransform, m_globalTransform, m_parentBoneName, m_parentBoneIdx );
+
+            BoneData() = default;
             BoneData( const char* pName );
 
         public:
@@ -0,0 +1,31 @@
+#include "MeshTools.h"
+
+#include <MeshOptimizer.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render
+{
+    float SimplifyTriangles( uint8_t const* pVertexData, size_t numVertices, size_t vertexStride, uint32_t const* pIndices, uint32_t numIndices, uint32_t targetNumIndices, float maxRelativeError, TVector<uint32_t>& outIndices )
+    {
+        EE_ASSERT( pVertexData != nullptr && numVertices > 0 && vertexStride >= sizeof( Float3 ) );
+        EE_ASSERT( ( numIndices % 3 ) == 0 && targetNumIndices <= numIndices && maxRelativeError >= 0.0f );
+
+        outIndices.clear();
+
+        if ( numIndices == 0 )
+        {
+            return 0.0f;
+        }
+
+        float const* pPositions = (float const*) pVertexData;
+
+        outIndices.resize( numIndices );
+        float relativeError = 0.0f;
+        size_t const numSimplifiedIndices = meshopt_simplify( outIndices.data(), pIndices, numIndices, pPositions, numVertices, vertexStride, targetNumIndices, maxRelativeError, 0, &relativeError );
+        outIndices.resize( numSimplifiedIndices );
+
+        // Convert the error to mesh space units
+        return relativeError * meshopt_simplifyScale( pPositions, numVertices, vertexStride );
+    }
+}
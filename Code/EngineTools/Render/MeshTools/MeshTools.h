@@ -0,0 +1,25 @@
+#pragma once
+
+#include "EngineTools/_Module/API.h"
+#include "Engine/Render/Mesh/RenderMesh.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render
+{
+    struct MeshletSettings
+    {
+        uint32_t                            m_maxVertices = 64;
+        uint32_t                            m_maxTriangles = 124;
+        float                               m_coneWeight = 0.25f;       // [0,1] Trades spatial locality for tighter normal cones (i.e. better backface culling)
+    };
+
+    // Simplify a range of triangles to (at most) the target index count
+    // The simplification stops early if the max error (relative to the size of the mesh) would be exceeded
+    // Returns the simplification error in mesh space units
+    EE_ENGINETOOLS_API float SimplifyTriangles( uint8_t const* pVertexData, size_t numVertices, size_t vertexStride, uint32_t const* pIndices, uint32_t numIndices, uint32_t targetNumIndices, float maxRelativeError, TVector<uint32_t>& outIndices );
+
+    // Reorder a range of triangles into meshlets and calculate the meshlet culling data, the meshlets are appended to the output list
+    // Vertex positions are expected to be the first element of each vertex
+    EE_ENGINETOOLS_API void BuildMeshlets( uint8_t const* pVertexData, size_t numVertices, size_t vertexStride, TVector<uint32_t>& indices, uint32_t startIndex, uint32_t numIndices, TVector<Mesh::Meshlet>& outMeshlets, MeshletSettings const& settings = MeshletSettings() );
+}
@@ -0,0 +1,67 @@
+#include "MeshTools.h"
+
+#include <MeshOptimizer.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render
+{
+    void BuildMeshlets( uint8_t const* pVertexData, size_t numVertices, size_t vertexStride, TVector<uint32_t>& indices, uint32_t startIndex, uint32_t numIndices, TVector<Mesh::Meshlet>& outMeshlets, MeshletSettings const& settings )
+    {
+        EE_ASSERT( pVertexData != nullptr && numVertices > 0 && vertexStride >= sizeof( Float3 ) );
+        EE_ASSERT( ( startIndex + numIndices ) <= indices.size() && ( numIndices % 3 ) == 0 );
+        EE_ASSERT( settings.m_maxVertices <= 255 && settings.m_maxTriangles <= 512 );
+
+        if ( numIndices == 0 )
+        {
+            return;
+        }
+
+        float const* pPositions = (float const*) pVertexData;
+        uint32_t* pIndices = &indices[startIndex];
+
+        // Build meshlets
+        //-------------------------------------------------------------------------
+
+        size_t const maxMeshlets = meshopt_buildMeshletsBound( numIndices, settings.m_maxVertices, settings.m_maxTriangles );
+        TVector<meshopt_Meshlet> meshlets( maxMeshlets );
+        TVector<uint32_t> meshletVertices( maxMeshlets * settings.m_maxVertices );
+        TVector<uint8_t> meshletTriangles( maxMeshlets * settings.m_maxTriangles * 3 );
+
+        size_t const numMeshlets = meshopt_buildMeshlets( meshlets.data(), meshletVertices.data(), meshletTriangles.data(), pIndices, numIndices, pPositions, numVertices, vertexStride, settings.m_maxVertices, settings.m_maxTriangles, settings.m_coneWeight );
+
+        // Rewrite the index range in meshlet order and calculate the culling data
+        //-------------------------------------------------------------------------
+
+        TVector<uint32_t> reorderedIndices;
+        reorderedIndices.reserve( numIndices );
+
+        outMeshlets.reserve( outMeshlets.size() + numMeshlets );
+
+        for ( size_t i = 0; i < numMeshlets; i++ )
+        {
+            meshopt_Meshlet const& meshlet = meshlets[i];
+            uint32_t const* pMeshletVertices = &meshletVertices[meshlet.vertex_offset];
+            uint8_t const* pMeshletTriangles = &meshletTriangles[meshlet.triangle_offset];
+
+            Mesh::Meshlet& outMeshlet = outMeshlets.emplace_back();
+            outMeshlet.m_startIndex = startIndex + (uint32_t) reorderedIndices.size();
+            outMeshlet.m_numIndices = meshlet.triangle_count * 3;
+
+            for ( uint32_t j = 0; j < outMeshlet.m_numIndices; j++ )
+            {
+                reorderedIndices.emplace_back( pMeshletVertices[pMeshletTriangles[j]] );
+            }
+
+            meshopt_Bounds const bounds = meshopt_computeMeshletBounds( pMeshletVertices, pMeshletTriangles, meshlet.triangle_count, pPositions, numVertices, vertexStride );
+            outMeshlet.m_boundingSphereCenter = Float3( bounds.center[0], bounds.center[1], bounds.center[2] );
+            outMeshlet.m_boundingSphereRadius = bounds.radius;
+            outMeshlet.m_coneApex = Float3( bounds.cone_apex[0], bounds.cone_apex[1], bounds.cone_apex[2] );
+            outMeshlet.m_coneAxis = Float3( bounds.cone_axis[0], bounds.cone_axis[1], bounds.cone_axis[2] );
+            outMeshlet.m_coneCutoff = bounds.cone_cutoff;
+        }
+
+        EE_ASSERT( reorderedIndices.size() == numIndices );
+        memcpy( pIndices, reorderedIndices.data(), numIndices * sizeof( uint32_t ) );
+    }
+}
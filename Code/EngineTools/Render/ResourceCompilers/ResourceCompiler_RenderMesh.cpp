@@ -2,9 +2,11 @@
 #include "EngineTools/Render/ResourceDescriptors/ResourceDescriptor_RenderMesh.h"
 #include "EngineTools/RawAssets/RawMesh.h"
 #include "EngineTools/RawAssets/RawAssetReader.h"
+#include "EngineTools/Render/MeshTools/MeshTools.h"
 #include "Engine/Render/Mesh/StaticMesh.h"
 #include "Engine/Render/Mesh/SkeletalMesh.h"
 #include "Base/FileSystem/FileSystem.h"
+#include "Base/Render/RenderVertexCompression.h"
 #include "Base/Serialization/BinarySerialization.h"
 
 #include <MeshOptimizer.h>
@@ -146,7 +148,66 @@ namespace EE::Render
         mesh.m_bounds = OBB( meshAlignedBounds );
     }
 
-    void MeshCompiler::OptimizeMeshGeometry( Mesh& mesh ) const
+    void MeshCompiler::GenerateMeshLODs( MeshResourceDescriptor const& descriptor, Mesh& mesh ) const
+    {
+        EE_ASSERT( mesh.m_LODs.empty() );
+
+        int32_t const maxLODs = Math::Min( descriptor.m_numLODs, 15 );
+        if ( maxLODs <= 0 )
+        {
+            return;
+        }
+
+        size_t const vertexSize = (size_t) mesh.m_vertexBuffer.m_byteStride;
+        size_t const numVertices = (size_t) mesh.GetNumVertices();
+        float const triangleRatio = Math::Clamp( descriptor.m_LODTriangleRatio, 0.05f, 0.95f );
+
+        // Each LOD is simplified from the base mesh, so the errors are relative to the base mesh and not accumulated over the chain
+        //-------------------------------------------------------------------------
+
+        uint32_t const numBaseTriangles = (uint32_t) mesh.m_indices.size() / 3;
+        uint32_t numPreviousTriangles = numBaseTriangles;
+        float previousError = 0.0f;
+        float targetRatio = 1.0f;
+        TVector<uint32_t> simplifiedIndices;
+
+        for ( int32_t i = 0; i < maxLODs; i++ )
+        {
+            targetRatio *= triangleRatio;
+
+            Mesh::LOD LOD;
+            LOD.m_error = previousError;
+
+            uint32_t numLODTriangles = 0;
+            for ( auto const& baseSection : mesh.m_sections )
+            {
+                uint32_t const targetNumIndices = Math::Max( 3u, uint32_t( baseSection.m_numIndices / 3 * targetRatio ) * 3 );
+                float const error = SimplifyTriangles( mesh.m_vertices.data(), numVertices, vertexSize, &mesh.m_indices[baseSection.m_startIndex], baseSection.m_numIndices, Math::Min( targetNumIndices, baseSection.m_numIndices ), descriptor.m_maxLODError, simplifiedIndices );
+                LOD.m_error = Math::Max( LOD.m_error, error );
+
+                Mesh::GeometrySection& section = LOD.m_sections.emplace_back( baseSection.m_ID, (uint32_t) mesh.m_indices.size(), (uint32_t) simplifiedIndices.size() );
+                mesh.m_indices.insert( mesh.m_indices.end(), simplifiedIndices.begin(), simplifiedIndices.end() );
+                numLODTriangles += section.m_numIndices / 3;
+            }
+
+            // Stop once the error limit prevents any meaningful reduction, the LOD would just be a copy of the previous one
+            if ( numLODTriangles > numPreviousTriangles * 0.95f )
+            {
+                mesh.m_indices.resize( LOD.m_sections.front().m_startIndex );
+                break;
+            }
+
+            Message( "LOD %d: %u triangles (%.1f%%), error: %f", i + 1, numLODTriangles, 100.0f * numLODTriangles / numBaseTriangles, LOD.m_error );
+
+            previousError = LOD.m_error;
+            numPreviousTriangles = numLODTriangles;
+            mesh.m_LODs.emplace_back( eastl::move( LOD ) );
+        }
+
+        mesh.m_indexBuffer.m_byteSize = (uint32_t) mesh.m_indices.size() * sizeof( uint32_t );
+    }
+
+    void MeshCompiler::OptimizeMeshGeometry( Mesh& mesh, bool generateMeshlets ) const
     {
         size_t const vertexSize = (size_t) mesh.m_vertexBuffer.m_byteStride;
         size_t const numVertices = (size_t) mesh.GetNumVertices();
@@ -160,10 +221,77 @@ namespace EE::Render
             meshopt_optimizeOverdraw( &mesh.m_indices[section.m_startIndex], &mesh.m_indices[section.m_startIndex], section.m_numIndices, (float*) &mesh.m_vertices[0], numVertices, vertexSize, kThreshold );
         }
 
+        // LODs only get the vertex cache optimization, since they are only used when the mesh is small on screen
+        for ( auto const& LOD : mesh.m_LODs )
+        {
+            for ( auto const& section : LOD.m_sections )
+            {
+                if ( section.m_numIndices > 0 )
+                {
+                    meshopt_optimizeVertexCache( &mesh.m_indices[section.m_startIndex], &mesh.m_indices[section.m_startIndex], section.m_numIndices, numVertices );
+                }
+            }
+        }
+
+        // Split sections into meshlets, this reorders the section triangles but the meshlets are built from the cache-optimized order so locality is mostly retained
+        if ( generateMeshlets )
+        {
+            for ( auto& section : mesh.m_sections )
+            {
+                section.m_startMeshlet = (uint32_t) mesh.m_meshlets.size();
+                BuildMeshlets( mesh.m_vertices.data(), numVertices, vertexSize, mesh.m_indices, section.m_startIndex, section.m_numIndices, mesh.m_meshlets );
+                section.m_numMeshlets = (uint32_t) mesh.m_meshlets.size() - section.m_startMeshlet;
+            }
+        }
+
         // Vertex fetch optimization should go last as it depends on the final index order
         meshopt_optimizeVertexFetch( &mesh.m_vertices[0], &mesh.m_indices[0], mesh.m_indices.size(), &mesh.m_vertices[0], numVertices, vertexSize );
     }
 
+    void MeshCompiler::CompressMeshVertices( Mesh& mesh ) const
+    {
+        EE_ASSERT( !IsCompressedVertexFormat( mesh.m_vertexBuffer.m_vertexFormat ) );
+
+        size_t const vertexSize = (size_t) mesh.m_vertexBuffer.m_byteStride;
+        size_t const numVertices = (size_t) mesh.GetNumVertices();
+        if ( numVertices == 0 )
+        {
+            return;
+        }
+
+        // Quantize positions to the vertex bounds, sections share the vertex buffer so we cant use per-section ranges
+        //-------------------------------------------------------------------------
+
+        Float3 min( FLT_MAX );
+        Float3 max( -FLT_MAX );
+        for ( size_t i = 0; i < numVertices; i++ )
+        {
+            Float4 const& position = reinterpret_cast<StaticMeshVertex const*>( &mesh.m_vertices[i * vertexSize] )->m_position;
+            min = Float3( Math::Min( min.m_x, position.m_x ), Math::Min( min.m_y, position.m_y ), Math::Min( min.m_z, position.m_z ) );
+            max = Float3( Math::Max( max.m_x, position.m_x ), Math::Max( max.m_y, position.m_y ), Math::Max( max.m_z, position.m_z ) );
+        }
+
+        mesh.m_vertexPositionRange = VertexCompression::QuantizationRange( min, max );
+
+        // Compress
+        //-------------------------------------------------------------------------
+
+        size_t const uncompressedVertexBufferSize = mesh.m_vertices.size();
+        size_t const uncompressedMeshSize = uncompressedVertexBufferSize + mesh.m_indices.size() * sizeof( uint32_t );
+
+        Blob compressedVertices;
+        VertexFormat const compressedFormat = VertexCompression::CompressVertices( mesh.m_vertexBuffer.m_vertexFormat, mesh.m_vertices.data(), numVertices, mesh.m_vertexPositionRange, compressedVertices );
+
+        mesh.m_vertices.swap( compressedVertices );
+        mesh.m_vertexBuffer.m_vertexFormat = compressedFormat;
+        mesh.m_vertexBuffer.m_byteStride = VertexLayoutRegistry::GetDescriptorForFormat( compressedFormat ).m_byteSize;
+        mesh.m_vertexBuffer.m_byteSize = (uint32_t) mesh.m_vertices.size();
+        EE_ASSERT( mesh.m_vertexBuffer.m_byteSize == mesh.m_vertexBuffer.m_byteStride * numVertices );
+
+        size_t const compressedMeshSize = mesh.m_vertices.size() + mesh.m_indices.size() * sizeof( uint32_t );
+        Message( "Compressed vertices: %u -> %u bytes per vertex, vertex data: %.1f KB -> %.1f KB, mesh data: %.1f KB -> %.1f KB (%.1f%%)", (uint32_t) vertexSize, mesh.m_vertexBuffer.m_byteStride, uncompressedVertexBufferSize / 1024.0f, mesh.m_vertices.size() / 1024.0f, uncompressedMeshSize / 1024.0f, compressedMeshSize / 1024.0f, 100.0f * compressedMeshSize / uncompressedMeshSize );
+    }
+
     void MeshCompiler::SetMeshDefaultMaterials( MeshResourceDescriptor const& descriptor, Mesh& mesh ) const
     {
         mesh.m_materials.reserve( mesh.GetNumSections() );
@@ -243,7 +371,7 @@ namespace EE::Render
             return Error( "Invalid mesh data path: %s", resourceDescriptor.m_meshPath.c_str() );
         }
 
-        RawAssets::ReaderContext readerCtx = { [this]( char const* pString ) { Warning( pString ); }, [this] ( char const* pString ) { Error( pString ); } };
+        RawAssets::ReaderContext readerCtx = { [this]( char const* pString ) { Warning( pString ); }, [this] ( char const* pString ) { Error( pString ); }, ctx.m_rawAssetCacheDirectoryPath, ctx.m_pTaskSystem };
         TUniquePtr<RawAssets::RawMesh> pRawMesh = RawAssets::ReadStaticMesh( readerCtx, meshFilePath, resourceDescriptor.m_meshesToInclude );
         if ( pRawMesh == nullptr )
         {
@@ -265,7 +393,14 @@ namespace EE::Render
         StaticMesh staticMesh;
 
         TransferMeshGeometry( *pRawMesh, staticMesh, 4 );
-        OptimizeMeshGeometry( staticMesh );
+        GenerateMeshLODs( resourceDescriptor, staticMesh );
+        OptimizeMeshGeometry( staticMesh, resourceDescriptor.m_generateMeshlets );
+
+        if ( resourceDescriptor.m_compressVertices )
+        {
+            CompressMeshVertices( staticMesh );
+        }
+
         SetMeshDefaultMaterials( resourceDescriptor, staticMesh );
 
         // Serialize
@@ -319,7 +454,7 @@ namespace EE::Render
             return Error( "Invalid mesh data path: %s", resourceDescriptor.m_meshPath.c_str() );
         }
 
-        RawAssets::ReaderContext readerCtx = { [this]( char const* pString ) { Warning( pString ); }, [this] ( char const* pString ) { Error( pString ); } };
+        RawAssets::ReaderContext readerCtx = { [this]( char const* pString ) { Warning( pString ); }, [this] ( char const* pString ) { Error( pString ); }, ctx.m_rawAssetCacheDirectoryPath, ctx.m_pTaskSystem };
         int32_t const maxBoneInfluences = 4;
         TUniquePtr<RawAssets::RawMesh> pRawMesh = RawAssets::ReadSkeletalMesh( readerCtx, meshFilePath, resourceDescriptor.m_meshesToInclude, maxBoneInfluences );
         if ( pRawMesh == nullptr )
@@ -339,7 +474,22 @@ namespace EE::Render
 
         SkeletalMesh skeletalMesh;
         TransferMeshGeometry( *pRawMesh, skeletalMesh, maxBoneInfluences );
-        OptimizeMeshGeometry( skeletalMesh );
+        GenerateMeshLODs( resourceDescriptor, skeletalMesh );
+        OptimizeMeshGeometry( skeletalMesh, resourceDescriptor.m_generateMeshlets );
+
+        if ( resourceDescriptor.m_compressVertices )
+        {
+            // Compressed vertices store bone indices as bytes, with 0xFF reserved for unused influences
+            if ( pRawMesh->GetSkeleton().GetNumBones() < 0xFF )
+            {
+                CompressMeshVertices( skeletalMesh );
+            }
+            else
+            {
+                Warning( "Mesh has %u bones, vertex compression supports at most 254 bones - vertices will not be compressed!", pRawMesh->GetSkeleton().GetNumBones() );
+            }
+        }
+
         TransferSkeletalMeshData( *pRawMesh, skeletalMesh );
         SetMeshDefaultMaterials( resourceDescriptor, skeletalMesh );
 
@@ -28,7 +28,9 @@ namespace EE::Render
     protected:
 
         void TransferMeshGeometry( RawAssets::RawMesh const& rawMesh, Mesh& mesh, int32_t maxBoneInfluences ) const;
-        void OptimizeMeshGeometry( Mesh& mesh ) const;
+        void GenerateMeshLODs( MeshResourceDescriptor const& descriptor, Mesh& mesh ) const;
+        void OptimizeMeshGeometry( Mesh& mesh, bool generateMeshlets ) const;
+        void CompressMeshVertices( Mesh& mesh ) const;
         void SetMeshDefaultMaterials( MeshResourceDescriptor const& descriptor, Mesh& mesh ) const;
         void SetMeshInstallDependencies( Mesh const& mesh, Resource::ResourceHeader& hdr ) const;
         virtual bool GetInstallDependencies( ResourceID const& resourceID, TVector<ResourceID>& outReferencedResources ) const override;
@@ -39,7 +41,7 @@ namespace EE::Render
     class StaticMeshCompiler : public MeshCompiler
     {
         EE_REFLECT_TYPE( StaticMeshCompiler );
-        static const int32_t s_version = 2;
+        static const int32_t s_version = 5;
 
     public:
 
@@ -52,7 +54,7 @@ namespace EE::Render
     class SkeletalMeshCompiler : public MeshCompiler
     {
         EE_REFLECT_TYPE( SkeletalMeshCompiler );
-        static const int32_t s_version = 5;
+        static const int32_t s_version = 8;
 
     public:
 
@@ -50,6 +50,26 @@ namespace EE::Render
         // Should all mesh-sections with the same materials be merged together?
         EE_REFLECT();
         bool                                    m_mergeSectionsByMaterial = true;
+
+        // Should the mesh sections be split into meshlets (small triangle clusters with bounds and normal cones) to allow for per-cluster culling?
+        EE_REFLECT();
+        bool                                    m_generateMeshlets = false;
+
+        // The max number of simplified LODs to generate, generation stops early once the mesh cant be simplified any further
+        EE_REFLECT();
+        int32_t                                 m_numLODs = 0;
+
+        // The target triangle count of each LOD relative to the previous LOD
+        EE_REFLECT();
+        float                                   m_LODTriangleRatio = 0.5f;
+
+        // The max simplification error for any LOD, relative to the size of the mesh
+        EE_REFLECT();
+        float                                   m_maxLODError = 0.05f;
+
+        // Should the vertices be stored in the compressed vertex format (quantized positions, octahedral normals and half float UVs)?
+        EE_REFLECT();
+        bool                                    m_compressVertices = false;
     };
 
     //-------------------------------------------------------------------------
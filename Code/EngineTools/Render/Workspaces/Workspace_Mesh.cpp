@@ -24,6 +24,12 @@ namespace EE::Render
             ImGui::PushID( i );
             Mesh::GeometrySection const& section = pMesh->GetSection( i );
             ImGui::Text( "Name: %s", section.m_ID.c_str() );
+            ImGui::Text( "Triangles: %u", section.m_numIndices / 3 );
+
+            if ( pMesh->HasMeshlets() )
+            {
+                ImGui::Text( "Meshlets: %u", section.m_numMeshlets );
+            }
 
             if ( pMeshComponent != nullptr )
             {
@@ -150,20 +156,20 @@ namespace EE::Render
 
             if ( ( m_showVertices || m_showNormals ) )
             {
-                auto pVertex = reinterpret_cast<StaticMeshVertex const*>( pMesh->GetVertexData().data() );
+                // Vertices are decoded individually since the vertex layout depends on the format (and may be compressed)
                 for ( auto i = 0; i < pMesh->GetNumVertices(); i++ )
                 {
+                    StaticMeshVertex const vertex = pMesh->GetVertex( i );
+
                     if ( m_showVertices )
                     {
-                        drawingContext.DrawPoint( pVertex->m_position, Colors::Cyan );
+                        drawingContext.DrawPoint( vertex.m_position, Colors::Cyan );
                     }
 
                     if ( m_showNormals )
                     {
-                        drawingContext.DrawLine( pVertex->m_position, pVertex->m_position + ( pVertex->m_normal * 0.15f ), Colors::Yellow );
+                        drawingContext.DrawLine( vertex.m_position, vertex.m_position + ( vertex.m_normal * 0.15f ), Colors::Yellow );
                     }
-
-                    pVertex++;
                 }
             }
         }
@@ -224,6 +230,14 @@ namespace EE::Render
 
             ImGui::TableNextRow();
 
+            ImGui::TableNextColumn();
+            ImGui::Text( "Vertex Data" );
+
+            ImGui::TableNextColumn();
+            ImGui::Text( "%.1f KB (%u bytes per vertex%s)", pMesh->GetVertexData().size() / 1024.0f, pMesh->GetVertexBuffer().m_byteStride, pMesh->HasCompressedVertices() ? ", compressed" : "" );
+
+            ImGui::TableNextRow();
+
             ImGui::TableNextColumn();
             ImGui::Text( "Num Indices" );
 
@@ -431,20 +445,20 @@ namespace EE::Render
 
             if ( ( m_showVertices || m_showNormals ) )
             {
-                auto pVertex = reinterpret_cast<StaticMeshVertex const*>( pMesh->GetVertexData().data() );
+                // Vertices are decoded individually since the vertex layout depends on the format (and may be compressed)
                 for ( auto i = 0; i < pMesh->GetNumVertices(); i++ )
                 {
+                    StaticMeshVertex const vertex = pMesh->GetVertex( i );
+
                     if ( m_showVertices )
                     {
-                        drawingCtx.DrawPoint( pVertex->m_position, Colors::Cyan );
+                        drawingCtx.DrawPoint( vertex.m_position, Colors::Cyan );
                     }
 
                     if ( m_showNormals )
                     {
-                        drawingCtx.DrawLine( pVertex->m_position, pVertex->m_position + ( pVertex->m_normal * 0.15f ), Colors::Yellow );
+                        drawingCtx.DrawLine( vertex.m_position, vertex.m_position + ( vertex.m_normal * 0.15f ), Colors::Yellow );
                     }
-
-                    pVertex++;
                 }
             }
 
@@ -537,6 +551,14 @@ namespace EE::Render
 
                 ImGui::TableNextRow();
 
+                ImGui::TableNextColumn();
+                ImGui::Text( "Vertex Data" );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.1f KB (%u bytes per vertex%s)", pSkeletalMesh->GetVertexData().size() / 1024.0f, pSkeletalMesh->GetVertexBuffer().m_byteStride, pSkeletalMesh->HasCompressedVertices() ? ", compressed" : "" );
+
+                ImGui::TableNextRow();
+
                 ImGui::TableNextColumn();
                 ImGui::Text( "Num Indices" );
 
@@ -328,7 +328,21 @@ namespace EE::Resource
 
     void ResourceBrowserEditorTool::UpdateVisibility()
     {
-        auto VisibilityFunc = [this] ( TreeListViewItem const* pItem )
+        // Use the database search index to find all matching files rather than testing every item
+        THashMap<ResourcePath, bool> matchingFiles;
+        if ( m_filter.HasFilterSet() )
+        {
+            TVector<Resource::ResourceDatabase::FileEntry const*> foundFileEntries;
+            m_pToolsContext->m_pResourceDatabase->FindResources( m_filter.GetFilterTokens(), foundFileEntries );
+            for ( auto pFileEntry : foundFileEntries )
+            {
+                matchingFiles.insert( TPair<ResourcePath, bool>( pFileEntry->m_resourceID.GetResourcePath(), true ) );
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        auto VisibilityFunc = [this, &matchingFiles] ( TreeListViewItem const* pItem )
         {
             bool isVisible = true;
 
@@ -352,9 +366,16 @@ namespace EE::Resource
             // Text filter
             //-------------------------------------------------------------------------
 
-            if ( isVisible )
+            if ( isVisible && m_filter.HasFilterSet() )
             {
-                isVisible = m_filter.MatchesFilter( pItem->GetDisplayName() );
+                if ( pDataFileItem->IsFile() )
+                {
+                    isVisible = matchingFiles.find( pDataFileItem->GetResourcePath() ) != matchingFiles.end();
+                }
+                else
+                {
+                    isVisible = m_filter.MatchesFilter( pItem->GetDisplayName() );
+                }
             }
 
             //-------------------------------------------------------------------------
@@ -409,6 +430,41 @@ namespace EE::Resource
         {
             ImGui::Separator();
 
+            auto DrawResourceList = [this] ( TVector<ResourcePath> const& resourcePaths )
+            {
+                if ( resourcePaths.empty() )
+                {
+                    ImGui::TextDisabled( "None" );
+                    return;
+                }
+
+                for ( ResourcePath const& resourcePath : resourcePaths )
+                {
+                    if ( ImGui::MenuItem( resourcePath.c_str() ) )
+                    {
+                        ResourceID const resourceID( resourcePath );
+                        if ( resourceID.IsValid() && m_pToolsContext->m_pResourceDatabase->DoesResourceExist( resourceID ) )
+                        {
+                            TryFindAndSelectResource( resourceID );
+                        }
+                    }
+                }
+            };
+
+            if ( ImGui::BeginMenu( "Dependencies" ) )
+            {
+                DrawResourceList( m_pToolsContext->m_pResourceDatabase->GetDependencies( pResourceItem->GetResourcePath() ) );
+                ImGui::EndMenu();
+            }
+
+            if ( ImGui::BeginMenu( "Referenced By" ) )
+            {
+                DrawResourceList( m_pToolsContext->m_pResourceDatabase->GetReferencers( pResourceItem->GetResourcePath() ) );
+                ImGui::EndMenu();
+            }
+
+            ImGui::Separator();
+
             if ( ImGui::MenuItem( EE_ICON_ALERT_OCTAGON" Delete" ) )
             {
                 m_dialogManager.CreateModalDialog( "Delete Resource", [this] ( UpdateContext const& context ) { return DrawDeleteConfirmationDialog( context ); } );
@@ -8,6 +8,13 @@
 
 //-------------------------------------------------------------------------
 
+namespace EE
+{
+    class TaskSystem;
+}
+
+//-------------------------------------------------------------------------
+
 namespace EE::Resource
 {
     enum class CompilationResult : int32_t
@@ -42,6 +49,8 @@ namespace EE::Resource
         FileSystem::Path const                          m_outputFilePath;
 
         uint64_t                                        m_sourceResourceHash = 0; // The combined hash of the source resource and its dependencies
+        FileSystem::Path                                m_rawAssetCacheDirectoryPath; // Optional: cache for the raw assets read from source files
+        TaskSystem*                                     m_pTaskSystem = nullptr; // Optional: used by compilers to parallelize the processing of a single resource
     };
 
     // Resource Compiler
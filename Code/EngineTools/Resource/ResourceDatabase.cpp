@@ -1,13 +1,73 @@
 #include "ResourceDatabase.h"
 #include "ResourceDescriptor.h"
 #include "Base/FileSystem/FileSystemUtils.h"
+#include "Base/FileSystem/FileSystem.h"
 #include "Base/TypeSystem/TypeRegistry.h"
+#include "Base/Encoding/Hash.h"
 #include "Base/Types/Function.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Resource
 {
+    // Update this value to invalidate all existing snapshots
+    constexpr static int32_t const g_snapshotVersion = 1;
+
+    //-------------------------------------------------------------------------
+
+    static bool ReadDescriptorFile( FileSystem::Path const& descriptorPath, String& outDescriptorData, uint64_t& outContentHash )
+    {
+        Blob fileData;
+        if ( !FileSystem::LoadFile( descriptorPath.c_str(), fileData ) )
+        {
+            outDescriptorData.clear();
+            outContentHash = 0;
+            return false;
+        }
+
+        outDescriptorData.assign( (char const*) fileData.data(), fileData.size() );
+        outContentHash = Hash::XXHash::GetHash64( outDescriptorData );
+        return true;
+    }
+
+    static ResourceDescriptor* TryCreateDescriptorFromData( TypeSystem::TypeRegistry const& typeRegistry, String const& descriptorData, FileSystem::Path const& descriptorPath )
+    {
+        Serialization::TypeArchiveReader typeReader( typeRegistry );
+        if ( !typeReader.ReadFromString( descriptorData.c_str() ) )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Descriptor", "Failed to read resource descriptor file: %s", descriptorPath.c_str() );
+            return nullptr;
+        }
+
+        auto pDescriptor = typeReader.TryReadType();
+        if ( pDescriptor == nullptr )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Descriptor", "Failed to read resource descriptor file: %s", descriptorPath.c_str() );
+            return nullptr;
+        }
+
+        if ( !pDescriptor->GetTypeInfo()->IsDerivedFrom( ResourceDescriptor::GetStaticTypeID() ) )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Descriptor", "Read type from file: %s is not a resource descriptor", descriptorPath.c_str() );
+            EE::Delete( pDescriptor );
+            return nullptr;
+        }
+
+        return Cast<ResourceDescriptor>( pDescriptor );
+    }
+
+    static void GetAllFileEntries( ResourceDatabase::DirectoryEntry const& directory, TVector<ResourceDatabase::FileEntry*>& outFileEntries )
+    {
+        for ( auto const& childDirectory : directory.m_directories )
+        {
+            GetAllFileEntries( childDirectory, outFileEntries );
+        }
+
+        outFileEntries.insert( outFileEntries.end(), directory.m_files.begin(), directory.m_files.end() );
+    }
+
+    //-------------------------------------------------------------------------
+
     ResourceDatabase::FileEntry::~FileEntry()
     {
         EE::Delete( m_pDescriptor );
@@ -19,7 +79,24 @@ namespace EE::Resource
         EE_ASSERT( m_pDescriptor == nullptr );
         EE_ASSERT( m_filePath.IsValid() );
 
-        m_pDescriptor = ResourceDescriptor::TryReadFromFile( typeRegistry, m_filePath );
+        // Read the file ourselves so that we can hash the contents for the snapshot
+        String descriptorData;
+        if ( !ReadDescriptorFile( m_filePath, descriptorData, m_contentHash ) )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Descriptor", "Failed to read resource descriptor file: %s", m_filePath.c_str() );
+            return;
+        }
+
+        m_pDescriptor = TryCreateDescriptorFromData( typeRegistry, descriptorData, m_filePath );
+    }
+
+    void ResourceDatabase::FileEntry::LoadDescriptorFromData( TypeSystem::TypeRegistry const& typeRegistry, String const& descriptorData )
+    {
+        EE_ASSERT( m_isRegisteredResourceType );
+        EE_ASSERT( m_pDescriptor == nullptr );
+        EE_ASSERT( !descriptorData.empty() );
+
+        m_pDescriptor = TryCreateDescriptorFromData( typeRegistry, descriptorData, m_filePath );
     }
 
     void ResourceDatabase::FileEntry::ReloadDescriptor( TypeSystem::TypeRegistry const& typeRegistry )
@@ -101,7 +178,13 @@ namespace EE::Resource
         // Start database build
         //-------------------------------------------------------------------------
 
-        StartFilesystemCacheBuild();
+        m_buildTimer.Start();
+        m_buildStats = BuildStats();
+
+        if ( !TryLoadSnapshot() )
+        {
+            StartFilesystemCacheBuild();
+        }
 
         // Start file system watcher
         //-------------------------------------------------------------------------
@@ -121,6 +204,11 @@ namespace EE::Resource
 
         //-------------------------------------------------------------------------
 
+        if ( m_state == DatabaseState::Ready && m_isSnapshotDirty )
+        {
+            SaveSnapshot();
+        }
+
         ClearDatabase();
 
         if ( m_filesystemCacheUpdatedEvent.HasBoundUsers() )
@@ -148,6 +236,7 @@ namespace EE::Resource
                 if ( m_state == DatabaseState::BuildingFileSystemCache )
                 {
                     EE_ASSERT( m_numItemsProcessed == m_totalItemsToProcess );
+                    m_buildStats.m_fileSystemCacheTime = m_buildTimer.GetElapsedTimeMilliseconds();
 
                     // Notify users that the DB has been rebuilt
                     m_filesystemCacheUpdatedEvent.Execute();
@@ -159,15 +248,28 @@ namespace EE::Resource
                     }
                     else // Nothing else to do
                     {
-                        m_state = DatabaseState::Ready;
+                        OnBuildComplete();
                     }
                 }
-                else if ( m_state == DatabaseState::BuildingDescriptorCache )
+                else if ( m_state == DatabaseState::ReconcilingFileSystemCache )
                 {
                     EE_ASSERT( m_numItemsProcessed == m_totalItemsToProcess );
 
-                    m_descriptorsToLoad.clear();
-                    m_state = DatabaseState::Ready;
+                    ApplyReconcileResult();
+
+                    if ( !m_descriptorsToLoad.empty() )
+                    {
+                        StartDescriptorCacheBuild();
+                    }
+                    else
+                    {
+                        OnBuildComplete();
+                    }
+                }
+                else if ( m_state == DatabaseState::BuildingDescriptorCache )
+                {
+                    EE_ASSERT( m_numItemsProcessed == m_totalItemsToProcess );
+                    OnBuildComplete();
                 }
                 else // Error
                 {
@@ -196,6 +298,10 @@ namespace EE::Resource
     {
         CancelDatabaseBuild();
         ClearDatabase();
+
+        // A rebuild always goes through the file system, the snapshot will be overwritten on shutdown
+        m_buildTimer.Start();
+        m_buildStats = BuildStats();
         StartFilesystemCacheBuild();
     }
 
@@ -204,11 +310,423 @@ namespace EE::Resource
         m_resourcesPerType.clear();
         m_resourcesPerPath.clear();
         m_reflectedDataDirectory.Clear();
-        m_descriptorsToLoad.empty();
+        m_searchIndex.Clear();
+        m_dependencies.clear();
+        m_referencers.clear();
+        m_descriptorsToLoad.clear();
+        m_descriptorsToLoadData.clear();
+        m_snapshot = Snapshot();
+        m_snapshotFileLookup.clear();
+        m_reconcileResult = ReconcileResult();
+        m_isSnapshotDirty = false;
         m_numItemsProcessed = m_totalItemsToProcess = 0;
         m_state = DatabaseState::Empty;
     }
 
+    void ResourceDatabase::ResetFileSystemCache()
+    {
+        // Reset the resource type category and add an entry for for every known resource type
+        m_resourcesPerType.clear();
+        for ( auto const& resourceInfoPair : m_pTypeRegistry->GetRegisteredResourceTypes() )
+        {
+            auto const& resourceInfo = resourceInfoPair.second;
+            m_resourcesPerType.insert( TPair<ResourceTypeID, TVector<FileEntry*>>( resourceInfo.m_resourceTypeID, TVector<FileEntry*>() ) );
+        }
+
+        // Reset file map and indices
+        m_resourcesPerPath.clear();
+        m_searchIndex.Clear();
+        m_dependencies.clear();
+        m_referencers.clear();
+
+        // Reset the root dir
+        m_reflectedDataDirectory.Clear();
+        m_reflectedDataDirectory.m_name = StringID( m_rawResourceDirPath.GetDirectoryName() );
+        m_reflectedDataDirectory.m_filePath = m_rawResourceDirPath;
+    }
+
+    void ResourceDatabase::OnBuildComplete()
+    {
+        int32_t const numDescriptorsLoaded = (int32_t) m_descriptorsToLoad.size();
+        m_descriptorsToLoad.clear();
+        m_descriptorsToLoadData.clear();
+
+        // A full build always needs to be persisted, for a snapshot build we only need to save if anything changed
+        if ( !m_buildStats.m_usedSnapshot )
+        {
+            m_isSnapshotDirty = true;
+        }
+
+        // The snapshot data is only needed while building
+        m_snapshot = Snapshot();
+        m_snapshotFileLookup.clear();
+
+        RebuildDependencies();
+
+        m_buildStats.m_totalTime = m_buildTimer.GetElapsedTimeMilliseconds();
+        m_buildStats.m_numFiles = (int32_t) m_resourcesPerPath.size();
+        m_buildStats.m_numDescriptorsReadFromDisk = m_numDescriptorsReadFromDisk;
+        m_buildStats.m_numDescriptorsReadFromSnapshot = numDescriptorsLoaded - m_numDescriptorsReadFromDisk;
+
+        m_state = DatabaseState::Ready;
+
+        EE_LOG_INFO( "Resource", "Resource Database", "Database built in %.2fms (%s, file system cache: %.2fms) - %d files, %d descriptors read from disk, %d descriptors read from snapshot", m_buildStats.m_totalTime.ToFloat(), m_buildStats.m_usedSnapshot ? "Snapshot" : "Full", m_buildStats.m_fileSystemCacheTime.ToFloat(), m_buildStats.m_numFiles, m_buildStats.m_numDescriptorsReadFromDisk, m_buildStats.m_numDescriptorsReadFromSnapshot );
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool ResourceDatabase::TryLoadSnapshot()
+    {
+        EE_ASSERT( m_state == DatabaseState::Empty );
+        EE_ASSERT( m_pAsyncTask == nullptr );
+
+        FileSystem::Path const snapshotFilePath = GetSnapshotFilePath();
+        if ( !snapshotFilePath.Exists() )
+        {
+            return false;
+        }
+
+        Serialization::BinaryInputArchive archive;
+        if ( !archive.ReadFromFile( snapshotFilePath ) )
+        {
+            EE_LOG_WARNING( "Resource", "Resource Database", "Failed to read resource database snapshot: %s", snapshotFilePath.c_str() );
+            return false;
+        }
+
+        archive << m_snapshot;
+        if ( m_snapshot.m_version != g_snapshotVersion )
+        {
+            m_snapshot = Snapshot();
+            return false;
+        }
+
+        // Build the file system cache from the snapshot
+        //-------------------------------------------------------------------------
+
+        ResetFileSystemCache();
+
+        for ( String const& directoryPath : m_snapshot.m_directories )
+        {
+            ResourcePath const resourcePath( directoryPath );
+            if ( resourcePath.IsValid() && resourcePath.IsDirectory() )
+            {
+                FindOrCreateDirectory( ResourcePath::ToFileSystemPath( m_rawResourceDirPath, resourcePath ) );
+            }
+        }
+
+        int32_t const numFiles = (int32_t) m_snapshot.m_files.size();
+        m_snapshotFileLookup.reserve( numFiles );
+        for ( int32_t i = 0; i < numFiles; i++ )
+        {
+            SnapshotFileRecord const& record = m_snapshot.m_files[i];
+            ResourcePath const resourcePath( record.m_path );
+            if ( !resourcePath.IsValid() || !resourcePath.IsFile() )
+            {
+                continue;
+            }
+
+            // The snapshot can contain stale entries for paths that were fixed up, we only keep the first one
+            if ( m_snapshotFileLookup.find( resourcePath ) != m_snapshotFileLookup.end() )
+            {
+                continue;
+            }
+
+            FileEntry* pFileEntry = AddFileRecord( ResourcePath::ToFileSystemPath( m_rawResourceDirPath, resourcePath ), false, record.m_modifiedTime );
+            pFileEntry->m_contentHash = record.m_contentHash;
+            m_snapshotFileLookup[resourcePath] = i;
+        }
+
+        //-------------------------------------------------------------------------
+
+        m_buildStats.m_usedSnapshot = true;
+        m_buildStats.m_fileSystemCacheTime = m_buildTimer.GetElapsedTimeMilliseconds();
+        m_filesystemCacheUpdatedEvent.Execute();
+
+        StartSnapshotReconcile();
+        return true;
+    }
+
+    void ResourceDatabase::SaveSnapshot() const
+    {
+        EE_ASSERT( m_state == DatabaseState::Ready );
+
+        Snapshot snapshot;
+        snapshot.m_version = g_snapshotVersion;
+
+        // Directories - resource paths are derived from the file paths, since directory resource paths are not updated on rename
+        //-------------------------------------------------------------------------
+
+        TVector<DirectoryEntry const*> directoriesToVisit;
+        directoriesToVisit.emplace_back( &m_reflectedDataDirectory );
+        while ( !directoriesToVisit.empty() )
+        {
+            DirectoryEntry const* pDirectory = directoriesToVisit.back();
+            directoriesToVisit.pop_back();
+
+            for ( auto const& childDirectory : pDirectory->m_directories )
+            {
+                snapshot.m_directories.emplace_back( ResourcePath::FromFileSystemPath( m_rawResourceDirPath, childDirectory.m_filePath ).GetString() );
+                directoriesToVisit.emplace_back( &childDirectory );
+            }
+        }
+
+        // Files
+        //-------------------------------------------------------------------------
+
+        snapshot.m_files.reserve( m_resourcesPerPath.size() );
+        for ( auto const& filePair : m_resourcesPerPath )
+        {
+            FileEntry const* pFileEntry = filePair.second;
+
+            SnapshotFileRecord& record = snapshot.m_files.emplace_back();
+            record.m_path = pFileEntry->m_resourceID.GetResourcePath().GetString();
+            record.m_modifiedTime = pFileEntry->m_modifiedTime;
+
+            // Only store descriptors that were successfully loaded, everything else will be read from disk on the next startup
+            if ( pFileEntry->m_pDescriptor != nullptr )
+            {
+                record.m_contentHash = pFileEntry->m_contentHash;
+                Serialization::WriteNativeTypeToString( *m_pTypeRegistry, pFileEntry->m_pDescriptor, record.m_descriptorData );
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        FileSystem::Path const snapshotFilePath = GetSnapshotFilePath();
+        snapshotFilePath.EnsureDirectoryExists();
+
+        Serialization::BinaryOutputArchive archive;
+        archive << snapshot;
+        if ( !archive.WriteToFile( snapshotFilePath ) )
+        {
+            EE_LOG_WARNING( "Resource", "Resource Database", "Failed to write resource database snapshot: %s", snapshotFilePath.c_str() );
+        }
+    }
+
+    void ResourceDatabase::StartSnapshotReconcile()
+    {
+        EE_ASSERT( m_pAsyncTask == nullptr );
+        EE_ASSERT( m_buildStats.m_usedSnapshot );
+
+        //-------------------------------------------------------------------------
+
+        // Only the snapshot and the reconcile result are touched by this task, the file system cache is only updated once the task completes
+        auto ReconcileFileSystemCache = [this] ( TaskSetPartition range, uint32_t threadnum )
+        {
+            if ( m_cancelActiveTask )
+            {
+                return;
+            }
+
+            TVector<FileSystem::Path> foundPaths;
+            if ( !FileSystem::GetDirectoryContents( m_rawResourceDirPath, foundPaths, FileSystem::DirectoryReaderOutput::All, FileSystem::DirectoryReaderMode::Expand ) )
+            {
+                EE_HALT();
+            }
+
+            THashMap<ResourcePath, int32_t> snapshotDirectoryLookup;
+            int32_t const numSnapshotDirectories = (int32_t) m_snapshot.m_directories.size();
+            for ( int32_t i = 0; i < numSnapshotDirectories; i++ )
+            {
+                snapshotDirectoryLookup[ResourcePath( m_snapshot.m_directories[i] )] = i;
+            }
+
+            TVector<bool> directoriesFound( numSnapshotDirectories, false );
+            TVector<bool> filesFound( m_snapshot.m_files.size(), false );
+
+            // Compare the file system to the snapshot
+            //-------------------------------------------------------------------------
+
+            m_totalItemsToProcess = (int32_t) foundPaths.size();
+            for ( int32_t i = 0; i < m_totalItemsToProcess; i++ )
+            {
+                auto const& foundPath = foundPaths[i];
+
+                if ( m_cancelActiveTask )
+                {
+                    m_numItemsProcessed = m_totalItemsToProcess;
+                    return;
+                }
+
+                //-------------------------------------------------------------------------
+
+                ResourcePath const resourcePath = ResourcePath::FromFileSystemPath( m_rawResourceDirPath, foundPath );
+
+                if ( foundPath.IsDirectoryPath() )
+                {
+                    auto directoryIter = snapshotDirectoryLookup.find( resourcePath );
+                    if ( directoryIter != snapshotDirectoryLookup.end() )
+                    {
+                        directoriesFound[directoryIter->second] = true;
+                    }
+                    else
+                    {
+                        m_reconcileResult.m_addedDirectories.emplace_back( foundPath );
+                    }
+                }
+                else
+                {
+                    auto fileIter = m_snapshotFileLookup.find( resourcePath );
+                    if ( fileIter == m_snapshotFileLookup.end() )
+                    {
+                        m_reconcileResult.m_addedFiles.emplace_back( foundPath );
+                    }
+                    else
+                    {
+                        int32_t const recordIdx = fileIter->second;
+                        filesFound[recordIdx] = true;
+
+                        SnapshotFileRecord& record = m_snapshot.m_files[recordIdx];
+                        uint64_t const modifiedTime = FileSystem::GetFileModifiedTime( foundPath );
+                        if ( modifiedTime != record.m_modifiedTime )
+                        {
+                            record.m_modifiedTime = modifiedTime;
+
+                            // A new timestamp doesnt necessarily mean new contents, only discard the snapshot data if the contents actually changed
+                            if ( m_pTypeRegistry->IsRegisteredResourceType( ResourceID( resourcePath ).GetResourceTypeID() ) )
+                            {
+                                String descriptorData;
+                                uint64_t contentHash = 0;
+                                ReadDescriptorFile( foundPath, descriptorData, contentHash );
+                                if ( contentHash != record.m_contentHash || record.m_descriptorData.empty() )
+                                {
+                                    record.m_contentHash = contentHash;
+                                    record.m_descriptorData = eastl::move( descriptorData );
+
+                                    // The descriptor will be loaded from the updated record, but its data came from disk
+                                    m_numDescriptorsReadFromDisk++;
+                                }
+                            }
+
+                            m_reconcileResult.m_modifiedFileRecords.emplace_back( recordIdx );
+                        }
+                    }
+                }
+
+                m_numItemsProcessed++;
+            }
+
+            // Anything in the snapshot that wasnt found was removed
+            //-------------------------------------------------------------------------
+
+            for ( int32_t i = 0; i < numSnapshotDirectories; i++ )
+            {
+                if ( !directoriesFound[i] )
+                {
+                    ResourcePath const resourcePath( m_snapshot.m_directories[i] );
+                    if ( resourcePath.IsValid() )
+                    {
+                        m_reconcileResult.m_removedDirectories.emplace_back( ResourcePath::ToFileSystemPath( m_rawResourceDirPath, resourcePath ) );
+                    }
+                }
+            }
+
+            for ( auto const& filePair : m_snapshotFileLookup )
+            {
+                if ( !filesFound[filePair.second] )
+                {
+                    m_reconcileResult.m_removedFiles.emplace_back( ResourcePath::ToFileSystemPath( m_rawResourceDirPath, filePair.first ) );
+                }
+            }
+
+            EE_ASSERT( m_numItemsProcessed == m_totalItemsToProcess );
+        };
+
+        //-------------------------------------------------------------------------
+
+        m_reconcileResult = ReconcileResult();
+        m_numItemsProcessed = 0;
+        m_totalItemsToProcess = 0;
+        m_numDescriptorsReadFromDisk = 0;
+
+        m_state = DatabaseState::ReconcilingFileSystemCache;
+        m_pAsyncTask = EE::New<AsyncTask>( ReconcileFileSystemCache );
+        m_pTaskSystem->ScheduleTask( m_pAsyncTask );
+    }
+
+    void ResourceDatabase::ApplyReconcileResult()
+    {
+        EE_ASSERT( m_state == DatabaseState::ReconcilingFileSystemCache );
+        EE_ASSERT( m_descriptorsToLoad.empty() );
+
+        // Apply the file system differences, the file watcher might have already applied some of them
+        //-------------------------------------------------------------------------
+
+        for ( auto const& filePath : m_reconcileResult.m_removedFiles )
+        {
+            if ( m_resourcesPerPath.find( ResourcePath::FromFileSystemPath( m_rawResourceDirPath, filePath ) ) != m_resourcesPerPath.end() )
+            {
+                RemoveFileRecord( filePath );
+            }
+        }
+
+        for ( auto const& directoryPath : m_reconcileResult.m_removedDirectories )
+        {
+            RemoveDirectoryRecord( directoryPath );
+        }
+
+        for ( auto const& directoryPath : m_reconcileResult.m_addedDirectories )
+        {
+            FindOrCreateDirectory( directoryPath );
+        }
+
+        for ( auto const& filePath : m_reconcileResult.m_addedFiles )
+        {
+            if ( m_resourcesPerPath.find( ResourcePath::FromFileSystemPath( m_rawResourceDirPath, filePath ) ) == m_resourcesPerPath.end() )
+            {
+                AddFileRecord( filePath, false );
+            }
+        }
+
+        for ( int32_t recordIdx : m_reconcileResult.m_modifiedFileRecords )
+        {
+            SnapshotFileRecord const& record = m_snapshot.m_files[recordIdx];
+            auto fileIter = m_resourcesPerPath.find( ResourcePath( record.m_path ) );
+            if ( fileIter != m_resourcesPerPath.end() )
+            {
+                fileIter->second->m_modifiedTime = record.m_modifiedTime;
+                fileIter->second->m_contentHash = record.m_contentHash;
+            }
+        }
+
+        bool const hasChanges = !m_reconcileResult.m_removedFiles.empty() || !m_reconcileResult.m_removedDirectories.empty() || !m_reconcileResult.m_addedDirectories.empty() || !m_reconcileResult.m_addedFiles.empty() || !m_reconcileResult.m_modifiedFileRecords.empty();
+        if ( hasChanges )
+        {
+            m_isSnapshotDirty = true;
+            m_filesystemCacheUpdatedEvent.Execute();
+        }
+
+        m_reconcileResult = ReconcileResult();
+
+        // Queue all descriptors for load, unchanged descriptors are read from the snapshot data
+        //-------------------------------------------------------------------------
+
+        for ( auto const& resourceTypePair : m_resourcesPerType )
+        {
+            for ( FileEntry* pFileEntry : resourceTypePair.second )
+            {
+                if ( pFileEntry->m_pDescriptor != nullptr )
+                {
+                    continue;
+                }
+
+                String const* pDescriptorData = nullptr;
+                auto recordIter = m_snapshotFileLookup.find( pFileEntry->m_resourceID.GetResourcePath() );
+                if ( recordIter != m_snapshotFileLookup.end() )
+                {
+                    SnapshotFileRecord const& record = m_snapshot.m_files[recordIter->second];
+                    if ( !record.m_descriptorData.empty() && record.m_contentHash == pFileEntry->m_contentHash )
+                    {
+                        pDescriptorData = &record.m_descriptorData;
+                    }
+                }
+
+                m_descriptorsToLoad.emplace_back( pFileEntry );
+                m_descriptorsToLoadData.emplace_back( pDescriptorData );
+            }
+        }
+    }
+
     void ResourceDatabase::CancelDatabaseBuild()
     {
         if ( m_pAsyncTask != nullptr )
@@ -233,27 +751,7 @@ namespace EE::Resource
 
         auto BuildFileSystemCache = [this] ( TaskSetPartition range, uint32_t threadnum )
         {
-            // Reset the resource type category and add an entry for for every known resource type
-            //-------------------------------------------------------------------------
-
-            m_resourcesPerType.clear();
-            for ( auto const& resourceInfoPair : m_pTypeRegistry->GetRegisteredResourceTypes() )
-            {
-                auto const& resourceInfo = resourceInfoPair.second;
-                m_resourcesPerType.insert( TPair<ResourceTypeID, TVector<FileEntry*>>( resourceInfo.m_resourceTypeID, TVector<FileEntry*>() ) );
-            }
-
-            // Reset file map
-            //-------------------------------------------------------------------------
-
-            m_resourcesPerPath.clear();
-
-            // Reset the root dir
-            //-------------------------------------------------------------------------
-
-            m_reflectedDataDirectory.Clear();
-            m_reflectedDataDirectory.m_name = StringID( m_rawResourceDirPath.GetDirectoryName() );
-            m_reflectedDataDirectory.m_filePath = m_rawResourceDirPath;
+            ResetFileSystemCache();
 
             // Get all files in the data directory
             //-------------------------------------------------------------------------
@@ -311,6 +809,7 @@ namespace EE::Resource
 
         m_numItemsProcessed = 0;
         m_totalItemsToProcess = 0;
+        m_numDescriptorsReadFromDisk = 0;
 
         m_state = DatabaseState::BuildingFileSystemCache;
         m_pAsyncTask = EE::New<AsyncTask>( BuildFileSystemCache );
@@ -319,9 +818,10 @@ namespace EE::Resource
 
     void ResourceDatabase::StartDescriptorCacheBuild()
     {
-        EE_ASSERT( m_state == DatabaseState::BuildingFileSystemCache );
+        EE_ASSERT( m_state == DatabaseState::BuildingFileSystemCache || m_state == DatabaseState::ReconcilingFileSystemCache );
         EE_ASSERT( m_pAsyncTask == nullptr );
         EE_ASSERT( !m_descriptorsToLoad.empty() );
+        EE_ASSERT( m_descriptorsToLoadData.empty() || m_descriptorsToLoadData.size() == m_descriptorsToLoad.size() );
 
         //-------------------------------------------------------------------------
 
@@ -329,8 +829,17 @@ namespace EE::Resource
         {
             for ( uint32_t i = range.start; i < range.end; i++ )
             {
-                m_descriptorsToLoad[i]->LoadDescriptor( *m_pTypeRegistry );
-                m_descriptorsToLoad[i] = nullptr;
+                String const* pDescriptorData = m_descriptorsToLoadData.empty() ? nullptr : m_descriptorsToLoadData[i];
+                if ( pDescriptorData != nullptr )
+                {
+                    m_descriptorsToLoad[i]->LoadDescriptorFromData( *m_pTypeRegistry, *pDescriptorData );
+                }
+                else
+                {
+                    m_descriptorsToLoad[i]->LoadDescriptor( *m_pTypeRegistry );
+                    m_numDescriptorsReadFromDisk++;
+                }
+
                 m_numItemsProcessed++;
             }
         };
@@ -516,7 +1025,7 @@ namespace EE::Resource
         return pCurrentDir;
     }
 
-    ResourceDatabase::FileEntry* ResourceDatabase::AddFileRecord( FileSystem::Path const& path, bool loadDescriptor )
+    ResourceDatabase::FileEntry* ResourceDatabase::AddFileRecord( FileSystem::Path const& path, bool loadDescriptor, uint64_t modifiedTime )
     {
         auto const resourcePath = ResourcePath::FromFileSystemPath( m_rawResourceDirPath, path );
         EE_ASSERT( resourcePath.IsFile() );
@@ -525,6 +1034,7 @@ namespace EE::Resource
         auto pNewEntry = EE::New<FileEntry>();
         pNewEntry->m_filePath = path;
         pNewEntry->m_resourceID = resourcePath;
+        pNewEntry->m_modifiedTime = ( modifiedTime != 0 ) ? modifiedTime : FileSystem::GetFileModifiedTime( path );
         pNewEntry->m_isRegisteredResourceType = m_pTypeRegistry->IsRegisteredResourceType( pNewEntry->m_resourceID.GetResourceTypeID() );
 
         // Add to directory list
@@ -540,11 +1050,13 @@ namespace EE::Resource
 
         // Add to file map
         m_resourcesPerPath[resourcePath] = pNewEntry;
+        m_searchIndex.AddPath( resourcePath );
 
         // Load descriptor
         if ( pNewEntry->m_isRegisteredResourceType && loadDescriptor )
         {
             pNewEntry->LoadDescriptor( *m_pTypeRegistry );
+            UpdateDependencies( pNewEntry );
         }
 
         return pNewEntry;
@@ -560,13 +1072,17 @@ namespace EE::Resource
         {
             if ( pDirectory->m_files[i]->m_filePath == path )
             {
-                // Remove from file map
-                auto fileMapiter = m_resourcesPerPath.find( pDirectory->m_files[i]->m_resourceID.GetResourcePath() );
+                // Remove from file map and indices
+                ResourcePath const& resourcePath = pDirectory->m_files[i]->m_resourceID.GetResourcePath();
+                auto fileMapiter = m_resourcesPerPath.find( resourcePath );
                 if ( fileMapiter != m_resourcesPerPath.end() )
                 {
                     m_resourcesPerPath.erase( fileMapiter );
                 }
 
+                m_searchIndex.RemovePath( resourcePath );
+                RemoveDependencies( resourcePath );
+
                 // Remove from categorized resource lists
                 ResourceID const& resourceID = pDirectory->m_files[i]->m_resourceID;
                 if ( resourceID.IsValid() )
@@ -591,6 +1107,160 @@ namespace EE::Resource
         }
     }
 
+    //-------------------------------------------------------------------------
+
+    void ResourceDatabase::FindResources( TVector<String> const& searchTokens, TVector<FileEntry const*>& outResults ) const
+    {
+        outResults.clear();
+
+        TVector<ResourcePath> foundPaths;
+        m_searchIndex.Search( searchTokens, foundPaths );
+
+        outResults.reserve( foundPaths.size() );
+        for ( ResourcePath const& foundPath : foundPaths )
+        {
+            auto fileEntryIter = m_resourcesPerPath.find( foundPath );
+            EE_ASSERT( fileEntryIter != m_resourcesPerPath.end() );
+            outResults.emplace_back( fileEntryIter->second );
+        }
+    }
+
+    TVector<ResourcePath> const& ResourceDatabase::GetDependencies( ResourcePath const& resourcePath ) const
+    {
+        static TVector<ResourcePath> const s_noDependencies;
+        auto iter = m_dependencies.find( resourcePath );
+        return ( iter != m_dependencies.end() ) ? iter->second : s_noDependencies;
+    }
+
+    TVector<ResourcePath> const& ResourceDatabase::GetReferencers( ResourcePath const& resourcePath ) const
+    {
+        static TVector<ResourcePath> const s_noReferencers;
+        auto iter = m_referencers.find( resourcePath );
+        return ( iter != m_referencers.end() ) ? iter->second : s_noReferencers;
+    }
+
+    void ResourceDatabase::UpdateDependencies( FileEntry const* pFileEntry )
+    {
+        EE_ASSERT( pFileEntry != nullptr );
+
+        ResourcePath const& resourcePath = pFileEntry->m_resourceID.GetResourcePath();
+        RemoveDependencies( resourcePath );
+
+        if ( pFileEntry->m_pDescriptor == nullptr )
+        {
+            return;
+        }
+
+        // Get both the compile dependencies and all resources referenced by the descriptor (i.e. install dependencies)
+        //-------------------------------------------------------------------------
+
+        TVector<ResourceID> referencedResources;
+        pFileEntry->m_pDescriptor->GetCompileDependencies( referencedResources );
+        pFileEntry->m_pDescriptor->GetTypeInfo()->GetReferencedResources( pFileEntry->m_pDescriptor, referencedResources );
+
+        TVector<ResourcePath> dependencies;
+        for ( ResourceID const& referencedResourceID : referencedResources )
+        {
+            if ( referencedResourceID.IsValid() && referencedResourceID.GetResourcePath() != resourcePath )
+            {
+                VectorEmplaceBackUnique( dependencies, referencedResourceID.GetResourcePath() );
+            }
+        }
+
+        if ( dependencies.empty() )
+        {
+            return;
+        }
+
+        // Update graph
+        //-------------------------------------------------------------------------
+
+        for ( ResourcePath const& dependency : dependencies )
+        {
+            m_referencers[dependency].emplace_back( resourcePath );
+        }
+
+        m_dependencies.insert( TPair<ResourcePath, TVector<ResourcePath>>( resourcePath, eastl::move( dependencies ) ) );
+    }
+
+    void ResourceDatabase::RemoveDependencies( ResourcePath const& resourcePath )
+    {
+        auto iter = m_dependencies.find( resourcePath );
+        if ( iter == m_dependencies.end() )
+        {
+            return;
+        }
+
+        // We only remove the outgoing edges, anything that references this resource still does so even if it no longer exists
+        for ( ResourcePath const& dependency : iter->second )
+        {
+            auto referencersIter = m_referencers.find( dependency );
+            EE_ASSERT( referencersIter != m_referencers.end() );
+            referencersIter->second.erase_first_unsorted( resourcePath );
+
+            if ( referencersIter->second.empty() )
+            {
+                m_referencers.erase( referencersIter );
+            }
+        }
+
+        m_dependencies.erase( iter );
+    }
+
+    void ResourceDatabase::RebuildDependencies()
+    {
+        m_dependencies.clear();
+        m_referencers.clear();
+
+        for ( auto const& resourceTypePair : m_resourcesPerType )
+        {
+            for ( FileEntry const* pFileEntry : resourceTypePair.second )
+            {
+                UpdateDependencies( pFileEntry );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ResourceDatabase::RemoveDirectoryRecord( FileSystem::Path const& path )
+    {
+        // The parent might have already been removed
+        auto pParentDirectory = FindDirectory( path.GetParentDirectory() );
+        if ( pParentDirectory == nullptr )
+        {
+            return;
+        }
+
+        int32_t const numDirectories = (int32_t) pParentDirectory->m_directories.size();
+        for ( int32_t i = 0; i < numDirectories; i++ )
+        {
+            if ( pParentDirectory->m_directories[i].m_filePath == path )
+            {
+                // Remove all file records so that the file map and indices are kept in sync
+                TVector<FileEntry*> fileEntries;
+                GetAllFileEntries( pParentDirectory->m_directories[i], fileEntries );
+
+                TVector<FileSystem::Path> filePaths;
+                filePaths.reserve( fileEntries.size() );
+                for ( FileEntry const* pFileEntry : fileEntries )
+                {
+                    filePaths.emplace_back( pFileEntry->m_filePath );
+                }
+
+                for ( auto const& filePath : filePaths )
+                {
+                    RemoveFileRecord( filePath );
+                }
+
+                // Delete all children and remove directory
+                pParentDirectory->m_directories[i].Clear();
+                pParentDirectory->m_directories.erase_unsorted( pParentDirectory->m_directories.begin() + i );
+                break;
+            }
+        }
+    }
+
     // Watcher Events
     //-------------------------------------------------------------------------
 
@@ -601,6 +1271,8 @@ namespace EE::Resource
             m_filesystemCacheUpdatedEvent.Execute();
         }
 
+        m_isSnapshotDirty = true;
+
         //-------------------------------------------------------------------------
 
         auto const& fsEvents = m_fileSystemWatcher.GetFileSystemChangeEvents();
@@ -643,9 +1315,12 @@ namespace EE::Resource
                     {
                         if ( pDirectory->m_files[i]->m_filePath == fsEvent.m_path )
                         {
+                            pDirectory->m_files[i]->m_modifiedTime = FileSystem::GetFileModifiedTime( fsEvent.m_path );
+
                             if ( pDirectory->m_files[i]->m_isRegisteredResourceType )
                             {
                                 pDirectory->m_files[i]->ReloadDescriptor( *m_pTypeRegistry );
+                                UpdateDependencies( pDirectory->m_files[i] );
                             }
 
                             break;
@@ -684,20 +1359,8 @@ namespace EE::Resource
 
                 case FileSystem::Watcher::Event::DirectoryDeleted:
                 {
-                    auto pParentDirectory = FindDirectory( fsEvent.m_path.GetParentDirectory() );
-                    EE_ASSERT( pParentDirectory != nullptr );
-
-                    int32_t const numDirectories = (int32_t) pParentDirectory->m_directories.size();
-                    for ( int32_t i = 0; i < numDirectories; i++ )
-                    {
-                        if ( pParentDirectory->m_directories[i].m_filePath == fsEvent.m_path )
-                        {
-                            // Delete all children and remove directory
-                            pParentDirectory->m_directories[i].Clear();
-                            pParentDirectory->m_directories.erase_unsorted( pParentDirectory->m_directories.begin() + i );
-                            break;
-                        }
-                    }
+                    EE_ASSERT( FindDirectory( fsEvent.m_path.GetParentDirectory() ) != nullptr );
+                    RemoveDirectoryRecord( fsEvent.m_path );
                 }
                 break;
 
@@ -752,7 +1415,28 @@ namespace EE::Resource
                     //-------------------------------------------------------------------------
 
                     EE_ASSERT( pDirectory != nullptr );
+
+                    // Remove all renamed files from the file map and indices
+                    TVector<FileEntry*> fileEntries;
+                    GetAllFileEntries( *pDirectory, fileEntries );
+                    for ( FileEntry const* pFileEntry : fileEntries )
+                    {
+                        ResourcePath const& oldResourcePath = pFileEntry->m_resourceID.GetResourcePath();
+                        m_resourcesPerPath.erase( oldResourcePath );
+                        m_searchIndex.RemovePath( oldResourcePath );
+                        RemoveDependencies( oldResourcePath );
+                    }
+
                     pDirectory->ChangePath( m_rawResourceDirPath, fsEvent.m_path );
+
+                    // Re-add the files with their new paths
+                    for ( FileEntry* pFileEntry : fileEntries )
+                    {
+                        ResourcePath const& newResourcePath = pFileEntry->m_resourceID.GetResourcePath();
+                        m_resourcesPerPath[newResourcePath] = pFileEntry;
+                        m_searchIndex.AddPath( newResourcePath );
+                        UpdateDependencies( pFileEntry );
+                    }
                 }
                 break;
 
@@ -1,6 +1,9 @@
 #pragma once
+#include "ResourceSearchIndex.h"
 #include "EngineTools/Core/FileSystem/FileSystemWatcher.h"
 #include "Base/Resource/ResourceID.h"
+#include "Base/Serialization/BinarySerialization.h"
+#include "Base/Time/Timers.h"
 #include "Base/Types/StringID.h"
 #include "Base/Types/Event.h"
 #include "Base/Types/HashMap.h"
@@ -23,6 +26,13 @@ namespace EE::Resource
     // Maintains a DB of all source resources in the source data folder
     //-------------------------------------------------------------------------
     // The way we load descriptors is pretty naive and can definitely be improved
+    //
+    // The database persists a snapshot of all its records (timestamps, descriptor hashes and descriptor data) on shutdown
+    // On startup, the file system cache is immediately built from the snapshot and then reconciled with the actual file system in the background
+    // Only descriptors whose files have changed are read from disk, all others are read from the snapshot
+    //
+    // The database also maintains a search index over all resource paths and a dependency graph (compile and install dependencies) for all descriptors
+    // Both are kept up to date with file system changes, so searches and referencer queries never need to load any descriptors
 
     class EE_ENGINETOOLS_API ResourceDatabase final
     {
@@ -32,10 +42,21 @@ namespace EE::Resource
         {
             Empty,
             BuildingFileSystemCache,
+            ReconcilingFileSystemCache, // The file system cache was loaded from the snapshot and is being checked against the file system
             BuildingDescriptorCache,
             Ready
         };
 
+        struct BuildStats
+        {
+            Milliseconds                                            m_fileSystemCacheTime = 0;  // The time until the file system cache was available
+            Milliseconds                                            m_totalTime = 0;            // The time until all descriptors were loaded
+            int32_t                                                 m_numFiles = 0;
+            int32_t                                                 m_numDescriptorsReadFromDisk = 0;        // Includes modified descriptors that were re-read while reconciling the snapshot
+            int32_t                                                 m_numDescriptorsReadFromSnapshot = 0;
+            bool                                                    m_usedSnapshot = false;
+        };
+
         struct FileEntry
         {
             FileEntry() = default;
@@ -48,12 +69,15 @@ namespace EE::Resource
 
             // Descriptor
             void LoadDescriptor( TypeSystem::TypeRegistry const& typeRegistry );
+            void LoadDescriptorFromData( TypeSystem::TypeRegistry const& typeRegistry, String const& descriptorData );
             void ReloadDescriptor( TypeSystem::TypeRegistry const& typeRegistry );
 
         public:
 
             ResourceID                                              m_resourceID;
             FileSystem::Path                                        m_filePath;
+            uint64_t                                                m_modifiedTime = 0;
+            uint64_t                                                m_contentHash = 0;          // Only set for descriptors
             bool                                                    m_isRegisteredResourceType = false;
             struct ResourceDescriptor*                              m_pDescriptor = nullptr;
         };
@@ -148,14 +172,71 @@ namespace EE::Resource
         // Event that fires whenever a resource is deleted
         TEventHandle<ResourceID> OnResourceDeleted() const { return m_resourceDeletedEvent; }
 
+        // Search / Dependencies
+        //-------------------------------------------------------------------------
+
+        // Find all resources whose path contains all the supplied search tokens (case insensitive)
+        void FindResources( TVector<String> const& searchTokens, TVector<FileEntry const*>& outResults ) const;
+
+        // Get all the resources that a resource depends on (both compile and install dependencies) - only complete once the descriptor cache is built
+        TVector<ResourcePath> const& GetDependencies( ResourcePath const& resourcePath ) const;
+
+        // Get all the resources that depend on a resource - only complete once the descriptor cache is built
+        TVector<ResourcePath> const& GetReferencers( ResourcePath const& resourcePath ) const;
+
+        // Get the timings for the last database build
+        inline BuildStats const& GetBuildStats() const { return m_buildStats; }
+
+    private:
+
+        struct SnapshotFileRecord
+        {
+            EE_SERIALIZE( m_path, m_modifiedTime, m_contentHash, m_descriptorData );
+
+            String                                                  m_path;
+            uint64_t                                                m_modifiedTime = 0;
+            uint64_t                                                m_contentHash = 0;
+            String                                                  m_descriptorData;
+        };
+
+        struct Snapshot
+        {
+            EE_SERIALIZE( m_version, m_directories, m_files );
+
+            int32_t                                                 m_version = 0;
+            TVector<String>                                         m_directories;
+            TVector<SnapshotFileRecord>                             m_files;
+        };
+
+        // The differences between the snapshot and the file system
+        struct ReconcileResult
+        {
+            TVector<FileSystem::Path>                               m_addedDirectories;
+            TVector<FileSystem::Path>                               m_removedDirectories;
+            TVector<FileSystem::Path>                               m_addedFiles;
+            TVector<FileSystem::Path>                               m_removedFiles;
+            TVector<int32_t>                                        m_modifiedFileRecords;      // Snapshot records updated with the new file state
+        };
+
     private:
 
         void ClearDatabase();
 
+        // Reset the file system cache to an empty root directory
+        void ResetFileSystemCache();
+
         void StartFilesystemCacheBuild();
 
         void StartDescriptorCacheBuild();
 
+        // Snapshot
+        FileSystem::Path GetSnapshotFilePath() const { return m_compiledResourceDirPath + "ResourceDatabase.snapshot"; }
+        bool TryLoadSnapshot();
+        void SaveSnapshot() const;
+        void StartSnapshotReconcile();
+        void ApplyReconcileResult();
+        void OnBuildComplete();
+
         // Cancel the rebuild of the database
         void CancelDatabaseBuild();
 
@@ -163,9 +244,15 @@ namespace EE::Resource
         DirectoryEntry* FindDirectory( FileSystem::Path const& dirPath );
         DirectoryEntry* FindOrCreateDirectory( FileSystem::Path const& dirPath );
 
-        // Add/Remove records
-        FileEntry* AddFileRecord( FileSystem::Path const& path, bool loadDescriptor );
+        // Add/Remove records - if no modified time is supplied, it will be read from the file system
+        FileEntry* AddFileRecord( FileSystem::Path const& path, bool loadDescriptor, uint64_t modifiedTime = 0 );
         void RemoveFileRecord( FileSystem::Path const& path );
+        void RemoveDirectoryRecord( FileSystem::Path const& path );
+
+        // Dependency graph
+        void UpdateDependencies( FileEntry const* pFileEntry );
+        void RemoveDependencies( ResourcePath const& resourcePath );
+        void RebuildDependencies();
 
         // File system listener
         void ProcessFileSystemChanges();
@@ -188,6 +275,11 @@ namespace EE::Resource
         mutable TEvent<>                                            m_filesystemCacheUpdatedEvent;
         mutable TEvent<ResourceID>                                  m_resourceDeletedEvent;
 
+        // Search / Dependencies
+        ResourceSearchIndex                                         m_searchIndex;
+        THashMap<ResourcePath, TVector<ResourcePath>>               m_dependencies;
+        THashMap<ResourcePath, TVector<ResourcePath>>               m_referencers;
+
         // Build state
         std::atomic<DatabaseState>                                  m_state = DatabaseState::Empty;
         ITaskSet*                                                   m_pAsyncTask = nullptr;
@@ -195,5 +287,17 @@ namespace EE::Resource
         std::atomic<int32_t>                                        m_numItemsProcessed = 0;
         int32_t                                                     m_totalItemsToProcess = 1;
         TVector<FileEntry*>                                         m_descriptorsToLoad;
+        TVector<String const*>                                      m_descriptorsToLoadData;    // Snapshot data for each descriptor to load, null if it needs to be read from disk
+
+        // Snapshot
+        Snapshot                                                    m_snapshot;
+        THashMap<ResourcePath, int32_t>                             m_snapshotFileLookup;
+        ReconcileResult                                             m_reconcileResult;
+        bool                                                        m_isSnapshotDirty = false;
+
+        // Stats
+        Timer<PlatformClock>                                        m_buildTimer;
+        BuildStats                                                  m_buildStats;
+        std::atomic<int32_t>                                        m_numDescriptorsReadFromDisk = 0;
     };
 }
\ No newline at end of file
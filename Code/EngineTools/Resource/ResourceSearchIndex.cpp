@@ -0,0 +1,203 @@
+#include "ResourceSearchIndex.h"
+#include "EASTL/sort.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    void ResourceSearchIndex::GetTrigrams( char const* pString, size_t length, TVector<Trigram>& outTrigrams )
+    {
+        outTrigrams.clear();
+
+        if ( length < 3 )
+        {
+            return;
+        }
+
+        for ( size_t i = 0; i < length - 2; i++ )
+        {
+            Trigram const trigram = ( uint32_t( (uint8_t) pString[i] ) << 16 ) | ( uint32_t( (uint8_t) pString[i + 1] ) << 8 ) | uint32_t( (uint8_t) pString[i + 2] );
+            outTrigrams.emplace_back( trigram );
+        }
+
+        eastl::sort( outTrigrams.begin(), outTrigrams.end() );
+        outTrigrams.erase( eastl::unique( outTrigrams.begin(), outTrigrams.end() ), outTrigrams.end() );
+    }
+
+    String ResourceSearchIndex::GetSearchString( ResourcePath const& path )
+    {
+        EE_ASSERT( path.IsValid() );
+        String searchString( path.c_str() + ResourcePath::s_pathPrefixLength );
+        searchString.make_lower();
+        return searchString;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ResourceSearchIndex::Clear()
+    {
+        m_paths.clear();
+        m_searchStrings.clear();
+        m_freeIDs.clear();
+        m_pathToID.clear();
+        m_trigramToIDs.clear();
+    }
+
+    void ResourceSearchIndex::AddPath( ResourcePath const& path )
+    {
+        EE_ASSERT( path.IsValid() );
+
+        if ( Contains( path ) )
+        {
+            return;
+        }
+
+        // Allocate ID
+        //-------------------------------------------------------------------------
+
+        uint32_t ID = 0;
+        if ( !m_freeIDs.empty() )
+        {
+            ID = m_freeIDs.back();
+            m_freeIDs.pop_back();
+        }
+        else
+        {
+            ID = (uint32_t) m_paths.size();
+            m_paths.emplace_back();
+            m_searchStrings.emplace_back();
+        }
+
+        m_paths[ID] = path;
+        m_searchStrings[ID] = GetSearchString( path );
+        m_pathToID.insert( TPair<ResourcePath, uint32_t>( path, ID ) );
+
+        // Add to trigram lists, reused IDs mean that we cant simply append
+        //-------------------------------------------------------------------------
+
+        TVector<Trigram> trigrams;
+        GetTrigrams( m_searchStrings[ID].c_str(), m_searchStrings[ID].length(), trigrams );
+        for ( Trigram trigram : trigrams )
+        {
+            TVector<uint32_t>& IDs = m_trigramToIDs[trigram];
+            IDs.insert( eastl::lower_bound( IDs.begin(), IDs.end(), ID ), ID );
+        }
+    }
+
+    void ResourceSearchIndex::RemovePath( ResourcePath const& path )
+    {
+        auto iter = m_pathToID.find( path );
+        if ( iter == m_pathToID.end() )
+        {
+            return;
+        }
+
+        uint32_t const ID = iter->second;
+        m_pathToID.erase( iter );
+
+        // Remove from trigram lists
+        //-------------------------------------------------------------------------
+
+        TVector<Trigram> trigrams;
+        GetTrigrams( m_searchStrings[ID].c_str(), m_searchStrings[ID].length(), trigrams );
+        for ( Trigram trigram : trigrams )
+        {
+            auto trigramIter = m_trigramToIDs.find( trigram );
+            EE_ASSERT( trigramIter != m_trigramToIDs.end() );
+
+            TVector<uint32_t>& IDs = trigramIter->second;
+            auto IDIter = eastl::lower_bound( IDs.begin(), IDs.end(), ID );
+            EE_ASSERT( IDIter != IDs.end() && *IDIter == ID );
+            IDs.erase( IDIter );
+
+            if ( IDs.empty() )
+            {
+                m_trigramToIDs.erase( trigramIter );
+            }
+        }
+
+        // Release ID
+        //-------------------------------------------------------------------------
+
+        m_paths[ID].Clear();
+        m_searchStrings[ID].clear();
+        m_freeIDs.emplace_back( ID );
+    }
+
+    void ResourceSearchIndex::Search( TVector<String> const& searchTokens, TVector<ResourcePath>& outResults ) const
+    {
+        outResults.clear();
+
+        TInlineVector<String, 4> tokens;
+        for ( String const& searchToken : searchTokens )
+        {
+            if ( !searchToken.empty() )
+            {
+                String& token = tokens.emplace_back( searchToken );
+                token.make_lower();
+            }
+        }
+
+        // Find the smallest candidate list, if any trigram is missing then nothing can match
+        //-------------------------------------------------------------------------
+
+        TVector<uint32_t> const* pCandidateIDs = nullptr;
+
+        TVector<Trigram> trigrams;
+        for ( String const& token : tokens )
+        {
+            GetTrigrams( token.c_str(), token.length(), trigrams );
+            for ( Trigram trigram : trigrams )
+            {
+                auto trigramIter = m_trigramToIDs.find( trigram );
+                if ( trigramIter == m_trigramToIDs.end() )
+                {
+                    return;
+                }
+
+                if ( pCandidateIDs == nullptr || trigramIter->second.size() < pCandidateIDs->size() )
+                {
+                    pCandidateIDs = &trigramIter->second;
+                }
+            }
+        }
+
+        // Verify candidates
+        //-------------------------------------------------------------------------
+
+        auto MatchesAllTokens = [&tokens] ( String const& searchString )
+        {
+            for ( String const& token : tokens )
+            {
+                if ( searchString.find( token ) == String::npos )
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        // Only short tokens were supplied, so we need to check every path
+        if ( pCandidateIDs == nullptr )
+        {
+            uint32_t const numIDs = (uint32_t) m_paths.size();
+            for ( uint32_t ID = 0; ID < numIDs; ID++ )
+            {
+                if ( m_paths[ID].IsValid() && MatchesAllTokens( m_searchStrings[ID] ) )
+                {
+                    outResults.emplace_back( m_paths[ID] );
+                }
+            }
+        }
+        else
+        {
+            for ( uint32_t ID : *pCandidateIDs )
+            {
+                if ( MatchesAllTokens( m_searchStrings[ID] ) )
+                {
+                    outResults.emplace_back( m_paths[ID] );
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "EngineTools/_Module/API.h"
+#include "Base/Resource/ResourcePath.h"
+#include "Base/Types/HashMap.h"
+#include "Base/Types/String.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Resource Search Index
+//-------------------------------------------------------------------------
+// A trigram index over resource paths used to find all resources whose path contains a set of search tokens
+//
+// Every path is assigned an ID and each trigram (three consecutive lower case characters) in the path has a sorted list of the IDs of the paths that contain it
+// A search only needs to look at the paths in the shortest list for the trigrams in the search tokens, instead of every path in the database
+// The candidates are then verified against the full tokens, so tokens shorter than a trigram are still supported
+
+namespace EE::Resource
+{
+    class EE_ENGINETOOLS_API ResourceSearchIndex
+    {
+        using Trigram = uint32_t;
+
+    public:
+
+        inline int32_t GetNumPaths() const { return (int32_t) m_pathToID.size(); }
+        inline bool Contains( ResourcePath const& path ) const { return m_pathToID.find( path ) != m_pathToID.end(); }
+
+        void Clear();
+
+        void AddPath( ResourcePath const& path );
+        void RemovePath( ResourcePath const& path );
+
+        // Find all paths containing all the supplied tokens (case insensitive), no tokens will return all paths
+        void Search( TVector<String> const& searchTokens, TVector<ResourcePath>& outResults ) const;
+
+    private:
+
+        // Get the unique trigrams for a lower case string
+        static void GetTrigrams( char const* pString, size_t length, TVector<Trigram>& outTrigrams );
+
+        // The searchable part of a path, i.e. the lower case path without the resource path prefix
+        static String GetSearchString( ResourcePath const& path );
+
+    private:
+
+        TVector<ResourcePath>                   m_paths;            // Indexed by ID, invalid for free IDs
+        TVector<String>                         m_searchStrings;    // Indexed by ID
+        TVector<uint32_t>                       m_freeIDs;
+        THashMap<ResourcePath, uint32_t>        m_pathToID;
+        THashMap<Trigram, TVector<uint32_t>>    m_trigramToIDs;
+    };
+}
@@ -54,6 +54,19 @@ namespace EE::AI
     void AIDebugView::DrawOverviewWindow( EntityWorldUpdateContext const& context )
     {
         ImGui::Text( "Num AI: %u", m_pAIManager->m_AIs.size() );
+
+        //-------------------------------------------------------------------------
+
+        ImGui::Separator();
+
+        ImGui::Text( "Last Spawn: %d AI in %.3fms", m_pAIManager->m_lastSpawnCount, m_pAIManager->m_lastSpawnTime.ToFloat() );
+
+        auto const poolStats = m_pWorld->GetPersistentMap()->GetPoolStats();
+        ImGui::Text( "Pools: %d", poolStats.m_numPools );
+        ImGui::Text( "Active Instances: %d", poolStats.m_numActiveInstances );
+        ImGui::Text( "Free Instances: %d", poolStats.m_numInactiveInstances );
+        ImGui::Text( "Pooled Spawns: %d", poolStats.m_numPooledSpawns );
+        ImGui::Text( "Unpooled Spawns: %d", poolStats.m_numUnpooledSpawns );
     }
 }
 #endif
\ No newline at end of file
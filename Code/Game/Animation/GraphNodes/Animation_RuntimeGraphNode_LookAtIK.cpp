@@ -28,9 +28,9 @@ namespace EE::Animation::GraphNodes
         PassthroughNode::ShutdownInternal( context );
     }
 
-    GraphPoseNodeResult LookAtIKNode::Update( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
+    GraphPoseNodeResult LookAtIKNode::UpdateInternal( GraphContext& context, SyncTrackTimeRange const* pUpdateRange )
     {
-        GraphPoseNodeResult result = PassthroughNode::Update( context, pUpdateRange );
+        GraphPoseNodeResult result = PassthroughNode::UpdateInternal( context, pUpdateRange );
         if ( result.HasRegisteredTasks() )
         {
             result = RegisterIKTask( context, result );
@@ -13,6 +13,12 @@ namespace EE
         EE_ASSERT( m_coverVolumes.empty() );
     }
 
+    bool CoverManager::GetComponentInterests( WorldSystemComponentInterests& outInterests ) const
+    {
+        outInterests.Includes<CoverVolumeComponent>();
+        return true;
+    }
+
     void CoverManager::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
     {
         if ( auto pCoverComponent = TryCast<CoverVolumeComponent>( pComponent ) )
@@ -31,6 +37,12 @@ namespace EE
 
     //-------------------------------------------------------------------------
 
+    bool CoverManager::GetUpdateDependencies( UpdateStage stage, WorldSystemUpdateDependencies& outDependencies ) const
+    {
+        outDependencies.Writes<CoverVolumeComponent>();
+        return true;
+    }
+
     void CoverManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
     }
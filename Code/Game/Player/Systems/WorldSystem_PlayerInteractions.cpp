@@ -20,6 +20,13 @@ namespace EE::Player
 
     //-------------------------------------------------------------------------
 
+    bool PlayerInteractionSystem::GetComponentInterests( WorldSystemComponentInterests& outInterests ) const
+    {
+        outInterests.Includes<MainPlayerComponent>();
+        outInterests.Includes<PlayerInteractibleComponent>();
+        return true;
+    }
+
     void PlayerInteractionSystem::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
     {
         if ( auto pPlayerComponent = TryCast<MainPlayerComponent>( pComponent ) )
@@ -51,6 +58,12 @@ namespace EE::Player
 
     //-------------------------------------------------------------------------
 
+    bool PlayerInteractionSystem::GetUpdateDependencies( UpdateStage stage, WorldSystemUpdateDependencies& outDependencies ) const
+    {
+        outDependencies.Writes<MainPlayerComponent>().Reads<PlayerInteractibleComponent>().Reads<SpatialEntityComponent>();
+        return true;
+    }
+
     void PlayerInteractionSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         if ( !ctx.IsGameWorld() )
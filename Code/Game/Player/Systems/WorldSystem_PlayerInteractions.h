@@ -33,8 +33,10 @@ namespace EE::Player
         virtual void ShutdownSystem() override;
 
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override;
+        virtual bool GetComponentInterests( WorldSystemComponentInterests& outInterests ) const override;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual bool GetUpdateDependencies( UpdateStage stage, WorldSystemUpdateDependencies& outDependencies ) const override;
 
     private:
 